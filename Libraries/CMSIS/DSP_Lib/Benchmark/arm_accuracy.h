@@ -0,0 +1,148 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* Project: 	    CMSIS DSP Library
+* Title:		arm_accuracy.h
+*
+* Description:	Kernel table and double precision reference kernels of the
+*               DSP library accuracy harness.
+*
+* Target Processor: Host (ARM_MATH_HOST) / Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#ifndef _ARM_ACCURACY_H
+#define _ARM_ACCURACY_H
+
+#include "arm_math.h"
+
+/**
+ * @brief Longest test signal and filter the buffers are sized for.
+ */
+#define ARM_ACC_MAX_LEN         8192u
+#define ARM_ACC_MAX_TAPS        512u
+
+/**
+ * @brief Number of elements in each output buffer; the interpolators produce
+ * ARM_ACC_FACTOR outputs per input and the correlations 2 * srcLen - 1.
+ */
+#define ARM_ACC_BUF_LEN         (ARM_ACC_FACTOR * ARM_ACC_MAX_LEN + 2u * ARM_ACC_MAX_TAPS)
+
+/**
+ * @brief Block size the streaming kernels are called with.  Signals are
+ * processed as a sequence of blocks so that the state handling between
+ * calls is part of what is measured.
+ */
+#define ARM_ACC_BLOCK           64u
+
+/**
+ * @brief Fixed parameters of the test cases: second order sections of the
+ * biquad cascades, decimation and interpolation factor, and complex FFT length.
+ */
+#define ARM_ACC_NUM_STAGES      2u
+#define ARM_ACC_FACTOR          4u
+#define ARM_ACC_FFT_LEN         256u
+
+/**
+ * @brief Largest number of taps the solvers are run with: the normal equations
+ * of the solve family are numTaps x numTaps.
+ */
+#define ARM_ACC_MAX_SOLVE       64u
+
+/**
+ * @brief Data formats.  The biquad coefficients of the fixed-point kernels
+ * are stored with one integer bit (Q30 / Q14) and a postShift of 1.
+ */
+typedef enum
+{
+  ARM_ACC_F32 = 0,
+  ARM_ACC_Q31,
+  ARM_ACC_Q15,
+  ARM_ACC_Q7
+} arm_acc_format;
+
+/**
+ * @brief One test case as seen by a kernel.
+ *
+ * All values are doubles already quantized to the kernel's format, so the
+ * conversion to the native type is exact and the reference sees the same
+ * input and coefficients as the kernel under test; the measured error is the
+ * error of the kernel's arithmetic alone.
+ */
+typedef struct
+{
+  arm_acc_format format;                /**< format of the kernel under test. */
+  const double *pSrc;                   /**< input signal, full scale is +/-1. */
+  uint32_t srcLen;                      /**< number of input samples, a multiple of ARM_ACC_BLOCK. */
+  const double *pCoeffs;                /**< FIR coefficients in library (time reversed) order. */
+  uint32_t numTaps;                     /**< number of FIR coefficients. */
+  const double *pSos;                   /**< biquad coefficients {b0, b1, b2, a1, a2} per stage. */
+} arm_acc_case;
+
+/**
+ * @brief One entry of the kernel table.
+ *
+ * <code>ref</code> and <code>run</code> write the reference and the kernel
+ * output to <code>pDst</code> as doubles in the same units and return the
+ * number of outputs; <code>run</code> returns 0 when the kernel rejects the
+ * case (e.g. an odd tap count for the Q15 FIR).
+ */
+typedef struct
+{
+  const char *name;                     /**< library function under test. */
+  const char *family;                   /**< kernels sharing a reference. */
+  const char *type;                     /**< data type: q7, q15, q31 or f32. */
+  arm_acc_format format;                /**< data format of the kernel. */
+  uint32_t (*ref) (const arm_acc_case * c, double *pDst);
+  uint32_t (*run) (const arm_acc_case * c, double *pDst);
+} arm_acc_kernel;
+
+extern const arm_acc_kernel armAccKernels[];
+extern const uint32_t armAccKernelsCount;
+
+/**
+ * @brief Double precision reference kernels.  They follow the definitions
+ * in the library documentation, including the output scaling of the
+ * fixed-point FFTs, with no rounding or saturation.
+ */
+uint32_t arm_acc_ref_fir(
+  const arm_acc_case * c,
+  double *pDst);
+
+uint32_t arm_acc_ref_fir_decimate(
+  const arm_acc_case * c,
+  double *pDst);
+
+uint32_t arm_acc_ref_fir_interpolate(
+  const arm_acc_case * c,
+  double *pDst);
+
+uint32_t arm_acc_ref_biquad(
+  const arm_acc_case * c,
+  double *pDst);
+
+uint32_t arm_acc_ref_conv(
+  const arm_acc_case * c,
+  double *pDst);
+
+uint32_t arm_acc_ref_correlate(
+  const arm_acc_case * c,
+  double *pDst);
+
+uint32_t arm_acc_ref_cfft(
+  const arm_acc_case * c,
+  double *pDst);
+
+uint32_t arm_acc_ref_solve(
+  const arm_acc_case * c,
+  double *pDst);
+
+/**
+ * @brief Normal equations R * h = p of the least-squares identification of
+ * the FIR filter from its input and output, shared by the solve family.
+ */
+void arm_acc_normal_equations(
+  const arm_acc_case * c,
+  double *pR,
+  double *pP);
+
+#endif /* _ARM_ACCURACY_H */
@@ -0,0 +1,1225 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* Project: 	    CMSIS DSP Library
+* Title:		arm_accuracy_kernels.c
+*
+* Description:	Kernel table of the accuracy harness.  Every entry converts
+*               the test case to its native type, runs the library kernel
+*               and converts the result back to doubles.
+*
+* Target Processor: Host (ARM_MATH_HOST) / Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include <math.h>
+#include <string.h>
+#include "arm_accuracy.h"
+
+/**
+ * @brief The fast Q15 convolutions and correlations read the word before an
+ * odd-length second operand, so the coefficients start a few words in.
+ */
+#define ACC_GUARD               4u
+
+static float32_t accSrc_f32[ARM_ACC_MAX_LEN];
+static float32_t accDst_f32[ARM_ACC_BUF_LEN];
+static float32_t accCoeff_f32[ARM_ACC_MAX_TAPS + ACC_GUARD];
+static float32_t accState_f32[ARM_ACC_MAX_TAPS + ARM_ACC_BLOCK];
+
+static q31_t accSrc_q31[ARM_ACC_MAX_LEN];
+static q31_t accDst_q31[ARM_ACC_BUF_LEN];
+static q31_t accCoeff_q31[ARM_ACC_MAX_TAPS + ACC_GUARD];
+static q31_t accState_q31[ARM_ACC_MAX_TAPS + ARM_ACC_BLOCK];
+
+static q15_t accSrc_q15[ARM_ACC_MAX_LEN];
+static q15_t accDst_q15[ARM_ACC_BUF_LEN];
+static q15_t accCoeff_q15[ARM_ACC_MAX_TAPS + ACC_GUARD];
+static q15_t accState_q15[ARM_ACC_MAX_TAPS + ARM_ACC_BLOCK];
+
+static q7_t accSrc_q7[ARM_ACC_MAX_LEN];
+static q7_t accDst_q7[ARM_ACC_BUF_LEN];
+static q7_t accCoeff_q7[ARM_ACC_MAX_TAPS + ACC_GUARD];
+static q7_t accState_q7[ARM_ACC_MAX_TAPS + ARM_ACC_BLOCK];
+
+static q63_t accState_q63[4u * ARM_ACC_NUM_STAGES];
+
+/* ----------------------------------------------------------------------
+** Conversions.  The case values are already quantized, so these are exact
+** apart from the clipping of +1.0 to the largest fixed-point value.
+** ------------------------------------------------------------------- */
+
+static q63_t acc_fixed(
+  double in,
+  uint32_t fracBits)
+{
+  double maxVal = ldexp(1.0, (int) fracBits);
+  double v = floor((in * maxVal) + 0.5);
+
+  v = (v >= maxVal) ? (maxVal - 1.0) : ((v < -maxVal) ? -maxVal : v);
+
+  return ((q63_t) v);
+}
+
+static void acc_to_f32(
+  const double *pSrc,
+  float32_t * pDst,
+  uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    pDst[i] = (float32_t) pSrc[i];
+  }
+}
+
+static void acc_to_q31(
+  const double *pSrc,
+  q31_t * pDst,
+  uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    pDst[i] = (q31_t) acc_fixed(pSrc[i], 31u);
+  }
+}
+
+static void acc_to_q15(
+  const double *pSrc,
+  q15_t * pDst,
+  uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    pDst[i] = (q15_t) acc_fixed(pSrc[i], 15u);
+  }
+}
+
+static void acc_to_q7(
+  const double *pSrc,
+  q7_t * pDst,
+  uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    pDst[i] = (q7_t) acc_fixed(pSrc[i], 7u);
+  }
+}
+
+static void acc_from_f32(
+  const float32_t * pSrc,
+  double *pDst,
+  uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    pDst[i] = (double) pSrc[i];
+  }
+}
+
+static void acc_from_q31(
+  const q31_t * pSrc,
+  double *pDst,
+  uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    pDst[i] = ldexp((double) pSrc[i], -31);
+  }
+}
+
+static void acc_from_q15(
+  const q15_t * pSrc,
+  double *pDst,
+  uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    pDst[i] = ldexp((double) pSrc[i], -15);
+  }
+}
+
+static void acc_from_q7(
+  const q7_t * pSrc,
+  double *pDst,
+  uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    pDst[i] = ldexp((double) pSrc[i], -7);
+  }
+}
+
+/**
+ * @brief Biquad coefficients in the fixed-point layout: halved into Q30 / Q14
+ * and, for Q15, with the zero between b0 and b1 used by the SIMD code.
+ */
+
+static void acc_sos_q31(
+  const double *pSos,
+  q31_t * pDst)
+{
+  uint32_t i;
+
+  for (i = 0u; i < 5u * ARM_ACC_NUM_STAGES; i++)
+  {
+    pDst[i] = (q31_t) acc_fixed(0.5 * pSos[i], 31u);
+  }
+}
+
+static void acc_sos_q15(
+  const double *pSos,
+  q15_t * pDst)
+{
+  uint32_t s;
+
+  for (s = 0u; s < ARM_ACC_NUM_STAGES; s++)
+  {
+    pDst[6u * s] = (q15_t) acc_fixed(0.5 * pSos[5u * s], 15u);
+    pDst[(6u * s) + 1u] = 0;
+    pDst[(6u * s) + 2u] = (q15_t) acc_fixed(0.5 * pSos[(5u * s) + 1u], 15u);
+    pDst[(6u * s) + 3u] = (q15_t) acc_fixed(0.5 * pSos[(5u * s) + 2u], 15u);
+    pDst[(6u * s) + 4u] = (q15_t) acc_fixed(0.5 * pSos[(5u * s) + 3u], 15u);
+    pDst[(6u * s) + 5u] = (q15_t) acc_fixed(0.5 * pSos[(5u * s) + 4u], 15u);
+  }
+}
+
+/* ----------------------------------------------------------------------
+** FIR filters
+** ------------------------------------------------------------------- */
+
+typedef void (*acc_fir_q31_fn) (const arm_fir_instance_q31 *, q31_t *, q31_t *, uint32_t);
+typedef void (*acc_fir_q15_fn) (const arm_fir_instance_q15 *, q15_t *, q15_t *, uint32_t);
+
+static uint32_t acc_arm_fir_f32(
+  const arm_acc_case * c,
+  double *pDst)
+{
+  arm_fir_instance_f32 S;
+  uint32_t i;
+
+  acc_to_f32(c->pSrc, accSrc_f32, c->srcLen);
+  acc_to_f32(c->pCoeffs, accCoeff_f32, c->numTaps);
+  arm_fir_init_f32(&S, (uint16_t) c->numTaps, accCoeff_f32, accState_f32, ARM_ACC_BLOCK);
+
+  for (i = 0u; i < c->srcLen; i += ARM_ACC_BLOCK)
+  {
+    arm_fir_f32(&S, &accSrc_f32[i], &accDst_f32[i], ARM_ACC_BLOCK);
+  }
+
+  acc_from_f32(accDst_f32, pDst, c->srcLen);
+
+  return (c->srcLen);
+}
+
+static uint32_t acc_fir_q31(
+  const arm_acc_case * c,
+  double *pDst,
+  acc_fir_q31_fn fn)
+{
+  arm_fir_instance_q31 S;
+  uint32_t i;
+
+  acc_to_q31(c->pSrc, accSrc_q31, c->srcLen);
+  acc_to_q31(c->pCoeffs, accCoeff_q31, c->numTaps);
+  arm_fir_init_q31(&S, (uint16_t) c->numTaps, accCoeff_q31, accState_q31, ARM_ACC_BLOCK);
+
+  for (i = 0u; i < c->srcLen; i += ARM_ACC_BLOCK)
+  {
+    fn(&S, &accSrc_q31[i], &accDst_q31[i], ARM_ACC_BLOCK);
+  }
+
+  acc_from_q31(accDst_q31, pDst, c->srcLen);
+
+  return (c->srcLen);
+}
+
+static uint32_t acc_fir_q15(
+  const arm_acc_case * c,
+  double *pDst,
+  acc_fir_q15_fn fn)
+{
+  arm_fir_instance_q15 S;
+  uint32_t i;
+
+  acc_to_q15(c->pSrc, accSrc_q15, c->srcLen);
+  acc_to_q15(c->pCoeffs, accCoeff_q15, c->numTaps);
+
+  if(arm_fir_init_q15(&S, (uint16_t) c->numTaps, accCoeff_q15, accState_q15,
+                      ARM_ACC_BLOCK) != ARM_MATH_SUCCESS)
+  {
+    return (0u);
+  }
+
+  for (i = 0u; i < c->srcLen; i += ARM_ACC_BLOCK)
+  {
+    fn(&S, &accSrc_q15[i], &accDst_q15[i], ARM_ACC_BLOCK);
+  }
+
+  acc_from_q15(accDst_q15, pDst, c->srcLen);
+
+  return (c->srcLen);
+}
+
+static uint32_t acc_arm_fir_q31(
+  const arm_acc_case * c,
+  double *pDst)
+{
+  return (acc_fir_q31(c, pDst, arm_fir_q31));
+}
+
+static uint32_t acc_arm_fir_fast_q31(
+  const arm_acc_case * c,
+  double *pDst)
+{
+  return (acc_fir_q31(c, pDst, arm_fir_fast_q31));
+}
+
+static uint32_t acc_arm_fir_q15(
+  const arm_acc_case * c,
+  double *pDst)
+{
+  return (acc_fir_q15(c, pDst, arm_fir_q15));
+}
+
+static uint32_t acc_arm_fir_fast_q15(
+  const arm_acc_case * c,
+  double *pDst)
+{
+  return (acc_fir_q15(c, pDst, arm_fir_fast_q15));
+}
+
+static uint32_t acc_arm_fir_q7(
+  const arm_acc_case * c,
+  double *pDst)
+{
+  arm_fir_instance_q7 S;
+  uint32_t i;
+
+  acc_to_q7(c->pSrc, accSrc_q7, c->srcLen);
+  acc_to_q7(c->pCoeffs, accCoeff_q7, c->numTaps);
+  arm_fir_init_q7(&S, (uint16_t) c->numTaps, accCoeff_q7, accState_q7, ARM_ACC_BLOCK);
+
+  for (i = 0u; i < c->srcLen; i += ARM_ACC_BLOCK)
+  {
+    arm_fir_q7(&S, &accSrc_q7[i], &accDst_q7[i], ARM_ACC_BLOCK);
+  }
+
+  acc_from_q7(accDst_q7, pDst, c->srcLen);
+
+  return (c->srcLen);
+}
+
+/* ----------------------------------------------------------------------
+** Decimators and interpolators
+** ------------------------------------------------------------------- */
+
+typedef void (*acc_decimate_q31_fn) (const arm_fir_decimate_instance_q31 *, q31_t *,
+                                     q31_t *, uint32_t);
+typedef void (*acc_decimate_q15_fn) (const arm_fir_decimate_instance_q15 *, q15_t *,
+                                     q15_t *, uint32_t);
+
+static uint32_t acc_arm_fir_decimate_f32(
+  const arm_acc_case * c,
+  double *pDst)
+{
+  arm_fir_decimate_instance_f32 S;
+  uint32_t i;
+
+  acc_to_f32(c->pSrc, accSrc_f32, c->srcLen);
+  acc_to_f32(c->pCoeffs, accCoeff_f32, c->numTaps);
+
+  if(arm_fir_decimate_init_f32(&S, (uint16_t) c->numTaps, (uint8_t) ARM_ACC_FACTOR,
+                               accCoeff_f32, accState_f32, ARM_ACC_BLOCK) != ARM_MATH_SUCCESS)
+  {
+    return (0u);
+  }
+
+  for (i = 0u; i < c->srcLen; i += ARM_ACC_BLOCK)
+  {
+    arm_fir_decimate_f32(&S, &accSrc_f32[i], &accDst_f32[i / ARM_ACC_FACTOR], ARM_ACC_BLOCK);
+  }
+
+  acc_from_f32(accDst_f32, pDst, c->srcLen / ARM_ACC_FACTOR);
+
+  return (c->srcLen / ARM_ACC_FACTOR);
+}
+
+static uint32_t acc_fir_decimate_q31(
+  const arm_acc_case * c,
+  double *pDst,
+  acc_decimate_q31_fn fn)
+{
+  arm_fir_decimate_instance_q31 S;
+  uint32_t i;
+
+  acc_to_q31(c->pSrc, accSrc_q31, c->srcLen);
+  acc_to_q31(c->pCoeffs, accCoeff_q31, c->numTaps);
+
+  if(arm_fir_decimate_init_q31(&S, (uint16_t) c->numTaps, (uint8_t) ARM_ACC_FACTOR,
+                               accCoeff_q31, accState_q31, ARM_ACC_BLOCK) != ARM_MATH_SUCCESS)
+  {
+    return (0u);
+  }
+
+  for (i = 0u; i < c->srcLen; i += ARM_ACC_BLOCK)
+  {
+    fn(&S, &accSrc_q31[i], &accDst_q31[i / ARM_ACC_FACTOR], ARM_ACC_BLOCK);
+  }
+
+  acc_from_q31(accDst_q31, pDst, c->srcLen / ARM_ACC_FACTOR);
+
+  return (c->srcLen / ARM_ACC_FACTOR);
+}
+
+static uint32_t acc_fir_decimate_q15(
+  const arm_acc_case * c,
+  double *pDst,
+  acc_decimate_q15_fn fn)
+{
+  arm_fir_decimate_instance_q15 S;
+  uint32_t i;
+
+  acc_to_q15(c->pSrc, accSrc_q15, c->srcLen);
+  acc_to_q15(c->pCoeffs, accCoeff_q15, c->numTaps);
+
+  if(arm_fir_decimate_init_q15(&S, (uint16_t) c->numTaps, (uint8_t) ARM_ACC_FACTOR,
+                               accCoeff_q15, accState_q15, ARM_ACC_BLOCK) != ARM_MATH_SUCCESS)
+  {
+    return (0u);
+  }
+
+  for (i = 0u; i < c->srcLen; i += ARM_ACC_BLOCK)
+  {
+    fn(&S, &accSrc_q15[i], &accDst_q15[i / ARM_ACC_FACTOR], ARM_ACC_BLOCK);
+  }
+
+  acc_from_q15(accDst_q15, pDst, c->srcLen / ARM_ACC_FACTOR);
+
+  return (c->srcLen / ARM_ACC_FACTOR);
+}
+
+static uint32_t acc_arm_fir_decimate_q31(
+  const arm_acc_case * c,
+  double *pDst)
+{
+  return (acc_fir_decimate_q31(c, pDst, arm_fir_decimate_q31));
+}
+
+static uint32_t acc_arm_fir_decimate_fast_q31(
+  const arm_acc_case * c,
+  double *pDst)
+{
+  return (acc_fir_decimate_q31(c, pDst, arm_fir_decimate_fast_q31));
+}
+
+static uint32_t acc_arm_fir_decimate_q15(
+  const arm_acc_case * c,
+  double *pDst)
+{
+  return (acc_fir_decimate_q15(c, pDst, arm_fir_decimate_q15));
+}
+
+static uint32_t acc_arm_fir_decimate_fast_q15(
+  const arm_acc_case * c,
+  double *pDst)
+{
+  return (acc_fir_decimate_q15(c, pDst, arm_fir_decimate_fast_q15));
+}
+
+static uint32_t acc_arm_fir_interpolate_f32(
+  const arm_acc_case * c,
+  double *pDst)
+{
+  arm_fir_interpolate_instance_f32 S;
+  uint32_t i;
+
+  acc_to_f32(c->pSrc, accSrc_f32, c->srcLen);
+  acc_to_f32(c->pCoeffs, accCoeff_f32, c->numTaps);
+
+  if(arm_fir_interpolate_init_f32(&S, (uint8_t) ARM_ACC_FACTOR, (uint16_t) c->numTaps,
+                                  accCoeff_f32, accState_f32, ARM_ACC_BLOCK) != ARM_MATH_SUCCESS)
+  {
+    return (0u);
+  }
+
+  for (i = 0u; i < c->srcLen; i += ARM_ACC_BLOCK)
+  {
+    arm_fir_interpolate_f32(&S, &accSrc_f32[i], &accDst_f32[i * ARM_ACC_FACTOR], ARM_ACC_BLOCK);
+  }
+
+  acc_from_f32(accDst_f32, pDst, c->srcLen * ARM_ACC_FACTOR);
+
+  return (c->srcLen * ARM_ACC_FACTOR);
+}
+
+static uint32_t acc_arm_fir_interpolate_q31(
+  const arm_acc_case * c,
+  double *pDst)
+{
+  arm_fir_interpolate_instance_q31 S;
+  uint32_t i;
+
+  acc_to_q31(c->pSrc, accSrc_q31, c->srcLen);
+  acc_to_q31(c->pCoeffs, accCoeff_q31, c->numTaps);
+
+  if(arm_fir_interpolate_init_q31(&S, (uint8_t) ARM_ACC_FACTOR, (uint16_t) c->numTaps,
+                                  accCoeff_q31, accState_q31, ARM_ACC_BLOCK) != ARM_MATH_SUCCESS)
+  {
+    return (0u);
+  }
+
+  for (i = 0u; i < c->srcLen; i += ARM_ACC_BLOCK)
+  {
+    arm_fir_interpolate_q31(&S, &accSrc_q31[i], &accDst_q31[i * ARM_ACC_FACTOR], ARM_ACC_BLOCK);
+  }
+
+  acc_from_q31(accDst_q31, pDst, c->srcLen * ARM_ACC_FACTOR);
+
+  return (c->srcLen * ARM_ACC_FACTOR);
+}
+
+static uint32_t acc_arm_fir_interpolate_q15(
+  const arm_acc_case * c,
+  double *pDst)
+{
+  arm_fir_interpolate_instance_q15 S;
+  uint32_t i;
+
+  acc_to_q15(c->pSrc, accSrc_q15, c->srcLen);
+  acc_to_q15(c->pCoeffs, accCoeff_q15, c->numTaps);
+
+  if(arm_fir_interpolate_init_q15(&S, (uint8_t) ARM_ACC_FACTOR, (uint16_t) c->numTaps,
+                                  accCoeff_q15, accState_q15, ARM_ACC_BLOCK) != ARM_MATH_SUCCESS)
+  {
+    return (0u);
+  }
+
+  for (i = 0u; i < c->srcLen; i += ARM_ACC_BLOCK)
+  {
+    arm_fir_interpolate_q15(&S, &accSrc_q15[i], &accDst_q15[i * ARM_ACC_FACTOR], ARM_ACC_BLOCK);
+  }
+
+  acc_from_q15(accDst_q15, pDst, c->srcLen * ARM_ACC_FACTOR);
+
+  return (c->srcLen * ARM_ACC_FACTOR);
+}
+
+/* ----------------------------------------------------------------------
+** Biquad cascades
+** ------------------------------------------------------------------- */
+
+typedef void (*acc_biquad_q31_fn) (const arm_biquad_casd_df1_inst_q31 *, q31_t *, q31_t *,
+                                   uint32_t);
+typedef void (*acc_biquad_q15_fn) (const arm_biquad_casd_df1_inst_q15 *, q15_t *, q15_t *,
+                                   uint32_t);
+
+static uint32_t acc_arm_biquad_cascade_df1_f32(
+  const arm_acc_case * c,
+  double *pDst)
+{
+  arm_biquad_casd_df1_inst_f32 S;
+  uint32_t i;
+
+  acc_to_f32(c->pSrc, accSrc_f32, c->srcLen);
+  acc_to_f32(c->pSos, accCoeff_f32, 5u * ARM_ACC_NUM_STAGES);
+  arm_biquad_cascade_df1_init_f32(&S, ARM_ACC_NUM_STAGES, accCoeff_f32, accState_f32);
+
+  for (i = 0u; i < c->srcLen; i += ARM_ACC_BLOCK)
+  {
+    arm_biquad_cascade_df1_f32(&S, &accSrc_f32[i], &accDst_f32[i], ARM_ACC_BLOCK);
+  }
+
+  acc_from_f32(accDst_f32, pDst, c->srcLen);
+
+  return (c->srcLen);
+}
+
+static uint32_t acc_arm_biquad_cascade_df2T_f32(
+  const arm_acc_case * c,
+  double *pDst)
+{
+  arm_biquad_cascade_df2T_instance_f32 S;
+  uint32_t i;
+
+  acc_to_f32(c->pSrc, accSrc_f32, c->srcLen);
+  acc_to_f32(c->pSos, accCoeff_f32, 5u * ARM_ACC_NUM_STAGES);
+  arm_biquad_cascade_df2T_init_f32(&S, ARM_ACC_NUM_STAGES, accCoeff_f32, accState_f32);
+
+  for (i = 0u; i < c->srcLen; i += ARM_ACC_BLOCK)
+  {
+    arm_biquad_cascade_df2T_f32(&S, &accSrc_f32[i], &accDst_f32[i], ARM_ACC_BLOCK);
+  }
+
+  acc_from_f32(accDst_f32, pDst, c->srcLen);
+
+  return (c->srcLen);
+}
+
+static uint32_t acc_biquad_q31(
+  const arm_acc_case * c,
+  double *pDst,
+  acc_biquad_q31_fn fn)
+{
+  arm_biquad_casd_df1_inst_q31 S;
+  uint32_t i;
+
+  acc_to_q31(c->pSrc, accSrc_q31, c->srcLen);
+  acc_sos_q31(c->pSos, accCoeff_q31);
+  arm_biquad_cascade_df1_init_q31(&S, ARM_ACC_NUM_STAGES, accCoeff_q31, accState_q31, 1);
+
+  for (i = 0u; i < c->srcLen; i += ARM_ACC_BLOCK)
+  {
+    fn(&S, &accSrc_q31[i], &accDst_q31[i], ARM_ACC_BLOCK);
+  }
+
+  acc_from_q31(accDst_q31, pDst, c->srcLen);
+
+  return (c->srcLen);
+}
+
+static uint32_t acc_biquad_q15(
+  const arm_acc_case * c,
+  double *pDst,
+  acc_biquad_q15_fn fn)
+{
+  arm_biquad_casd_df1_inst_q15 S;
+  uint32_t i;
+
+  acc_to_q15(c->pSrc, accSrc_q15, c->srcLen);
+  acc_sos_q15(c->pSos, accCoeff_q15);
+  arm_biquad_cascade_df1_init_q15(&S, ARM_ACC_NUM_STAGES, accCoeff_q15, accState_q15, 1);
+
+  for (i = 0u; i < c->srcLen; i += ARM_ACC_BLOCK)
+  {
+    fn(&S, &accSrc_q15[i], &accDst_q15[i], ARM_ACC_BLOCK);
+  }
+
+  acc_from_q15(accDst_q15, pDst, c->srcLen);
+
+  return (c->srcLen);
+}
+
+static uint32_t acc_arm_biquad_cascade_df1_q31(
+  const arm_acc_case * c,
+  double *pDst)
+{
+  return (acc_biquad_q31(c, pDst, arm_biquad_cascade_df1_q31));
+}
+
+static uint32_t acc_arm_biquad_cascade_df1_fast_q31(
+  const arm_acc_case * c,
+  double *pDst)
+{
+  return (acc_biquad_q31(c, pDst, arm_biquad_cascade_df1_fast_q31));
+}
+
+static uint32_t acc_arm_biquad_cascade_df1_q15(
+  const arm_acc_case * c,
+  double *pDst)
+{
+  return (acc_biquad_q15(c, pDst, arm_biquad_cascade_df1_q15));
+}
+
+static uint32_t acc_arm_biquad_cascade_df1_fast_q15(
+  const arm_acc_case * c,
+  double *pDst)
+{
+  return (acc_biquad_q15(c, pDst, arm_biquad_cascade_df1_fast_q15));
+}
+
+static uint32_t acc_arm_biquad_cas_df1_32x64_q31(
+  const arm_acc_case * c,
+  double *pDst)
+{
+  arm_biquad_cas_df1_32x64_ins_q31 S;
+  uint32_t i;
+
+  acc_to_q31(c->pSrc, accSrc_q31, c->srcLen);
+  acc_sos_q31(c->pSos, accCoeff_q31);
+  arm_biquad_cas_df1_32x64_init_q31(&S, ARM_ACC_NUM_STAGES, accCoeff_q31, accState_q63, 1u);
+
+  for (i = 0u; i < c->srcLen; i += ARM_ACC_BLOCK)
+  {
+    arm_biquad_cas_df1_32x64_q31(&S, &accSrc_q31[i], &accDst_q31[i], ARM_ACC_BLOCK);
+  }
+
+  acc_from_q31(accDst_q31, pDst, c->srcLen);
+
+  return (c->srcLen);
+}
+
+static uint32_t acc_arm_biquad_cascade_df2T_q31(
+  const arm_acc_case * c,
+  double *pDst)
+{
+  arm_biquad_cascade_df2T_instance_q31 S;
+  uint32_t i;
+
+  acc_to_q31(c->pSrc, accSrc_q31, c->srcLen);
+  acc_sos_q31(c->pSos, accCoeff_q31);
+  arm_biquad_cascade_df2T_init_q31(&S, ARM_ACC_NUM_STAGES, accCoeff_q31, accState_q31, 1);
+
+  for (i = 0u; i < c->srcLen; i += ARM_ACC_BLOCK)
+  {
+    arm_biquad_cascade_df2T_q31(&S, &accSrc_q31[i], &accDst_q31[i], ARM_ACC_BLOCK);
+  }
+
+  acc_from_q31(accDst_q31, pDst, c->srcLen);
+
+  return (c->srcLen);
+}
+
+static uint32_t acc_arm_biquad_cascade_df2T_q15(
+  const arm_acc_case * c,
+  double *pDst)
+{
+  arm_biquad_cascade_df2T_instance_q15 S;
+  uint32_t i;
+
+  acc_to_q15(c->pSrc, accSrc_q15, c->srcLen);
+  acc_sos_q15(c->pSos, accCoeff_q15);
+  arm_biquad_cascade_df2T_init_q15(&S, ARM_ACC_NUM_STAGES, accCoeff_q15, accState_q31, 1);
+
+  for (i = 0u; i < c->srcLen; i += ARM_ACC_BLOCK)
+  {
+    arm_biquad_cascade_df2T_q15(&S, &accSrc_q15[i], &accDst_q15[i], ARM_ACC_BLOCK);
+  }
+
+  acc_from_q15(accDst_q15, pDst, c->srcLen);
+
+  return (c->srcLen);
+}
+
+/* Error feedback biquads, second order under the function name and first
+   order with an _o1 suffix */
+
+static uint32_t acc_biquad_ef_q31(
+  const arm_acc_case * c,
+  double *pDst,
+  uint8_t efOrder)
+{
+  arm_biquad_cas_df1_ef_ins_q31 S;
+  uint32_t i;
+
+  acc_to_q31(c->pSrc, accSrc_q31, c->srcLen);
+  acc_sos_q31(c->pSos, accCoeff_q31);
+  arm_biquad_cas_df1_ef_init_q31(&S, ARM_ACC_NUM_STAGES, accCoeff_q31, accState_q31, 1u, efOrder);
+
+  for (i = 0u; i < c->srcLen; i += ARM_ACC_BLOCK)
+  {
+    arm_biquad_cas_df1_ef_q31(&S, &accSrc_q31[i], &accDst_q31[i], ARM_ACC_BLOCK);
+  }
+
+  acc_from_q31(accDst_q31, pDst, c->srcLen);
+
+  return (c->srcLen);
+}
+
+static uint32_t acc_biquad_ef_q15(
+  const arm_acc_case * c,
+  double *pDst,
+  uint8_t efOrder)
+{
+  arm_biquad_cas_df1_ef_ins_q15 S;
+  uint32_t i;
+
+  acc_to_q15(c->pSrc, accSrc_q15, c->srcLen);
+  acc_sos_q15(c->pSos, accCoeff_q15);
+  arm_biquad_cas_df1_ef_init_q15(&S, ARM_ACC_NUM_STAGES, accCoeff_q15, accState_q15, 1, efOrder);
+
+  for (i = 0u; i < c->srcLen; i += ARM_ACC_BLOCK)
+  {
+    arm_biquad_cas_df1_ef_q15(&S, &accSrc_q15[i], &accDst_q15[i], ARM_ACC_BLOCK);
+  }
+
+  acc_from_q15(accDst_q15, pDst, c->srcLen);
+
+  return (c->srcLen);
+}
+
+static uint32_t acc_arm_biquad_cas_df1_ef_q31(
+  const arm_acc_case * c,
+  double *pDst)
+{
+  return (acc_biquad_ef_q31(c, pDst, 2u));
+}
+
+static uint32_t acc_arm_biquad_cas_df1_ef_q31_o1(
+  const arm_acc_case * c,
+  double *pDst)
+{
+  return (acc_biquad_ef_q31(c, pDst, 1u));
+}
+
+static uint32_t acc_arm_biquad_cas_df1_ef_q15(
+  const arm_acc_case * c,
+  double *pDst)
+{
+  return (acc_biquad_ef_q15(c, pDst, 2u));
+}
+
+static uint32_t acc_arm_biquad_cas_df1_ef_q15_o1(
+  const arm_acc_case * c,
+  double *pDst)
+{
+  return (acc_biquad_ef_q15(c, pDst, 1u));
+}
+
+/* ----------------------------------------------------------------------
+** Convolution and correlation of the whole signal with the coefficients.
+** The correlations leave their leading zero outputs unwritten, so the
+** destination is cleared first as the library documentation asks.
+** ------------------------------------------------------------------- */
+
+typedef void (*acc_conv_f32_fn) (float32_t *, uint32_t, float32_t *, uint32_t, float32_t *);
+typedef void (*acc_conv_q31_fn) (q31_t *, uint32_t, q31_t *, uint32_t, q31_t *);
+typedef void (*acc_conv_q15_fn) (q15_t *, uint32_t, q15_t *, uint32_t, q15_t *);
+typedef void (*acc_conv_q7_fn) (q7_t *, uint32_t, q7_t *, uint32_t, q7_t *);
+
+static uint32_t acc_conv_f32(
+  const arm_acc_case * c,
+  double *pDst,
+  acc_conv_f32_fn fn,
+  uint32_t outLen)
+{
+  acc_to_f32(c->pSrc, accSrc_f32, c->srcLen);
+  acc_to_f32(c->pCoeffs, &accCoeff_f32[ACC_GUARD], c->numTaps);
+  memset(accDst_f32, 0, outLen * sizeof(float32_t));
+  fn(accSrc_f32, c->srcLen, &accCoeff_f32[ACC_GUARD], c->numTaps, accDst_f32);
+  acc_from_f32(accDst_f32, pDst, outLen);
+
+  return (outLen);
+}
+
+static uint32_t acc_conv_q31(
+  const arm_acc_case * c,
+  double *pDst,
+  acc_conv_q31_fn fn,
+  uint32_t outLen)
+{
+  acc_to_q31(c->pSrc, accSrc_q31, c->srcLen);
+  acc_to_q31(c->pCoeffs, &accCoeff_q31[ACC_GUARD], c->numTaps);
+  memset(accDst_q31, 0, outLen * sizeof(q31_t));
+  fn(accSrc_q31, c->srcLen, &accCoeff_q31[ACC_GUARD], c->numTaps, accDst_q31);
+  acc_from_q31(accDst_q31, pDst, outLen);
+
+  return (outLen);
+}
+
+static uint32_t acc_conv_q15(
+  const arm_acc_case * c,
+  double *pDst,
+  acc_conv_q15_fn fn,
+  uint32_t outLen)
+{
+  acc_to_q15(c->pSrc, accSrc_q15, c->srcLen);
+  acc_to_q15(c->pCoeffs, &accCoeff_q15[ACC_GUARD], c->numTaps);
+  memset(accDst_q15, 0, outLen * sizeof(q15_t));
+  fn(accSrc_q15, c->srcLen, &accCoeff_q15[ACC_GUARD], c->numTaps, accDst_q15);
+  acc_from_q15(accDst_q15, pDst, outLen);
+
+  return (outLen);
+}
+
+static uint32_t acc_conv_q7(
+  const arm_acc_case * c,
+  double *pDst,
+  acc_conv_q7_fn fn,
+  uint32_t outLen)
+{
+  acc_to_q7(c->pSrc, accSrc_q7, c->srcLen);
+  acc_to_q7(c->pCoeffs, &accCoeff_q7[ACC_GUARD], c->numTaps);
+  memset(accDst_q7, 0, outLen * sizeof(q7_t));
+  fn(accSrc_q7, c->srcLen, &accCoeff_q7[ACC_GUARD], c->numTaps, accDst_q7);
+  acc_from_q7(accDst_q7, pDst, outLen);
+
+  return (outLen);
+}
+
+#define ACC_CONV(fn, T) \
+  static uint32_t acc_##fn(const arm_acc_case * c, double *pDst) \
+  { return (acc_conv_##T(c, pDst, fn, c->srcLen + c->numTaps - 1u)); }
+
+#define ACC_CORRELATE(fn, T) \
+  static uint32_t acc_##fn(const arm_acc_case * c, double *pDst) \
+  { return (acc_conv_##T(c, pDst, fn, (2u * c->srcLen) - 1u)); }
+
+ACC_CONV(arm_conv_f32, f32)
+ACC_CONV(arm_conv_q31, q31)
+ACC_CONV(arm_conv_fast_q31, q31)
+ACC_CONV(arm_conv_q15, q15)
+ACC_CONV(arm_conv_fast_q15, q15)
+ACC_CONV(arm_conv_q7, q7)
+ACC_CORRELATE(arm_correlate_f32, f32)
+ACC_CORRELATE(arm_correlate_q31, q31)
+ACC_CORRELATE(arm_correlate_fast_q31, q31)
+ACC_CORRELATE(arm_correlate_q15, q15)
+ACC_CORRELATE(arm_correlate_fast_q15, q15)
+ACC_CORRELATE(arm_correlate_q7, q7)
+
+/* ----------------------------------------------------------------------
+** FFT convolutions and correlations.  At the default lengths the cost
+** model picks the direct algorithm, so the "_n512" entries also run the
+** FFT core at a fixed length of 512 to check it against the references.
+** ------------------------------------------------------------------- */
+
+static float32_t accScratch_f32[(4u * 2048u) + 4u + ARM_ACC_MAX_LEN + ARM_ACC_MAX_TAPS];
+
+static uint32_t acc_conv_fft_f32(
+  const arm_acc_case * c,
+  double *pDst,
+  uint16_t fftLen,
+  uint8_t correlate)
+{
+  uint32_t outLen = (correlate != 0u) ? ((2u * c->srcLen) - 1u) : ((c->srcLen + c->numTaps) - 1u);
+  uint32_t offset = (correlate != 0u) ? (c->srcLen - c->numTaps) : 0u;
+
+  acc_to_f32(c->pSrc, accSrc_f32, c->srcLen);
+  acc_to_f32(c->pCoeffs, accCoeff_f32, c->numTaps);
+
+  if(fftLen == 0u)
+  {
+    if(correlate != 0u)
+    {
+      arm_correlate_fft_f32(accSrc_f32, c->srcLen, accCoeff_f32, c->numTaps, accDst_f32, accScratch_f32);
+    }
+    else
+    {
+      arm_conv_fft_f32(accSrc_f32, c->srcLen, accCoeff_f32, c->numTaps, accDst_f32, accScratch_f32);
+    }
+  }
+  else
+  {
+    memset(accDst_f32, 0, outLen * sizeof(float32_t));
+    arm_conv_fft_core_f32(accSrc_f32, c->srcLen, accCoeff_f32, c->numTaps,
+                          &accDst_f32[offset], accScratch_f32, fftLen, correlate);
+  }
+
+  acc_from_f32(accDst_f32, pDst, outLen);
+
+  return (outLen);
+}
+
+static uint32_t acc_conv_fft_q15(
+  const arm_acc_case * c,
+  double *pDst,
+  uint16_t fftLen,
+  uint8_t correlate)
+{
+  uint32_t outLen = (correlate != 0u) ? ((2u * c->srcLen) - 1u) : ((c->srcLen + c->numTaps) - 1u);
+  uint32_t offset = (correlate != 0u) ? (c->srcLen - c->numTaps) : 0u;
+  float32_t *pAcc = &accScratch_f32[(4u * 2048u) + 4u];
+
+  acc_to_q15(c->pSrc, accSrc_q15, c->srcLen);
+  acc_to_q15(c->pCoeffs, accCoeff_q15, c->numTaps);
+
+  if(fftLen == 0u)
+  {
+    if(correlate != 0u)
+    {
+      arm_correlate_fft_q15(accSrc_q15, c->srcLen, accCoeff_q15, c->numTaps, accDst_q15, accScratch_f32);
+    }
+    else
+    {
+      arm_conv_fft_q15(accSrc_q15, c->srcLen, accCoeff_q15, c->numTaps, accDst_q15, accScratch_f32);
+    }
+  }
+  else
+  {
+    memset(pAcc, 0, outLen * sizeof(float32_t));
+    arm_conv_fft_core_q15(accSrc_q15, c->srcLen, accCoeff_q15, c->numTaps,
+                          &pAcc[offset], accScratch_f32, fftLen, correlate);
+    arm_conv_fft_to_q15(pAcc, accDst_q15, outLen);
+  }
+
+  acc_from_q15(accDst_q15, pDst, outLen);
+
+  return (outLen);
+}
+
+#define ACC_CONV_FFT(fn, T, fftLen, correlate) \
+  static uint32_t acc_##fn(const arm_acc_case * c, double *pDst) \
+  { return (acc_conv_fft_##T(c, pDst, fftLen, correlate)); }
+
+ACC_CONV_FFT(arm_conv_fft_f32, f32, 0u, 0u)
+ACC_CONV_FFT(arm_conv_fft_f32_n512, f32, 512u, 0u)
+ACC_CONV_FFT(arm_conv_fft_q15, q15, 0u, 0u)
+ACC_CONV_FFT(arm_conv_fft_q15_n512, q15, 512u, 0u)
+ACC_CONV_FFT(arm_correlate_fft_f32, f32, 0u, 1u)
+ACC_CONV_FFT(arm_correlate_fft_f32_n512, f32, 512u, 1u)
+ACC_CONV_FFT(arm_correlate_fft_q15, q15, 0u, 1u)
+ACC_CONV_FFT(arm_correlate_fft_q15_n512, q15, 512u, 1u)
+
+/* ----------------------------------------------------------------------
+** Complex FFTs, in place on a copy of the first ARM_ACC_FFT_LEN samples
+** ------------------------------------------------------------------- */
+
+static uint32_t acc_arm_cfft_radix4_f32(
+  const arm_acc_case * c,
+  double *pDst)
+{
+  arm_cfft_radix4_instance_f32 S;
+
+  if((c->srcLen < (2u * ARM_ACC_FFT_LEN)) ||
+     (arm_cfft_radix4_init_f32(&S, ARM_ACC_FFT_LEN, 0u, 1u) != ARM_MATH_SUCCESS))
+  {
+    return (0u);
+  }
+
+  acc_to_f32(c->pSrc, accDst_f32, 2u * ARM_ACC_FFT_LEN);
+  arm_cfft_radix4_f32(&S, accDst_f32);
+  acc_from_f32(accDst_f32, pDst, 2u * ARM_ACC_FFT_LEN);
+
+  return (2u * ARM_ACC_FFT_LEN);
+}
+
+static uint32_t acc_arm_cfft_radix4_q31(
+  const arm_acc_case * c,
+  double *pDst)
+{
+  arm_cfft_radix4_instance_q31 S;
+
+  if((c->srcLen < (2u * ARM_ACC_FFT_LEN)) ||
+     (arm_cfft_radix4_init_q31(&S, ARM_ACC_FFT_LEN, 0u, 1u) != ARM_MATH_SUCCESS))
+  {
+    return (0u);
+  }
+
+  acc_to_q31(c->pSrc, accDst_q31, 2u * ARM_ACC_FFT_LEN);
+  arm_cfft_radix4_q31(&S, accDst_q31);
+  acc_from_q31(accDst_q31, pDst, 2u * ARM_ACC_FFT_LEN);
+
+  return (2u * ARM_ACC_FFT_LEN);
+}
+
+static uint32_t acc_arm_cfft_radix4_q15(
+  const arm_acc_case * c,
+  double *pDst)
+{
+  arm_cfft_radix4_instance_q15 S;
+
+  if((c->srcLen < (2u * ARM_ACC_FFT_LEN)) ||
+     (arm_cfft_radix4_init_q15(&S, ARM_ACC_FFT_LEN, 0u, 1u) != ARM_MATH_SUCCESS))
+  {
+    return (0u);
+  }
+
+  acc_to_q15(c->pSrc, accDst_q15, 2u * ARM_ACC_FFT_LEN);
+  arm_cfft_radix4_q15(&S, accDst_q15);
+  acc_from_q15(accDst_q15, pDst, 2u * ARM_ACC_FFT_LEN);
+
+  return (2u * ARM_ACC_FFT_LEN);
+}
+
+/* ----------------------------------------------------------------------
+** Linear system solvers on the normal equations R * h = p of the solve
+** family.  The output is R * h in double precision, so the error against
+** the reference p is the residual of the solution.
+** ------------------------------------------------------------------- */
+
+enum
+{
+  ACC_SOLVE_INVERSE = 0,
+  ACC_SOLVE_LU,
+  ACC_SOLVE_LDLT,
+  ACC_SOLVE_QR
+};
+
+static double accR[ARM_ACC_MAX_SOLVE * ARM_ACC_MAX_SOLVE];
+static float32_t accMatA_f32[ARM_ACC_MAX_SOLVE * ARM_ACC_MAX_SOLVE];
+static float32_t accMatB_f32[ARM_ACC_MAX_SOLVE * ARM_ACC_MAX_SOLVE];
+static float32_t accVec_f32[ARM_ACC_MAX_SOLVE];
+static uint16_t accPerm[ARM_ACC_MAX_SOLVE];
+
+static uint32_t acc_solve_f32(
+  const arm_acc_case * c,
+  double *pDst,
+  uint32_t method)
+{
+  arm_matrix_instance_f32 A, B, P, H;
+  arm_status status;
+  uint32_t N = c->numTaps;
+  uint32_t i, j;
+  double sum;
+
+  if(N > ARM_ACC_MAX_SOLVE)
+  {
+    return (0u);
+  }
+
+  arm_acc_normal_equations(c, accR, pDst);
+  acc_to_f32(accR, accMatA_f32, N * N);
+  acc_to_f32(pDst, accVec_f32, N);
+
+  arm_mat_init_f32(&A, (uint16_t) N, (uint16_t) N, accMatA_f32);
+  arm_mat_init_f32(&P, (uint16_t) N, 1u, accVec_f32);
+  arm_mat_init_f32(&H, (uint16_t) N, 1u, accDst_f32);
+
+  switch (method)
+  {
+  case ACC_SOLVE_INVERSE:
+    arm_mat_init_f32(&B, (uint16_t) N, (uint16_t) N, accMatB_f32);
+    status = arm_mat_inverse_f32(&A, &B);
+
+    if(status == ARM_MATH_SUCCESS)
+    {
+      status = arm_mat_mult_f32(&B, &P, &H);
+    }
+    break;
+
+  case ACC_SOLVE_LU:
+    status = arm_mat_lu_f32(&A, accPerm);
+
+    if(status == ARM_MATH_SUCCESS)
+    {
+      status = arm_mat_lu_solve_f32(&A, accPerm, &P, &H);
+    }
+    break;
+
+  case ACC_SOLVE_LDLT:
+    status = arm_mat_ldlt_f32(&A);
+
+    if(status == ARM_MATH_SUCCESS)
+    {
+      status = arm_mat_ldlt_solve_f32(&A, &P, &H);
+    }
+    break;
+
+  default:
+    status = arm_mat_qr_f32(&A, accState_f32);
+
+    if(status == ARM_MATH_SUCCESS)
+    {
+      status = arm_mat_qr_solve_f32(&A, accState_f32, &P, &H, accCoeff_f32);
+    }
+    break;
+  }
+
+  if(status != ARM_MATH_SUCCESS)
+  {
+    return (0u);
+  }
+
+  /* Residual form: R * h with the f32 values of R, which the reference rounded the same way */
+  for (i = 0u; i < N; i++)
+  {
+    sum = 0.0;
+
+    for (j = 0u; j < N; j++)
+    {
+      sum += accR[(i * N) + j] * accDst_f32[j];
+    }
+
+    pDst[i] = sum;
+  }
+
+  return (N);
+}
+
+#define ACC_SOLVE(fn, method) \
+  static uint32_t acc_##fn(const arm_acc_case * c, double *pDst) \
+  { return (acc_solve_f32(c, pDst, method)); }
+
+ACC_SOLVE(arm_mat_inverse_f32, ACC_SOLVE_INVERSE)
+ACC_SOLVE(arm_mat_lu_solve_f32, ACC_SOLVE_LU)
+ACC_SOLVE(arm_mat_ldlt_solve_f32, ACC_SOLVE_LDLT)
+ACC_SOLVE(arm_mat_qr_solve_f32, ACC_SOLVE_QR)
+
+/* ----------------------------------------------------------------------
+** Kernel table.  Names match the speed benchmark so that the two CSV
+** outputs can be joined on the kernel column.
+** ------------------------------------------------------------------- */
+
+#define ACC_ENTRY(fn, family, type, format, ref) \
+  { #fn, family, #type, format, arm_acc_ref_##ref, acc_##fn }
+
+/* The biquads again on the low cutoff highpass of the biquad_dc family */
+#define ACC_ENTRY_DC(fn, type, format) \
+  { #fn "_dc", "biquad_dc", #type, format, arm_acc_ref_biquad, acc_##fn }
+
+const arm_acc_kernel armAccKernels[] = {
+  ACC_ENTRY(arm_fir_f32, "fir", f32, ARM_ACC_F32, fir),
+  ACC_ENTRY(arm_fir_q31, "fir", q31, ARM_ACC_Q31, fir),
+  ACC_ENTRY(arm_fir_fast_q31, "fir", q31, ARM_ACC_Q31, fir),
+  ACC_ENTRY(arm_fir_q15, "fir", q15, ARM_ACC_Q15, fir),
+  ACC_ENTRY(arm_fir_fast_q15, "fir", q15, ARM_ACC_Q15, fir),
+  ACC_ENTRY(arm_fir_q7, "fir", q7, ARM_ACC_Q7, fir),
+  ACC_ENTRY(arm_fir_decimate_f32, "fir_decimate", f32, ARM_ACC_F32, fir_decimate),
+  ACC_ENTRY(arm_fir_decimate_q31, "fir_decimate", q31, ARM_ACC_Q31, fir_decimate),
+  ACC_ENTRY(arm_fir_decimate_fast_q31, "fir_decimate", q31, ARM_ACC_Q31, fir_decimate),
+  ACC_ENTRY(arm_fir_decimate_q15, "fir_decimate", q15, ARM_ACC_Q15, fir_decimate),
+  ACC_ENTRY(arm_fir_decimate_fast_q15, "fir_decimate", q15, ARM_ACC_Q15, fir_decimate),
+  ACC_ENTRY(arm_fir_interpolate_f32, "fir_interpolate", f32, ARM_ACC_F32, fir_interpolate),
+  ACC_ENTRY(arm_fir_interpolate_q31, "fir_interpolate", q31, ARM_ACC_Q31, fir_interpolate),
+  ACC_ENTRY(arm_fir_interpolate_q15, "fir_interpolate", q15, ARM_ACC_Q15, fir_interpolate),
+  ACC_ENTRY(arm_biquad_cascade_df1_f32, "biquad", f32, ARM_ACC_F32, biquad),
+  ACC_ENTRY(arm_biquad_cascade_df2T_f32, "biquad", f32, ARM_ACC_F32, biquad),
+  ACC_ENTRY(arm_biquad_cascade_df1_q31, "biquad", q31, ARM_ACC_Q31, biquad),
+  ACC_ENTRY(arm_biquad_cascade_df1_fast_q31, "biquad", q31, ARM_ACC_Q31, biquad),
+  ACC_ENTRY(arm_biquad_cas_df1_32x64_q31, "biquad", q31, ARM_ACC_Q31, biquad),
+  ACC_ENTRY(arm_biquad_cascade_df2T_q31, "biquad", q31, ARM_ACC_Q31, biquad),
+  ACC_ENTRY(arm_biquad_cascade_df1_q15, "biquad", q15, ARM_ACC_Q15, biquad),
+  ACC_ENTRY(arm_biquad_cascade_df1_fast_q15, "biquad", q15, ARM_ACC_Q15, biquad),
+  ACC_ENTRY(arm_biquad_cascade_df2T_q15, "biquad", q15, ARM_ACC_Q15, biquad),
+  ACC_ENTRY(arm_biquad_cas_df1_ef_q31, "biquad", q31, ARM_ACC_Q31, biquad),
+  ACC_ENTRY(arm_biquad_cas_df1_ef_q31_o1, "biquad", q31, ARM_ACC_Q31, biquad),
+  ACC_ENTRY(arm_biquad_cas_df1_ef_q15, "biquad", q15, ARM_ACC_Q15, biquad),
+  ACC_ENTRY(arm_biquad_cas_df1_ef_q15_o1, "biquad", q15, ARM_ACC_Q15, biquad),
+  ACC_ENTRY_DC(arm_biquad_cascade_df1_f32, f32, ARM_ACC_F32),
+  ACC_ENTRY_DC(arm_biquad_cascade_df2T_f32, f32, ARM_ACC_F32),
+  ACC_ENTRY_DC(arm_biquad_cascade_df1_q31, q31, ARM_ACC_Q31),
+  ACC_ENTRY_DC(arm_biquad_cascade_df1_fast_q31, q31, ARM_ACC_Q31),
+  ACC_ENTRY_DC(arm_biquad_cas_df1_32x64_q31, q31, ARM_ACC_Q31),
+  ACC_ENTRY_DC(arm_biquad_cascade_df2T_q31, q31, ARM_ACC_Q31),
+  ACC_ENTRY_DC(arm_biquad_cas_df1_ef_q31, q31, ARM_ACC_Q31),
+  ACC_ENTRY_DC(arm_biquad_cas_df1_ef_q31_o1, q31, ARM_ACC_Q31),
+  ACC_ENTRY_DC(arm_biquad_cascade_df1_q15, q15, ARM_ACC_Q15),
+  ACC_ENTRY_DC(arm_biquad_cascade_df1_fast_q15, q15, ARM_ACC_Q15),
+  ACC_ENTRY_DC(arm_biquad_cascade_df2T_q15, q15, ARM_ACC_Q15),
+  ACC_ENTRY_DC(arm_biquad_cas_df1_ef_q15, q15, ARM_ACC_Q15),
+  ACC_ENTRY_DC(arm_biquad_cas_df1_ef_q15_o1, q15, ARM_ACC_Q15),
+  ACC_ENTRY(arm_conv_f32, "conv", f32, ARM_ACC_F32, conv),
+  ACC_ENTRY(arm_conv_q31, "conv", q31, ARM_ACC_Q31, conv),
+  ACC_ENTRY(arm_conv_fast_q31, "conv", q31, ARM_ACC_Q31, conv),
+  ACC_ENTRY(arm_conv_q15, "conv", q15, ARM_ACC_Q15, conv),
+  ACC_ENTRY(arm_conv_fast_q15, "conv", q15, ARM_ACC_Q15, conv),
+  ACC_ENTRY(arm_conv_q7, "conv", q7, ARM_ACC_Q7, conv),
+  ACC_ENTRY(arm_correlate_f32, "correlate", f32, ARM_ACC_F32, correlate),
+  ACC_ENTRY(arm_correlate_q31, "correlate", q31, ARM_ACC_Q31, correlate),
+  ACC_ENTRY(arm_correlate_fast_q31, "correlate", q31, ARM_ACC_Q31, correlate),
+  ACC_ENTRY(arm_correlate_q15, "correlate", q15, ARM_ACC_Q15, correlate),
+  ACC_ENTRY(arm_correlate_fast_q15, "correlate", q15, ARM_ACC_Q15, correlate),
+  ACC_ENTRY(arm_correlate_q7, "correlate", q7, ARM_ACC_Q7, correlate),
+  ACC_ENTRY(arm_conv_fft_f32, "conv", f32, ARM_ACC_F32, conv),
+  ACC_ENTRY(arm_conv_fft_f32_n512, "conv", f32, ARM_ACC_F32, conv),
+  ACC_ENTRY(arm_conv_fft_q15, "conv", q15, ARM_ACC_Q15, conv),
+  ACC_ENTRY(arm_conv_fft_q15_n512, "conv", q15, ARM_ACC_Q15, conv),
+  ACC_ENTRY(arm_correlate_fft_f32, "correlate", f32, ARM_ACC_F32, correlate),
+  ACC_ENTRY(arm_correlate_fft_f32_n512, "correlate", f32, ARM_ACC_F32, correlate),
+  ACC_ENTRY(arm_correlate_fft_q15, "correlate", q15, ARM_ACC_Q15, correlate),
+  ACC_ENTRY(arm_correlate_fft_q15_n512, "correlate", q15, ARM_ACC_Q15, correlate),
+  ACC_ENTRY(arm_cfft_radix4_f32, "cfft", f32, ARM_ACC_F32, cfft),
+  ACC_ENTRY(arm_cfft_radix4_q31, "cfft", q31, ARM_ACC_Q31, cfft),
+  ACC_ENTRY(arm_cfft_radix4_q15, "cfft", q15, ARM_ACC_Q15, cfft),
+  ACC_ENTRY(arm_mat_inverse_f32, "solve", f32, ARM_ACC_F32, solve),
+  ACC_ENTRY(arm_mat_lu_solve_f32, "solve", f32, ARM_ACC_F32, solve),
+  ACC_ENTRY(arm_mat_ldlt_solve_f32, "solve", f32, ARM_ACC_F32, solve),
+  ACC_ENTRY(arm_mat_qr_solve_f32, "solve", f32, ARM_ACC_F32, solve),
+};
+
+const uint32_t armAccKernelsCount = sizeof(armAccKernels) / sizeof(armAccKernels[0]);
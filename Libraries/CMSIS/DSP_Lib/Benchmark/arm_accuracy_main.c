@@ -0,0 +1,613 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* Project: 	    CMSIS DSP Library
+* Title:		arm_accuracy_main.c
+*
+* Description:	Accuracy harness driver: runs every kernel variant on a set
+*               of test signals and compares it with a double precision
+*               reference.
+*
+* Target Processor: Host (ARM_MATH_HOST) / Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+/**
+ * @defgroup groupAccuracy Accuracy
+ *
+ * \par Description:
+ * \par
+ * Runs the normal and fast variants of the filtering and transform kernels
+ * in every data type on a set of test signals and compares their output
+ * with a double precision reference implementation of the same kernel.
+ * For each kernel and signal it reports
+ * - the signal to noise ratio of the output, 10 log10(sum(ref^2) / sum(err^2)),
+ *   capped at 200 dB;
+ * - the largest absolute error, relative to full scale and in LSBs of the
+ *   output type (2^-24 of full scale for f32);
+ * - the number of overflows, outputs more than 1/16 of full scale away from
+ *   the reference.  Rounding never produces errors that large; they come from
+ *   saturation or wrap-around of an intermediate or of the result.
+ *
+ * \par
+ * Inputs and coefficients are quantized to the kernel's type first and the
+ * reference is run on the quantized values, so the figures describe the
+ * kernel's arithmetic and not the input format.
+ *
+ * \par Test signals:
+ * - <code>sine</code>: 0.0123 cycles/sample at -1 dBFS;
+ * - <code>sine_quiet</code>: the same sine at -40 dBFS;
+ * - <code>noise</code>: uniform white noise at +/-0.5;
+ * - <code>chirp</code>: linear sweep from DC to Nyquist at -1 dBFS;
+ * - <code>step</code>: silence, then full scale steps between +1 and -1 every
+ *   quarter of the signal.  The filters overshoot on these, so the reference
+ *   leaves the representable range and the overflow handling of each variant
+ *   shows up.
+ *
+ * \par
+ * The FIR coefficients are a Hamming windowed lowpass at 0.1 cycles/sample
+ * with unity gain, used as the second operand of the convolutions and
+ * correlations as well.  The biquads are a 4th order Butterworth lowpass
+ * at 0.05 cycles/sample in two sections.  The <code>biquad_dc</code> family
+ * runs the same kernels on a 4th order Butterworth highpass at 0.0005
+ * cycles/sample (24 Hz at 48 kHz), a DC blocker whose poles are close to z=1,
+ * which shows the quantization noise and limit cycles of the fixed-point
+ * structures; its kernel names have a <code>_dc</code> suffix.
+ *
+ * \par
+ * The <code>solve</code> family solves the normal equations of the
+ * least-squares identification of the FIR filter from each signal,
+ * numTaps x numTaps (at most 64), with arm_mat_inverse_f32() followed by a
+ * multiplication and with the LU, LDL' and QR solvers.  The output is the
+ * product of the system matrix with the solution, so the SNR compares the
+ * right-hand side with the residual.  The narrowband signals give badly
+ * conditioned systems.
+ *
+ * \par Usage:
+ * <pre>
+ *   arm_accuracy [--format text|csv|json] [--filter STRING] [--kernel NAME]
+ *                [--signal NAME] [--length N] [--taps N]
+ *                [--compare BASELINE.csv] [--threshold DB] [--list]
+ * </pre>
+ * <code>--length</code> sets the test signal length (default 1024, rounded
+ * down to a multiple of 64) and <code>--taps</code> the FIR length (default 32).
+ * <code>--compare</code> reads a CSV written by an earlier run and marks
+ * results whose SNR dropped by more than <code>--threshold</code> dB
+ * (default 1) or whose overflow count grew as REGRESSION; the program then
+ * exits with status 1.
+ *
+ * \par
+ * The kernel names are those of the speed benchmark (\ref groupBenchmark), so
+ * the CSV outputs of the two programs can be joined on the kernel column to
+ * put the cost and the accuracy of each variant side by side.  Build with
+ * <code>arm_bench_Build.sh</code>, which builds both programs.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "arm_accuracy.h"
+
+#define ACC_MAX_BASELINE        1024u
+#define ACC_NAME_LEN            48u
+#define ACC_NUM_SIGNALS         5u
+#define ACC_SNR_CAP             200.0
+#define ACC_OVERFLOW_ERR        0.0625
+
+enum
+{
+  ACC_TEXT = 0,
+  ACC_CSV,
+  ACC_JSON
+};
+
+typedef struct
+{
+  char name[ACC_NAME_LEN];
+  char signal[16];
+  double snr;
+  uint32_t overflows;
+} acc_baseline;
+
+typedef struct
+{
+  uint32_t outputs;
+  double snr;
+  double maxErr;
+  double maxErrLsb;
+  uint32_t overflows;
+} acc_result;
+
+static const char *accSignalNames[ACC_NUM_SIGNALS] = {
+  "sine", "sine_quiet", "noise", "chirp", "step"
+};
+
+static double accSignal[ACC_NUM_SIGNALS][ARM_ACC_MAX_LEN];
+static double accTaps[ARM_ACC_MAX_TAPS];
+static double accSos[5u * ARM_ACC_NUM_STAGES];
+static double accSosDc[5u * ARM_ACC_NUM_STAGES];
+
+static double accSrc[ARM_ACC_MAX_LEN];
+static double accCoeffs[ARM_ACC_MAX_TAPS];
+static double accSosQ[5u * ARM_ACC_NUM_STAGES];
+static double accRef[ARM_ACC_BUF_LEN];
+static double accOut[ARM_ACC_BUF_LEN];
+
+static acc_baseline accBaseline[ACC_MAX_BASELINE];
+static uint32_t accNumBaseline;
+
+/* ----------------------------------------------------------------------
+** Test signals and coefficients
+** ------------------------------------------------------------------- */
+
+static void acc_make_signals(
+  uint32_t len)
+{
+  const double pi = 3.14159265358979323846;
+  const double fullScale = 0.89125093813374556;  /* -1 dBFS */
+  uint32_t seed = 0x12345678u;
+  uint32_t n, quarter = len / 4u;
+
+  for (n = 0u; n < len; n++)
+  {
+    accSignal[0][n] = fullScale * sin(2.0 * pi * 0.0123 * n);
+    accSignal[1][n] = 0.01 * sin(2.0 * pi * 0.0123 * n);
+
+    seed = (seed * 1664525u) + 1013904223u;
+    accSignal[2][n] = 0.5 * ((double) (int32_t) seed / 2147483648.0);
+
+    /* Instantaneous frequency 0.5 * n / len cycles/sample */
+    accSignal[3][n] = fullScale * sin((pi * (double) n * n) / (2.0 * len));
+
+    accSignal[4][n] = (n < quarter) ? 0.0 : (((n / quarter) & 1u) ? 1.0 : -1.0);
+  }
+}
+
+static void acc_make_filters(
+  uint32_t numTaps)
+{
+  const double pi = 3.14159265358979323846;
+  const double fc = 0.1;
+  const double q[ARM_ACC_NUM_STAGES] = { 0.54119610014619701, 1.3065629648763764 };
+  double sum = 0.0, t, w0, alpha, a0;
+  uint32_t k, s;
+
+  for (k = 0u; k < numTaps; k++)
+  {
+    t = (double) k - (0.5 * (numTaps - 1u));
+    accTaps[k] = (t == 0.0) ? (2.0 * fc) : (sin(2.0 * pi * fc * t) / (pi * t));
+
+    if(numTaps > 1u)
+    {
+      accTaps[k] *= 0.54 - (0.46 * cos((2.0 * pi * k) / (numTaps - 1u)));
+    }
+
+    sum += accTaps[k];
+  }
+
+  for (k = 0u; k < numTaps; k++)
+  {
+    accTaps[k] /= sum;
+  }
+
+  /* Butterworth sections, feedback coefficients negated as the library expects */
+  w0 = 2.0 * pi * 0.05;
+
+  for (s = 0u; s < ARM_ACC_NUM_STAGES; s++)
+  {
+    alpha = sin(w0) / (2.0 * q[s]);
+    a0 = 1.0 + alpha;
+
+    accSos[5u * s] = (0.5 * (1.0 - cos(w0))) / a0;
+    accSos[(5u * s) + 1u] = (1.0 - cos(w0)) / a0;
+    accSos[(5u * s) + 2u] = accSos[5u * s];
+    accSos[(5u * s) + 3u] = (2.0 * cos(w0)) / a0;
+    accSos[(5u * s) + 4u] = -(1.0 - alpha) / a0;
+  }
+
+  /* Butterworth highpass sections of the biquad_dc family.  b0 is put on the
+     Q14 grid so that b1 = -2 * b0 stays exact in every format and the zeros
+     at DC survive the quantization; the poles are close enough to z=1 that a
+     1 LSB error there gives a DC gain well above 1. */
+  w0 = 2.0 * pi * 0.0005;
+
+  for (s = 0u; s < ARM_ACC_NUM_STAGES; s++)
+  {
+    alpha = sin(w0) / (2.0 * q[s]);
+    a0 = 1.0 + alpha;
+
+    accSosDc[5u * s] = floor(((16384.0 * 0.5 * (1.0 + cos(w0))) / a0) + 0.5) / 16384.0;
+    accSosDc[(5u * s) + 1u] = -2.0 * accSosDc[5u * s];
+    accSosDc[(5u * s) + 2u] = accSosDc[5u * s];
+    accSosDc[(5u * s) + 3u] = (2.0 * cos(w0)) / a0;
+    accSosDc[(5u * s) + 4u] = -(1.0 - alpha) / a0;
+  }
+}
+
+/**
+ * @brief Rounds to the nearest value of the format, saturating fixed-point
+ * values to [-1, 1 - 2^-fracBits].  <code>scale</code> gives the value of the
+ * most significant fraction bit, 2 for the Q30 / Q14 biquad coefficients.
+ */
+
+static double acc_quantize(
+  double in,
+  arm_acc_format format,
+  double scale)
+{
+  uint32_t fracBits = (format == ARM_ACC_Q31) ? 31u : (format == ARM_ACC_Q15) ? 15u : 7u;
+  double maxVal, v;
+
+  if(format == ARM_ACC_F32)
+  {
+    return ((double) (float32_t) in);
+  }
+
+  maxVal = ldexp(1.0, (int) fracBits);
+  v = floor(((in / scale) * maxVal) + 0.5);
+  v = (v >= maxVal) ? (maxVal - 1.0) : ((v < -maxVal) ? -maxVal : v);
+
+  return ((v / maxVal) * scale);
+}
+
+/* ----------------------------------------------------------------------
+** Measurement
+** ------------------------------------------------------------------- */
+
+static uint32_t acc_measure(
+  const arm_acc_kernel * kernel,
+  const double *pSignal,
+  uint32_t len,
+  uint32_t numTaps,
+  acc_result * pResult)
+{
+  arm_acc_case c;
+  const double *pSos = (strcmp(kernel->family, "biquad_dc") == 0) ? accSosDc : accSos;
+  double lsb, sigPow = 0.0, errPow = 0.0, err;
+  uint32_t i, n;
+
+  for (i = 0u; i < len; i++)
+  {
+    accSrc[i] = acc_quantize(pSignal[i], kernel->format, 1.0);
+  }
+
+  for (i = 0u; i < numTaps; i++)
+  {
+    accCoeffs[i] = acc_quantize(accTaps[i], kernel->format, 1.0);
+  }
+
+  for (i = 0u; i < 5u * ARM_ACC_NUM_STAGES; i++)
+  {
+    accSosQ[i] = acc_quantize(pSos[i], kernel->format, 2.0);
+  }
+
+  c.format = kernel->format;
+  c.pSrc = accSrc;
+  c.srcLen = len;
+  c.pCoeffs = accCoeffs;
+  c.numTaps = numTaps;
+  c.pSos = accSosQ;
+
+  n = kernel->run(&c, accOut);
+
+  if((n == 0u) || (kernel->ref(&c, accRef) != n))
+  {
+    return (0u);
+  }
+
+  lsb = (kernel->format == ARM_ACC_F32) ? ldexp(1.0, -24) :
+    (kernel->format == ARM_ACC_Q31) ? ldexp(1.0, -31) :
+    (kernel->format == ARM_ACC_Q15) ? ldexp(1.0, -15) : ldexp(1.0, -7);
+
+  pResult->outputs = n;
+  pResult->maxErr = 0.0;
+  pResult->overflows = 0u;
+
+  for (i = 0u; i < n; i++)
+  {
+    err = fabs(accOut[i] - accRef[i]);
+    sigPow += accRef[i] * accRef[i];
+    errPow += err * err;
+
+    if(err > pResult->maxErr)
+    {
+      pResult->maxErr = err;
+    }
+
+    if(err > ACC_OVERFLOW_ERR)
+    {
+      pResult->overflows++;
+    }
+  }
+
+  pResult->maxErrLsb = pResult->maxErr / lsb;
+  pResult->snr = ((errPow == 0.0) || (sigPow / errPow > 1e20)) ? ACC_SNR_CAP :
+    (sigPow == 0.0) ? -ACC_SNR_CAP : 10.0 * log10(sigPow / errPow);
+
+  return (n);
+}
+
+/* ----------------------------------------------------------------------
+** Baseline comparison
+** ------------------------------------------------------------------- */
+
+static int acc_load_baseline(
+  const char *path)
+{
+  FILE *fp = fopen(path, "r");
+  char line[256];
+  acc_baseline *p;
+  char family[32], type[8];
+  uint32_t outputs;
+
+  if(fp == NULL)
+  {
+    fprintf(stderr, "arm_accuracy: cannot open baseline %s\n", path);
+    return (-1);
+  }
+
+  while((fgets(line, sizeof(line), fp) != NULL) && (accNumBaseline < ACC_MAX_BASELINE))
+  {
+    p = &accBaseline[accNumBaseline];
+
+    if(sscanf(line, "%47[^,],%31[^,],%7[^,],%15[^,],%u,%lf,%*f,%*f,%u", p->name, family,
+              type, p->signal, &outputs, &p->snr, &p->overflows) == 7)
+    {
+      accNumBaseline++;
+    }
+  }
+
+  fclose(fp);
+
+  return (0);
+}
+
+static const acc_baseline *acc_find_baseline(
+  const char *name,
+  const char *signal)
+{
+  uint32_t i;
+
+  for (i = 0u; i < accNumBaseline; i++)
+  {
+    if((strcmp(accBaseline[i].name, name) == 0) && (strcmp(accBaseline[i].signal, signal) == 0))
+    {
+      return (&accBaseline[i]);
+    }
+  }
+
+  return (NULL);
+}
+
+/* ----------------------------------------------------------------------
+** Command line
+** ------------------------------------------------------------------- */
+
+static void acc_usage(
+  void)
+{
+  fprintf(stderr,
+          "usage: arm_accuracy [--format text|csv|json] [--filter STRING] [--kernel NAME]\n"
+          "                    [--signal NAME] [--length N] [--taps N]\n"
+          "                    [--compare BASELINE.csv] [--threshold DB] [--list]\n");
+}
+
+int main(
+  int argc,
+  char *argv[])
+{
+  uint32_t len = 1024u, numTaps = 32u;
+  uint32_t format = ACC_TEXT, list = 0u;
+  double threshold = 1.0;
+  const char *filter = NULL, *name = NULL, *signal = NULL, *baseline = NULL;
+  uint32_t regressions = 0u, first = 1u;
+  uint32_t k, s;
+  int a;
+
+  for (a = 1; a < argc; a++)
+  {
+    const char *opt = argv[a];
+    const char *val = (a + 1 < argc) ? argv[a + 1] : NULL;
+
+    if(strcmp(opt, "--list") == 0)
+    {
+      list = 1u;
+      continue;
+    }
+
+    if(val == NULL)
+    {
+      acc_usage();
+      return (2);
+    }
+
+    a++;
+
+    if(strcmp(opt, "--format") == 0)
+    {
+      format = (strcmp(val, "csv") == 0) ? ACC_CSV :
+        (strcmp(val, "json") == 0) ? ACC_JSON : ACC_TEXT;
+    }
+    else if(strcmp(opt, "--filter") == 0)
+    {
+      filter = val;
+    }
+    else if(strcmp(opt, "--kernel") == 0)
+    {
+      name = val;
+    }
+    else if(strcmp(opt, "--signal") == 0)
+    {
+      signal = val;
+    }
+    else if(strcmp(opt, "--length") == 0)
+    {
+      len = (uint32_t) strtoul(val, NULL, 0);
+    }
+    else if(strcmp(opt, "--taps") == 0)
+    {
+      numTaps = (uint32_t) strtoul(val, NULL, 0);
+    }
+    else if(strcmp(opt, "--compare") == 0)
+    {
+      baseline = val;
+    }
+    else if(strcmp(opt, "--threshold") == 0)
+    {
+      threshold = atof(val);
+    }
+    else
+    {
+      acc_usage();
+      return (2);
+    }
+  }
+
+  /* The correlations need a signal at least as long as the filter */
+  len -= len % ARM_ACC_BLOCK;
+
+  if((len == 0u) || (len > ARM_ACC_MAX_LEN) || (numTaps == 0u) ||
+     (numTaps > ARM_ACC_MAX_TAPS) || (numTaps > len))
+  {
+    acc_usage();
+    return (2);
+  }
+
+  if((baseline != NULL) && (acc_load_baseline(baseline) != 0))
+  {
+    return (2);
+  }
+
+  acc_make_signals(len);
+  acc_make_filters(numTaps);
+
+  if(format == ACC_CSV)
+  {
+    printf("kernel,family,type,signal,outputs,snr_db,max_err,max_err_lsb,overflows%s\n",
+           (baseline != NULL) ? ",baseline_snr_db,delta_db,status" : "");
+  }
+  else if(format == ACC_JSON)
+  {
+    printf("[\n");
+  }
+  else if(list == 0u)
+  {
+    printf("%-34s %-5s %-10s %9s %12s %14s %9s%s\n", "kernel", "type", "signal",
+           "SNR dB", "max err", "max err LSB", "overflows",
+           (baseline != NULL) ? "    delta" : "");
+  }
+
+  for (k = 0u; k < armAccKernelsCount; k++)
+  {
+    const arm_acc_kernel *kernel = &armAccKernels[k];
+
+    if((filter != NULL) && (strstr(kernel->name, filter) == NULL) &&
+       (strstr(kernel->family, filter) == NULL))
+    {
+      continue;
+    }
+
+    if((name != NULL) && (strcmp(kernel->name, name) != 0))
+    {
+      continue;
+    }
+
+    if(list != 0u)
+    {
+      printf("%-34s %-16s %s\n", kernel->name, kernel->family, kernel->type);
+      continue;
+    }
+
+    for (s = 0u; s < ACC_NUM_SIGNALS; s++)
+    {
+      const acc_baseline *base = NULL;
+      acc_result r;
+      double delta = 0.0;
+      uint32_t regressed = 0u;
+
+      if((signal != NULL) && (strcmp(accSignalNames[s], signal) != 0))
+      {
+        continue;
+      }
+
+      if(acc_measure(kernel, accSignal[s], len, numTaps, &r) == 0u)
+      {
+        continue;
+      }
+
+      if(baseline != NULL)
+      {
+        base = acc_find_baseline(kernel->name, accSignalNames[s]);
+
+        if(base != NULL)
+        {
+          delta = r.snr - base->snr;
+          regressed = ((delta < -threshold) || (r.overflows > base->overflows)) ? 1u : 0u;
+          regressions += regressed;
+        }
+      }
+
+      if(format == ACC_CSV)
+      {
+        printf("%s,%s,%s,%s,%u,%.2f,%.4e,%.2f,%u", kernel->name, kernel->family,
+               kernel->type, accSignalNames[s], r.outputs, r.snr, r.maxErr,
+               r.maxErrLsb, r.overflows);
+
+        if(baseline != NULL)
+        {
+          if(base != NULL)
+          {
+            printf(",%.2f,%.2f,%s", base->snr, delta, (regressed != 0u) ? "REGRESSION" : "ok");
+          }
+          else
+          {
+            printf(",,,new");
+          }
+        }
+        printf("\n");
+      }
+      else if(format == ACC_JSON)
+      {
+        printf("%s  {\"kernel\": \"%s\", \"family\": \"%s\", \"type\": \"%s\", "
+               "\"signal\": \"%s\", \"outputs\": %u, \"snr_db\": %.2f, "
+               "\"max_err\": %.4e, \"max_err_lsb\": %.2f, \"overflows\": %u",
+               (first != 0u) ? "" : ",\n", kernel->name, kernel->family, kernel->type,
+               accSignalNames[s], r.outputs, r.snr, r.maxErr, r.maxErrLsb, r.overflows);
+
+        if(base != NULL)
+        {
+          printf(", \"baseline_snr_db\": %.2f, \"delta_db\": %.2f, \"regression\": %s",
+                 base->snr, delta, (regressed != 0u) ? "true" : "false");
+        }
+        printf("}");
+      }
+      else
+      {
+        printf("%-34s %-5s %-10s %9.2f %12.4e %14.2f %9u", kernel->name, kernel->type,
+               accSignalNames[s], r.snr, r.maxErr, r.maxErrLsb, r.overflows);
+
+        if(base != NULL)
+        {
+          printf(" %+8.2f%s", delta, (regressed != 0u) ? "  REGRESSION" : "");
+        }
+        printf("\n");
+      }
+
+      first = 0u;
+    }
+  }
+
+  if(format == ACC_JSON)
+  {
+    printf("\n]\n");
+  }
+
+  if(regressions != 0u)
+  {
+    fprintf(stderr, "arm_accuracy: %u result(s) lost more than %.1f dB SNR or gained "
+            "overflows against %s\n", regressions, threshold, baseline);
+    return (1);
+  }
+
+  return (0);
+}
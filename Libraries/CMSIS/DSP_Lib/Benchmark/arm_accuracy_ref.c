@@ -0,0 +1,370 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* Project: 	    CMSIS DSP Library
+* Title:		arm_accuracy_ref.c
+*
+* Description:	Double precision reference kernels for the accuracy harness.
+*               Each one is the textbook form of the library definition,
+*               written for clarity rather than speed.
+*
+* Target Processor: Host (ARM_MATH_HOST) / Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include <math.h>
+#include "arm_accuracy.h"
+
+/**
+ * @brief Input sample n, zero before the start of the signal.
+ */
+
+static double ref_x(
+  const arm_acc_case * c,
+  int32_t n)
+{
+  return ((n < 0) ? 0.0 : c->pSrc[n]);
+}
+
+/**
+ * @brief FIR filter.  The coefficients are in library order, so
+ * coefficient k multiplies the state entry k of the window that ends
+ * at the current sample:
+ * <pre>
+ *    y[n] = sum(k = 0 .. numTaps-1) pCoeffs[k] * x[n - numTaps + 1 + k]
+ * </pre>
+ */
+
+uint32_t arm_acc_ref_fir(
+  const arm_acc_case * c,
+  double *pDst)
+{
+  uint32_t n, k;
+  double sum;
+
+  for (n = 0u; n < c->srcLen; n++)
+  {
+    sum = 0.0;
+
+    for (k = 0u; k < c->numTaps; k++)
+    {
+      sum += c->pCoeffs[k] * ref_x(c, (int32_t) (n + k) - (int32_t) c->numTaps + 1);
+    }
+
+    pDst[n] = sum;
+  }
+
+  return (c->srcLen);
+}
+
+/**
+ * @brief FIR decimator: output m is the FIR output at input sample m * M.
+ */
+
+uint32_t arm_acc_ref_fir_decimate(
+  const arm_acc_case * c,
+  double *pDst)
+{
+  uint32_t m, k, n;
+  double sum;
+
+  for (m = 0u; m < c->srcLen / ARM_ACC_FACTOR; m++)
+  {
+    n = m * ARM_ACC_FACTOR;
+    sum = 0.0;
+
+    for (k = 0u; k < c->numTaps; k++)
+    {
+      sum += c->pCoeffs[k] * ref_x(c, (int32_t) (n + k) - (int32_t) c->numTaps + 1);
+    }
+
+    pDst[m] = sum;
+  }
+
+  return (c->srcLen / ARM_ACC_FACTOR);
+}
+
+/**
+ * @brief Polyphase FIR interpolator.  Phase j of input sample n uses every
+ * L-th coefficient starting at L - 1 - j over the last numTaps / L inputs.
+ */
+
+uint32_t arm_acc_ref_fir_interpolate(
+  const arm_acc_case * c,
+  double *pDst)
+{
+  uint32_t phaseLen = c->numTaps / ARM_ACC_FACTOR;
+  uint32_t n, j, t;
+  double sum;
+
+  for (n = 0u; n < c->srcLen; n++)
+  {
+    for (j = 0u; j < ARM_ACC_FACTOR; j++)
+    {
+      sum = 0.0;
+
+      for (t = 0u; t < phaseLen; t++)
+      {
+        sum += c->pCoeffs[(ARM_ACC_FACTOR - 1u - j) + (t * ARM_ACC_FACTOR)] *
+          ref_x(c, (int32_t) (n + t) - (int32_t) phaseLen + 1);
+      }
+
+      pDst[(n * ARM_ACC_FACTOR) + j] = sum;
+    }
+  }
+
+  return (c->srcLen * ARM_ACC_FACTOR);
+}
+
+/**
+ * @brief Biquad cascade, one Direct Form I section per stage with the
+ * library's sign convention for the feedback coefficients:
+ * <pre>
+ *    y[n] = b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2]
+ * </pre>
+ * Direct Form II transposed has the same transfer function and shares this
+ * reference.
+ */
+
+uint32_t arm_acc_ref_biquad(
+  const arm_acc_case * c,
+  double *pDst)
+{
+  double x1[ARM_ACC_NUM_STAGES] = { 0.0 }, x2[ARM_ACC_NUM_STAGES] = { 0.0 };
+  double y1[ARM_ACC_NUM_STAGES] = { 0.0 }, y2[ARM_ACC_NUM_STAGES] = { 0.0 };
+  const double *p;
+  double in, out = 0.0;
+  uint32_t n, s;
+
+  for (n = 0u; n < c->srcLen; n++)
+  {
+    in = c->pSrc[n];
+
+    for (s = 0u; s < ARM_ACC_NUM_STAGES; s++)
+    {
+      p = &c->pSos[5u * s];
+      out = (p[0] * in) + (p[1] * x1[s]) + (p[2] * x2[s]) + (p[3] * y1[s]) + (p[4] * y2[s]);
+
+      x2[s] = x1[s];
+      x1[s] = in;
+      y2[s] = y1[s];
+      y1[s] = out;
+
+      in = out;
+    }
+
+    pDst[n] = out;
+  }
+
+  return (c->srcLen);
+}
+
+/**
+ * @brief Convolution of the signal with the coefficients,
+ * srcLen + numTaps - 1 outputs.
+ */
+
+uint32_t arm_acc_ref_conv(
+  const arm_acc_case * c,
+  double *pDst)
+{
+  uint32_t outLen = c->srcLen + c->numTaps - 1u;
+  uint32_t n, k;
+  double sum;
+
+  for (n = 0u; n < outLen; n++)
+  {
+    sum = 0.0;
+
+    for (k = 0u; k < c->numTaps; k++)
+    {
+      if((n >= k) && ((n - k) < c->srcLen))
+      {
+        sum += c->pSrc[n - k] * c->pCoeffs[k];
+      }
+    }
+
+    pDst[n] = sum;
+  }
+
+  return (outLen);
+}
+
+/**
+ * @brief Correlation of the signal (A) with the coefficients (B).  The
+ * library writes 2 * srcLen - 1 outputs, the first srcLen - numTaps of
+ * which are zero, followed by
+ * <pre>
+ *    r[i] = sum(j) a[j] * b[numTaps - 1 - i + j],  i = 0 .. srcLen + numTaps - 2
+ * </pre>
+ */
+
+uint32_t arm_acc_ref_correlate(
+  const arm_acc_case * c,
+  double *pDst)
+{
+  uint32_t outLen = (2u * c->srcLen) - 1u;
+  uint32_t zeros = c->srcLen - c->numTaps;
+  int32_t i, j, k;
+  double sum;
+
+  for (i = 0; i < (int32_t) zeros; i++)
+  {
+    pDst[i] = 0.0;
+  }
+
+  for (i = 0; i < (int32_t) (c->srcLen + c->numTaps - 1u); i++)
+  {
+    sum = 0.0;
+
+    for (j = 0; j < (int32_t) c->srcLen; j++)
+    {
+      k = ((int32_t) c->numTaps - 1) - i + j;
+
+      if((k >= 0) && (k < (int32_t) c->numTaps))
+      {
+        sum += c->pSrc[j] * c->pCoeffs[k];
+      }
+    }
+
+    pDst[zeros + i] = sum;
+  }
+
+  return (outLen);
+}
+
+/**
+ * @brief Forward complex DFT of the first ARM_ACC_FFT_LEN interleaved
+ * complex samples.  The fixed-point FFTs scale down by 2 in every radix-2
+ * step to stay in range, so their reference is scaled by 1 / fftLen.
+ */
+
+uint32_t arm_acc_ref_cfft(
+  const arm_acc_case * c,
+  double *pDst)
+{
+  const double twoPi = 6.283185307179586476925286766559;
+  double scale = (c->format == ARM_ACC_F32) ? 1.0 : (1.0 / ARM_ACC_FFT_LEN);
+  double re, im, w;
+  uint32_t k, n;
+
+  if(c->srcLen < (2u * ARM_ACC_FFT_LEN))
+  {
+    return (0u);
+  }
+
+  for (k = 0u; k < ARM_ACC_FFT_LEN; k++)
+  {
+    re = 0.0;
+    im = 0.0;
+
+    for (n = 0u; n < ARM_ACC_FFT_LEN; n++)
+    {
+      /* Reduce k * n first so the angle stays exact for long transforms */
+      w = (twoPi * (double) ((k * n) % ARM_ACC_FFT_LEN)) / ARM_ACC_FFT_LEN;
+      re += (c->pSrc[2u * n] * cos(w)) + (c->pSrc[(2u * n) + 1u] * sin(w));
+      im += (c->pSrc[(2u * n) + 1u] * cos(w)) - (c->pSrc[2u * n] * sin(w));
+    }
+
+    pDst[2u * k] = re * scale;
+    pDst[(2u * k) + 1u] = im * scale;
+  }
+
+  return (2u * ARM_ACC_FFT_LEN);
+}
+
+/**
+ * @brief Normal equations of the least-squares FIR design: with u(n) the
+ * window of numTaps inputs ending at sample n and d(n) the FIR output,
+ * <pre>
+ *    R = mean(u(n) * u(n)') + delta * I,   p = mean(d(n) * u(n))
+ * </pre>
+ * whose solution is the FIR coefficients when delta = 0.  The sine and
+ * step signals give an autocorrelation of rank 2 or so; the diagonal
+ * loading delta, 1e-5 of the signal power, keeps their system solvable
+ * but badly conditioned.  R and p are rounded to f32, the format of the
+ * solvers, so the reference and the kernels see the same system.
+ */
+
+void arm_acc_normal_equations(
+  const arm_acc_case * c,
+  double *pR,
+  double *pP)
+{
+  uint32_t N = c->numTaps;
+  uint32_t n, i, j;
+  int32_t first;
+  double d;
+
+  for (i = 0u; i < (N * N); i++)
+  {
+    pR[i] = 0.0;
+  }
+
+  for (i = 0u; i < N; i++)
+  {
+    pP[i] = 0.0;
+  }
+
+  for (n = 0u; n < c->srcLen; n++)
+  {
+    first = (int32_t) n - (int32_t) N + 1;
+    d = 0.0;
+
+    for (i = 0u; i < N; i++)
+    {
+      d += c->pCoeffs[i] * ref_x(c, first + (int32_t) i);
+    }
+
+    for (i = 0u; i < N; i++)
+    {
+      pP[i] += d * ref_x(c, first + (int32_t) i);
+
+      for (j = 0u; j < N; j++)
+      {
+        pR[(i * N) + j] += ref_x(c, first + (int32_t) i) * ref_x(c, first + (int32_t) j);
+      }
+    }
+  }
+
+  d = 0.0;
+
+  for (i = 0u; i < N; i++)
+  {
+    d += pR[(i * N) + i];
+  }
+
+  d = 1e-5 * d / N;
+
+  for (i = 0u; i < N; i++)
+  {
+    pR[(i * N) + i] += d;
+    pP[i] = (double) (float) (pP[i] / c->srcLen);
+
+    for (j = 0u; j < N; j++)
+    {
+      pR[(i * N) + j] = (double) (float) (pR[(i * N) + j] / c->srcLen);
+    }
+  }
+}
+
+/**
+ * @brief Linear system solve, measured by its residual: the reference is
+ * the right-hand side p of the normal equations and the kernels return
+ * R * h for the h they find, so the error is the residual R * h - p.
+ */
+
+uint32_t arm_acc_ref_solve(
+  const arm_acc_case * c,
+  double *pDst)
+{
+  static double R[ARM_ACC_MAX_SOLVE * ARM_ACC_MAX_SOLVE];
+
+  if(c->numTaps > ARM_ACC_MAX_SOLVE)
+  {
+    return (0u);
+  }
+
+  arm_acc_normal_equations(c, R, pDst);
+
+  return (c->numTaps);
+}
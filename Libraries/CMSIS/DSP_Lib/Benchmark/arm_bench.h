@@ -0,0 +1,145 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* Project: 	    CMSIS DSP Library
+* Title:		arm_bench.h
+*
+* Description:	Kernel table and shared buffers of the DSP library
+*               micro-benchmark.
+*
+* Target Processor: Host (ARM_MATH_HOST) / Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#ifndef _ARM_BENCH_H
+#define _ARM_BENCH_H
+
+#include "arm_math.h"
+
+/**
+ * @brief Largest block size and tap count the shared buffers are sized for.
+ */
+#define ARM_BENCH_MAX_BLOCK     4096u
+#define ARM_BENCH_MAX_TAPS      512u
+
+/**
+ * @brief Number of elements in each shared buffer.
+ * Complex kernels use two words per sample and the convolutions
+ * produce blockSize + numTaps - 1 outputs, hence the headroom.
+ */
+#define ARM_BENCH_BUF_LEN       (4u * ARM_BENCH_MAX_BLOCK + 2u * ARM_BENCH_MAX_TAPS)
+
+/**
+ * @brief Number of second order sections used by the biquad kernels.
+ */
+#define ARM_BENCH_NUM_STAGES    4u
+
+/**
+ * @brief Kernel flags.
+ */
+#define ARM_BENCH_TAPS          0x01u   /**< kernel is swept over the tap counts as well as the block sizes */
+
+/**
+ * @brief Configuration of one benchmark point.
+ */
+typedef struct
+{
+  uint32_t blockSize;                   /**< number of samples per call. */
+  uint32_t numTaps;                     /**< number of filter taps (ARM_BENCH_TAPS kernels only). */
+} arm_bench_config;
+
+/**
+ * @brief One entry of the kernel table.
+ *
+ * <code>setup</code> prepares the instance for the given configuration and
+ * returns the number of samples one call of <code>run</code> processes,
+ * or 0 when the configuration is not supported by the kernel (e.g. an FFT
+ * length outside the twiddle tables).  A NULL <code>setup</code> means the
+ * kernel needs no preparation and processes <code>blockSize</code> samples.
+ */
+typedef struct
+{
+  const char *name;                     /**< library function being measured. */
+  const char *group;                    /**< library function group. */
+  const char *type;                     /**< data type: q7, q15, q31 or f32. */
+  uint32_t flags;                       /**< ARM_BENCH_xxx flags. */
+  uint32_t (*setup) (const arm_bench_config * cfg);
+  void (*run) (const arm_bench_config * cfg);
+} arm_bench_kernel;
+
+/**
+ * @brief Kernel tables, one per library function group.
+ */
+extern const arm_bench_kernel armBenchBasicMath[];
+extern const arm_bench_kernel armBenchFastMath[];
+extern const arm_bench_kernel armBenchComplexMath[];
+extern const arm_bench_kernel armBenchFiltering[];
+extern const arm_bench_kernel armBenchTransform[];
+extern const arm_bench_kernel armBenchMatrix[];
+extern const arm_bench_kernel armBenchStatistics[];
+extern const arm_bench_kernel armBenchSupport[];
+extern const arm_bench_kernel armBenchController[];
+
+extern const uint32_t armBenchBasicMathCount;
+extern const uint32_t armBenchFastMathCount;
+extern const uint32_t armBenchComplexMathCount;
+extern const uint32_t armBenchFilteringCount;
+extern const uint32_t armBenchTransformCount;
+extern const uint32_t armBenchMatrixCount;
+extern const uint32_t armBenchStatisticsCount;
+extern const uint32_t armBenchSupportCount;
+extern const uint32_t armBenchControllerCount;
+
+/**
+ * @brief Shared input, output, coefficient and state buffers.
+ * The inputs are refilled by arm_bench_fill_inputs() before every kernel with a
+ * deterministic signal at about half scale.
+ */
+extern float32_t benchSrcA_f32[ARM_BENCH_BUF_LEN];
+extern float32_t benchSrcB_f32[ARM_BENCH_BUF_LEN];
+extern float32_t benchDst_f32[ARM_BENCH_BUF_LEN];
+extern float32_t benchCoeff_f32[ARM_BENCH_BUF_LEN];
+extern float32_t benchState_f32[ARM_BENCH_BUF_LEN];
+
+extern q31_t benchSrcA_q31[ARM_BENCH_BUF_LEN];
+extern q31_t benchSrcB_q31[ARM_BENCH_BUF_LEN];
+extern q31_t benchDst_q31[ARM_BENCH_BUF_LEN];
+extern q31_t benchCoeff_q31[ARM_BENCH_BUF_LEN];
+extern q31_t benchState_q31[ARM_BENCH_BUF_LEN];
+
+extern q15_t benchSrcA_q15[ARM_BENCH_BUF_LEN];
+extern q15_t benchSrcB_q15[ARM_BENCH_BUF_LEN];
+extern q15_t benchDst_q15[ARM_BENCH_BUF_LEN];
+extern q15_t benchCoeff_q15[ARM_BENCH_BUF_LEN];
+extern q15_t benchState_q15[ARM_BENCH_BUF_LEN];
+
+extern q7_t benchSrcA_q7[ARM_BENCH_BUF_LEN];
+extern q7_t benchSrcB_q7[ARM_BENCH_BUF_LEN];
+extern q7_t benchDst_q7[ARM_BENCH_BUF_LEN];
+extern q7_t benchCoeff_q7[ARM_BENCH_BUF_LEN];
+extern q7_t benchState_q7[ARM_BENCH_BUF_LEN];
+
+/**
+ * @brief Scratch buffers for kernels that need a second work area.
+ * The sparse filters fetch one tap delay past the last one (the value
+ * is not used), so the delay array has a spare entry.
+ */
+extern q31_t benchScratch_q31[ARM_BENCH_BUF_LEN];
+extern q63_t benchState_q63[ARM_BENCH_BUF_LEN];
+extern int32_t benchTapDelay[ARM_BENCH_MAX_TAPS + 1u];
+
+/**
+ * @brief Scalar results are written here so the calls cannot be optimized away.
+ */
+extern volatile q63_t benchSink;
+extern volatile float32_t benchSink_f32;
+
+void arm_bench_fill_inputs(
+  void);
+
+/**
+ * @brief Table entry helpers.
+ */
+#define ARM_BENCH_ENTRY(fn, group, type, flags, setup) \
+  { #fn, group, #type, flags, setup, bench_##fn }
+
+#endif /* _ARM_BENCH_H */
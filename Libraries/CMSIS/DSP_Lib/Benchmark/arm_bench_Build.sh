@@ -0,0 +1,32 @@
+#!/bin/sh
+# Builds the DSP library micro-benchmark and accuracy harness for the host.
+#
+#   ./arm_bench_Build.sh                 SSE2 / NEON build (ARM_MATH_HOST)
+#   ./arm_bench_Build.sh -mavx2          AVX2 build
+#   ./arm_bench_Build.sh -DARM_MATH_HOST_SCALAR
+#                                        portable Cortex-M0 C code only
+#
+# Extra arguments are passed to the compiler.  CC selects the compiler,
+# OUT and ACC_OUT the names of the benchmark and accuracy executables.
+
+CC=${CC:-gcc}
+OUT=${OUT:-arm_bench}
+ACC_OUT=${ACC_OUT:-arm_accuracy}
+DIR=$(dirname "$0")
+
+# Regenerate the FIR kernels for fixed tap counts (Scripts/arm_fir_fixed.cfg)
+if command -v python3 >/dev/null 2>&1; then
+    python3 "$DIR/../Scripts/arm_fir_fixed_gen.py" || exit 1
+fi
+
+$CC -O2 -DARM_MATH_HOST "$@" \
+    -I"$DIR/../../Include" \
+    -o "$OUT" \
+    "$DIR"/arm_bench_*.c "$DIR"/../Source/*Functions/*.c "$DIR"/../Source/CommonTables/*.c \
+    -lm || exit 1
+
+$CC -O2 -DARM_MATH_HOST "$@" \
+    -I"$DIR/../../Include" \
+    -o "$ACC_OUT" \
+    "$DIR"/arm_accuracy*.c "$DIR"/../Source/*Functions/*.c "$DIR"/../Source/CommonTables/*.c \
+    -lm
@@ -0,0 +1,249 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* Project: 	    CMSIS DSP Library
+* Title:		arm_bench_basic.c
+*
+* Description:	Benchmark table for the basic math and complex math functions.
+*
+* Target Processor: Host (ARM_MATH_HOST) / Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_bench.h"
+
+#define BENCH_BINARY(fn, T) \
+  static void bench_##fn(const arm_bench_config * cfg) \
+  { fn(benchSrcA_##T, benchSrcB_##T, benchDst_##T, cfg->blockSize); }
+
+#define BENCH_UNARY(fn, T) \
+  static void bench_##fn(const arm_bench_config * cfg) \
+  { fn(benchSrcA_##T, benchDst_##T, cfg->blockSize); }
+
+#define BENCH_SHIFT(fn, T) \
+  static void bench_##fn(const arm_bench_config * cfg) \
+  { fn(benchSrcA_##T, 1, benchDst_##T, cfg->blockSize); }
+
+#define BENCH_SCALE(fn, T, scale) \
+  static void bench_##fn(const arm_bench_config * cfg) \
+  { fn(benchSrcA_##T, (scale), 1, benchDst_##T, cfg->blockSize); }
+
+#define BENCH_DOT(fn, T, R) \
+  static void bench_##fn(const arm_bench_config * cfg) \
+  { R r; fn(benchSrcA_##T, benchSrcB_##T, cfg->blockSize, &r); benchSink = (q63_t) r; }
+
+#define BENCH_GAIN(fn, T) \
+  static void bench_##fn(const arm_bench_config * cfg) \
+  { fn(benchDst_##T, benchSrcB_##T, cfg->blockSize); }
+
+/* A multiply-accumulate as a product into a temporary and an addition, for comparison */
+#define BENCH_MAC_SEPARATE(T) \
+  static void bench_arm_cmplx_mac_separate_##T(const arm_bench_config * cfg) \
+  { arm_cmplx_mult_cmplx_##T(benchSrcA_##T, benchSrcB_##T, benchState_##T, cfg->blockSize); \
+    arm_add_##T(benchDst_##T, benchState_##T, benchDst_##T, 2u * cfg->blockSize); }
+
+/* ----------------------------------------------------------------------
+** Basic math
+** ------------------------------------------------------------------- */
+
+BENCH_BINARY(arm_add_f32, f32)
+BENCH_BINARY(arm_add_q31, q31)
+BENCH_BINARY(arm_add_q15, q15)
+BENCH_BINARY(arm_add_q7, q7)
+BENCH_BINARY(arm_sub_f32, f32)
+BENCH_BINARY(arm_sub_q31, q31)
+BENCH_BINARY(arm_sub_q15, q15)
+BENCH_BINARY(arm_sub_q7, q7)
+BENCH_BINARY(arm_mult_f32, f32)
+BENCH_BINARY(arm_mult_q31, q31)
+BENCH_BINARY(arm_mult_q15, q15)
+BENCH_BINARY(arm_mult_q7, q7)
+BENCH_UNARY(arm_abs_f32, f32)
+BENCH_UNARY(arm_abs_q31, q31)
+BENCH_UNARY(arm_abs_q15, q15)
+BENCH_UNARY(arm_abs_q7, q7)
+BENCH_UNARY(arm_negate_f32, f32)
+BENCH_UNARY(arm_negate_q31, q31)
+BENCH_UNARY(arm_negate_q15, q15)
+BENCH_UNARY(arm_negate_q7, q7)
+BENCH_SCALE(arm_scale_q31, q31, 0x40000000)
+BENCH_SCALE(arm_scale_q15, q15, 0x4000)
+BENCH_SCALE(arm_scale_q7, q7, 0x40)
+BENCH_SHIFT(arm_shift_q31, q31)
+BENCH_SHIFT(arm_shift_q15, q15)
+BENCH_SHIFT(arm_shift_q7, q7)
+BENCH_DOT(arm_dot_prod_f32, f32, float32_t)
+BENCH_DOT(arm_dot_prod_q31, q31, q63_t)
+BENCH_DOT(arm_dot_prod_q15, q15, q63_t)
+BENCH_DOT(arm_dot_prod_q7, q7, q31_t)
+
+static void bench_arm_scale_f32(
+  const arm_bench_config * cfg)
+{
+  arm_scale_f32(benchSrcA_f32, 0.5f, benchDst_f32, cfg->blockSize);
+}
+
+static void bench_arm_offset_f32(
+  const arm_bench_config * cfg)
+{
+  arm_offset_f32(benchSrcA_f32, 0.25f, benchDst_f32, cfg->blockSize);
+}
+
+static void bench_arm_offset_q31(
+  const arm_bench_config * cfg)
+{
+  arm_offset_q31(benchSrcA_q31, 0x20000000, benchDst_q31, cfg->blockSize);
+}
+
+static void bench_arm_offset_q15(
+  const arm_bench_config * cfg)
+{
+  arm_offset_q15(benchSrcA_q15, 0x2000, benchDst_q15, cfg->blockSize);
+}
+
+static void bench_arm_offset_q7(
+  const arm_bench_config * cfg)
+{
+  arm_offset_q7(benchSrcA_q7, 0x20, benchDst_q7, cfg->blockSize);
+}
+
+const arm_bench_kernel armBenchBasicMath[] = {
+  ARM_BENCH_ENTRY(arm_add_f32, "BasicMath", f32, 0u, 0),
+  ARM_BENCH_ENTRY(arm_add_q31, "BasicMath", q31, 0u, 0),
+  ARM_BENCH_ENTRY(arm_add_q15, "BasicMath", q15, 0u, 0),
+  ARM_BENCH_ENTRY(arm_add_q7, "BasicMath", q7, 0u, 0),
+  ARM_BENCH_ENTRY(arm_sub_f32, "BasicMath", f32, 0u, 0),
+  ARM_BENCH_ENTRY(arm_sub_q31, "BasicMath", q31, 0u, 0),
+  ARM_BENCH_ENTRY(arm_sub_q15, "BasicMath", q15, 0u, 0),
+  ARM_BENCH_ENTRY(arm_sub_q7, "BasicMath", q7, 0u, 0),
+  ARM_BENCH_ENTRY(arm_mult_f32, "BasicMath", f32, 0u, 0),
+  ARM_BENCH_ENTRY(arm_mult_q31, "BasicMath", q31, 0u, 0),
+  ARM_BENCH_ENTRY(arm_mult_q15, "BasicMath", q15, 0u, 0),
+  ARM_BENCH_ENTRY(arm_mult_q7, "BasicMath", q7, 0u, 0),
+  ARM_BENCH_ENTRY(arm_abs_f32, "BasicMath", f32, 0u, 0),
+  ARM_BENCH_ENTRY(arm_abs_q31, "BasicMath", q31, 0u, 0),
+  ARM_BENCH_ENTRY(arm_abs_q15, "BasicMath", q15, 0u, 0),
+  ARM_BENCH_ENTRY(arm_abs_q7, "BasicMath", q7, 0u, 0),
+  ARM_BENCH_ENTRY(arm_negate_f32, "BasicMath", f32, 0u, 0),
+  ARM_BENCH_ENTRY(arm_negate_q31, "BasicMath", q31, 0u, 0),
+  ARM_BENCH_ENTRY(arm_negate_q15, "BasicMath", q15, 0u, 0),
+  ARM_BENCH_ENTRY(arm_negate_q7, "BasicMath", q7, 0u, 0),
+  ARM_BENCH_ENTRY(arm_scale_f32, "BasicMath", f32, 0u, 0),
+  ARM_BENCH_ENTRY(arm_scale_q31, "BasicMath", q31, 0u, 0),
+  ARM_BENCH_ENTRY(arm_scale_q15, "BasicMath", q15, 0u, 0),
+  ARM_BENCH_ENTRY(arm_scale_q7, "BasicMath", q7, 0u, 0),
+  ARM_BENCH_ENTRY(arm_offset_f32, "BasicMath", f32, 0u, 0),
+  ARM_BENCH_ENTRY(arm_offset_q31, "BasicMath", q31, 0u, 0),
+  ARM_BENCH_ENTRY(arm_offset_q15, "BasicMath", q15, 0u, 0),
+  ARM_BENCH_ENTRY(arm_offset_q7, "BasicMath", q7, 0u, 0),
+  ARM_BENCH_ENTRY(arm_shift_q31, "BasicMath", q31, 0u, 0),
+  ARM_BENCH_ENTRY(arm_shift_q15, "BasicMath", q15, 0u, 0),
+  ARM_BENCH_ENTRY(arm_shift_q7, "BasicMath", q7, 0u, 0),
+  ARM_BENCH_ENTRY(arm_dot_prod_f32, "BasicMath", f32, 0u, 0),
+  ARM_BENCH_ENTRY(arm_dot_prod_q31, "BasicMath", q31, 0u, 0),
+  ARM_BENCH_ENTRY(arm_dot_prod_q15, "BasicMath", q15, 0u, 0),
+  ARM_BENCH_ENTRY(arm_dot_prod_q7, "BasicMath", q7, 0u, 0),
+};
+
+const uint32_t armBenchBasicMathCount =
+  sizeof(armBenchBasicMath) / sizeof(armBenchBasicMath[0]);
+
+/* ----------------------------------------------------------------------
+** Complex math.  blockSize is the number of complex samples.
+** ------------------------------------------------------------------- */
+
+BENCH_UNARY(arm_cmplx_conj_f32, f32)
+BENCH_UNARY(arm_cmplx_conj_q31, q31)
+BENCH_UNARY(arm_cmplx_conj_q15, q15)
+BENCH_UNARY(arm_cmplx_mag_f32, f32)
+BENCH_UNARY(arm_cmplx_mag_q31, q31)
+BENCH_UNARY(arm_cmplx_mag_q15, q15)
+BENCH_UNARY(arm_cmplx_mag_squared_f32, f32)
+BENCH_UNARY(arm_cmplx_mag_squared_q31, q31)
+BENCH_UNARY(arm_cmplx_mag_squared_q15, q15)
+BENCH_BINARY(arm_cmplx_mult_cmplx_f32, f32)
+BENCH_BINARY(arm_cmplx_mult_cmplx_q31, q31)
+BENCH_BINARY(arm_cmplx_mult_cmplx_q15, q15)
+BENCH_BINARY(arm_cmplx_mult_real_f32, f32)
+BENCH_BINARY(arm_cmplx_mult_real_q31, q31)
+BENCH_BINARY(arm_cmplx_mult_real_q15, q15)
+BENCH_BINARY(arm_cmplx_mac_f32, f32)
+BENCH_BINARY(arm_cmplx_mac_q31, q31)
+BENCH_BINARY(arm_cmplx_mac_q15, q15)
+BENCH_BINARY(arm_cmplx_conj_mac_f32, f32)
+BENCH_BINARY(arm_cmplx_conj_mac_q31, q31)
+BENCH_BINARY(arm_cmplx_conj_mac_q15, q15)
+BENCH_GAIN(arm_cmplx_gain_f32, f32)
+BENCH_GAIN(arm_cmplx_gain_q31, q31)
+BENCH_GAIN(arm_cmplx_gain_q15, q15)
+BENCH_UNARY(arm_cmplx_mag_squared_acc_f32, f32)
+BENCH_UNARY(arm_cmplx_mag_squared_acc_q31, q31)
+BENCH_UNARY(arm_cmplx_mag_squared_acc_q15, q15)
+BENCH_MAC_SEPARATE(f32)
+BENCH_MAC_SEPARATE(q31)
+BENCH_MAC_SEPARATE(q15)
+
+static void bench_arm_cmplx_dot_prod_f32(
+  const arm_bench_config * cfg)
+{
+  float32_t re, im;
+
+  arm_cmplx_dot_prod_f32(benchSrcA_f32, benchSrcB_f32, cfg->blockSize, &re, &im);
+  benchSink_f32 = re + im;
+}
+
+static void bench_arm_cmplx_dot_prod_q31(
+  const arm_bench_config * cfg)
+{
+  q63_t re, im;
+
+  arm_cmplx_dot_prod_q31(benchSrcA_q31, benchSrcB_q31, cfg->blockSize, &re, &im);
+  benchSink = re + im;
+}
+
+static void bench_arm_cmplx_dot_prod_q15(
+  const arm_bench_config * cfg)
+{
+  q31_t re, im;
+
+  arm_cmplx_dot_prod_q15(benchSrcA_q15, benchSrcB_q15, cfg->blockSize, &re, &im);
+  benchSink = (q63_t) re + im;
+}
+
+const arm_bench_kernel armBenchComplexMath[] = {
+  ARM_BENCH_ENTRY(arm_cmplx_conj_f32, "ComplexMath", f32, 0u, 0),
+  ARM_BENCH_ENTRY(arm_cmplx_conj_q31, "ComplexMath", q31, 0u, 0),
+  ARM_BENCH_ENTRY(arm_cmplx_conj_q15, "ComplexMath", q15, 0u, 0),
+  ARM_BENCH_ENTRY(arm_cmplx_dot_prod_f32, "ComplexMath", f32, 0u, 0),
+  ARM_BENCH_ENTRY(arm_cmplx_dot_prod_q31, "ComplexMath", q31, 0u, 0),
+  ARM_BENCH_ENTRY(arm_cmplx_dot_prod_q15, "ComplexMath", q15, 0u, 0),
+  ARM_BENCH_ENTRY(arm_cmplx_mag_f32, "ComplexMath", f32, 0u, 0),
+  ARM_BENCH_ENTRY(arm_cmplx_mag_q31, "ComplexMath", q31, 0u, 0),
+  ARM_BENCH_ENTRY(arm_cmplx_mag_q15, "ComplexMath", q15, 0u, 0),
+  ARM_BENCH_ENTRY(arm_cmplx_mag_squared_f32, "ComplexMath", f32, 0u, 0),
+  ARM_BENCH_ENTRY(arm_cmplx_mag_squared_q31, "ComplexMath", q31, 0u, 0),
+  ARM_BENCH_ENTRY(arm_cmplx_mag_squared_q15, "ComplexMath", q15, 0u, 0),
+  ARM_BENCH_ENTRY(arm_cmplx_mult_cmplx_f32, "ComplexMath", f32, 0u, 0),
+  ARM_BENCH_ENTRY(arm_cmplx_mult_cmplx_q31, "ComplexMath", q31, 0u, 0),
+  ARM_BENCH_ENTRY(arm_cmplx_mult_cmplx_q15, "ComplexMath", q15, 0u, 0),
+  ARM_BENCH_ENTRY(arm_cmplx_mult_real_f32, "ComplexMath", f32, 0u, 0),
+  ARM_BENCH_ENTRY(arm_cmplx_mult_real_q31, "ComplexMath", q31, 0u, 0),
+  ARM_BENCH_ENTRY(arm_cmplx_mult_real_q15, "ComplexMath", q15, 0u, 0),
+  ARM_BENCH_ENTRY(arm_cmplx_mac_f32, "ComplexMath", f32, 0u, 0),
+  ARM_BENCH_ENTRY(arm_cmplx_mac_q31, "ComplexMath", q31, 0u, 0),
+  ARM_BENCH_ENTRY(arm_cmplx_mac_q15, "ComplexMath", q15, 0u, 0),
+  ARM_BENCH_ENTRY(arm_cmplx_mac_separate_f32, "ComplexMath", f32, 0u, 0),
+  ARM_BENCH_ENTRY(arm_cmplx_mac_separate_q31, "ComplexMath", q31, 0u, 0),
+  ARM_BENCH_ENTRY(arm_cmplx_mac_separate_q15, "ComplexMath", q15, 0u, 0),
+  ARM_BENCH_ENTRY(arm_cmplx_conj_mac_f32, "ComplexMath", f32, 0u, 0),
+  ARM_BENCH_ENTRY(arm_cmplx_conj_mac_q31, "ComplexMath", q31, 0u, 0),
+  ARM_BENCH_ENTRY(arm_cmplx_conj_mac_q15, "ComplexMath", q15, 0u, 0),
+  ARM_BENCH_ENTRY(arm_cmplx_gain_f32, "ComplexMath", f32, 0u, 0),
+  ARM_BENCH_ENTRY(arm_cmplx_gain_q31, "ComplexMath", q31, 0u, 0),
+  ARM_BENCH_ENTRY(arm_cmplx_gain_q15, "ComplexMath", q15, 0u, 0),
+  ARM_BENCH_ENTRY(arm_cmplx_mag_squared_acc_f32, "ComplexMath", f32, 0u, 0),
+  ARM_BENCH_ENTRY(arm_cmplx_mag_squared_acc_q31, "ComplexMath", q31, 0u, 0),
+  ARM_BENCH_ENTRY(arm_cmplx_mag_squared_acc_q15, "ComplexMath", q15, 0u, 0),
+};
+
+const uint32_t armBenchComplexMathCount =
+  sizeof(armBenchComplexMath) / sizeof(armBenchComplexMath[0]);
@@ -0,0 +1,561 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* Project: 	    CMSIS DSP Library
+* Title:		arm_bench_fastmath.c
+*
+* Description:	Benchmark table for the fast math and controller functions.
+*               The per-sample functions are called once for every sample
+*               of the block, the block functions once per run.  The C
+*               library functions are timed alongside as a reference.
+*
+* Target Processor: Host (ARM_MATH_HOST) / Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_bench.h"
+
+static arm_pid_instance_f32 pidF32;
+static arm_pid_instance_q31 pidQ31;
+static arm_pid_instance_q15 pidQ15;
+
+/**
+ * @brief Fills the state buffers with inputs inside each function's valid
+ * range: [0, 2pi) for the float sine/cosine, [0, 1) for the fixed-point ones
+ * and positive values for the square roots.
+ */
+
+static uint32_t setup_angles(
+  const arm_bench_config * cfg)
+{
+  uint32_t i;
+
+  for (i = 0u; i < cfg->blockSize; i++)
+  {
+    benchState_f32[i] = (6.2831853f * (float32_t) i) / (float32_t) cfg->blockSize;
+    benchState_q31[i] = (q31_t) (((q63_t) 0x7FFFFFFF * i) / cfg->blockSize);
+    benchState_q15[i] = (q15_t) ((0x7FFF * i) / cfg->blockSize);
+  }
+
+  return (cfg->blockSize);
+}
+
+/**
+ * @brief Fills the state buffers with positive inputs in (0, 1] for the
+ * logarithms and the reciprocal square roots.
+ */
+
+static uint32_t setup_positive(
+  const arm_bench_config * cfg)
+{
+  uint32_t i;
+
+  for (i = 0u; i < cfg->blockSize; i++)
+  {
+    benchState_f32[i] = (float32_t) (i + 1u) / (float32_t) cfg->blockSize;
+    benchState_q31[i] = (q31_t) (((q63_t) 0x7FFFFFFF * (i + 1u)) / cfg->blockSize);
+    benchState_q15[i] = (q15_t) ((0x7FFF * (i + 1u)) / cfg->blockSize);
+  }
+
+  return (cfg->blockSize);
+}
+
+/**
+ * @brief Fills the state buffers with negative inputs for the exponentials
+ * and the decibel to linear conversions: [-120, 0) for the floats and
+ * [-1, 0) for the fixed-point ones.
+ */
+
+static uint32_t setup_levels(
+  const arm_bench_config * cfg)
+{
+  uint32_t i;
+
+  for (i = 0u; i < cfg->blockSize; i++)
+  {
+    benchState_f32[i] = (-120.0f * (float32_t) (cfg->blockSize - i)) / (float32_t) cfg->blockSize;
+    benchState_q31[i] = (q31_t) (-(((q63_t) 0x7FFFFFFF * (cfg->blockSize - i)) / cfg->blockSize));
+    benchState_q15[i] = (q15_t) (-((0x7FFF * (int32_t) (cfg->blockSize - i)) / (int32_t) cfg->blockSize));
+  }
+
+  return (cfg->blockSize);
+}
+
+static void bench_arm_sin_f32(
+  const arm_bench_config * cfg)
+{
+  uint32_t i;
+
+  for (i = 0u; i < cfg->blockSize; i++)
+  {
+    benchDst_f32[i] = arm_sin_f32(benchState_f32[i]);
+  }
+}
+
+static void bench_arm_sin_q31(
+  const arm_bench_config * cfg)
+{
+  uint32_t i;
+
+  for (i = 0u; i < cfg->blockSize; i++)
+  {
+    benchDst_q31[i] = arm_sin_q31(benchState_q31[i]);
+  }
+}
+
+static void bench_arm_sin_q15(
+  const arm_bench_config * cfg)
+{
+  uint32_t i;
+
+  for (i = 0u; i < cfg->blockSize; i++)
+  {
+    benchDst_q15[i] = arm_sin_q15(benchState_q15[i]);
+  }
+}
+
+static void bench_arm_cos_f32(
+  const arm_bench_config * cfg)
+{
+  uint32_t i;
+
+  for (i = 0u; i < cfg->blockSize; i++)
+  {
+    benchDst_f32[i] = arm_cos_f32(benchState_f32[i]);
+  }
+}
+
+static void bench_arm_cos_q31(
+  const arm_bench_config * cfg)
+{
+  uint32_t i;
+
+  for (i = 0u; i < cfg->blockSize; i++)
+  {
+    benchDst_q31[i] = arm_cos_q31(benchState_q31[i]);
+  }
+}
+
+static void bench_arm_cos_q15(
+  const arm_bench_config * cfg)
+{
+  uint32_t i;
+
+  for (i = 0u; i < cfg->blockSize; i++)
+  {
+    benchDst_q15[i] = arm_cos_q15(benchState_q15[i]);
+  }
+}
+
+static void bench_arm_sin_block_f32(
+  const arm_bench_config * cfg)
+{
+  arm_sin_block_f32(benchState_f32, benchDst_f32, cfg->blockSize);
+}
+
+static void bench_arm_sin_block_q31(
+  const arm_bench_config * cfg)
+{
+  arm_sin_block_q31(benchState_q31, benchDst_q31, cfg->blockSize);
+}
+
+static void bench_arm_sin_block_q15(
+  const arm_bench_config * cfg)
+{
+  arm_sin_block_q15(benchState_q15, benchDst_q15, cfg->blockSize);
+}
+
+static void bench_arm_cos_block_f32(
+  const arm_bench_config * cfg)
+{
+  arm_cos_block_f32(benchState_f32, benchDst_f32, cfg->blockSize);
+}
+
+static void bench_arm_cos_block_q31(
+  const arm_bench_config * cfg)
+{
+  arm_cos_block_q31(benchState_q31, benchDst_q31, cfg->blockSize);
+}
+
+static void bench_arm_cos_block_q15(
+  const arm_bench_config * cfg)
+{
+  arm_cos_block_q15(benchState_q15, benchDst_q15, cfg->blockSize);
+}
+
+static void bench_arm_sqrt_f32(
+  const arm_bench_config * cfg)
+{
+  uint32_t i;
+
+  for (i = 0u; i < cfg->blockSize; i++)
+  {
+    arm_sqrt_f32(benchState_f32[i], &benchDst_f32[i]);
+  }
+}
+
+static void bench_arm_sqrt_q31(
+  const arm_bench_config * cfg)
+{
+  uint32_t i;
+
+  for (i = 0u; i < cfg->blockSize; i++)
+  {
+    arm_sqrt_q31(benchState_q31[i], &benchDst_q31[i]);
+  }
+}
+
+static void bench_arm_sqrt_q15(
+  const arm_bench_config * cfg)
+{
+  uint32_t i;
+
+  for (i = 0u; i < cfg->blockSize; i++)
+  {
+    arm_sqrt_q15(benchState_q15[i], &benchDst_q15[i]);
+  }
+}
+
+static void bench_arm_log2_f32(
+  const arm_bench_config * cfg)
+{
+  arm_log2_f32(benchState_f32, benchDst_f32, cfg->blockSize);
+}
+
+static void bench_arm_log2_q31(
+  const arm_bench_config * cfg)
+{
+  arm_log2_q31(benchState_q31, benchDst_q31, cfg->blockSize);
+}
+
+static void bench_arm_log2_q15(
+  const arm_bench_config * cfg)
+{
+  arm_log2_q15(benchState_q15, benchDst_q15, cfg->blockSize);
+}
+
+static void bench_arm_ln_f32(
+  const arm_bench_config * cfg)
+{
+  arm_ln_f32(benchState_f32, benchDst_f32, cfg->blockSize);
+}
+
+static void bench_arm_log10_f32(
+  const arm_bench_config * cfg)
+{
+  arm_log10_f32(benchState_f32, benchDst_f32, cfg->blockSize);
+}
+
+static void bench_arm_exp2_f32(
+  const arm_bench_config * cfg)
+{
+  arm_exp2_f32(benchState_f32, benchDst_f32, cfg->blockSize);
+}
+
+static void bench_arm_exp2_q31(
+  const arm_bench_config * cfg)
+{
+  arm_exp2_q31(benchState_q31, benchDst_q31, cfg->blockSize);
+}
+
+static void bench_arm_exp2_q15(
+  const arm_bench_config * cfg)
+{
+  arm_exp2_q15(benchState_q15, benchDst_q15, cfg->blockSize);
+}
+
+static void bench_arm_exp_f32(
+  const arm_bench_config * cfg)
+{
+  arm_exp_f32(benchState_f32, benchDst_f32, cfg->blockSize);
+}
+
+static void bench_arm_lin_to_db_f32(
+  const arm_bench_config * cfg)
+{
+  arm_lin_to_db_f32(benchState_f32, benchDst_f32, cfg->blockSize);
+}
+
+static void bench_arm_lin_to_db_q31(
+  const arm_bench_config * cfg)
+{
+  arm_lin_to_db_q31(benchState_q31, benchDst_q31, cfg->blockSize);
+}
+
+static void bench_arm_lin_to_db_q15(
+  const arm_bench_config * cfg)
+{
+  arm_lin_to_db_q15(benchState_q15, benchDst_q15, cfg->blockSize);
+}
+
+static void bench_arm_db_to_lin_f32(
+  const arm_bench_config * cfg)
+{
+  arm_db_to_lin_f32(benchState_f32, benchDst_f32, cfg->blockSize);
+}
+
+static void bench_arm_db_to_lin_q31(
+  const arm_bench_config * cfg)
+{
+  arm_db_to_lin_q31(benchState_q31, benchDst_q31, cfg->blockSize);
+}
+
+static void bench_arm_db_to_lin_q15(
+  const arm_bench_config * cfg)
+{
+  arm_db_to_lin_q15(benchState_q15, benchDst_q15, cfg->blockSize);
+}
+
+static void bench_arm_rsqrt_f32(
+  const arm_bench_config * cfg)
+{
+  arm_rsqrt_f32(benchState_f32, benchDst_f32, cfg->blockSize);
+}
+
+static void bench_arm_rsqrt_q31(
+  const arm_bench_config * cfg)
+{
+  arm_rsqrt_q31(benchState_q31, benchDst_q31, cfg->blockSize);
+}
+
+static void bench_arm_rsqrt_q15(
+  const arm_bench_config * cfg)
+{
+  arm_rsqrt_q15(benchState_q15, benchDst_q31, cfg->blockSize);
+}
+
+/* The C library functions the fast approximations replace, for comparison */
+
+static void bench_libm_log2f(
+  const arm_bench_config * cfg)
+{
+  uint32_t i;
+
+  for (i = 0u; i < cfg->blockSize; i++)
+  {
+    benchDst_f32[i] = log2f(benchState_f32[i]);
+  }
+}
+
+static void bench_libm_logf(
+  const arm_bench_config * cfg)
+{
+  uint32_t i;
+
+  for (i = 0u; i < cfg->blockSize; i++)
+  {
+    benchDst_f32[i] = logf(benchState_f32[i]);
+  }
+}
+
+static void bench_libm_log10f(
+  const arm_bench_config * cfg)
+{
+  uint32_t i;
+
+  for (i = 0u; i < cfg->blockSize; i++)
+  {
+    benchDst_f32[i] = log10f(benchState_f32[i]);
+  }
+}
+
+static void bench_libm_exp2f(
+  const arm_bench_config * cfg)
+{
+  uint32_t i;
+
+  for (i = 0u; i < cfg->blockSize; i++)
+  {
+    benchDst_f32[i] = exp2f(benchState_f32[i]);
+  }
+}
+
+static void bench_libm_expf(
+  const arm_bench_config * cfg)
+{
+  uint32_t i;
+
+  for (i = 0u; i < cfg->blockSize; i++)
+  {
+    benchDst_f32[i] = expf(benchState_f32[i]);
+  }
+}
+
+static void bench_libm_rsqrtf(
+  const arm_bench_config * cfg)
+{
+  uint32_t i;
+
+  for (i = 0u; i < cfg->blockSize; i++)
+  {
+    benchDst_f32[i] = 1.0f / sqrtf(benchState_f32[i]);
+  }
+}
+
+const arm_bench_kernel armBenchFastMath[] = {
+  ARM_BENCH_ENTRY(arm_sin_f32, "FastMath", f32, 0u, setup_angles),
+  ARM_BENCH_ENTRY(arm_sin_q31, "FastMath", q31, 0u, setup_angles),
+  ARM_BENCH_ENTRY(arm_sin_q15, "FastMath", q15, 0u, setup_angles),
+  ARM_BENCH_ENTRY(arm_cos_f32, "FastMath", f32, 0u, setup_angles),
+  ARM_BENCH_ENTRY(arm_cos_q31, "FastMath", q31, 0u, setup_angles),
+  ARM_BENCH_ENTRY(arm_cos_q15, "FastMath", q15, 0u, setup_angles),
+  ARM_BENCH_ENTRY(arm_sin_block_f32, "FastMath", f32, 0u, setup_angles),
+  ARM_BENCH_ENTRY(arm_sin_block_q31, "FastMath", q31, 0u, setup_angles),
+  ARM_BENCH_ENTRY(arm_sin_block_q15, "FastMath", q15, 0u, setup_angles),
+  ARM_BENCH_ENTRY(arm_cos_block_f32, "FastMath", f32, 0u, setup_angles),
+  ARM_BENCH_ENTRY(arm_cos_block_q31, "FastMath", q31, 0u, setup_angles),
+  ARM_BENCH_ENTRY(arm_cos_block_q15, "FastMath", q15, 0u, setup_angles),
+  ARM_BENCH_ENTRY(arm_sqrt_f32, "FastMath", f32, 0u, setup_angles),
+  ARM_BENCH_ENTRY(arm_sqrt_q31, "FastMath", q31, 0u, setup_angles),
+  ARM_BENCH_ENTRY(arm_sqrt_q15, "FastMath", q15, 0u, setup_angles),
+  ARM_BENCH_ENTRY(arm_log2_f32, "FastMath", f32, 0u, setup_positive),
+  ARM_BENCH_ENTRY(arm_log2_q31, "FastMath", q31, 0u, setup_positive),
+  ARM_BENCH_ENTRY(arm_log2_q15, "FastMath", q15, 0u, setup_positive),
+  ARM_BENCH_ENTRY(arm_ln_f32, "FastMath", f32, 0u, setup_positive),
+  ARM_BENCH_ENTRY(arm_log10_f32, "FastMath", f32, 0u, setup_positive),
+  ARM_BENCH_ENTRY(arm_exp2_f32, "FastMath", f32, 0u, setup_levels),
+  ARM_BENCH_ENTRY(arm_exp2_q31, "FastMath", q31, 0u, setup_levels),
+  ARM_BENCH_ENTRY(arm_exp2_q15, "FastMath", q15, 0u, setup_levels),
+  ARM_BENCH_ENTRY(arm_exp_f32, "FastMath", f32, 0u, setup_levels),
+  ARM_BENCH_ENTRY(arm_lin_to_db_f32, "FastMath", f32, 0u, setup_positive),
+  ARM_BENCH_ENTRY(arm_lin_to_db_q31, "FastMath", q31, 0u, setup_positive),
+  ARM_BENCH_ENTRY(arm_lin_to_db_q15, "FastMath", q15, 0u, setup_positive),
+  ARM_BENCH_ENTRY(arm_db_to_lin_f32, "FastMath", f32, 0u, setup_levels),
+  ARM_BENCH_ENTRY(arm_db_to_lin_q31, "FastMath", q31, 0u, setup_levels),
+  ARM_BENCH_ENTRY(arm_db_to_lin_q15, "FastMath", q15, 0u, setup_levels),
+  ARM_BENCH_ENTRY(arm_rsqrt_f32, "FastMath", f32, 0u, setup_positive),
+  ARM_BENCH_ENTRY(arm_rsqrt_q31, "FastMath", q31, 0u, setup_positive),
+  ARM_BENCH_ENTRY(arm_rsqrt_q15, "FastMath", q15, 0u, setup_positive),
+  ARM_BENCH_ENTRY(libm_log2f, "FastMath", f32, 0u, setup_positive),
+  ARM_BENCH_ENTRY(libm_logf, "FastMath", f32, 0u, setup_positive),
+  ARM_BENCH_ENTRY(libm_log10f, "FastMath", f32, 0u, setup_positive),
+  ARM_BENCH_ENTRY(libm_exp2f, "FastMath", f32, 0u, setup_levels),
+  ARM_BENCH_ENTRY(libm_expf, "FastMath", f32, 0u, setup_levels),
+  ARM_BENCH_ENTRY(libm_rsqrtf, "FastMath", f32, 0u, setup_positive),
+};
+
+const uint32_t armBenchFastMathCount =
+  sizeof(armBenchFastMath) / sizeof(armBenchFastMath[0]);
+
+/* ----------------------------------------------------------------------
+** Controller functions
+** ------------------------------------------------------------------- */
+
+static uint32_t setup_pid(
+  const arm_bench_config * cfg)
+{
+  pidF32.Kp = 0.5f;
+  pidF32.Ki = 0.125f;
+  pidF32.Kd = 0.0625f;
+  arm_pid_init_f32(&pidF32, 1);
+
+  pidQ31.Kp = 0x40000000;
+  pidQ31.Ki = 0x10000000;
+  pidQ31.Kd = 0x08000000;
+  arm_pid_init_q31(&pidQ31, 1);
+
+  pidQ15.Kp = 0x4000;
+  pidQ15.Ki = 0x1000;
+  pidQ15.Kd = 0x0800;
+  arm_pid_init_q15(&pidQ15, 1);
+
+  return (cfg->blockSize);
+}
+
+static void bench_arm_pid_f32(
+  const arm_bench_config * cfg)
+{
+  uint32_t i;
+
+  for (i = 0u; i < cfg->blockSize; i++)
+  {
+    benchDst_f32[i] = arm_pid_f32(&pidF32, benchSrcA_f32[i]);
+  }
+}
+
+static void bench_arm_pid_q31(
+  const arm_bench_config * cfg)
+{
+  uint32_t i;
+
+  for (i = 0u; i < cfg->blockSize; i++)
+  {
+    benchDst_q31[i] = arm_pid_q31(&pidQ31, benchSrcA_q31[i]);
+  }
+}
+
+static void bench_arm_pid_q15(
+  const arm_bench_config * cfg)
+{
+  uint32_t i;
+
+  for (i = 0u; i < cfg->blockSize; i++)
+  {
+    benchDst_q15[i] = arm_pid_q15(&pidQ15, benchSrcA_q15[i]);
+  }
+}
+
+static void bench_arm_sin_cos_f32(
+  const arm_bench_config * cfg)
+{
+  uint32_t i;
+
+  /* theta is in degrees; the half scale inputs map to [-90, 90) */
+  for (i = 0u; i < cfg->blockSize; i++)
+  {
+    arm_sin_cos_f32(180.0f * benchSrcA_f32[i], &benchDst_f32[2u * i],
+                    &benchDst_f32[(2u * i) + 1u]);
+  }
+}
+
+static void bench_arm_sin_cos_q31(
+  const arm_bench_config * cfg)
+{
+  uint32_t i;
+
+  for (i = 0u; i < cfg->blockSize; i++)
+  {
+    arm_sin_cos_q31(benchSrcA_q31[i], &benchDst_q31[2u * i],
+                    &benchDst_q31[(2u * i) + 1u]);
+  }
+}
+
+static void bench_arm_clarke_park_f32(
+  const arm_bench_config * cfg)
+{
+  float32_t alpha, beta;
+  uint32_t i;
+
+  for (i = 0u; i < cfg->blockSize; i++)
+  {
+    arm_clarke_f32(benchSrcA_f32[i], benchSrcB_f32[i], &alpha, &beta);
+    arm_park_f32(alpha, beta, &benchDst_f32[2u * i], &benchDst_f32[(2u * i) + 1u],
+                 0.6f, 0.8f);
+  }
+}
+
+static void bench_arm_clarke_park_q31(
+  const arm_bench_config * cfg)
+{
+  q31_t alpha, beta;
+  uint32_t i;
+
+  for (i = 0u; i < cfg->blockSize; i++)
+  {
+    arm_clarke_q31(benchSrcA_q31[i], benchSrcB_q31[i], &alpha, &beta);
+    arm_park_q31(alpha, beta, &benchDst_q31[2u * i], &benchDst_q31[(2u * i) + 1u],
+                 0x4CCCCCCD, 0x66666666);
+  }
+}
+
+const arm_bench_kernel armBenchController[] = {
+  ARM_BENCH_ENTRY(arm_pid_f32, "Controller", f32, 0u, setup_pid),
+  ARM_BENCH_ENTRY(arm_pid_q31, "Controller", q31, 0u, setup_pid),
+  ARM_BENCH_ENTRY(arm_pid_q15, "Controller", q15, 0u, setup_pid),
+  ARM_BENCH_ENTRY(arm_sin_cos_f32, "Controller", f32, 0u, 0),
+  ARM_BENCH_ENTRY(arm_sin_cos_q31, "Controller", q31, 0u, 0),
+  ARM_BENCH_ENTRY(arm_clarke_park_f32, "Controller", f32, 0u, 0),
+  ARM_BENCH_ENTRY(arm_clarke_park_q31, "Controller", q31, 0u, 0),
+};
+
+const uint32_t armBenchControllerCount =
+  sizeof(armBenchController) / sizeof(armBenchController[0]);
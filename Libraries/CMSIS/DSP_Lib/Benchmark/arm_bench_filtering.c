@@ -0,0 +1,1049 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* Project: 	    CMSIS DSP Library
+* Title:		arm_bench_filtering.c
+*
+* Description:	Benchmark table for the filtering functions.
+*
+* Target Processor: Host (ARM_MATH_HOST) / Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_bench.h"
+
+/* Decimation and interpolation factor */
+#define BENCH_FACTOR            2u
+
+/* Maximum tap delay of the sparse filters, as a multiple of numTaps */
+#define BENCH_SPARSE_SPREAD     2u
+
+/* Channels of the multichannel filters; blockSize counts the samples of all channels */
+#define BENCH_CHANNELS          2u
+
+/* Multistage decimator: ratio, passband (fraction of the output Nyquist frequency) and attenuation */
+#define BENCH_MS_RATIO          8u
+#define BENCH_MS_PASSBAND       0.9f
+#define BENCH_MS_ATTENUATION    80.0f
+
+static arm_fir_instance_f32 firF32;
+static arm_fir_instance_q31 firQ31;
+static arm_fir_instance_q15 firQ15;
+static arm_fir_instance_q7 firQ7;
+
+static arm_fir_circ_instance_f32 firCircF32;
+static arm_fir_circ_instance_q31 firCircQ31;
+static arm_fir_circ_instance_q15 firCircQ15;
+
+static arm_fir_multi_instance_f32 firMultiF32;
+static arm_fir_multi_instance_q31 firMultiQ31;
+static arm_fir_multi_instance_q15 firMultiQ15;
+
+static arm_fir_sym_instance_f32 firSymF32;
+static arm_fir_sym_instance_q31 firSymQ31;
+static arm_fir_sym_instance_q15 firSymQ15;
+
+static arm_fir_decimate_instance_f32 decF32;
+static arm_fir_decimate_instance_q31 decQ31;
+static arm_fir_decimate_instance_q15 decQ15;
+
+static arm_fir_interpolate_instance_f32 intF32;
+static arm_fir_interpolate_instance_q31 intQ31;
+static arm_fir_interpolate_instance_q15 intQ15;
+
+static arm_fir_halfband_decimate_instance_f32 hbDecF32;
+static arm_fir_halfband_decimate_instance_q31 hbDecQ31;
+static arm_fir_halfband_decimate_instance_q15 hbDecQ15;
+
+static arm_fir_halfband_interpolate_instance_f32 hbIntF32;
+static arm_fir_halfband_interpolate_instance_q31 hbIntQ31;
+static arm_fir_halfband_interpolate_instance_q15 hbIntQ15;
+
+static arm_fir_multistage_instance_f32 msF32;
+
+static arm_fir_lattice_instance_f32 firLatF32;
+static arm_fir_lattice_instance_q31 firLatQ31;
+static arm_fir_lattice_instance_q15 firLatQ15;
+
+static arm_iir_lattice_instance_f32 iirLatF32;
+static arm_iir_lattice_instance_q31 iirLatQ31;
+static arm_iir_lattice_instance_q15 iirLatQ15;
+
+static arm_lms_instance_f32 lmsF32;
+static arm_lms_instance_q31 lmsQ31;
+static arm_lms_instance_q15 lmsQ15;
+
+static arm_lms_norm_instance_f32 lmsNormF32;
+static arm_lms_norm_instance_q31 lmsNormQ31;
+static arm_lms_norm_instance_q15 lmsNormQ15;
+
+static arm_fir_sparse_instance_f32 sparseF32;
+static arm_fir_sparse_instance_q31 sparseQ31;
+static arm_fir_sparse_instance_q15 sparseQ15;
+static arm_fir_sparse_instance_q7 sparseQ7;
+
+static arm_biquad_casd_df1_inst_f32 df1F32;
+static arm_biquad_casd_df1_inst_q31 df1Q31;
+static arm_biquad_casd_df1_inst_q15 df1Q15;
+static arm_biquad_cas_df1_32x64_ins_q31 df1Q31x64;
+static arm_biquad_cas_df1_ef_ins_q31 df1EfQ31;
+static arm_biquad_cas_df1_ef_ins_q15 df1EfQ15;
+static arm_biquad_cascade_df2T_instance_f32 df2TF32;
+static arm_biquad_cascade_df2T_instance_q31 df2TQ31;
+static arm_biquad_cascade_df2T_instance_q15 df2TQ15;
+static arm_biquad_cascade_stereo_df2T_instance_f32 df2TStereoF32;
+
+static arm_biquad_casd_df1_multi_inst_f32 df1MultiF32;
+static arm_biquad_casd_df1_multi_inst_q31 df1MultiQ31;
+static arm_biquad_casd_df1_multi_inst_q15 df1MultiQ15;
+
+/* ----------------------------------------------------------------------
+** FIR filters
+** ------------------------------------------------------------------- */
+
+static uint32_t setup_fir(
+  const arm_bench_config * cfg)
+{
+  arm_fir_init_f32(&firF32, (uint16_t) cfg->numTaps, benchCoeff_f32, benchState_f32,
+                   cfg->blockSize);
+  arm_fir_init_q31(&firQ31, (uint16_t) cfg->numTaps, benchCoeff_q31, benchState_q31,
+                   cfg->blockSize);
+  arm_fir_init_q7(&firQ7, (uint16_t) cfg->numTaps, benchCoeff_q7, benchState_q7,
+                  cfg->blockSize);
+
+  return (cfg->blockSize);
+}
+
+static uint32_t setup_fir_q15(
+  const arm_bench_config * cfg)
+{
+  /* The Q15 FIR requires an even number of taps, at least 4 */
+  if(arm_fir_init_q15(&firQ15, (uint16_t) cfg->numTaps, benchCoeff_q15, benchState_q15,
+                      cfg->blockSize) != ARM_MATH_SUCCESS)
+  {
+    return (0u);
+  }
+
+  return (cfg->blockSize);
+}
+
+static void bench_arm_fir_f32(
+  const arm_bench_config * cfg)
+{
+  arm_fir_f32(&firF32, benchSrcA_f32, benchDst_f32, cfg->blockSize);
+}
+
+static void bench_arm_fir_q31(
+  const arm_bench_config * cfg)
+{
+  arm_fir_q31(&firQ31, benchSrcA_q31, benchDst_q31, cfg->blockSize);
+}
+
+static void bench_arm_fir_fast_q31(
+  const arm_bench_config * cfg)
+{
+  arm_fir_fast_q31(&firQ31, benchSrcA_q31, benchDst_q31, cfg->blockSize);
+}
+
+static void bench_arm_fir_q15(
+  const arm_bench_config * cfg)
+{
+  arm_fir_q15(&firQ15, benchSrcA_q15, benchDst_q15, cfg->blockSize);
+}
+
+static void bench_arm_fir_fast_q15(
+  const arm_bench_config * cfg)
+{
+  arm_fir_fast_q15(&firQ15, benchSrcA_q15, benchDst_q15, cfg->blockSize);
+}
+
+static void bench_arm_fir_q7(
+  const arm_bench_config * cfg)
+{
+  arm_fir_q7(&firQ7, benchSrcA_q7, benchDst_q7, cfg->blockSize);
+}
+
+/* ----------------------------------------------------------------------
+** Sample-by-sample FIR filters on the instances of setup_fir(), one call
+** per input sample.  The difference to arm_fir_xxx is the call overhead.
+** ------------------------------------------------------------------- */
+
+static void bench_arm_fir_sample_f32(
+  const arm_bench_config * cfg)
+{
+  uint32_t n;
+
+  for (n = 0u; n < cfg->blockSize; n++)
+  {
+    benchDst_f32[n] = arm_fir_sample_f32(&firF32, benchSrcA_f32[n]);
+  }
+}
+
+static void bench_arm_fir_sample_q31(
+  const arm_bench_config * cfg)
+{
+  uint32_t n;
+
+  for (n = 0u; n < cfg->blockSize; n++)
+  {
+    benchDst_q31[n] = arm_fir_sample_q31(&firQ31, benchSrcA_q31[n]);
+  }
+}
+
+static void bench_arm_fir_sample_q15(
+  const arm_bench_config * cfg)
+{
+  uint32_t n;
+
+  for (n = 0u; n < cfg->blockSize; n++)
+  {
+    benchDst_q15[n] = arm_fir_sample_q15(&firQ15, benchSrcA_q15[n]);
+  }
+}
+
+/* ----------------------------------------------------------------------
+** Circular state FIR filters, with the shortest delay line for numTaps.
+** Compare with the linear FIR at small blocks: --blocks 1,4,16,64
+** ------------------------------------------------------------------- */
+
+static uint32_t setup_fir_circ(
+  const arm_bench_config * cfg)
+{
+  uint16_t delayLen = 1u;
+
+  while(delayLen < cfg->numTaps)
+  {
+    delayLen <<= 1u;
+  }
+
+  arm_fir_circ_init_f32(&firCircF32, (uint16_t) cfg->numTaps, benchCoeff_f32, benchState_f32,
+                        delayLen);
+  arm_fir_circ_init_q31(&firCircQ31, (uint16_t) cfg->numTaps, benchCoeff_q31, benchState_q31,
+                        delayLen);
+  arm_fir_circ_init_q15(&firCircQ15, (uint16_t) cfg->numTaps, benchCoeff_q15, benchState_q15,
+                        delayLen);
+
+  return (cfg->blockSize);
+}
+
+static void bench_arm_fir_circ_f32(
+  const arm_bench_config * cfg)
+{
+  arm_fir_circ_f32(&firCircF32, benchSrcA_f32, benchDst_f32, cfg->blockSize);
+}
+
+static void bench_arm_fir_circ_q31(
+  const arm_bench_config * cfg)
+{
+  arm_fir_circ_q31(&firCircQ31, benchSrcA_q31, benchDst_q31, cfg->blockSize);
+}
+
+static void bench_arm_fir_circ_q15(
+  const arm_bench_config * cfg)
+{
+  arm_fir_circ_q15(&firCircQ15, benchSrcA_q15, benchDst_q15, cfg->blockSize);
+}
+
+/* ----------------------------------------------------------------------
+** Multichannel FIR filters: BENCH_CHANNELS interleaved channels of
+** blockSize / BENCH_CHANNELS samples each, so the rate is comparable
+** with the single channel filters above.
+** ------------------------------------------------------------------- */
+
+static uint32_t setup_fir_multi(
+  const arm_bench_config * cfg)
+{
+  uint32_t frames = cfg->blockSize / BENCH_CHANNELS;
+
+  arm_fir_multi_init_f32(&firMultiF32, (uint16_t) cfg->numTaps, BENCH_CHANNELS,
+                         ARM_MULTI_INTERLEAVED, benchCoeff_f32, benchState_f32, frames);
+  arm_fir_multi_init_q31(&firMultiQ31, (uint16_t) cfg->numTaps, BENCH_CHANNELS,
+                         ARM_MULTI_INTERLEAVED, benchCoeff_q31, benchState_q31, frames);
+  arm_fir_multi_init_q15(&firMultiQ15, (uint16_t) cfg->numTaps, BENCH_CHANNELS,
+                         ARM_MULTI_INTERLEAVED, benchCoeff_q15, benchState_q15, frames);
+
+  return (frames * BENCH_CHANNELS);
+}
+
+static void bench_arm_fir_multi_f32(
+  const arm_bench_config * cfg)
+{
+  arm_fir_multi_f32(&firMultiF32, benchSrcA_f32, benchDst_f32,
+                    cfg->blockSize / BENCH_CHANNELS);
+}
+
+static void bench_arm_fir_multi_q31(
+  const arm_bench_config * cfg)
+{
+  arm_fir_multi_q31(&firMultiQ31, benchSrcA_q31, benchDst_q31,
+                    cfg->blockSize / BENCH_CHANNELS);
+}
+
+static void bench_arm_fir_multi_q15(
+  const arm_bench_config * cfg)
+{
+  arm_fir_multi_q15(&firMultiQ15, benchSrcA_q15, benchDst_q15,
+                    cfg->blockSize / BENCH_CHANNELS);
+}
+
+/* ----------------------------------------------------------------------
+** Decimators and interpolators.  The sample count is the input block.
+** ------------------------------------------------------------------- */
+
+static uint32_t setup_decimate(
+  const arm_bench_config * cfg)
+{
+  arm_status status;
+
+  status = arm_fir_decimate_init_f32(&decF32, (uint16_t) cfg->numTaps, BENCH_FACTOR,
+                                     benchCoeff_f32, benchState_f32, cfg->blockSize);
+  status |= arm_fir_decimate_init_q31(&decQ31, (uint16_t) cfg->numTaps, BENCH_FACTOR,
+                                      benchCoeff_q31, benchState_q31, cfg->blockSize);
+  status |= arm_fir_decimate_init_q15(&decQ15, (uint16_t) cfg->numTaps, BENCH_FACTOR,
+                                      benchCoeff_q15, benchState_q15, cfg->blockSize);
+
+  return ((status == ARM_MATH_SUCCESS) ? cfg->blockSize : 0u);
+}
+
+static void bench_arm_fir_decimate_f32(
+  const arm_bench_config * cfg)
+{
+  arm_fir_decimate_f32(&decF32, benchSrcA_f32, benchDst_f32, cfg->blockSize);
+}
+
+static void bench_arm_fir_decimate_q31(
+  const arm_bench_config * cfg)
+{
+  arm_fir_decimate_q31(&decQ31, benchSrcA_q31, benchDst_q31, cfg->blockSize);
+}
+
+static void bench_arm_fir_decimate_fast_q31(
+  const arm_bench_config * cfg)
+{
+  arm_fir_decimate_fast_q31(&decQ31, benchSrcA_q31, benchDst_q31, cfg->blockSize);
+}
+
+static void bench_arm_fir_decimate_q15(
+  const arm_bench_config * cfg)
+{
+  arm_fir_decimate_q15(&decQ15, benchSrcA_q15, benchDst_q15, cfg->blockSize);
+}
+
+static void bench_arm_fir_decimate_fast_q15(
+  const arm_bench_config * cfg)
+{
+  arm_fir_decimate_fast_q15(&decQ15, benchSrcA_q15, benchDst_q15, cfg->blockSize);
+}
+
+static uint32_t setup_interpolate(
+  const arm_bench_config * cfg)
+{
+  arm_status status;
+
+  status = arm_fir_interpolate_init_f32(&intF32, BENCH_FACTOR, (uint16_t) cfg->numTaps,
+                                        benchCoeff_f32, benchState_f32, cfg->blockSize);
+  status |= arm_fir_interpolate_init_q31(&intQ31, BENCH_FACTOR, (uint16_t) cfg->numTaps,
+                                         benchCoeff_q31, benchState_q31, cfg->blockSize);
+  status |= arm_fir_interpolate_init_q15(&intQ15, BENCH_FACTOR, (uint16_t) cfg->numTaps,
+                                         benchCoeff_q15, benchState_q15, cfg->blockSize);
+
+  return ((status == ARM_MATH_SUCCESS) ? cfg->blockSize : 0u);
+}
+
+static void bench_arm_fir_interpolate_f32(
+  const arm_bench_config * cfg)
+{
+  arm_fir_interpolate_f32(&intF32, benchSrcA_f32, benchDst_f32, cfg->blockSize);
+}
+
+static void bench_arm_fir_interpolate_q31(
+  const arm_bench_config * cfg)
+{
+  arm_fir_interpolate_q31(&intQ31, benchSrcA_q31, benchDst_q31, cfg->blockSize);
+}
+
+static void bench_arm_fir_interpolate_q15(
+  const arm_bench_config * cfg)
+{
+  arm_fir_interpolate_q15(&intQ15, benchSrcA_q15, benchDst_q15, cfg->blockSize);
+}
+
+/* ----------------------------------------------------------------------
+** Symmetric FIR filters, numTaps long, on the first half of the shared
+** coefficients: the cost does not depend on their values.
+** ------------------------------------------------------------------- */
+
+static uint32_t setup_fir_sym(
+  const arm_bench_config * cfg)
+{
+  arm_fir_sym_init_f32(&firSymF32, (uint16_t) cfg->numTaps, benchCoeff_f32, benchState_f32,
+                       cfg->blockSize);
+  arm_fir_sym_init_q31(&firSymQ31, (uint16_t) cfg->numTaps, benchCoeff_q31, benchState_q31,
+                       cfg->blockSize);
+  arm_fir_sym_init_q15(&firSymQ15, (uint16_t) cfg->numTaps, benchCoeff_q15, benchState_q15,
+                       cfg->blockSize);
+
+  return (cfg->blockSize);
+}
+
+static void bench_arm_fir_sym_f32(
+  const arm_bench_config * cfg)
+{
+  arm_fir_sym_f32(&firSymF32, benchSrcA_f32, benchDst_f32, cfg->blockSize);
+}
+
+static void bench_arm_fir_sym_q31(
+  const arm_bench_config * cfg)
+{
+  arm_fir_sym_q31(&firSymQ31, benchSrcA_q31, benchDst_q31, cfg->blockSize);
+}
+
+static void bench_arm_fir_sym_q15(
+  const arm_bench_config * cfg)
+{
+  arm_fir_sym_q15(&firSymQ15, benchSrcA_q15, benchDst_q15, cfg->blockSize);
+}
+
+/* ----------------------------------------------------------------------
+** Half-band decimators and interpolators by 2.  The tap count is rounded
+** up to the next 4k+3 and the decimator block down to an even size, so
+** they compare with the decimators and interpolators of BENCH_FACTOR 2.
+** ------------------------------------------------------------------- */
+
+static uint32_t setup_halfband(
+  const arm_bench_config * cfg)
+{
+  uint16_t numTaps = (uint16_t) (cfg->numTaps | 3u);
+  uint32_t blockSize = cfg->blockSize & ~1u;
+  arm_status status;
+
+  status = arm_fir_halfband_decimate_init_f32(&hbDecF32, numTaps, benchCoeff_f32,
+                                              benchState_f32, blockSize);
+  status |= arm_fir_halfband_decimate_init_q31(&hbDecQ31, numTaps, benchCoeff_q31,
+                                               benchState_q31, blockSize);
+  status |= arm_fir_halfband_decimate_init_q15(&hbDecQ15, numTaps, benchCoeff_q15,
+                                               benchState_q15, blockSize);
+
+  /* The interpolators share the state buffers, only one kernel runs at a time */
+  status |= arm_fir_halfband_interpolate_init_f32(&hbIntF32, numTaps, benchCoeff_f32,
+                                                  benchState_f32, blockSize);
+  status |= arm_fir_halfband_interpolate_init_q31(&hbIntQ31, numTaps, benchCoeff_q31,
+                                                  benchState_q31, blockSize);
+  status |= arm_fir_halfband_interpolate_init_q15(&hbIntQ15, numTaps, benchCoeff_q15,
+                                                  benchState_q15, blockSize);
+
+  return (((status == ARM_MATH_SUCCESS) && (blockSize != 0u)) ? blockSize : 0u);
+}
+
+static void bench_arm_fir_halfband_decimate_f32(
+  const arm_bench_config * cfg)
+{
+  arm_fir_halfband_decimate_f32(&hbDecF32, benchSrcA_f32, benchDst_f32, cfg->blockSize & ~1u);
+}
+
+static void bench_arm_fir_halfband_decimate_q31(
+  const arm_bench_config * cfg)
+{
+  arm_fir_halfband_decimate_q31(&hbDecQ31, benchSrcA_q31, benchDst_q31, cfg->blockSize & ~1u);
+}
+
+static void bench_arm_fir_halfband_decimate_q15(
+  const arm_bench_config * cfg)
+{
+  arm_fir_halfband_decimate_q15(&hbDecQ15, benchSrcA_q15, benchDst_q15, cfg->blockSize & ~1u);
+}
+
+static void bench_arm_fir_halfband_interpolate_f32(
+  const arm_bench_config * cfg)
+{
+  arm_fir_halfband_interpolate_f32(&hbIntF32, benchSrcA_f32, benchDst_f32, cfg->blockSize & ~1u);
+}
+
+static void bench_arm_fir_halfband_interpolate_q31(
+  const arm_bench_config * cfg)
+{
+  arm_fir_halfband_interpolate_q31(&hbIntQ31, benchSrcA_q31, benchDst_q31, cfg->blockSize & ~1u);
+}
+
+static void bench_arm_fir_halfband_interpolate_q15(
+  const arm_bench_config * cfg)
+{
+  arm_fir_halfband_interpolate_q15(&hbIntQ15, benchSrcA_q15, benchDst_q15, cfg->blockSize & ~1u);
+}
+
+/* ----------------------------------------------------------------------
+** Multistage decimator by BENCH_MS_RATIO, with the filters designed by the
+** planner rather than the shared coefficients.  The arena is the state buffer.
+** A single stage arm_fir_decimate_f32() for the same specification
+** costs plan.singleStageMacsPerOutput multiplications per output.
+** ------------------------------------------------------------------- */
+
+static uint32_t setup_multistage(
+  const arm_bench_config * cfg)
+{
+  arm_fir_multistage_plan_instance_f32 plan;
+  uint32_t blockSize = (cfg->blockSize / BENCH_MS_RATIO) * BENCH_MS_RATIO;
+
+  if((blockSize == 0u) ||
+     (arm_fir_multistage_plan_f32(&plan, BENCH_MS_RATIO, 0u, BENCH_MS_PASSBAND,
+                                  BENCH_MS_ATTENUATION, ARM_FIR_MULTISTAGE_MAX_STAGES) != ARM_MATH_SUCCESS) ||
+     (arm_fir_multistage_init_f32(&msF32, &plan, blockSize, benchState_f32,
+                                  ARM_BENCH_BUF_LEN) != ARM_MATH_SUCCESS))
+  {
+    return (0u);
+  }
+
+  return (blockSize);
+}
+
+static void bench_arm_fir_multistage_f32(
+  const arm_bench_config * cfg)
+{
+  arm_fir_multistage_f32(&msF32, benchSrcA_f32, benchDst_f32,
+                         (cfg->blockSize / BENCH_MS_RATIO) * BENCH_MS_RATIO);
+}
+
+/* ----------------------------------------------------------------------
+** Lattice filters.  numTaps is the number of stages.  The shared
+** coefficients are well below 1 so the reflection coefficients are stable.
+** ------------------------------------------------------------------- */
+
+static uint32_t setup_lattice(
+  const arm_bench_config * cfg)
+{
+  uint16_t numStages = (uint16_t) cfg->numTaps;
+
+  arm_fir_lattice_init_f32(&firLatF32, numStages, benchCoeff_f32, benchState_f32);
+  arm_fir_lattice_init_q31(&firLatQ31, numStages, benchCoeff_q31, benchState_q31);
+  arm_fir_lattice_init_q15(&firLatQ15, numStages, benchCoeff_q15, benchState_q15);
+
+  arm_iir_lattice_init_f32(&iirLatF32, numStages, benchCoeff_f32,
+                           &benchCoeff_f32[numStages], benchState_f32, cfg->blockSize);
+  arm_iir_lattice_init_q31(&iirLatQ31, numStages, benchCoeff_q31,
+                           &benchCoeff_q31[numStages], benchState_q31, cfg->blockSize);
+  arm_iir_lattice_init_q15(&iirLatQ15, numStages, benchCoeff_q15,
+                           &benchCoeff_q15[numStages], benchState_q15, cfg->blockSize);
+
+  return (cfg->blockSize);
+}
+
+static void bench_arm_fir_lattice_f32(
+  const arm_bench_config * cfg)
+{
+  arm_fir_lattice_f32(&firLatF32, benchSrcA_f32, benchDst_f32, cfg->blockSize);
+}
+
+static void bench_arm_fir_lattice_q31(
+  const arm_bench_config * cfg)
+{
+  arm_fir_lattice_q31(&firLatQ31, benchSrcA_q31, benchDst_q31, cfg->blockSize);
+}
+
+static void bench_arm_fir_lattice_q15(
+  const arm_bench_config * cfg)
+{
+  arm_fir_lattice_q15(&firLatQ15, benchSrcA_q15, benchDst_q15, cfg->blockSize);
+}
+
+static void bench_arm_iir_lattice_f32(
+  const arm_bench_config * cfg)
+{
+  arm_iir_lattice_f32(&iirLatF32, benchSrcA_f32, benchDst_f32, cfg->blockSize);
+}
+
+static void bench_arm_iir_lattice_q31(
+  const arm_bench_config * cfg)
+{
+  arm_iir_lattice_q31(&iirLatQ31, benchSrcA_q31, benchDst_q31, cfg->blockSize);
+}
+
+static void bench_arm_iir_lattice_q15(
+  const arm_bench_config * cfg)
+{
+  arm_iir_lattice_q15(&iirLatQ15, benchSrcA_q15, benchDst_q15, cfg->blockSize);
+}
+
+/* ----------------------------------------------------------------------
+** Adaptive filters.  Output and error go to the two halves of pDst.
+** ------------------------------------------------------------------- */
+
+static uint32_t setup_lms(
+  const arm_bench_config * cfg)
+{
+  uint16_t numTaps = (uint16_t) cfg->numTaps;
+
+  arm_lms_init_f32(&lmsF32, numTaps, benchCoeff_f32, benchState_f32, 0.001f,
+                   cfg->blockSize);
+  arm_lms_init_q31(&lmsQ31, numTaps, benchCoeff_q31, benchState_q31, 0x00200000,
+                   cfg->blockSize, 0u);
+  arm_lms_init_q15(&lmsQ15, numTaps, benchCoeff_q15, benchState_q15, 0x0020,
+                   cfg->blockSize, 0u);
+
+  arm_lms_norm_init_f32(&lmsNormF32, numTaps, benchCoeff_f32, benchState_f32, 0.01f,
+                        cfg->blockSize);
+  arm_lms_norm_init_q31(&lmsNormQ31, numTaps, benchCoeff_q31, benchState_q31,
+                        0x01000000, cfg->blockSize, 0u);
+  arm_lms_norm_init_q15(&lmsNormQ15, numTaps, benchCoeff_q15, benchState_q15, 0x0100,
+                        cfg->blockSize, 0u);
+
+  return (cfg->blockSize);
+}
+
+static void bench_arm_lms_f32(
+  const arm_bench_config * cfg)
+{
+  arm_lms_f32(&lmsF32, benchSrcA_f32, benchSrcB_f32, benchDst_f32,
+              &benchDst_f32[cfg->blockSize], cfg->blockSize);
+}
+
+static void bench_arm_lms_q31(
+  const arm_bench_config * cfg)
+{
+  arm_lms_q31(&lmsQ31, benchSrcA_q31, benchSrcB_q31, benchDst_q31,
+              &benchDst_q31[cfg->blockSize], cfg->blockSize);
+}
+
+static void bench_arm_lms_q15(
+  const arm_bench_config * cfg)
+{
+  arm_lms_q15(&lmsQ15, benchSrcA_q15, benchSrcB_q15, benchDst_q15,
+              &benchDst_q15[cfg->blockSize], cfg->blockSize);
+}
+
+static void bench_arm_lms_norm_f32(
+  const arm_bench_config * cfg)
+{
+  arm_lms_norm_f32(&lmsNormF32, benchSrcA_f32, benchSrcB_f32, benchDst_f32,
+                   &benchDst_f32[cfg->blockSize], cfg->blockSize);
+}
+
+static void bench_arm_lms_norm_q31(
+  const arm_bench_config * cfg)
+{
+  arm_lms_norm_q31(&lmsNormQ31, benchSrcA_q31, benchSrcB_q31, benchDst_q31,
+                   &benchDst_q31[cfg->blockSize], cfg->blockSize);
+}
+
+static void bench_arm_lms_norm_q15(
+  const arm_bench_config * cfg)
+{
+  arm_lms_norm_q15(&lmsNormQ15, benchSrcA_q15, benchSrcB_q15, benchDst_q15,
+                   &benchDst_q15[cfg->blockSize], cfg->blockSize);
+}
+
+/* ----------------------------------------------------------------------
+** Sparse FIR filters.  Taps are spread evenly over BENCH_SPARSE_SPREAD
+** times the tap count.
+** ------------------------------------------------------------------- */
+
+static uint32_t setup_sparse(
+  const arm_bench_config * cfg)
+{
+  uint16_t numTaps = (uint16_t) cfg->numTaps;
+  uint16_t maxDelay = (uint16_t) (BENCH_SPARSE_SPREAD * cfg->numTaps);
+  uint32_t i;
+
+  for (i = 0u; i < numTaps; i++)
+  {
+    benchTapDelay[i] = (int32_t) (BENCH_SPARSE_SPREAD * i);
+  }
+
+  arm_fir_sparse_init_f32(&sparseF32, numTaps, benchCoeff_f32, benchState_f32,
+                          benchTapDelay, maxDelay, cfg->blockSize);
+  arm_fir_sparse_init_q31(&sparseQ31, numTaps, benchCoeff_q31, benchState_q31,
+                          benchTapDelay, maxDelay, cfg->blockSize);
+  arm_fir_sparse_init_q15(&sparseQ15, numTaps, benchCoeff_q15, benchState_q15,
+                          benchTapDelay, maxDelay, cfg->blockSize);
+  arm_fir_sparse_init_q7(&sparseQ7, numTaps, benchCoeff_q7, benchState_q7,
+                         benchTapDelay, maxDelay, cfg->blockSize);
+
+  return (cfg->blockSize);
+}
+
+static void bench_arm_fir_sparse_f32(
+  const arm_bench_config * cfg)
+{
+  arm_fir_sparse_f32(&sparseF32, benchSrcA_f32, benchDst_f32, benchSrcB_f32,
+                     cfg->blockSize);
+}
+
+static void bench_arm_fir_sparse_q31(
+  const arm_bench_config * cfg)
+{
+  arm_fir_sparse_q31(&sparseQ31, benchSrcA_q31, benchDst_q31, benchSrcB_q31,
+                     cfg->blockSize);
+}
+
+static void bench_arm_fir_sparse_q15(
+  const arm_bench_config * cfg)
+{
+  arm_fir_sparse_q15(&sparseQ15, benchSrcA_q15, benchDst_q15, benchSrcB_q15,
+                     benchScratch_q31, cfg->blockSize);
+}
+
+static void bench_arm_fir_sparse_q7(
+  const arm_bench_config * cfg)
+{
+  arm_fir_sparse_q7(&sparseQ7, benchSrcA_q7, benchDst_q7, benchSrcB_q7,
+                    benchScratch_q31, cfg->blockSize);
+}
+
+/* ----------------------------------------------------------------------
+** Convolution and correlation of a blockSize input with a numTaps kernel.
+** The fast Q15 versions read the word just before an odd-length kernel,
+** so the kernel starts BENCH_GUARD elements into the coefficient buffer.
+** ------------------------------------------------------------------- */
+
+#define BENCH_GUARD             4u
+
+#define BENCH_CONV(fn, T) \
+  static void bench_##fn(const arm_bench_config * cfg) \
+  { fn(benchSrcA_##T, cfg->blockSize, &benchCoeff_##T[BENCH_GUARD], cfg->numTaps, \
+       benchDst_##T); }
+
+BENCH_CONV(arm_conv_f32, f32)
+BENCH_CONV(arm_conv_q31, q31)
+BENCH_CONV(arm_conv_fast_q31, q31)
+BENCH_CONV(arm_conv_q15, q15)
+BENCH_CONV(arm_conv_fast_q15, q15)
+BENCH_CONV(arm_conv_q7, q7)
+BENCH_CONV(arm_correlate_f32, f32)
+BENCH_CONV(arm_correlate_q31, q31)
+BENCH_CONV(arm_correlate_fast_q31, q31)
+BENCH_CONV(arm_correlate_q15, q15)
+BENCH_CONV(arm_correlate_fast_q15, q15)
+BENCH_CONV(arm_correlate_q7, q7)
+
+/* The FFT versions take their scratch from the floating-point state buffer */
+#define BENCH_CONV_FFT(fn, T) \
+  static void bench_##fn(const arm_bench_config * cfg) \
+  { fn(benchSrcA_##T, cfg->blockSize, &benchCoeff_##T[BENCH_GUARD], cfg->numTaps, \
+       benchDst_##T, benchState_f32); }
+
+BENCH_CONV_FFT(arm_conv_fft_f32, f32)
+BENCH_CONV_FFT(arm_conv_fft_q15, q15)
+BENCH_CONV_FFT(arm_correlate_fft_f32, f32)
+BENCH_CONV_FFT(arm_correlate_fft_q15, q15)
+
+/* ----------------------------------------------------------------------
+** Biquad cascades of ARM_BENCH_NUM_STAGES identical stable sections:
+** b = {0.2, 0.4, 0.2}, a = {0.5, -0.3}, fixed-point in Q1.30 / Q1.14
+** with a post shift of 1.
+** ------------------------------------------------------------------- */
+
+static uint32_t setup_biquad(
+  const arm_bench_config * cfg)
+{
+  float32_t *pF32 = &benchCoeff_f32[0];
+  q31_t *pQ31 = &benchCoeff_q31[0];
+  q15_t *pQ15 = &benchCoeff_q15[0];
+  uint32_t i;
+
+  for (i = 0u; i < ARM_BENCH_NUM_STAGES; i++)
+  {
+    *pF32++ = 0.2f;
+    *pF32++ = 0.4f;
+    *pF32++ = 0.2f;
+    *pF32++ = 0.5f;
+    *pF32++ = -0.3f;
+
+    *pQ31++ = 0x0CCCCCCD;
+    *pQ31++ = 0x1999999A;
+    *pQ31++ = 0x0CCCCCCD;
+    *pQ31++ = 0x20000000;
+    *pQ31++ = (q31_t) 0xECCCCCCD;
+
+    *pQ15++ = 0x0CCD;
+    *pQ15++ = 0;
+    *pQ15++ = 0x199A;
+    *pQ15++ = 0x0CCD;
+    *pQ15++ = 0x2000;
+    *pQ15++ = (q15_t) 0xECCD;
+  }
+
+  arm_biquad_cascade_df1_init_f32(&df1F32, ARM_BENCH_NUM_STAGES, benchCoeff_f32,
+                                  benchState_f32);
+  arm_biquad_cascade_df1_init_q31(&df1Q31, ARM_BENCH_NUM_STAGES, benchCoeff_q31,
+                                  benchState_q31, 1);
+  arm_biquad_cascade_df1_init_q15(&df1Q15, ARM_BENCH_NUM_STAGES, benchCoeff_q15,
+                                  benchState_q15, 1);
+  arm_biquad_cas_df1_32x64_init_q31(&df1Q31x64, ARM_BENCH_NUM_STAGES, benchCoeff_q31,
+                                    benchState_q63, 1u);
+  arm_biquad_cas_df1_ef_init_q31(&df1EfQ31, ARM_BENCH_NUM_STAGES, benchCoeff_q31,
+                                 &benchState_q31[8u * ARM_BENCH_NUM_STAGES], 1u, 2u);
+  arm_biquad_cas_df1_ef_init_q15(&df1EfQ15, ARM_BENCH_NUM_STAGES, benchCoeff_q15,
+                                 &benchState_q15[4u * ARM_BENCH_NUM_STAGES], 1, 2u);
+  arm_biquad_cascade_df2T_init_f32(&df2TF32, ARM_BENCH_NUM_STAGES, benchCoeff_f32,
+                                   &benchState_f32[4u * ARM_BENCH_NUM_STAGES]);
+  arm_biquad_cascade_df2T_init_q31(&df2TQ31, ARM_BENCH_NUM_STAGES, benchCoeff_q31,
+                                   &benchState_q31[4u * ARM_BENCH_NUM_STAGES], 1);
+  arm_biquad_cascade_df2T_init_q15(&df2TQ15, ARM_BENCH_NUM_STAGES, benchCoeff_q15,
+                                   &benchState_q31[6u * ARM_BENCH_NUM_STAGES], 1);
+  arm_biquad_cascade_stereo_df2T_init_f32(&df2TStereoF32, ARM_BENCH_NUM_STAGES, benchCoeff_f32,
+                                          &benchState_f32[6u * ARM_BENCH_NUM_STAGES]);
+
+  return (cfg->blockSize);
+}
+
+static void bench_arm_biquad_cascade_df1_f32(
+  const arm_bench_config * cfg)
+{
+  arm_biquad_cascade_df1_f32(&df1F32, benchSrcA_f32, benchDst_f32, cfg->blockSize);
+}
+
+static void bench_arm_biquad_cascade_df1_q31(
+  const arm_bench_config * cfg)
+{
+  arm_biquad_cascade_df1_q31(&df1Q31, benchSrcA_q31, benchDst_q31, cfg->blockSize);
+}
+
+static void bench_arm_biquad_cascade_df1_fast_q31(
+  const arm_bench_config * cfg)
+{
+  arm_biquad_cascade_df1_fast_q31(&df1Q31, benchSrcA_q31, benchDst_q31, cfg->blockSize);
+}
+
+static void bench_arm_biquad_cascade_df1_q15(
+  const arm_bench_config * cfg)
+{
+  arm_biquad_cascade_df1_q15(&df1Q15, benchSrcA_q15, benchDst_q15, cfg->blockSize);
+}
+
+static void bench_arm_biquad_cascade_df1_fast_q15(
+  const arm_bench_config * cfg)
+{
+  arm_biquad_cascade_df1_fast_q15(&df1Q15, benchSrcA_q15, benchDst_q15, cfg->blockSize);
+}
+
+static void bench_arm_biquad_cas_df1_32x64_q31(
+  const arm_bench_config * cfg)
+{
+  arm_biquad_cas_df1_32x64_q31(&df1Q31x64, benchSrcA_q31, benchDst_q31, cfg->blockSize);
+}
+
+static void bench_arm_biquad_cas_df1_ef_q31(
+  const arm_bench_config * cfg)
+{
+  arm_biquad_cas_df1_ef_q31(&df1EfQ31, benchSrcA_q31, benchDst_q31, cfg->blockSize);
+}
+
+static void bench_arm_biquad_cas_df1_ef_q15(
+  const arm_bench_config * cfg)
+{
+  arm_biquad_cas_df1_ef_q15(&df1EfQ15, benchSrcA_q15, benchDst_q15, cfg->blockSize);
+}
+
+static void bench_arm_biquad_cascade_df2T_f32(
+  const arm_bench_config * cfg)
+{
+  arm_biquad_cascade_df2T_f32(&df2TF32, benchSrcA_f32, benchDst_f32, cfg->blockSize);
+}
+
+static void bench_arm_biquad_cascade_df2T_q31(
+  const arm_bench_config * cfg)
+{
+  arm_biquad_cascade_df2T_q31(&df2TQ31, benchSrcA_q31, benchDst_q31, cfg->blockSize);
+}
+
+static void bench_arm_biquad_cascade_df2T_q15(
+  const arm_bench_config * cfg)
+{
+  arm_biquad_cascade_df2T_q15(&df2TQ15, benchSrcA_q15, benchDst_q15, cfg->blockSize);
+}
+
+/* The block holds blockSize / 2 interleaved stereo pairs */
+static void bench_arm_biquad_cascade_stereo_df2T_f32(
+  const arm_bench_config * cfg)
+{
+  arm_biquad_cascade_stereo_df2T_f32(&df2TStereoF32, benchSrcA_f32, benchDst_f32,
+                                     cfg->blockSize >> 1u);
+}
+
+/* Sample-by-sample Biquad cascades on the instances of setup_biquad() */
+
+static void bench_arm_biquad_cascade_df1_sample_f32(
+  const arm_bench_config * cfg)
+{
+  uint32_t n;
+
+  for (n = 0u; n < cfg->blockSize; n++)
+  {
+    benchDst_f32[n] = arm_biquad_cascade_df1_sample_f32(&df1F32, benchSrcA_f32[n]);
+  }
+}
+
+static void bench_arm_biquad_cascade_df1_sample_q31(
+  const arm_bench_config * cfg)
+{
+  uint32_t n;
+
+  for (n = 0u; n < cfg->blockSize; n++)
+  {
+    benchDst_q31[n] = arm_biquad_cascade_df1_sample_q31(&df1Q31, benchSrcA_q31[n]);
+  }
+}
+
+static void bench_arm_biquad_cascade_df1_sample_q15(
+  const arm_bench_config * cfg)
+{
+  uint32_t n;
+
+  for (n = 0u; n < cfg->blockSize; n++)
+  {
+    benchDst_q15[n] = arm_biquad_cascade_df1_sample_q15(&df1Q15, benchSrcA_q15[n]);
+  }
+}
+
+static void bench_arm_biquad_cascade_df2T_sample_f32(
+  const arm_bench_config * cfg)
+{
+  uint32_t n;
+
+  for (n = 0u; n < cfg->blockSize; n++)
+  {
+    benchDst_f32[n] = arm_biquad_cascade_df2T_sample_f32(&df2TF32, benchSrcA_f32[n]);
+  }
+}
+
+/* Multichannel Biquad cascades with the coefficients of setup_biquad() */
+
+static uint32_t setup_biquad_multi(
+  const arm_bench_config * cfg)
+{
+  uint32_t frames = cfg->blockSize / BENCH_CHANNELS;
+
+  setup_biquad(cfg);
+
+  arm_biquad_cascade_df1_multi_init_f32(&df1MultiF32, ARM_BENCH_NUM_STAGES, BENCH_CHANNELS,
+                                        ARM_MULTI_INTERLEAVED, benchCoeff_f32,
+                                        benchState_f32);
+  arm_biquad_cascade_df1_multi_init_q31(&df1MultiQ31, ARM_BENCH_NUM_STAGES, BENCH_CHANNELS,
+                                        ARM_MULTI_INTERLEAVED, benchCoeff_q31,
+                                        benchState_q31, 1);
+  arm_biquad_cascade_df1_multi_init_q15(&df1MultiQ15, ARM_BENCH_NUM_STAGES, BENCH_CHANNELS,
+                                        ARM_MULTI_INTERLEAVED, benchCoeff_q15,
+                                        benchState_q15, 1);
+
+  return (frames * BENCH_CHANNELS);
+}
+
+static void bench_arm_biquad_cascade_df1_multi_f32(
+  const arm_bench_config * cfg)
+{
+  arm_biquad_cascade_df1_multi_f32(&df1MultiF32, benchSrcA_f32, benchDst_f32,
+                                   cfg->blockSize / BENCH_CHANNELS);
+}
+
+static void bench_arm_biquad_cascade_df1_multi_q31(
+  const arm_bench_config * cfg)
+{
+  arm_biquad_cascade_df1_multi_q31(&df1MultiQ31, benchSrcA_q31, benchDst_q31,
+                                   cfg->blockSize / BENCH_CHANNELS);
+}
+
+static void bench_arm_biquad_cascade_df1_multi_q15(
+  const arm_bench_config * cfg)
+{
+  arm_biquad_cascade_df1_multi_q15(&df1MultiQ15, benchSrcA_q15, benchDst_q15,
+                                   cfg->blockSize / BENCH_CHANNELS);
+}
+
+const arm_bench_kernel armBenchFiltering[] = {
+  ARM_BENCH_ENTRY(arm_fir_f32, "Filtering", f32, ARM_BENCH_TAPS, setup_fir),
+  ARM_BENCH_ENTRY(arm_fir_q31, "Filtering", q31, ARM_BENCH_TAPS, setup_fir),
+  ARM_BENCH_ENTRY(arm_fir_fast_q31, "Filtering", q31, ARM_BENCH_TAPS, setup_fir),
+  ARM_BENCH_ENTRY(arm_fir_q15, "Filtering", q15, ARM_BENCH_TAPS, setup_fir_q15),
+  ARM_BENCH_ENTRY(arm_fir_fast_q15, "Filtering", q15, ARM_BENCH_TAPS, setup_fir_q15),
+  ARM_BENCH_ENTRY(arm_fir_q7, "Filtering", q7, ARM_BENCH_TAPS, setup_fir),
+  ARM_BENCH_ENTRY(arm_fir_sample_f32, "Filtering", f32, ARM_BENCH_TAPS, setup_fir),
+  ARM_BENCH_ENTRY(arm_fir_sample_q31, "Filtering", q31, ARM_BENCH_TAPS, setup_fir),
+  ARM_BENCH_ENTRY(arm_fir_sample_q15, "Filtering", q15, ARM_BENCH_TAPS, setup_fir_q15),
+  ARM_BENCH_ENTRY(arm_fir_circ_f32, "Filtering", f32, ARM_BENCH_TAPS, setup_fir_circ),
+  ARM_BENCH_ENTRY(arm_fir_circ_q31, "Filtering", q31, ARM_BENCH_TAPS, setup_fir_circ),
+  ARM_BENCH_ENTRY(arm_fir_circ_q15, "Filtering", q15, ARM_BENCH_TAPS, setup_fir_circ),
+  ARM_BENCH_ENTRY(arm_fir_multi_f32, "Filtering", f32, ARM_BENCH_TAPS, setup_fir_multi),
+  ARM_BENCH_ENTRY(arm_fir_multi_q31, "Filtering", q31, ARM_BENCH_TAPS, setup_fir_multi),
+  ARM_BENCH_ENTRY(arm_fir_multi_q15, "Filtering", q15, ARM_BENCH_TAPS, setup_fir_multi),
+  ARM_BENCH_ENTRY(arm_fir_sym_f32, "Filtering", f32, ARM_BENCH_TAPS, setup_fir_sym),
+  ARM_BENCH_ENTRY(arm_fir_sym_q31, "Filtering", q31, ARM_BENCH_TAPS, setup_fir_sym),
+  ARM_BENCH_ENTRY(arm_fir_sym_q15, "Filtering", q15, ARM_BENCH_TAPS, setup_fir_sym),
+  ARM_BENCH_ENTRY(arm_fir_decimate_f32, "Filtering", f32, ARM_BENCH_TAPS, setup_decimate),
+  ARM_BENCH_ENTRY(arm_fir_decimate_q31, "Filtering", q31, ARM_BENCH_TAPS, setup_decimate),
+  ARM_BENCH_ENTRY(arm_fir_decimate_fast_q31, "Filtering", q31, ARM_BENCH_TAPS,
+                  setup_decimate),
+  ARM_BENCH_ENTRY(arm_fir_decimate_q15, "Filtering", q15, ARM_BENCH_TAPS, setup_decimate),
+  ARM_BENCH_ENTRY(arm_fir_decimate_fast_q15, "Filtering", q15, ARM_BENCH_TAPS,
+                  setup_decimate),
+  ARM_BENCH_ENTRY(arm_fir_interpolate_f32, "Filtering", f32, ARM_BENCH_TAPS,
+                  setup_interpolate),
+  ARM_BENCH_ENTRY(arm_fir_interpolate_q31, "Filtering", q31, ARM_BENCH_TAPS,
+                  setup_interpolate),
+  ARM_BENCH_ENTRY(arm_fir_interpolate_q15, "Filtering", q15, ARM_BENCH_TAPS,
+                  setup_interpolate),
+  ARM_BENCH_ENTRY(arm_fir_halfband_decimate_f32, "Filtering", f32, ARM_BENCH_TAPS,
+                  setup_halfband),
+  ARM_BENCH_ENTRY(arm_fir_halfband_decimate_q31, "Filtering", q31, ARM_BENCH_TAPS,
+                  setup_halfband),
+  ARM_BENCH_ENTRY(arm_fir_halfband_decimate_q15, "Filtering", q15, ARM_BENCH_TAPS,
+                  setup_halfband),
+  ARM_BENCH_ENTRY(arm_fir_halfband_interpolate_f32, "Filtering", f32, ARM_BENCH_TAPS,
+                  setup_halfband),
+  ARM_BENCH_ENTRY(arm_fir_halfband_interpolate_q31, "Filtering", q31, ARM_BENCH_TAPS,
+                  setup_halfband),
+  ARM_BENCH_ENTRY(arm_fir_halfband_interpolate_q15, "Filtering", q15, ARM_BENCH_TAPS,
+                  setup_halfband),
+  ARM_BENCH_ENTRY(arm_fir_multistage_f32, "Filtering", f32, 0u, setup_multistage),
+  ARM_BENCH_ENTRY(arm_fir_lattice_f32, "Filtering", f32, ARM_BENCH_TAPS, setup_lattice),
+  ARM_BENCH_ENTRY(arm_fir_lattice_q31, "Filtering", q31, ARM_BENCH_TAPS, setup_lattice),
+  ARM_BENCH_ENTRY(arm_fir_lattice_q15, "Filtering", q15, ARM_BENCH_TAPS, setup_lattice),
+  ARM_BENCH_ENTRY(arm_iir_lattice_f32, "Filtering", f32, ARM_BENCH_TAPS, setup_lattice),
+  ARM_BENCH_ENTRY(arm_iir_lattice_q31, "Filtering", q31, ARM_BENCH_TAPS, setup_lattice),
+  ARM_BENCH_ENTRY(arm_iir_lattice_q15, "Filtering", q15, ARM_BENCH_TAPS, setup_lattice),
+  ARM_BENCH_ENTRY(arm_lms_f32, "Filtering", f32, ARM_BENCH_TAPS, setup_lms),
+  ARM_BENCH_ENTRY(arm_lms_q31, "Filtering", q31, ARM_BENCH_TAPS, setup_lms),
+  ARM_BENCH_ENTRY(arm_lms_q15, "Filtering", q15, ARM_BENCH_TAPS, setup_lms),
+  ARM_BENCH_ENTRY(arm_lms_norm_f32, "Filtering", f32, ARM_BENCH_TAPS, setup_lms),
+  ARM_BENCH_ENTRY(arm_lms_norm_q31, "Filtering", q31, ARM_BENCH_TAPS, setup_lms),
+  ARM_BENCH_ENTRY(arm_lms_norm_q15, "Filtering", q15, ARM_BENCH_TAPS, setup_lms),
+  ARM_BENCH_ENTRY(arm_fir_sparse_f32, "Filtering", f32, ARM_BENCH_TAPS, setup_sparse),
+  ARM_BENCH_ENTRY(arm_fir_sparse_q31, "Filtering", q31, ARM_BENCH_TAPS, setup_sparse),
+  ARM_BENCH_ENTRY(arm_fir_sparse_q15, "Filtering", q15, ARM_BENCH_TAPS, setup_sparse),
+  ARM_BENCH_ENTRY(arm_fir_sparse_q7, "Filtering", q7, ARM_BENCH_TAPS, setup_sparse),
+  ARM_BENCH_ENTRY(arm_conv_f32, "Filtering", f32, ARM_BENCH_TAPS, 0),
+  ARM_BENCH_ENTRY(arm_conv_q31, "Filtering", q31, ARM_BENCH_TAPS, 0),
+  ARM_BENCH_ENTRY(arm_conv_fast_q31, "Filtering", q31, ARM_BENCH_TAPS, 0),
+  ARM_BENCH_ENTRY(arm_conv_q15, "Filtering", q15, ARM_BENCH_TAPS, 0),
+  ARM_BENCH_ENTRY(arm_conv_fast_q15, "Filtering", q15, ARM_BENCH_TAPS, 0),
+  ARM_BENCH_ENTRY(arm_conv_q7, "Filtering", q7, ARM_BENCH_TAPS, 0),
+  ARM_BENCH_ENTRY(arm_correlate_f32, "Filtering", f32, ARM_BENCH_TAPS, 0),
+  ARM_BENCH_ENTRY(arm_correlate_q31, "Filtering", q31, ARM_BENCH_TAPS, 0),
+  ARM_BENCH_ENTRY(arm_correlate_fast_q31, "Filtering", q31, ARM_BENCH_TAPS, 0),
+  ARM_BENCH_ENTRY(arm_correlate_q15, "Filtering", q15, ARM_BENCH_TAPS, 0),
+  ARM_BENCH_ENTRY(arm_correlate_fast_q15, "Filtering", q15, ARM_BENCH_TAPS, 0),
+  ARM_BENCH_ENTRY(arm_correlate_q7, "Filtering", q7, ARM_BENCH_TAPS, 0),
+  ARM_BENCH_ENTRY(arm_conv_fft_f32, "Filtering", f32, ARM_BENCH_TAPS, 0),
+  ARM_BENCH_ENTRY(arm_conv_fft_q15, "Filtering", q15, ARM_BENCH_TAPS, 0),
+  ARM_BENCH_ENTRY(arm_correlate_fft_f32, "Filtering", f32, ARM_BENCH_TAPS, 0),
+  ARM_BENCH_ENTRY(arm_correlate_fft_q15, "Filtering", q15, ARM_BENCH_TAPS, 0),
+  ARM_BENCH_ENTRY(arm_biquad_cascade_df1_f32, "Filtering", f32, 0u, setup_biquad),
+  ARM_BENCH_ENTRY(arm_biquad_cascade_df1_q31, "Filtering", q31, 0u, setup_biquad),
+  ARM_BENCH_ENTRY(arm_biquad_cascade_df1_fast_q31, "Filtering", q31, 0u, setup_biquad),
+  ARM_BENCH_ENTRY(arm_biquad_cascade_df1_q15, "Filtering", q15, 0u, setup_biquad),
+  ARM_BENCH_ENTRY(arm_biquad_cascade_df1_fast_q15, "Filtering", q15, 0u, setup_biquad),
+  ARM_BENCH_ENTRY(arm_biquad_cas_df1_32x64_q31, "Filtering", q31, 0u, setup_biquad),
+  ARM_BENCH_ENTRY(arm_biquad_cas_df1_ef_q31, "Filtering", q31, 0u, setup_biquad),
+  ARM_BENCH_ENTRY(arm_biquad_cas_df1_ef_q15, "Filtering", q15, 0u, setup_biquad),
+  ARM_BENCH_ENTRY(arm_biquad_cascade_df2T_f32, "Filtering", f32, 0u, setup_biquad),
+  ARM_BENCH_ENTRY(arm_biquad_cascade_df2T_q31, "Filtering", q31, 0u, setup_biquad),
+  ARM_BENCH_ENTRY(arm_biquad_cascade_df2T_q15, "Filtering", q15, 0u, setup_biquad),
+  ARM_BENCH_ENTRY(arm_biquad_cascade_stereo_df2T_f32, "Filtering", f32, 0u, setup_biquad),
+  ARM_BENCH_ENTRY(arm_biquad_cascade_df1_sample_f32, "Filtering", f32, 0u, setup_biquad),
+  ARM_BENCH_ENTRY(arm_biquad_cascade_df1_sample_q31, "Filtering", q31, 0u, setup_biquad),
+  ARM_BENCH_ENTRY(arm_biquad_cascade_df1_sample_q15, "Filtering", q15, 0u, setup_biquad),
+  ARM_BENCH_ENTRY(arm_biquad_cascade_df2T_sample_f32, "Filtering", f32, 0u, setup_biquad),
+  ARM_BENCH_ENTRY(arm_biquad_cascade_df1_multi_f32, "Filtering", f32, 0u, setup_biquad_multi),
+  ARM_BENCH_ENTRY(arm_biquad_cascade_df1_multi_q31, "Filtering", q31, 0u, setup_biquad_multi),
+  ARM_BENCH_ENTRY(arm_biquad_cascade_df1_multi_q15, "Filtering", q15, 0u, setup_biquad_multi),
+};
+
+const uint32_t armBenchFilteringCount =
+  sizeof(armBenchFiltering) / sizeof(armBenchFiltering[0]);
@@ -0,0 +1,611 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* Project: 	    CMSIS DSP Library
+* Title:		arm_bench_main.c
+*
+* Description:	Micro-benchmark driver for the DSP library kernels.
+*
+* Target Processor: Host (ARM_MATH_HOST) / Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+/**
+ * @defgroup groupBenchmark Benchmark
+ *
+ * \par Description:
+ * \par
+ * Runs every public kernel of the library for each data type over a sweep
+ * of block sizes and, for the filters, tap counts.  For every point the
+ * call is repeated until one measurement lasts at least <code>--min-time</code>
+ * milliseconds; the fastest of <code>--repeat</code> measurements is reported
+ * as ns/sample, million samples/s and, where the host has a cycle counter
+ * (x86 time stamp counter), cycles/sample.
+ *
+ * \par Usage:
+ * <pre>
+ *   arm_bench [--format text|csv|json] [--filter STRING] [--kernel NAME]
+ *             [--blocks N,N,...] [--taps N,N,...] [--min-time MS] [--repeat N]
+ *             [--iters N] [--compare BASELINE.csv] [--threshold PERCENT] [--list]
+ * </pre>
+ * <code>--filter</code> keeps kernels whose name or group contains STRING;
+ * <code>--kernel</code> keeps only the kernel called NAME.
+ * <code>--list</code> prints the kernel names, groups, types and whether
+ * they are swept over the tap counts.
+ * <code>--iters</code> runs a fixed number of calls per point instead of
+ * calibrating against the clock.
+ * <code>--compare</code> reads a CSV written by an earlier run, adds the
+ * change against it to every result and marks results more than
+ * <code>--threshold</code> percent (default 10) slower as REGRESSION; the
+ * program then exits with status 1.
+ *
+ * \par
+ * Kernels that only accept certain sizes (FFT lengths, even Q15 FIR tap
+ * counts, decimation factors) skip the unsupported points.  Matrix kernels
+ * run on N x N operands with N = floor(sqrt(blockSize)) and report per
+ * output element; the solvers include the decomposition of the matrix, as
+ * arm_mat_inverse_f32 includes the inversion.  MatrixFlops kernels run N x N operands with N = blockSize,
+ * up to 1024, and report per floating-point operation (2 N^3 per call), so
+ * Msamples/s reads as MFLOP/s, e.g.
+ * <code>--filter MatrixFlops --blocks 4,8,16,32,64,128,256,512,1024</code>.
+ * Transform timings include copying the input into the in-place work buffer.
+ * The dithered conversions run once per rounding mode, with the mode
+ * appended to the name.
+ *
+ * \par
+ * Build with <code>arm_bench_Build.sh</code>.  <code>arm_bench_qemu.sh</code>
+ * builds the same program with ARM_MATH_CM4 for Thumb-2 and reports
+ * instruction and memory access counts per sample under qemu-arm, for
+ * tracking the cost of the Cortex-M4 code paths without a board.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "arm_bench.h"
+
+#if defined (__x86_64__) || defined (__i386__)
+#include <x86intrin.h>
+#define ARM_BENCH_HAVE_CYCLES
+#endif
+
+#define BENCH_MAX_SWEEP         16u
+#define BENCH_MAX_BASELINE      4096u
+#define BENCH_NAME_LEN          48u
+
+enum
+{
+  BENCH_TEXT = 0,
+  BENCH_CSV,
+  BENCH_JSON
+};
+
+typedef struct
+{
+  char name[BENCH_NAME_LEN];
+  uint32_t blockSize;
+  uint32_t numTaps;
+  double nsPerSample;
+} bench_baseline;
+
+typedef struct
+{
+  const arm_bench_kernel *table;
+  const uint32_t *count;
+} bench_group;
+
+/* ----------------------------------------------------------------------
+** Shared buffers
+** ------------------------------------------------------------------- */
+
+float32_t benchSrcA_f32[ARM_BENCH_BUF_LEN];
+float32_t benchSrcB_f32[ARM_BENCH_BUF_LEN];
+float32_t benchDst_f32[ARM_BENCH_BUF_LEN];
+float32_t benchCoeff_f32[ARM_BENCH_BUF_LEN];
+float32_t benchState_f32[ARM_BENCH_BUF_LEN];
+
+q31_t benchSrcA_q31[ARM_BENCH_BUF_LEN];
+q31_t benchSrcB_q31[ARM_BENCH_BUF_LEN];
+q31_t benchDst_q31[ARM_BENCH_BUF_LEN];
+q31_t benchCoeff_q31[ARM_BENCH_BUF_LEN];
+q31_t benchState_q31[ARM_BENCH_BUF_LEN];
+
+q15_t benchSrcA_q15[ARM_BENCH_BUF_LEN];
+q15_t benchSrcB_q15[ARM_BENCH_BUF_LEN];
+q15_t benchDst_q15[ARM_BENCH_BUF_LEN];
+q15_t benchCoeff_q15[ARM_BENCH_BUF_LEN];
+q15_t benchState_q15[ARM_BENCH_BUF_LEN];
+
+q7_t benchSrcA_q7[ARM_BENCH_BUF_LEN];
+q7_t benchSrcB_q7[ARM_BENCH_BUF_LEN];
+q7_t benchDst_q7[ARM_BENCH_BUF_LEN];
+q7_t benchCoeff_q7[ARM_BENCH_BUF_LEN];
+q7_t benchState_q7[ARM_BENCH_BUF_LEN];
+
+q31_t benchScratch_q31[ARM_BENCH_BUF_LEN];
+q63_t benchState_q63[ARM_BENCH_BUF_LEN];
+int32_t benchTapDelay[ARM_BENCH_MAX_TAPS + 1u];
+
+volatile q63_t benchSink;
+volatile float32_t benchSink_f32;
+
+static const bench_group benchGroups[] = {
+  {armBenchBasicMath, &armBenchBasicMathCount},
+  {armBenchFastMath, &armBenchFastMathCount},
+  {armBenchComplexMath, &armBenchComplexMathCount},
+  {armBenchFiltering, &armBenchFilteringCount},
+  {armBenchTransform, &armBenchTransformCount},
+  {armBenchMatrix, &armBenchMatrixCount},
+  {armBenchStatistics, &armBenchStatisticsCount},
+  {armBenchSupport, &armBenchSupportCount},
+  {armBenchController, &armBenchControllerCount},
+};
+
+static bench_baseline benchBaseline[BENCH_MAX_BASELINE];
+static uint32_t benchNumBaseline;
+
+/**
+ * @brief Fills inputs, coefficients and states.
+ * Inputs are a 1/16 cycle/sample sine plus uniform noise, about half
+ * scale; coefficients are noise at 1/64 scale so long filters neither
+ * saturate nor go unstable.  Called before every kernel so that in-place
+ * and adaptive kernels always start from the same data.
+ */
+
+void arm_bench_fill_inputs(
+  void)
+{
+  uint32_t seed = 0x12345678u;
+  uint32_t i;
+  float32_t a, b, c;
+
+  for (i = 0u; i < ARM_BENCH_BUF_LEN; i++)
+  {
+    seed = (seed * 1664525u) + 1013904223u;
+    a = (0.25f * sinf(0.3926991f * (float32_t) i)) +
+      (0.25f * ((float32_t) (int32_t) seed / 2147483648.0f));
+    seed = (seed * 1664525u) + 1013904223u;
+    b = 0.5f * ((float32_t) (int32_t) seed / 2147483648.0f);
+    seed = (seed * 1664525u) + 1013904223u;
+    c = 0.015625f * ((float32_t) (int32_t) seed / 2147483648.0f);
+
+    benchSrcA_f32[i] = a;
+    benchSrcB_f32[i] = b;
+    benchCoeff_f32[i] = c;
+  }
+
+  arm_float_to_q31(benchSrcA_f32, benchSrcA_q31, ARM_BENCH_BUF_LEN);
+  arm_float_to_q31(benchSrcB_f32, benchSrcB_q31, ARM_BENCH_BUF_LEN);
+  arm_float_to_q31(benchCoeff_f32, benchCoeff_q31, ARM_BENCH_BUF_LEN);
+  arm_float_to_q15(benchSrcA_f32, benchSrcA_q15, ARM_BENCH_BUF_LEN);
+  arm_float_to_q15(benchSrcB_f32, benchSrcB_q15, ARM_BENCH_BUF_LEN);
+  arm_float_to_q15(benchCoeff_f32, benchCoeff_q15, ARM_BENCH_BUF_LEN);
+  arm_float_to_q7(benchSrcA_f32, benchSrcA_q7, ARM_BENCH_BUF_LEN);
+  arm_float_to_q7(benchSrcB_f32, benchSrcB_q7, ARM_BENCH_BUF_LEN);
+
+  /* At Q7 resolution 1/64 noise is mostly zero; use 1/8 instead */
+  for (i = 0u; i < ARM_BENCH_BUF_LEN; i++)
+  {
+    benchCoeff_q7[i] = (q7_t) (benchCoeff_q15[i] >> 5);
+  }
+
+  memset(benchState_f32, 0, sizeof(benchState_f32));
+  memset(benchState_q31, 0, sizeof(benchState_q31));
+  memset(benchState_q15, 0, sizeof(benchState_q15));
+  memset(benchState_q7, 0, sizeof(benchState_q7));
+  memset(benchState_q63, 0, sizeof(benchState_q63));
+}
+
+/* ----------------------------------------------------------------------
+** Timing
+** ------------------------------------------------------------------- */
+
+static double bench_now_ns(
+  void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+
+  return ((double) ts.tv_sec * 1e9) + (double) ts.tv_nsec;
+}
+
+static uint64_t bench_cycles(
+  void)
+{
+#ifdef ARM_BENCH_HAVE_CYCLES
+  return (__rdtsc());
+#else
+  return (0u);
+#endif
+}
+
+/* ----------------------------------------------------------------------
+** Baseline comparison
+** ------------------------------------------------------------------- */
+
+static int bench_load_baseline(
+  const char *path)
+{
+  FILE *fp = fopen(path, "r");
+  char line[256];
+  bench_baseline *p;
+  char group[32], type[8];
+  uint32_t samples;
+  double nsPerCall;
+
+  if(fp == NULL)
+  {
+    fprintf(stderr, "arm_bench: cannot open baseline %s\n", path);
+    return (-1);
+  }
+
+  while((fgets(line, sizeof(line), fp) != NULL) &&
+        (benchNumBaseline < BENCH_MAX_BASELINE))
+  {
+    p = &benchBaseline[benchNumBaseline];
+
+    if(sscanf(line, "%47[^,],%31[^,],%7[^,],%u,%u,%u,%lf,%lf", p->name, group, type,
+              &p->blockSize, &p->numTaps, &samples, &nsPerCall, &p->nsPerSample) == 8)
+    {
+      benchNumBaseline++;
+    }
+  }
+
+  fclose(fp);
+
+  return (0);
+}
+
+static const bench_baseline *bench_find_baseline(
+  const char *name,
+  uint32_t blockSize,
+  uint32_t numTaps)
+{
+  uint32_t i;
+
+  for (i = 0u; i < benchNumBaseline; i++)
+  {
+    if((benchBaseline[i].blockSize == blockSize) && (benchBaseline[i].numTaps == numTaps)
+       && (strcmp(benchBaseline[i].name, name) == 0))
+    {
+      return (&benchBaseline[i]);
+    }
+  }
+
+  return (NULL);
+}
+
+/* ----------------------------------------------------------------------
+** Command line
+** ------------------------------------------------------------------- */
+
+static uint32_t bench_parse_list(
+  const char *arg,
+  uint32_t * pList)
+{
+  uint32_t n = 0u, value;
+  char *end;
+
+  while((*arg != '\0') && (n < BENCH_MAX_SWEEP))
+  {
+    value = (uint32_t) strtoul(arg, &end, 0);
+
+    if(end == arg)
+    {
+      break;
+    }
+
+    pList[n++] = value;
+    arg = (*end == ',') ? end + 1 : end;
+  }
+
+  return (n);
+}
+
+static void bench_usage(
+  void)
+{
+  fprintf(stderr,
+          "usage: arm_bench [--format text|csv|json] [--filter STRING] [--kernel NAME]\n"
+          "                 [--blocks N,N,...] [--taps N,N,...] [--min-time MS]\n"
+          "                 [--repeat N] [--iters N] [--compare BASELINE.csv]\n"
+          "                 [--threshold PERCENT] [--list]\n");
+}
+
+int main(
+  int argc,
+  char *argv[])
+{
+  uint32_t blocks[BENCH_MAX_SWEEP] = { 16u, 64u, 128u, 256u, 512u, 1024u };
+  uint32_t taps[BENCH_MAX_SWEEP] = { 8u, 32u, 128u };
+  uint32_t numBlocks = 6u, numTaps = 3u;
+  uint32_t format = BENCH_TEXT, repeat = 3u, fixedIters = 0u, list = 0u;
+  double minTimeNs = 5e6, threshold = 10.0;
+  const char *filter = NULL, *name = NULL, *baseline = NULL;
+  uint32_t regressions = 0u, first = 1u;
+  uint32_t g, k, b, t, r, i;
+  int a;
+
+  for (a = 1; a < argc; a++)
+  {
+    const char *opt = argv[a];
+    const char *val = (a + 1 < argc) ? argv[a + 1] : NULL;
+
+    if(strcmp(opt, "--list") == 0)
+    {
+      list = 1u;
+      continue;
+    }
+
+    if(val == NULL)
+    {
+      bench_usage();
+      return (2);
+    }
+
+    a++;
+
+    if(strcmp(opt, "--format") == 0)
+    {
+      format = (strcmp(val, "csv") == 0) ? BENCH_CSV :
+        (strcmp(val, "json") == 0) ? BENCH_JSON : BENCH_TEXT;
+    }
+    else if(strcmp(opt, "--filter") == 0)
+    {
+      filter = val;
+    }
+    else if(strcmp(opt, "--kernel") == 0)
+    {
+      name = val;
+    }
+    else if(strcmp(opt, "--blocks") == 0)
+    {
+      numBlocks = bench_parse_list(val, blocks);
+    }
+    else if(strcmp(opt, "--taps") == 0)
+    {
+      numTaps = bench_parse_list(val, taps);
+    }
+    else if(strcmp(opt, "--min-time") == 0)
+    {
+      minTimeNs = atof(val) * 1e6;
+    }
+    else if(strcmp(opt, "--repeat") == 0)
+    {
+      repeat = (uint32_t) strtoul(val, NULL, 0);
+      repeat = (repeat == 0u) ? 1u : repeat;
+    }
+    else if(strcmp(opt, "--iters") == 0)
+    {
+      fixedIters = (uint32_t) strtoul(val, NULL, 0);
+    }
+    else if(strcmp(opt, "--compare") == 0)
+    {
+      baseline = val;
+    }
+    else if(strcmp(opt, "--threshold") == 0)
+    {
+      threshold = atof(val);
+    }
+    else
+    {
+      bench_usage();
+      return (2);
+    }
+  }
+
+  if((baseline != NULL) && (bench_load_baseline(baseline) != 0))
+  {
+    return (2);
+  }
+
+  if(format == BENCH_CSV)
+  {
+    printf("kernel,group,type,block,taps,samples,ns_per_call,ns_per_sample,"
+           "msamples_per_s,cycles_per_sample%s\n",
+           (baseline != NULL) ? ",baseline_ns_per_sample,delta_pct,status" : "");
+  }
+  else if(format == BENCH_JSON)
+  {
+    printf("[\n");
+  }
+  else if(list == 0u)
+  {
+    printf("%-34s %-5s %6s %5s %12s %12s %10s%s\n", "kernel", "type", "block", "taps",
+           "ns/sample", "Msamples/s", "cyc/sample",
+           (baseline != NULL) ? "     delta" : "");
+  }
+
+  for (g = 0u; g < sizeof(benchGroups) / sizeof(benchGroups[0]); g++)
+  {
+    for (k = 0u; k < *benchGroups[g].count; k++)
+    {
+      const arm_bench_kernel *kernel = &benchGroups[g].table[k];
+      uint32_t tapSweep = ((kernel->flags & ARM_BENCH_TAPS) != 0u) ? numTaps : 1u;
+
+      if((filter != NULL) && (strstr(kernel->name, filter) == NULL) &&
+         (strstr(kernel->group, filter) == NULL))
+      {
+        continue;
+      }
+
+      if((name != NULL) && (strcmp(kernel->name, name) != 0))
+      {
+        continue;
+      }
+
+      if(list != 0u)
+      {
+        printf("%-34s %-12s %-4s %s\n", kernel->name, kernel->group, kernel->type,
+               ((kernel->flags & ARM_BENCH_TAPS) != 0u) ? "taps" : "-");
+        continue;
+      }
+
+      for (b = 0u; b < numBlocks; b++)
+      {
+        for (t = 0u; t < tapSweep; t++)
+        {
+          arm_bench_config cfg;
+          const bench_baseline *base = NULL;
+          uint32_t samples, iters;
+          double best = 0.0, bestCycles = 0.0, start, elapsed, nsPerSample;
+          double cycPerSample, delta = 0.0;
+          uint64_t c0;
+
+          cfg.blockSize = blocks[b];
+          cfg.numTaps = ((kernel->flags & ARM_BENCH_TAPS) != 0u) ? taps[t] : 0u;
+
+          if((cfg.blockSize == 0u) || (cfg.blockSize > ARM_BENCH_MAX_BLOCK) ||
+             (cfg.numTaps > ARM_BENCH_MAX_TAPS) ||
+             (((kernel->flags & ARM_BENCH_TAPS) != 0u) && (cfg.numTaps == 0u)))
+          {
+            continue;
+          }
+
+          arm_bench_fill_inputs();
+          samples = (kernel->setup != NULL) ? kernel->setup(&cfg) : cfg.blockSize;
+
+          if(samples == 0u)
+          {
+            continue;
+          }
+
+          /* Double the call count until one measurement is long enough */
+          iters = (fixedIters != 0u) ? fixedIters : 1u;
+
+          while(fixedIters == 0u)
+          {
+            start = bench_now_ns();
+            for (i = 0u; i < iters; i++)
+            {
+              kernel->run(&cfg);
+            }
+            elapsed = bench_now_ns() - start;
+
+            if((elapsed >= minTimeNs) || (iters >= 0x40000000u))
+            {
+              break;
+            }
+
+            iters = (elapsed < (minTimeNs / 64.0)) ? (iters * 16u) : (iters * 2u);
+          }
+
+          for (r = 0u; r < repeat; r++)
+          {
+            start = bench_now_ns();
+            c0 = bench_cycles();
+            for (i = 0u; i < iters; i++)
+            {
+              kernel->run(&cfg);
+            }
+            cycPerSample = (double) (bench_cycles() - c0);
+            elapsed = bench_now_ns() - start;
+
+            if((r == 0u) || (elapsed < best))
+            {
+              best = elapsed;
+              bestCycles = cycPerSample;
+            }
+          }
+
+          best /= (double) iters;
+          nsPerSample = best / (double) samples;
+          cycPerSample = bestCycles / ((double) iters * samples);
+
+          if(baseline != NULL)
+          {
+            base = bench_find_baseline(kernel->name, cfg.blockSize, cfg.numTaps);
+
+            if(base != NULL)
+            {
+              delta = ((nsPerSample / base->nsPerSample) - 1.0) * 100.0;
+
+              if(delta > threshold)
+              {
+                regressions++;
+              }
+            }
+          }
+
+          if(format == BENCH_CSV)
+          {
+            printf("%s,%s,%s,%u,%u,%u,%.3f,%.4f,%.3f,", kernel->name, kernel->group,
+                   kernel->type, cfg.blockSize, cfg.numTaps, samples, best, nsPerSample,
+                   1e3 / nsPerSample);
+#ifdef ARM_BENCH_HAVE_CYCLES
+            printf("%.3f", cycPerSample);
+#endif
+            if(baseline != NULL)
+            {
+              if(base != NULL)
+              {
+                printf(",%.4f,%.2f,%s", base->nsPerSample, delta,
+                       (delta > threshold) ? "REGRESSION" : "ok");
+              }
+              else
+              {
+                printf(",,,new");
+              }
+            }
+            printf("\n");
+          }
+          else if(format == BENCH_JSON)
+          {
+            printf("%s  {\"kernel\": \"%s\", \"group\": \"%s\", \"type\": \"%s\", "
+                   "\"block\": %u, \"taps\": %u, \"samples\": %u, "
+                   "\"ns_per_call\": %.3f, \"ns_per_sample\": %.4f, "
+                   "\"msamples_per_s\": %.3f, \"cycles_per_sample\": ",
+                   (first != 0u) ? "" : ",\n", kernel->name, kernel->group,
+                   kernel->type, cfg.blockSize, cfg.numTaps, samples, best,
+                   nsPerSample, 1e3 / nsPerSample);
+#ifdef ARM_BENCH_HAVE_CYCLES
+            printf("%.3f", cycPerSample);
+#else
+            printf("null");
+#endif
+            if(base != NULL)
+            {
+              printf(", \"baseline_ns_per_sample\": %.4f, \"delta_pct\": %.2f, "
+                     "\"regression\": %s", base->nsPerSample, delta,
+                     (delta > threshold) ? "true" : "false");
+            }
+            printf("}");
+          }
+          else
+          {
+            printf("%-34s %-5s %6u %5u %12.4f %12.3f ", kernel->name, kernel->type,
+                   cfg.blockSize, cfg.numTaps, nsPerSample, 1e3 / nsPerSample);
+#ifdef ARM_BENCH_HAVE_CYCLES
+            printf("%10.3f", cycPerSample);
+#else
+            printf("%10s", "-");
+#endif
+            if(base != NULL)
+            {
+              printf(" %+8.1f%%%s", delta, (delta > threshold) ? "  REGRESSION" : "");
+            }
+            printf("\n");
+          }
+
+          first = 0u;
+          fflush(stdout);
+        }
+      }
+    }
+  }
+
+  if(format == BENCH_JSON)
+  {
+    printf("\n]\n");
+  }
+
+  if(regressions != 0u)
+  {
+    fprintf(stderr, "arm_bench: %u result(s) more than %.1f%% slower than %s\n",
+            regressions, threshold, baseline);
+    return (1);
+  }
+
+  return (0);
+}
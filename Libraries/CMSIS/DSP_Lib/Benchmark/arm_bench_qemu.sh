@@ -0,0 +1,132 @@
+#!/bin/sh
+# Counts instructions and memory accesses per sample of every benchmark
+# kernel built with ARM_MATH_CM4 for Thumb-2 and run under the qemu-arm
+# user mode emulator with the libinsn and libmem TCG plugins.
+#
+#   ./arm_bench_qemu.sh [--filter STRING] [--blocks N,N,...] [--taps N,N,...]
+#                       [--compare BASELINE.csv] [--threshold PERCENT] > counts.csv
+#
+# Environment:
+#   CROSS     cross compiler prefix                 (arm-linux-gnueabihf-)
+#   QEMU      user mode emulator                    (qemu-arm)
+#   PLUGINS   directory holding libinsn.so/libmem.so (/usr/lib/qemu/plugins)
+#   ITERS     calls per measurement                 (8)
+#   OUT       emulated executable                   (arm_bench_m4)
+#   BUILD     set to 0 to reuse an existing OUT
+#
+# Cortex-M4 code cannot be linked against a Linux C library, so the kernels
+# are compiled for the ARMv7-A Thumb-2 subset with the same DSP extension
+# (SMLAD, QADD16, SSAT, ...) and VFPv4, tuned for the M4.  The ARM_MATH_CM4
+# paths are the ones measured; the counts track M4 cost closely enough to
+# catch regressions in the SIMD code, not to predict cycles.
+#
+# Each point runs twice, with 1 and 1 + ITERS calls per measurement.  The
+# difference divided by ITERS and the sample count leaves the per-sample
+# cost of the kernel alone, without start-up, input fill and setup.
+#
+# With --compare, points whose instruction count per sample grew by more
+# than --threshold percent (default 1) against the baseline CSV are marked
+# REGRESSION and the script exits with status 1.
+
+CROSS=${CROSS:-arm-linux-gnueabihf-}
+QEMU=${QEMU:-qemu-arm}
+PLUGINS=${PLUGINS:-/usr/lib/qemu/plugins}
+ITERS=${ITERS:-8}
+OUT=${OUT:-arm_bench_m4}
+BUILD=${BUILD:-1}
+DIR=$(dirname "$0")
+
+FILTER=
+BLOCKS=16,64,256,1024
+TAPS=8,32,128
+BASELINE=
+THRESHOLD=1
+
+while [ $# -gt 0 ]; do
+  case "$1" in
+    --filter)    FILTER=$2; shift 2 ;;
+    --blocks)    BLOCKS=$2; shift 2 ;;
+    --taps)      TAPS=$2; shift 2 ;;
+    --compare)   BASELINE=$2; shift 2 ;;
+    --threshold) THRESHOLD=$2; shift 2 ;;
+    *)
+      echo "usage: arm_bench_qemu.sh [--filter STRING] [--blocks N,N,...] [--taps N,N,...]" >&2
+      echo "                         [--compare BASELINE.csv] [--threshold PERCENT]" >&2
+      exit 2 ;;
+  esac
+done
+
+if [ "$BUILD" != 0 ]; then
+  "${CROSS}gcc" -O2 -static -mthumb -march=armv7-a -mtune=cortex-m4 \
+      -mfpu=vfpv4-d16 -mfloat-abi=hard \
+      -DARM_MATH_CM4 -D__FPU_PRESENT=1 \
+      -I"$DIR/../../Include" \
+      -o "$OUT" \
+      "$DIR"/arm_bench_*.c "$DIR"/../Source/*Functions/*.c "$DIR"/../Source/CommonTables/*.c \
+      -lm || exit 2
+fi
+
+TMP=$(mktemp -d) || exit 2
+trap 'rm -rf "$TMP"' EXIT
+
+# count CALLS KERNEL BLOCK TAPS: prints "samples insns memAccesses"
+count() {
+  "$QEMU" -plugin "$PLUGINS/libinsn.so,inline=on" -plugin "$PLUGINS/libmem.so" \
+      -d plugin -D "$TMP/log" \
+      "$OUT" --kernel "$2" --blocks "$3" --taps "$4" --iters "$1" --repeat 1 \
+      --format csv > "$TMP/csv" || return 1
+
+  awk -F, 'NR == 2 { print $6 }' "$TMP/csv" | tr -d '\n'
+  awk '/insns:/ { i = $NF } /mem accesses:/ { m = $NF } END { print " " i " " m }' "$TMP/log"
+}
+
+printf 'kernel,group,type,block,taps,samples,insns_per_sample,mem_per_sample'
+[ -n "$BASELINE" ] && printf ',baseline_insns_per_sample,delta_pct,status'
+printf '\n'
+
+: > "$TMP/regressions"
+
+"$QEMU" "$OUT" --list | while read -r kernel group type sweep; do
+  case "$kernel$group" in
+    *"$FILTER"*) ;;
+    *) continue ;;
+  esac
+
+  if [ "$sweep" = taps ]; then tapList=$TAPS; else tapList=0; fi
+
+  for block in $(echo "$BLOCKS" | tr ',' ' '); do
+    for taps in $(echo "$tapList" | tr ',' ' '); do
+      set -- $(count 1 "$kernel" "$block" "$taps")
+      [ $# -eq 3 ] || continue
+      samples=$1 insns1=$2 mem1=$3
+      set -- $(count $((ITERS + 1)) "$kernel" "$block" "$taps")
+      [ $# -eq 3 ] || continue
+
+      line=$(awk -v n="$ITERS" -v s="$samples" -v i1="$insns1" -v i2="$2" \
+                 -v m1="$mem1" -v m2="$3" \
+                 'BEGIN { printf "%.3f,%.3f", (i2 - i1) / (n * s), (m2 - m1) / (n * s) }')
+      row="$kernel,$group,$type,$block,$taps,$samples,$line"
+
+      if [ -n "$BASELINE" ]; then
+        base=$(awk -F, -v k="$kernel" -v b="$block" -v t="$taps" \
+                   '$1 == k && $4 == b && $5 == t { print $7; exit }' "$BASELINE")
+        if [ -n "$base" ]; then
+          row=$(echo "$row" | awk -F, -v base="$base" -v th="$THRESHOLD" \
+                    '{ d = (base > 0) ? ($7 / base - 1) * 100 : 0;
+                       printf "%s,%s,%.2f,%s", $0, base, d, (d > th) ? "REGRESSION" : "ok" }')
+          case "$row" in *REGRESSION) echo "$kernel $block $taps" >> "$TMP/regressions" ;; esac
+        else
+          row="$row,,,new"
+        fi
+      fi
+
+      echo "$row"
+    done
+  done
+done
+
+if [ -s "$TMP/regressions" ]; then
+  echo "arm_bench_qemu: $(wc -l < "$TMP/regressions") point(s) more than $THRESHOLD% more instructions than $BASELINE" >&2
+  exit 1
+fi
+exit 0
@@ -0,0 +1,326 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* Project: 	    CMSIS DSP Library
+* Title:		arm_bench_stats.c
+*
+* Description:	Benchmark table for the statistics and support functions.
+*
+* Target Processor: Host (ARM_MATH_HOST) / Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_bench.h"
+
+#define BENCH_STAT(fn, T, R) \
+  static void bench_##fn(const arm_bench_config * cfg) \
+  { R r; fn(benchSrcA_##T, cfg->blockSize, &r); benchSink = (q63_t) r; }
+
+#define BENCH_MINMAX(fn, T, R) \
+  static void bench_##fn(const arm_bench_config * cfg) \
+  { R r; uint32_t idx; fn(benchSrcA_##T, cfg->blockSize, &r, &idx); benchSink = idx; }
+
+#define BENCH_FUSED(fn, T) \
+  static void bench_##fn(const arm_bench_config * cfg) \
+  { arm_stats_result_##T r; fn(benchSrcA_##T, cfg->blockSize, &r); benchSink = r.maxIndex; }
+
+#define BENCH_ACC(T) \
+  static void bench_arm_stats_acc_##T(const arm_bench_config * cfg) \
+  { arm_stats_acc_instance_##T S; arm_stats_result_##T r; arm_stats_acc_init_##T(&S); \
+    arm_stats_acc_##T(&S, benchSrcA_##T, cfg->blockSize); arm_stats_acc_get_##T(&S, &r); benchSink = r.maxIndex; }
+
+#define BENCH_RMS_EXP(T, R, C) \
+  static void bench_arm_rms_exp_##T(const arm_bench_config * cfg) \
+  { arm_rms_exp_instance_##T S; R r; arm_rms_exp_init_##T(&S, C); \
+    arm_rms_exp_##T(&S, benchSrcA_##T, cfg->blockSize, &r); benchSink = (q63_t) r; }
+
+#define BENCH_HISTOGRAM(T) \
+  static void bench_arm_histogram_##T(const arm_bench_config * cfg) \
+  { arm_histogram_instance_##T S; arm_histogram_init_##T(&S, 256u, benchCounts); \
+    arm_histogram_##T(&S, benchSrcA_##T, cfg->blockSize); benchSink = benchCounts[128]; }
+
+#define BENCH_CONVERT(fn, S, D) \
+  static void bench_##fn(const arm_bench_config * cfg) \
+  { fn(benchSrcA_##S, benchDst_##D, cfg->blockSize); }
+
+/* ----------------------------------------------------------------------
+** Statistics
+** ------------------------------------------------------------------- */
+
+BENCH_STAT(arm_mean_f32, f32, float32_t)
+BENCH_STAT(arm_mean_q31, q31, q31_t)
+BENCH_STAT(arm_mean_q15, q15, q15_t)
+BENCH_STAT(arm_mean_q7, q7, q7_t)
+BENCH_STAT(arm_power_f32, f32, float32_t)
+BENCH_STAT(arm_power_q31, q31, q63_t)
+BENCH_STAT(arm_power_q15, q15, q63_t)
+BENCH_STAT(arm_power_q7, q7, q31_t)
+BENCH_STAT(arm_rms_f32, f32, float32_t)
+BENCH_STAT(arm_rms_q31, q31, q31_t)
+BENCH_STAT(arm_rms_q15, q15, q15_t)
+BENCH_STAT(arm_std_f32, f32, float32_t)
+BENCH_STAT(arm_std_q31, q31, q31_t)
+BENCH_STAT(arm_std_q15, q15, q15_t)
+BENCH_STAT(arm_var_f32, f32, float32_t)
+BENCH_STAT(arm_var_q31, q31, q63_t)
+BENCH_STAT(arm_var_q15, q15, q31_t)
+BENCH_MINMAX(arm_min_f32, f32, float32_t)
+BENCH_MINMAX(arm_min_q31, q31, q31_t)
+BENCH_MINMAX(arm_min_q15, q15, q15_t)
+BENCH_MINMAX(arm_min_q7, q7, q7_t)
+BENCH_MINMAX(arm_max_f32, f32, float32_t)
+BENCH_MINMAX(arm_max_q31, q31, q31_t)
+BENCH_MINMAX(arm_max_q15, q15, q15_t)
+BENCH_MINMAX(arm_max_q7, q7, q7_t)
+BENCH_FUSED(arm_stats_f32, f32)
+BENCH_FUSED(arm_stats_q31, q31)
+BENCH_FUSED(arm_stats_q15, q15)
+BENCH_FUSED(arm_stats_q7, q7)
+
+/* The streaming functions are timed for a single block, with the init and the final
+ * reduction of the accumulator included. */
+static uint32_t benchCounts[256];
+
+BENCH_ACC(f32)
+BENCH_ACC(q31)
+BENCH_ACC(q15)
+BENCH_RMS_EXP(f32, float32_t, 0.01f)
+BENCH_RMS_EXP(q31, q31_t, 0x01000000)
+BENCH_RMS_EXP(q15, q15_t, 0x01000000)
+BENCH_HISTOGRAM(q31)
+BENCH_HISTOGRAM(q15)
+
+static void bench_arm_histogram_f32(
+  const arm_bench_config * cfg)
+{
+  arm_histogram_instance_f32 S;
+
+  arm_histogram_init_f32(&S, 256u, -1.0f, 1.0f, benchCounts);
+  arm_histogram_f32(&S, benchSrcA_f32, cfg->blockSize);
+  benchSink = benchCounts[128];
+}
+
+/* The statistics of arm_stats_xxx() with one call per statistic, for comparison.
+ * There are no Q7 variance, standard deviation and RMS functions. */
+static void bench_arm_stats_separate_f32(
+  const arm_bench_config * cfg)
+{
+  arm_stats_result_f32 r;
+
+  arm_mean_f32(benchSrcA_f32, cfg->blockSize, &r.mean);
+  arm_var_f32(benchSrcA_f32, cfg->blockSize, &r.var);
+  arm_std_f32(benchSrcA_f32, cfg->blockSize, &r.std);
+  arm_rms_f32(benchSrcA_f32, cfg->blockSize, &r.rms);
+  arm_power_f32(benchSrcA_f32, cfg->blockSize, &r.power);
+  arm_min_f32(benchSrcA_f32, cfg->blockSize, &r.min, &r.minIndex);
+  arm_max_f32(benchSrcA_f32, cfg->blockSize, &r.max, &r.maxIndex);
+  benchSink = r.maxIndex;
+}
+
+static void bench_arm_stats_separate_q31(
+  const arm_bench_config * cfg)
+{
+  arm_stats_result_q31 r;
+
+  arm_mean_q31(benchSrcA_q31, cfg->blockSize, &r.mean);
+  arm_var_q31(benchSrcA_q31, cfg->blockSize, &r.var);
+  arm_std_q31(benchSrcA_q31, cfg->blockSize, &r.std);
+  arm_rms_q31(benchSrcA_q31, cfg->blockSize, &r.rms);
+  arm_power_q31(benchSrcA_q31, cfg->blockSize, &r.power);
+  arm_min_q31(benchSrcA_q31, cfg->blockSize, &r.min, &r.minIndex);
+  arm_max_q31(benchSrcA_q31, cfg->blockSize, &r.max, &r.maxIndex);
+  benchSink = r.maxIndex;
+}
+
+static void bench_arm_stats_separate_q15(
+  const arm_bench_config * cfg)
+{
+  arm_stats_result_q15 r;
+
+  arm_mean_q15(benchSrcA_q15, cfg->blockSize, &r.mean);
+  arm_var_q15(benchSrcA_q15, cfg->blockSize, &r.var);
+  arm_std_q15(benchSrcA_q15, cfg->blockSize, &r.std);
+  arm_rms_q15(benchSrcA_q15, cfg->blockSize, &r.rms);
+  arm_power_q15(benchSrcA_q15, cfg->blockSize, &r.power);
+  arm_min_q15(benchSrcA_q15, cfg->blockSize, &r.min, &r.minIndex);
+  arm_max_q15(benchSrcA_q15, cfg->blockSize, &r.max, &r.maxIndex);
+  benchSink = r.maxIndex;
+}
+
+static void bench_arm_stats_separate_q7(
+  const arm_bench_config * cfg)
+{
+  arm_stats_result_q7 r;
+
+  arm_mean_q7(benchSrcA_q7, cfg->blockSize, &r.mean);
+  arm_power_q7(benchSrcA_q7, cfg->blockSize, &r.power);
+  arm_min_q7(benchSrcA_q7, cfg->blockSize, &r.min, &r.minIndex);
+  arm_max_q7(benchSrcA_q7, cfg->blockSize, &r.max, &r.maxIndex);
+  benchSink = r.maxIndex;
+}
+
+const arm_bench_kernel armBenchStatistics[] = {
+  ARM_BENCH_ENTRY(arm_mean_f32, "Statistics", f32, 0u, 0),
+  ARM_BENCH_ENTRY(arm_mean_q31, "Statistics", q31, 0u, 0),
+  ARM_BENCH_ENTRY(arm_mean_q15, "Statistics", q15, 0u, 0),
+  ARM_BENCH_ENTRY(arm_mean_q7, "Statistics", q7, 0u, 0),
+  ARM_BENCH_ENTRY(arm_power_f32, "Statistics", f32, 0u, 0),
+  ARM_BENCH_ENTRY(arm_power_q31, "Statistics", q31, 0u, 0),
+  ARM_BENCH_ENTRY(arm_power_q15, "Statistics", q15, 0u, 0),
+  ARM_BENCH_ENTRY(arm_power_q7, "Statistics", q7, 0u, 0),
+  ARM_BENCH_ENTRY(arm_rms_f32, "Statistics", f32, 0u, 0),
+  ARM_BENCH_ENTRY(arm_rms_q31, "Statistics", q31, 0u, 0),
+  ARM_BENCH_ENTRY(arm_rms_q15, "Statistics", q15, 0u, 0),
+  ARM_BENCH_ENTRY(arm_std_f32, "Statistics", f32, 0u, 0),
+  ARM_BENCH_ENTRY(arm_std_q31, "Statistics", q31, 0u, 0),
+  ARM_BENCH_ENTRY(arm_std_q15, "Statistics", q15, 0u, 0),
+  ARM_BENCH_ENTRY(arm_var_f32, "Statistics", f32, 0u, 0),
+  ARM_BENCH_ENTRY(arm_var_q31, "Statistics", q31, 0u, 0),
+  ARM_BENCH_ENTRY(arm_var_q15, "Statistics", q15, 0u, 0),
+  ARM_BENCH_ENTRY(arm_min_f32, "Statistics", f32, 0u, 0),
+  ARM_BENCH_ENTRY(arm_min_q31, "Statistics", q31, 0u, 0),
+  ARM_BENCH_ENTRY(arm_min_q15, "Statistics", q15, 0u, 0),
+  ARM_BENCH_ENTRY(arm_min_q7, "Statistics", q7, 0u, 0),
+  ARM_BENCH_ENTRY(arm_max_f32, "Statistics", f32, 0u, 0),
+  ARM_BENCH_ENTRY(arm_max_q31, "Statistics", q31, 0u, 0),
+  ARM_BENCH_ENTRY(arm_max_q15, "Statistics", q15, 0u, 0),
+  ARM_BENCH_ENTRY(arm_max_q7, "Statistics", q7, 0u, 0),
+  ARM_BENCH_ENTRY(arm_stats_f32, "Statistics", f32, 0u, 0),
+  ARM_BENCH_ENTRY(arm_stats_q31, "Statistics", q31, 0u, 0),
+  ARM_BENCH_ENTRY(arm_stats_q15, "Statistics", q15, 0u, 0),
+  ARM_BENCH_ENTRY(arm_stats_q7, "Statistics", q7, 0u, 0),
+  ARM_BENCH_ENTRY(arm_stats_separate_f32, "Statistics", f32, 0u, 0),
+  ARM_BENCH_ENTRY(arm_stats_separate_q31, "Statistics", q31, 0u, 0),
+  ARM_BENCH_ENTRY(arm_stats_separate_q15, "Statistics", q15, 0u, 0),
+  ARM_BENCH_ENTRY(arm_stats_separate_q7, "Statistics", q7, 0u, 0),
+  ARM_BENCH_ENTRY(arm_stats_acc_f32, "Statistics", f32, 0u, 0),
+  ARM_BENCH_ENTRY(arm_stats_acc_q31, "Statistics", q31, 0u, 0),
+  ARM_BENCH_ENTRY(arm_stats_acc_q15, "Statistics", q15, 0u, 0),
+  ARM_BENCH_ENTRY(arm_rms_exp_f32, "Statistics", f32, 0u, 0),
+  ARM_BENCH_ENTRY(arm_rms_exp_q31, "Statistics", q31, 0u, 0),
+  ARM_BENCH_ENTRY(arm_rms_exp_q15, "Statistics", q15, 0u, 0),
+  ARM_BENCH_ENTRY(arm_histogram_f32, "Statistics", f32, 0u, 0),
+  ARM_BENCH_ENTRY(arm_histogram_q31, "Statistics", q31, 0u, 0),
+  ARM_BENCH_ENTRY(arm_histogram_q15, "Statistics", q15, 0u, 0),
+};
+
+const uint32_t armBenchStatisticsCount =
+  sizeof(armBenchStatistics) / sizeof(armBenchStatistics[0]);
+
+/* ----------------------------------------------------------------------
+** Support functions.  The type column names the source type.
+** ------------------------------------------------------------------- */
+
+BENCH_CONVERT(arm_copy_f32, f32, f32)
+BENCH_CONVERT(arm_copy_q31, q31, q31)
+BENCH_CONVERT(arm_copy_q15, q15, q15)
+BENCH_CONVERT(arm_copy_q7, q7, q7)
+BENCH_CONVERT(arm_float_to_q31, f32, q31)
+BENCH_CONVERT(arm_float_to_q15, f32, q15)
+BENCH_CONVERT(arm_float_to_q7, f32, q7)
+BENCH_CONVERT(arm_q31_to_float, q31, f32)
+BENCH_CONVERT(arm_q31_to_q15, q31, q15)
+BENCH_CONVERT(arm_q31_to_q7, q31, q7)
+BENCH_CONVERT(arm_q15_to_float, q15, f32)
+BENCH_CONVERT(arm_q15_to_q31, q15, q31)
+BENCH_CONVERT(arm_q15_to_q7, q15, q7)
+BENCH_CONVERT(arm_q7_to_float, q7, f32)
+BENCH_CONVERT(arm_q7_to_q31, q7, q31)
+BENCH_CONVERT(arm_q7_to_q15, q7, q15)
+
+#define BENCH_DITHER(fn, M, C, name, S, D) \
+  static arm_convert_instance convert_##name; \
+  static uint32_t setup_##name(const arm_bench_config * cfg) \
+  { arm_convert_init(&convert_##name, M, C, 1u); return (cfg->blockSize); } \
+  static void bench_##name(const arm_bench_config * cfg) \
+  { benchSink = fn(&convert_##name, benchSrcA_##S, benchDst_##D, cfg->blockSize); }
+
+BENCH_DITHER(arm_convert_float_to_q31, ARM_CONVERT_TRUNCATE, 1u, arm_convert_float_to_q31_truncate, f32, q31)
+BENCH_DITHER(arm_convert_float_to_q31, ARM_CONVERT_TRUNCATE, 0u, arm_convert_float_to_q31_truncate_nocount, f32, q31)
+BENCH_DITHER(arm_convert_float_to_q31, ARM_CONVERT_ROUND, 1u, arm_convert_float_to_q31_round, f32, q31)
+BENCH_DITHER(arm_convert_float_to_q31, ARM_CONVERT_DITHER_TPDF, 1u, arm_convert_float_to_q31_dither, f32, q31)
+BENCH_DITHER(arm_convert_float_to_q31, ARM_CONVERT_DITHER_TPDF, 0u, arm_convert_float_to_q31_dither_nocount, f32, q31)
+BENCH_DITHER(arm_convert_float_to_q15, ARM_CONVERT_TRUNCATE, 1u, arm_convert_float_to_q15_truncate, f32, q15)
+BENCH_DITHER(arm_convert_float_to_q15, ARM_CONVERT_TRUNCATE, 0u, arm_convert_float_to_q15_truncate_nocount, f32, q15)
+BENCH_DITHER(arm_convert_float_to_q15, ARM_CONVERT_ROUND, 1u, arm_convert_float_to_q15_round, f32, q15)
+BENCH_DITHER(arm_convert_float_to_q15, ARM_CONVERT_DITHER_TPDF, 1u, arm_convert_float_to_q15_dither, f32, q15)
+BENCH_DITHER(arm_convert_float_to_q15, ARM_CONVERT_DITHER_TPDF, 0u, arm_convert_float_to_q15_dither_nocount, f32, q15)
+BENCH_DITHER(arm_convert_float_to_q7, ARM_CONVERT_TRUNCATE, 1u, arm_convert_float_to_q7_truncate, f32, q7)
+BENCH_DITHER(arm_convert_float_to_q7, ARM_CONVERT_TRUNCATE, 0u, arm_convert_float_to_q7_truncate_nocount, f32, q7)
+BENCH_DITHER(arm_convert_float_to_q7, ARM_CONVERT_ROUND, 1u, arm_convert_float_to_q7_round, f32, q7)
+BENCH_DITHER(arm_convert_float_to_q7, ARM_CONVERT_DITHER_TPDF, 1u, arm_convert_float_to_q7_dither, f32, q7)
+BENCH_DITHER(arm_convert_float_to_q7, ARM_CONVERT_DITHER_TPDF, 0u, arm_convert_float_to_q7_dither_nocount, f32, q7)
+BENCH_DITHER(arm_convert_q31_to_q15, ARM_CONVERT_TRUNCATE, 1u, arm_convert_q31_to_q15_truncate, q31, q15)
+BENCH_DITHER(arm_convert_q31_to_q15, ARM_CONVERT_TRUNCATE, 0u, arm_convert_q31_to_q15_truncate_nocount, q31, q15)
+BENCH_DITHER(arm_convert_q31_to_q15, ARM_CONVERT_ROUND, 1u, arm_convert_q31_to_q15_round, q31, q15)
+BENCH_DITHER(arm_convert_q31_to_q15, ARM_CONVERT_DITHER_TPDF, 1u, arm_convert_q31_to_q15_dither, q31, q15)
+BENCH_DITHER(arm_convert_q31_to_q15, ARM_CONVERT_DITHER_TPDF, 0u, arm_convert_q31_to_q15_dither_nocount, q31, q15)
+
+static void bench_arm_fill_f32(
+  const arm_bench_config * cfg)
+{
+  arm_fill_f32(0.5f, benchDst_f32, cfg->blockSize);
+}
+
+static void bench_arm_fill_q31(
+  const arm_bench_config * cfg)
+{
+  arm_fill_q31(0x40000000, benchDst_q31, cfg->blockSize);
+}
+
+static void bench_arm_fill_q15(
+  const arm_bench_config * cfg)
+{
+  arm_fill_q15(0x4000, benchDst_q15, cfg->blockSize);
+}
+
+static void bench_arm_fill_q7(
+  const arm_bench_config * cfg)
+{
+  arm_fill_q7(0x40, benchDst_q7, cfg->blockSize);
+}
+
+const arm_bench_kernel armBenchSupport[] = {
+  ARM_BENCH_ENTRY(arm_copy_f32, "Support", f32, 0u, 0),
+  ARM_BENCH_ENTRY(arm_copy_q31, "Support", q31, 0u, 0),
+  ARM_BENCH_ENTRY(arm_copy_q15, "Support", q15, 0u, 0),
+  ARM_BENCH_ENTRY(arm_copy_q7, "Support", q7, 0u, 0),
+  ARM_BENCH_ENTRY(arm_fill_f32, "Support", f32, 0u, 0),
+  ARM_BENCH_ENTRY(arm_fill_q31, "Support", q31, 0u, 0),
+  ARM_BENCH_ENTRY(arm_fill_q15, "Support", q15, 0u, 0),
+  ARM_BENCH_ENTRY(arm_fill_q7, "Support", q7, 0u, 0),
+  ARM_BENCH_ENTRY(arm_float_to_q31, "Support", f32, 0u, 0),
+  ARM_BENCH_ENTRY(arm_float_to_q15, "Support", f32, 0u, 0),
+  ARM_BENCH_ENTRY(arm_float_to_q7, "Support", f32, 0u, 0),
+  ARM_BENCH_ENTRY(arm_q31_to_float, "Support", q31, 0u, 0),
+  ARM_BENCH_ENTRY(arm_q31_to_q15, "Support", q31, 0u, 0),
+  ARM_BENCH_ENTRY(arm_q31_to_q7, "Support", q31, 0u, 0),
+  ARM_BENCH_ENTRY(arm_q15_to_float, "Support", q15, 0u, 0),
+  ARM_BENCH_ENTRY(arm_q15_to_q31, "Support", q15, 0u, 0),
+  ARM_BENCH_ENTRY(arm_q15_to_q7, "Support", q15, 0u, 0),
+  ARM_BENCH_ENTRY(arm_q7_to_float, "Support", q7, 0u, 0),
+  ARM_BENCH_ENTRY(arm_q7_to_q31, "Support", q7, 0u, 0),
+  ARM_BENCH_ENTRY(arm_q7_to_q15, "Support", q7, 0u, 0),
+  ARM_BENCH_ENTRY(arm_convert_float_to_q31_truncate, "Support", f32, 0u, setup_arm_convert_float_to_q31_truncate),
+  ARM_BENCH_ENTRY(arm_convert_float_to_q31_truncate_nocount, "Support", f32, 0u, setup_arm_convert_float_to_q31_truncate_nocount),
+  ARM_BENCH_ENTRY(arm_convert_float_to_q31_round, "Support", f32, 0u, setup_arm_convert_float_to_q31_round),
+  ARM_BENCH_ENTRY(arm_convert_float_to_q31_dither, "Support", f32, 0u, setup_arm_convert_float_to_q31_dither),
+  ARM_BENCH_ENTRY(arm_convert_float_to_q31_dither_nocount, "Support", f32, 0u, setup_arm_convert_float_to_q31_dither_nocount),
+  ARM_BENCH_ENTRY(arm_convert_float_to_q15_truncate, "Support", f32, 0u, setup_arm_convert_float_to_q15_truncate),
+  ARM_BENCH_ENTRY(arm_convert_float_to_q15_truncate_nocount, "Support", f32, 0u, setup_arm_convert_float_to_q15_truncate_nocount),
+  ARM_BENCH_ENTRY(arm_convert_float_to_q15_round, "Support", f32, 0u, setup_arm_convert_float_to_q15_round),
+  ARM_BENCH_ENTRY(arm_convert_float_to_q15_dither, "Support", f32, 0u, setup_arm_convert_float_to_q15_dither),
+  ARM_BENCH_ENTRY(arm_convert_float_to_q15_dither_nocount, "Support", f32, 0u, setup_arm_convert_float_to_q15_dither_nocount),
+  ARM_BENCH_ENTRY(arm_convert_float_to_q7_truncate, "Support", f32, 0u, setup_arm_convert_float_to_q7_truncate),
+  ARM_BENCH_ENTRY(arm_convert_float_to_q7_truncate_nocount, "Support", f32, 0u, setup_arm_convert_float_to_q7_truncate_nocount),
+  ARM_BENCH_ENTRY(arm_convert_float_to_q7_round, "Support", f32, 0u, setup_arm_convert_float_to_q7_round),
+  ARM_BENCH_ENTRY(arm_convert_float_to_q7_dither, "Support", f32, 0u, setup_arm_convert_float_to_q7_dither),
+  ARM_BENCH_ENTRY(arm_convert_float_to_q7_dither_nocount, "Support", f32, 0u, setup_arm_convert_float_to_q7_dither_nocount),
+  ARM_BENCH_ENTRY(arm_convert_q31_to_q15_truncate, "Support", q31, 0u, setup_arm_convert_q31_to_q15_truncate),
+  ARM_BENCH_ENTRY(arm_convert_q31_to_q15_truncate_nocount, "Support", q31, 0u, setup_arm_convert_q31_to_q15_truncate_nocount),
+  ARM_BENCH_ENTRY(arm_convert_q31_to_q15_round, "Support", q31, 0u, setup_arm_convert_q31_to_q15_round),
+  ARM_BENCH_ENTRY(arm_convert_q31_to_q15_dither, "Support", q31, 0u, setup_arm_convert_q31_to_q15_dither),
+  ARM_BENCH_ENTRY(arm_convert_q31_to_q15_dither_nocount, "Support", q31, 0u, setup_arm_convert_q31_to_q15_dither_nocount),
+};
+
+const uint32_t armBenchSupportCount =
+  sizeof(armBenchSupport) / sizeof(armBenchSupport[0]);
@@ -0,0 +1,616 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* Project: 	    CMSIS DSP Library
+* Title:		arm_bench_transform.c
+*
+* Description:	Benchmark table for the transform and matrix functions.
+*
+* Target Processor: Host (ARM_MATH_HOST) / Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include <stdlib.h>
+#include "arm_bench.h"
+
+static arm_cfft_radix4_instance_f32 cfftF32;
+static arm_cfft_radix4_instance_q31 cfftQ31;
+static arm_cfft_radix4_instance_q15 cfftQ15;
+
+static arm_rfft_instance_f32 rfftF32;
+static arm_rfft_instance_q31 rfftQ31;
+static arm_rfft_instance_q15 rfftQ15;
+
+static arm_dct4_instance_f32 dct4F32;
+static arm_dct4_instance_q31 dct4Q31;
+static arm_dct4_instance_q15 dct4Q15;
+
+static arm_goertzel_instance_f32 goertzelF32;
+static arm_goertzel_instance_q31 goertzelQ31;
+static arm_goertzel_instance_q15 goertzelQ15;
+
+static float32_t goertzelFreqs_f32[ARM_BENCH_MAX_TAPS];
+static q31_t goertzelFreqs_q31[ARM_BENCH_MAX_TAPS];
+static q15_t goertzelFreqs_q15[ARM_BENCH_MAX_TAPS];
+
+static arm_matrix_instance_f32 matAF32, matBF32, matDF32;
+static arm_matrix_instance_q31 matAQ31, matBQ31, matDQ31;
+static arm_matrix_instance_q15 matAQ15, matBQ15, matDQ15;
+static arm_matrix_instance_f32 matPF32;
+
+/* Largest N of the Matrix group, floor(sqrt(ARM_BENCH_MAX_BLOCK)) */
+#define BENCH_MAT_MAX_N         64u
+
+static float32_t matSpd_f32[BENCH_MAT_MAX_N * BENCH_MAT_MAX_N];
+static float32_t matTau_f32[BENCH_MAT_MAX_N];
+static float32_t matScratch_f32[BENCH_MAT_MAX_N];
+static uint16_t matPerm[BENCH_MAT_MAX_N];
+
+static float32_t *gemmA_f32, *gemmB_f32, *gemmP_f32, *gemmD_f32;
+static arm_matrix_instance_f32 gemmAF32, gemmBF32, gemmPF32, gemmDF32;
+
+/* ----------------------------------------------------------------------
+** Transforms.  blockSize is the transform length; lengths without
+** twiddle tables are skipped.  The transforms work in place, so each run
+** first copies the input into pDst (included in the measurement) to keep
+** the repeated float transforms from overflowing.
+** ------------------------------------------------------------------- */
+
+static uint32_t setup_cfft_f32(
+  const arm_bench_config * cfg)
+{
+  return ((arm_cfft_radix4_init_f32(&cfftF32, (uint16_t) cfg->blockSize, 0u, 1u) ==
+           ARM_MATH_SUCCESS) ? cfg->blockSize : 0u);
+}
+
+static uint32_t setup_cfft_q31(
+  const arm_bench_config * cfg)
+{
+  return ((arm_cfft_radix4_init_q31(&cfftQ31, (uint16_t) cfg->blockSize, 0u, 1u) ==
+           ARM_MATH_SUCCESS) ? cfg->blockSize : 0u);
+}
+
+static uint32_t setup_cfft_q15(
+  const arm_bench_config * cfg)
+{
+  return ((arm_cfft_radix4_init_q15(&cfftQ15, (uint16_t) cfg->blockSize, 0u, 1u) ==
+           ARM_MATH_SUCCESS) ? cfg->blockSize : 0u);
+}
+
+static void bench_arm_cfft_radix4_f32(
+  const arm_bench_config * cfg)
+{
+  arm_copy_f32(benchSrcA_f32, benchDst_f32, 2u * cfg->blockSize);
+  arm_cfft_radix4_f32(&cfftF32, benchDst_f32);
+}
+
+static void bench_arm_cfft_radix4_q31(
+  const arm_bench_config * cfg)
+{
+  arm_copy_q31(benchSrcA_q31, benchDst_q31, 2u * cfg->blockSize);
+  arm_cfft_radix4_q31(&cfftQ31, benchDst_q31);
+}
+
+static void bench_arm_cfft_radix4_q15(
+  const arm_bench_config * cfg)
+{
+  arm_copy_q15(benchSrcA_q15, benchDst_q15, 2u * cfg->blockSize);
+  arm_cfft_radix4_q15(&cfftQ15, benchDst_q15);
+}
+
+static uint32_t setup_rfft_f32(
+  const arm_bench_config * cfg)
+{
+  return ((arm_rfft_init_f32(&rfftF32, &cfftF32, cfg->blockSize, 0u, 1u) ==
+           ARM_MATH_SUCCESS) ? cfg->blockSize : 0u);
+}
+
+static uint32_t setup_rfft_q31(
+  const arm_bench_config * cfg)
+{
+  return ((arm_rfft_init_q31(&rfftQ31, &cfftQ31, cfg->blockSize, 0u, 1u) ==
+           ARM_MATH_SUCCESS) ? cfg->blockSize : 0u);
+}
+
+static uint32_t setup_rfft_q15(
+  const arm_bench_config * cfg)
+{
+  return ((arm_rfft_init_q15(&rfftQ15, &cfftQ15, cfg->blockSize, 0u, 1u) ==
+           ARM_MATH_SUCCESS) ? cfg->blockSize : 0u);
+}
+
+static void bench_arm_rfft_f32(
+  const arm_bench_config * cfg)
+{
+  arm_copy_f32(benchSrcA_f32, benchState_f32, cfg->blockSize);
+  arm_rfft_f32(&rfftF32, benchState_f32, benchDst_f32);
+}
+
+static void bench_arm_rfft_q31(
+  const arm_bench_config * cfg)
+{
+  arm_copy_q31(benchSrcA_q31, benchState_q31, cfg->blockSize);
+  arm_rfft_q31(&rfftQ31, benchState_q31, benchDst_q31);
+}
+
+static void bench_arm_rfft_q15(
+  const arm_bench_config * cfg)
+{
+  arm_copy_q15(benchSrcA_q15, benchState_q15, cfg->blockSize);
+  arm_rfft_q15(&rfftQ15, benchState_q15, benchDst_q15);
+}
+
+static uint32_t setup_dct4_f32(
+  const arm_bench_config * cfg)
+{
+  float32_t normalize = 0.0f;
+
+  arm_sqrt_f32(2.0f / (float32_t) cfg->blockSize, &normalize);
+
+  return ((arm_dct4_init_f32(&dct4F32, &rfftF32, &cfftF32, (uint16_t) cfg->blockSize,
+                             (uint16_t) (cfg->blockSize / 2u), normalize) ==
+           ARM_MATH_SUCCESS) ? cfg->blockSize : 0u);
+}
+
+static uint32_t setup_dct4_q31(
+  const arm_bench_config * cfg)
+{
+  float32_t normalize = 0.0f;
+  q31_t normQ31;
+
+  arm_sqrt_f32(2.0f / (float32_t) cfg->blockSize, &normalize);
+  arm_float_to_q31(&normalize, &normQ31, 1u);
+
+  return ((arm_dct4_init_q31(&dct4Q31, &rfftQ31, &cfftQ31, (uint16_t) cfg->blockSize,
+                             (uint16_t) (cfg->blockSize / 2u), normQ31) ==
+           ARM_MATH_SUCCESS) ? cfg->blockSize : 0u);
+}
+
+static uint32_t setup_dct4_q15(
+  const arm_bench_config * cfg)
+{
+  float32_t normalize = 0.0f;
+  q15_t normQ15;
+
+  arm_sqrt_f32(2.0f / (float32_t) cfg->blockSize, &normalize);
+  arm_float_to_q15(&normalize, &normQ15, 1u);
+
+  return ((arm_dct4_init_q15(&dct4Q15, &rfftQ15, &cfftQ15, (uint16_t) cfg->blockSize,
+                             (uint16_t) (cfg->blockSize / 2u), normQ15) ==
+           ARM_MATH_SUCCESS) ? cfg->blockSize : 0u);
+}
+
+static void bench_arm_dct4_f32(
+  const arm_bench_config * cfg)
+{
+  arm_copy_f32(benchSrcA_f32, benchDst_f32, cfg->blockSize);
+  arm_dct4_f32(&dct4F32, benchState_f32, benchDst_f32);
+}
+
+static void bench_arm_dct4_q31(
+  const arm_bench_config * cfg)
+{
+  arm_copy_q31(benchSrcA_q31, benchDst_q31, cfg->blockSize);
+  arm_dct4_q31(&dct4Q31, benchState_q31, benchDst_q31);
+}
+
+static void bench_arm_dct4_q15(
+  const arm_bench_config * cfg)
+{
+  arm_copy_q15(benchSrcA_q15, benchDst_q15, cfg->blockSize);
+  arm_dct4_q15(&dct4Q15, benchState_q15, benchDst_q15);
+}
+
+/* ----------------------------------------------------------------------
+** Goertzel filter banks with numTaps bins spread over the band and one
+** window per call, windowLength = blockSize.  The cost grows with
+** numTaps * blockSize, the one of an FFT with blockSize * log2(blockSize)
+** whatever the number of bins, so the crossover in numTaps is read from
+** these entries against arm_rfft_xxx at the same blockSize.  The power
+** outputs of the fixed-point banks are 64-bit, and follow the q63 state of
+** the Q31 bank in benchState_q63.
+** ------------------------------------------------------------------- */
+
+static uint32_t setup_goertzel(
+  const arm_bench_config * cfg)
+{
+  arm_status status;
+  uint32_t i;
+
+  if(cfg->blockSize > 0xFFFFu)
+  {
+    return (0u);
+  }
+
+  for (i = 0u; i < cfg->numTaps; i++)
+  {
+    goertzelFreqs_f32[i] = (0.5f * (float32_t) i) / (float32_t) cfg->numTaps;
+  }
+
+  arm_float_to_q31(goertzelFreqs_f32, goertzelFreqs_q31, cfg->numTaps);
+  arm_float_to_q15(goertzelFreqs_f32, goertzelFreqs_q15, cfg->numTaps);
+
+  status = arm_goertzel_init_f32(&goertzelF32, (uint16_t) cfg->numTaps,
+                                 (uint16_t) cfg->blockSize, goertzelFreqs_f32,
+                                 benchCoeff_f32, benchState_f32);
+  status |= arm_goertzel_init_q31(&goertzelQ31, (uint16_t) cfg->numTaps,
+                                  (uint16_t) cfg->blockSize, goertzelFreqs_q31,
+                                  benchCoeff_q31, benchState_q63);
+  status |= arm_goertzel_init_q15(&goertzelQ15, (uint16_t) cfg->numTaps,
+                                  (uint16_t) cfg->blockSize, goertzelFreqs_q15,
+                                  benchCoeff_q15, benchState_q31);
+
+  return ((status == ARM_MATH_SUCCESS) ? cfg->blockSize : 0u);
+}
+
+static void bench_arm_goertzel_f32(
+  const arm_bench_config * cfg)
+{
+  benchSink = arm_goertzel_f32(&goertzelF32, benchSrcA_f32, benchDst_f32, cfg->blockSize);
+}
+
+static void bench_arm_goertzel_q31(
+  const arm_bench_config * cfg)
+{
+  benchSink = arm_goertzel_q31(&goertzelQ31, benchSrcA_q31,
+                               &benchState_q63[2u * ARM_BENCH_MAX_TAPS], cfg->blockSize);
+}
+
+static void bench_arm_goertzel_q15(
+  const arm_bench_config * cfg)
+{
+  benchSink = arm_goertzel_q15(&goertzelQ15, benchSrcA_q15,
+                               &benchState_q63[2u * ARM_BENCH_MAX_TAPS], cfg->blockSize);
+}
+
+const arm_bench_kernel armBenchTransform[] = {
+  ARM_BENCH_ENTRY(arm_cfft_radix4_f32, "Transform", f32, 0u, setup_cfft_f32),
+  ARM_BENCH_ENTRY(arm_cfft_radix4_q31, "Transform", q31, 0u, setup_cfft_q31),
+  ARM_BENCH_ENTRY(arm_cfft_radix4_q15, "Transform", q15, 0u, setup_cfft_q15),
+  ARM_BENCH_ENTRY(arm_rfft_f32, "Transform", f32, 0u, setup_rfft_f32),
+  ARM_BENCH_ENTRY(arm_rfft_q31, "Transform", q31, 0u, setup_rfft_q31),
+  ARM_BENCH_ENTRY(arm_rfft_q15, "Transform", q15, 0u, setup_rfft_q15),
+  ARM_BENCH_ENTRY(arm_dct4_f32, "Transform", f32, 0u, setup_dct4_f32),
+  ARM_BENCH_ENTRY(arm_dct4_q31, "Transform", q31, 0u, setup_dct4_q31),
+  ARM_BENCH_ENTRY(arm_dct4_q15, "Transform", q15, 0u, setup_dct4_q15),
+  ARM_BENCH_ENTRY(arm_goertzel_f32, "Transform", f32, ARM_BENCH_TAPS, setup_goertzel),
+  ARM_BENCH_ENTRY(arm_goertzel_q31, "Transform", q31, ARM_BENCH_TAPS, setup_goertzel),
+  ARM_BENCH_ENTRY(arm_goertzel_q15, "Transform", q15, ARM_BENCH_TAPS, setup_goertzel),
+};
+
+const uint32_t armBenchTransformCount =
+  sizeof(armBenchTransform) / sizeof(armBenchTransform[0]);
+
+/* ----------------------------------------------------------------------
+** Matrix functions on square N x N operands, N = floor(sqrt(blockSize)).
+** The sample count is the number of output elements, N * N.
+** ------------------------------------------------------------------- */
+
+static uint32_t setup_matrix(
+  const arm_bench_config * cfg)
+{
+  uint16_t n = 1u;
+
+  while(((uint32_t) (n + 1u) * (n + 1u)) <= cfg->blockSize)
+  {
+    n++;
+  }
+
+  arm_mat_init_f32(&matAF32, n, n, benchSrcA_f32);
+  arm_mat_init_f32(&matBF32, n, n, benchSrcB_f32);
+  arm_mat_init_f32(&matDF32, n, n, benchDst_f32);
+  arm_mat_init_q31(&matAQ31, n, n, benchSrcA_q31);
+  arm_mat_init_q31(&matBQ31, n, n, benchSrcB_q31);
+  arm_mat_init_q31(&matDQ31, n, n, benchDst_q31);
+  arm_mat_init_q15(&matAQ15, n, n, benchSrcA_q15);
+  arm_mat_init_q15(&matBQ15, n, n, benchSrcB_q15);
+  arm_mat_init_q15(&matDQ15, n, n, benchDst_q15);
+
+  return ((uint32_t) n * n);
+}
+
+#define BENCH_MAT_BINARY(fn, U) \
+  static void bench_##fn(const arm_bench_config * cfg) \
+  { (void) cfg; fn(&matA##U, &matB##U, &matD##U); }
+
+BENCH_MAT_BINARY(arm_mat_add_f32, F32)
+BENCH_MAT_BINARY(arm_mat_add_q31, Q31)
+BENCH_MAT_BINARY(arm_mat_add_q15, Q15)
+BENCH_MAT_BINARY(arm_mat_sub_f32, F32)
+BENCH_MAT_BINARY(arm_mat_sub_q31, Q31)
+BENCH_MAT_BINARY(arm_mat_sub_q15, Q15)
+BENCH_MAT_BINARY(arm_mat_mult_f32, F32)
+BENCH_MAT_BINARY(arm_mat_mult_q31, Q31)
+BENCH_MAT_BINARY(arm_mat_mult_fast_q31, Q31)
+
+static uint32_t setup_matrix_packed(
+  const arm_bench_config * cfg)
+{
+  uint32_t samples = setup_matrix(cfg);
+
+  /* B is packed once, as for a fixed operand */
+  arm_mat_init_f32(&matPF32, matBF32.numRows, matBF32.numCols, benchState_f32);
+  arm_mat_pack_f32(&matBF32, benchState_f32);
+
+  return (samples);
+}
+
+static void bench_arm_mat_mult_packed_f32(
+  const arm_bench_config * cfg)
+{
+  (void) cfg;
+  arm_mat_mult_packed_f32(&matAF32, &matPF32, &matDF32);
+}
+
+static void bench_arm_mat_mult_q15(
+  const arm_bench_config * cfg)
+{
+  (void) cfg;
+  arm_mat_mult_q15(&matAQ15, &matBQ15, &matDQ15, benchState_q15);
+}
+
+static void bench_arm_mat_mult_fast_q15(
+  const arm_bench_config * cfg)
+{
+  (void) cfg;
+  arm_mat_mult_fast_q15(&matAQ15, &matBQ15, &matDQ15, benchState_q15);
+}
+
+static void bench_arm_mat_trans_f32(
+  const arm_bench_config * cfg)
+{
+  (void) cfg;
+  arm_mat_trans_f32(&matAF32, &matDF32);
+}
+
+static void bench_arm_mat_trans_q31(
+  const arm_bench_config * cfg)
+{
+  (void) cfg;
+  arm_mat_trans_q31(&matAQ31, &matDQ31);
+}
+
+static void bench_arm_mat_trans_q15(
+  const arm_bench_config * cfg)
+{
+  (void) cfg;
+  arm_mat_trans_q15(&matAQ15, &matDQ15);
+}
+
+static void bench_arm_mat_scale_f32(
+  const arm_bench_config * cfg)
+{
+  (void) cfg;
+  arm_mat_scale_f32(&matAF32, 0.5f, &matDF32);
+}
+
+static void bench_arm_mat_scale_q31(
+  const arm_bench_config * cfg)
+{
+  (void) cfg;
+  arm_mat_scale_q31(&matAQ31, 0x40000000, 0, &matDQ31);
+}
+
+static void bench_arm_mat_scale_q15(
+  const arm_bench_config * cfg)
+{
+  (void) cfg;
+  arm_mat_scale_q15(&matAQ15, 0x4000, 0, &matDQ15);
+}
+
+static void bench_arm_mat_inverse_f32(
+  const arm_bench_config * cfg)
+{
+  /* The inverse works in place on its source, so invert a copy */
+  (void) cfg;
+  arm_copy_f32(benchSrcA_f32, benchState_f32,
+               (uint32_t) matAF32.numRows * matAF32.numCols);
+  matBF32.numRows = matAF32.numRows;
+  matBF32.numCols = matAF32.numCols;
+  matBF32.pData = benchState_f32;
+  arm_mat_inverse_f32(&matBF32, &matDF32);
+  matBF32.pData = benchSrcB_f32;
+}
+
+/* The solvers factor a copy of A and solve for one right-hand side, the
+ * first column of B, so they compare with arm_mat_inverse_f32 above. */
+
+static uint32_t setup_matrix_spd(
+  const arm_bench_config * cfg)
+{
+  uint32_t samples = setup_matrix(cfg);
+  uint32_t n = matAF32.numRows;
+  uint32_t i, j;
+
+  /* A + A' + 2N * I is symmetric and diagonally dominant, so positive definite */
+  for (i = 0u; i < n; i++)
+  {
+    for (j = 0u; j < n; j++)
+    {
+      matSpd_f32[(i * n) + j] = benchSrcA_f32[(i * n) + j] + benchSrcA_f32[(j * n) + i] +
+        ((i == j) ? (2.0f * n) : 0.0f);
+    }
+  }
+
+  return (samples);
+}
+
+static void bench_arm_mat_lu_solve_f32(
+  const arm_bench_config * cfg)
+{
+  arm_matrix_instance_f32 LU, B, X;
+  uint16_t n = matAF32.numRows;
+
+  (void) cfg;
+  arm_copy_f32(benchSrcA_f32, benchState_f32, (uint32_t) n * n);
+  arm_mat_init_f32(&LU, n, n, benchState_f32);
+  arm_mat_init_f32(&B, n, 1u, benchSrcB_f32);
+  arm_mat_init_f32(&X, n, 1u, benchDst_f32);
+  arm_mat_lu_f32(&LU, matPerm);
+  arm_mat_lu_solve_f32(&LU, matPerm, &B, &X);
+}
+
+static void bench_arm_mat_ldlt_solve_f32(
+  const arm_bench_config * cfg)
+{
+  arm_matrix_instance_f32 LDLT, B, X;
+  uint16_t n = matAF32.numRows;
+
+  (void) cfg;
+  arm_copy_f32(matSpd_f32, benchState_f32, (uint32_t) n * n);
+  arm_mat_init_f32(&LDLT, n, n, benchState_f32);
+  arm_mat_init_f32(&B, n, 1u, benchSrcB_f32);
+  arm_mat_init_f32(&X, n, 1u, benchDst_f32);
+  arm_mat_ldlt_f32(&LDLT);
+  arm_mat_ldlt_solve_f32(&LDLT, &B, &X);
+}
+
+static void bench_arm_mat_qr_solve_f32(
+  const arm_bench_config * cfg)
+{
+  arm_matrix_instance_f32 QR, B, X;
+  uint16_t n = matAF32.numRows;
+
+  (void) cfg;
+  arm_copy_f32(benchSrcA_f32, benchState_f32, (uint32_t) n * n);
+  arm_mat_init_f32(&QR, n, n, benchState_f32);
+  arm_mat_init_f32(&B, n, 1u, benchSrcB_f32);
+  arm_mat_init_f32(&X, n, 1u, benchDst_f32);
+  arm_mat_qr_f32(&QR, matTau_f32);
+  arm_mat_qr_solve_f32(&QR, matTau_f32, &B, &X, matScratch_f32);
+}
+
+/* ----------------------------------------------------------------------
+** Matrix multiplication throughput on N x N operands, N = blockSize up to
+** BENCH_GEMM_MAX_N.  The sample count is the number of floating-point
+** operations, 2 * N^3, so Msamples/s reads as MFLOP/s.  The operands do not
+** fit the shared buffers and are allocated on first use.
+** ------------------------------------------------------------------- */
+
+#define BENCH_GEMM_MAX_N        1024u
+#define BENCH_GEMM_MAX_NAIVE_N  512u
+
+static uint32_t setup_gemm(
+  const arm_bench_config * cfg)
+{
+  uint32_t n = cfg->blockSize;
+  uint32_t i;
+
+  if(n > BENCH_GEMM_MAX_N)
+  {
+    return (0u);
+  }
+
+  if(gemmA_f32 == NULL)
+  {
+    gemmA_f32 = (float32_t *) malloc(BENCH_GEMM_MAX_N * BENCH_GEMM_MAX_N * sizeof(float32_t));
+    gemmB_f32 = (float32_t *) malloc(BENCH_GEMM_MAX_N * BENCH_GEMM_MAX_N * sizeof(float32_t));
+    gemmP_f32 = (float32_t *) malloc(ARM_MAT_PACKED_SIZE_F32(BENCH_GEMM_MAX_N, BENCH_GEMM_MAX_N) * sizeof(float32_t));
+    gemmD_f32 = (float32_t *) malloc(BENCH_GEMM_MAX_N * BENCH_GEMM_MAX_N * sizeof(float32_t));
+
+    if((gemmA_f32 == NULL) || (gemmB_f32 == NULL) || (gemmP_f32 == NULL) || (gemmD_f32 == NULL))
+    {
+      free(gemmA_f32);
+      free(gemmB_f32);
+      free(gemmP_f32);
+      free(gemmD_f32);
+      gemmA_f32 = NULL;
+      return (0u);
+    }
+
+    /* the shared inputs, repeated */
+    for (i = 0u; i < (BENCH_GEMM_MAX_N * BENCH_GEMM_MAX_N); i++)
+    {
+      gemmA_f32[i] = benchSrcA_f32[i % ARM_BENCH_BUF_LEN];
+      gemmB_f32[i] = benchSrcB_f32[i % ARM_BENCH_BUF_LEN];
+    }
+  }
+
+  arm_mat_init_f32(&gemmAF32, (uint16_t) n, (uint16_t) n, gemmA_f32);
+  arm_mat_init_f32(&gemmBF32, (uint16_t) n, (uint16_t) n, gemmB_f32);
+  arm_mat_init_f32(&gemmPF32, (uint16_t) n, (uint16_t) n, gemmP_f32);
+  arm_mat_init_f32(&gemmDF32, (uint16_t) n, (uint16_t) n, gemmD_f32);
+  arm_mat_pack_f32(&gemmBF32, gemmP_f32);
+
+  return (2u * n * n * n);
+}
+
+static uint32_t setup_gemm_naive(
+  const arm_bench_config * cfg)
+{
+  return ((cfg->blockSize > BENCH_GEMM_MAX_NAIVE_N) ? 0u : setup_gemm(cfg));
+}
+
+static void bench_arm_mat_mult_f32_flops(
+  const arm_bench_config * cfg)
+{
+  (void) cfg;
+  arm_mat_mult_f32(&gemmAF32, &gemmBF32, &gemmDF32);
+}
+
+static void bench_arm_mat_mult_packed_f32_flops(
+  const arm_bench_config * cfg)
+{
+  (void) cfg;
+  arm_mat_mult_packed_f32(&gemmAF32, &gemmPF32, &gemmDF32);
+}
+
+static void bench_arm_mat_mult_naive_f32_flops(
+  const arm_bench_config * cfg)
+{
+  /* The unblocked loop of the portable code, one dot product down a column of B per output */
+  const float32_t *pA = gemmA_f32;
+  float32_t *pOut = gemmD_f32;
+  float32_t sum;
+  uint32_t n = gemmAF32.numRows;
+  uint32_t row, col, k;
+
+  (void) cfg;
+
+  for (row = 0u; row < n; row++)
+  {
+    for (col = 0u; col < n; col++)
+    {
+      sum = 0.0f;
+
+      for (k = 0u; k < n; k++)
+      {
+        sum += pA[k] * gemmB_f32[(k * n) + col];
+      }
+
+      *pOut++ = sum;
+    }
+
+    pA += n;
+  }
+}
+
+const arm_bench_kernel armBenchMatrix[] = {
+  ARM_BENCH_ENTRY(arm_mat_add_f32, "Matrix", f32, 0u, setup_matrix),
+  ARM_BENCH_ENTRY(arm_mat_add_q31, "Matrix", q31, 0u, setup_matrix),
+  ARM_BENCH_ENTRY(arm_mat_add_q15, "Matrix", q15, 0u, setup_matrix),
+  ARM_BENCH_ENTRY(arm_mat_sub_f32, "Matrix", f32, 0u, setup_matrix),
+  ARM_BENCH_ENTRY(arm_mat_sub_q31, "Matrix", q31, 0u, setup_matrix),
+  ARM_BENCH_ENTRY(arm_mat_sub_q15, "Matrix", q15, 0u, setup_matrix),
+  ARM_BENCH_ENTRY(arm_mat_mult_f32, "Matrix", f32, 0u, setup_matrix),
+  ARM_BENCH_ENTRY(arm_mat_mult_packed_f32, "Matrix", f32, 0u, setup_matrix_packed),
+  ARM_BENCH_ENTRY(arm_mat_mult_q31, "Matrix", q31, 0u, setup_matrix),
+  ARM_BENCH_ENTRY(arm_mat_mult_fast_q31, "Matrix", q31, 0u, setup_matrix),
+  ARM_BENCH_ENTRY(arm_mat_mult_q15, "Matrix", q15, 0u, setup_matrix),
+  ARM_BENCH_ENTRY(arm_mat_mult_fast_q15, "Matrix", q15, 0u, setup_matrix),
+  ARM_BENCH_ENTRY(arm_mat_trans_f32, "Matrix", f32, 0u, setup_matrix),
+  ARM_BENCH_ENTRY(arm_mat_trans_q31, "Matrix", q31, 0u, setup_matrix),
+  ARM_BENCH_ENTRY(arm_mat_trans_q15, "Matrix", q15, 0u, setup_matrix),
+  ARM_BENCH_ENTRY(arm_mat_scale_f32, "Matrix", f32, 0u, setup_matrix),
+  ARM_BENCH_ENTRY(arm_mat_scale_q31, "Matrix", q31, 0u, setup_matrix),
+  ARM_BENCH_ENTRY(arm_mat_scale_q15, "Matrix", q15, 0u, setup_matrix),
+  ARM_BENCH_ENTRY(arm_mat_inverse_f32, "Matrix", f32, 0u, setup_matrix),
+  ARM_BENCH_ENTRY(arm_mat_lu_solve_f32, "Matrix", f32, 0u, setup_matrix),
+  ARM_BENCH_ENTRY(arm_mat_ldlt_solve_f32, "Matrix", f32, 0u, setup_matrix_spd),
+  ARM_BENCH_ENTRY(arm_mat_qr_solve_f32, "Matrix", f32, 0u, setup_matrix),
+  ARM_BENCH_ENTRY(arm_mat_mult_f32_flops, "MatrixFlops", f32, 0u, setup_gemm),
+  ARM_BENCH_ENTRY(arm_mat_mult_packed_f32_flops, "MatrixFlops", f32, 0u, setup_gemm),
+  ARM_BENCH_ENTRY(arm_mat_mult_naive_f32_flops, "MatrixFlops", f32, 0u, setup_gemm_naive),
+};
+
+const uint32_t armBenchMatrixCount =
+  sizeof(armBenchMatrix) / sizeof(armBenchMatrix[0]);
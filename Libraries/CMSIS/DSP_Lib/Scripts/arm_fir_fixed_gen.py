@@ -0,0 +1,398 @@
+#!/usr/bin/env python3
+# ----------------------------------------------------------------------
+# Copyright (C) 2010 ARM Limited. All rights reserved.
+#
+# Project:      CMSIS DSP Library
+# Title:        arm_fir_fixed_gen.py
+#
+# Description:  Generates FIR kernels specialized for fixed tap counts.
+#
+# Reads the (type, numTaps, blockSize) list of arm_fir_fixed.cfg and writes
+# arm_fir_fixed_f32.c, arm_fir_fixed_q31.c and arm_fir_fixed_q15.c to
+# Source/FilteringFunctions.  Every kernel has its tap loop fully unrolled
+# and computes 4 outputs at a time like the generic Cortex-M3/M4 code, with
+# the same arithmetic, so the outputs are bit exact with it.  The generic
+# functions call arm_fir_fixed_xxx() first and fall back to their own loops
+# when there is no kernel for the instance.
+#
+# Files are only rewritten when their contents change.
+#
+#   arm_fir_fixed_gen.py [CONFIG] [OUTDIR]
+# ----------------------------------------------------------------------
+
+import os
+import sys
+
+DIR = os.path.dirname(os.path.abspath(__file__))
+CONFIG = os.path.join(DIR, 'arm_fir_fixed.cfg')
+OUTDIR = os.path.join(DIR, '..', 'Source', 'FilteringFunctions')
+
+# kind: (file type, C type, instance type, generic function, description)
+KINDS = {
+    'f32':      ('f32', 'float32_t', 'arm_fir_instance_f32', 'arm_fir_f32', 'Floating-point'),
+    'q31':      ('q31', 'q31_t', 'arm_fir_instance_q31', 'arm_fir_q31', 'Q31'),
+    'q15':      ('q15', 'q15_t', 'arm_fir_instance_q15', 'arm_fir_q15', 'Q15'),
+    'fast_q15': ('q15', 'q15_t', 'arm_fir_instance_q15', 'arm_fir_fast_q15', 'Fast Q15'),
+}
+
+FILES = ['f32', 'q31', 'q15']
+
+
+def read_config(path):
+    entries = []
+    with open(path) as f:
+        for lineNo, line in enumerate(f, 1):
+            line = line.split('#', 1)[0].split()
+            if not line:
+                continue
+            if len(line) != 3 or line[0] not in KINDS:
+                sys.exit('%s:%d: expected "<%s> numTaps blockSize"' % (path, lineNo, '|'.join(KINDS)))
+            kind, numTaps, blockSize = line[0], int(line[1]), int(line[2])
+            if numTaps < 1 or numTaps > 65535 or blockSize < 0:
+                sys.exit('%s:%d: numTaps must be 1..65535 and blockSize >= 0' % (path, lineNo))
+            if KINDS[kind][0] == 'q15' and ((numTaps % 2) != 0 or numTaps < 4):
+                sys.exit('%s:%d: the Q15 filters need an even number of taps, at least 4' % (path, lineNo))
+            if (kind, numTaps, blockSize) not in entries:
+                entries.append((kind, numTaps, blockSize))
+    return entries
+
+
+def kernel_name(kind, numTaps, blockSize):
+    name = '%s_%d' % (KINDS[kind][3], numTaps)
+    if blockSize:
+        name += 'x%d' % blockSize
+    return name
+
+
+class Writer:
+    def __init__(self):
+        self.lines = []
+
+    def __call__(self, indent, text=''):
+        self.lines.append(('  ' * indent + text) if text else '')
+
+
+# ----------------------------------------------------------------------
+# Multiply-accumulates of one group of 4 outputs and of one single output.
+# pState points to the oldest sample of the first output.
+# ----------------------------------------------------------------------
+
+def mac4_float(w, ind, numTaps, fmt):
+    """f32 and q31: one coefficient per tap, x0..x3 rotate as in arm_fir_f32()."""
+    x = ['x0', 'x1', 'x2', 'x3']
+    w(ind, 'x0 = pState[0];')
+    w(ind, 'x1 = pState[1];')
+    w(ind, 'x2 = pState[2];')
+    w(ind)
+    for k in range(numTaps):
+        w(ind, 'c0 = pCoeffs[%du];' % k)
+        w(ind, '%s = pState[%du];' % (x[(k + 3) % 4], k + 3))
+        for a in range(4):
+            w(ind, fmt % (a, x[(k + a) % 4]))
+        w(ind)
+
+
+def mac1_float(w, ind, numTaps, fmt1):
+    for k in range(numTaps):
+        w(ind, fmt1 % (k, k))
+
+
+def mac4_q15(w, ind, numTaps, mac):
+    """q15: one coefficient pair per 2 taps, as in arm_fir_q15() and arm_fir_fast_q15()."""
+    w(ind, 'x0 = *(q31_t *) (pState + 0);')
+    w(ind, 'x1 = *(q31_t *) (pState + 1);')
+    w(ind)
+    for p in range(numTaps // 2):
+        a, b = ('x0', 'x1') if (p % 2) == 0 else ('x2', 'x3')
+        c, d = ('x2', 'x3') if (p % 2) == 0 else ('x0', 'x1')
+        w(ind, 'c0 = pb[%du];' % p)
+        w(ind, '%s = *(q31_t *) (pState + %d);' % (c, 2 * p + 2))
+        w(ind, '%s = *(q31_t *) (pState + %d);' % (d, 2 * p + 3))
+        for acc, xv in (('acc0', a), ('acc1', b), ('acc2', c), ('acc3', d)):
+            w(ind, '%s = %s(%s, c0, %s);' % (acc, mac, xv, acc))
+        w(ind)
+
+
+def mac1_q15(w, ind, numTaps, mac):
+    for p in range(numTaps // 2):
+        w(ind, 'acc0 = %s(*(q31_t *) (pState + %d), pb[%du], acc0);' % (mac, 2 * p, p))
+
+
+# ----------------------------------------------------------------------
+# One kernel
+# ----------------------------------------------------------------------
+
+def emit_kernel(w, kind, numTaps, blockSize):
+    ftype, ctype, inst, generic, desc = KINDS[kind]
+    name = kernel_name(kind, numTaps, blockSize)
+    q15 = (ftype == 'q15')
+
+    if blockSize:
+        w(0, '/**')
+        w(0, ' * @brief %s FIR filter for numTaps = %d and blockSize = %d.' % (desc, numTaps, blockSize))
+        w(0, ' */')
+    else:
+        w(0, '/**')
+        w(0, ' * @brief %s FIR filter for numTaps = %d.' % (desc, numTaps))
+        w(0, ' */')
+    w(0)
+    w(0, 'static void %s(' % name)
+    w(0, '  const %s * S,' % inst)
+    w(0, '  %s * pSrc,' % ctype)
+    if blockSize:
+        w(0, '  %s * pDst)' % ctype)
+    else:
+        w(0, '  %s * pDst,' % ctype)
+        w(0, '  uint32_t blockSize)')
+    w(0, '{')
+    w(1, '%-46s /* State pointer */' % ('%s *pState = S->pState;' % ctype))
+    if q15:
+        w(1, '%-46s /* Coefficient pairs */' % 'q31_t *pb = (q31_t *) S->pCoeffs;')
+    else:
+        w(1, '%-46s /* Coefficient pointer */' % ('%s *pCoeffs = S->pCoeffs;' % ctype))
+    w(1, '%-46s /* Points to the current sample of the state */' % ('%s *pStateCurnt;' % ctype))
+    if q15:
+        w(1, '%-46s /* State and coefficient pairs */' % 'q31_t x0, x1, x2, x3, c0;')
+        acc = 'q31_t' if kind == 'fast_q15' else 'q63_t'
+    else:
+        w(1, '%-46s /* State and coefficient values */' % ('%s x0, x1, x2, x3, c0;' % ctype))
+        acc = 'float32_t' if ftype == 'f32' else 'q63_t'
+    w(1, '%-46s /* Accumulators */' % ('%s acc0, acc1, acc2, acc3;' % acc))
+    w(1, '%-46s /* Loop counter */' % 'uint32_t blkCnt;')
+    w(0)
+    w(1, '/* pStateCurnt points to the location where the new input data should be written */')
+    w(1, 'pStateCurnt = &(S->pState[%du]);' % (numTaps - 1))
+    w(0)
+    w(1, '/* Compute 4 outputs at a time */')
+    w(1, 'blkCnt = %s;' % (('%du' % (blockSize // 4)) if blockSize else 'blockSize >> 2u'))
+    w(0)
+    w(1, 'while(blkCnt > 0u)')
+    w(1, '{')
+    if q15:
+        w(2, '/* Copy four new input samples into the state buffer */')
+        w(2, '*__SIMD32(pStateCurnt)++ = *__SIMD32(pSrc)++;')
+        w(2, '*__SIMD32(pStateCurnt)++ = *__SIMD32(pSrc)++;')
+    else:
+        w(2, '/* Copy four new input samples into the state buffer */')
+        for i in range(4):
+            w(2, '*pStateCurnt++ = *pSrc++;')
+    w(0)
+    zero = '0.0f' if ftype == 'f32' else '0'
+    for a in range(4):
+        w(2, 'acc%d = %s;' % (a, zero))
+    w(0)
+    if ftype == 'f32':
+        mac4_float(w, 2, numTaps, 'acc%d += %s * c0;')
+    elif ftype == 'q31':
+        mac4_float(w, 2, numTaps, 'acc%d += (q63_t) %s * c0;')
+    else:
+        mac4_q15(w, 2, numTaps, '__SMLAD' if kind == 'fast_q15' else '__SMLALD')
+
+    w(2, '/* Store the 4 outputs */')
+    if ftype == 'f32':
+        for a in range(4):
+            w(2, '*pDst++ = acc%d;' % a)
+    elif ftype == 'q31':
+        for a in range(4):
+            w(2, '*pDst++ = (q31_t) (acc%d >> 31u);' % a)
+    else:
+        if kind == 'fast_q15':
+            sat = '(acc%d >> 15)'
+        else:
+            sat = '__SSAT((acc%d >> 15), 16)'
+        w(0, '#ifndef ARM_MATH_BIG_ENDIAN')
+        w(0)
+        w(2, '*__SIMD32(pDst)++ = __PKHBT(%s, %s, 16);' % (sat % 0, sat % 1))
+        w(2, '*__SIMD32(pDst)++ = __PKHBT(%s, %s, 16);' % (sat % 2, sat % 3))
+        w(0)
+        w(0, '#else')
+        w(0)
+        w(2, '*__SIMD32(pDst)++ = __PKHBT(%s, %s, 16);' % (sat % 1, sat % 0))
+        w(2, '*__SIMD32(pDst)++ = __PKHBT(%s, %s, 16);' % (sat % 3, sat % 2))
+        w(0)
+        w(0, '#endif /* #ifndef ARM_MATH_BIG_ENDIAN */')
+    w(0)
+    w(2, 'pState = pState + 4;')
+    w(0)
+    w(2, 'blkCnt--;')
+    w(1, '}')
+    w(0)
+
+    if (not blockSize) or (blockSize % 4):
+        w(1, '/* Compute the remaining 1 to 3 outputs */')
+        w(1, 'blkCnt = %s;' % (('%du' % (blockSize % 4)) if blockSize else 'blockSize % 0x4u'))
+        w(0)
+        w(1, 'while(blkCnt > 0u)')
+        w(1, '{')
+        w(2, '*pStateCurnt++ = *pSrc++;')
+        w(0)
+        w(2, 'acc0 = %s;' % zero)
+        w(0)
+        if ftype == 'f32':
+            mac1_float(w, 2, numTaps, 'acc0 += pState[%du] * pCoeffs[%du];')
+        elif ftype == 'q31':
+            mac1_float(w, 2, numTaps, 'acc0 += (q63_t) pState[%du] * pCoeffs[%du];')
+        else:
+            mac1_q15(w, 2, numTaps, '__SMLAD' if kind == 'fast_q15' else '__SMLALD')
+        w(0)
+        if ftype == 'f32':
+            w(2, '*pDst++ = acc0;')
+        elif ftype == 'q31':
+            w(2, '*pDst++ = (q31_t) (acc0 >> 31u);')
+        elif kind == 'fast_q15':
+            w(2, '*pDst++ = (q15_t) (acc0 >> 15);')
+        else:
+            w(2, '*pDst++ = (q15_t) (__SSAT((acc0 >> 15), 16));')
+        w(0)
+        w(2, 'pState = pState + 1;')
+        w(0)
+        w(2, 'blkCnt--;')
+        w(1, '}')
+        w(0)
+
+    w(1, '/* Copy the last %d samples to the start of the state buffer */' % (numTaps - 1))
+    w(1, 'pStateCurnt = S->pState;')
+    if numTaps > 1:
+        w(0)
+    if q15:
+        for i in range((numTaps - 1) // 2):
+            w(1, '*(q31_t *) (pStateCurnt + %d) = *(q31_t *) (pState + %d);' % (2 * i, 2 * i))
+        if (numTaps - 1) % 2:
+            w(1, 'pStateCurnt[%du] = pState[%du];' % (numTaps - 2, numTaps - 2))
+    else:
+        for i in range(numTaps - 1):
+            w(1, 'pStateCurnt[%du] = pState[%du];' % (i, i))
+    w(0, '}')
+    w(0)
+
+
+# ----------------------------------------------------------------------
+# One file per data type
+# ----------------------------------------------------------------------
+
+def emit_unused(w, why):
+    # Without a kernel the dispatcher reads none of its arguments
+    w(1, '/* No kernel is generated %s */' % why)
+    for arg in ('S', 'pSrc', 'pDst', 'blockSize'):
+        w(1, '(void) %s;' % arg)
+
+
+def emit_dispatch(w, kind, entries):
+    ftype, ctype, inst, generic, desc = KINDS[kind]
+    w(0, '/**')
+    w(0, ' * @brief Runs the generated kernel of <code>%s()</code> for this instance, if any.' % generic)
+    w(0, ' * @param[in]  *S points to an instance of the %s FIR filter structure.' % KINDS[kind][4].replace('Fast ', ''))
+    w(0, ' * @param[in]  *pSrc points to the block of input data.')
+    w(0, ' * @param[out] *pDst points to the block of output data.')
+    w(0, ' * @param[in]  blockSize number of samples to process per call.')
+    w(0, ' * @return     ARM_MATH_SUCCESS if a kernel processed the block, ARM_MATH_ARGUMENT_ERROR if')
+    w(0, ' * there is none for <code>numTaps</code> and <code>blockSize</code>.  Nothing is done then.')
+    w(0, ' */')
+    w(0)
+    w(0, 'arm_status arm_fir_fixed_%s(' % kind)
+    w(0, '  const %s * S,' % inst)
+    w(0, '  %s * pSrc,' % ctype)
+    w(0, '  %s * pDst,' % ctype)
+    w(0, '  uint32_t blockSize)')
+    w(0, '{')
+    ents = [e for e in entries if e[0] == kind]
+    # Kernels for one block size take precedence over those for any block size
+    ents.sort(key=lambda e: (e[2] == 0, e[1], e[2]))
+    if ents:
+        w(0, '#ifndef ARM_MATH_CM0')
+        w(0)
+        for (_, numTaps, blockSize) in ents:
+            name = kernel_name(kind, numTaps, blockSize)
+            if blockSize:
+                w(1, 'if((S->numTaps == %du) && (blockSize == %du))' % (numTaps, blockSize))
+                w(1, '{')
+                w(2, '%s(S, pSrc, pDst);' % name)
+            else:
+                w(1, 'if(S->numTaps == %du)' % numTaps)
+                w(1, '{')
+                w(2, '%s(S, pSrc, pDst, blockSize);' % name)
+            w(2, 'return (ARM_MATH_SUCCESS);')
+            w(1, '}')
+            w(0)
+        w(0, '#else')
+        w(0)
+        emit_unused(w, 'for Cortex-M0')
+        w(0)
+        w(0, '#endif /* #ifndef ARM_MATH_CM0 */')
+        w(0)
+    else:
+        emit_unused(w, 'for this type')
+        w(0)
+    w(1, 'return (ARM_MATH_ARGUMENT_ERROR);')
+    w(0, '}')
+    w(0)
+
+
+def emit_file(ftype, entries):
+    w = Writer()
+    kinds = [k for k in KINDS if KINDS[k][0] == ftype]
+    desc = KINDS[kinds[0]][4]
+    w(0, '/* ----------------------------------------------------------------------')
+    w(0, '* Copyright (C) 2010 ARM Limited. All rights reserved.')
+    w(0, '*')
+    w(0, '* Project: \t    CMSIS DSP Library')
+    w(0, '* Title:\t    arm_fir_fixed_%s.c' % ftype)
+    w(0, '*')
+    w(0, '* Description:\t%s FIR kernels specialized for fixed tap counts.' % desc)
+    w(0, '*')
+    w(0, '*               GENERATED by Scripts/arm_fir_fixed_gen.py from')
+    w(0, '*               Scripts/arm_fir_fixed.cfg.  Do not edit.')
+    w(0, '*')
+    w(0, '* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0')
+    w(0, '* -------------------------------------------------------------------- */')
+    w(0)
+    w(0, '#include "arm_math.h"')
+    w(0)
+    w(0, '/**')
+    w(0, ' * @ingroup groupFilters')
+    w(0, ' */')
+    w(0)
+    w(0, '/**')
+    w(0, ' * @addtogroup FIR')
+    w(0, ' * @{')
+    w(0, ' */')
+    w(0)
+    ents = [e for e in entries if KINDS[e[0]][0] == ftype]
+    if ents:
+        w(0, '#ifndef ARM_MATH_CM0')
+        w(0)
+        w(0, '/* Run the below code for Cortex-M4 and Cortex-M3 */')
+        w(0)
+        for e in ents:
+            emit_kernel(w, *e)
+        w(0, '#endif /* #ifndef ARM_MATH_CM0 */')
+        w(0)
+    for k in kinds:
+        emit_dispatch(w, k, entries)
+    w(0, '/**')
+    w(0, ' * @} end of FIR group')
+    w(0, ' */')
+    return '\r\n'.join(w.lines) + '\r\n'
+
+
+def main():
+    config = sys.argv[1] if len(sys.argv) > 1 else CONFIG
+    outdir = sys.argv[2] if len(sys.argv) > 2 else OUTDIR
+    entries = read_config(config)
+
+    for ftype in FILES:
+        path = os.path.join(outdir, 'arm_fir_fixed_%s.c' % ftype)
+        text = emit_file(ftype, entries).encode('ascii')
+        try:
+            with open(path, 'rb') as f:
+                if f.read() == text:
+                    continue
+        except IOError:
+            pass
+        with open(path, 'wb') as f:
+            f.write(text)
+        print('arm_fir_fixed_gen.py: wrote %s' % path)
+
+
+if __name__ == '__main__':
+    main()
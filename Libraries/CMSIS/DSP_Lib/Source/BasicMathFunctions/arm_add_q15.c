@@ -102,11 +102,52 @@ void arm_add_q15(
 
   /* Run the below code for Cortex-M0 */
 
+#if defined (ARM_MATH_SSE2)
 
+  /* Host build: saturating add of 8 samples per SSE2 operation */
+  blkCnt = blockSize >> 3u;
+
+  while(blkCnt > 0u)
+  {
+    _mm_storeu_si128((__m128i *) pDst,
+                     _mm_adds_epi16(_mm_loadu_si128((__m128i *) pSrcA), _mm_loadu_si128((__m128i *) pSrcB)));
+    pSrcA += 8u;
+    pSrcB += 8u;
+    pDst += 8u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Compute the remaining 1 to 7 samples below */
+  blkCnt = blockSize % 0x8u;
+
+#elif defined (ARM_MATH_NEON)
+
+  /* Host build: saturating add of 8 samples per NEON operation */
+  blkCnt = blockSize >> 3u;
+
+  while(blkCnt > 0u)
+  {
+    vst1q_s16(pDst, vqaddq_s16(vld1q_s16(pSrcA), vld1q_s16(pSrcB)));
+    pSrcA += 8u;
+    pSrcB += 8u;
+    pDst += 8u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Compute the remaining 1 to 7 samples below */
+  blkCnt = blockSize % 0x8u;
+
+#else
 
   /* Initialize blkCnt with number of samples */
   blkCnt = blockSize;
 
+#endif /* #if defined (ARM_MATH_SSE2) */
+
   while(blkCnt > 0u)
   {
     /* C = A + B */
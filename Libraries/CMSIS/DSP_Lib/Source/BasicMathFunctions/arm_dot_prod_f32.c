@@ -98,9 +98,94 @@ void arm_dot_prod_f32(
 
   /* Run the below code for Cortex-M0 */
 
+#if defined (ARM_MATH_AVX2)
+
+  /* Host build: accumulate 8 samples per AVX2 operation */
+  {
+    __m256 vSum8 = _mm256_setzero_ps();
+    __m128 vSum;
+
+    blkCnt = blockSize >> 3u;
+
+    while(blkCnt > 0u)
+    {
+      vSum8 = _mm256_add_ps(vSum8, _mm256_mul_ps(_mm256_loadu_ps(pSrcA), _mm256_loadu_ps(pSrcB)));
+      pSrcA += 8u;
+      pSrcB += 8u;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Fold the 8 partial sums and add them to sum */
+    vSum = _mm_add_ps(_mm256_castps256_ps128(vSum8), _mm256_extractf128_ps(vSum8, 1));
+    vSum = _mm_add_ps(vSum, _mm_movehl_ps(vSum, vSum));
+    vSum = _mm_add_ss(vSum, _mm_shuffle_ps(vSum, vSum, 0x55));
+    sum = _mm_cvtss_f32(vSum);
+  }
+
+  /* Compute the remaining 1 to 7 samples below */
+  blkCnt = blockSize % 0x8u;
+
+#elif defined (ARM_MATH_SSE2)
+
+  /* Host build: accumulate 4 samples per SSE2 operation */
+  {
+    __m128 vSum = _mm_setzero_ps();
+
+    blkCnt = blockSize >> 2u;
+
+    while(blkCnt > 0u)
+    {
+      vSum = _mm_add_ps(vSum, _mm_mul_ps(_mm_loadu_ps(pSrcA), _mm_loadu_ps(pSrcB)));
+      pSrcA += 4u;
+      pSrcB += 4u;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Add the 4 partial sums */
+    vSum = _mm_add_ps(vSum, _mm_movehl_ps(vSum, vSum));
+    vSum = _mm_add_ss(vSum, _mm_shuffle_ps(vSum, vSum, 0x55));
+    sum = _mm_cvtss_f32(vSum);
+  }
+
+  /* Compute the remaining 1 to 3 samples below */
+  blkCnt = blockSize % 0x4u;
+
+#elif defined (ARM_MATH_NEON)
+
+  /* Host build: accumulate 4 samples per NEON operation */
+  {
+    float32x4_t vSum = vdupq_n_f32(0.0f);
+
+    blkCnt = blockSize >> 2u;
+
+    while(blkCnt > 0u)
+    {
+      vSum = vmlaq_f32(vSum, vld1q_f32(pSrcA), vld1q_f32(pSrcB));
+      pSrcA += 4u;
+      pSrcB += 4u;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Add the 4 partial sums */
+    sum = vaddvq_f32(vSum);
+  }
+
+  /* Compute the remaining 1 to 3 samples below */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
   /* Initialize blkCnt with number of samples */
   blkCnt = blockSize;
 
+#endif /* #if defined (ARM_MATH_AVX2) */
+
 #endif /* #ifndef ARM_MATH_CM0 */
 
 
@@ -112,9 +112,49 @@ void arm_scale_f32(
 
   /* Run the below code for Cortex-M0 */
 
+#if defined (ARM_MATH_SSE2)
+
+  /* Host build: scale 4 samples per SSE2 operation */
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    _mm_storeu_ps(pDst, _mm_mul_ps(_mm_loadu_ps(pSrc), _mm_set1_ps(scale)));
+    pSrc += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Compute the remaining 1 to 3 samples below */
+  blkCnt = blockSize % 0x4u;
+
+#elif defined (ARM_MATH_NEON)
+
+  /* Host build: scale 4 samples per NEON operation */
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    vst1q_f32(pDst, vmulq_n_f32(vld1q_f32(pSrc), scale));
+    pSrc += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Compute the remaining 1 to 3 samples below */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
   /* Initialize blkCnt with number of samples */
   blkCnt = blockSize;
 
+#endif /* #if defined (ARM_MATH_SSE2) */
+
 #endif /* #ifndef ARM_MATH_CM0 */
 
   while(blkCnt > 0u)
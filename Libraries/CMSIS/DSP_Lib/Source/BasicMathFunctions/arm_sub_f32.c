@@ -100,9 +100,51 @@ void arm_sub_f32(
 
   /* Run the below code for Cortex-M0 */
 
+#if defined (ARM_MATH_SSE2)
+
+  /* Host build: subtract 4 samples per SSE2 operation */
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    _mm_storeu_ps(pDst, _mm_sub_ps(_mm_loadu_ps(pSrcA), _mm_loadu_ps(pSrcB)));
+    pSrcA += 4u;
+    pSrcB += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Compute the remaining 1 to 3 samples below */
+  blkCnt = blockSize % 0x4u;
+
+#elif defined (ARM_MATH_NEON)
+
+  /* Host build: subtract 4 samples per NEON operation */
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    vst1q_f32(pDst, vsubq_f32(vld1q_f32(pSrcA), vld1q_f32(pSrcB)));
+    pSrcA += 4u;
+    pSrcB += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Compute the remaining 1 to 3 samples below */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
   /* Initialize blkCnt with number of samples */
   blkCnt = blockSize;
 
+#endif /* #if defined (ARM_MATH_SSE2) */
+
 #endif /* #ifndef ARM_MATH_CM0 */
 
 
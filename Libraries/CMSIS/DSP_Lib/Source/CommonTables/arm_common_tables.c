@@ -142,3 +142,404 @@ const q31_t armRecipTableQ31[64] = {
   0x4521CCE1, 0x448DB244, 0x43FC0CFA, 0x436CCD78, 0x42DFE4B4, 0x42554426,
   0x41CCDDB6, 0x4146A3C6, 0x40C28923, 0x40408102
 };
+
+/**   
+ * @ingroup groupFastMath   
+ */
+
+/**   
+ * @addtogroup sin   
+ * @{   
+ */
+
+/**  
+ * \par   
+ * Example code for Generation of Floating-point Sin Table:  
+ * tableSize = 256;   
+ * <pre>for(n = -1; n < (tableSize + 1); n++)   
+ * {   
+ *	sinTable[n+1]=sin(2*pi*n/tableSize);   
+ * }</pre>   
+ * \par   
+ * where pi value is  3.14159265358979   
+ */
+const float32_t sinTable_f32[259] = {
+  -0.024541229009628296f, 0.000000000000000000f, 0.024541229009628296f,
+  0.049067676067352295f, 0.073564566671848297f, 0.098017141222953796f,
+  0.122410677373409270f, 0.146730467677116390f,
+  0.170961886644363400f, 0.195090323686599730f, 0.219101235270500180f,
+  0.242980182170867920f, 0.266712754964828490f, 0.290284663438797000f,
+  0.313681751489639280f, 0.336889863014221190f,
+  0.359895050525665280f, 0.382683426141738890f, 0.405241310596466060f,
+  0.427555084228515630f, 0.449611335992813110f, 0.471396744251251220f,
+  0.492898195981979370f, 0.514102756977081300f,
+  0.534997642040252690f, 0.555570244789123540f, 0.575808167457580570f,
+  0.595699310302734380f, 0.615231573581695560f, 0.634393274784088130f,
+  0.653172850608825680f, 0.671558976173400880f,
+  0.689540565013885500f, 0.707106769084930420f, 0.724247097969055180f,
+  0.740951120853424070f, 0.757208824157714840f, 0.773010432720184330f,
+  0.788346409797668460f, 0.803207516670227050f,
+  0.817584812641143800f, 0.831469595432281490f, 0.844853579998016360f,
+  0.857728600502014160f, 0.870086967945098880f, 0.881921291351318360f,
+  0.893224298954010010f, 0.903989315032958980f,
+  0.914209783077239990f, 0.923879504203796390f, 0.932992815971374510f,
+  0.941544055938720700f, 0.949528157711029050f, 0.956940352916717530f,
+  0.963776051998138430f, 0.970031261444091800f,
+  0.975702106952667240f, 0.980785250663757320f, 0.985277652740478520f,
+  0.989176511764526370f, 0.992479562759399410f, 0.995184719562530520f,
+  0.997290432453155520f, 0.998795449733734130f,
+  0.999698817729949950f, 1.000000000000000000f, 0.999698817729949950f,
+  0.998795449733734130f, 0.997290432453155520f, 0.995184719562530520f,
+  0.992479562759399410f, 0.989176511764526370f,
+  0.985277652740478520f, 0.980785250663757320f, 0.975702106952667240f,
+  0.970031261444091800f, 0.963776051998138430f, 0.956940352916717530f,
+  0.949528157711029050f, 0.941544055938720700f,
+  0.932992815971374510f, 0.923879504203796390f, 0.914209783077239990f,
+  0.903989315032958980f, 0.893224298954010010f, 0.881921291351318360f,
+  0.870086967945098880f, 0.857728600502014160f,
+  0.844853579998016360f, 0.831469595432281490f, 0.817584812641143800f,
+  0.803207516670227050f, 0.788346409797668460f, 0.773010432720184330f,
+  0.757208824157714840f, 0.740951120853424070f,
+  0.724247097969055180f, 0.707106769084930420f, 0.689540565013885500f,
+  0.671558976173400880f, 0.653172850608825680f, 0.634393274784088130f,
+  0.615231573581695560f, 0.595699310302734380f,
+  0.575808167457580570f, 0.555570244789123540f, 0.534997642040252690f,
+  0.514102756977081300f, 0.492898195981979370f, 0.471396744251251220f,
+  0.449611335992813110f, 0.427555084228515630f,
+  0.405241310596466060f, 0.382683426141738890f, 0.359895050525665280f,
+  0.336889863014221190f, 0.313681751489639280f, 0.290284663438797000f,
+  0.266712754964828490f, 0.242980182170867920f,
+  0.219101235270500180f, 0.195090323686599730f, 0.170961886644363400f,
+  0.146730467677116390f, 0.122410677373409270f, 0.098017141222953796f,
+  0.073564566671848297f, 0.049067676067352295f,
+  0.024541229009628296f, 0.000000000000000122f, -0.024541229009628296f,
+  -0.049067676067352295f, -0.073564566671848297f, -0.098017141222953796f,
+  -0.122410677373409270f, -0.146730467677116390f,
+  -0.170961886644363400f, -0.195090323686599730f, -0.219101235270500180f,
+  -0.242980182170867920f, -0.266712754964828490f, -0.290284663438797000f,
+  -0.313681751489639280f, -0.336889863014221190f,
+  -0.359895050525665280f, -0.382683426141738890f, -0.405241310596466060f,
+  -0.427555084228515630f, -0.449611335992813110f, -0.471396744251251220f,
+  -0.492898195981979370f, -0.514102756977081300f,
+  -0.534997642040252690f, -0.555570244789123540f, -0.575808167457580570f,
+  -0.595699310302734380f, -0.615231573581695560f, -0.634393274784088130f,
+  -0.653172850608825680f, -0.671558976173400880f,
+  -0.689540565013885500f, -0.707106769084930420f, -0.724247097969055180f,
+  -0.740951120853424070f, -0.757208824157714840f, -0.773010432720184330f,
+  -0.788346409797668460f, -0.803207516670227050f,
+  -0.817584812641143800f, -0.831469595432281490f, -0.844853579998016360f,
+  -0.857728600502014160f, -0.870086967945098880f, -0.881921291351318360f,
+  -0.893224298954010010f, -0.903989315032958980f,
+  -0.914209783077239990f, -0.923879504203796390f, -0.932992815971374510f,
+  -0.941544055938720700f, -0.949528157711029050f, -0.956940352916717530f,
+  -0.963776051998138430f, -0.970031261444091800f,
+  -0.975702106952667240f, -0.980785250663757320f, -0.985277652740478520f,
+  -0.989176511764526370f, -0.992479562759399410f, -0.995184719562530520f,
+  -0.997290432453155520f, -0.998795449733734130f,
+  -0.999698817729949950f, -1.000000000000000000f, -0.999698817729949950f,
+  -0.998795449733734130f, -0.997290432453155520f, -0.995184719562530520f,
+  -0.992479562759399410f, -0.989176511764526370f,
+  -0.985277652740478520f, -0.980785250663757320f, -0.975702106952667240f,
+  -0.970031261444091800f, -0.963776051998138430f, -0.956940352916717530f,
+  -0.949528157711029050f, -0.941544055938720700f,
+  -0.932992815971374510f, -0.923879504203796390f, -0.914209783077239990f,
+  -0.903989315032958980f, -0.893224298954010010f, -0.881921291351318360f,
+  -0.870086967945098880f, -0.857728600502014160f,
+  -0.844853579998016360f, -0.831469595432281490f, -0.817584812641143800f,
+  -0.803207516670227050f, -0.788346409797668460f, -0.773010432720184330f,
+  -0.757208824157714840f, -0.740951120853424070f,
+  -0.724247097969055180f, -0.707106769084930420f, -0.689540565013885500f,
+  -0.671558976173400880f, -0.653172850608825680f, -0.634393274784088130f,
+  -0.615231573581695560f, -0.595699310302734380f,
+  -0.575808167457580570f, -0.555570244789123540f, -0.534997642040252690f,
+  -0.514102756977081300f, -0.492898195981979370f, -0.471396744251251220f,
+  -0.449611335992813110f, -0.427555084228515630f,
+  -0.405241310596466060f, -0.382683426141738890f, -0.359895050525665280f,
+  -0.336889863014221190f, -0.313681751489639280f, -0.290284663438797000f,
+  -0.266712754964828490f, -0.242980182170867920f,
+  -0.219101235270500180f, -0.195090323686599730f, -0.170961886644363400f,
+  -0.146730467677116390f, -0.122410677373409270f, -0.098017141222953796f,
+  -0.073564566671848297f, -0.049067676067352295f,
+  -0.024541229009628296f, -0.000000000000000245f, 0.024541229009628296f
+};
+
+/**  
+ * \par   
+ * Tables generated are in Q31(1.31 Fixed point format)   
+ * Generation of sin values in floating point:   
+ * <pre>tableSize = 256;     
+ * for(n = -1; n < (tableSize + 1); n++)   
+ * {   
+ *	sinTable[n+1]= sin(2*pi*n/tableSize);   
+ * } </pre>   
+ * where pi value is  3.14159265358979   
+ * \par   
+ * Convert Floating point to Q31(Fixed point):   
+ *	(sinTable[i] * pow(2, 31))   
+ * \par   
+ * rounding to nearest integer is done   
+ * 	sinTable[i] += (sinTable[i] > 0 ? 0.5 :-0.5);   
+ */
+const q31_t sinTable_q31[259] = {
+  0xfcdbd541, 0x0, 0x3242abf, 0x647d97c, 0x96a9049, 0xc8bd35e, 0xfab272b,
+  0x12c8106f,
+  0x15e21445, 0x18f8b83c, 0x1c0b826a, 0x1f19f97b, 0x2223a4c5, 0x25280c5e,
+  0x2826b928, 0x2b1f34eb,
+  0x2e110a62, 0x30fbc54d, 0x33def287, 0x36ba2014, 0x398cdd32, 0x3c56ba70,
+  0x3f1749b8, 0x41ce1e65,
+  0x447acd50, 0x471cece7, 0x49b41533, 0x4c3fdff4, 0x4ebfe8a5, 0x5133cc94,
+  0x539b2af0, 0x55f5a4d2,
+  0x5842dd54, 0x5a82799a, 0x5cb420e0, 0x5ed77c8a, 0x60ec3830, 0x62f201ac,
+  0x64e88926, 0x66cf8120,
+  0x68a69e81, 0x6a6d98a4, 0x6c242960, 0x6dca0d14, 0x6f5f02b2, 0x70e2cbc6,
+  0x72552c85, 0x73b5ebd1,
+  0x7504d345, 0x7641af3d, 0x776c4edb, 0x78848414, 0x798a23b1, 0x7a7d055b,
+  0x7b5d039e, 0x7c29fbee,
+  0x7ce3ceb2, 0x7d8a5f40, 0x7e1d93ea, 0x7e9d55fc, 0x7f0991c4, 0x7f62368f,
+  0x7fa736b4, 0x7fd8878e,
+  0x7ff62182, 0x7fffffff, 0x7ff62182, 0x7fd8878e, 0x7fa736b4, 0x7f62368f,
+  0x7f0991c4, 0x7e9d55fc,
+  0x7e1d93ea, 0x7d8a5f40, 0x7ce3ceb2, 0x7c29fbee, 0x7b5d039e, 0x7a7d055b,
+  0x798a23b1, 0x78848414,
+  0x776c4edb, 0x7641af3d, 0x7504d345, 0x73b5ebd1, 0x72552c85, 0x70e2cbc6,
+  0x6f5f02b2, 0x6dca0d14,
+  0x6c242960, 0x6a6d98a4, 0x68a69e81, 0x66cf8120, 0x64e88926, 0x62f201ac,
+  0x60ec3830, 0x5ed77c8a,
+  0x5cb420e0, 0x5a82799a, 0x5842dd54, 0x55f5a4d2, 0x539b2af0, 0x5133cc94,
+  0x4ebfe8a5, 0x4c3fdff4,
+  0x49b41533, 0x471cece7, 0x447acd50, 0x41ce1e65, 0x3f1749b8, 0x3c56ba70,
+  0x398cdd32, 0x36ba2014,
+  0x33def287, 0x30fbc54d, 0x2e110a62, 0x2b1f34eb, 0x2826b928, 0x25280c5e,
+  0x2223a4c5, 0x1f19f97b,
+  0x1c0b826a, 0x18f8b83c, 0x15e21445, 0x12c8106f, 0xfab272b, 0xc8bd35e,
+  0x96a9049, 0x647d97c,
+  0x3242abf, 0x0, 0xfcdbd541, 0xf9b82684, 0xf6956fb7, 0xf3742ca2, 0xf054d8d5,
+  0xed37ef91,
+  0xea1debbb, 0xe70747c4, 0xe3f47d96, 0xe0e60685, 0xdddc5b3b, 0xdad7f3a2,
+  0xd7d946d8, 0xd4e0cb15,
+  0xd1eef59e, 0xcf043ab3, 0xcc210d79, 0xc945dfec, 0xc67322ce, 0xc3a94590,
+  0xc0e8b648, 0xbe31e19b,
+  0xbb8532b0, 0xb8e31319, 0xb64beacd, 0xb3c0200c, 0xb140175b, 0xaecc336c,
+  0xac64d510, 0xaa0a5b2e,
+  0xa7bd22ac, 0xa57d8666, 0xa34bdf20, 0xa1288376, 0x9f13c7d0, 0x9d0dfe54,
+  0x9b1776da, 0x99307ee0,
+  0x9759617f, 0x9592675c, 0x93dbd6a0, 0x9235f2ec, 0x90a0fd4e, 0x8f1d343a,
+  0x8daad37b, 0x8c4a142f,
+  0x8afb2cbb, 0x89be50c3, 0x8893b125, 0x877b7bec, 0x8675dc4f, 0x8582faa5,
+  0x84a2fc62, 0x83d60412,
+  0x831c314e, 0x8275a0c0, 0x81e26c16, 0x8162aa04, 0x80f66e3c, 0x809dc971,
+  0x8058c94c, 0x80277872,
+  0x8009de7e, 0x80000000, 0x8009de7e, 0x80277872, 0x8058c94c, 0x809dc971,
+  0x80f66e3c, 0x8162aa04,
+  0x81e26c16, 0x8275a0c0, 0x831c314e, 0x83d60412, 0x84a2fc62, 0x8582faa5,
+  0x8675dc4f, 0x877b7bec,
+  0x8893b125, 0x89be50c3, 0x8afb2cbb, 0x8c4a142f, 0x8daad37b, 0x8f1d343a,
+  0x90a0fd4e, 0x9235f2ec,
+  0x93dbd6a0, 0x9592675c, 0x9759617f, 0x99307ee0, 0x9b1776da, 0x9d0dfe54,
+  0x9f13c7d0, 0xa1288376,
+  0xa34bdf20, 0xa57d8666, 0xa7bd22ac, 0xaa0a5b2e, 0xac64d510, 0xaecc336c,
+  0xb140175b, 0xb3c0200c,
+  0xb64beacd, 0xb8e31319, 0xbb8532b0, 0xbe31e19b, 0xc0e8b648, 0xc3a94590,
+  0xc67322ce, 0xc945dfec,
+  0xcc210d79, 0xcf043ab3, 0xd1eef59e, 0xd4e0cb15, 0xd7d946d8, 0xdad7f3a2,
+  0xdddc5b3b, 0xe0e60685,
+  0xe3f47d96, 0xe70747c4, 0xea1debbb, 0xed37ef91, 0xf054d8d5, 0xf3742ca2,
+  0xf6956fb7, 0xf9b82684,
+  0xfcdbd541, 0x0, 0x3242abf
+};
+
+/**   
+ * \par   
+ * Example code for Generation of Q15 Sin Table:  
+ * \par   
+ * <pre>tableSize = 256;   
+ * for(n = -1; n < (tableSize + 1); n++)   
+ * {   
+ *	sinTable[n+1]=sin(2*pi*n/tableSize);   
+ * } </pre>   
+ * where pi value is  3.14159265358979   
+ * \par   
+ * Convert Floating point to Q15(Fixed point):   
+ *	(sinTable[i] * pow(2, 15))   
+ * \par   
+ * rounding to nearest integer is done   
+ * 	sinTable[i] += (sinTable[i] > 0 ? 0.5 :-0.5);   
+ */
+const q15_t sinTable_q15[259] = {
+  0xfcdc, 0x0, 0x324, 0x648, 0x96b, 0xc8c, 0xfab, 0x12c8,
+  0x15e2, 0x18f9, 0x1c0c, 0x1f1a, 0x2224, 0x2528, 0x2827, 0x2b1f,
+  0x2e11, 0x30fc, 0x33df, 0x36ba, 0x398d, 0x3c57, 0x3f17, 0x41ce,
+  0x447b, 0x471d, 0x49b4, 0x4c40, 0x4ec0, 0x5134, 0x539b, 0x55f6,
+  0x5843, 0x5a82, 0x5cb4, 0x5ed7, 0x60ec, 0x62f2, 0x64e9, 0x66d0,
+  0x68a7, 0x6a6e, 0x6c24, 0x6dca, 0x6f5f, 0x70e3, 0x7255, 0x73b6,
+  0x7505, 0x7642, 0x776c, 0x7885, 0x798a, 0x7a7d, 0x7b5d, 0x7c2a,
+  0x7ce4, 0x7d8a, 0x7e1e, 0x7e9d, 0x7f0a, 0x7f62, 0x7fa7, 0x7fd9,
+  0x7ff6, 0x7fff, 0x7ff6, 0x7fd9, 0x7fa7, 0x7f62, 0x7f0a, 0x7e9d,
+  0x7e1e, 0x7d8a, 0x7ce4, 0x7c2a, 0x7b5d, 0x7a7d, 0x798a, 0x7885,
+  0x776c, 0x7642, 0x7505, 0x73b6, 0x7255, 0x70e3, 0x6f5f, 0x6dca,
+  0x6c24, 0x6a6e, 0x68a7, 0x66d0, 0x64e9, 0x62f2, 0x60ec, 0x5ed7,
+  0x5cb4, 0x5a82, 0x5843, 0x55f6, 0x539b, 0x5134, 0x4ec0, 0x4c40,
+  0x49b4, 0x471d, 0x447b, 0x41ce, 0x3f17, 0x3c57, 0x398d, 0x36ba,
+  0x33df, 0x30fc, 0x2e11, 0x2b1f, 0x2827, 0x2528, 0x2224, 0x1f1a,
+  0x1c0c, 0x18f9, 0x15e2, 0x12c8, 0xfab, 0xc8c, 0x96b, 0x648,
+  0x324, 0x0, 0xfcdc, 0xf9b8, 0xf695, 0xf374, 0xf055, 0xed38,
+  0xea1e, 0xe707, 0xe3f4, 0xe0e6, 0xdddc, 0xdad8, 0xd7d9, 0xd4e1,
+  0xd1ef, 0xcf04, 0xcc21, 0xc946, 0xc673, 0xc3a9, 0xc0e9, 0xbe32,
+  0xbb85, 0xb8e3, 0xb64c, 0xb3c0, 0xb140, 0xaecc, 0xac65, 0xaa0a,
+  0xa7bd, 0xa57e, 0xa34c, 0xa129, 0x9f14, 0x9d0e, 0x9b17, 0x9930,
+  0x9759, 0x9592, 0x93dc, 0x9236, 0x90a1, 0x8f1d, 0x8dab, 0x8c4a,
+  0x8afb, 0x89be, 0x8894, 0x877b, 0x8676, 0x8583, 0x84a3, 0x83d6,
+  0x831c, 0x8276, 0x81e2, 0x8163, 0x80f6, 0x809e, 0x8059, 0x8027,
+  0x800a, 0x8000, 0x800a, 0x8027, 0x8059, 0x809e, 0x80f6, 0x8163,
+  0x81e2, 0x8276, 0x831c, 0x83d6, 0x84a3, 0x8583, 0x8676, 0x877b,
+  0x8894, 0x89be, 0x8afb, 0x8c4a, 0x8dab, 0x8f1d, 0x90a1, 0x9236,
+  0x93dc, 0x9592, 0x9759, 0x9930, 0x9b17, 0x9d0e, 0x9f14, 0xa129,
+  0xa34c, 0xa57e, 0xa7bd, 0xaa0a, 0xac65, 0xaecc, 0xb140, 0xb3c0,
+  0xb64c, 0xb8e3, 0xbb85, 0xbe32, 0xc0e9, 0xc3a9, 0xc673, 0xc946,
+  0xcc21, 0xcf04, 0xd1ef, 0xd4e1, 0xd7d9, 0xdad8, 0xdddc, 0xe0e6,
+  0xe3f4, 0xe707, 0xea1e, 0xed38, 0xf055, 0xf374, 0xf695, 0xf9b8,
+  0xfcdc, 0x0, 0x324
+};
+
+/**   
+ * @} end of sin group   
+ */
+
+/**
+ * @addtogroup Log
+ * @{
+ */
+
+/**
+ * \par
+ * Q31 table of the base-2 logarithm of the mantissa, used by the fixed-point
+ * logarithm functions:
+ * <pre>for(n = 0; n < 257; n++)
+ * {
+ *	log2Table_q31[n] = log2(1 + n/256) * 2^31;
+ * } </pre>
+ * rounded to the nearest integer and saturated, so the last entry is 0x7FFFFFFF.
+ */
+const q31_t log2Table_q31[257] = {
+  0x00000000, 0x00B84E23, 0x016FE50B, 0x0226C623, 0x02DCF2D1, 0x03926C77, 0x04473475, 0x04FB4C25,
+  0x05AEB4DD, 0x06616FF1, 0x07137EAE, 0x07C4E261, 0x08759C50, 0x0925ADBF, 0x09D517EF, 0x0A83DC1B,
+  0x0B31FB7D, 0x0BDF774B, 0x0C8C50B7, 0x0D3888F0, 0x0DE42120, 0x0E8F1A72, 0x0F397609, 0x0FE33508,
+  0x108C588D, 0x1134E1B5, 0x11DCD197, 0x1284294B, 0x132AE9E2, 0x13D1146E, 0x1476A9FA, 0x151BAB90,
+  0x15C01A3A, 0x1663F6FB, 0x170742D5, 0x17A9FEC8, 0x184C2BD0, 0x18EDCAE8, 0x198EDD07, 0x1A2F6323,
+  0x1ACF5E2E, 0x1B6ECF17, 0x1C0DB6CE, 0x1CAC163C, 0x1D49EE4C, 0x1DE73FE4, 0x1E840BE7, 0x1F205339,
+  0x1FBC16B9, 0x20575745, 0x20F215B7, 0x218C52EB, 0x22260FB6, 0x22BF4CED, 0x23580B65, 0x23F04BEE,
+  0x24880F56, 0x251F566B, 0x25B621F9, 0x264C72C7, 0x26E2499D, 0x2777A741, 0x280C8C76, 0x28A0F9FE,
+  0x2934F098, 0x29C87102, 0x2A5B7BF9, 0x2AEE1236, 0x2B803474, 0x2C11E368, 0x2CA31FC9, 0x2D33EA49,
+  0x2DC4439B, 0x2E542C70, 0x2EE3A575, 0x2F72AF59, 0x30014AC6, 0x308F7868, 0x311D38E6, 0x31AA8CE7,
+  0x32377512, 0x32C3F20A, 0x33500472, 0x33DBACEB, 0x3466EC15, 0x34F1C28E, 0x357C30F3, 0x360637E0,
+  0x368FD7EE, 0x371911B8, 0x37A1E5D4, 0x382A54D8, 0x38B25F5A, 0x393A05EE, 0x39C14924, 0x3A482990,
+  0x3ACEA7C0, 0x3B54C444, 0x3BDA7FA9, 0x3C5FDA7A, 0x3CE4D544, 0x3D697090, 0x3DEDACE6, 0x3E718ACF,
+  0x3EF50AD2, 0x3F782D72, 0x3FFAF335, 0x407D5C9E, 0x40FF6A2E, 0x41811C68, 0x420273CA, 0x428370D4,
+  0x43041403, 0x43845DD5, 0x44044EC5, 0x4483E74E, 0x450327EB, 0x45821112, 0x4600A33E, 0x467EDEE4,
+  0x46FCC47A, 0x477A5476, 0x47F78F4C, 0x4874756F, 0x48F10751, 0x496D4563, 0x49E93016, 0x4A64C7DA,
+  0x4AE00D1D, 0x4B5B004D, 0x4BD5A1D8, 0x4C4FF228, 0x4CC9F1AB, 0x4D43A0C9, 0x4DBCFFEE, 0x4E360F81,
+  0x4EAECFEB, 0x4F274192, 0x4F9F64DE, 0x50173A35, 0x508EC1FA, 0x5105FC93, 0x517CEA63, 0x51F38BCB,
+  0x5269E12F, 0x52DFEAF0, 0x5355A96D, 0x53CB1D07, 0x5440461C, 0x54B5250C, 0x5529BA33, 0x559E05EE,
+  0x5612089A, 0x5685C293, 0x56F93433, 0x576C5DD4, 0x57DF3FD0, 0x5851DA81, 0x58C42E3D, 0x59363B5E,
+  0x59A80239, 0x5A198326, 0x5A8ABE79, 0x5AFBB489, 0x5B6C65AA, 0x5BDCD22F, 0x5C4CFA6C, 0x5CBCDEB4,
+  0x5D2C7F59, 0x5D9BDCAD, 0x5E0AF6FF, 0x5E79CEA2, 0x5EE863E5, 0x5F56B717, 0x5FC4C886, 0x60329882,
+  0x60A02757, 0x610D7553, 0x617A82C3, 0x61E74FF2, 0x6253DD2C, 0x62C02ABC, 0x632C38ED, 0x63980809,
+  0x64039858, 0x646EEA24, 0x64D9FDB7, 0x6544D356, 0x65AF6B4B, 0x6619C5DB, 0x6683E34F, 0x66EDC3EB,
+  0x675767F5, 0x67C0CFB3, 0x6829FB69, 0x6892EB5C, 0x68FB9FCE, 0x69641904, 0x69CC5741, 0x6A345AC6,
+  0x6A9C23D6, 0x6B03B2B2, 0x6B6B079C, 0x6BD222D4, 0x6C39049B, 0x6C9FAD30, 0x6D061CD3, 0x6D6C53C2,
+  0x6DD2523D, 0x6E381882, 0x6E9DA6CE, 0x6F02FD60, 0x6F681C73, 0x6FCD0445, 0x7031B512, 0x70962F16,
+  0x70FA728C, 0x715E7FAF, 0x71C256BA, 0x7225F7E8, 0x72896373, 0x72EC9993, 0x734F9A83, 0x73B2667B,
+  0x7414FDB5, 0x74776067, 0x74D98ECA, 0x753B8916, 0x759D4F81, 0x75FEE242, 0x76604191, 0x76C16DA3,
+  0x772266AD, 0x77832CE6, 0x77E3C082, 0x784421B7, 0x78A450B8, 0x79044DBB, 0x796418F2, 0x79C3B292,
+  0x7A231ACE, 0x7A8251D8, 0x7AE157E3, 0x7B402D22, 0x7B9ED1C7, 0x7BFD4603, 0x7C5B8A07, 0x7CB99E06,
+  0x7D17822F, 0x7D7536B4, 0x7DD2BBC4, 0x7E30118F, 0x7E8D3846, 0x7EEA3017, 0x7F46F932, 0x7FA393C5,
+  0x7FFFFFFF
+};
+
+/**
+ * @} end of Log group
+ */
+
+/**
+ * @addtogroup Exp
+ * @{
+ */
+
+/**
+ * \par
+ * Q31 table of the base-2 power of the fraction, used by the fixed-point
+ * exponential functions:
+ * <pre>for(n = 0; n < 257; n++)
+ * {
+ *	exp2Table_q31[n] = 2^(n/256 - 1) * 2^31;
+ * } </pre>
+ * rounded to the nearest integer and saturated, so the last entry is 0x7FFFFFFF.
+ */
+const q31_t exp2Table_q31[257] = {
+  0x40000000, 0x402C6BE9, 0x4058F6A8, 0x4085A051, 0x40B268FA, 0x40DF50B8, 0x410C57A2, 0x41397DCC,
+  0x4166C34C, 0x41942839, 0x41C1ACA7, 0x41EF50AE, 0x421D1462, 0x424AF7DA, 0x4278FB2B, 0x42A71E6C,
+  0x42D561B4, 0x4303C518, 0x433248AE, 0x4360EC8D, 0x438FB0CB, 0x43BE957F, 0x43ED9AC0, 0x441CC0A3,
+  0x444C0740, 0x447B6EAD, 0x44AAF702, 0x44DAA054, 0x450A6ABB, 0x453A564D, 0x456A6323, 0x459A9152,
+  0x45CAE0F2, 0x45FB521A, 0x462BE4E2, 0x465C9961, 0x468D6FAE, 0x46BE67E0, 0x46EF8210, 0x4720BE55,
+  0x47521CC6, 0x47839D7B, 0x47B5408C, 0x47E70611, 0x4818EE22, 0x484AF8D6, 0x487D2646, 0x48AF768A,
+  0x48E1E9BA, 0x49147FEE, 0x4947393F, 0x497A15C4, 0x49AD1598, 0x49E038D0, 0x4A137F88, 0x4A46E9D6,
+  0x4A7A77D4, 0x4AAE299B, 0x4AE1FF43, 0x4B15F8E6, 0x4B4A169C, 0x4B7E587E, 0x4BB2BEA5, 0x4BE7492B,
+  0x4C1BF829, 0x4C50CBB8, 0x4C85C3F1, 0x4CBAE0EF, 0x4CF022CA, 0x4D25899C, 0x4D5B157E, 0x4D90C68B,
+  0x4DC69CDD, 0x4DFC988C, 0x4E32B9B4, 0x4E69006E, 0x4E9F6CD4, 0x4ED5FF00, 0x4F0CB70C, 0x4F439514,
+  0x4F7A9930, 0x4FB1C37C, 0x4FE91413, 0x50208B0E, 0x50582888, 0x508FEC9C, 0x50C7D765, 0x50FFE8FE,
+  0x51382182, 0x5170810B, 0x51A907B4, 0x51E1B59A, 0x521A8AD7, 0x52538786, 0x528CABC3, 0x52C5F7AA,
+  0x52FF6B55, 0x533906E0, 0x5372CA68, 0x53ACB607, 0x53E6C9DA, 0x542105FD, 0x545B6A8B, 0x5495F7A1,
+  0x54D0AD5A, 0x550B8BD4, 0x55469329, 0x5581C378, 0x55BD1CDB, 0x55F89F70, 0x56344B52, 0x567020A0,
+  0x56AC1F75, 0x56E847EF, 0x57249A29, 0x57611642, 0x579DBC57, 0x57DA8C83, 0x581786E6, 0x5854AB9B,
+  0x5891FAC1, 0x58CF7474, 0x590D18D3, 0x594AE7FB, 0x5988E209, 0x59C7071C, 0x5A055751, 0x5A43D2C6,
+  0x5A82799A, 0x5AC14BEA, 0x5B0049D4, 0x5B3F7377, 0x5B7EC8F2, 0x5BBE4A61, 0x5BFDF7E5, 0x5C3DD19C,
+  0x5C7DD7A4, 0x5CBE0A1C, 0x5CFE6923, 0x5D3EF4D7, 0x5D7FAD59, 0x5DC092C7, 0x5E01A53F, 0x5E42E4E3,
+  0x5E8451D0, 0x5EC5EC26, 0x5F07B405, 0x5F49A98C, 0x5F8BCCDB, 0x5FCE1E12, 0x60109D51, 0x60534AB7,
+  0x60962665, 0x60D9307B, 0x611C6919, 0x615FD05E, 0x61A3666D, 0x61E72B65, 0x622B1F66, 0x626F4292,
+  0x62B39509, 0x62F816EB, 0x633CC85B, 0x6381A978, 0x63C6BA64, 0x640BFB41, 0x64516C2E, 0x64970D4F,
+  0x64DCDEC3, 0x6522E0AD, 0x6569132F, 0x65AF766A, 0x65F60A7F, 0x663CCF92, 0x6683C5C3, 0x66CAED35,
+  0x6712460B, 0x6759D065, 0x67A18C68, 0x67E97A34, 0x683199ED, 0x6879EBB6, 0x68C26FB1, 0x690B2601,
+  0x69540EC9, 0x699D2A2C, 0x69E6784D, 0x6A2FF94F, 0x6A79AD56, 0x6AC39485, 0x6B0DAEFF, 0x6B57FCE9,
+  0x6BA27E65, 0x6BED3399, 0x6C381CA6, 0x6C8339B2, 0x6CCE8AE1, 0x6D1A1057, 0x6D65CA38, 0x6DB1B8A8,
+  0x6DFDDBCC, 0x6E4A33C9, 0x6E96C0C3, 0x6EE382DE, 0x6F307A41, 0x6F7DA710, 0x6FCB096F, 0x7018A185,
+  0x70666F76, 0x70B47368, 0x7102AD80, 0x71511DE4, 0x719FC4B9, 0x71EEA226, 0x723DB650, 0x728D015D,
+  0x72DC8374, 0x732C3CBA, 0x737C2D55, 0x73CC556D, 0x741CB528, 0x746D4CAC, 0x74BE1C20, 0x750F23AB,
+  0x75606374, 0x75B1DBA2, 0x76038C5B, 0x765575C8, 0x76A7980F, 0x76F9F359, 0x774C87CC, 0x779F5590,
+  0x77F25CCE, 0x78459DAC, 0x78991854, 0x78ECCCEC, 0x7940BB9E, 0x7994E492, 0x79E947EF, 0x7A3DE5DF,
+  0x7A92BE8B, 0x7AE7D21A, 0x7B3D20B6, 0x7B92AA88, 0x7BE86FBA, 0x7C3E7073, 0x7C94ACDE, 0x7CEB2523,
+  0x7D41D96E, 0x7D98C9E6, 0x7DEFF6B6, 0x7E476009, 0x7E9F0606, 0x7EF6E8DA, 0x7F4F08AE, 0x7FA765AD,
+  0x7FFFFFFF
+};
+
+/**
+ * @} end of Exp group
+ */
+
+/**
+ * @addtogroup RSQRT
+ * @{
+ */
+
+/**
+ * \par
+ * Initial estimates of the reciprocal square root of a mantissa in [0.25 1),
+ * in 2.30 format, used by the fixed-point reciprocal square root functions:
+ * <pre>for(n = 0; n < 49; n++)
+ * {
+ *	rsqrtTable_q31[n] = (1 / sqrt(0.25 + n/64)) * 2^30;
+ * } </pre>
+ * rounded to the nearest integer and saturated, so the first entry is 0x7FFFFFFF.
+ */
+const q31_t rsqrtTable_q31[49] = {
+  0x7FFFFFFF, 0x7C2DA123, 0x78ADF778, 0x7575FAA4, 0x727C9717, 0x6FBA415C, 0x6D28A4F0, 0x6AC266BA,
+  0x6882F5C0, 0x66666666, 0x64695585, 0x6288D173, 0x60C2479B, 0x5F137599, 0x5D7A5D1B, 0x5BF539E5,
+  0x5A82799A, 0x5920B4DF, 0x57CEA99D, 0x568B3632, 0x55555555, 0x542C1AA4, 0x530EAFA5, 0x51FC5140,
+  0x50F44D89, 0x4FF601E0, 0x4F00D944, 0x4E144AE9, 0x4D2FD8F4, 0x4C530F65, 0x4B7D8317, 0x4AAED0F0,
+  0x49E69D16, 0x49249249, 0x48686148, 0x47B1C049, 0x47006A81, 0x46541FB4, 0x45ACA3D5, 0x4509BEB0,
+  0x446B3B96, 0x43D0E917, 0x433A98C6, 0x42A81EF6, 0x4219528B, 0x418E0CC8, 0x41062920, 0x40818512,
+  0x40000000
+};
+
+/**
+ * @} end of RSQRT group
+ */
@@ -0,0 +1,203 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cmplx_conj_mac_f32.c
+*
+* Description:	Floating-point complex multiply by the conjugate and accumulate.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup CmplxMac
+ * @{
+ */
+
+/**
+ * @brief  Floating-point complex multiply by the conjugate and accumulate.
+ * @param[in]      *pSrcA points to the first input vector.
+ * @param[in]      *pSrcB points to the second input vector, which is conjugated.
+ * @param[in,out]  *pDst points to the vector the products are added to.
+ * @param[in]      numSamples number of complex samples in each vector.
+ * @return none.
+ */
+
+void arm_cmplx_conj_mac_f32(
+  float32_t * pSrcA,
+  float32_t * pSrcB,
+  float32_t * pDst,
+  uint32_t numSamples)
+{
+  float32_t a, b, c, d;                          /* Temporary variables to store real and imaginary values */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* loop Unrolling */
+  blkCnt = numSamples >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C[2 * i] += A[2 * i] * B[2 * i] + A[2 * i + 1] * B[2 * i + 1].  */
+    /* C[2 * i + 1] += A[2 * i + 1] * B[2 * i] - A[2 * i] * B[2 * i + 1].  */
+    a = pSrcA[0];
+    b = pSrcA[1];
+    c = pSrcB[0];
+    d = pSrcB[1];
+    pDst[0] += (a * c) + (b * d);
+    pDst[1] += (b * c) - (a * d);
+
+    a = pSrcA[2];
+    b = pSrcA[3];
+    c = pSrcB[2];
+    d = pSrcB[3];
+    pDst[2] += (a * c) + (b * d);
+    pDst[3] += (b * c) - (a * d);
+
+    a = pSrcA[4];
+    b = pSrcA[5];
+    c = pSrcB[4];
+    d = pSrcB[5];
+    pDst[4] += (a * c) + (b * d);
+    pDst[5] += (b * c) - (a * d);
+
+    a = pSrcA[6];
+    b = pSrcA[7];
+    c = pSrcB[6];
+    d = pSrcB[7];
+    pDst[6] += (a * c) + (b * d);
+    pDst[7] += (b * c) - (a * d);
+
+    pSrcA += 8u;
+    pSrcB += 8u;
+    pDst += 8u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the numSamples is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = numSamples % 0x4u;
+
+  while(blkCnt > 0u)
+  {
+    a = *pSrcA++;
+    b = *pSrcA++;
+    c = *pSrcB++;
+    d = *pSrcB++;
+
+    /* accumulate the product in the destination buffer. */
+    *pDst++ += (a * c) + (b * d);
+    *pDst++ += (b * c) - (a * d);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+#if defined (ARM_MATH_SSE2)
+
+  /* Host build: 2 complex samples per SSE2 operation */
+  {
+    __m128 vA, vB, vRe, vIm;
+    const __m128 vSign = _mm_castsi128_ps(_mm_set_epi32((int32_t) 0x80000000, 0, (int32_t) 0x80000000, 0));
+    uint32_t blkCnt = numSamples >> 1u;
+
+    while(blkCnt > 0u)
+    {
+      /* vA = {a0, b0, a1, b1}, vB = {c0, d0, c1, d1} */
+      vA = _mm_loadu_ps(pSrcA);
+      vB = _mm_loadu_ps(pSrcB);
+
+      /* {a * c, a * d} and {b * d, b * c} */
+      vRe = _mm_mul_ps(_mm_shuffle_ps(vA, vA, _MM_SHUFFLE(2, 2, 0, 0)), vB);
+      vIm = _mm_mul_ps(_mm_shuffle_ps(vA, vA, _MM_SHUFFLE(3, 3, 1, 1)),
+                       _mm_shuffle_ps(vB, vB, _MM_SHUFFLE(2, 3, 0, 1)));
+
+      /* {a * c + b * d, b * c - a * d} added to the destination */
+      _mm_storeu_ps(pDst, _mm_add_ps(_mm_loadu_ps(pDst), _mm_add_ps(_mm_xor_ps(vRe, vSign), vIm)));
+
+      pSrcA += 4u;
+      pSrcB += 4u;
+      pDst += 4u;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Compute the last sample below */
+    numSamples = numSamples & 0x1u;
+  }
+
+#elif defined (ARM_MATH_NEON)
+
+  /* Host build: 4 complex samples per NEON operation */
+  {
+    float32x4x2_t vA, vB, vOut;
+    uint32_t blkCnt = numSamples >> 2u;
+
+    while(blkCnt > 0u)
+    {
+      /* De-interleave the real and imaginary parts */
+      vA = vld2q_f32(pSrcA);
+      vB = vld2q_f32(pSrcB);
+      vOut = vld2q_f32(pDst);
+
+      vOut.val[0] = vmlaq_f32(vmlaq_f32(vOut.val[0], vA.val[0], vB.val[0]), vA.val[1], vB.val[1]);
+      vOut.val[1] = vmlsq_f32(vmlaq_f32(vOut.val[1], vA.val[1], vB.val[0]), vA.val[0], vB.val[1]);
+      vst2q_f32(pDst, vOut);
+
+      pSrcA += 8u;
+      pSrcB += 8u;
+      pDst += 8u;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Compute the remaining 1 to 3 samples below */
+    numSamples = numSamples % 0x4u;
+  }
+
+#endif /* #if defined (ARM_MATH_SSE2) */
+
+  while(numSamples > 0u)
+  {
+    a = *pSrcA++;
+    b = *pSrcA++;
+    c = *pSrcB++;
+    d = *pSrcB++;
+
+    /* accumulate the product in the destination buffer. */
+    *pDst++ += (a * c) + (b * d);
+    *pDst++ += (b * c) - (a * d);
+
+    /* Decrement the loop counter */
+    numSamples--;
+  }
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+}
+
+/**
+ * @} end of CmplxMac group
+ */
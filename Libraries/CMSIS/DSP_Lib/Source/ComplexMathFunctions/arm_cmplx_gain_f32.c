@@ -0,0 +1,168 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cmplx_gain_f32.c
+*
+* Description:	Floating-point real gain applied to complex data in place.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup CmplxMac
+ * @{
+ */
+
+/**
+ * @brief  Floating-point real gain applied to complex data in place.
+ * @param[in,out]  *pCmplx points to the complex vector.
+ * @param[in]      *pGain points to the real gains, one per complex sample.
+ * @param[in]      numSamples number of complex samples in the vector.
+ * @return none.
+ */
+
+void arm_cmplx_gain_f32(
+  float32_t * pCmplx,
+  float32_t * pGain,
+  uint32_t numSamples)
+{
+  float32_t in;                                  /* Temporary variable to store the gain */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* loop Unrolling */
+  blkCnt = numSamples >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C[2 * i] *= B[i].  */
+    /* C[2 * i + 1] *= B[i].  */
+    in = pGain[0];
+    pCmplx[0] *= in;
+    pCmplx[1] *= in;
+
+    in = pGain[1];
+    pCmplx[2] *= in;
+    pCmplx[3] *= in;
+
+    in = pGain[2];
+    pCmplx[4] *= in;
+    pCmplx[5] *= in;
+
+    in = pGain[3];
+    pCmplx[6] *= in;
+    pCmplx[7] *= in;
+
+    pGain += 4u;
+    pCmplx += 8u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the numSamples is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = numSamples % 0x4u;
+
+  while(blkCnt > 0u)
+  {
+    in = *pGain++;
+    *pCmplx++ *= in;
+    *pCmplx++ *= in;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+#if defined (ARM_MATH_SSE2)
+
+  /* Host build: 4 complex samples per pair of SSE2 operations */
+  {
+    __m128 vGain;
+    uint32_t blkCnt = numSamples >> 2u;
+
+    while(blkCnt > 0u)
+    {
+      /* {g0, g0, g1, g1} and {g2, g2, g3, g3} */
+      vGain = _mm_loadu_ps(pGain);
+      _mm_storeu_ps(pCmplx, _mm_mul_ps(_mm_loadu_ps(pCmplx), _mm_unpacklo_ps(vGain, vGain)));
+      _mm_storeu_ps(pCmplx + 4, _mm_mul_ps(_mm_loadu_ps(pCmplx + 4), _mm_unpackhi_ps(vGain, vGain)));
+
+      pGain += 4u;
+      pCmplx += 8u;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Compute the remaining 1 to 3 samples below */
+    numSamples = numSamples % 0x4u;
+  }
+
+#elif defined (ARM_MATH_NEON)
+
+  /* Host build: 4 complex samples per NEON operation */
+  {
+    float32x4x2_t vCmplx;
+    float32x4_t vGain;
+    uint32_t blkCnt = numSamples >> 2u;
+
+    while(blkCnt > 0u)
+    {
+      vCmplx = vld2q_f32(pCmplx);
+      vGain = vld1q_f32(pGain);
+      vCmplx.val[0] = vmulq_f32(vCmplx.val[0], vGain);
+      vCmplx.val[1] = vmulq_f32(vCmplx.val[1], vGain);
+      vst2q_f32(pCmplx, vCmplx);
+
+      pGain += 4u;
+      pCmplx += 8u;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Compute the remaining 1 to 3 samples below */
+    numSamples = numSamples % 0x4u;
+  }
+
+#endif /* #if defined (ARM_MATH_SSE2) */
+
+  while(numSamples > 0u)
+  {
+    /* C[2 * i] *= B[i].  */
+    /* C[2 * i + 1] *= B[i].  */
+    in = *pGain++;
+    *pCmplx++ *= in;
+    *pCmplx++ *= in;
+
+    /* Decrement the loop counter */
+    numSamples--;
+  }
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+}
+
+/**
+ * @} end of CmplxMac group
+ */
@@ -0,0 +1,181 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cmplx_gain_q15.c
+*
+* Description:	Q15 real gain applied to complex data in place.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup CmplxMac
+ * @{
+ */
+
+/**
+ * @brief  Q15 real gain applied to complex data in place.
+ * @param[in,out]  *pCmplx points to the complex vector.
+ * @param[in]      *pGain points to the real gains, one per complex sample.
+ * @param[in]      numSamples number of complex samples in the vector.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function uses saturating arithmetic.
+ * Results outside of the allowable Q15 range [0x8000 0x7FFF] will be saturated.
+ */
+
+void arm_cmplx_gain_q15(
+  q15_t * pCmplx,
+  q15_t * pGain,
+  uint32_t numSamples)
+{
+  q15_t in;                                      /* Temporary variable to store the gain */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* loop Unrolling */
+  blkCnt = numSamples >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C[2 * i] *= B[i].  */
+    /* C[2 * i + 1] *= B[i].  */
+    in = pGain[0];
+    pCmplx[0] = (q15_t) __SSAT((((q31_t) pCmplx[0] * in) >> 15), 16);
+    pCmplx[1] = (q15_t) __SSAT((((q31_t) pCmplx[1] * in) >> 15), 16);
+
+    in = pGain[1];
+    pCmplx[2] = (q15_t) __SSAT((((q31_t) pCmplx[2] * in) >> 15), 16);
+    pCmplx[3] = (q15_t) __SSAT((((q31_t) pCmplx[3] * in) >> 15), 16);
+
+    in = pGain[2];
+    pCmplx[4] = (q15_t) __SSAT((((q31_t) pCmplx[4] * in) >> 15), 16);
+    pCmplx[5] = (q15_t) __SSAT((((q31_t) pCmplx[5] * in) >> 15), 16);
+
+    in = pGain[3];
+    pCmplx[6] = (q15_t) __SSAT((((q31_t) pCmplx[6] * in) >> 15), 16);
+    pCmplx[7] = (q15_t) __SSAT((((q31_t) pCmplx[7] * in) >> 15), 16);
+
+    pGain += 4u;
+    pCmplx += 8u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the numSamples is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = numSamples % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_SSE2)
+
+  /* Host build: 4 complex samples per SSE2 operation */
+  {
+    __m128i vCmplx, vGain, vLo, vHi;
+
+    blkCnt = numSamples >> 2u;
+
+    while(blkCnt > 0u)
+    {
+      /* {g0, g0, g1, g1, g2, g2, g3, g3} */
+      vGain = _mm_loadl_epi64((__m128i *) pGain);
+      vGain = _mm_unpacklo_epi16(vGain, vGain);
+      vCmplx = _mm_loadu_si128((__m128i *) pCmplx);
+
+      /* the 32-bit products from their low and high halves, shifted and saturated */
+      vLo = _mm_mullo_epi16(vCmplx, vGain);
+      vHi = _mm_mulhi_epi16(vCmplx, vGain);
+      vCmplx = _mm_packs_epi32(_mm_srai_epi32(_mm_unpacklo_epi16(vLo, vHi), 15),
+                               _mm_srai_epi32(_mm_unpackhi_epi16(vLo, vHi), 15));
+      _mm_storeu_si128((__m128i *) pCmplx, vCmplx);
+
+      pGain += 4u;
+      pCmplx += 8u;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Compute the remaining 1 to 3 samples below */
+    blkCnt = numSamples % 0x4u;
+  }
+
+#elif defined (ARM_MATH_NEON)
+
+  /* Host build: 4 complex samples per NEON operation.  The doubling multiply high
+   ** returns the saturated (x * g) >> 15. */
+  {
+    int16x4x2_t vCmplx;
+    int16x4_t vGain;
+
+    blkCnt = numSamples >> 2u;
+
+    while(blkCnt > 0u)
+    {
+      vCmplx = vld2_s16(pCmplx);
+      vGain = vld1_s16(pGain);
+      vCmplx.val[0] = vqdmulh_s16(vCmplx.val[0], vGain);
+      vCmplx.val[1] = vqdmulh_s16(vCmplx.val[1], vGain);
+      vst2_s16(pCmplx, vCmplx);
+
+      pGain += 4u;
+      pCmplx += 8u;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Compute the remaining 1 to 3 samples below */
+    blkCnt = numSamples % 0x4u;
+  }
+
+#else
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = numSamples;
+
+#endif /* #if defined (ARM_MATH_SSE2) */
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    /* C[2 * i] *= B[i].  */
+    /* C[2 * i + 1] *= B[i].  */
+    in = *pGain++;
+    *pCmplx = (q15_t) __SSAT((((q31_t) (*pCmplx) * in) >> 15), 16);
+    pCmplx++;
+    *pCmplx = (q15_t) __SSAT((((q31_t) (*pCmplx) * in) >> 15), 16);
+    pCmplx++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+}
+
+/**
+ * @} end of CmplxMac group
+ */
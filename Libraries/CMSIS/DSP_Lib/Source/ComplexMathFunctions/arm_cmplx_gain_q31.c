@@ -0,0 +1,112 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cmplx_gain_q31.c
+*
+* Description:	Q31 real gain applied to complex data in place.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup CmplxMac
+ * @{
+ */
+
+/**
+ * @brief  Q31 real gain applied to complex data in place.
+ * @param[in,out]  *pCmplx points to the complex vector.
+ * @param[in]      *pGain points to the real gains, one per complex sample.
+ * @param[in]      numSamples number of complex samples in the vector.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function uses saturating arithmetic.
+ * Results outside of the allowable Q31 range [0x80000000 0x7FFFFFFF] will be saturated.
+ */
+
+void arm_cmplx_gain_q31(
+  q31_t * pCmplx,
+  q31_t * pGain,
+  uint32_t numSamples)
+{
+  q31_t in;                                      /* Temporary variable to store the gain */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* loop Unrolling */
+  blkCnt = numSamples >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C[2 * i] *= B[i].  */
+    /* C[2 * i + 1] *= B[i].  */
+    in = pGain[0];
+    pCmplx[0] = clip_q63_to_q31((((q63_t) pCmplx[0] * in) >> 31));
+    pCmplx[1] = clip_q63_to_q31((((q63_t) pCmplx[1] * in) >> 31));
+
+    in = pGain[1];
+    pCmplx[2] = clip_q63_to_q31((((q63_t) pCmplx[2] * in) >> 31));
+    pCmplx[3] = clip_q63_to_q31((((q63_t) pCmplx[3] * in) >> 31));
+
+    in = pGain[2];
+    pCmplx[4] = clip_q63_to_q31((((q63_t) pCmplx[4] * in) >> 31));
+    pCmplx[5] = clip_q63_to_q31((((q63_t) pCmplx[5] * in) >> 31));
+
+    in = pGain[3];
+    pCmplx[6] = clip_q63_to_q31((((q63_t) pCmplx[6] * in) >> 31));
+    pCmplx[7] = clip_q63_to_q31((((q63_t) pCmplx[7] * in) >> 31));
+
+    pGain += 4u;
+    pCmplx += 8u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the numSamples is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = numSamples % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+  uint32_t blkCnt = numSamples;                  /* loop counter */
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    /* C[2 * i] *= B[i].  */
+    /* C[2 * i + 1] *= B[i].  */
+    in = *pGain++;
+    *pCmplx = clip_q63_to_q31((((q63_t) (*pCmplx) * in) >> 31));
+    pCmplx++;
+    *pCmplx = clip_q63_to_q31((((q63_t) (*pCmplx) * in) >> 31));
+    pCmplx++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+}
+
+/**
+ * @} end of CmplxMac group
+ */
@@ -0,0 +1,248 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cmplx_mac_q15.c
+*
+* Description:	Q15 complex multiply-accumulate.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup CmplxMac
+ * @{
+ */
+
+/**
+ * @brief  Q15 complex multiply-accumulate.
+ * @param[in]      *pSrcA points to the first input vector.
+ * @param[in]      *pSrcB points to the second input vector.
+ * @param[in,out]  *pDst points to the vector the products are added to.
+ * @param[in]      numSamples number of complex samples in each vector.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function implements 1.15 by 1.15 multiplications and the sums of the products are
+ * converted into 3.13 format, as in arm_cmplx_mult_cmplx_q15().  The sums are computed
+ * exactly before the shift.  The addition to <code>pDst</code> saturates.
+ */
+
+void arm_cmplx_mac_q15(
+  q15_t * pSrcA,
+  q15_t * pSrcB,
+  q15_t * pDst,
+  uint32_t numSamples)
+{
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  q31_t inA, inB;                                /* Temporary variables to hold a complex sample */
+  q31_t real, imag;                              /* Real and imaginary parts of the product */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* loop Unrolling */
+  blkCnt = numSamples >> 1u;
+
+  /* First part of the processing with loop unrolling.  Compute 2 outputs at a time.
+   ** a second loop below computes the remaining sample. */
+  while(blkCnt > 0u)
+  {
+    /* C[2 * i] += A[2 * i] * B[2 * i] - A[2 * i + 1] * B[2 * i + 1].  */
+    /* C[2 * i + 1] += A[2 * i] * B[2 * i + 1] + A[2 * i + 1] * B[2 * i].  */
+    inA = *__SIMD32(pSrcA)++;
+    inB = *__SIMD32(pSrcB)++;
+
+    /* the imaginary sum reaches 2^31 for -1 inputs, so it is accumulated in 64 bits */
+    imag = (q31_t) (__SMLALDX(inA, inB, 0) >> 17);
+
+#ifndef ARM_MATH_BIG_ENDIAN
+
+    real = __SMUSD(inA, inB) >> 17;
+    *__SIMD32(pDst) = __QADD16(*__SIMD32(pDst), __PKHBT(real, imag, 16));
+
+#else
+
+    /* the halfwords of a sample are swapped, and __SMUSD returns the negated real part */
+    real = (-__SMUSD(inA, inB)) >> 17;
+    *__SIMD32(pDst) = __QADD16(*__SIMD32(pDst), __PKHBT(imag, real, 16));
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+    pDst += 2u;
+
+    inA = *__SIMD32(pSrcA)++;
+    inB = *__SIMD32(pSrcB)++;
+
+    imag = (q31_t) (__SMLALDX(inA, inB, 0) >> 17);
+
+#ifndef ARM_MATH_BIG_ENDIAN
+
+    real = __SMUSD(inA, inB) >> 17;
+    *__SIMD32(pDst) = __QADD16(*__SIMD32(pDst), __PKHBT(real, imag, 16));
+
+#else
+
+    real = (-__SMUSD(inA, inB)) >> 17;
+    *__SIMD32(pDst) = __QADD16(*__SIMD32(pDst), __PKHBT(imag, real, 16));
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+    pDst += 2u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the numSamples is odd, compute the last sample here */
+  if((numSamples & 0x1u) != 0u)
+  {
+    inA = *__SIMD32(pSrcA);
+    inB = *__SIMD32(pSrcB);
+
+    imag = (q31_t) (__SMLALDX(inA, inB, 0) >> 17);
+
+#ifndef ARM_MATH_BIG_ENDIAN
+
+    real = __SMUSD(inA, inB) >> 17;
+    *__SIMD32(pDst) = __QADD16(*__SIMD32(pDst), __PKHBT(real, imag, 16));
+
+#else
+
+    real = (-__SMUSD(inA, inB)) >> 17;
+    *__SIMD32(pDst) = __QADD16(*__SIMD32(pDst), __PKHBT(imag, real, 16));
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+  }
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+  q15_t a, b, c, d;                              /* Temporary variables to store real and imaginary values */
+  q31_t real, imag;                              /* Real and imaginary parts of the product */
+
+#if defined (ARM_MATH_SSE2)
+
+  /* Host build: 4 complex samples per SSE2 operation.  A 32-bit lane holds one sample, with
+   ** the real part in the lower half, and _mm_madd_epi16 sums the two products of a lane. */
+  {
+    __m128i vA, vB, vRe, vIm, vSum;
+    const __m128i vLow = _mm_set1_epi32(0x0000FFFF);
+    const __m128i vHigh = _mm_set1_epi32((int32_t) 0xFFFF0000);
+    const __m128i vMin = _mm_set1_epi32((int32_t) 0x80000000);
+    const __m128i vHalf = _mm_set1_epi32(0x00008000);
+    uint32_t blkCnt = numSamples >> 2u;
+
+    while(blkCnt > 0u)
+    {
+      vA = _mm_loadu_si128((__m128i *) pSrcA);
+      vB = _mm_loadu_si128((__m128i *) pSrcB);
+
+      /* a * c + b * ~d = a * c - b * d - b, corrected by adding b */
+      vRe = _mm_madd_epi16(vA, _mm_xor_si128(vB, vHigh));
+      vRe = _mm_srai_epi32(_mm_add_epi32(vRe, _mm_srai_epi32(vA, 16)), 17);
+
+      /* a * d + b * c, with the halves of B swapped.  The sum of 2^31 wraps to the
+       ** smallest value, which gets 2^15 added after the shift. */
+      vIm = _mm_madd_epi16(vA, _mm_shufflehi_epi16(_mm_shufflelo_epi16(vB, _MM_SHUFFLE(2, 3, 0, 1)),
+                                                   _MM_SHUFFLE(2, 3, 0, 1)));
+      vIm = _mm_add_epi32(_mm_srai_epi32(vIm, 17), _mm_and_si128(_mm_cmpeq_epi32(vIm, vMin), vHalf));
+
+      /* interleave the results back and add them to the destination with saturation */
+      vSum = _mm_or_si128(_mm_and_si128(vRe, vLow), _mm_slli_epi32(vIm, 16));
+      _mm_storeu_si128((__m128i *) pDst, _mm_adds_epi16(_mm_loadu_si128((__m128i *) pDst), vSum));
+
+      pSrcA += 8u;
+      pSrcB += 8u;
+      pDst += 8u;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Compute the remaining 1 to 3 samples below */
+    numSamples = numSamples % 0x4u;
+  }
+
+#elif defined (ARM_MATH_NEON)
+
+  /* Host build: 4 complex samples per NEON operation */
+  {
+    int16x4x2_t vA, vB, vOut;
+    int32x4_t vRe, vIm;
+    const int32x4_t vMin = vdupq_n_s32((int32_t) 0x80000000);
+    const int32x4_t vHalf = vdupq_n_s32(0x00008000);
+    uint32_t blkCnt = numSamples >> 2u;
+
+    while(blkCnt > 0u)
+    {
+      /* De-interleave the real and imaginary parts */
+      vA = vld2_s16(pSrcA);
+      vB = vld2_s16(pSrcB);
+      vOut = vld2_s16(pDst);
+
+      vRe = vmlsl_s16(vmull_s16(vA.val[0], vB.val[0]), vA.val[1], vB.val[1]);
+
+      /* The sum of 2^31 wraps to the smallest value, which gets 2^15 added after the shift */
+      vIm = vmlal_s16(vmull_s16(vA.val[0], vB.val[1]), vA.val[1], vB.val[0]);
+      vIm = vaddq_s32(vshrq_n_s32(vIm, 17), vandq_s32(vreinterpretq_s32_u32(vceqq_s32(vIm, vMin)), vHalf));
+
+      vOut.val[0] = vqadd_s16(vOut.val[0], vmovn_s32(vshrq_n_s32(vRe, 17)));
+      vOut.val[1] = vqadd_s16(vOut.val[1], vmovn_s32(vIm));
+      vst2_s16(pDst, vOut);
+
+      pSrcA += 8u;
+      pSrcB += 8u;
+      pDst += 8u;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Compute the remaining 1 to 3 samples below */
+    numSamples = numSamples % 0x4u;
+  }
+
+#endif /* #if defined (ARM_MATH_SSE2) */
+
+  while(numSamples > 0u)
+  {
+    /* C[2 * i] += A[2 * i] * B[2 * i] - A[2 * i + 1] * B[2 * i + 1].  */
+    /* C[2 * i + 1] += A[2 * i] * B[2 * i + 1] + A[2 * i + 1] * B[2 * i].  */
+    a = *pSrcA++;
+    b = *pSrcA++;
+    c = *pSrcB++;
+    d = *pSrcB++;
+
+    real = (((q31_t) a * c) - ((q31_t) b * d)) >> 17;
+    imag = (q31_t) ((((q63_t) a * d) + ((q31_t) b * c)) >> 17);
+
+    /* accumulate the product in 3.13 format in the destination buffer. */
+    *pDst = (q15_t) __SSAT(*pDst + real, 16);
+    pDst++;
+    *pDst = (q15_t) __SSAT(*pDst + imag, 16);
+    pDst++;
+
+    /* Decrement the loop counter */
+    numSamples--;
+  }
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+}
+
+/**
+ * @} end of CmplxMac group
+ */
@@ -0,0 +1,130 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cmplx_mac_q31.c
+*
+* Description:	Q31 complex multiply-accumulate.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup CmplxMac
+ * @{
+ */
+
+/**
+ * @brief  Q31 complex multiply-accumulate.
+ * @param[in]      *pSrcA points to the first input vector.
+ * @param[in]      *pSrcB points to the second input vector.
+ * @param[in,out]  *pDst points to the vector the products are added to.
+ * @param[in]      numSamples number of complex samples in each vector.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function implements 1.31 by 1.31 multiplications and the products are converted into
+ * 3.29 format before they are summed, as in arm_cmplx_mult_cmplx_q31().  The addition to
+ * <code>pDst</code> saturates.
+ */
+
+void arm_cmplx_mac_q31(
+  q31_t * pSrcA,
+  q31_t * pSrcB,
+  q31_t * pDst,
+  uint32_t numSamples)
+{
+  q31_t a, b, c, d;                              /* Temporary variables to store real and imaginary values */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* loop Unrolling */
+  blkCnt = numSamples >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C[2 * i] += A[2 * i] * B[2 * i] - A[2 * i + 1] * B[2 * i + 1].  */
+    /* C[2 * i + 1] += A[2 * i] * B[2 * i + 1] + A[2 * i + 1] * B[2 * i].  */
+    a = pSrcA[0];
+    b = pSrcA[1];
+    c = pSrcB[0];
+    d = pSrcB[1];
+    pDst[0] = __QADD(pDst[0], (q31_t) (((q63_t) a * c) >> 33) - (q31_t) (((q63_t) b * d) >> 33));
+    pDst[1] = __QADD(pDst[1], (q31_t) (((q63_t) a * d) >> 33) + (q31_t) (((q63_t) b * c) >> 33));
+
+    a = pSrcA[2];
+    b = pSrcA[3];
+    c = pSrcB[2];
+    d = pSrcB[3];
+    pDst[2] = __QADD(pDst[2], (q31_t) (((q63_t) a * c) >> 33) - (q31_t) (((q63_t) b * d) >> 33));
+    pDst[3] = __QADD(pDst[3], (q31_t) (((q63_t) a * d) >> 33) + (q31_t) (((q63_t) b * c) >> 33));
+
+    a = pSrcA[4];
+    b = pSrcA[5];
+    c = pSrcB[4];
+    d = pSrcB[5];
+    pDst[4] = __QADD(pDst[4], (q31_t) (((q63_t) a * c) >> 33) - (q31_t) (((q63_t) b * d) >> 33));
+    pDst[5] = __QADD(pDst[5], (q31_t) (((q63_t) a * d) >> 33) + (q31_t) (((q63_t) b * c) >> 33));
+
+    a = pSrcA[6];
+    b = pSrcA[7];
+    c = pSrcB[6];
+    d = pSrcB[7];
+    pDst[6] = __QADD(pDst[6], (q31_t) (((q63_t) a * c) >> 33) - (q31_t) (((q63_t) b * d) >> 33));
+    pDst[7] = __QADD(pDst[7], (q31_t) (((q63_t) a * d) >> 33) + (q31_t) (((q63_t) b * c) >> 33));
+
+    pSrcA += 8u;
+    pSrcB += 8u;
+    pDst += 8u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the numSamples is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = numSamples % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+  uint32_t blkCnt = numSamples;                  /* loop counter */
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    a = *pSrcA++;
+    b = *pSrcA++;
+    c = *pSrcB++;
+    d = *pSrcB++;
+
+    /* accumulate the product in 3.29 format in the destination buffer. */
+    pDst[0] = __QADD(pDst[0], (q31_t) (((q63_t) a * c) >> 33) - (q31_t) (((q63_t) b * d) >> 33));
+    pDst[1] = __QADD(pDst[1], (q31_t) (((q63_t) a * d) >> 33) + (q31_t) (((q63_t) b * c) >> 33));
+    pDst += 2u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+}
+
+/**
+ * @} end of CmplxMac group
+ */
@@ -0,0 +1,167 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cmplx_mag_squared_acc_f32.c
+*
+* Description:	Floating-point complex magnitude squared with accumulation.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup CmplxMac
+ * @{
+ */
+
+/**
+ * @brief  Floating-point complex magnitude squared with accumulation.
+ * @param[in]      *pSrc points to the complex input vector.
+ * @param[in,out]  *pDst points to the real vector the magnitudes squared are added to.
+ * @param[in]      numSamples number of complex samples in the input vector.
+ * @return none.
+ */
+
+void arm_cmplx_mag_squared_acc_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t numSamples)
+{
+  float32_t real, imag;                          /* Temporary variables to store real and imaginary values */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* loop Unrolling */
+  blkCnt = numSamples >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C[i] += A[2 * i] * A[2 * i] + A[2 * i + 1] * A[2 * i + 1].  */
+    real = pSrc[0];
+    imag = pSrc[1];
+    pDst[0] += (real * real) + (imag * imag);
+
+    real = pSrc[2];
+    imag = pSrc[3];
+    pDst[1] += (real * real) + (imag * imag);
+
+    real = pSrc[4];
+    imag = pSrc[5];
+    pDst[2] += (real * real) + (imag * imag);
+
+    real = pSrc[6];
+    imag = pSrc[7];
+    pDst[3] += (real * real) + (imag * imag);
+
+    pSrc += 8u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the numSamples is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = numSamples % 0x4u;
+
+  while(blkCnt > 0u)
+  {
+    real = *pSrc++;
+    imag = *pSrc++;
+    *pDst++ += (real * real) + (imag * imag);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+#if defined (ARM_MATH_SSE2)
+
+  /* Host build: 4 complex samples per SSE2 operation */
+  {
+    __m128 vLo, vHi;
+    uint32_t blkCnt = numSamples >> 2u;
+
+    while(blkCnt > 0u)
+    {
+      /* the squares, then the sums of the even and the odd lanes */
+      vLo = _mm_loadu_ps(pSrc);
+      vHi = _mm_loadu_ps(pSrc + 4);
+      vLo = _mm_mul_ps(vLo, vLo);
+      vHi = _mm_mul_ps(vHi, vHi);
+      vLo = _mm_add_ps(_mm_shuffle_ps(vLo, vHi, _MM_SHUFFLE(2, 0, 2, 0)),
+                       _mm_shuffle_ps(vLo, vHi, _MM_SHUFFLE(3, 1, 3, 1)));
+      _mm_storeu_ps(pDst, _mm_add_ps(_mm_loadu_ps(pDst), vLo));
+
+      pSrc += 8u;
+      pDst += 4u;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Compute the remaining 1 to 3 samples below */
+    numSamples = numSamples % 0x4u;
+  }
+
+#elif defined (ARM_MATH_NEON)
+
+  /* Host build: 4 complex samples per NEON operation */
+  {
+    float32x4x2_t vIn;
+    uint32_t blkCnt = numSamples >> 2u;
+
+    while(blkCnt > 0u)
+    {
+      vIn = vld2q_f32(pSrc);
+      vst1q_f32(pDst, vaddq_f32(vld1q_f32(pDst),
+                                vaddq_f32(vmulq_f32(vIn.val[0], vIn.val[0]), vmulq_f32(vIn.val[1], vIn.val[1]))));
+
+      pSrc += 8u;
+      pDst += 4u;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Compute the remaining 1 to 3 samples below */
+    numSamples = numSamples % 0x4u;
+  }
+
+#endif /* #if defined (ARM_MATH_SSE2) */
+
+  while(numSamples > 0u)
+  {
+    /* C[i] += A[2 * i] * A[2 * i] + A[2 * i + 1] * A[2 * i + 1].  */
+    real = *pSrc++;
+    imag = *pSrc++;
+    *pDst++ += (real * real) + (imag * imag);
+
+    /* Decrement the loop counter */
+    numSamples--;
+  }
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+}
+
+/**
+ * @} end of CmplxMac group
+ */
@@ -0,0 +1,175 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cmplx_mag_squared_acc_q15.c
+*
+* Description:	Q15 complex magnitude squared with accumulation.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup CmplxMac
+ * @{
+ */
+
+/**
+ * @brief  Q15 complex magnitude squared with accumulation.
+ * @param[in]      *pSrc points to the complex input vector.
+ * @param[in,out]  *pDst points to the real vector the magnitudes squared are added to.
+ * @param[in]      numSamples number of complex samples in the input vector.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function implements 1.15 by 1.15 multiplications and the magnitudes squared are
+ * converted into 3.13 format, as in arm_cmplx_mag_squared_q15().  The addition to
+ * <code>pDst</code> saturates.
+ */
+
+void arm_cmplx_mag_squared_acc_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t numSamples)
+{
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  q31_t in1, in2;                                /* Temporary variables to hold complex samples */
+  q31_t acc0, acc1;                              /* Magnitudes squared */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* loop Unrolling */
+  blkCnt = numSamples >> 1u;
+
+  /* First part of the processing with loop unrolling.  Compute 2 outputs at a time.
+   ** a second loop below computes the remaining sample. */
+  while(blkCnt > 0u)
+  {
+    /* C[i] += A[2 * i] * A[2 * i] + A[2 * i + 1] * A[2 * i + 1].  */
+    in1 = *__SIMD32(pSrc)++;
+    in2 = *__SIMD32(pSrc)++;
+
+    /* the sum reaches 2^31 for -1 inputs, so it is accumulated in 64 bits */
+    acc0 = (q31_t) (__SMLALD(in1, in1, 0) >> 17);
+    acc1 = (q31_t) (__SMLALD(in2, in2, 0) >> 17);
+
+#ifndef ARM_MATH_BIG_ENDIAN
+
+    *__SIMD32(pDst) = __QADD16(*__SIMD32(pDst), __PKHBT(acc0, acc1, 16));
+
+#else
+
+    *__SIMD32(pDst) = __QADD16(*__SIMD32(pDst), __PKHBT(acc1, acc0, 16));
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+    pDst += 2u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the numSamples is odd, compute the last sample here */
+  if((numSamples & 0x1u) != 0u)
+  {
+    in1 = *__SIMD32(pSrc);
+    acc0 = (q31_t) (__SMLALD(in1, in1, 0) >> 17);
+    *pDst = (q15_t) __SSAT(*pDst + acc0, 16);
+  }
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+  q15_t real, imag;                              /* Temporary variables to store real and imaginary values */
+  q31_t acc0;                                    /* Magnitude squared */
+
+#if defined (ARM_MATH_SSE2)
+
+  /* Host build: 8 complex samples per SSE2 operation.  _mm_madd_epi16 sums the squares of
+   ** a sample, and as the sum is not negative a logical shift handles the sum of 2^31. */
+  {
+    __m128i vLo, vHi;
+    uint32_t blkCnt = numSamples >> 3u;
+
+    while(blkCnt > 0u)
+    {
+      vLo = _mm_loadu_si128((__m128i *) pSrc);
+      vHi = _mm_loadu_si128((__m128i *) (pSrc + 8));
+      vLo = _mm_srli_epi32(_mm_madd_epi16(vLo, vLo), 17);
+      vHi = _mm_srli_epi32(_mm_madd_epi16(vHi, vHi), 17);
+      _mm_storeu_si128((__m128i *) pDst,
+                       _mm_adds_epi16(_mm_loadu_si128((__m128i *) pDst), _mm_packs_epi32(vLo, vHi)));
+
+      pSrc += 16u;
+      pDst += 8u;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Compute the remaining 1 to 7 samples below */
+    numSamples = numSamples % 0x8u;
+  }
+
+#elif defined (ARM_MATH_NEON)
+
+  /* Host build: 4 complex samples per NEON operation.  As the sum of the squares is not
+   ** negative, an unsigned shift handles the sum of 2^31. */
+  {
+    int16x4x2_t vIn;
+    uint32x4_t vSum;
+    uint32_t blkCnt = numSamples >> 2u;
+
+    while(blkCnt > 0u)
+    {
+      vIn = vld2_s16(pSrc);
+      vSum = vreinterpretq_u32_s32(vmlal_s16(vmull_s16(vIn.val[0], vIn.val[0]), vIn.val[1], vIn.val[1]));
+      vst1_s16(pDst, vqadd_s16(vld1_s16(pDst), vreinterpret_s16_u16(vmovn_u32(vshrq_n_u32(vSum, 17)))));
+
+      pSrc += 8u;
+      pDst += 4u;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Compute the remaining 1 to 3 samples below */
+    numSamples = numSamples % 0x4u;
+  }
+
+#endif /* #if defined (ARM_MATH_SSE2) */
+
+  while(numSamples > 0u)
+  {
+    /* C[i] += A[2 * i] * A[2 * i] + A[2 * i + 1] * A[2 * i + 1].  */
+    real = *pSrc++;
+    imag = *pSrc++;
+    acc0 = (q31_t) ((((q63_t) real * real) + ((q31_t) imag * imag)) >> 17);
+
+    /* accumulate the result in 3.13 format in the destination buffer. */
+    *pDst = (q15_t) __SSAT(*pDst + acc0, 16);
+    pDst++;
+
+    /* Decrement the loop counter */
+    numSamples--;
+  }
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+}
+
+/**
+ * @} end of CmplxMac group
+ */
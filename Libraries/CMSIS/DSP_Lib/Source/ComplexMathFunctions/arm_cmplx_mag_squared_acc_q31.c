@@ -0,0 +1,111 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cmplx_mag_squared_acc_q31.c
+*
+* Description:	Q31 complex magnitude squared with accumulation.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup CmplxMac
+ * @{
+ */
+
+/**
+ * @brief  Q31 complex magnitude squared with accumulation.
+ * @param[in]      *pSrc points to the complex input vector.
+ * @param[in,out]  *pDst points to the real vector the magnitudes squared are added to.
+ * @param[in]      numSamples number of complex samples in the input vector.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function implements 1.31 by 1.31 multiplications and the squares are converted into
+ * 3.29 format before they are summed, as in arm_cmplx_mag_squared_q31().  The addition to
+ * <code>pDst</code> saturates.
+ */
+
+void arm_cmplx_mag_squared_acc_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t numSamples)
+{
+  q31_t real, imag;                              /* Temporary variables to store real and imaginary values */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* loop Unrolling */
+  blkCnt = numSamples >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C[i] += A[2 * i] * A[2 * i] + A[2 * i + 1] * A[2 * i + 1].  */
+    real = pSrc[0];
+    imag = pSrc[1];
+    pDst[0] = __QADD(pDst[0], (q31_t) (((q63_t) real * real) >> 33) + (q31_t) (((q63_t) imag * imag) >> 33));
+
+    real = pSrc[2];
+    imag = pSrc[3];
+    pDst[1] = __QADD(pDst[1], (q31_t) (((q63_t) real * real) >> 33) + (q31_t) (((q63_t) imag * imag) >> 33));
+
+    real = pSrc[4];
+    imag = pSrc[5];
+    pDst[2] = __QADD(pDst[2], (q31_t) (((q63_t) real * real) >> 33) + (q31_t) (((q63_t) imag * imag) >> 33));
+
+    real = pSrc[6];
+    imag = pSrc[7];
+    pDst[3] = __QADD(pDst[3], (q31_t) (((q63_t) real * real) >> 33) + (q31_t) (((q63_t) imag * imag) >> 33));
+
+    pSrc += 8u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the numSamples is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = numSamples % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+  uint32_t blkCnt = numSamples;                  /* loop counter */
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    real = *pSrc++;
+    imag = *pSrc++;
+
+    /* accumulate the result in 3.29 format in the destination buffer. */
+    *pDst = __QADD(*pDst, (q31_t) (((q63_t) real * real) >> 33) + (q31_t) (((q63_t) imag * imag) >> 33));
+    pDst++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+}
+
+/**
+ * @} end of CmplxMac group
+ */
@@ -132,6 +132,62 @@ void arm_cmplx_mag_squared_f32(
 
   /* Run the below code for Cortex-M0 */
 
+#if defined (ARM_MATH_SSE2)
+
+  /* Host build: 4 complex samples per SSE2 operation */
+  {
+    __m128 v0, v1;
+    uint32_t blkCnt = numSamples >> 2u;
+
+    while(blkCnt > 0u)
+    {
+      /* Square {r0, i0, r1, i1} and {r2, i2, r3, i3} */
+      v0 = _mm_loadu_ps(pSrc);
+      v1 = _mm_loadu_ps(pSrc + 4);
+      v0 = _mm_mul_ps(v0, v0);
+      v1 = _mm_mul_ps(v1, v1);
+
+      /* Add the squared real parts to the squared imaginary parts */
+      _mm_storeu_ps(pDst, _mm_add_ps(_mm_shuffle_ps(v0, v1, _MM_SHUFFLE(2, 0, 2, 0)),
+                                     _mm_shuffle_ps(v0, v1, _MM_SHUFFLE(3, 1, 3, 1))));
+
+      pSrc += 8u;
+      pDst += 4u;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Compute the remaining 1 to 3 samples below */
+    numSamples = numSamples % 0x4u;
+  }
+
+#elif defined (ARM_MATH_NEON)
+
+  /* Host build: 4 complex samples per NEON operation */
+  {
+    float32x4x2_t vIn;
+    uint32_t blkCnt = numSamples >> 2u;
+
+    while(blkCnt > 0u)
+    {
+      /* De-interleave the real and imaginary parts */
+      vIn = vld2q_f32(pSrc);
+      vst1q_f32(pDst, vaddq_f32(vmulq_f32(vIn.val[0], vIn.val[0]), vmulq_f32(vIn.val[1], vIn.val[1])));
+
+      pSrc += 8u;
+      pDst += 4u;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Compute the remaining 1 to 3 samples below */
+    numSamples = numSamples % 0x4u;
+  }
+
+#endif /* #if defined (ARM_MATH_SSE2) */
+
   while(numSamples > 0u)
   {
     /* reading real and imaginary values */
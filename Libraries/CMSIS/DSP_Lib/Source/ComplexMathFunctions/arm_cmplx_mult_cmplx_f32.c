@@ -154,6 +154,71 @@ void arm_cmplx_mult_cmplx_f32(
 
   /* Run the below code for Cortex-M0 */
 
+#if defined (ARM_MATH_SSE2)
+
+  /* Host build: 2 complex samples per SSE2 operation */
+  {
+    __m128 vA, vB, vRe, vIm;
+    const __m128 vSign = _mm_castsi128_ps(_mm_set_epi32(0, (int32_t) 0x80000000, 0, (int32_t) 0x80000000));
+    uint32_t blkCnt = numSamples >> 1u;
+
+    while(blkCnt > 0u)
+    {
+      /* vA = {a0, b0, a1, b1}, vB = {c0, d0, c1, d1} */
+      vA = _mm_loadu_ps(pSrcA);
+      vB = _mm_loadu_ps(pSrcB);
+
+      /* {a * c, a * d} and {b * d, b * c} */
+      vRe = _mm_mul_ps(_mm_shuffle_ps(vA, vA, _MM_SHUFFLE(2, 2, 0, 0)), vB);
+      vIm = _mm_mul_ps(_mm_shuffle_ps(vA, vA, _MM_SHUFFLE(3, 3, 1, 1)),
+                       _mm_shuffle_ps(vB, vB, _MM_SHUFFLE(2, 3, 0, 1)));
+
+      /* {a * c - b * d, a * d + b * c} */
+      _mm_storeu_ps(pDst, _mm_add_ps(vRe, _mm_xor_ps(vIm, vSign)));
+
+      pSrcA += 4u;
+      pSrcB += 4u;
+      pDst += 4u;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Compute the last sample below */
+    numSamples = numSamples & 0x1u;
+  }
+
+#elif defined (ARM_MATH_NEON)
+
+  /* Host build: 4 complex samples per NEON operation */
+  {
+    float32x4x2_t vA, vB, vOut;
+    uint32_t blkCnt = numSamples >> 2u;
+
+    while(blkCnt > 0u)
+    {
+      /* De-interleave the real and imaginary parts */
+      vA = vld2q_f32(pSrcA);
+      vB = vld2q_f32(pSrcB);
+
+      vOut.val[0] = vsubq_f32(vmulq_f32(vA.val[0], vB.val[0]), vmulq_f32(vA.val[1], vB.val[1]));
+      vOut.val[1] = vaddq_f32(vmulq_f32(vA.val[0], vB.val[1]), vmulq_f32(vA.val[1], vB.val[0]));
+      vst2q_f32(pDst, vOut);
+
+      pSrcA += 8u;
+      pSrcB += 8u;
+      pDst += 8u;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Compute the remaining 1 to 3 samples below */
+    numSamples = numSamples % 0x4u;
+  }
+
+#endif /* #if defined (ARM_MATH_SSE2) */
+
   while(numSamples > 0u)
   {
     /* C[2 * i] = A[2 * i] * B[2 * i] - A[2 * i + 1] * B[2 * i + 1].  */
@@ -0,0 +1,328 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cos_block_q15.c
+*
+* Description:	Fast cosine calculation for a block of Q15 values.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup cos
+ * @{
+ */
+
+/**
+ * @brief  Cosine of one phase.
+ * @param[in]  in phase in [0 1) turns, in 1.15 format.
+ * @return the cosine.
+ */
+
+static __INLINE q15_t arm_cos_block_sample_q15(
+  uint32_t in)
+{
+  q31_t sinVal;                                  /* Temporary variable for output */
+  q31_t wa, wb, wc, wd;                          /* Cubic interpolation coefficients */
+  q15_t fract, fractCube, fractSquare;           /* Temporary values for fractional value */
+  q15_t oneBy6 = 0x1555;                         /* Fixed point value of 1/6 */
+  q15_t *tablePtr;                               /* Pointer to table */
+
+  /* Table index from the upper bits, fractional value from the lower bits */
+  tablePtr = (q15_t *) &sinTable_q15[in >> 7u];
+  fract = (q15_t) ((in & 0x7Fu) << 8u);
+
+  fractSquare = (q15_t) ((fract * fract) >> 15);
+  fractCube = (q15_t) ((fractSquare * fract) >> 15);
+
+  /* Cubic interpolation as in arm_cos_q15() */
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /* oneBy6 * fractCube + 0x2AAA * fract with one dual multiply */
+  wa = __SMUAD(__PKHBT(fractCube, fract, 16), 0x2AAA1555);
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  wa = (q31_t) oneBy6 *fractCube;
+  wa += (q31_t) 0x2AAA *fract;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  wa = -(wa >> 15);
+  wa += ((q31_t) fractSquare >> 1u);
+
+  wb = (((q31_t) fractCube >> 1u) - (q31_t) fractSquare) -
+    (((q31_t) fract >> 1u) - 0x7FFF);
+
+  wc = -(q31_t) fractCube + fractSquare;
+  wc = (wc >> 1u) + fract;
+
+  fractCube = fractCube - fract;
+  wd = ((q15_t) (((q31_t) oneBy6 * fractCube) >> 15));
+
+#ifndef ARM_MATH_CM0
+
+  /* The weights all fit in 16 bits: the table values are read in pairs and
+   ** weighted with two dual multiply accumulates */
+#ifndef  ARM_MATH_BIG_ENDIAN
+
+  sinVal = __SMUAD(*__SIMD32(tablePtr)++, __PKHBT(wa, wb, 16));
+  sinVal = __SMLAD(*__SIMD32(tablePtr), __PKHBT(wc, wd, 16), sinVal);
+
+#else
+
+  sinVal = __SMUAD(*__SIMD32(tablePtr)++, __PKHBT(wb, wa, 16));
+  sinVal = __SMLAD(*__SIMD32(tablePtr), __PKHBT(wd, wc, 16), sinVal);
+
+#endif /* #ifndef  ARM_MATH_BIG_ENDIAN    */
+
+#else
+
+  sinVal = tablePtr[0] * wa;
+  sinVal += tablePtr[1] * wb;
+  sinVal += tablePtr[2] * wc;
+  sinVal += tablePtr[3] * wd;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  /* Output in 1.15 format */
+  return ((q15_t) (sinVal >> 15u));
+}
+
+/**
+ * @brief  Fast approximation to the trigonometric cosine function for a block of Q15 data.
+ * @param[in]  *pSrc points to the scaled input values
+ * @param[out] *pDst points to the output values
+ * @param[in]  blockSize number of values to compute
+ * @return none.
+ *
+ * \par
+ * The input is a phase in turns: the range [0 +1) is mapped to [0 2*pi), as for
+ * arm_cos_q15(), and negative inputs are taken modulo one turn, so the range [-1 0)
+ * is mapped to [-2*pi 0).  The results are those of arm_cos_q15() for inputs in [0 +1).
+ * The Cortex-M4 code weights the table values with dual 16 bit multiplies and the
+ * vector paths interpolate 8 (SSE2) or 4 (NEON) values at a time, with the same results.
+ */
+
+void arm_cos_block_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /* loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* Phases modulo one turn, a quarter turn ahead for the cosine */
+    *pDst++ = arm_cos_block_sample_q15(((uint32_t) *pSrc++ + 0x2000u) & 0x7FFFu);
+    *pDst++ = arm_cos_block_sample_q15(((uint32_t) *pSrc++ + 0x2000u) & 0x7FFFu);
+    *pDst++ = arm_cos_block_sample_q15(((uint32_t) *pSrc++ + 0x2000u) & 0x7FFFu);
+    *pDst++ = arm_cos_block_sample_q15(((uint32_t) *pSrc++ + 0x2000u) & 0x7FFFu);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+#if defined (ARM_MATH_SSE2)
+
+  __m128i in, idx;                               /* Phases and table indices */
+  __m128i fract, fractSquare, fractCube;         /* Fractional values and their powers */
+  __m128i wa, wb, wc, wd;                        /* Cubic interpolation coefficients */
+  __m128i wab, wcd, w0, w1, w2, w3;              /* Coefficients interleaved per value */
+  __m128i s0, s1, lo, hi;                        /* Partial and complete sums */
+
+  /* Host build: compute 8 values per SSE2 operation */
+  blkCnt = blockSize >> 3u;
+
+  while(blkCnt > 0u)
+  {
+    /* Phases modulo one turn, a quarter turn ahead for the cosine */
+    in = _mm_and_si128(_mm_add_epi16(_mm_loadu_si128((__m128i *) pSrc), _mm_set1_epi16(0x2000)),
+                       _mm_set1_epi16(0x7FFF));
+
+    /* Table indices from the upper bits, fractional values from the lower bits */
+    idx = _mm_srli_epi16(in, 7);
+    fract = _mm_slli_epi16(_mm_and_si128(in, _mm_set1_epi16(0x7F)), 8);
+
+    /* (a * b) >> 15 is put together from the high and the low halves of the products */
+    fractSquare = _mm_or_si128(_mm_slli_epi16(_mm_mulhi_epi16(fract, fract), 1),
+                               _mm_srli_epi16(_mm_mullo_epi16(fract, fract), 15));
+    fractCube = _mm_or_si128(_mm_slli_epi16(_mm_mulhi_epi16(fractSquare, fract), 1),
+                             _mm_srli_epi16(_mm_mullo_epi16(fractSquare, fract), 15));
+
+    /* Cubic interpolation as in arm_cos_q15(): oneBy6 * fractCube + 0x2AAA * fract
+     * with the pairwise multiply add in 32 bits */
+    lo = _mm_madd_epi16(_mm_unpacklo_epi16(fractCube, fract), _mm_set1_epi32(0x2AAA1555));
+    hi = _mm_madd_epi16(_mm_unpackhi_epi16(fractCube, fract), _mm_set1_epi32(0x2AAA1555));
+    wa = _mm_sub_epi16(_mm_srai_epi16(fractSquare, 1),
+                       _mm_packs_epi32(_mm_srai_epi32(lo, 15), _mm_srai_epi32(hi, 15)));
+
+    wb = _mm_sub_epi16(_mm_sub_epi16(_mm_srai_epi16(fractCube, 1), fractSquare),
+                       _mm_sub_epi16(_mm_srai_epi16(fract, 1), _mm_set1_epi16(0x7FFF)));
+
+    wc = _mm_add_epi16(_mm_srai_epi16(_mm_sub_epi16(fractSquare, fractCube), 1), fract);
+
+    fractCube = _mm_sub_epi16(fractCube, fract);
+    wd = _mm_or_si128(_mm_slli_epi16(_mm_mulhi_epi16(_mm_set1_epi16(0x1555), fractCube), 1),
+                      _mm_srli_epi16(_mm_mullo_epi16(_mm_set1_epi16(0x1555), fractCube), 15));
+
+    /* Interleave the weights as wa wb wc wd per value, two values per vector */
+    wab = _mm_unpacklo_epi16(wa, wb);
+    wcd = _mm_unpacklo_epi16(wc, wd);
+    w0 = _mm_unpacklo_epi32(wab, wcd);
+    w1 = _mm_unpackhi_epi32(wab, wcd);
+    wab = _mm_unpackhi_epi16(wa, wb);
+    wcd = _mm_unpackhi_epi16(wc, wd);
+    w2 = _mm_unpacklo_epi32(wab, wcd);
+    w3 = _mm_unpackhi_epi32(wab, wcd);
+
+    /* The four nearest table values of a value are contiguous, 64 bits.  Each
+     * multiply add gives the two partial sums of two values, which are then added */
+    s0 = _mm_madd_epi16(_mm_unpacklo_epi64(
+                          _mm_loadl_epi64((__m128i *) &sinTable_q15[_mm_extract_epi16(idx, 0)]),
+                          _mm_loadl_epi64((__m128i *) &sinTable_q15[_mm_extract_epi16(idx, 1)])), w0);
+    s1 = _mm_madd_epi16(_mm_unpacklo_epi64(
+                          _mm_loadl_epi64((__m128i *) &sinTable_q15[_mm_extract_epi16(idx, 2)]),
+                          _mm_loadl_epi64((__m128i *) &sinTable_q15[_mm_extract_epi16(idx, 3)])), w1);
+    lo = _mm_add_epi32(
+           _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(s0), _mm_castsi128_ps(s1), 0x88)),
+           _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(s0), _mm_castsi128_ps(s1), 0xDD)));
+
+    s0 = _mm_madd_epi16(_mm_unpacklo_epi64(
+                          _mm_loadl_epi64((__m128i *) &sinTable_q15[_mm_extract_epi16(idx, 4)]),
+                          _mm_loadl_epi64((__m128i *) &sinTable_q15[_mm_extract_epi16(idx, 5)])), w2);
+    s1 = _mm_madd_epi16(_mm_unpacklo_epi64(
+                          _mm_loadl_epi64((__m128i *) &sinTable_q15[_mm_extract_epi16(idx, 6)]),
+                          _mm_loadl_epi64((__m128i *) &sinTable_q15[_mm_extract_epi16(idx, 7)])), w3);
+    hi = _mm_add_epi32(
+           _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(s0), _mm_castsi128_ps(s1), 0x88)),
+           _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(s0), _mm_castsi128_ps(s1), 0xDD)));
+
+    /* Output in 1.15 format; the sums never leave the 16 bit range after the shift */
+    _mm_storeu_si128((__m128i *) pDst, _mm_packs_epi32(_mm_srai_epi32(lo, 15), _mm_srai_epi32(hi, 15)));
+    pSrc += 8u;
+    pDst += 8u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Compute the remaining 1 to 7 samples below */
+  blkCnt = blockSize % 0x8u;
+
+#elif defined (ARM_MATH_NEON)
+
+  int16x4_t in, fract, fractSquare, fractCube;   /* Phases, fractional values and their powers */
+  int16x4_t wa, wb, wc, wd;                      /* Cubic interpolation coefficients */
+  int16x4_t t0, t1, t2, t3;                      /* Table values, one row per value at first */
+  int16x4x2_t t01, t23;                          /* Half transposed table values */
+  int32x2x2_t t02, t13;                          /* Transposed table values */
+  uint16x4_t idx;                                /* Table indices */
+  int32x4_t acc;                                 /* Weighted sums */
+
+  /* Host build: compute 4 values per NEON operation */
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    /* Phases modulo one turn, a quarter turn ahead for the cosine */
+    in = vand_s16(vadd_s16(vld1_s16(pSrc), vdup_n_s16(0x2000)), vdup_n_s16(0x7FFF));
+
+    /* Table indices from the upper bits, fractional values from the lower bits */
+    idx = vshr_n_u16(vreinterpret_u16_s16(in), 7);
+    fract = vshl_n_s16(vand_s16(in, vdup_n_s16(0x7F)), 8);
+
+    fractSquare = vshrn_n_s32(vmull_s16(fract, fract), 15);
+    fractCube = vshrn_n_s32(vmull_s16(fractSquare, fract), 15);
+
+    /* Cubic interpolation as in arm_cos_q15() */
+    wa = vsub_s16(vshr_n_s16(fractSquare, 1),
+                  vshrn_n_s32(vmlal_n_s16(vmull_n_s16(fractCube, 0x1555), fract, 0x2AAA), 15));
+    wb = vsub_s16(vsub_s16(vshr_n_s16(fractCube, 1), fractSquare),
+                  vsub_s16(vshr_n_s16(fract, 1), vdup_n_s16(0x7FFF)));
+    wc = vadd_s16(vshr_n_s16(vsub_s16(fractSquare, fractCube), 1), fract);
+    fractCube = vsub_s16(fractCube, fract);
+    wd = vshrn_n_s32(vmull_n_s16(fractCube, 0x1555), 15);
+
+    /* The four nearest table values of each input are contiguous: load them as rows
+     * and transpose them to one vector per tap */
+    t0 = vld1_s16(&sinTable_q15[vget_lane_u16(idx, 0)]);
+    t1 = vld1_s16(&sinTable_q15[vget_lane_u16(idx, 1)]);
+    t2 = vld1_s16(&sinTable_q15[vget_lane_u16(idx, 2)]);
+    t3 = vld1_s16(&sinTable_q15[vget_lane_u16(idx, 3)]);
+    t01 = vtrn_s16(t0, t1);
+    t23 = vtrn_s16(t2, t3);
+    t02 = vtrn_s32(vreinterpret_s32_s16(t01.val[0]), vreinterpret_s32_s16(t23.val[0]));
+    t13 = vtrn_s32(vreinterpret_s32_s16(t01.val[1]), vreinterpret_s32_s16(t23.val[1]));
+
+    acc = vmull_s16(vreinterpret_s16_s32(t02.val[0]), wa);
+    acc = vmlal_s16(acc, vreinterpret_s16_s32(t13.val[0]), wb);
+    acc = vmlal_s16(acc, vreinterpret_s16_s32(t02.val[1]), wc);
+    acc = vmlal_s16(acc, vreinterpret_s16_s32(t13.val[1]), wd);
+
+    /* Output in 1.15 format */
+    vst1_s16(pDst, vshrn_n_s32(acc, 15));
+    pSrc += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Compute the remaining 1 to 3 samples below */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_SSE2) */
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    /* Phase modulo one turn, a quarter turn ahead for the cosine */
+    *pDst++ = arm_cos_block_sample_q15(((uint32_t) *pSrc++ + 0x2000u) & 0x7FFFu);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of cos group
+ */
@@ -0,0 +1,49 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_db_to_lin_f32.c
+*
+* Description:	Conversion of decibels to floating-point amplitudes.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup Decibel
+ * @{
+ */
+
+/**
+ * @brief  Converts a block of levels in decibels to floating-point amplitudes.
+ * @param[in]  *pSrc points to the input values in dB
+ * @param[out] *pDst points to the output values
+ * @param[in]  blockSize number of values to compute
+ * @return none.
+ *
+ * \par
+ * Levels below -758.6 dB give zero.
+ */
+
+void arm_db_to_lin_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  /* 10^(x / 20) = 2^(x * log2(10) / 20) */
+  arm_scale_f32(pSrc, 0.166096405f, pDst, blockSize);
+  arm_exp2_f32(pDst, pDst, blockSize);
+}
+
+/**
+ * @} end of Decibel group
+ */
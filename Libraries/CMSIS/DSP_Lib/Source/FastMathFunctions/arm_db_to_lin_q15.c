@@ -0,0 +1,86 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_db_to_lin_q15.c
+*
+* Description:	Conversion of decibels to Q15 amplitudes.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup Decibel
+ * @{
+ */
+
+/**
+ * @brief  Converts a block of levels in decibels to Q15 amplitudes.
+ * @param[in]  *pSrc points to the input values, dB / 128 in 1.15 format
+ * @param[out] *pDst points to the output values
+ * @param[in]  blockSize number of values to compute
+ * @return none.
+ *
+ * \par
+ * The levels are scaled to the Q31 input of arm_exp2_q31() and the amplitudes are
+ * rounded to 1.15 format, so the absolute error is below 0.52 of a step, 2^-15, for
+ * all levels.  Levels below -96.3 dB give zero and levels of 0 dB and above give the
+ * largest amplitude.
+ */
+
+void arm_db_to_lin_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t buf[32];                                 /* Levels and amplitudes of a chunk in Q31 */
+  q31_t *pBuf;                                   /* Pointer into the chunk */
+  uint32_t chunk;                                /* Values of the chunk */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+  uint32_t i;                                    /* loop counter of the chunk */
+
+  while(blkCnt > 0u)
+  {
+    chunk = (blkCnt < 32u) ? blkCnt : 32u;
+
+    /* log2(x) / 32 = dB / 128 * 4 / (20 * log10(2)) = dB / 128 * 0.664386.  A Q15
+     * intermediate would step by 0.034% of the amplitude, 11 steps of the result
+     * near 0 dB, so the product is kept in Q31 */
+    pBuf = buf;
+    i = chunk;
+
+    while(i > 0u)
+    {
+      *pBuf++ = (q31_t) (((q63_t) * pSrc++ * 0x550A9685) >> 15);
+      i--;
+    }
+
+    arm_exp2_q31(buf, buf, chunk);
+
+    /* Round the amplitudes to 1.15 format, the ones within half a step of one saturate */
+    pBuf = buf;
+    i = chunk;
+
+    while(i > 0u)
+    {
+      *pDst++ = (q15_t) __SSAT(((*pBuf++ >> 15) + 1) >> 1, 16);
+      i--;
+    }
+
+    /* Decrement the loop counter */
+    blkCnt -= chunk;
+  }
+}
+
+/**
+ * @} end of Decibel group
+ */
@@ -0,0 +1,51 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_db_to_lin_q31.c
+*
+* Description:	Conversion of decibels to Q31 amplitudes.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup Decibel
+ * @{
+ */
+
+/**
+ * @brief  Converts a block of levels in decibels to Q31 amplitudes.
+ * @param[in]  *pSrc points to the input values, dB / 256 in 1.31 format
+ * @param[out] *pDst points to the output values
+ * @param[in]  blockSize number of values to compute
+ * @return none.
+ *
+ * \par
+ * The relative error is below 2e-6 for levels above -60 dB.  Levels below
+ * -186.6 dB give the smallest step and levels of 0 dB and above give the largest
+ * amplitude.
+ */
+
+void arm_db_to_lin_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  /* log2(x) / 32 = dB / 256 * 8 / (20 * log10(2)), the factor 1.328771 being 0.664386 * 2^1 */
+  arm_scale_q31(pSrc, 0x550A9685, 1, pDst, blockSize);
+  arm_exp2_q31(pDst, pDst, blockSize);
+}
+
+/**
+ * @} end of Decibel group
+ */
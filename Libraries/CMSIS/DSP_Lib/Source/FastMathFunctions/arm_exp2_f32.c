@@ -0,0 +1,277 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_exp2_f32.c
+*
+* Description:	Fast base-2 exponential of a block of floating-point data.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup Exp Exponential
+ *
+ * Computes the exponential of each value of a block.
+ *
+ * The base-2 exponential is computed directly and the natural exponential scales
+ * its input by log2(e) with arm_scale_f32() first.
+ *
+ * \par Algorithm
+ * The floating-point function splits the input into the nearest integer and a
+ * fraction in [-0.5 0.5], evaluates a polynomial of the power of two of the
+ * fraction and builds the power of two of the integer in the exponent bits.  The
+ * fixed-point functions interpolate the power of two of the fraction linearly in a
+ * table of 257 values shared by the Q31 and Q15 functions, and shift the result by
+ * the integer part.
+ *
+ * \par Fixed-Point Behavior
+ * The inputs have the formats of the outputs of the fixed-point logarithms: the Q31
+ * function reads x / 32 in 1.31 format and the Q15 function x / 16 in 1.15 format.
+ * The result 2^x is a fraction in 1.31 or 1.15 format.  Inputs of zero and above,
+ * whose exponentials are one or more, saturate to the largest positive value.  The
+ * results are rounded to the format and the smallest one, for the most negative
+ * input, is one step.
+ */
+
+/**
+ * @addtogroup Exp
+ * @{
+ */
+
+/**
+ * @brief  Base-2 exponential of one value.
+ * @param[in]  x input value.
+ * @return 2^x, zero below -126 and for NaN, infinity above 128.
+ *
+ * The out of range inputs are clamped and their results selected rather than
+ * branched around, so the unrolled loop below has no branch per sample.
+ */
+
+static __INLINE float32_t arm_exp2_sample_f32(
+  float32_t x)
+{
+  union
+  {
+    float32_t f;
+    int32_t i;
+  } scale;                                       /* Power of two of the integer part */
+  float32_t in, t, p;                            /* Clamped input, fraction and polynomial */
+  int32_t n;                                     /* Nearest integer of the input */
+
+  /* The comparison is false for NaN as well.  Inputs of 128 and above overflow to
+   * infinity below */
+  in = (x >= -126.0f) ? x : -126.0f;
+  in = (in > 128.0f) ? 128.0f : in;
+
+  /* Nearest integer n, as the floor of in + 0.5, and the fraction in [-0.5 0.5] */
+  t = in + 0.5f;
+  n = (int32_t) t;
+
+  if(t < (float32_t) n)
+  {
+    n = n - 1;
+  }
+
+  t = in - (float32_t) n;
+
+  /* 2^t = 1 + t * P(t) */
+  p = 1.535336188319500e-4f;
+  p = (p * t) + 1.339887440266574e-3f;
+  p = (p * t) + 9.618437357674640e-3f;
+  p = (p * t) + 5.550332471162809e-2f;
+  p = (p * t) + 2.402264791363012e-1f;
+  p = (p * t) + 6.931472028550421e-1f;
+  p = (p * t) + 1.0f;
+
+  /* 2^128 is out of the exponent range, so it is built as 2 * 2^127 */
+  if(n > 127)
+  {
+    n = 127;
+    p = p * 2.0f;
+  }
+
+  scale.i = (n + 127) << 23;
+
+  return ((x >= -126.0f) ? (p * scale.f) : 0.0f);
+}
+
+/**
+ * @brief  Fast base-2 exponential of a block of floating-point data.
+ * @param[in]  *pSrc points to the input values
+ * @param[out] *pDst points to the output values
+ * @param[in]  blockSize number of values to compute
+ * @return none.
+ *
+ * \par
+ * The relative error is below 3e-7 for inputs in [-126 128).  Smaller inputs and
+ * NaN give zero, and larger ones give infinity.  The vector paths give the same
+ * results.
+ */
+
+void arm_exp2_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /* loop Unrolling: the four polynomials are independent, so the FPU pipeline of the
+   ** Cortex-M4 overlaps them */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    *pDst++ = arm_exp2_sample_f32(*pSrc++);
+    *pDst++ = arm_exp2_sample_f32(*pSrc++);
+    *pDst++ = arm_exp2_sample_f32(*pSrc++);
+    *pDst++ = arm_exp2_sample_f32(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+#if defined (ARM_MATH_SSE2)
+
+  __m128 x, in, t, p, valid, over;               /* Inputs, clamped inputs, fractions, polynomials, masks */
+  __m128i n;                                     /* Nearest integers */
+
+  /* Host build: compute 4 exponentials per SSE2 operation */
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    /* The comparison is false for NaN as well, and the maximum returns its second
+     * operand for NaN, so NaN is clamped like the small inputs and gives zero */
+    x = _mm_loadu_ps(pSrc);
+    valid = _mm_cmpge_ps(x, _mm_set1_ps(-126.0f));
+    in = _mm_min_ps(_mm_max_ps(x, _mm_set1_ps(-126.0f)), _mm_set1_ps(128.0f));
+
+    /* Nearest integers, as the floor of in + 0.5: the truncation is corrected by the
+     * all ones mask of the inputs below it */
+    t = _mm_add_ps(in, _mm_set1_ps(0.5f));
+    n = _mm_cvttps_epi32(t);
+    n = _mm_add_epi32(n, _mm_castps_si128(_mm_cmplt_ps(t, _mm_cvtepi32_ps(n))));
+
+    t = _mm_sub_ps(in, _mm_cvtepi32_ps(n));
+
+    p = _mm_set1_ps(1.535336188319500e-4f);
+    p = _mm_add_ps(_mm_mul_ps(p, t), _mm_set1_ps(1.339887440266574e-3f));
+    p = _mm_add_ps(_mm_mul_ps(p, t), _mm_set1_ps(9.618437357674640e-3f));
+    p = _mm_add_ps(_mm_mul_ps(p, t), _mm_set1_ps(5.550332471162809e-2f));
+    p = _mm_add_ps(_mm_mul_ps(p, t), _mm_set1_ps(2.402264791363012e-1f));
+    p = _mm_add_ps(_mm_mul_ps(p, t), _mm_set1_ps(6.931472028550421e-1f));
+    p = _mm_add_ps(_mm_mul_ps(p, t), _mm_set1_ps(1.0f));
+
+    /* 2^128 is built as 2 * 2^127: the all ones mask takes one from the integer */
+    over = _mm_castsi128_ps(_mm_cmpgt_epi32(n, _mm_set1_epi32(127)));
+    n = _mm_add_epi32(n, _mm_castps_si128(over));
+    p = _mm_add_ps(p, _mm_and_ps(over, p));
+
+    p = _mm_mul_ps(p, _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(n, _mm_set1_epi32(127)), 23)));
+
+    _mm_storeu_ps(pDst, _mm_and_ps(valid, p));
+    pSrc += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Compute the remaining 1 to 3 samples below */
+  blkCnt = blockSize % 0x4u;
+
+#elif defined (ARM_MATH_NEON)
+
+  float32x4_t x, in, t, p;                       /* Inputs, clamped inputs, fractions and polynomials */
+  uint32x4_t valid, over;                        /* Masks of the valid and the largest inputs */
+  int32x4_t n;                                   /* Nearest integers */
+
+  /* Host build: compute 4 exponentials per NEON operation */
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    /* The comparison is false for NaN as well */
+    x = vld1q_f32(pSrc);
+    valid = vcgeq_f32(x, vdupq_n_f32(-126.0f));
+    in = vminq_f32(vbslq_f32(valid, x, vdupq_n_f32(-126.0f)), vdupq_n_f32(128.0f));
+
+    /* Nearest integers, as the floor of in + 0.5: the truncation is corrected by the
+     * all ones mask of the inputs below it */
+    t = vaddq_f32(in, vdupq_n_f32(0.5f));
+    n = vcvtq_s32_f32(t);
+    n = vaddq_s32(n, vreinterpretq_s32_u32(vcltq_f32(t, vcvtq_f32_s32(n))));
+
+    t = vsubq_f32(in, vcvtq_f32_s32(n));
+
+    p = vdupq_n_f32(1.535336188319500e-4f);
+    p = vaddq_f32(vmulq_f32(p, t), vdupq_n_f32(1.339887440266574e-3f));
+    p = vaddq_f32(vmulq_f32(p, t), vdupq_n_f32(9.618437357674640e-3f));
+    p = vaddq_f32(vmulq_f32(p, t), vdupq_n_f32(5.550332471162809e-2f));
+    p = vaddq_f32(vmulq_f32(p, t), vdupq_n_f32(2.402264791363012e-1f));
+    p = vaddq_f32(vmulq_f32(p, t), vdupq_n_f32(6.931472028550421e-1f));
+    p = vaddq_f32(vmulq_f32(p, t), vdupq_n_f32(1.0f));
+
+    /* 2^128 is built as 2 * 2^127: the all ones mask takes one from the integer */
+    over = vcgtq_s32(n, vdupq_n_s32(127));
+    n = vaddq_s32(n, vreinterpretq_s32_u32(over));
+    p = vbslq_f32(over, vaddq_f32(p, p), p);
+
+    p = vmulq_f32(p, vreinterpretq_f32_s32(vshlq_n_s32(vaddq_s32(n, vdupq_n_s32(127)), 23)));
+
+    vst1q_f32(pDst, vreinterpretq_f32_u32(vandq_u32(valid, vreinterpretq_u32_f32(p))));
+    pSrc += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Compute the remaining 1 to 3 samples below */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_SSE2) */
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = arm_exp2_sample_f32(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of Exp group
+ */
@@ -0,0 +1,87 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_exp2_q15.c
+*
+* Description:	Fast base-2 exponential of a block of Q15 data.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup Exp
+ * @{
+ */
+
+/**
+ * @brief  Fast base-2 exponential of a block of Q15 data.
+ * @param[in]  *pSrc points to the input values, x / 16 in 1.15 format
+ * @param[out] *pDst points to the output values
+ * @param[in]  blockSize number of values to compute
+ * @return none.
+ *
+ * \par
+ * The input reads the table of arm_exp2_q31().  The result is within one step
+ * of the output format, 2^-15, of the exact exponential of the input.  A step of
+ * the input, 2^-11, changes the result by 0.034%.
+ */
+
+void arm_exp2_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t in;                                      /* Input value */
+  q31_t a, b, y;                                 /* Table values and interpolated power */
+  uint32_t shift;                                /* Right shift of the integer part */
+  uint32_t index, fract;                         /* Table index and interpolation fraction */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+
+    if(in >= 0)
+    {
+      /* 2^x is one or more */
+      *pDst++ = 0x7FFF;
+    }
+    else
+    {
+      /* x = i + f with the integer i = in >> 11 in [-16 -1] and the fraction f in
+       * the 11 bits below; the Q31 power 2^(f - 1) is shifted by -(i + 1) and
+       * by 16 bits to Q15 */
+      shift = (uint32_t) (15 - (in >> 11));
+
+      /* 8 bits of the fraction index the table of 2^(f - 1),
+       * the 3 bits below them are the interpolation fraction */
+      index = ((uint32_t) in >> 3) & 0xFFu;
+      fract = (uint32_t) in & 0x7u;
+
+      a = exp2Table_q31[index];
+      b = exp2Table_q31[index + 1u];
+      y = a + (((b - a) * (q31_t) fract) >> 3);
+
+      /* Shift with rounding */
+      *pDst++ = (q15_t) (((y >> (shift - 1u)) + 1) >> 1);
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of Exp group
+ */
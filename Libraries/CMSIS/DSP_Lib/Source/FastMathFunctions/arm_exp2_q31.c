@@ -0,0 +1,92 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_exp2_q31.c
+*
+* Description:	Fast base-2 exponential of a block of Q31 data.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup Exp
+ * @{
+ */
+
+/**
+ * @brief  Fast base-2 exponential of a block of Q31 data.
+ * @param[in]  *pSrc points to the input values, x / 32 in 1.31 format
+ * @param[out] *pDst points to the output values
+ * @param[in]  blockSize number of values to compute
+ * @return none.
+ *
+ * \par
+ * The relative error is below 2e-6 for results above 2^-10 and the absolute
+ * error below 2^-31 plus 2e-6 times the result otherwise.
+ */
+
+void arm_exp2_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t in;                                      /* Input value */
+  q31_t a, b, y;                                 /* Table values and interpolated power */
+  uint32_t shift;                                /* Right shift of the integer part */
+  uint32_t index, fract;                         /* Table index and interpolation fraction */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+
+    if(in >= 0)
+    {
+      /* 2^x is one or more */
+      *pDst++ = 0x7FFFFFFF;
+    }
+    else
+    {
+      /* x = i + f with the integer i = in >> 26 in [-32 -1] and the fraction f in
+       * the 26 bits below, so 2^x = 2^(f - 1) * 2^-shift with shift = -(i + 1) */
+      shift = (uint32_t) (-((in >> 26) + 1));
+
+      /* 8 bits of the fraction index the table of 2^(f - 1),
+       * the 18 bits below them are the interpolation fraction */
+      index = ((uint32_t) in >> 18) & 0xFFu;
+      fract = (uint32_t) in & 0x0003FFFFu;
+
+      a = exp2Table_q31[index];
+      b = exp2Table_q31[index + 1u];
+      y = a + (q31_t) (((q63_t) (b - a) * fract) >> 18);
+
+      /* Shift by the integer part with rounding */
+      if(shift == 0u)
+      {
+        *pDst++ = y;
+      }
+      else
+      {
+        *pDst++ = ((y >> (shift - 1u)) + 1) >> 1;
+      }
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of Exp group
+ */
@@ -0,0 +1,51 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_exp_f32.c
+*
+* Description:	Fast natural exponential of a block of floating-point data.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup Exp
+ * @{
+ */
+
+/**
+ * @brief  Fast natural exponential of a block of floating-point data.
+ * @param[in]  *pSrc points to the input values
+ * @param[out] *pDst points to the output values
+ * @param[in]  blockSize number of values to compute
+ * @return none.
+ *
+ * \par
+ * The result is arm_exp2_f32() of the input scaled by log2(e), so the inputs
+ * are valid in [-87.3 88.7).  The rounding of the scaled input adds a relative
+ * error of up to 6e-8 times the magnitude of the input.
+ */
+
+void arm_exp_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  /* e^x = 2^(x * log2(e)) */
+  arm_scale_f32(pSrc, 1.44269504f, pDst, blockSize);
+  arm_exp2_f32(pDst, pDst, blockSize);
+}
+
+/**
+ * @} end of Exp group
+ */
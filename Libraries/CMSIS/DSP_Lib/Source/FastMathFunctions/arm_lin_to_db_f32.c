@@ -0,0 +1,70 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_lin_to_db_f32.c
+*
+* Description:	Conversion of floating-point amplitudes to decibels.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup Decibel Decibel Conversion
+ *
+ * Converts each value of a block between a linear amplitude and a level in decibels,
+ * 20 * log10(x).  Levels of powers, 10 * log10(x), are half of those of the
+ * amplitudes, and the conversion of a power is that of its square root.
+ *
+ * \par Algorithm
+ * The conversions are the base-2 logarithm and exponential of the Log and Exp groups
+ * with the input or output scaled by 20 * log10(2) = 6.0206 dB per octave, so
+ * they have the accuracy of those functions.
+ *
+ * \par Fixed-Point Behavior
+ * The levels of fractions are negative and reach -186.6 dB (Q31) and -90.3 dB (Q15)
+ * at the smallest step.  The Q31 functions represent a level as dB / 256 in 1.31
+ * format, i.e. a 9.23 number, and the Q15 functions as dB / 128 in 1.15 format,
+ * i.e. an 8.8 number.  Zero and negative amplitudes give -192.7 dB (Q31) and
+ * -96.3 dB (Q15), and levels of 0 dB and above saturate to the largest amplitude.
+ */
+
+/**
+ * @addtogroup Decibel
+ * @{
+ */
+
+/**
+ * @brief  Converts a block of floating-point amplitudes to decibels.
+ * @param[in]  *pSrc points to the input values
+ * @param[out] *pDst points to the output values
+ * @param[in]  blockSize number of values to compute
+ * @return none.
+ *
+ * \par
+ * Zero and negative amplitudes give -758.6 dB, the level of the smallest normal
+ * number.
+ */
+
+void arm_lin_to_db_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  /* 20 * log10(x) = log2(x) * 20 * log10(2) */
+  arm_log2_f32(pSrc, pDst, blockSize);
+  arm_scale_f32(pDst, 6.02059991f, pDst, blockSize);
+}
+
+/**
+ * @} end of Decibel group
+ */
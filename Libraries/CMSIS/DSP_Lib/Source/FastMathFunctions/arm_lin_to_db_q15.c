@@ -0,0 +1,50 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_lin_to_db_q15.c
+*
+* Description:	Conversion of Q15 amplitudes to decibels.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup Decibel
+ * @{
+ */
+
+/**
+ * @brief  Converts a block of Q15 amplitudes to decibels.
+ * @param[in]  *pSrc points to the input values
+ * @param[out] *pDst points to the output values, dB / 128 in 1.15 format
+ * @param[in]  blockSize number of values to compute
+ * @return none.
+ *
+ * \par
+ * The result is arm_log2_q15() scaled by 0.752575, so the error is below 0.006 dB,
+ * and zero and negative amplitudes give -96.3 dB.
+ */
+
+void arm_lin_to_db_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  /* dB / 128 = log2(x) / 16 * 20 * log10(2) / 8 */
+  arm_log2_q15(pSrc, pDst, blockSize);
+  arm_scale_q15(pDst, 0x6054, 0, pDst, blockSize);
+}
+
+/**
+ * @} end of Decibel group
+ */
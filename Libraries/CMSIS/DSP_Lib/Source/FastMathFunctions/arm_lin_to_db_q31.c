@@ -0,0 +1,50 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_lin_to_db_q31.c
+*
+* Description:	Conversion of Q31 amplitudes to decibels.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup Decibel
+ * @{
+ */
+
+/**
+ * @brief  Converts a block of Q31 amplitudes to decibels.
+ * @param[in]  *pSrc points to the input values
+ * @param[out] *pDst points to the output values, dB / 256 in 1.31 format
+ * @param[in]  blockSize number of values to compute
+ * @return none.
+ *
+ * \par
+ * The result is arm_log2_q31() scaled by 0.752575, so the error is below 2e-5 dB,
+ * and zero and negative amplitudes give -192.7 dB.
+ */
+
+void arm_lin_to_db_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  /* dB / 256 = log2(x) / 32 * 20 * log10(2) / 8 */
+  arm_log2_q31(pSrc, pDst, blockSize);
+  arm_scale_q31(pDst, 0x60546093, 0, pDst, blockSize);
+}
+
+/**
+ * @} end of Decibel group
+ */
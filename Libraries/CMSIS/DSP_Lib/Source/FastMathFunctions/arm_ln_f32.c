@@ -0,0 +1,50 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_ln_f32.c
+*
+* Description:	Fast natural logarithm of a block of floating-point data.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup Log
+ * @{
+ */
+
+/**
+ * @brief  Fast natural logarithm of a block of floating-point data.
+ * @param[in]  *pSrc points to the input values
+ * @param[out] *pDst points to the output values
+ * @param[in]  blockSize number of values to compute
+ * @return none.
+ *
+ * \par
+ * The result is arm_log2_f32() scaled by ln(2), with the same handling of zero and
+ * negative inputs.
+ */
+
+void arm_ln_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  /* ln(x) = log2(x) * ln(2) */
+  arm_log2_f32(pSrc, pDst, blockSize);
+  arm_scale_f32(pDst, 0.693147181f, pDst, blockSize);
+}
+
+/**
+ * @} end of Log group
+ */
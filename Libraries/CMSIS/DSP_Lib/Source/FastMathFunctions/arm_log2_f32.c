@@ -0,0 +1,276 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_log2_f32.c
+*
+* Description:	Fast base-2 logarithm of a block of floating-point data.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup Log Logarithm
+ *
+ * Computes the logarithm of each value of a block.
+ *
+ * The base-2 logarithm is computed directly and the natural and base-10 logarithms
+ * are scaled from it with arm_scale_f32(), so they have the same relative accuracy.
+ * The decibel conversions of the Decibel group are built the same way.
+ *
+ * \par Algorithm
+ * The floating-point function splits the input into its exponent and its mantissa,
+ * centers the mantissa on one and evaluates a polynomial of the logarithm of the
+ * mantissa.  The fixed-point functions normalize the input with a count of the
+ * leading zeros (<code>__CLZ</code>) and interpolate the logarithm of the mantissa
+ * linearly in a table of 257 values shared by the Q31 and Q15 functions.
+ *
+ * \par Fixed-Point Behavior
+ * The input is a positive fraction in [2^-31 1) (Q31) or [2^-15 1) (Q15), so its
+ * logarithm is in [-31 0) or [-15 0).  The results are scaled down to fit:
+ * the Q31 function returns log2(x) / 32 in 1.31 format, i.e. a 6.26 number, and
+ * the Q15 function returns log2(x) / 16 in 1.15 format, i.e. a 5.11 number.
+ * Zero and negative inputs give the most negative result, -32 or -16.
+ * These are the input formats of the fixed-point exponentials, so
+ * arm_exp2_q31() inverts arm_log2_q31().
+ */
+
+/**
+ * @addtogroup Log
+ * @{
+ */
+
+/**
+ * @brief  Base-2 logarithm of one value.
+ * @param[in]  x input value.
+ * @return log2(x), or -126 for zero, negative and denormal inputs and NaN.
+ *
+ * The out of range inputs are replaced by the smallest normal number rather than
+ * branched around, so the unrolled loop below has no branch per sample.
+ */
+
+static __INLINE float32_t arm_log2_sample_f32(
+  float32_t x)
+{
+  union
+  {
+    float32_t f;
+    int32_t i;
+  } in;                                          /* Input value and its bits */
+  float32_t m, z, y;                             /* Mantissa, its square and the polynomial */
+  int32_t e;                                     /* Exponent of the input */
+
+  /* The comparison is false for NaN as well */
+  in.f = (x >= 1.17549435e-38f) ? x : 1.17549435e-38f;
+
+  /* Split the input into the exponent and the mantissa in [1 2) */
+  e = ((in.i >> 23) & 0xFF) - 127;
+  in.i = (in.i & 0x007FFFFF) | 0x3F800000;
+  m = in.f;
+
+  /* Center the mantissa on one, in [sqrt(1/2) sqrt(2)) */
+  if(m > 1.41421356f)
+  {
+    m = m * 0.5f;
+    e = e + 1;
+  }
+
+  m = m - 1.0f;
+  z = m * m;
+
+  /* ln(1 + m) = m - z/2 + m * z * P(m) */
+  y = 7.0376836292e-2f;
+  y = (y * m) - 1.1514610310e-1f;
+  y = (y * m) + 1.1676998740e-1f;
+  y = (y * m) - 1.2420140846e-1f;
+  y = (y * m) + 1.4249322787e-1f;
+  y = (y * m) - 1.6668057665e-1f;
+  y = (y * m) + 2.0000714765e-1f;
+  y = (y * m) - 2.4999993993e-1f;
+  y = (y * m) + 3.3333331174e-1f;
+  y = (m * z * y) - (0.5f * z);
+
+  /* log2(x) = e + ln(1 + m) / ln(2) */
+  return (((m + y) * 1.44269504f) + (float32_t) e);
+}
+
+/**
+ * @brief  Fast base-2 logarithm of a block of floating-point data.
+ * @param[in]  *pSrc points to the input values
+ * @param[out] *pDst points to the output values
+ * @param[in]  blockSize number of values to compute
+ * @return none.
+ *
+ * \par
+ * The absolute error is below 2e-7 plus the rounding of the result, 6e-8 of its
+ * magnitude, for inputs from the smallest normal number up to the largest finite
+ * one.  Zero, negative and denormal inputs, and NaN,
+ * give -126, the logarithm of the smallest normal number, so the result of a
+ * silent signal stays finite.  The vector paths give the same results.
+ */
+
+void arm_log2_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /* loop Unrolling: the four polynomials are independent, so the FPU pipeline of the
+   ** Cortex-M4 overlaps them */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    *pDst++ = arm_log2_sample_f32(*pSrc++);
+    *pDst++ = arm_log2_sample_f32(*pSrc++);
+    *pDst++ = arm_log2_sample_f32(*pSrc++);
+    *pDst++ = arm_log2_sample_f32(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+#if defined (ARM_MATH_SSE2)
+
+  __m128 x, m, z, y, big;                        /* Inputs, mantissas, squares, polynomials, centering mask */
+  __m128i e;                                     /* Exponents */
+
+  /* Host build: compute 4 logarithms per SSE2 operation */
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    /* The maximum returns its second operand for NaN, so zero, negative and
+     * denormal inputs and NaN all become the smallest normal number */
+    x = _mm_max_ps(_mm_loadu_ps(pSrc), _mm_set1_ps(1.17549435e-38f));
+
+    /* Split the inputs into the exponents and the mantissas in [1 2) */
+    e = _mm_sub_epi32(_mm_srli_epi32(_mm_castps_si128(x), 23), _mm_set1_epi32(127));
+    m = _mm_or_ps(_mm_and_ps(x, _mm_castsi128_ps(_mm_set1_epi32(0x007FFFFF))), _mm_set1_ps(1.0f));
+
+    /* Center the mantissas on one; the all ones mask adds one to the exponent */
+    big = _mm_cmpgt_ps(m, _mm_set1_ps(1.41421356f));
+    m = _mm_sub_ps(m, _mm_and_ps(big, _mm_mul_ps(m, _mm_set1_ps(0.5f))));
+    e = _mm_sub_epi32(e, _mm_castps_si128(big));
+
+    m = _mm_sub_ps(m, _mm_set1_ps(1.0f));
+    z = _mm_mul_ps(m, m);
+
+    y = _mm_set1_ps(7.0376836292e-2f);
+    y = _mm_sub_ps(_mm_mul_ps(y, m), _mm_set1_ps(1.1514610310e-1f));
+    y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(1.1676998740e-1f));
+    y = _mm_sub_ps(_mm_mul_ps(y, m), _mm_set1_ps(1.2420140846e-1f));
+    y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(1.4249322787e-1f));
+    y = _mm_sub_ps(_mm_mul_ps(y, m), _mm_set1_ps(1.6668057665e-1f));
+    y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(2.0000714765e-1f));
+    y = _mm_sub_ps(_mm_mul_ps(y, m), _mm_set1_ps(2.4999993993e-1f));
+    y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(3.3333331174e-1f));
+    y = _mm_sub_ps(_mm_mul_ps(_mm_mul_ps(m, z), y), _mm_mul_ps(_mm_set1_ps(0.5f), z));
+
+    _mm_storeu_ps(pDst, _mm_add_ps(_mm_mul_ps(_mm_add_ps(m, y), _mm_set1_ps(1.44269504f)),
+                                   _mm_cvtepi32_ps(e)));
+    pSrc += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Compute the remaining 1 to 3 samples below */
+  blkCnt = blockSize % 0x4u;
+
+#elif defined (ARM_MATH_NEON)
+
+  float32x4_t x, m, z, y;                        /* Inputs, mantissas, squares and polynomials */
+  uint32x4_t big;                                /* Centering mask */
+  int32x4_t e;                                   /* Exponents */
+
+  /* Host build: compute 4 logarithms per NEON operation */
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    /* The comparison is false for NaN as well */
+    x = vld1q_f32(pSrc);
+    x = vbslq_f32(vcgeq_f32(x, vdupq_n_f32(1.17549435e-38f)), x, vdupq_n_f32(1.17549435e-38f));
+
+    /* Split the inputs into the exponents and the mantissas in [1 2) */
+    e = vsubq_s32(vreinterpretq_s32_u32(vshrq_n_u32(vreinterpretq_u32_f32(x), 23)), vdupq_n_s32(127));
+    m = vreinterpretq_f32_u32(vorrq_u32(vandq_u32(vreinterpretq_u32_f32(x), vdupq_n_u32(0x007FFFFFu)),
+                                        vdupq_n_u32(0x3F800000u)));
+
+    /* Center the mantissas on one; the all ones mask adds one to the exponent */
+    big = vcgtq_f32(m, vdupq_n_f32(1.41421356f));
+    m = vbslq_f32(big, vmulq_n_f32(m, 0.5f), m);
+    e = vsubq_s32(e, vreinterpretq_s32_u32(big));
+
+    m = vsubq_f32(m, vdupq_n_f32(1.0f));
+    z = vmulq_f32(m, m);
+
+    y = vdupq_n_f32(7.0376836292e-2f);
+    y = vsubq_f32(vmulq_f32(y, m), vdupq_n_f32(1.1514610310e-1f));
+    y = vaddq_f32(vmulq_f32(y, m), vdupq_n_f32(1.1676998740e-1f));
+    y = vsubq_f32(vmulq_f32(y, m), vdupq_n_f32(1.2420140846e-1f));
+    y = vaddq_f32(vmulq_f32(y, m), vdupq_n_f32(1.4249322787e-1f));
+    y = vsubq_f32(vmulq_f32(y, m), vdupq_n_f32(1.6668057665e-1f));
+    y = vaddq_f32(vmulq_f32(y, m), vdupq_n_f32(2.0000714765e-1f));
+    y = vsubq_f32(vmulq_f32(y, m), vdupq_n_f32(2.4999993993e-1f));
+    y = vaddq_f32(vmulq_f32(y, m), vdupq_n_f32(3.3333331174e-1f));
+    y = vsubq_f32(vmulq_f32(vmulq_f32(m, z), y), vmulq_n_f32(z, 0.5f));
+
+    vst1q_f32(pDst, vaddq_f32(vmulq_n_f32(vaddq_f32(m, y), 1.44269504f), vcvtq_f32_s32(e)));
+    pSrc += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Compute the remaining 1 to 3 samples below */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_SSE2) */
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = arm_log2_sample_f32(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of Log group
+ */
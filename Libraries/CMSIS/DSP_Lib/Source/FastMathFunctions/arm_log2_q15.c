@@ -0,0 +1,86 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_log2_q15.c
+*
+* Description:	Fast base-2 logarithm of a block of Q15 data.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup Log
+ * @{
+ */
+
+/**
+ * @brief  Fast base-2 logarithm of a block of Q15 data.
+ * @param[in]  *pSrc points to the input values
+ * @param[out] *pDst points to the output values, log2(x) / 16 in 1.15 format
+ * @param[in]  blockSize number of values to compute
+ * @return none.
+ *
+ * \par
+ * The input is shifted to the Q31 range and reads the table of arm_log2_q31().
+ * The result is within one step of the output format, 2^-11, of the exact
+ * logarithm for all positive inputs.  Zero and negative inputs give 0x8000, i.e. -16.
+ */
+
+void arm_log2_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t in;                                      /* Input value */
+  q31_t a, b, y;                                 /* Table values and interpolated logarithm */
+  uint32_t m;                                    /* Normalized input */
+  uint32_t n;                                    /* Normalization shift */
+  uint32_t index, fract;                         /* Table index and interpolation fraction */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    in = (q31_t) *pSrc++ << 16;
+
+    if(in <= 0)
+    {
+      *pDst++ = (q15_t) 0x8000;
+    }
+    else
+    {
+      /* Normalize the input to m in [0.5 1), x = m * 2^-n */
+      n = __CLZ(in) - 1u;
+      m = (uint32_t) in << n;
+
+      /* The 8 bits below the leading one index the table of log2(2 * m),
+       * the 7 bits below them are the interpolation fraction */
+      index = (m >> 22) & 0xFFu;
+      fract = (m >> 15) & 0x7Fu;
+
+      a = log2Table_q31[index];
+      b = log2Table_q31[index + 1u];
+      y = a + (q31_t) (((q63_t) (b - a) * fract) >> 7);
+
+      /* log2(x) = log2(2 * m) - (n + 1), scaled by 1/16 with rounding */
+      *pDst++ = (q15_t) ((((y >> 19) + 1) >> 1) - (q31_t) ((n + 1u) << 11));
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of Log group
+ */
@@ -0,0 +1,85 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_log2_q31.c
+*
+* Description:	Fast base-2 logarithm of a block of Q31 data.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup Log
+ * @{
+ */
+
+/**
+ * @brief  Fast base-2 logarithm of a block of Q31 data.
+ * @param[in]  *pSrc points to the input values
+ * @param[out] *pDst points to the output values, log2(x) / 32 in 1.31 format
+ * @param[in]  blockSize number of values to compute
+ * @return none.
+ *
+ * \par
+ * The absolute error of the logarithm is below 3e-6, about 1.7e-5 dB, for all
+ * positive inputs.  Zero and negative inputs give 0x80000000, i.e. -32.
+ */
+
+void arm_log2_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t in;                                      /* Input value */
+  q31_t a, b, y;                                 /* Table values and interpolated logarithm */
+  uint32_t m;                                    /* Normalized input */
+  uint32_t n;                                    /* Normalization shift */
+  uint32_t index, fract;                         /* Table index and interpolation fraction */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+
+    if(in <= 0)
+    {
+      *pDst++ = 0x80000000;
+    }
+    else
+    {
+      /* Normalize the input to m in [0.5 1), x = m * 2^-n */
+      n = __CLZ(in) - 1u;
+      m = (uint32_t) in << n;
+
+      /* The 8 bits below the leading one index the table of log2(2 * m),
+       * the 22 bits below them are the interpolation fraction */
+      index = (m >> 22) & 0xFFu;
+      fract = m & 0x003FFFFFu;
+
+      a = log2Table_q31[index];
+      b = log2Table_q31[index + 1u];
+      y = a + (q31_t) (((q63_t) (b - a) * fract) >> 22);
+
+      /* log2(x) = log2(2 * m) - (n + 1), scaled by 1/32 with rounding */
+      *pDst++ = (((y >> 4) + 1) >> 1) - (q31_t) ((n + 1u) << 26);
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of Log group
+ */
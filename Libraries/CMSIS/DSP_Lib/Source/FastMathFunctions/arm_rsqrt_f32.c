@@ -0,0 +1,108 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_rsqrt_f32.c
+*
+* Description:	Fast reciprocal square root of a block of floating-point data.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup RSQRT Reciprocal Square Root
+ *
+ * Computes the reciprocal of the square root of each value of a block, as used to
+ * normalize vectors and magnitudes without a division.
+ *
+ * \par Algorithm
+ * The floating-point function takes its initial estimate from the bits of the input
+ * and refines it with two Newton-Raphson iterations
+ * <pre>
+ *     y1 = y0 * (1.5 - 0.5 * x * y0 * y0)
+ * </pre>
+ * The fixed-point functions normalize the input to a mantissa in [0.25 1) with an
+ * even shift, so that the shift halves exactly, interpolate the initial estimate
+ * in a table of 49 values and refine it with one iteration.
+ *
+ * \par Fixed-Point Behavior
+ * The reciprocal square root of a fraction in (0 1) is above one, up to 46341 for
+ * the smallest Q31 value and 182 for the smallest Q15 value.  Both the Q31 and the
+ * Q15 functions return it in 1.31 format scaled down by 2^16, i.e. as a 17.15
+ * number.  Multiplying a Q15 value by it and shifting the product right by 15 bits
+ * gives the Q15 product.
+ *
+ * \par
+ * Zero and negative inputs give zero, as in the square root functions, so the
+ * normalization of a zero vector stays zero.
+ */
+
+/**
+ * @addtogroup RSQRT
+ * @{
+ */
+
+/**
+ * @brief  Fast reciprocal square root of a block of floating-point data.
+ * @param[in]  *pSrc points to the input values
+ * @param[out] *pDst points to the output values
+ * @param[in]  blockSize number of values to compute
+ * @return none.
+ *
+ * \par
+ * The relative error is below 5e-6 for positive normal inputs.
+ */
+
+void arm_rsqrt_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  union
+  {
+    float32_t f;
+    int32_t i;
+  } y;                                           /* Estimate and its bits */
+  float32_t in, half;                            /* Input value and its half */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+
+    /* The comparison is false for NaN as well */
+    if(!(in > 0.0f))
+    {
+      *pDst++ = 0.0f;
+    }
+    else
+    {
+      /* Halving the exponent in the bits gives the estimate within 4% */
+      y.f = in;
+      y.i = 0x5F3759DF - (y.i >> 1);
+      half = 0.5f * in;
+
+      /* Two Newton-Raphson iterations */
+      y.f = y.f * (1.5f - (half * y.f * y.f));
+      y.f = y.f * (1.5f - (half * y.f * y.f));
+
+      *pDst++ = y.f;
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of RSQRT group
+ */
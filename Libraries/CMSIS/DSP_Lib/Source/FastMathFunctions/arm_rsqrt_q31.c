@@ -0,0 +1,99 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_rsqrt_q31.c
+*
+* Description:	Fast reciprocal square root of a block of Q31 data.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup RSQRT
+ * @{
+ */
+
+/**
+ * @brief  Fast reciprocal square root of a block of Q31 data.
+ * @param[in]  *pSrc points to the input values
+ * @param[out] *pDst points to the output values, 1/sqrt(x) / 2^16 in 1.31 format
+ * @param[in]  blockSize number of values to compute
+ * @return none.
+ *
+ * \par
+ * The relative error is below 1e-6 plus one step of the output format, 2^-15.
+ */
+
+void arm_rsqrt_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t in;                                      /* Input value */
+  q31_t a, b, y, t;                              /* Table values, estimate and temporary */
+  q63_t out;                                     /* Refined estimate */
+  uint32_t m;                                    /* Normalized input */
+  uint32_t n, shift;                             /* Normalization shift and output shift */
+  uint32_t index, fract;                         /* Table index and interpolation fraction */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+
+    if(in <= 0)
+    {
+      *pDst++ = 0;
+    }
+    else
+    {
+      /* Normalize the input to m in [0.25 1) with an even shift, x = m * 2^-n */
+      n = (__CLZ(in) - 1u) & ~1u;
+      m = (uint32_t) in << n;
+
+      /* The 6 bits from bit 30 down index the table of 1/sqrt(m) over [0.25 1),
+       * the 25 bits below them are the interpolation fraction */
+      index = (m >> 25) - 16u;
+      fract = m & 0x01FFFFFFu;
+
+      a = rsqrtTable_q31[index];
+      b = rsqrtTable_q31[index + 1u];
+      y = a + (q31_t) (((q63_t) (b - a) * fract) >> 25);
+
+      /* One Newton-Raphson iteration in 2.30 format, y = y * (1.5 - m * y * y / 2) */
+      t = (q31_t) (((q63_t) (q31_t) m * y) >> 31);
+      t = (q31_t) (((q63_t) t * y) >> 31);
+      out = ((q63_t) y * (0x60000000 - t)) >> 30;
+
+      /* 1/sqrt(x) = 1/sqrt(m) * 2^(n/2), from 2.30 to 17.15 format with rounding */
+      shift = 15u - (n >> 1);
+
+      if(shift == 0u)
+      {
+        *pDst++ = (q31_t) out;
+      }
+      else
+      {
+        *pDst++ = (q31_t) (((out >> (shift - 1u)) + 1) >> 1);
+      }
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of RSQRT group
+ */
@@ -0,0 +1,270 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_sin_block_f32.c
+*
+* Description:	Fast sine calculation for a block of floating-point values.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup sin
+ * @{
+ */
+
+/**
+ * @brief  Sine of one phase.
+ * @param[in]  in phase in turns.
+ * @return the sine.
+ */
+
+static __INLINE float32_t arm_sin_block_sample_f32(
+  float32_t in)
+{
+  float32_t fract;                               /* Fractional value */
+  float32_t fract2, fract3;                      /* Powers of the fractional value */
+  float32_t wa, wb, wc, wd;                      /* Cubic interpolation coefficients */
+  const float32_t *tablePtr;                     /* Pointer to table */
+  float32_t tableSize = (float32_t) TABLE_SIZE;  /* Table size */
+  int32_t n;                                     /* Integer part of the input in turns */
+  uint32_t index;                                /* Index variable */
+
+  /* Map the input to [0 1) with the floor of the value */
+  n = (int32_t) in;
+
+  if(in < (float32_t) n)
+  {
+    n = n - 1;
+  }
+
+  in = in - (float32_t) n;
+
+  /* Calculation of the table index and of the fractional value */
+  index = (uint32_t) (tableSize * in);
+  fract = (tableSize * in) - (float32_t) index;
+
+  /* A value just below a whole turn can round up to it */
+  if(index >= (uint32_t) TABLE_SIZE)
+  {
+    index = 0u;
+  }
+
+  tablePtr = &sinTable_f32[index];
+
+  /* Cubic interpolation weights as in arm_sin_f32() */
+  fract2 = fract * fract;
+  fract3 = fract * fract2;
+  wa = -((0.166666667f * fract3) + (0.3333333333333f * fract)) + (0.5f * fract2);
+  wb = ((0.5f * fract3) - (fract2 + (0.5f * fract))) + 1.0f;
+  wc = (-(0.5f * fract3) + (0.5f * fract2)) + fract;
+  wd = (0.166666667f * fract3) - (0.166666667f * fract);
+
+  /* Weighted sum of the four nearest table values */
+  return (((tablePtr[0] * wa) + (tablePtr[1] * wb)) + ((tablePtr[2] * wc) + (tablePtr[3] * wd)));
+}
+
+/**
+ * @brief  Fast approximation to the trigonometric sine function for a block of floating-point data.
+ * @param[in]  *pSrc points to the input values in radians
+ * @param[out] *pDst points to the output values
+ * @param[in]  blockSize number of values to compute
+ * @return none.
+ *
+ * \par
+ * The results are those of arm_sin_f32() for each value, computed from the same
+ * table and cubic interpolation.  The vector paths interpolate 4 values at a time
+ * and give the same results.
+ */
+
+void arm_sin_block_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /* loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* Scale the inputs from radians to turns */
+    *pDst++ = arm_sin_block_sample_f32(*pSrc++ * 0.159154943092f);
+    *pDst++ = arm_sin_block_sample_f32(*pSrc++ * 0.159154943092f);
+    *pDst++ = arm_sin_block_sample_f32(*pSrc++ * 0.159154943092f);
+    *pDst++ = arm_sin_block_sample_f32(*pSrc++ * 0.159154943092f);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+#if defined (ARM_MATH_SSE2)
+
+  __m128 in, fract, fract2, fract3;              /* Phases, fractional values and their powers */
+  __m128 wa, wb, wc, wd;                         /* Cubic interpolation coefficients */
+  __m128 t0, t1, t2, t3;                         /* Table values, one row per value at first */
+  __m128i n;                                     /* Integer parts and table indices */
+
+  /* Host build: compute 4 values per SSE2 operation */
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    /* Scale the inputs from radians to turns and map them to [0 1) with the floor:
+     * the truncation is corrected by the all ones mask of the values below it */
+    in = _mm_mul_ps(_mm_loadu_ps(pSrc), _mm_set1_ps(0.159154943092f));
+    n = _mm_cvttps_epi32(in);
+    n = _mm_add_epi32(n, _mm_castps_si128(_mm_cmplt_ps(in, _mm_cvtepi32_ps(n))));
+    in = _mm_sub_ps(in, _mm_cvtepi32_ps(n));
+
+    /* Table indices and fractional values; an index of a whole turn is wrapped to zero */
+    in = _mm_mul_ps(_mm_set1_ps((float32_t) TABLE_SIZE), in);
+    n = _mm_cvttps_epi32(in);
+    fract = _mm_sub_ps(in, _mm_cvtepi32_ps(n));
+    n = _mm_and_si128(n, _mm_cmplt_epi32(n, _mm_set1_epi32(TABLE_SIZE)));
+
+    /* The four nearest table values of each input are contiguous: load them as rows
+     * and transpose them to one vector per tap */
+    t0 = _mm_loadu_ps(&sinTable_f32[_mm_cvtsi128_si32(n)]);
+    t1 = _mm_loadu_ps(&sinTable_f32[_mm_cvtsi128_si32(_mm_shuffle_epi32(n, 0x55))]);
+    t2 = _mm_loadu_ps(&sinTable_f32[_mm_cvtsi128_si32(_mm_shuffle_epi32(n, 0xAA))]);
+    t3 = _mm_loadu_ps(&sinTable_f32[_mm_cvtsi128_si32(_mm_shuffle_epi32(n, 0xFF))]);
+    _MM_TRANSPOSE4_PS(t0, t1, t2, t3);
+
+    /* Cubic interpolation weights as in arm_sin_f32() */
+    fract2 = _mm_mul_ps(fract, fract);
+    fract3 = _mm_mul_ps(fract, fract2);
+    wa = _mm_sub_ps(_mm_mul_ps(_mm_set1_ps(0.5f), fract2),
+                    _mm_add_ps(_mm_mul_ps(_mm_set1_ps(0.166666667f), fract3),
+                               _mm_mul_ps(_mm_set1_ps(0.3333333333333f), fract)));
+    wb = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(_mm_set1_ps(0.5f), fract3),
+                               _mm_add_ps(fract2, _mm_mul_ps(_mm_set1_ps(0.5f), fract))),
+                    _mm_set1_ps(1.0f));
+    wc = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(_mm_set1_ps(0.5f), fract2),
+                               _mm_mul_ps(_mm_set1_ps(0.5f), fract3)), fract);
+    wd = _mm_sub_ps(_mm_mul_ps(_mm_set1_ps(0.166666667f), fract3),
+                    _mm_mul_ps(_mm_set1_ps(0.166666667f), fract));
+
+    /* Weighted sum of the four nearest table values */
+    _mm_storeu_ps(pDst, _mm_add_ps(_mm_add_ps(_mm_mul_ps(t0, wa), _mm_mul_ps(t1, wb)),
+                                   _mm_add_ps(_mm_mul_ps(t2, wc), _mm_mul_ps(t3, wd))));
+    pSrc += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Compute the remaining 1 to 3 samples below */
+  blkCnt = blockSize % 0x4u;
+
+#elif defined (ARM_MATH_NEON)
+
+  float32x4_t in, fract, fract2, fract3;         /* Phases, fractional values and their powers */
+  float32x4_t wa, wb, wc, wd;                    /* Cubic interpolation coefficients */
+  float32x4_t t0, t1, t2, t3;                    /* Table values, one row per value */
+  float32x4x2_t t01, t23;                        /* Half transposed table values */
+  int32x4_t n;                                   /* Integer parts and table indices */
+
+  /* Host build: compute 4 values per NEON operation */
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    /* Scale the inputs from radians to turns and map them to [0 1) with the floor:
+     * the truncation is corrected by the all ones mask of the values below it */
+    in = vmulq_n_f32(vld1q_f32(pSrc), 0.159154943092f);
+    n = vcvtq_s32_f32(in);
+    n = vaddq_s32(n, vreinterpretq_s32_u32(vcltq_f32(in, vcvtq_f32_s32(n))));
+    in = vsubq_f32(in, vcvtq_f32_s32(n));
+
+    /* Table indices and fractional values; an index of a whole turn is wrapped to zero */
+    in = vmulq_n_f32(in, (float32_t) TABLE_SIZE);
+    n = vcvtq_s32_f32(in);
+    fract = vsubq_f32(in, vcvtq_f32_s32(n));
+    n = vandq_s32(n, vreinterpretq_s32_u32(vcltq_s32(n, vdupq_n_s32(TABLE_SIZE))));
+
+    /* The four nearest table values of each input are contiguous: load them as rows
+     * and transpose them to one vector per tap */
+    t0 = vld1q_f32(&sinTable_f32[vgetq_lane_s32(n, 0)]);
+    t1 = vld1q_f32(&sinTable_f32[vgetq_lane_s32(n, 1)]);
+    t2 = vld1q_f32(&sinTable_f32[vgetq_lane_s32(n, 2)]);
+    t3 = vld1q_f32(&sinTable_f32[vgetq_lane_s32(n, 3)]);
+    t01 = vtrnq_f32(t0, t1);
+    t23 = vtrnq_f32(t2, t3);
+    t0 = vcombine_f32(vget_low_f32(t01.val[0]), vget_low_f32(t23.val[0]));
+    t1 = vcombine_f32(vget_low_f32(t01.val[1]), vget_low_f32(t23.val[1]));
+    t2 = vcombine_f32(vget_high_f32(t01.val[0]), vget_high_f32(t23.val[0]));
+    t3 = vcombine_f32(vget_high_f32(t01.val[1]), vget_high_f32(t23.val[1]));
+
+    /* Cubic interpolation weights as in arm_sin_f32() */
+    fract2 = vmulq_f32(fract, fract);
+    fract3 = vmulq_f32(fract, fract2);
+    wa = vsubq_f32(vmulq_n_f32(fract2, 0.5f),
+                   vaddq_f32(vmulq_n_f32(fract3, 0.166666667f), vmulq_n_f32(fract, 0.3333333333333f)));
+    wb = vaddq_f32(vsubq_f32(vmulq_n_f32(fract3, 0.5f), vaddq_f32(fract2, vmulq_n_f32(fract, 0.5f))),
+                   vdupq_n_f32(1.0f));
+    wc = vaddq_f32(vsubq_f32(vmulq_n_f32(fract2, 0.5f), vmulq_n_f32(fract3, 0.5f)), fract);
+    wd = vsubq_f32(vmulq_n_f32(fract3, 0.166666667f), vmulq_n_f32(fract, 0.166666667f));
+
+    /* Weighted sum of the four nearest table values */
+    vst1q_f32(pDst, vaddq_f32(vaddq_f32(vmulq_f32(t0, wa), vmulq_f32(t1, wb)),
+                              vaddq_f32(vmulq_f32(t2, wc), vmulq_f32(t3, wd))));
+    pSrc += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Compute the remaining 1 to 3 samples below */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_SSE2) */
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    /* Scale the input from radians to turns */
+    *pDst++ = arm_sin_block_sample_f32(*pSrc++ * 0.159154943092f);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of sin group
+ */
@@ -0,0 +1,333 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_sin_block_q31.c
+*
+* Description:	Fast sine calculation for a block of Q31 values.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup sin
+ * @{
+ */
+
+/**
+ * @brief  Sine of one phase.
+ * @param[in]  in phase in [0 1) turns, in 1.31 format.
+ * @return the sine.
+ */
+
+static __INLINE q31_t arm_sin_block_sample_q31(
+  uint32_t in)
+{
+  q31_t sinVal;                                  /* Temporary variable for output */
+  q31_t wa, wb, wc, wd;                          /* Cubic interpolation coefficients */
+  q31_t fract, fractCube, fractSquare;           /* Temporary values for fractional values */
+  q31_t oneBy6 = 0x15555555;                     /* Fixed point value of 1/6 */
+  const q31_t *tablePtr;                         /* Pointer to table */
+
+  /* Table index from the upper bits, fractional value from the lower bits */
+  tablePtr = &sinTable_q31[in >> 23u];
+  fract = (q31_t) ((in & 0x7FFFFFu) << 8u);
+
+  fractSquare = ((q31_t) (((q63_t) fract * fract) >> 32));
+  fractSquare = fractSquare << 1;
+  fractCube = ((q31_t) (((q63_t) fractSquare * fract) >> 32));
+  fractCube = fractCube << 1;
+
+  /* Cubic interpolation as in arm_sin_q31().  The accumulations ((a << 32) + b * c) >> 32
+   ** are written as a + ((b * c) >> 32), the same value without a shift of a negative
+   ** number, and the multiply accumulate form the Cortex-M4 has an instruction for */
+  wa = ((q31_t) (((q63_t) oneBy6 * fractCube) >> 32));
+  wa = wa + (q31_t) (((q63_t) 0x2AAAAAAA * fract) >> 32);
+  wa = -(wa << 1u);
+  wa += (fractSquare >> 1u);
+  sinVal = ((q31_t) (((q63_t) tablePtr[0] * wa) >> 32));
+
+  /* fractSquare + fract / 2 can exceed the 1.31 range, so this weight is summed in
+   ** unsigned arithmetic, where the wrap around is defined */
+  wb = (q31_t) ((((uint32_t) fractCube >> 1u) - ((uint32_t) fractSquare + ((uint32_t) fract >> 1u))) +
+                0x7FFFFFFFu);
+  sinVal = sinVal + (q31_t) (((q63_t) tablePtr[1] * wb) >> 32);
+
+  wc = -fractCube + fractSquare;
+  wc = (wc >> 1u) + fract;
+  sinVal = sinVal + (q31_t) (((q63_t) tablePtr[2] * wc) >> 32);
+
+  fractCube = fractCube - fract;
+  wd = ((q31_t) (((q63_t) oneBy6 * fractCube) >> 32));
+  wd = wd * 2;
+  sinVal = sinVal + (q31_t) (((q63_t) tablePtr[3] * wd) >> 32);
+
+  /* Convert the 2.30 result to 1.31 format, saturated, as the interpolation
+   * can overshoot full scale next to the peaks */
+  return (clip_q63_to_q31((q63_t) sinVal * 2));
+}
+
+#if defined (ARM_MATH_CM0) && defined (ARM_MATH_SSE2)
+
+/**
+ * @brief  High halves of the products of 4 pairs of unsigned 32 bit values.
+ */
+
+static __INLINE __m128i arm_sin_block_mulhi_epu32(
+  __m128i a,
+  __m128i b)
+{
+  /* The products of the even and of the odd lanes, 64 bits each */
+  __m128i even = _mm_mul_epu32(a, b);
+  __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+
+  return (_mm_or_si128(_mm_srli_epi64(even, 32), _mm_and_si128(odd, _mm_set_epi32(-1, 0, -1, 0))));
+}
+
+/**
+ * @brief  High halves of the products of 4 pairs of signed 32 bit values.
+ */
+
+static __INLINE __m128i arm_sin_block_mulhi_epi32(
+  __m128i a,
+  __m128i b)
+{
+  /* A negative factor is read as 2^32 more by the unsigned multiply, which adds the
+   * other factor to the high half */
+  return (_mm_sub_epi32(_mm_sub_epi32(arm_sin_block_mulhi_epu32(a, b),
+                                      _mm_and_si128(_mm_srai_epi32(a, 31), b)),
+                        _mm_and_si128(_mm_srai_epi32(b, 31), a)));
+}
+
+#endif /* #if defined (ARM_MATH_CM0) && defined (ARM_MATH_SSE2) */
+
+/**
+ * @brief  Fast approximation to the trigonometric sine function for a block of Q31 data.
+ * @param[in]  *pSrc points to the scaled input values
+ * @param[out] *pDst points to the output values
+ * @param[in]  blockSize number of values to compute
+ * @return none.
+ *
+ * \par
+ * The input is a phase in turns: the range [0 +1) is mapped to [0 2*pi), as for
+ * arm_sin_q31(), and negative inputs are taken modulo one turn, so the range [-1 0)
+ * is mapped to [-2*pi 0).  The results are those of arm_sin_q31() for inputs in [0 +1),
+ * except next to the peaks, where the output is saturated instead of wrapping around.
+ * The vector paths interpolate 4 values at a time and give the same results.
+ */
+
+void arm_sin_block_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /* loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* Phases modulo one turn */
+    *pDst++ = arm_sin_block_sample_q31(((uint32_t) *pSrc++) & 0x7FFFFFFFu);
+    *pDst++ = arm_sin_block_sample_q31(((uint32_t) *pSrc++) & 0x7FFFFFFFu);
+    *pDst++ = arm_sin_block_sample_q31(((uint32_t) *pSrc++) & 0x7FFFFFFFu);
+    *pDst++ = arm_sin_block_sample_q31(((uint32_t) *pSrc++) & 0x7FFFFFFFu);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+#if defined (ARM_MATH_SSE2)
+
+  __m128i in, fract, fractSquare, fractCube;     /* Phases, fractional values and their powers */
+  __m128i wa, wb, wc, wd;                        /* Cubic interpolation coefficients */
+  __m128i t0, t1, t2, t3;                        /* Table values, one row per value at first */
+  __m128i lo, hi;                                /* Half transposed table values */
+  __m128i sinVal, over;                          /* Sums and their overflow mask */
+
+  /* Host build: compute 4 values per SSE2 operation */
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    /* Phases modulo one turn */
+    in = _mm_and_si128(_mm_loadu_si128((__m128i *) pSrc), _mm_set1_epi32(0x7FFFFFFF));
+
+    /* The four nearest table values of each input are contiguous: load them as rows
+     * and transpose them to one vector per tap */
+    t0 = _mm_srli_epi32(in, 23);
+    t1 = _mm_loadu_si128((__m128i *) &sinTable_q31[_mm_cvtsi128_si32(_mm_shuffle_epi32(t0, 0x55))]);
+    t2 = _mm_loadu_si128((__m128i *) &sinTable_q31[_mm_cvtsi128_si32(_mm_shuffle_epi32(t0, 0xAA))]);
+    t3 = _mm_loadu_si128((__m128i *) &sinTable_q31[_mm_cvtsi128_si32(_mm_shuffle_epi32(t0, 0xFF))]);
+    t0 = _mm_loadu_si128((__m128i *) &sinTable_q31[_mm_cvtsi128_si32(t0)]);
+    lo = _mm_unpacklo_epi32(t0, t1);
+    hi = _mm_unpacklo_epi32(t2, t3);
+    t1 = _mm_unpackhi_epi32(t0, t1);
+    t3 = _mm_unpackhi_epi32(t2, t3);
+    t0 = _mm_unpacklo_epi64(lo, hi);
+    t2 = _mm_unpacklo_epi64(t1, t3);
+    t3 = _mm_unpackhi_epi64(t1, t3);
+    t1 = _mm_unpackhi_epi64(lo, hi);
+
+    /* Fractional values from the lower bits; the fraction and its powers are not
+     * negative, so their products are unsigned */
+    fract = _mm_slli_epi32(_mm_and_si128(in, _mm_set1_epi32(0x7FFFFF)), 8);
+    fractSquare = _mm_slli_epi32(arm_sin_block_mulhi_epu32(fract, fract), 1);
+    fractCube = _mm_slli_epi32(arm_sin_block_mulhi_epu32(fractSquare, fract), 1);
+
+    /* Cubic interpolation as in arm_sin_q31() */
+    wa = _mm_add_epi32(arm_sin_block_mulhi_epu32(_mm_set1_epi32(0x15555555), fractCube),
+                       arm_sin_block_mulhi_epu32(_mm_set1_epi32(0x2AAAAAAA), fract));
+    wa = _mm_sub_epi32(_mm_srai_epi32(fractSquare, 1), _mm_slli_epi32(wa, 1));
+    wb = _mm_add_epi32(_mm_sub_epi32(_mm_srli_epi32(fractCube, 1),
+                                     _mm_add_epi32(fractSquare, _mm_srli_epi32(fract, 1))),
+                       _mm_set1_epi32(0x7FFFFFFF));
+    wc = _mm_add_epi32(_mm_srai_epi32(_mm_sub_epi32(fractSquare, fractCube), 1), fract);
+    wd = _mm_slli_epi32(arm_sin_block_mulhi_epi32(_mm_set1_epi32(0x15555555),
+                                                  _mm_sub_epi32(fractCube, fract)), 1);
+
+    sinVal = arm_sin_block_mulhi_epi32(t0, wa);
+    sinVal = _mm_add_epi32(sinVal, arm_sin_block_mulhi_epi32(t1, wb));
+    sinVal = _mm_add_epi32(sinVal, arm_sin_block_mulhi_epi32(t2, wc));
+    sinVal = _mm_add_epi32(sinVal, arm_sin_block_mulhi_epi32(t3, wd));
+
+    /* Convert the 2.30 results to 1.31 format, saturated where the doubling
+     * changes the sign */
+    in = _mm_slli_epi32(sinVal, 1);
+    over = _mm_srai_epi32(_mm_xor_si128(sinVal, in), 31);
+    in = _mm_or_si128(_mm_andnot_si128(over, in),
+                      _mm_and_si128(over, _mm_xor_si128(_mm_srai_epi32(sinVal, 31), _mm_set1_epi32(0x7FFFFFFF))));
+
+    _mm_storeu_si128((__m128i *) pDst, in);
+    pSrc += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Compute the remaining 1 to 3 samples below */
+  blkCnt = blockSize % 0x4u;
+
+#elif defined (ARM_MATH_NEON)
+
+  int32x4_t in, fract, fractSquare, fractCube;   /* Phases, fractional values and their powers */
+  int32x4_t wa, wb, wc, wd;                      /* Cubic interpolation coefficients */
+  int32x4_t t0, t1, t2, t3;                      /* Table values, one row per value at first */
+  int32x4x2_t t01, t23;                          /* Half transposed table values */
+  int32x4_t sinVal;                              /* Sums */
+  uint32x4_t idx;                                /* Table indices */
+
+  /* Host build: compute 4 values per NEON operation.  The high halves of the products
+   * are taken from the full 64 bit products, as in the scalar code */
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    /* Phases modulo one turn */
+    in = vandq_s32(vld1q_s32(pSrc), vdupq_n_s32(0x7FFFFFFF));
+
+    /* The four nearest table values of each input are contiguous: load them as rows
+     * and transpose them to one vector per tap */
+    idx = vshrq_n_u32(vreinterpretq_u32_s32(in), 23);
+    t0 = vld1q_s32(&sinTable_q31[vgetq_lane_u32(idx, 0)]);
+    t1 = vld1q_s32(&sinTable_q31[vgetq_lane_u32(idx, 1)]);
+    t2 = vld1q_s32(&sinTable_q31[vgetq_lane_u32(idx, 2)]);
+    t3 = vld1q_s32(&sinTable_q31[vgetq_lane_u32(idx, 3)]);
+    t01 = vtrnq_s32(t0, t1);
+    t23 = vtrnq_s32(t2, t3);
+    t0 = vcombine_s32(vget_low_s32(t01.val[0]), vget_low_s32(t23.val[0]));
+    t1 = vcombine_s32(vget_low_s32(t01.val[1]), vget_low_s32(t23.val[1]));
+    t2 = vcombine_s32(vget_high_s32(t01.val[0]), vget_high_s32(t23.val[0]));
+    t3 = vcombine_s32(vget_high_s32(t01.val[1]), vget_high_s32(t23.val[1]));
+
+    /* Fractional values from the lower bits */
+    fract = vshlq_n_s32(vandq_s32(in, vdupq_n_s32(0x7FFFFF)), 8);
+    fractSquare = vshlq_n_s32(vcombine_s32(vshrn_n_s64(vmull_s32(vget_low_s32(fract), vget_low_s32(fract)), 32),
+                                           vshrn_n_s64(vmull_s32(vget_high_s32(fract), vget_high_s32(fract)), 32)), 1);
+    fractCube = vshlq_n_s32(vcombine_s32(vshrn_n_s64(vmull_s32(vget_low_s32(fractSquare), vget_low_s32(fract)), 32),
+                                         vshrn_n_s64(vmull_s32(vget_high_s32(fractSquare), vget_high_s32(fract)), 32)), 1);
+
+    /* Cubic interpolation as in arm_sin_q31() */
+    wa = vaddq_s32(vcombine_s32(vshrn_n_s64(vmull_n_s32(vget_low_s32(fractCube), 0x15555555), 32),
+                                vshrn_n_s64(vmull_n_s32(vget_high_s32(fractCube), 0x15555555), 32)),
+                   vcombine_s32(vshrn_n_s64(vmull_n_s32(vget_low_s32(fract), 0x2AAAAAAA), 32),
+                                vshrn_n_s64(vmull_n_s32(vget_high_s32(fract), 0x2AAAAAAA), 32)));
+    wa = vsubq_s32(vshrq_n_s32(fractSquare, 1), vshlq_n_s32(wa, 1));
+    wb = vreinterpretq_s32_u32(vaddq_u32(vsubq_u32(vshrq_n_u32(vreinterpretq_u32_s32(fractCube), 1),
+                                                   vaddq_u32(vreinterpretq_u32_s32(fractSquare),
+                                                             vshrq_n_u32(vreinterpretq_u32_s32(fract), 1))),
+                                         vdupq_n_u32(0x7FFFFFFFu)));
+    wc = vaddq_s32(vshrq_n_s32(vsubq_s32(fractSquare, fractCube), 1), fract);
+    fractCube = vsubq_s32(fractCube, fract);
+    wd = vshlq_n_s32(vcombine_s32(vshrn_n_s64(vmull_n_s32(vget_low_s32(fractCube), 0x15555555), 32),
+                                  vshrn_n_s64(vmull_n_s32(vget_high_s32(fractCube), 0x15555555), 32)), 1);
+
+    sinVal = vcombine_s32(vshrn_n_s64(vmull_s32(vget_low_s32(t0), vget_low_s32(wa)), 32),
+                          vshrn_n_s64(vmull_s32(vget_high_s32(t0), vget_high_s32(wa)), 32));
+    sinVal = vaddq_s32(sinVal, vcombine_s32(vshrn_n_s64(vmull_s32(vget_low_s32(t1), vget_low_s32(wb)), 32),
+                                            vshrn_n_s64(vmull_s32(vget_high_s32(t1), vget_high_s32(wb)), 32)));
+    sinVal = vaddq_s32(sinVal, vcombine_s32(vshrn_n_s64(vmull_s32(vget_low_s32(t2), vget_low_s32(wc)), 32),
+                                            vshrn_n_s64(vmull_s32(vget_high_s32(t2), vget_high_s32(wc)), 32)));
+    sinVal = vaddq_s32(sinVal, vcombine_s32(vshrn_n_s64(vmull_s32(vget_low_s32(t3), vget_low_s32(wd)), 32),
+                                            vshrn_n_s64(vmull_s32(vget_high_s32(t3), vget_high_s32(wd)), 32)));
+
+    /* Convert the 2.30 results to 1.31 format, saturated */
+    vst1q_s32(pDst, vqshlq_n_s32(sinVal, 1));
+    pSrc += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Compute the remaining 1 to 3 samples below */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_SSE2) */
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    /* Phase modulo one turn */
+    *pDst++ = arm_sin_block_sample_q31(((uint32_t) *pSrc++) & 0x7FFFFFFFu);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of sin group
+ */
@@ -28,6 +28,7 @@
 * -------------------------------------------------------------------- */
 
 #include "arm_math.h"
+#include "arm_common_tables.h"
 
 /**   
  * @ingroup groupFastMath   
@@ -73,119 +74,6 @@
  */
 
 
-/**  
- * \par   
- * Example code for Generation of Floating-point Sin Table:  
- * tableSize = 256;   
- * <pre>for(n = -1; n < (tableSize + 1); n++)   
- * {   
- *	sinTable[n+1]=sin(2*pi*n/tableSize);   
- * }</pre>   
- * \par   
- * where pi value is  3.14159265358979   
- */
-
-static const float32_t sinTable[259] = {
-  -0.024541229009628296f, 0.000000000000000000f, 0.024541229009628296f,
-  0.049067676067352295f, 0.073564566671848297f, 0.098017141222953796f,
-  0.122410677373409270f, 0.146730467677116390f,
-  0.170961886644363400f, 0.195090323686599730f, 0.219101235270500180f,
-  0.242980182170867920f, 0.266712754964828490f, 0.290284663438797000f,
-  0.313681751489639280f, 0.336889863014221190f,
-  0.359895050525665280f, 0.382683426141738890f, 0.405241310596466060f,
-  0.427555084228515630f, 0.449611335992813110f, 0.471396744251251220f,
-  0.492898195981979370f, 0.514102756977081300f,
-  0.534997642040252690f, 0.555570244789123540f, 0.575808167457580570f,
-  0.595699310302734380f, 0.615231573581695560f, 0.634393274784088130f,
-  0.653172850608825680f, 0.671558976173400880f,
-  0.689540565013885500f, 0.707106769084930420f, 0.724247097969055180f,
-  0.740951120853424070f, 0.757208824157714840f, 0.773010432720184330f,
-  0.788346409797668460f, 0.803207516670227050f,
-  0.817584812641143800f, 0.831469595432281490f, 0.844853579998016360f,
-  0.857728600502014160f, 0.870086967945098880f, 0.881921291351318360f,
-  0.893224298954010010f, 0.903989315032958980f,
-  0.914209783077239990f, 0.923879504203796390f, 0.932992815971374510f,
-  0.941544055938720700f, 0.949528157711029050f, 0.956940352916717530f,
-  0.963776051998138430f, 0.970031261444091800f,
-  0.975702106952667240f, 0.980785250663757320f, 0.985277652740478520f,
-  0.989176511764526370f, 0.992479562759399410f, 0.995184719562530520f,
-  0.997290432453155520f, 0.998795449733734130f,
-  0.999698817729949950f, 1.000000000000000000f, 0.999698817729949950f,
-  0.998795449733734130f, 0.997290432453155520f, 0.995184719562530520f,
-  0.992479562759399410f, 0.989176511764526370f,
-  0.985277652740478520f, 0.980785250663757320f, 0.975702106952667240f,
-  0.970031261444091800f, 0.963776051998138430f, 0.956940352916717530f,
-  0.949528157711029050f, 0.941544055938720700f,
-  0.932992815971374510f, 0.923879504203796390f, 0.914209783077239990f,
-  0.903989315032958980f, 0.893224298954010010f, 0.881921291351318360f,
-  0.870086967945098880f, 0.857728600502014160f,
-  0.844853579998016360f, 0.831469595432281490f, 0.817584812641143800f,
-  0.803207516670227050f, 0.788346409797668460f, 0.773010432720184330f,
-  0.757208824157714840f, 0.740951120853424070f,
-  0.724247097969055180f, 0.707106769084930420f, 0.689540565013885500f,
-  0.671558976173400880f, 0.653172850608825680f, 0.634393274784088130f,
-  0.615231573581695560f, 0.595699310302734380f,
-  0.575808167457580570f, 0.555570244789123540f, 0.534997642040252690f,
-  0.514102756977081300f, 0.492898195981979370f, 0.471396744251251220f,
-  0.449611335992813110f, 0.427555084228515630f,
-  0.405241310596466060f, 0.382683426141738890f, 0.359895050525665280f,
-  0.336889863014221190f, 0.313681751489639280f, 0.290284663438797000f,
-  0.266712754964828490f, 0.242980182170867920f,
-  0.219101235270500180f, 0.195090323686599730f, 0.170961886644363400f,
-  0.146730467677116390f, 0.122410677373409270f, 0.098017141222953796f,
-  0.073564566671848297f, 0.049067676067352295f,
-  0.024541229009628296f, 0.000000000000000122f, -0.024541229009628296f,
-  -0.049067676067352295f, -0.073564566671848297f, -0.098017141222953796f,
-  -0.122410677373409270f, -0.146730467677116390f,
-  -0.170961886644363400f, -0.195090323686599730f, -0.219101235270500180f,
-  -0.242980182170867920f, -0.266712754964828490f, -0.290284663438797000f,
-  -0.313681751489639280f, -0.336889863014221190f,
-  -0.359895050525665280f, -0.382683426141738890f, -0.405241310596466060f,
-  -0.427555084228515630f, -0.449611335992813110f, -0.471396744251251220f,
-  -0.492898195981979370f, -0.514102756977081300f,
-  -0.534997642040252690f, -0.555570244789123540f, -0.575808167457580570f,
-  -0.595699310302734380f, -0.615231573581695560f, -0.634393274784088130f,
-  -0.653172850608825680f, -0.671558976173400880f,
-  -0.689540565013885500f, -0.707106769084930420f, -0.724247097969055180f,
-  -0.740951120853424070f, -0.757208824157714840f, -0.773010432720184330f,
-  -0.788346409797668460f, -0.803207516670227050f,
-  -0.817584812641143800f, -0.831469595432281490f, -0.844853579998016360f,
-  -0.857728600502014160f, -0.870086967945098880f, -0.881921291351318360f,
-  -0.893224298954010010f, -0.903989315032958980f,
-  -0.914209783077239990f, -0.923879504203796390f, -0.932992815971374510f,
-  -0.941544055938720700f, -0.949528157711029050f, -0.956940352916717530f,
-  -0.963776051998138430f, -0.970031261444091800f,
-  -0.975702106952667240f, -0.980785250663757320f, -0.985277652740478520f,
-  -0.989176511764526370f, -0.992479562759399410f, -0.995184719562530520f,
-  -0.997290432453155520f, -0.998795449733734130f,
-  -0.999698817729949950f, -1.000000000000000000f, -0.999698817729949950f,
-  -0.998795449733734130f, -0.997290432453155520f, -0.995184719562530520f,
-  -0.992479562759399410f, -0.989176511764526370f,
-  -0.985277652740478520f, -0.980785250663757320f, -0.975702106952667240f,
-  -0.970031261444091800f, -0.963776051998138430f, -0.956940352916717530f,
-  -0.949528157711029050f, -0.941544055938720700f,
-  -0.932992815971374510f, -0.923879504203796390f, -0.914209783077239990f,
-  -0.903989315032958980f, -0.893224298954010010f, -0.881921291351318360f,
-  -0.870086967945098880f, -0.857728600502014160f,
-  -0.844853579998016360f, -0.831469595432281490f, -0.817584812641143800f,
-  -0.803207516670227050f, -0.788346409797668460f, -0.773010432720184330f,
-  -0.757208824157714840f, -0.740951120853424070f,
-  -0.724247097969055180f, -0.707106769084930420f, -0.689540565013885500f,
-  -0.671558976173400880f, -0.653172850608825680f, -0.634393274784088130f,
-  -0.615231573581695560f, -0.595699310302734380f,
-  -0.575808167457580570f, -0.555570244789123540f, -0.534997642040252690f,
-  -0.514102756977081300f, -0.492898195981979370f, -0.471396744251251220f,
-  -0.449611335992813110f, -0.427555084228515630f,
-  -0.405241310596466060f, -0.382683426141738890f, -0.359895050525665280f,
-  -0.336889863014221190f, -0.313681751489639280f, -0.290284663438797000f,
-  -0.266712754964828490f, -0.242980182170867920f,
-  -0.219101235270500180f, -0.195090323686599730f, -0.170961886644363400f,
-  -0.146730467677116390f, -0.122410677373409270f, -0.098017141222953796f,
-  -0.073564566671848297f, -0.049067676067352295f,
-  -0.024541229009628296f, -0.000000000000000245f, 0.024541229009628296f
-};
-
-
 /**  
  * @brief  Fast approximation to the trigonometric sine function for floating-point data.  
  * @param[in] x input value in radians.  
@@ -226,7 +114,7 @@ float32_t arm_sin_f32(
   fract = ((float32_t) tableSize * in) - (float32_t) index;
 
   /* Initialise table pointer */
-  tablePtr = (float32_t *) & sinTable[index];
+  tablePtr = (float32_t *) & sinTable_f32[index];
 
   /* Read four nearest values of output value from the sin table */
   a = *tablePtr++;
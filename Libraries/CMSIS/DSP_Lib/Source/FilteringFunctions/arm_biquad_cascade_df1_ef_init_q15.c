@@ -0,0 +1,85 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_biquad_cascade_df1_ef_init_q15.c
+*
+* Description:	Q15 Biquad cascade filter with error feedback initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadCascadeDF1_EF
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 Biquad cascade filter with error feedback.
+ * @param[in,out] *S           points to an instance of the Q15 Biquad cascade structure with error feedback.
+ * @param[in]     numStages    number of 2nd order stages in the filter.
+ * @param[in]     *pCoeffs     points to the filter coefficients.
+ * @param[in]     *pState      points to the state buffer.
+ * @param[in]     postShift    Shift to be applied to the accumulator result. Varies according to the coefficients format
+ * @param[in]     efOrder      order of the error feedback: 0 (none), 1 or 2.  Larger values are treated as 2.
+ * @return        none
+ *
+ * <b>Coefficient and State Ordering:</b>
+ * \par
+ * The coefficients are stored in the array <code>pCoeffs</code> in the following order:
+ * <pre>
+ *     {b10, 0, b11, b12, a11, a12, b20, 0, b21, b22, a21, a22, ...}
+ * </pre>
+ * as for <code>arm_biquad_cascade_df1_init_q15()</code>.  The <code>pCoeffs</code> array contains a total of <code>6*numStages</code> values.
+ *
+ * \par
+ * The state variables are stored in the array <code>pState</code>.
+ * Each Biquad stage has 6 state variables <code>x[n-1], x[n-2], y[n-1], y[n-2], e[n-1]</code> and <code>e[n-2]</code>,
+ * arranged in the state array as:
+ * <pre>
+ *     {x[n-1], x[n-2], y[n-1], y[n-2], e[n-1], e[n-2]}
+ * </pre>
+ * The 6 state variables for stage 1 are first, then the 6 state variables for stage 2, and so on.
+ * The state array has a total length of <code>6*numStages</code> values.
+ * The state variables are updated after each block of data is processed; the coefficients are untouched.
+ */
+
+void arm_biquad_cas_df1_ef_init_q15(
+  arm_biquad_cas_df1_ef_ins_q15 * S,
+  uint8_t numStages,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  int8_t postShift,
+  uint8_t efOrder)
+{
+  /* Assign filter stages */
+  S->numStages = (int8_t) numStages;
+
+  /* Assign postShift to be applied to the output */
+  S->postShift = postShift;
+
+  /* Assign the order of the error feedback */
+  S->efOrder = efOrder;
+
+  /* Assign coefficient pointer */
+  S->pCoeffs = pCoeffs;
+
+  /* Clear state buffer and size is always 6 * numStages */
+  memset(pState, 0, (6u * (uint32_t) numStages) * sizeof(q15_t));
+
+  /* Assign state pointer */
+  S->pState = pState;
+}
+
+/**
+ * @} end of BiquadCascadeDF1_EF group
+ */
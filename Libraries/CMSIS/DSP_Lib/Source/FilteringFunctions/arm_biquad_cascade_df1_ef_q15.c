@@ -0,0 +1,332 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_biquad_cascade_df1_ef_q15.c
+*
+* Description:	Q15 Biquad cascade filter with error feedback processing function
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadCascadeDF1_EF
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q15 Biquad cascade filter with error feedback.
+ * @param[in]  *S         points to an instance of the Q15 Biquad cascade structure with error feedback.
+ * @param[in]  *pSrc      points to the block of input data.
+ * @param[out] *pDst      points to the block of output data.
+ * @param[in]  blockSize  number of samples to process per call.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function is implemented using a 64-bit internal accumulator, as <code>arm_biquad_cascade_df1_q15()</code>.
+ * The error terms are added to the accumulator before it is shifted by <code>postShift</code> bits,
+ * truncated to 1.15 format by discarding the low 15 bits and saturated.
+ * The error is the discarded low bits only, so a saturated output does not feed its clipping
+ * error back into the filter.  The error terms are kept in the state buffer as q15_t values.
+ */
+
+void arm_biquad_cas_df1_ef_q15(
+  const arm_biquad_cas_df1_ef_ins_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pIn = pSrc;                             /*  Source pointer                               */
+  q15_t *pOut = pDst;                            /*  Destination pointer                          */
+  q63_t acc;                                     /*  Accumulator                                  */
+  int32_t shift = (15 - (int32_t) S->postShift); /*  Post shift                                   */
+  q31_t mask = (1 << shift) - 1;                 /*  Bits discarded by the shift                  */
+  q15_t *pState = S->pState;                     /*  State pointer                                */
+  q15_t *pCoeffs = S->pCoeffs;                   /*  Coefficient pointer                          */
+  q31_t k1, k2;                                  /*  Error feedback coefficients                  */
+  uint32_t sample, stage = (uint32_t) S->numStages;     /*  Stage loop counter                           */
+
+  /* Error feedback coefficients for the order of the instance */
+  k1 = (S->efOrder == 0u) ? 0 : ((S->efOrder == 1u) ? 1 : 2);
+  k2 = (S->efOrder >= 2u) ? -1 : 0;
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  {
+    q31_t in;                                    /*  Temporary variable to hold input value       */
+    q31_t out;                                   /*  Temporary variable to hold output value      */
+    q31_t b0;                                    /*  Temporary variable to hold bo value          */
+    q31_t b1, a1;                                /*  Filter coefficients                          */
+    q31_t state_in, state_out;                   /*  Filter state variables                       */
+    q31_t coefErr, state_err;                    /*  Packed {k1, k2} and {e[n-1], e[n-2]}         */
+    q31_t *pState_q31;                           /*  32-bit state pointer for SIMD implementation */
+
+    /* Both halves are built in registers, so the packing does not depend on the endianness */
+    coefErr = __PKHBT(k1, k2, 16);
+
+    do
+    {
+      /* Initialize state pointer of type q31 */
+      pState_q31 = (q31_t *) (pState);
+
+      /* Read the b0 and 0 coefficients using SIMD  */
+      b0 = *__SIMD32(pCoeffs)++;
+
+      /* Read the b1 and b2 coefficients using SIMD */
+      b1 = *__SIMD32(pCoeffs)++;
+
+      /* Read the a1 and a2 coefficients using SIMD */
+      a1 = *__SIMD32(pCoeffs)++;
+
+      /* Read the input state values from the state buffer:  x[n-1], x[n-2] */
+      state_in = (q31_t) (*pState_q31++);
+
+      /* Read the output state values from the state buffer:  y[n-1], y[n-2] */
+      state_out = (q31_t) (*pState_q31);
+
+      /* Read the error state values e[n-1], e[n-2] */
+      state_err = __PKHBT(pState[4], pState[5], 16);
+
+      /* Apply loop unrolling and compute 2 output values simultaneously. */
+      sample = blockSize >> 1u;
+
+      while(sample > 0u)
+      {
+        /* Read the input */
+        in = *__SIMD32(pIn)++;
+
+        /* out =  b0 * x[n] + 0 * 0 */
+        out = __SMUAD(b0, in);
+
+        /* acc +=  b1 * x[n-1] +  b2 * x[n-2] + out */
+        acc = __SMLALD(b1, state_in, out);
+        /* acc +=  a1 * y[n-1] +  a2 * y[n-2] */
+        acc = __SMLALD(a1, state_out, acc);
+        /* acc +=  k1 * e[n-1] +  k2 * e[n-2] */
+        acc = __SMLALD(coefErr, state_err, acc);
+
+        /* The result is converted to 1.15 and saturated, the discarded bits are the new error */
+        out = __SSAT((acc >> shift), 16);
+        state_err = __PKHBT(((q31_t) acc & mask), state_err, 16);
+
+#ifndef  ARM_MATH_BIG_ENDIAN
+
+        state_in = __PKHBT(in, state_in, 16);
+        state_out = __PKHBT(out, state_out, 16);
+
+#else
+
+        state_in = __PKHBT(state_in >> 16, (in >> 16), 16);
+        state_out = __PKHBT(state_out >> 16, (out), 16);
+
+#endif /*      #ifndef  ARM_MATH_BIG_ENDIAN    */
+
+        /* out =  b0 * x[n] + 0 * 0 */
+        out = __SMUADX(b0, in);
+        /* acc +=  b1 * x[n-1] +  b2 * x[n-2] + out */
+        acc = __SMLALD(b1, state_in, out);
+        /* acc +=  a1 * y[n-1] + a2 * y[n-2] */
+        acc = __SMLALD(a1, state_out, acc);
+        /* acc +=  k1 * e[n-1] +  k2 * e[n-2] */
+        acc = __SMLALD(coefErr, state_err, acc);
+
+        out = __SSAT((acc >> shift), 16);
+        state_err = __PKHBT(((q31_t) acc & mask), state_err, 16);
+
+        /* Store the output in the destination buffer. */
+
+#ifndef  ARM_MATH_BIG_ENDIAN
+
+        *__SIMD32(pOut)++ = __PKHBT(state_out, out, 16);
+
+#else
+
+        *__SIMD32(pOut)++ = __PKHBT(out, state_out >> 16, 16);
+
+#endif /*      #ifndef  ARM_MATH_BIG_ENDIAN    */
+
+#ifndef  ARM_MATH_BIG_ENDIAN
+
+        state_in = __PKHBT(in >> 16, state_in, 16);
+        state_out = __PKHBT(out, state_out, 16);
+
+#else
+
+        state_in = __PKHBT(state_in >> 16, in, 16);
+        state_out = __PKHBT(state_out >> 16, out, 16);
+
+#endif /*      #ifndef  ARM_MATH_BIG_ENDIAN    */
+
+        /* Decrement the loop counter */
+        sample--;
+      }
+
+      /* If the blockSize is not a multiple of 2, compute the remaining output sample here. */
+      if((blockSize & 0x1u) != 0u)
+      {
+        /* Read the input */
+        in = *pIn++;
+
+        /* out =  b0 * x[n] + 0 * 0 */
+
+#ifndef  ARM_MATH_BIG_ENDIAN
+
+        out = __SMUAD(b0, in);
+
+#else
+
+        out = __SMUADX(b0, in);
+
+#endif /*      #ifndef  ARM_MATH_BIG_ENDIAN    */
+
+        /* acc =  b1 * x[n-1] + b2 * x[n-2] + out */
+        acc = __SMLALD(b1, state_in, out);
+        /* acc +=  a1 * y[n-1] + a2 * y[n-2] */
+        acc = __SMLALD(a1, state_out, acc);
+        /* acc +=  k1 * e[n-1] +  k2 * e[n-2] */
+        acc = __SMLALD(coefErr, state_err, acc);
+
+        out = __SSAT((acc >> shift), 16);
+        state_err = __PKHBT(((q31_t) acc & mask), state_err, 16);
+
+        /* Store the output in the destination buffer. */
+        *pOut++ = (q15_t) out;
+
+#ifndef  ARM_MATH_BIG_ENDIAN
+
+        state_in = __PKHBT(in, state_in, 16);
+        state_out = __PKHBT(out, state_out, 16);
+
+#else
+
+        state_in = __PKHBT(state_in >> 16, in, 16);
+        state_out = __PKHBT(state_out >> 16, out, 16);
+
+#endif /*   #ifndef  ARM_MATH_BIG_ENDIAN    */
+
+      }
+
+      /*  The first stage goes from the input wire to the output wire.  */
+      /*  Subsequent numStages occur in-place in the output wire  */
+      pIn = pDst;
+
+      /* Reset the output pointer */
+      pOut = pDst;
+
+      /*  Store the updated state variables back into the state array */
+      *__SIMD32(pState)++ = state_in;
+      *__SIMD32(pState)++ = state_out;
+      *pState++ = (q15_t) state_err;
+      *pState++ = (q15_t) (state_err >> 16);
+
+      /* Decrement the loop counter */
+      stage--;
+
+    } while(stage > 0u);
+  }
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  {
+    q15_t b0, b1, b2, a1, a2;                    /*  Filter coefficients           */
+    q15_t Xn1, Xn2, Yn1, Yn2, En1, En2;          /*  Filter state variables        */
+    q15_t Xn;                                    /*  temporary input               */
+    q31_t out;                                   /*  temporary output              */
+
+    do
+    {
+      /* Reading the coefficients */
+      b0 = *pCoeffs++;
+
+      /* Skip the zero between b0 and b1 that the Cortex-M4 code uses for SIMD */
+      pCoeffs++;
+
+      b1 = *pCoeffs++;
+      b2 = *pCoeffs++;
+      a1 = *pCoeffs++;
+      a2 = *pCoeffs++;
+
+      /* Reading the state values */
+      Xn1 = pState[0];
+      Xn2 = pState[1];
+      Yn1 = pState[2];
+      Yn2 = pState[3];
+      En1 = pState[4];
+      En2 = pState[5];
+
+      sample = blockSize;
+
+      while(sample > 0u)
+      {
+        /* Read the input */
+        Xn = *pIn++;
+
+        /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+        acc = (q31_t) b0 *Xn;
+        acc += (q31_t) b1 *Xn1;
+        acc += (q31_t) b2 *Xn2;
+        acc += (q31_t) a1 *Yn1;
+        acc += (q31_t) a2 *Yn2;
+
+        /* acc +=  k1 * e[n-1] + k2 * e[n-2] */
+        acc += k1 * En1;
+        acc += k2 * En2;
+
+        /* The result is converted to 1.15 and saturated, the discarded bits are the new error */
+        out = __SSAT((acc >> shift), 16);
+
+        Xn2 = Xn1;
+        Xn1 = Xn;
+        Yn2 = Yn1;
+        Yn1 = (q15_t) out;
+        En2 = En1;
+        En1 = (q15_t) ((q31_t) acc & mask);
+
+        /* Store the output in the destination buffer. */
+        *pOut++ = (q15_t) out;
+
+        /* decrement the loop counter */
+        sample--;
+      }
+
+      /*  The first stage goes from the input wire to the output wire.  */
+      /*  Subsequent stages occur in-place in the output wire  */
+      pIn = pDst;
+
+      /* Reset the output pointer */
+      pOut = pDst;
+
+      /*  Store the updated state variables back into the pState array */
+      *pState++ = Xn1;
+      *pState++ = Xn2;
+      *pState++ = Yn1;
+      *pState++ = Yn2;
+      *pState++ = En1;
+      *pState++ = En2;
+
+      /* Decrement the loop counter */
+      stage--;
+
+    } while(stage > 0u);
+  }
+
+#endif /* #ifndef ARM_MATH_CM0 */
+}
+
+/**
+ * @} end of BiquadCascadeDF1_EF group
+ */
@@ -0,0 +1,262 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_biquad_cascade_df1_ef_q31.c
+*
+* Description:	Q31 Biquad cascade filter with error feedback processing function
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup BiquadCascadeDF1_EF Biquad Cascade Filters with Error Feedback
+ *
+ * These functions implement the Direct Form I Biquad cascade of \ref BiquadCascadeDF1
+ * for Q31 and Q15 data, with error feedback on the truncation of the accumulator.
+ * Filters whose poles are close to z=1, such as high pass filters with a very low
+ * cutoff frequency, amplify the truncation noise of the output by the gain of 1/A(z)
+ * at low frequencies, which can be 40 to 60 dB, and are prone to limit cycles.
+ * Error feedback adds the bits discarded from the previous outputs back into the
+ * accumulator, which puts zeros at z=1 in the transfer function of the truncation noise:
+ * <pre>
+ *     acc  = b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2]
+ *            + k1 * e[n-1] + k2 * e[n-2]
+ *     y[n] = acc >> shift
+ *     e[n] = acc - (y[n] << shift)
+ * </pre>
+ * <code>e[n]</code> are the low <code>shift</code> bits of the accumulator,
+ * and <code>k1, k2</code> depend on the order of the error feedback:
+ * - <code>efOrder=0</code>: <code>k1=0, k2=0</code>, no error feedback; the output is the same as that of the plain filter.
+ * - <code>efOrder=1</code>: <code>k1=1, k2=0</code>, noise shaped by <code>(1 - z^-1)</code>.
+ *   This also removes the DC offset that truncation adds to the output.
+ * - <code>efOrder=2</code>: <code>k1=2, k2=-1</code>, noise shaped by <code>(1 - z^-1)^2</code>,
+ *   which cancels the low frequency gain of a pole pair close to z=1.
+ *
+ * \par
+ * The error feedback costs two extra multiply-accumulates per stage and output, whatever
+ * the order, and 2 extra state variables per stage.  The Q31 version is a cheaper
+ * alternative to \ref BiquadCascadeDF1_32x64 for low cutoff filters; the Q15 version
+ * gets close to the noise floor of a Q31 filter while keeping Q15 data.
+ *
+ * \par
+ * The coefficients have the same format and layout as for <code>arm_biquad_cascade_df1_q31()</code> and
+ * <code>arm_biquad_cascade_df1_q15()</code>, including the <code>postShift</code> scaling.
+ * Each Biquad stage has 6 state variables, arranged in the state array as:
+ * <pre>
+ *     {x[n-1], x[n-2], y[n-1], y[n-2], e[n-1], e[n-2]}
+ * </pre>
+ * The state array has a total length of <code>6*numStages</code> values of the data type.
+ *
+ * \par Instance Structure
+ * The coefficients and state variables for a filter are stored together in an instance data structure.
+ * A separate instance structure must be defined for each filter.
+ * Coefficient arrays may be shared among several instances while state variable arrays cannot be shared.
+ *
+ * \par Init Functions
+ * There is also an associated initialization function for each data type.
+ * The initialization function performs following operations:
+ * - Sets the values of the internal structure fields.
+ * - Zeros out the values in the state buffer.
+ * \par
+ * To statically initialize the instance structure, clear the state buffer and use
+ * <pre>
+ *     arm_biquad_cas_df1_ef_ins_q31 S1 = {numStages, pState, pCoeffs, postShift, efOrder};
+ *     arm_biquad_cas_df1_ef_ins_q15 S2 = {numStages, pState, pCoeffs, postShift, efOrder};
+ * </pre>
+ */
+
+/**
+ * @addtogroup BiquadCascadeDF1_EF
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q31 Biquad cascade filter with error feedback.
+ * @param[in]  *S         points to an instance of the Q31 Biquad cascade structure with error feedback.
+ * @param[in]  *pSrc      points to the block of input data.
+ * @param[out] *pDst      points to the block of output data.
+ * @param[in]  blockSize  number of samples to process per call.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function is implemented using an internal 64-bit accumulator in 2.62 format, as
+ * <code>arm_biquad_cascade_df1_q31()</code>, and has the same overflow behavior: the input signal must be
+ * scaled down by 2 bits to avoid wrap-around.  The error terms are added to the accumulator before the
+ * 2.62 result is shifted by <code>postShift</code> bits and truncated to 1.31 format.  They are the
+ * discarded low bits and are always positive and less than 1 LSB of the output; the second order feedback
+ * adds at most 2 LSB to the accumulator.
+ */
+
+void arm_biquad_cas_df1_ef_q31(
+  const arm_biquad_cas_df1_ef_ins_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t *pIn = pSrc;                             /*  input pointer initialization  */
+  q31_t *pOut = pDst;                            /*  output pointer initialization */
+  q31_t *pState = S->pState;                     /*  pState pointer initialization */
+  q31_t *pCoeffs = S->pCoeffs;                   /*  coeff pointer initialization  */
+  q63_t acc;                                     /*  accumulator                   */
+  q31_t Xn1, Xn2, Yn1, Yn2, En1, En2;            /*  Filter state variables        */
+  q31_t b0, b1, b2, a1, a2;                      /*  Filter coefficients           */
+  q31_t Xn;                                      /*  temporary input               */
+  q31_t k1, k2;                                  /*  Error feedback coefficients   */
+  uint32_t shift = 31u - (uint32_t) S->postShift;        /*  Shift to be applied to the output */
+  q63_t mask = ((q63_t) 1 << shift) - 1;         /*  Bits discarded by the shift   */
+  uint32_t sample, stage = S->numStages;         /*  loop counters                 */
+
+  /* Error feedback coefficients for the order of the instance */
+  k1 = (S->efOrder == 0u) ? 0 : ((S->efOrder == 1u) ? 1 : 2);
+  k2 = (S->efOrder >= 2u) ? -1 : 0;
+
+  do
+  {
+    /* Reading the coefficients */
+    b0 = *pCoeffs++;
+    b1 = *pCoeffs++;
+    b2 = *pCoeffs++;
+    a1 = *pCoeffs++;
+    a2 = *pCoeffs++;
+
+    /* Reading the state values */
+    Xn1 = pState[0];
+    Xn2 = pState[1];
+    Yn1 = pState[2];
+    Yn2 = pState[3];
+    En1 = pState[4];
+    En2 = pState[5];
+
+#ifndef ARM_MATH_CM0
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Apply loop unrolling and compute 2 output values at a time. */
+    sample = blockSize >> 1u;
+
+    while(sample > 0u)
+    {
+      /* Read the first input */
+      Xn = *pIn++;
+
+      /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+      acc = (q63_t) b0 *Xn;
+      acc += (q63_t) b1 *Xn1;
+      acc += (q63_t) b2 *Xn2;
+      acc += (q63_t) a1 *Yn1;
+      acc += (q63_t) a2 *Yn2;
+
+      /* acc +=  k1 * e[n-1] + k2 * e[n-2] */
+      acc += (q63_t) k1 *En1;
+      acc += (q63_t) k2 *En2;
+
+      /* The result is converted to 1.31, the discarded bits are the new error */
+      Xn2 = Xn1;
+      Xn1 = Xn;
+      Yn2 = Yn1;
+      Yn1 = (q31_t) (acc >> shift);
+      En2 = En1;
+      En1 = (q31_t) (acc & mask);
+
+      /* Store the output in the destination buffer. */
+      *pOut++ = Yn1;
+
+      /* Read the second input */
+      Xn = *pIn++;
+
+      acc = (q63_t) b0 *Xn;
+      acc += (q63_t) b1 *Xn1;
+      acc += (q63_t) b2 *Xn2;
+      acc += (q63_t) a1 *Yn1;
+      acc += (q63_t) a2 *Yn2;
+
+      acc += (q63_t) k1 *En1;
+      acc += (q63_t) k2 *En2;
+
+      Xn2 = Xn1;
+      Xn1 = Xn;
+      Yn2 = Yn1;
+      Yn1 = (q31_t) (acc >> shift);
+      En2 = En1;
+      En1 = (q31_t) (acc & mask);
+
+      *pOut++ = Yn1;
+
+      /* decrement the loop counter */
+      sample--;
+    }
+
+    /* Compute the last output if the blockSize is odd */
+    sample = blockSize & 0x1u;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    sample = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+    while(sample > 0u)
+    {
+      /* Read the input */
+      Xn = *pIn++;
+
+      /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+      acc = (q63_t) b0 *Xn;
+      acc += (q63_t) b1 *Xn1;
+      acc += (q63_t) b2 *Xn2;
+      acc += (q63_t) a1 *Yn1;
+      acc += (q63_t) a2 *Yn2;
+
+      /* acc +=  k1 * e[n-1] + k2 * e[n-2] */
+      acc += (q63_t) k1 *En1;
+      acc += (q63_t) k2 *En2;
+
+      /* The result is converted to 1.31, the discarded bits are the new error */
+      Xn2 = Xn1;
+      Xn1 = Xn;
+      Yn2 = Yn1;
+      Yn1 = (q31_t) (acc >> shift);
+      En2 = En1;
+      En1 = (q31_t) (acc & mask);
+
+      /* Store the output in the destination buffer. */
+      *pOut++ = Yn1;
+
+      /* decrement the loop counter */
+      sample--;
+    }
+
+    /*  The first stage goes from the input buffer to the output buffer. */
+    /*  Subsequent stages occur in-place in the output buffer */
+    pIn = pDst;
+
+    /* Reset to destination pointer */
+    pOut = pDst;
+
+    /*  Store the updated state variables back into the pState array */
+    *pState++ = Xn1;
+    *pState++ = Xn2;
+    *pState++ = Yn1;
+    *pState++ = Yn2;
+    *pState++ = En1;
+    *pState++ = En2;
+
+  } while(--stage);
+}
+
+/**
+ * @} end of BiquadCascadeDF1_EF group
+ */
@@ -0,0 +1,345 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_biquad_cascade_df1_multi_f32.c
+*
+* Description:	Processing function for the floating-point multichannel
+*               Biquad cascade DirectFormI(DF1) filter.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup BiquadCascadeDF1Multi Multichannel Biquad Cascade IIR Filters Using Direct Form I Structure
+ *
+ * These functions filter <code>numChannels</code> channels through the same cascade
+ * of Biquad sections in a single call.  Each channel gives the same output as the
+ * single channel function (\ref BiquadCascadeDF1) with the same coefficients, but the
+ * coefficients of a stage are loaded once for all channels and the channels are run
+ * in pairs (host build: groups of 4 in one vector), so the independent recursions
+ * hide each other's multiply-accumulate latency.
+ *
+ * \par Data layout
+ * <code>pSrc</code> and <code>pDst</code> hold <code>blockSize</code> samples of every
+ * channel, planar (<code>ARM_MULTI_PLANAR</code>) or interleaved
+ * (<code>ARM_MULTI_INTERLEAVED</code>), as described for the multichannel FIR
+ * filters (\ref FIRMulti).
+ *
+ * \par
+ * The coefficients use the layout of the single channel function of the same data
+ * type; for Q15 this includes the zero between <code>b0</code> and <code>b1</code>.
+ *
+ * \par
+ * The state of each stage is stored as four arrays of <code>numChannels</code> values,
+ * <code>x[n-1]</code>, <code>x[n-2]</code>, <code>y[n-1]</code> and <code>y[n-2]</code>,
+ * the four arrays of stage 1 first, then those of stage 2, and so on.  The state
+ * buffer holds <code>4*numStages*numChannels</code> values.
+ *
+ * \par Fixed-Point Behavior
+ * The Q15 and Q31 versions use the arithmetic of <code>arm_biquad_cascade_df1_q15()</code>
+ * and <code>arm_biquad_cascade_df1_q31()</code>, including <code>postShift</code>.
+ */
+
+/**
+ * @addtogroup BiquadCascadeDF1Multi
+ * @{
+ */
+
+/**
+ * @param[in]  *S         points to an instance of the floating-point multichannel Biquad cascade structure.
+ * @param[in]  *pSrc      points to the block of input data, blockSize samples of every channel.
+ * @param[out] *pDst      points to the block of output data, blockSize samples of every channel.
+ * @param[in]  blockSize  number of samples per channel to process per call.
+ * @return     none.
+ */
+
+void arm_biquad_cascade_df1_multi_f32(
+  const arm_biquad_casd_df1_multi_inst_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pIn = pSrc;                         /*  source pointer            */
+  float32_t *pState = S->pState;                 /*  pState pointer            */
+  float32_t *pCoeffs = S->pCoeffs;               /*  coefficient pointer       */
+  float32_t *px, *py;                            /*  channel input and output pointers */
+  float32_t b0, b1, b2, a1, a2;                  /*  Filter coefficients       */
+  float32_t Xn, Xn1, Xn2, Yn1, Yn2, acc;         /*  State variables of the first channel of a pair  */
+  float32_t Xm, Xm1, Xm2, Ym1, Ym2, accm;        /*  State variables of the second channel of a pair */
+  uint32_t numCh = S->numChannels;               /*  Number of channels        */
+  uint32_t sampleStep, chStep;                   /*  Distance between samples and between channels in pSrc/pDst */
+  uint32_t ch, sample, stage = S->numStages;     /*  loop counters             */
+
+  if(S->layout == ARM_MULTI_INTERLEAVED)
+  {
+    sampleStep = numCh;
+    chStep = 1u;
+  }
+  else
+  {
+    sampleStep = 1u;
+    chStep = blockSize;
+  }
+
+  do
+  {
+    /* Reading the coefficients */
+    b0 = *pCoeffs++;
+    b1 = *pCoeffs++;
+    b2 = *pCoeffs++;
+    a1 = *pCoeffs++;
+    a2 = *pCoeffs++;
+
+    /* pState holds x[n-1], x[n-2], y[n-1] and y[n-2] of this stage for all channels:
+     * state k of channel ch is pState[(k * numCh) + ch] */
+    ch = 0u;
+
+#if defined (ARM_MATH_SSE2)
+
+    /* Host build: run 4 channels in one vector */
+    {
+      __m128 vB0 = _mm_set1_ps(b0), vB1 = _mm_set1_ps(b1), vB2 = _mm_set1_ps(b2);
+      __m128 vA1 = _mm_set1_ps(a1), vA2 = _mm_set1_ps(a2);
+      __m128 vXn, vX1, vX2, vY1, vY2, vAcc;
+      float32_t in[4], out[4];
+
+      while((numCh - ch) >= 4u)
+      {
+        vX1 = _mm_loadu_ps(&pState[ch]);
+        vX2 = _mm_loadu_ps(&pState[numCh + ch]);
+        vY1 = _mm_loadu_ps(&pState[(2u * numCh) + ch]);
+        vY2 = _mm_loadu_ps(&pState[(3u * numCh) + ch]);
+
+        px = pIn + (ch * chStep);
+        py = pDst + (ch * chStep);
+
+        sample = blockSize;
+
+        while(sample > 0u)
+        {
+          in[0] = px[0];
+          in[1] = px[chStep];
+          in[2] = px[2u * chStep];
+          in[3] = px[3u * chStep];
+          vXn = _mm_loadu_ps(in);
+
+          /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+          vAcc = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vB0, vXn), _mm_mul_ps(vB1, vX1)),
+                            _mm_add_ps(_mm_mul_ps(vB2, vX2),
+                                       _mm_add_ps(_mm_mul_ps(vA1, vY1), _mm_mul_ps(vA2, vY2))));
+
+          vX2 = vX1;
+          vX1 = vXn;
+          vY2 = vY1;
+          vY1 = vAcc;
+
+          _mm_storeu_ps(out, vAcc);
+          py[0] = out[0];
+          py[chStep] = out[1];
+          py[2u * chStep] = out[2];
+          py[3u * chStep] = out[3];
+
+          px += sampleStep;
+          py += sampleStep;
+
+          sample--;
+        }
+
+        _mm_storeu_ps(&pState[ch], vX1);
+        _mm_storeu_ps(&pState[numCh + ch], vX2);
+        _mm_storeu_ps(&pState[(2u * numCh) + ch], vY1);
+        _mm_storeu_ps(&pState[(3u * numCh) + ch], vY2);
+
+        ch += 4u;
+      }
+    }
+
+#elif defined (ARM_MATH_NEON)
+
+    /* Host build: run 4 channels in one vector */
+    {
+      float32x4_t vXn, vX1, vX2, vY1, vY2, vAcc;
+      float32_t in[4], out[4];
+
+      while((numCh - ch) >= 4u)
+      {
+        vX1 = vld1q_f32(&pState[ch]);
+        vX2 = vld1q_f32(&pState[numCh + ch]);
+        vY1 = vld1q_f32(&pState[(2u * numCh) + ch]);
+        vY2 = vld1q_f32(&pState[(3u * numCh) + ch]);
+
+        px = pIn + (ch * chStep);
+        py = pDst + (ch * chStep);
+
+        sample = blockSize;
+
+        while(sample > 0u)
+        {
+          in[0] = px[0];
+          in[1] = px[chStep];
+          in[2] = px[2u * chStep];
+          in[3] = px[3u * chStep];
+          vXn = vld1q_f32(in);
+
+          /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+          vAcc = vmulq_n_f32(vXn, b0);
+          vAcc = vmlaq_n_f32(vAcc, vX1, b1);
+          vAcc = vmlaq_n_f32(vAcc, vX2, b2);
+          vAcc = vmlaq_n_f32(vAcc, vY1, a1);
+          vAcc = vmlaq_n_f32(vAcc, vY2, a2);
+
+          vX2 = vX1;
+          vX1 = vXn;
+          vY2 = vY1;
+          vY1 = vAcc;
+
+          vst1q_f32(out, vAcc);
+          py[0] = out[0];
+          py[chStep] = out[1];
+          py[2u * chStep] = out[2];
+          py[3u * chStep] = out[3];
+
+          px += sampleStep;
+          py += sampleStep;
+
+          sample--;
+        }
+
+        vst1q_f32(&pState[ch], vX1);
+        vst1q_f32(&pState[numCh + ch], vX2);
+        vst1q_f32(&pState[(2u * numCh) + ch], vY1);
+        vst1q_f32(&pState[(3u * numCh) + ch], vY2);
+
+        ch += 4u;
+      }
+    }
+
+#endif /* #if defined (ARM_MATH_SSE2) */
+
+    /* Run 2 channels at a time; their recursions are independent */
+    while((numCh - ch) >= 2u)
+    {
+      Xn1 = pState[ch];
+      Xn2 = pState[numCh + ch];
+      Yn1 = pState[(2u * numCh) + ch];
+      Yn2 = pState[(3u * numCh) + ch];
+
+      Xm1 = pState[ch + 1u];
+      Xm2 = pState[numCh + ch + 1u];
+      Ym1 = pState[(2u * numCh) + ch + 1u];
+      Ym2 = pState[(3u * numCh) + ch + 1u];
+
+      px = pIn + (ch * chStep);
+      py = pDst + (ch * chStep);
+
+      sample = blockSize;
+
+      while(sample > 0u)
+      {
+        /* Read the inputs */
+        Xn = px[0];
+        Xm = px[chStep];
+
+        /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+        acc = (b0 * Xn) + (b1 * Xn1) + (b2 * Xn2) + (a1 * Yn1) + (a2 * Yn2);
+        accm = (b0 * Xm) + (b1 * Xm1) + (b2 * Xm2) + (a1 * Ym1) + (a2 * Ym2);
+
+        /* Store the results in the destination buffer */
+        py[0] = acc;
+        py[chStep] = accm;
+
+        /* Update the state variables */
+        Xn2 = Xn1;
+        Xn1 = Xn;
+        Yn2 = Yn1;
+        Yn1 = acc;
+
+        Xm2 = Xm1;
+        Xm1 = Xm;
+        Ym2 = Ym1;
+        Ym1 = accm;
+
+        px += sampleStep;
+        py += sampleStep;
+
+        sample--;
+      }
+
+      /*  Store the updated state variables back into the pState array */
+      pState[ch] = Xn1;
+      pState[numCh + ch] = Xn2;
+      pState[(2u * numCh) + ch] = Yn1;
+      pState[(3u * numCh) + ch] = Yn2;
+
+      pState[ch + 1u] = Xm1;
+      pState[numCh + ch + 1u] = Xm2;
+      pState[(2u * numCh) + ch + 1u] = Ym1;
+      pState[(3u * numCh) + ch + 1u] = Ym2;
+
+      ch += 2u;
+    }
+
+    /* Run the last channel of an odd channel count */
+    if(ch < numCh)
+    {
+      Xn1 = pState[ch];
+      Xn2 = pState[numCh + ch];
+      Yn1 = pState[(2u * numCh) + ch];
+      Yn2 = pState[(3u * numCh) + ch];
+
+      px = pIn + (ch * chStep);
+      py = pDst + (ch * chStep);
+
+      sample = blockSize;
+
+      while(sample > 0u)
+      {
+        Xn = *px;
+
+        acc = (b0 * Xn) + (b1 * Xn1) + (b2 * Xn2) + (a1 * Yn1) + (a2 * Yn2);
+
+        *py = acc;
+
+        Xn2 = Xn1;
+        Xn1 = Xn;
+        Yn2 = Yn1;
+        Yn1 = acc;
+
+        px += sampleStep;
+        py += sampleStep;
+
+        sample--;
+      }
+
+      pState[ch] = Xn1;
+      pState[numCh + ch] = Xn2;
+      pState[(2u * numCh) + ch] = Yn1;
+      pState[(3u * numCh) + ch] = Yn2;
+    }
+
+    /* Move to the state of the next stage */
+    pState += 4u * numCh;
+
+    /*  The first stage goes from the input buffer to the output buffer. */
+    /*  Subsequent stages occur in-place in the output buffer */
+    pIn = pDst;
+
+    /* decrement the loop counter */
+    stage--;
+
+  } while(stage > 0u);
+}
+
+/**
+ * @} end of BiquadCascadeDF1Multi group
+ */
@@ -0,0 +1,86 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:        arm_biquad_cascade_df1_multi_init_q31.c
+*
+* Description:  Q31 multichannel Biquad cascade DirectFormI(DF1) filter initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadCascadeDF1Multi
+ * @{
+ */
+
+/**
+ * @details
+ *
+ * @param[in,out] *S           points to an instance of the Q31 multichannel Biquad cascade structure.
+ * @param[in]     numStages    number of 2nd order stages in the filter.
+ * @param[in]     numChannels  number of channels filtered by each call.
+ * @param[in]     layout       channel layout of the input and output buffers: ARM_MULTI_PLANAR or ARM_MULTI_INTERLEAVED.
+ * @param[in]     *pCoeffs     points to the filter coefficients, shared by all channels.
+ * @param[in]     *pState      points to the state buffer.
+ * @param[in]     postShift    Shift to be applied to the accumulator result. Varies according to the coefficients format.
+ * @return        none
+ *
+ * <b>Coefficient and State Ordering:</b>
+ *
+ * \par
+ * The coefficients are stored in the array <code>pCoeffs</code> in the following order:
+ * <pre>
+ *     {b10, b11, b12, a11, a12, b20, b21, b22, a21, a22, ...}
+ * </pre>
+ * The <code>pCoeffs</code> array contains a total of <code>5*numStages</code> values.
+ *
+ * \par
+ * The state variables are stored in the array <code>pState</code>.
+ * Each stage has the arrays <code>x[n-1]</code>, <code>x[n-2]</code>, <code>y[n-1]</code> and
+ * <code>y[n-2]</code> of <code>numChannels</code> values each, in that order.
+ * The arrays for stage 1 are first, then the arrays for stage 2, and so on.
+ * The state array has a total length of <code>4*numStages*numChannels</code> values.
+ */
+
+void arm_biquad_cascade_df1_multi_init_q31(
+  arm_biquad_casd_df1_multi_inst_q31 * S,
+  uint8_t numStages,
+  uint16_t numChannels,
+  arm_multi_layout layout,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  int8_t postShift)
+{
+  /* Assign filter stages */
+  S->numStages = numStages;
+
+  /* Assign the number of channels and their layout */
+  S->numChannels = numChannels;
+  S->layout = layout;
+
+  /* Assign postShift to be applied to the output */
+  S->postShift = postShift;
+
+  /* Assign coefficient pointer */
+  S->pCoeffs = pCoeffs;
+
+  /* Clear state buffer and size is always 4 * numStages * numChannels */
+  memset(pState, 0, (4u * (uint32_t) numStages * numChannels) * sizeof(q31_t));
+
+  /* Assign state pointer */
+  S->pState = pState;
+}
+
+/**
+ * @} end of BiquadCascadeDF1Multi group
+ */
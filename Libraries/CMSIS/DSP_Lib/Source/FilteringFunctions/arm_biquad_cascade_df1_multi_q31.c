@@ -0,0 +1,214 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_biquad_cascade_df1_multi_q31.c
+*
+* Description:	Processing function for the Q31 multichannel
+*               Biquad cascade DirectFormI(DF1) filter.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadCascadeDF1Multi
+ * @{
+ */
+
+/**
+ * @param[in]  *S         points to an instance of the Q31 multichannel Biquad cascade structure.
+ * @param[in]  *pSrc      points to the block of input data, blockSize samples of every channel.
+ * @param[out] *pDst      points to the block of output data, blockSize samples of every channel.
+ * @param[in]  blockSize  number of samples per channel to process per call.
+ * @return     none.
+ */
+
+void arm_biquad_cascade_df1_multi_q31(
+  const arm_biquad_casd_df1_multi_inst_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t *pIn = pSrc;                             /*  source pointer            */
+  q31_t *pState = S->pState;                     /*  pState pointer            */
+  q31_t *pCoeffs = S->pCoeffs;                   /*  coefficient pointer       */
+  q31_t *px, *py;                                /*  channel input and output pointers */
+  q31_t b0, b1, b2, a1, a2;                      /*  Filter coefficients       */
+  q31_t Xn, Xn1, Xn2, Yn1, Yn2;                  /*  State variables of the first channel of a pair  */
+  q31_t Xm, Xm1, Xm2, Ym1, Ym2;                  /*  State variables of the second channel of a pair */
+  q63_t acc, accm;                               /*  accumulators              */
+  int32_t shift = (31 - (int32_t) S->postShift); /*  Post shift                */
+  uint32_t numCh = S->numChannels;               /*  Number of channels        */
+  uint32_t sampleStep, chStep;                   /*  Distance between samples and between channels in pSrc/pDst */
+  uint32_t ch, sample, stage = S->numStages;     /*  loop counters             */
+
+  if(S->layout == ARM_MULTI_INTERLEAVED)
+  {
+    sampleStep = numCh;
+    chStep = 1u;
+  }
+  else
+  {
+    sampleStep = 1u;
+    chStep = blockSize;
+  }
+
+  do
+  {
+    /* Reading the coefficients */
+    b0 = *pCoeffs++;
+    b1 = *pCoeffs++;
+    b2 = *pCoeffs++;
+    a1 = *pCoeffs++;
+    a2 = *pCoeffs++;
+
+    /* pState holds x[n-1], x[n-2], y[n-1] and y[n-2] of this stage for all channels:
+     * state k of channel ch is pState[(k * numCh) + ch] */
+    ch = 0u;
+
+    /* Run 2 channels at a time; their recursions are independent */
+    while((numCh - ch) >= 2u)
+    {
+      Xn1 = pState[ch];
+      Xn2 = pState[numCh + ch];
+      Yn1 = pState[(2u * numCh) + ch];
+      Yn2 = pState[(3u * numCh) + ch];
+
+      Xm1 = pState[ch + 1u];
+      Xm2 = pState[numCh + ch + 1u];
+      Ym1 = pState[(2u * numCh) + ch + 1u];
+      Ym2 = pState[(3u * numCh) + ch + 1u];
+
+      px = pIn + (ch * chStep);
+      py = pDst + (ch * chStep);
+
+      sample = blockSize;
+
+      while(sample > 0u)
+      {
+        /* Read the inputs */
+        Xn = px[0];
+        Xm = px[chStep];
+
+        /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+        acc = (q63_t) b0 *Xn;
+        acc += (q63_t) b1 *Xn1;
+        acc += (q63_t) b2 *Xn2;
+        acc += (q63_t) a1 *Yn1;
+        acc += (q63_t) a2 *Yn2;
+
+        accm = (q63_t) b0 *Xm;
+        accm += (q63_t) b1 *Xm1;
+        accm += (q63_t) b2 *Xm2;
+        accm += (q63_t) a1 *Ym1;
+        accm += (q63_t) a2 *Ym2;
+
+        /* The result is converted to 1.31 */
+        acc = acc >> shift;
+        accm = accm >> shift;
+
+        /* Store the results in the destination buffer */
+        py[0] = (q31_t) acc;
+        py[chStep] = (q31_t) accm;
+
+        /* Update the state variables */
+        Xn2 = Xn1;
+        Xn1 = Xn;
+        Yn2 = Yn1;
+        Yn1 = (q31_t) acc;
+
+        Xm2 = Xm1;
+        Xm1 = Xm;
+        Ym2 = Ym1;
+        Ym1 = (q31_t) accm;
+
+        px += sampleStep;
+        py += sampleStep;
+
+        sample--;
+      }
+
+      /*  Store the updated state variables back into the pState array */
+      pState[ch] = Xn1;
+      pState[numCh + ch] = Xn2;
+      pState[(2u * numCh) + ch] = Yn1;
+      pState[(3u * numCh) + ch] = Yn2;
+
+      pState[ch + 1u] = Xm1;
+      pState[numCh + ch + 1u] = Xm2;
+      pState[(2u * numCh) + ch + 1u] = Ym1;
+      pState[(3u * numCh) + ch + 1u] = Ym2;
+
+      ch += 2u;
+    }
+
+    /* Run the last channel of an odd channel count */
+    if(ch < numCh)
+    {
+      Xn1 = pState[ch];
+      Xn2 = pState[numCh + ch];
+      Yn1 = pState[(2u * numCh) + ch];
+      Yn2 = pState[(3u * numCh) + ch];
+
+      px = pIn + (ch * chStep);
+      py = pDst + (ch * chStep);
+
+      sample = blockSize;
+
+      while(sample > 0u)
+      {
+        Xn = *px;
+
+        acc = (q63_t) b0 *Xn;
+        acc += (q63_t) b1 *Xn1;
+        acc += (q63_t) b2 *Xn2;
+        acc += (q63_t) a1 *Yn1;
+        acc += (q63_t) a2 *Yn2;
+
+        /* The result is converted to 1.31 */
+        acc = acc >> shift;
+
+        *py = (q31_t) acc;
+
+        Xn2 = Xn1;
+        Xn1 = Xn;
+        Yn2 = Yn1;
+        Yn1 = (q31_t) acc;
+
+        px += sampleStep;
+        py += sampleStep;
+
+        sample--;
+      }
+
+      pState[ch] = Xn1;
+      pState[numCh + ch] = Xn2;
+      pState[(2u * numCh) + ch] = Yn1;
+      pState[(3u * numCh) + ch] = Yn2;
+    }
+
+    /* Move to the state of the next stage */
+    pState += 4u * numCh;
+
+    /*  The first stage goes from the input buffer to the output buffer. */
+    /*  Subsequent stages occur in-place in the output buffer */
+    pIn = pDst;
+
+    /* decrement the loop counter */
+    stage--;
+
+  } while(stage > 0u);
+}
+
+/**
+ * @} end of BiquadCascadeDF1Multi group
+ */
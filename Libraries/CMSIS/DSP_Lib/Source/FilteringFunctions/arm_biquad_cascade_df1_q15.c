@@ -299,6 +299,10 @@ void arm_biquad_cascade_df1_q15(
   {
     /* Reading the coefficients */
     b0 = *pCoeffs++;
+
+    /* Skip the zero between b0 and b1 that the Cortex-M4 code uses for SIMD */
+    pCoeffs++;
+
     b1 = *pCoeffs++;
     b2 = *pCoeffs++;
     a1 = *pCoeffs++;
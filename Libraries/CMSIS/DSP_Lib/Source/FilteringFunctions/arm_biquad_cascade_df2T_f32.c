@@ -43,7 +43,8 @@
  * This set of functions implements arbitrary order recursive (IIR) filters using a transposed direct form II structure.   
  * The filters are implemented as a cascade of second order Biquad sections.   
  * These functions provide a slight memory savings as compared to the direct form I Biquad filter functions.  
- * Only floating-point data is supported.   
+ * The library supports floating-point, Q31 and Q15 data types, and a floating-point version that filters
+ * interleaved stereo data.
  *   
  * This function operate on blocks of input and output data and each call to the function   
  * processes <code>blockSize</code> samples through the filter.   
@@ -98,7 +99,8 @@
  * The advantage of the Direct Form I structure is that it is numerically more robust for fixed-point data types.   
  * That is why the Direct Form I structure supports Q15 and Q31 data types.   
  * The transposed Direct Form II structure, on the other hand, requires a wide dynamic range for the state variables <code>d1</code> and <code>d2</code>.   
- * Because of this, the CMSIS library only has a floating-point version of the Direct Form II Biquad.   
+ * The Q31 version keeps the state variables in the 1.31 format of the output, so the input must leave room for them.
+ * The Q15 version keeps them in the 2.30 format of the products, which gives them both the extra precision and the headroom.
  * The advantage of the Direct Form II Biquad is that it requires half the number of state variables, 2 rather than 4, per Biquad stage.   
  *   
  * \par Instance Structure   
@@ -123,6 +125,14 @@
  * </pre>   
  * where <code>numStages</code> is the number of Biquad stages in the filter; <code>pState</code> is the address of the state buffer.   
  * <code>pCoeffs</code> is the address of the coefficient buffer;    
+ *
+ * \par Fixed-Point and Stereo Versions
+ * The Q31 and Q15 coefficient arrays have the same layout as for the Direct Form I functions,
+ * so a filter designed for <code>arm_biquad_cascade_df1_q31()</code> or <code>arm_biquad_cascade_df1_q15()</code>
+ * can be run with the transposed structure as is, including <code>postShift</code>.
+ * <code>arm_biquad_cascade_stereo_df2T_f32()</code> filters the left and right channels of an interleaved
+ * stereo buffer with one set of coefficients.  Its state array holds <code>4*numStages</code> values,
+ * <code>{d1L, d2L, d1R, d2R}</code> for each stage.
  *   
  */
 
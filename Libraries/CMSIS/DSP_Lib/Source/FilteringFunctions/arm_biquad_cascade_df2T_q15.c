@@ -0,0 +1,190 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_biquad_cascade_df2T_q15.c
+*
+* Description:	Processing function for the Q15 transposed direct form II
+*               Biquad cascade filter.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadCascadeDF2T
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q15 transposed direct form II Biquad cascade filter.
+ * @param[in]  *S        points to an instance of the filter data structure.
+ * @param[in]  *pSrc     points to the block of input data.
+ * @param[out] *pDst     points to the block of output data
+ * @param[in]  blockSize number of samples to process.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * Coefficients and samples are in 1.15 format and multiplications yield a 2.30 result.
+ * The state variables <code>d1</code> and <code>d2</code> are kept in the 2.30 format of the
+ * products rather than in 1.15: they keep the 15 fractional bits that the output discards and
+ * have <code>postShift+1</code> bits of headroom above the output range.  <code>d1</code> and
+ * <code>d2</code> are computed with a 64-bit accumulator and saturated to 2.30.  For the output the
+ * accumulator is shifted by <code>postShift</code> bits, truncated to 1.15 by discarding the low
+ * 15 bits and saturated, as in <code>arm_biquad_cascade_df1_q15()</code>.
+ */
+
+void arm_biquad_cascade_df2T_q15(
+  const arm_biquad_cascade_df2T_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pIn = pSrc;                             /*  source pointer            */
+  q15_t *pOut = pDst;                            /*  destination pointer       */
+  q31_t *pState = S->pState;                     /*  State pointer             */
+  q15_t *pCoeffs = S->pCoeffs;                   /*  coefficient pointer       */
+  q63_t acc;                                     /*  accumulator               */
+  q15_t b0, b1, b2, a1, a2;                      /*  Filter coefficients       */
+  q15_t Xn, Yn;                                  /*  temporary input and output */
+  q31_t d1, d2;                                  /*  state variables, 2.30     */
+  int32_t shift = (15 - (int32_t) S->postShift); /*  Shift to be applied to the output */
+  uint32_t sample, stage = (uint32_t) S->numStages;      /*  loop counters             */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  q31_t coefB1A1, coefB2A2;                      /*  Packed coefficient pairs  */
+  q31_t inOut;                                   /*  Packed x[n] and y[n]      */
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  do
+  {
+    /* Reading the coefficients, the second value of a stage is a pad of 0 */
+    b0 = pCoeffs[0];
+    b1 = pCoeffs[2];
+    b2 = pCoeffs[3];
+    a1 = pCoeffs[4];
+    a2 = pCoeffs[5];
+    pCoeffs += 6u;
+
+    /* Reading the state values */
+    d1 = pState[0];
+    d2 = pState[1];
+
+#ifndef ARM_MATH_CM0
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Pair the coefficients that multiply x[n] and y[n] in the same sum,
+     ** so that each state update is one dual multiply-accumulate */
+    coefB1A1 = __PKHBT(b1, a1, 16);
+    coefB2A2 = __PKHBT(b2, a2, 16);
+
+    /* Apply loop unrolling and compute 2 output values at a time. */
+    sample = blockSize >> 1u;
+
+    while(sample > 0u)
+    {
+      /* Read the first input */
+      Xn = *pIn++;
+
+      /* y[n] = b0 * x[n] + d1 */
+      acc = ((q31_t) b0 * Xn) + (q63_t) d1;
+      Yn = (q15_t) __SSAT((acc >> shift), 16);
+      *pOut++ = Yn;
+
+      /* d1 = b1 * x[n] + a1 * y[n] + d2,  d2 = b2 * x[n] + a2 * y[n] */
+      inOut = __PKHBT(Xn, Yn, 16);
+      d1 = clip_q63_to_q31(__SMLALD(coefB1A1, inOut, (q63_t) d2));
+      d2 = clip_q63_to_q31(__SMLALD(coefB2A2, inOut, 0));
+
+      /* Read the second input */
+      Xn = *pIn++;
+
+      acc = ((q31_t) b0 * Xn) + (q63_t) d1;
+      Yn = (q15_t) __SSAT((acc >> shift), 16);
+      *pOut++ = Yn;
+
+      inOut = __PKHBT(Xn, Yn, 16);
+      d1 = clip_q63_to_q31(__SMLALD(coefB1A1, inOut, (q63_t) d2));
+      d2 = clip_q63_to_q31(__SMLALD(coefB2A2, inOut, 0));
+
+      /* decrement the loop counter */
+      sample--;
+    }
+
+    /* Compute the last output if the blockSize is odd */
+    if((blockSize & 0x1u) != 0u)
+    {
+      Xn = *pIn++;
+
+      acc = ((q31_t) b0 * Xn) + (q63_t) d1;
+      Yn = (q15_t) __SSAT((acc >> shift), 16);
+      *pOut++ = Yn;
+
+      inOut = __PKHBT(Xn, Yn, 16);
+      d1 = clip_q63_to_q31(__SMLALD(coefB1A1, inOut, (q63_t) d2));
+      d2 = clip_q63_to_q31(__SMLALD(coefB2A2, inOut, 0));
+    }
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    sample = blockSize;
+
+    while(sample > 0u)
+    {
+      /* Read the input */
+      Xn = *pIn++;
+
+      /* y[n] = b0 * x[n] + d1 */
+      acc = ((q31_t) b0 * Xn) + (q63_t) d1;
+      Yn = (q15_t) __SSAT((acc >> shift), 16);
+      *pOut++ = Yn;
+
+      /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+      acc = (q63_t) ((q31_t) b1 * Xn) + ((q31_t) a1 * Yn) + d2;
+      d1 = clip_q63_to_q31(acc);
+
+      /* d2 = b2 * x[n] + a2 * y[n] */
+      acc = (q63_t) ((q31_t) b2 * Xn) + ((q31_t) a2 * Yn);
+      d2 = clip_q63_to_q31(acc);
+
+      /* decrement the loop counter */
+      sample--;
+    }
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+    /* Store the updated state variables back into the state array */
+    *pState++ = d1;
+    *pState++ = d2;
+
+    /* The current stage input is given as the output to the next stage */
+    pIn = pDst;
+
+    /* Reset the output working pointer */
+    pOut = pDst;
+
+    /* decrement the loop counter */
+    stage--;
+
+  } while(stage > 0u);
+}
+
+/**
+ * @} end of BiquadCascadeDF2T group
+ */
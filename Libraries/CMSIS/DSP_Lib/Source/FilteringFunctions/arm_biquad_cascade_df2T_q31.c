@@ -0,0 +1,199 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_biquad_cascade_df2T_q31.c
+*
+* Description:	Processing function for the Q31 transposed direct form II
+*               Biquad cascade filter.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadCascadeDF2T
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q31 transposed direct form II Biquad cascade filter.
+ * @param[in]  *S        points to an instance of the filter data structure.
+ * @param[in]  *pSrc     points to the block of input data.
+ * @param[out] *pDst     points to the block of output data
+ * @param[in]  blockSize number of samples to process.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function uses a 64-bit accumulator in 2.62 format for each of the three sums
+ * <code>y[n]</code>, <code>d1</code> and <code>d2</code>.  The state variables are added to the
+ * accumulator shifted up by <code>31-postShift</code> bits, so that they line up with the products.
+ * Each sum is shifted by <code>postShift</code> bits and truncated to 1.31 format, like the output of
+ * <code>arm_biquad_cascade_df1_q31()</code>.  The state variables thus have the same format as the
+ * output and wrap around on overflow, and so does the output.  The state variables of a transposed
+ * Direct Form II section can be larger than its output; the input must be scaled down far enough
+ * that they fit.
+ */
+
+void arm_biquad_cascade_df2T_q31(
+  const arm_biquad_cascade_df2T_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t *pIn = pSrc;                             /*  source pointer            */
+  q31_t *pOut = pDst;                            /*  destination pointer       */
+  q31_t *pState = S->pState;                     /*  State pointer             */
+  q31_t *pCoeffs = S->pCoeffs;                   /*  coefficient pointer       */
+  q63_t acc;                                     /*  accumulator               */
+  q31_t b0, b1, b2, a1, a2;                      /*  Filter coefficients       */
+  q31_t Xn, Yn;                                  /*  temporary input and output */
+  q31_t d1, d2;                                  /*  state variables           */
+  uint32_t shift = 31u - (uint32_t) S->postShift;        /*  Shift to be applied to the output */
+  uint32_t sample, stage = S->numStages;         /*  loop counters             */
+
+  do
+  {
+    /* Reading the coefficients */
+    b0 = *pCoeffs++;
+    b1 = *pCoeffs++;
+    b2 = *pCoeffs++;
+    a1 = *pCoeffs++;
+    a2 = *pCoeffs++;
+
+    /* Reading the state values */
+    d1 = pState[0];
+    d2 = pState[1];
+
+#ifndef ARM_MATH_CM0
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Apply loop unrolling and compute 4 output values simultaneously. */
+    sample = blockSize >> 2u;
+
+    /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+     ** a second loop below computes the remaining 1 to 3 samples. */
+    while(sample > 0u)
+    {
+      /* Read the first input */
+      Xn = *pIn++;
+
+      /* y[n] = b0 * x[n] + d1 */
+      acc = ((q63_t) b0 * Xn) + ((q63_t) d1 * ((q63_t) 1 << shift));
+      Yn = (q31_t) (acc >> shift);
+      *pOut++ = Yn;
+
+      /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+      acc = ((q63_t) b1 * Xn) + ((q63_t) a1 * Yn) + ((q63_t) d2 * ((q63_t) 1 << shift));
+      d1 = (q31_t) (acc >> shift);
+
+      /* d2 = b2 * x[n] + a2 * y[n] */
+      acc = ((q63_t) b2 * Xn) + ((q63_t) a2 * Yn);
+      d2 = (q31_t) (acc >> shift);
+
+      /* Read the second input */
+      Xn = *pIn++;
+
+      acc = ((q63_t) b0 * Xn) + ((q63_t) d1 * ((q63_t) 1 << shift));
+      Yn = (q31_t) (acc >> shift);
+      *pOut++ = Yn;
+
+      acc = ((q63_t) b1 * Xn) + ((q63_t) a1 * Yn) + ((q63_t) d2 * ((q63_t) 1 << shift));
+      d1 = (q31_t) (acc >> shift);
+
+      acc = ((q63_t) b2 * Xn) + ((q63_t) a2 * Yn);
+      d2 = (q31_t) (acc >> shift);
+
+      /* Read the third input */
+      Xn = *pIn++;
+
+      acc = ((q63_t) b0 * Xn) + ((q63_t) d1 * ((q63_t) 1 << shift));
+      Yn = (q31_t) (acc >> shift);
+      *pOut++ = Yn;
+
+      acc = ((q63_t) b1 * Xn) + ((q63_t) a1 * Yn) + ((q63_t) d2 * ((q63_t) 1 << shift));
+      d1 = (q31_t) (acc >> shift);
+
+      acc = ((q63_t) b2 * Xn) + ((q63_t) a2 * Yn);
+      d2 = (q31_t) (acc >> shift);
+
+      /* Read the fourth input */
+      Xn = *pIn++;
+
+      acc = ((q63_t) b0 * Xn) + ((q63_t) d1 * ((q63_t) 1 << shift));
+      Yn = (q31_t) (acc >> shift);
+      *pOut++ = Yn;
+
+      acc = ((q63_t) b1 * Xn) + ((q63_t) a1 * Yn) + ((q63_t) d2 * ((q63_t) 1 << shift));
+      d1 = (q31_t) (acc >> shift);
+
+      acc = ((q63_t) b2 * Xn) + ((q63_t) a2 * Yn);
+      d2 = (q31_t) (acc >> shift);
+
+      /* decrement the loop counter */
+      sample--;
+    }
+
+    /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+     ** No loop unrolling is used. */
+    sample = blockSize & 0x3u;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    sample = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+    while(sample > 0u)
+    {
+      /* Read the input */
+      Xn = *pIn++;
+
+      /* y[n] = b0 * x[n] + d1 */
+      acc = ((q63_t) b0 * Xn) + ((q63_t) d1 * ((q63_t) 1 << shift));
+      Yn = (q31_t) (acc >> shift);
+      *pOut++ = Yn;
+
+      /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+      acc = ((q63_t) b1 * Xn) + ((q63_t) a1 * Yn) + ((q63_t) d2 * ((q63_t) 1 << shift));
+      d1 = (q31_t) (acc >> shift);
+
+      /* d2 = b2 * x[n] + a2 * y[n] */
+      acc = ((q63_t) b2 * Xn) + ((q63_t) a2 * Yn);
+      d2 = (q31_t) (acc >> shift);
+
+      /* decrement the loop counter */
+      sample--;
+    }
+
+    /* Store the updated state variables back into the state array */
+    *pState++ = d1;
+    *pState++ = d2;
+
+    /* The current stage input is given as the output to the next stage */
+    pIn = pDst;
+
+    /* Reset the output working pointer */
+    pOut = pDst;
+
+    /* decrement the loop counter */
+    stage--;
+
+  } while(stage > 0u);
+}
+
+/**
+ * @} end of BiquadCascadeDF2T group
+ */
@@ -0,0 +1,111 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_conv_fft_core_f32.c
+*
+* Description:	Segmented FFT convolution core of the floating-point FFT convolution and correlation.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @brief  Core of the floating-point FFT convolution and correlation.
+ * @param[in]      *pSrcA points to the first input sequence.
+ * @param[in]      srcALen length of the first input sequence.
+ * @param[in]      *pSrcB points to the second input sequence.
+ * @param[in]      srcBLen length of the second input sequence.
+ * @param[in,out]  *pDst points to the srcALen+srcBLen-1 outputs the convolution is added to.
+ * @param[in]      *pScratch points to a scratch buffer of 4*fftLen+4 values.
+ * @param[in]      fftLen real FFT length, 128, 512 or 2048.
+ * @param[in]      reverseB set to convolve with the second sequence reversed in time, for the correlation.
+ * @return none.
+ *
+ * The second sequence is cut into segments of at most fftLen/2 samples, and the first one
+ * into segments that fill the rest of the FFT, so the linear convolution of two segments fits
+ * in one FFT without wrapping around.  The spectrum of each segment of the second sequence is
+ * computed once and multiplied with the spectra of all the segments of the first one.  The
+ * products are transformed back and added into the output at the sum of the two segment
+ * offsets.  Only the bins 0 to fftLen/2 of the spectra are kept, as the inverse real FFT
+ * does not read the others.
+ */
+
+void arm_conv_fft_core_f32(
+  float32_t * pSrcA,
+  uint32_t srcALen,
+  float32_t * pSrcB,
+  uint32_t srcBLen,
+  float32_t * pDst,
+  float32_t * pScratch,
+  uint16_t fftLen,
+  uint8_t reverseB)
+{
+  arm_rfft_instance_f32 rfft, rifft;             /* Forward and inverse real FFT instances */
+  arm_cfft_radix4_instance_f32 cfft, cifft;      /* Complex FFT instances of the real FFTs */
+  float32_t *pSpecB = pScratch;                  /* Spectrum of the current segment of B */
+  float32_t *pSpec = pSpecB + fftLen + 2u;       /* Spectrum of a segment of A, and the product */
+  float32_t *pTime = pSpec + (2u * fftLen);      /* Segment in time, fftLen + 2 values */
+  float32_t *pIn;                                /* Input pointer */
+  float32_t *pOut;                               /* Pointer to a reversed segment */
+  uint32_t segLenA, segLenB;                     /* Segment lengths */
+  uint32_t i, j;                                 /* Segment offsets in A and B */
+  uint32_t lenA, lenB;                           /* Lengths of the current segments */
+  uint32_t k;                                    /* loop counter */
+
+  arm_rfft_init_f32(&rfft, &cfft, fftLen, 0u, 1u);
+  arm_rfft_init_f32(&rifft, &cifft, fftLen, 1u, 1u);
+
+  segLenB = (srcBLen < ((uint32_t) fftLen >> 1u)) ? srcBLen : ((uint32_t) fftLen >> 1u);
+  segLenA = ((uint32_t) fftLen + 1u) - segLenB;
+
+  for (j = 0u; j < srcBLen; j += segLenB)
+  {
+    lenB = ((srcBLen - j) < segLenB) ? (srcBLen - j) : segLenB;
+
+    /* Segment of B, zero padded to the FFT length */
+    if(reverseB != 0u)
+    {
+      /* The segment j of the reversed sequence ends at sample srcBLen - 1 - j of B */
+      pIn = pSrcB + (srcBLen - j - lenB);
+      pOut = pTime + lenB;
+
+      for (k = 0u; k < lenB; k++)
+      {
+        *--pOut = *pIn++;
+      }
+    }
+    else
+    {
+      arm_copy_f32(pSrcB + j, pTime, lenB);
+    }
+
+    arm_fill_f32(0.0f, pTime + lenB, fftLen - lenB);
+
+    /* The real FFT writes fftLen complex values, of which the first fftLen/2 + 1 are kept */
+    arm_rfft_f32(&rfft, pTime, pSpec);
+    arm_copy_f32(pSpec, pSpecB, fftLen + 2u);
+
+    for (i = 0u; i < srcALen; i += segLenA)
+    {
+      lenA = ((srcALen - i) < segLenA) ? (srcALen - i) : segLenA;
+
+      arm_copy_f32(pSrcA + i, pTime, lenA);
+      arm_fill_f32(0.0f, pTime + lenA, fftLen - lenA);
+
+      arm_rfft_f32(&rfft, pTime, pSpec);
+
+      /* Product of the spectra, in place, and back to the time domain */
+      arm_cmplx_mult_cmplx_f32(pSpec, pSpecB, pSpec, ((uint32_t) fftLen >> 1u) + 1u);
+      arm_rfft_f32(&rifft, pSpec, pTime);
+
+      /* Overlap-add of the lenA + lenB - 1 samples of the segment convolution */
+      pOut = pDst + (i + j);
+      arm_add_f32(pOut, pTime, pOut, (lenA + lenB) - 1u);
+    }
+  }
+}
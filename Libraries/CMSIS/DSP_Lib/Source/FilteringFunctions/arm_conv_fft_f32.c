@@ -0,0 +1,82 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_conv_fft_f32.c
+*
+* Description:	Convolution of floating-point sequences with the direct or the FFT algorithm.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Conv
+ * @{
+ */
+
+/**
+ * @brief Convolution of floating-point sequences with the direct or the FFT algorithm.
+ * @param[in]  *pSrcA points to the first input sequence.
+ * @param[in]  srcALen length of the first input sequence.
+ * @param[in]  *pSrcB points to the second input sequence.
+ * @param[in]  srcBLen length of the second input sequence.
+ * @param[out] *pDst points to the location where the output result is written.  Length srcALen+srcBLen-1.
+ * @param[in]  *pScratch points to a scratch buffer of 4*fftLen+4 values, where fftLen is returned by arm_conv_fft_len_f32().
+ * @return none.
+ *
+ * \par
+ * The function computes the same convolution as arm_conv_f32().  The cost of the direct
+ * algorithm grows with <code>srcALen * srcBLen</code>, and the cost of a convolution through
+ * the FFT with about <code>(srcALen + srcBLen) * log2(fftLen)</code>.
+ * arm_conv_fft_len_f32() compares the two for the given lengths.  If it returns 0, the function
+ * calls arm_conv_f32() and the scratch buffer is not used.  Otherwise the convolution runs
+ * through real FFTs of that length, with the shorter sequence cut into segments whose spectra
+ * are computed once.  The scratch buffer then holds at most 8196 values, for an FFT length of 2048.
+ *
+ * \par
+ * The FFT algorithm rounds differently from the direct one.  Each output has an error of a
+ * few units of the floating-point precision, relative to the largest output.
+ */
+
+void arm_conv_fft_f32(
+  float32_t * pSrcA,
+  uint32_t srcALen,
+  float32_t * pSrcB,
+  uint32_t srcBLen,
+  float32_t * pDst,
+  float32_t * pScratch)
+{
+  uint16_t fftLen = arm_conv_fft_len_f32(srcALen, srcBLen);
+
+  if(fftLen == 0u)
+  {
+    arm_conv_f32(pSrcA, srcALen, pSrcB, srcBLen, pDst);
+    return;
+  }
+
+  /* The segments of the output are accumulated */
+  arm_fill_f32(0.0f, pDst, (srcALen + srcBLen) - 1u);
+
+  /* The convolution is commutative, and the spectra of the shorter sequence are kept */
+  if(srcALen >= srcBLen)
+  {
+    arm_conv_fft_core_f32(pSrcA, srcALen, pSrcB, srcBLen, pDst, pScratch, fftLen, 0u);
+  }
+  else
+  {
+    arm_conv_fft_core_f32(pSrcB, srcBLen, pSrcA, srcALen, pDst, pScratch, fftLen, 0u);
+  }
+}
+
+/**
+ * @} end of Conv group
+ */
@@ -0,0 +1,97 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_conv_fft_len_f32.c
+*
+* Description:	Algorithm selection of the floating-point FFT convolution and correlation.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Conv
+ * @{
+ */
+
+/**
+ * @brief  FFT length the floating-point FFT convolution and correlation use for the given lengths.
+ * @param[in]  srcALen length of the first input sequence.
+ * @param[in]  srcBLen length of the second input sequence.
+ * @return The function returns the real FFT length, 128, 512 or 2048, or 0 when the direct
+ * algorithm is cheaper.
+ *
+ * \par
+ * The cost model counts the work of both algorithms in multiply-accumulates.  The direct
+ * algorithm needs <code>srcALen * srcBLen</code> of them.  The FFT algorithm of length
+ * <code>N</code> cuts the shorter sequence into <code>nS</code> segments of at most
+ * <code>N/2</code> samples, and the longer one into <code>nL</code> segments that fill the
+ * rest of the FFT.  It runs <code>nS + 2 * nS * nL</code> real FFTs of about
+ * <code>2.5 * N * log2(N)</code> each.  It also needs a spectrum product and
+ * an overlap-add for each pair of segments.  The length with the lowest cost is compared with
+ * the direct algorithm.
+ *
+ * \par
+ * The function also sizes the scratch buffer of arm_conv_fft_f32() and arm_correlate_fft_f32(),
+ * which holds <code>4 * N + 4</code> values.  No scratch is used when it returns 0.
+ */
+
+uint16_t arm_conv_fft_len_f32(
+  uint32_t srcALen,
+  uint32_t srcBLen)
+{
+  uint64_t cost, minCost;                        /* Costs in multiply-accumulates */
+  uint64_t pairs;                                /* Number of pairs of segments */
+  uint32_t shortLen, longLen;                    /* Lengths of the shorter and the longer sequence */
+  uint32_t segShort, segLong;                    /* Segment lengths */
+  uint32_t nShort, nLong;                        /* Numbers of segments */
+  uint32_t fftLen, log2Len;                      /* FFT length and its base 2 logarithm */
+  uint16_t bestLen = 0u;                         /* FFT length of the lowest cost */
+
+  if((srcALen == 0u) || (srcBLen == 0u))
+  {
+    return (0u);
+  }
+
+  /* The direct algorithm is the reference */
+  minCost = (uint64_t) srcALen * srcBLen;
+
+  shortLen = (srcALen < srcBLen) ? srcALen : srcBLen;
+  longLen = (srcALen < srcBLen) ? srcBLen : srcALen;
+
+  /* Real FFT lengths 128, 512 and 2048 */
+  for (fftLen = 128u, log2Len = 7u; fftLen <= 2048u; fftLen <<= 2u, log2Len += 2u)
+  {
+    /* Segments of the shorter sequence of at most half the FFT length, and segments of the
+     * longer one that fill the rest of it */
+    segShort = (shortLen < (fftLen >> 1u)) ? shortLen : (fftLen >> 1u);
+    segLong = (fftLen + 1u) - segShort;
+    nShort = (shortLen + segShort - 1u) / segShort;
+    nLong = (longLen + segLong - 1u) / segLong;
+
+    pairs = (uint64_t) nShort * nLong;
+    cost = ((nShort + (2u * pairs)) * ((5u * fftLen * log2Len) >> 1u)) +
+      (pairs * ((4u * ((fftLen >> 1u) + 1u)) + (2u * fftLen)));
+
+    if(cost < minCost)
+    {
+      minCost = cost;
+      bestLen = (uint16_t) fftLen;
+    }
+  }
+
+  return (bestLen);
+}
+
+/**
+ * @} end of Conv group
+ */
@@ -0,0 +1,102 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_conv_fft_len_q15.c
+*
+* Description:	Algorithm selection of the Q15 FFT convolution and correlation.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/* Weight of a Q15 multiply-accumulate against a floating-point one, as a right shift */
+#if (defined (__FPU_USED) && (__FPU_USED == 1)) || defined (ARM_MATH_HOST)
+#define ARM_CONV_FFT_Q15_SHIFT  1u
+#else
+#define ARM_CONV_FFT_Q15_SHIFT  5u
+#endif
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Conv
+ * @{
+ */
+
+/**
+ * @brief  FFT length the Q15 FFT convolution and correlation use for the given lengths.
+ * @param[in]  srcALen length of the first input sequence.
+ * @param[in]  srcBLen length of the second input sequence.
+ * @return The function returns the real FFT length, 128, 512 or 2048, or 0 when the direct
+ * algorithm is cheaper.
+ *
+ * \par
+ * The cost model is the one of arm_conv_fft_len_f32(), with the Q15 multiply-accumulates of
+ * the direct algorithm weighted against the floating-point operations of the FFT algorithm.
+ * On a Cortex-M4 with an FPU two Q15 multiply-accumulates take about the time of one
+ * floating-point one.  Without an FPU the floating-point operations are emulated, and a Q15
+ * multiply-accumulate counts as 1/32 of one.
+ *
+ * \par
+ * The function also sizes the scratch buffer of arm_conv_fft_q15() and arm_correlate_fft_q15(),
+ * which holds <code>4 * N + 4 + srcALen + srcBLen - 1</code> floating-point values.  No
+ * scratch is used when it returns 0.
+ */
+
+uint16_t arm_conv_fft_len_q15(
+  uint32_t srcALen,
+  uint32_t srcBLen)
+{
+  uint64_t cost, minCost;                        /* Costs in multiply-accumulates */
+  uint64_t pairs;                                /* Number of pairs of segments */
+  uint32_t shortLen, longLen;                    /* Lengths of the shorter and the longer sequence */
+  uint32_t segShort, segLong;                    /* Segment lengths */
+  uint32_t nShort, nLong;                        /* Numbers of segments */
+  uint32_t fftLen, log2Len;                      /* FFT length and its base 2 logarithm */
+  uint16_t bestLen = 0u;                         /* FFT length of the lowest cost */
+
+  if((srcALen == 0u) || (srcBLen == 0u))
+  {
+    return (0u);
+  }
+
+  /* The direct algorithm is the reference, in floating-point units */
+  minCost = ((uint64_t) srcALen * srcBLen) >> ARM_CONV_FFT_Q15_SHIFT;
+
+  shortLen = (srcALen < srcBLen) ? srcALen : srcBLen;
+  longLen = (srcALen < srcBLen) ? srcBLen : srcALen;
+
+  /* Real FFT lengths 128, 512 and 2048 */
+  for (fftLen = 128u, log2Len = 7u; fftLen <= 2048u; fftLen <<= 2u, log2Len += 2u)
+  {
+    /* Segments of the shorter sequence of at most half the FFT length, and segments of the
+     * longer one that fill the rest of it */
+    segShort = (shortLen < (fftLen >> 1u)) ? shortLen : (fftLen >> 1u);
+    segLong = (fftLen + 1u) - segShort;
+    nShort = (shortLen + segShort - 1u) / segShort;
+    nLong = (longLen + segLong - 1u) / segLong;
+
+    pairs = (uint64_t) nShort * nLong;
+    cost = ((nShort + (2u * pairs)) * ((5u * fftLen * log2Len) >> 1u)) +
+      (pairs * ((4u * ((fftLen >> 1u) + 1u)) + (2u * fftLen))) + srcALen + srcBLen;
+
+    if(cost < minCost)
+    {
+      minCost = cost;
+      bestLen = (uint16_t) fftLen;
+    }
+  }
+
+  return (bestLen);
+}
+
+/**
+ * @} end of Conv group
+ */
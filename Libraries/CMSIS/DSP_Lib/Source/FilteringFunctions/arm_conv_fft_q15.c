@@ -0,0 +1,85 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_conv_fft_q15.c
+*
+* Description:	Convolution of Q15 sequences with the direct or the FFT algorithm.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Conv
+ * @{
+ */
+
+/**
+ * @brief Convolution of Q15 sequences with the direct or the FFT algorithm.
+ * @param[in]  *pSrcA points to the first input sequence.
+ * @param[in]  srcALen length of the first input sequence.
+ * @param[in]  *pSrcB points to the second input sequence.
+ * @param[in]  srcBLen length of the second input sequence.
+ * @param[out] *pDst points to the location where the output result is written.  Length srcALen+srcBLen-1.
+ * @param[in]  *pScratch points to a scratch buffer of 4*fftLen+4+srcALen+srcBLen-1 values, where fftLen is returned by arm_conv_fft_len_q15().
+ * @return none.
+ *
+ * \par
+ * The function computes the same convolution as arm_conv_q15(), and selects the algorithm
+ * with arm_conv_fft_len_q15().  If it returns 0, the function calls arm_conv_q15() and the
+ * scratch buffer is not used.
+ *
+ * \par
+ * The FFT algorithm converts the inputs to floating-point segment by segment, and accumulates
+ * the convolution in floating-point in the scratch buffer.  The outputs are then converted to
+ * 1.15 format the way arm_conv_q15() does it: truncated and saturated.  The floating-point
+ * arithmetic has a 24-bit mantissa, so an output can differ from the direct result by one
+ * LSB when the exact sum lies close to a multiple of <code>2^-15</code>.
+ */
+
+void arm_conv_fft_q15(
+  q15_t * pSrcA,
+  uint32_t srcALen,
+  q15_t * pSrcB,
+  uint32_t srcBLen,
+  q15_t * pDst,
+  float32_t * pScratch)
+{
+  uint16_t fftLen = arm_conv_fft_len_q15(srcALen, srcBLen);
+  float32_t *pAcc;                               /* Floating-point outputs */
+
+  if(fftLen == 0u)
+  {
+    arm_conv_q15(pSrcA, srcALen, pSrcB, srcBLen, pDst);
+    return;
+  }
+
+  /* The floating-point outputs follow the work area of the core */
+  pAcc = pScratch + ((4u * (uint32_t) fftLen) + 4u);
+  arm_fill_f32(0.0f, pAcc, (srcALen + srcBLen) - 1u);
+
+  /* The convolution is commutative, and the spectra of the shorter sequence are kept */
+  if(srcALen >= srcBLen)
+  {
+    arm_conv_fft_core_q15(pSrcA, srcALen, pSrcB, srcBLen, pAcc, pScratch, fftLen, 0u);
+  }
+  else
+  {
+    arm_conv_fft_core_q15(pSrcB, srcBLen, pSrcA, srcALen, pAcc, pScratch, fftLen, 0u);
+  }
+
+  arm_conv_fft_to_q15(pAcc, pDst, (srcALen + srcBLen) - 1u);
+}
+
+/**
+ * @} end of Conv group
+ */
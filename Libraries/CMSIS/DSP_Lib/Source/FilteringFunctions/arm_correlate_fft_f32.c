@@ -0,0 +1,80 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_correlate_fft_f32.c
+*
+* Description:	Correlation of floating-point sequences with the direct or the FFT algorithm.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Corr
+ * @{
+ */
+
+/**
+ * @brief Correlation of floating-point sequences with the direct or the FFT algorithm.
+ * @param[in]  *pSrcA points to the first input sequence.
+ * @param[in]  srcALen length of the first input sequence.
+ * @param[in]  *pSrcB points to the second input sequence.
+ * @param[in]  srcBLen length of the second input sequence.
+ * @param[out] *pDst points to the location where the output result is written.  Length 2 * max(srcALen, srcBLen) - 1.
+ * @param[in]  *pScratch points to a scratch buffer of 4*fftLen+4 values, where fftLen is returned by arm_conv_fft_len_f32().
+ * @return none.
+ *
+ * \par
+ * The function computes the same correlation as arm_correlate_f32(), as the convolution of
+ * the first sequence with the second one reversed in time.  The algorithm is selected by
+ * arm_conv_fft_len_f32(), and the scratch buffer is only used by the FFT algorithm.  For
+ * example, the correlation of two blocks of 4096 samples runs through FFTs of 2048 points
+ * with about 1/8 of the multiply-accumulates of the direct algorithm.
+ *
+ * \par
+ * Unlike arm_correlate_f32(), the function writes all the outputs, including the zeros the
+ * shorter sequence leads to, so <code>pDst</code> need not be cleared.
+ */
+
+void arm_correlate_fft_f32(
+  float32_t * pSrcA,
+  uint32_t srcALen,
+  float32_t * pSrcB,
+  uint32_t srcBLen,
+  float32_t * pDst,
+  float32_t * pScratch)
+{
+  uint16_t fftLen = arm_conv_fft_len_f32(srcALen, srcBLen);
+  uint32_t outLen;                               /* Number of outputs */
+
+  outLen = (2u * ((srcALen > srcBLen) ? srcALen : srcBLen)) - 1u;
+  arm_fill_f32(0.0f, pDst, outLen);
+
+  if(fftLen == 0u)
+  {
+    arm_correlate_f32(pSrcA, srcALen, pSrcB, srcBLen, pDst);
+    return;
+  }
+
+  /* The correlation starts after srcALen - srcBLen zeros when the first sequence is the
+   * longer one, and ends with srcBLen - srcALen zeros otherwise */
+  if(srcALen > srcBLen)
+  {
+    pDst += srcALen - srcBLen;
+  }
+
+  arm_conv_fft_core_f32(pSrcA, srcALen, pSrcB, srcBLen, pDst, pScratch, fftLen, 1u);
+}
+
+/**
+ * @} end of Corr group
+ */
@@ -0,0 +1,86 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_correlate_fft_q15.c
+*
+* Description:	Correlation of Q15 sequences with the direct or the FFT algorithm.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Corr
+ * @{
+ */
+
+/**
+ * @brief Correlation of Q15 sequences with the direct or the FFT algorithm.
+ * @param[in]  *pSrcA points to the first input sequence.
+ * @param[in]  srcALen length of the first input sequence.
+ * @param[in]  *pSrcB points to the second input sequence.
+ * @param[in]  srcBLen length of the second input sequence.
+ * @param[out] *pDst points to the location where the output result is written.  Length 2 * max(srcALen, srcBLen) - 1.
+ * @param[in]  *pScratch points to a scratch buffer of 4*fftLen+4+srcALen+srcBLen-1 values, where fftLen is returned by arm_conv_fft_len_q15().
+ * @return none.
+ *
+ * \par
+ * The function computes the same correlation as arm_correlate_q15(), as the convolution of
+ * the first sequence with the second one reversed in time.  The algorithm is selected by
+ * arm_conv_fft_len_q15(), and the scratch buffer is only used by the FFT algorithm.  The
+ * FFT algorithm computes in floating-point and converts the outputs as arm_conv_fft_q15()
+ * does, so an output can differ from the direct result by one LSB.
+ *
+ * \par
+ * Unlike arm_correlate_q15(), the function writes all the outputs, including the zeros the
+ * shorter sequence leads to, so <code>pDst</code> need not be cleared.
+ */
+
+void arm_correlate_fft_q15(
+  q15_t * pSrcA,
+  uint32_t srcALen,
+  q15_t * pSrcB,
+  uint32_t srcBLen,
+  q15_t * pDst,
+  float32_t * pScratch)
+{
+  uint16_t fftLen = arm_conv_fft_len_q15(srcALen, srcBLen);
+  float32_t *pAcc;                               /* Floating-point outputs */
+  uint32_t outLen;                               /* Number of outputs */
+
+  outLen = (2u * ((srcALen > srcBLen) ? srcALen : srcBLen)) - 1u;
+  arm_fill_q15(0, pDst, outLen);
+
+  if(fftLen == 0u)
+  {
+    arm_correlate_q15(pSrcA, srcALen, pSrcB, srcBLen, pDst);
+    return;
+  }
+
+  /* The correlation starts after srcALen - srcBLen zeros when the first sequence is the
+   * longer one, and ends with srcBLen - srcALen zeros otherwise */
+  if(srcALen > srcBLen)
+  {
+    pDst += srcALen - srcBLen;
+  }
+
+  /* The floating-point outputs follow the work area of the core */
+  pAcc = pScratch + ((4u * (uint32_t) fftLen) + 4u);
+  arm_fill_f32(0.0f, pAcc, (srcALen + srcBLen) - 1u);
+
+  arm_conv_fft_core_q15(pSrcA, srcALen, pSrcB, srcBLen, pAcc, pScratch, fftLen, 1u);
+  arm_conv_fft_to_q15(pAcc, pDst, (srcALen + srcBLen) - 1u);
+}
+
+/**
+ * @} end of Corr group
+ */
@@ -0,0 +1,314 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_circ_f32.c
+*
+* Description:	Floating-point FIR filter with a circular state buffer.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup FIRCirc Circular State FIR Filters
+ *
+ * These functions compute the same outputs as the FIR filters (\ref FIR) with the
+ * same coefficients, but keep the delay line in a circular buffer instead of a
+ * linear one.  The linear FIR functions copy the last <code>numTaps-1</code> samples
+ * to the start of the state buffer at the end of every call, which for short blocks
+ * and long filters costs about as much as the filtering itself; these functions do
+ * not.  The state buffer also no longer depends on the block size.
+ *
+ * \par Algorithm
+ * The delay line has <code>delayLen</code> entries, a power of 2 not smaller than
+ * <code>numTaps</code>, and is stored twice: <code>pState[i]</code> and
+ * <code>pState[i+delayLen]</code> hold the same sample.  Because of the mirror the
+ * <code>numTaps</code> samples that make up one output are always contiguous,
+ * ending at <code>pState[stateIndex+delayLen]</code>, so the inner loops are the
+ * ones of the linear FIR.  A block is processed in segments that end where the
+ * write index wraps around: the new samples of a segment are written to the upper
+ * copy, the outputs of the segment are computed, and then the new samples are
+ * mirrored into the lower copy.  The only copy is that of the input samples, once.
+ *
+ * \par
+ * The coefficients are stored in time reversed order, as for the FIR filters:
+ * <pre>
+ *    {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}
+ * </pre>
+ *
+ * \par Instance Structure
+ * The coefficients, the state and the write index are stored in an instance data
+ * structure.  A separate instance structure must be defined for each filter, and
+ * the state must only be used through these functions.
+ *
+ * \par Initialization Functions
+ * The initialization function checks <code>delayLen</code>, clears the state buffer of
+ * <code>2*delayLen</code> samples and sets the write index to zero.
+ *
+ * \par Fixed-Point Behavior
+ * The Q15 and Q31 versions use the arithmetic of <code>arm_fir_q15()</code> and
+ * <code>arm_fir_q31()</code> and give the same outputs.  Unlike <code>arm_fir_q15()</code>
+ * any number of taps is supported.
+ */
+
+/**
+ * @addtogroup FIRCirc
+ * @{
+ */
+
+/**
+ * @param[in,out] *S points to an instance of the floating-point circular state FIR structure.
+ * @param[in]     *pSrc points to the block of input data.
+ * @param[out]    *pDst points to the block of output data.
+ * @param[in]     blockSize number of samples to process per call.
+ * @return        none.
+ */
+
+void arm_fir_circ_f32(
+  arm_fir_circ_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  float32_t *pStateCurnt;                        /* Points to the current sample of the state */
+  float32_t *pWin;                               /* Points to the oldest sample of the current output */
+  float32_t *px, *pb;                            /* Temporary pointers for state and coefficient buffers */
+  uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+  uint32_t delayLen = S->delayLen;               /* Length of one copy of the delay line */
+  uint32_t index = S->stateIndex;                /* Write index into the delay line */
+  uint32_t segCnt, i, tapCnt, blkCnt;            /* Loop counters */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  float32_t acc0, acc1, acc2, acc3;              /* Accumulators */
+  float32_t x0, x1, x2, x3, c0;                  /* Temporary variables to hold state and coefficient values */
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  float32_t acc;                                 /* Accumulator */
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blockSize > 0u)
+  {
+    /* The segment ends at the end of the block or where the write index wraps */
+    segCnt = delayLen - index;
+
+    if(segCnt > blockSize)
+    {
+      segCnt = blockSize;
+    }
+
+    /* Write the new samples to the upper copy of the delay line */
+    pStateCurnt = pState + delayLen + index;
+
+    i = segCnt;
+
+    while(i > 0u)
+    {
+      *pStateCurnt++ = *pSrc++;
+
+      i--;
+    }
+
+    /* The numTaps samples of the first output of the segment are contiguous and
+     ** end at its input sample.  The lower copy still holds the samples of the previous
+     ** pass over the delay line, which are the ones the outputs need there. */
+    pWin = pState + delayLen + index - (numTaps - 1u);
+
+#ifndef ARM_MATH_CM0
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Compute 4 outputs at a time, as the linear FIR does */
+    blkCnt = segCnt >> 2u;
+
+    while(blkCnt > 0u)
+    {
+      /* Set all accumulators to zero */
+      acc0 = 0.0f;
+      acc1 = 0.0f;
+      acc2 = 0.0f;
+      acc3 = 0.0f;
+
+      /* Initialize state and coefficient pointers */
+      px = pWin;
+      pb = pCoeffs;
+
+      /* Read the first three samples of the window */
+      x0 = *px++;
+      x1 = *px++;
+      x2 = *px++;
+
+      /* Loop unrolling.  Process 4 taps at a time. */
+      tapCnt = numTaps >> 2u;
+
+      while(tapCnt > 0u)
+      {
+        c0 = *pb++;
+        x3 = *px++;
+
+        acc0 += x0 * c0;
+        acc1 += x1 * c0;
+        acc2 += x2 * c0;
+        acc3 += x3 * c0;
+
+        c0 = *pb++;
+        x0 = *px++;
+
+        acc0 += x1 * c0;
+        acc1 += x2 * c0;
+        acc2 += x3 * c0;
+        acc3 += x0 * c0;
+
+        c0 = *pb++;
+        x1 = *px++;
+
+        acc0 += x2 * c0;
+        acc1 += x3 * c0;
+        acc2 += x0 * c0;
+        acc3 += x1 * c0;
+
+        c0 = *pb++;
+        x2 = *px++;
+
+        acc0 += x3 * c0;
+        acc1 += x0 * c0;
+        acc2 += x1 * c0;
+        acc3 += x2 * c0;
+
+        tapCnt--;
+      }
+
+      /* If the filter length is not a multiple of 4, compute the remaining filter taps */
+      tapCnt = numTaps % 0x4u;
+
+      while(tapCnt > 0u)
+      {
+        c0 = *pb++;
+        x3 = *px++;
+
+        acc0 += x0 * c0;
+        acc1 += x1 * c0;
+        acc2 += x2 * c0;
+        acc3 += x3 * c0;
+
+        /* Reuse the present sample states for next sample */
+        x0 = x1;
+        x1 = x2;
+        x2 = x3;
+
+        tapCnt--;
+      }
+
+      /* Store the 4 outputs in the destination buffer */
+      *pDst++ = acc0;
+      *pDst++ = acc1;
+      *pDst++ = acc2;
+      *pDst++ = acc3;
+
+      /* Advance the window by 4 samples */
+      pWin += 4u;
+
+      blkCnt--;
+    }
+
+    /* Compute the remaining 1 to 3 outputs of the segment */
+    blkCnt = segCnt % 0x4u;
+
+    while(blkCnt > 0u)
+    {
+      acc0 = 0.0f;
+
+      px = pWin;
+      pb = pCoeffs;
+
+      tapCnt = numTaps;
+
+      do
+      {
+        acc0 += *px++ * *pb++;
+
+        tapCnt--;
+      } while(tapCnt > 0u);
+
+      *pDst++ = acc0;
+
+      pWin++;
+
+      blkCnt--;
+    }
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    blkCnt = segCnt;
+
+    while(blkCnt > 0u)
+    {
+      acc = 0.0f;
+
+      px = pWin;
+      pb = pCoeffs;
+
+      tapCnt = numTaps;
+
+      do
+      {
+        /* acc =  b[numTaps-1] * x[n-numTaps-1] + b[numTaps-2] * x[n-numTaps-2] + ... + b[0] * x[n] */
+        acc += *px++ * *pb++;
+
+        tapCnt--;
+      } while(tapCnt > 0u);
+
+      *pDst++ = acc;
+
+      pWin++;
+
+      blkCnt--;
+    }
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+    /* Mirror the new samples into the lower copy for the outputs that follow */
+    px = pState + delayLen + index;
+    pStateCurnt = pState + index;
+
+    i = segCnt;
+
+    while(i > 0u)
+    {
+      *pStateCurnt++ = *px++;
+
+      i--;
+    }
+
+    /* Advance the write index modulo delayLen */
+    index = (index + segCnt) & (delayLen - 1u);
+
+    blockSize -= segCnt;
+  }
+
+  /* Save the write index for the next call */
+  S->stateIndex = (uint16_t) index;
+}
+
+/**
+ * @} end of FIRCirc group
+ */
@@ -0,0 +1,86 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:        arm_fir_circ_init_q31.c
+*
+* Description:  Q31 circular state FIR filter initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIRCirc
+ * @{
+ */
+
+/**
+ * @param[in,out] *S points to an instance of the Q31 circular state FIR filter structure.
+ * @param[in]     numTaps  Number of filter coefficients in the filter.
+ * @param[in]     *pCoeffs points to the filter coefficients buffer.
+ * @param[in]     *pState points to the state buffer.
+ * @param[in]     delayLen length of the delay line.  Must be a power of 2 greater than or equal to <code>numTaps</code>.
+ * @return The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if
+ * <code>numTaps</code> is zero or <code>delayLen</code> is not a power of 2 greater than or equal to <code>numTaps</code>.
+ *
+ * <b>Description:</b>
+ * \par
+ * <code>pCoeffs</code> points to the array of filter coefficients stored in time reversed order:
+ * <pre>
+ *    {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}
+ * </pre>
+ * \par
+ * <code>pState</code> points to the array of state variables.
+ * <code>pState</code> is of length <code>2*delayLen</code>, whatever the number of samples processed by each call to <code>arm_fir_circ_q31()</code>.
+ */
+
+arm_status arm_fir_circ_init_q31(
+  arm_fir_circ_instance_q31 * S,
+  uint16_t numTaps,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  uint16_t delayLen)
+{
+  arm_status status;
+
+  /* The delay line must hold numTaps samples and its length must be a power of 2 */
+  if((numTaps == 0u) || (delayLen < numTaps) || ((delayLen & (delayLen - 1u)) != 0u))
+  {
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    /* Assign filter taps */
+    S->numTaps = numTaps;
+
+    /* Assign the delay line length and start writing at its beginning */
+    S->delayLen = delayLen;
+    S->stateIndex = 0u;
+
+    /* Assign coefficient pointer */
+    S->pCoeffs = pCoeffs;
+
+    /* Clear the state buffer.  The size is always 2 * delayLen */
+    memset(pState, 0, (2u * (uint32_t) delayLen) * sizeof(q31_t));
+
+    /* Assign state pointer */
+    S->pState = pState;
+
+    status = ARM_MATH_SUCCESS;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of FIRCirc group
+ */
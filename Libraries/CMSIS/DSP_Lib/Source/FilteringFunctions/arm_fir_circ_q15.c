@@ -0,0 +1,250 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_circ_q15.c
+*
+* Description:	Q15 FIR filter with a circular state buffer.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIRCirc
+ * @{
+ */
+
+/**
+ * @param[in,out] *S points to an instance of the Q15 circular state FIR structure.
+ * @param[in]     *pSrc points to the block of input data.
+ * @param[out]    *pDst points to the block of output data.
+ * @param[in]     blockSize number of samples to process per call.
+ * @return        none.
+ */
+
+void arm_fir_circ_q15(
+  arm_fir_circ_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pState = S->pState;                     /* State pointer */
+  q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q15_t *pStateCurnt;                            /* Points to the current sample of the state */
+  q15_t *pWin;                                   /* Points to the oldest sample of the current output */
+  q15_t *px, *pb;                                /* Temporary pointers for state and coefficient buffers */
+  uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+  uint32_t delayLen = S->delayLen;               /* Length of one copy of the delay line */
+  uint32_t index = S->stateIndex;                /* Write index into the delay line */
+  uint32_t segCnt, i, tapCnt, blkCnt;            /* Loop counters */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  q63_t acc0, acc1, acc2, acc3;                  /* Accumulators */
+  q31_t x0, x1, x2, x3, c0;                      /* Temporary variables to hold SIMD state and coefficient values */
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  q63_t acc;                                     /* Accumulator */
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blockSize > 0u)
+  {
+    /* The segment ends at the end of the block or where the write index wraps */
+    segCnt = delayLen - index;
+
+    if(segCnt > blockSize)
+    {
+      segCnt = blockSize;
+    }
+
+    /* Write the new samples to the upper copy of the delay line */
+    pStateCurnt = pState + delayLen + index;
+
+    i = segCnt;
+
+    while(i > 0u)
+    {
+      *pStateCurnt++ = *pSrc++;
+
+      i--;
+    }
+
+    /* The numTaps samples of the first output of the segment are contiguous and
+     ** end at its input sample.  The lower copy still holds the samples of the previous
+     ** pass over the delay line, which are the ones the outputs need there. */
+    pWin = pState + delayLen + index - (numTaps - 1u);
+
+#ifndef ARM_MATH_CM0
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Compute 4 outputs at a time, as the linear FIR does, with the taps taken in
+     ** pairs by the dual 16-bit multiply-accumulate */
+    blkCnt = segCnt >> 2u;
+
+    while(blkCnt > 0u)
+    {
+      /* Set all accumulators to zero */
+      acc0 = 0;
+      acc1 = 0;
+      acc2 = 0;
+      acc3 = 0;
+
+      /* Initialize state and coefficient pointers */
+      px = pWin;
+      pb = pCoeffs;
+
+      /* Read the sample pairs x[0], x[1] and x[1], x[2] of the window */
+      x0 = *(q31_t *) (px++);
+      x1 = *(q31_t *) (px++);
+
+      /* Loop over the taps two at a time */
+      tapCnt = numTaps >> 1u;
+
+      while(tapCnt > 0u)
+      {
+        /* Read 2 coefficients */
+        c0 = *__SIMD32(pb)++;
+
+        /* Read the next two sample pairs */
+        x2 = *(q31_t *) (px++);
+        x3 = *(q31_t *) (px++);
+
+        /* acc0 +=  b[k] * x[k] + b[k+1] * x[k+1], and the same for the next 3 outputs */
+        acc0 = __SMLALD(x0, c0, acc0);
+        acc1 = __SMLALD(x1, c0, acc1);
+        acc2 = __SMLALD(x2, c0, acc2);
+        acc3 = __SMLALD(x3, c0, acc3);
+
+        /* Reuse the pairs for the next two taps */
+        x0 = x2;
+        x1 = x3;
+
+        tapCnt--;
+      }
+
+      /* If the filter length is odd, compute the last tap */
+      if((numTaps & 0x1u) != 0u)
+      {
+        c0 = *pb;
+        px = pWin + (numTaps - 1u);
+
+        acc0 += (q31_t) px[0] * c0;
+        acc1 += (q31_t) px[1] * c0;
+        acc2 += (q31_t) px[2] * c0;
+        acc3 += (q31_t) px[3] * c0;
+      }
+
+      /* The results in the 4 accumulators are in 2.30 format.  Convert to 1.15 with saturation.
+       ** Then store the 4 outputs in the destination buffer. */
+      *pDst++ = (q15_t) __SSAT((acc0 >> 15), 16);
+      *pDst++ = (q15_t) __SSAT((acc1 >> 15), 16);
+      *pDst++ = (q15_t) __SSAT((acc2 >> 15), 16);
+      *pDst++ = (q15_t) __SSAT((acc3 >> 15), 16);
+
+      /* Advance the window by 4 samples */
+      pWin += 4u;
+
+      blkCnt--;
+    }
+
+    /* Compute the remaining 1 to 3 outputs of the segment */
+    blkCnt = segCnt % 0x4u;
+
+    while(blkCnt > 0u)
+    {
+      acc0 = 0;
+
+      px = pWin;
+      pb = pCoeffs;
+
+      tapCnt = numTaps;
+
+      do
+      {
+        acc0 += (q31_t) * px++ * *pb++;
+
+        tapCnt--;
+      } while(tapCnt > 0u);
+
+      *pDst++ = (q15_t) __SSAT((acc0 >> 15), 16);
+
+      pWin++;
+
+      blkCnt--;
+    }
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    blkCnt = segCnt;
+
+    while(blkCnt > 0u)
+    {
+      acc = 0;
+
+      px = pWin;
+      pb = pCoeffs;
+
+      tapCnt = numTaps;
+
+      do
+      {
+        /* acc =  b[numTaps-1] * x[n-numTaps-1] + b[numTaps-2] * x[n-numTaps-2] + ... + b[0] * x[n] */
+        acc += (q31_t) * px++ * *pb++;
+
+        tapCnt--;
+      } while(tapCnt > 0u);
+
+      /* The result is in 2.30 format.  Convert to 1.15 with saturation */
+      *pDst++ = (q15_t) __SSAT((acc >> 15), 16);
+
+      pWin++;
+
+      blkCnt--;
+    }
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+    /* Mirror the new samples into the lower copy for the outputs that follow */
+    px = pState + delayLen + index;
+    pStateCurnt = pState + index;
+
+    i = segCnt;
+
+    while(i > 0u)
+    {
+      *pStateCurnt++ = *px++;
+
+      i--;
+    }
+
+    /* Advance the write index modulo delayLen */
+    index = (index + segCnt) & (delayLen - 1u);
+
+    blockSize -= segCnt;
+  }
+
+  /* Save the write index for the next call */
+  S->stateIndex = (uint16_t) index;
+}
+
+/**
+ * @} end of FIRCirc group
+ */
@@ -0,0 +1,274 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_circ_q31.c
+*
+* Description:	Q31 FIR filter with a circular state buffer.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIRCirc
+ * @{
+ */
+
+/**
+ * @param[in,out] *S points to an instance of the Q31 circular state FIR structure.
+ * @param[in]     *pSrc points to the block of input data.
+ * @param[out]    *pDst points to the block of output data.
+ * @param[in]     blockSize number of samples to process per call.
+ * @return        none.
+ */
+
+void arm_fir_circ_q31(
+  arm_fir_circ_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t *pState = S->pState;                     /* State pointer */
+  q31_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q31_t *pStateCurnt;                            /* Points to the current sample of the state */
+  q31_t *pWin;                                   /* Points to the oldest sample of the current output */
+  q31_t *px, *pb;                                /* Temporary pointers for state and coefficient buffers */
+  uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+  uint32_t delayLen = S->delayLen;               /* Length of one copy of the delay line */
+  uint32_t index = S->stateIndex;                /* Write index into the delay line */
+  uint32_t segCnt, i, tapCnt, blkCnt;            /* Loop counters */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  q63_t acc0, acc1, acc2, acc3;                  /* Accumulators */
+  q31_t x0, x1, x2, x3, c0;                      /* Temporary variables to hold state and coefficient values */
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  q63_t acc;                                     /* Accumulator */
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blockSize > 0u)
+  {
+    /* The segment ends at the end of the block or where the write index wraps */
+    segCnt = delayLen - index;
+
+    if(segCnt > blockSize)
+    {
+      segCnt = blockSize;
+    }
+
+    /* Write the new samples to the upper copy of the delay line */
+    pStateCurnt = pState + delayLen + index;
+
+    i = segCnt;
+
+    while(i > 0u)
+    {
+      *pStateCurnt++ = *pSrc++;
+
+      i--;
+    }
+
+    /* The numTaps samples of the first output of the segment are contiguous and
+     ** end at its input sample.  The lower copy still holds the samples of the previous
+     ** pass over the delay line, which are the ones the outputs need there. */
+    pWin = pState + delayLen + index - (numTaps - 1u);
+
+#ifndef ARM_MATH_CM0
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Compute 4 outputs at a time, as the linear FIR does */
+    blkCnt = segCnt >> 2u;
+
+    while(blkCnt > 0u)
+    {
+      /* Set all accumulators to zero */
+      acc0 = 0;
+      acc1 = 0;
+      acc2 = 0;
+      acc3 = 0;
+
+      /* Initialize state and coefficient pointers */
+      px = pWin;
+      pb = pCoeffs;
+
+      /* Read the first three samples of the window */
+      x0 = *px++;
+      x1 = *px++;
+      x2 = *px++;
+
+      /* Loop unrolling.  Process 4 taps at a time. */
+      tapCnt = numTaps >> 2u;
+
+      while(tapCnt > 0u)
+      {
+        c0 = *pb++;
+        x3 = *px++;
+
+        acc0 += ((q63_t) x0 * c0);
+        acc1 += ((q63_t) x1 * c0);
+        acc2 += ((q63_t) x2 * c0);
+        acc3 += ((q63_t) x3 * c0);
+
+        c0 = *pb++;
+        x0 = *px++;
+
+        acc0 += ((q63_t) x1 * c0);
+        acc1 += ((q63_t) x2 * c0);
+        acc2 += ((q63_t) x3 * c0);
+        acc3 += ((q63_t) x0 * c0);
+
+        c0 = *pb++;
+        x1 = *px++;
+
+        acc0 += ((q63_t) x2 * c0);
+        acc1 += ((q63_t) x3 * c0);
+        acc2 += ((q63_t) x0 * c0);
+        acc3 += ((q63_t) x1 * c0);
+
+        c0 = *pb++;
+        x2 = *px++;
+
+        acc0 += ((q63_t) x3 * c0);
+        acc1 += ((q63_t) x0 * c0);
+        acc2 += ((q63_t) x1 * c0);
+        acc3 += ((q63_t) x2 * c0);
+
+        tapCnt--;
+      }
+
+      /* If the filter length is not a multiple of 4, compute the remaining filter taps */
+      tapCnt = numTaps % 0x4u;
+
+      while(tapCnt > 0u)
+      {
+        c0 = *pb++;
+        x3 = *px++;
+
+        acc0 += ((q63_t) x0 * c0);
+        acc1 += ((q63_t) x1 * c0);
+        acc2 += ((q63_t) x2 * c0);
+        acc3 += ((q63_t) x3 * c0);
+
+        /* Reuse the present sample states for next sample */
+        x0 = x1;
+        x1 = x2;
+        x2 = x3;
+
+        tapCnt--;
+      }
+
+      /* The results in the 4 accumulators are in 2.62 format.  Convert to 1.31
+       ** Then store the 4 outputs in the destination buffer. */
+      *pDst++ = (q31_t) (acc0 >> 31u);
+      *pDst++ = (q31_t) (acc1 >> 31u);
+      *pDst++ = (q31_t) (acc2 >> 31u);
+      *pDst++ = (q31_t) (acc3 >> 31u);
+
+      /* Advance the window by 4 samples */
+      pWin += 4u;
+
+      blkCnt--;
+    }
+
+    /* Compute the remaining 1 to 3 outputs of the segment */
+    blkCnt = segCnt % 0x4u;
+
+    while(blkCnt > 0u)
+    {
+      acc0 = 0;
+
+      px = pWin;
+      pb = pCoeffs;
+
+      tapCnt = numTaps;
+
+      do
+      {
+        acc0 += (q63_t) * px++ * *pb++;
+
+        tapCnt--;
+      } while(tapCnt > 0u);
+
+      *pDst++ = (q31_t) (acc0 >> 31u);
+
+      pWin++;
+
+      blkCnt--;
+    }
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    blkCnt = segCnt;
+
+    while(blkCnt > 0u)
+    {
+      acc = 0;
+
+      px = pWin;
+      pb = pCoeffs;
+
+      tapCnt = numTaps;
+
+      do
+      {
+        /* acc =  b[numTaps-1] * x[n-numTaps-1] + b[numTaps-2] * x[n-numTaps-2] + ... + b[0] * x[n] */
+        acc += (q63_t) * px++ * *pb++;
+
+        tapCnt--;
+      } while(tapCnt > 0u);
+
+      /* The result is in 2.62 format.  Convert to 1.31 */
+      *pDst++ = (q31_t) (acc >> 31u);
+
+      pWin++;
+
+      blkCnt--;
+    }
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+    /* Mirror the new samples into the lower copy for the outputs that follow */
+    px = pState + delayLen + index;
+    pStateCurnt = pState + index;
+
+    i = segCnt;
+
+    while(i > 0u)
+    {
+      *pStateCurnt++ = *px++;
+
+      i--;
+    }
+
+    /* Advance the write index modulo delayLen */
+    index = (index + segCnt) & (delayLen - 1u);
+
+    blockSize -= segCnt;
+  }
+
+  /* Save the write index for the next call */
+  S->stateIndex = (uint16_t) index;
+}
+
+/**
+ * @} end of FIRCirc group
+ */
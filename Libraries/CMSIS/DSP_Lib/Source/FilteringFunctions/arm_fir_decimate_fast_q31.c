@@ -63,7 +63,7 @@
  */
 
 void arm_fir_decimate_fast_q31(
-  arm_fir_decimate_instance_q31 * S,
+  const arm_fir_decimate_instance_q31 * S,
   q31_t * pSrc,
   q31_t * pDst,
   uint32_t blockSize)
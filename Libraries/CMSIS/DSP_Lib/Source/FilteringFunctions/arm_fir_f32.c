@@ -108,6 +108,13 @@
  * Care must be taken when using the fixed-point versions of the FIR filter functions.   
  * In particular, the overflow and saturation behavior of the accumulator used in each function must be considered.   
  * Refer to the function specific documentation below for usage guidelines.   
+ *   
+ * \par Fixed Tap Counts   
+ * On Cortex-M3 and Cortex-M4, <code>arm_fir_f32()</code>, <code>arm_fir_q31()</code>, <code>arm_fir_q15()</code> and   
+ * <code>arm_fir_fast_q15()</code> first look for a kernel generated for the tap count (and optionally the block size)   
+ * of the instance.  These kernels have the tap loop fully unrolled and give the same outputs as the generic code.   
+ * The list of kernels is <code>DSP_Lib/Scripts/arm_fir_fixed.cfg</code>; <code>DSP_Lib/Scripts/arm_fir_fixed_gen.py</code>   
+ * turns it into <code>arm_fir_fixed_f32.c</code>, <code>arm_fir_fixed_q31.c</code> and <code>arm_fir_fixed_q15.c</code>.   
  */
 
 /**   
@@ -148,6 +155,12 @@ void arm_fir_f32(
   float32_t x0, x1, x2, x3, c0;                  /* Temporary variables to hold state and coefficient values */
 
 
+  /* Use the kernel generated for this tap count, if there is one (arm_fir_fixed_f32.c) */
+  if(arm_fir_fixed_f32(S, pSrc, pDst, blockSize) == ARM_MATH_SUCCESS)
+  {
+    return;
+  }
+
   /* S->pState points to state array which contains previous frame (numTaps - 1) samples */
   /* pStateCurnt points to the location where the new input data should be written */
   pStateCurnt = &(S->pState[(numTaps - 1u)]);
@@ -371,9 +384,190 @@ void arm_fir_f32(
   /* pStateCurnt points to the location where the new input data should be written */
   pStateCurnt = &(S->pState[(numTaps - 1u)]);
 
+#if defined (ARM_MATH_SSE2)
+
+  /* Host build: compute 4 outputs at a time.   
+   ** Each accumulator holds the partial sums of one output over 4 (AVX2: 8) taps,   
+   ** the accumulators are transposed and added at the end of the tap loop. */
+  {
+    __m128 vAcc0, vAcc1, vAcc2, vAcc3, vCoef, vOut;
+
+#if defined (ARM_MATH_AVX2)
+    __m256 vAcc80, vAcc81, vAcc82, vAcc83, vCoef8;
+#endif /* #if defined (ARM_MATH_AVX2) */
+
+    blkCnt = blockSize >> 2u;
+
+    while(blkCnt > 0u)
+    {
+      /* Copy four new input samples into the state buffer */
+      *pStateCurnt++ = *pSrc++;
+      *pStateCurnt++ = *pSrc++;
+      *pStateCurnt++ = *pSrc++;
+      *pStateCurnt++ = *pSrc++;
+
+      px = pState;
+      pb = pCoeffs;
+
+#if defined (ARM_MATH_AVX2)
+
+      vAcc80 = _mm256_setzero_ps();
+      vAcc81 = _mm256_setzero_ps();
+      vAcc82 = _mm256_setzero_ps();
+      vAcc83 = _mm256_setzero_ps();
+
+      /* Process 8 taps at a time */
+      tapCnt = numTaps >> 3u;
+
+      while(tapCnt > 0u)
+      {
+        vCoef8 = _mm256_loadu_ps(pb);
+        vAcc80 = _mm256_add_ps(vAcc80, _mm256_mul_ps(vCoef8, _mm256_loadu_ps(px)));
+        vAcc81 = _mm256_add_ps(vAcc81, _mm256_mul_ps(vCoef8, _mm256_loadu_ps(px + 1)));
+        vAcc82 = _mm256_add_ps(vAcc82, _mm256_mul_ps(vCoef8, _mm256_loadu_ps(px + 2)));
+        vAcc83 = _mm256_add_ps(vAcc83, _mm256_mul_ps(vCoef8, _mm256_loadu_ps(px + 3)));
+        px += 8u;
+        pb += 8u;
+
+        tapCnt--;
+      }
+
+      /* Fold the 256-bit accumulators into 128-bit accumulators */
+      vAcc0 = _mm_add_ps(_mm256_castps256_ps128(vAcc80), _mm256_extractf128_ps(vAcc80, 1));
+      vAcc1 = _mm_add_ps(_mm256_castps256_ps128(vAcc81), _mm256_extractf128_ps(vAcc81, 1));
+      vAcc2 = _mm_add_ps(_mm256_castps256_ps128(vAcc82), _mm256_extractf128_ps(vAcc82, 1));
+      vAcc3 = _mm_add_ps(_mm256_castps256_ps128(vAcc83), _mm256_extractf128_ps(vAcc83, 1));
+
+      /* At most one group of 4 taps is left */
+      tapCnt = (numTaps >> 2u) & 0x1u;
+
+#else
+
+      vAcc0 = _mm_setzero_ps();
+      vAcc1 = _mm_setzero_ps();
+      vAcc2 = _mm_setzero_ps();
+      vAcc3 = _mm_setzero_ps();
+
+      /* Process 4 taps at a time */
+      tapCnt = numTaps >> 2u;
+
+#endif /* #if defined (ARM_MATH_AVX2) */
+
+      while(tapCnt > 0u)
+      {
+        vCoef = _mm_loadu_ps(pb);
+        vAcc0 = _mm_add_ps(vAcc0, _mm_mul_ps(vCoef, _mm_loadu_ps(px)));
+        vAcc1 = _mm_add_ps(vAcc1, _mm_mul_ps(vCoef, _mm_loadu_ps(px + 1)));
+        vAcc2 = _mm_add_ps(vAcc2, _mm_mul_ps(vCoef, _mm_loadu_ps(px + 2)));
+        vAcc3 = _mm_add_ps(vAcc3, _mm_mul_ps(vCoef, _mm_loadu_ps(px + 3)));
+        px += 4u;
+        pb += 4u;
+
+        tapCnt--;
+      }
+
+      /* vOut = {acc0, acc1, acc2, acc3} */
+      _MM_TRANSPOSE4_PS(vAcc0, vAcc1, vAcc2, vAcc3);
+      vOut = _mm_add_ps(_mm_add_ps(vAcc0, vAcc1), _mm_add_ps(vAcc2, vAcc3));
+
+      /* Compute the remaining 1 to 3 taps for all 4 outputs */
+      tapCnt = numTaps % 0x4u;
+
+      while(tapCnt > 0u)
+      {
+        vOut = _mm_add_ps(vOut, _mm_mul_ps(_mm_set1_ps(*pb++), _mm_loadu_ps(px++)));
+
+        tapCnt--;
+      }
+
+      _mm_storeu_ps(pDst, vOut);
+      pDst += 4u;
+
+      /* Advance the state pointer by 4 to process the next group of 4 samples */
+      pState = pState + 4;
+
+      blkCnt--;
+    }
+  }
+
+  /* Compute the remaining 1 to 3 samples below */
+  blkCnt = blockSize % 0x4u;
+
+#elif defined (ARM_MATH_NEON)
+
+  /* Host build: compute 4 outputs at a time.   
+   ** Each accumulator holds the partial sums of one output over 4 taps,   
+   ** the accumulators are reduced pairwise at the end of the tap loop. */
+  {
+    float32x4_t vAcc0, vAcc1, vAcc2, vAcc3, vCoef, vOut;
+
+    blkCnt = blockSize >> 2u;
+
+    while(blkCnt > 0u)
+    {
+      /* Copy four new input samples into the state buffer */
+      *pStateCurnt++ = *pSrc++;
+      *pStateCurnt++ = *pSrc++;
+      *pStateCurnt++ = *pSrc++;
+      *pStateCurnt++ = *pSrc++;
+
+      px = pState;
+      pb = pCoeffs;
+
+      vAcc0 = vdupq_n_f32(0.0f);
+      vAcc1 = vdupq_n_f32(0.0f);
+      vAcc2 = vdupq_n_f32(0.0f);
+      vAcc3 = vdupq_n_f32(0.0f);
+
+      /* Process 4 taps at a time */
+      tapCnt = numTaps >> 2u;
+
+      while(tapCnt > 0u)
+      {
+        vCoef = vld1q_f32(pb);
+        vAcc0 = vmlaq_f32(vAcc0, vCoef, vld1q_f32(px));
+        vAcc1 = vmlaq_f32(vAcc1, vCoef, vld1q_f32(px + 1));
+        vAcc2 = vmlaq_f32(vAcc2, vCoef, vld1q_f32(px + 2));
+        vAcc3 = vmlaq_f32(vAcc3, vCoef, vld1q_f32(px + 3));
+        px += 4u;
+        pb += 4u;
+
+        tapCnt--;
+      }
+
+      /* vOut = {acc0, acc1, acc2, acc3} */
+      vOut = vpaddq_f32(vpaddq_f32(vAcc0, vAcc1), vpaddq_f32(vAcc2, vAcc3));
+
+      /* Compute the remaining 1 to 3 taps for all 4 outputs */
+      tapCnt = numTaps % 0x4u;
+
+      while(tapCnt > 0u)
+      {
+        vOut = vmlaq_n_f32(vOut, vld1q_f32(px++), *pb++);
+
+        tapCnt--;
+      }
+
+      vst1q_f32(pDst, vOut);
+      pDst += 4u;
+
+      /* Advance the state pointer by 4 to process the next group of 4 samples */
+      pState = pState + 4;
+
+      blkCnt--;
+    }
+  }
+
+  /* Compute the remaining 1 to 3 samples below */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
   /* Initialize blkCnt with blockSize */
   blkCnt = blockSize;
 
+#endif /* #if defined (ARM_MATH_SSE2) */
+
   while(blkCnt > 0u)
   {
     /* Copy one sample at a time into state buffer */
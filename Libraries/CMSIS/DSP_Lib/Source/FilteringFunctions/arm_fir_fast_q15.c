@@ -72,13 +72,211 @@ void arm_fir_fast_q15(
   q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
   q15_t *pStateCurnt;                            /* Points to the current sample of the state */
   q15_t *px1;                                    /* Temporary q15 pointer for state buffer */
-  q31_t *pb;                                     /* Temporary pointer for coefficient buffer */
-  q31_t *px2;                                    /* Temporary q31 pointer for SIMD state buffer accesses */
-  q31_t x0, x1, x2, x3, c0;                      /* Temporary variables to hold SIMD state and coefficient values */
-  q31_t acc0, acc1, acc2, acc3;                  /* Accumulators */
+  q31_t c0;                                      /* Temporary variable to hold coefficient values */
+  q31_t acc0;                                    /* Accumulator */
   uint32_t numTaps = S->numTaps;                 /* Number of taps in the filter */
   uint32_t tapCnt, blkCnt;                       /* Loop counters */
 
+#if defined (ARM_MATH_SSE2) || defined (ARM_MATH_NEON)
+
+  /* Run the below code for host targets */
+
+  q15_t *pc;                                     /* Temporary q15 pointer for coefficient buffer */
+  q31_t acc[4];                                  /* Accumulators of the 4 outputs */
+  uint32_t i;                                    /* Loop counter */
+
+#if defined (ARM_MATH_SSE2)
+  __m128i vAcc0, vAcc1, vAcc2, vAcc3, vCoef, vT0, vT1;
+#if defined (ARM_MATH_AVX2)
+  __m256i vAcc80, vAcc81, vAcc82, vAcc83, vCoef8;
+#endif /* #if defined (ARM_MATH_AVX2) */
+#else
+  int32x4_t vAcc0, vAcc1, vAcc2, vAcc3;
+  int16x8_t vCoef;
+#endif /* #if defined (ARM_MATH_SSE2) */
+
+  /* S->pState points to buffer which contains previous frame (numTaps - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = &(S->pState[(numTaps - 1u)]);
+
+  /* Copy the new input samples into the state buffer */
+  arm_copy_q15(pSrc, pStateCurnt, blockSize);
+
+  /* Compute 4 outputs at a time.   
+   ** Each vector accumulator holds the 32-bit partial sums of one output.   
+   ** The partial sums wrap around exactly like the single 32-bit accumulator   
+   ** of the Cortex-M code, so the result is bit exact with it. */
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    px1 = pState;
+    pc = pCoeffs;
+
+#if defined (ARM_MATH_SSE2)
+
+#if defined (ARM_MATH_AVX2)
+
+    vAcc80 = _mm256_setzero_si256();
+    vAcc81 = _mm256_setzero_si256();
+    vAcc82 = _mm256_setzero_si256();
+    vAcc83 = _mm256_setzero_si256();
+
+    /* Process 16 taps at a time */
+    tapCnt = numTaps >> 4u;
+
+    while(tapCnt > 0u)
+    {
+      vCoef8 = _mm256_loadu_si256((__m256i *) pc);
+      vAcc80 = _mm256_add_epi32(vAcc80, _mm256_madd_epi16(vCoef8, _mm256_loadu_si256((__m256i *) px1)));
+      vAcc81 = _mm256_add_epi32(vAcc81, _mm256_madd_epi16(vCoef8, _mm256_loadu_si256((__m256i *) (px1 + 1))));
+      vAcc82 = _mm256_add_epi32(vAcc82, _mm256_madd_epi16(vCoef8, _mm256_loadu_si256((__m256i *) (px1 + 2))));
+      vAcc83 = _mm256_add_epi32(vAcc83, _mm256_madd_epi16(vCoef8, _mm256_loadu_si256((__m256i *) (px1 + 3))));
+      px1 += 16u;
+      pc += 16u;
+
+      tapCnt--;
+    }
+
+    /* Fold the 256-bit accumulators into 128-bit accumulators */
+    vAcc0 = _mm_add_epi32(_mm256_castsi256_si128(vAcc80), _mm256_extracti128_si256(vAcc80, 1));
+    vAcc1 = _mm_add_epi32(_mm256_castsi256_si128(vAcc81), _mm256_extracti128_si256(vAcc81, 1));
+    vAcc2 = _mm_add_epi32(_mm256_castsi256_si128(vAcc82), _mm256_extracti128_si256(vAcc82, 1));
+    vAcc3 = _mm_add_epi32(_mm256_castsi256_si128(vAcc83), _mm256_extracti128_si256(vAcc83, 1));
+
+    /* At most one group of 8 taps is left */
+    tapCnt = (numTaps >> 3u) & 0x1u;
+
+#else
+
+    vAcc0 = _mm_setzero_si128();
+    vAcc1 = _mm_setzero_si128();
+    vAcc2 = _mm_setzero_si128();
+    vAcc3 = _mm_setzero_si128();
+
+    /* Process 8 taps at a time */
+    tapCnt = numTaps >> 3u;
+
+#endif /* #if defined (ARM_MATH_AVX2) */
+
+    while(tapCnt > 0u)
+    {
+      vCoef = _mm_loadu_si128((__m128i *) pc);
+      vAcc0 = _mm_add_epi32(vAcc0, _mm_madd_epi16(vCoef, _mm_loadu_si128((__m128i *) px1)));
+      vAcc1 = _mm_add_epi32(vAcc1, _mm_madd_epi16(vCoef, _mm_loadu_si128((__m128i *) (px1 + 1))));
+      vAcc2 = _mm_add_epi32(vAcc2, _mm_madd_epi16(vCoef, _mm_loadu_si128((__m128i *) (px1 + 2))));
+      vAcc3 = _mm_add_epi32(vAcc3, _mm_madd_epi16(vCoef, _mm_loadu_si128((__m128i *) (px1 + 3))));
+      px1 += 8u;
+      pc += 8u;
+
+      tapCnt--;
+    }
+
+    /* Reduce the 4 accumulators to {acc0, acc1, acc2, acc3} */
+    vT0 = _mm_add_epi32(_mm_unpacklo_epi32(vAcc0, vAcc1), _mm_unpackhi_epi32(vAcc0, vAcc1));
+    vT1 = _mm_add_epi32(_mm_unpacklo_epi32(vAcc2, vAcc3), _mm_unpackhi_epi32(vAcc2, vAcc3));
+    _mm_storeu_si128((__m128i *) acc, _mm_add_epi32(_mm_unpacklo_epi64(vT0, vT1), _mm_unpackhi_epi64(vT0, vT1)));
+
+#else
+
+    vAcc0 = vdupq_n_s32(0);
+    vAcc1 = vdupq_n_s32(0);
+    vAcc2 = vdupq_n_s32(0);
+    vAcc3 = vdupq_n_s32(0);
+
+    /* Process 8 taps at a time */
+    tapCnt = numTaps >> 3u;
+
+    while(tapCnt > 0u)
+    {
+      vCoef = vld1q_s16(pc);
+      vAcc0 = vmlal_s16(vAcc0, vget_low_s16(vCoef), vld1_s16(px1));
+      vAcc0 = vmlal_s16(vAcc0, vget_high_s16(vCoef), vld1_s16(px1 + 4));
+      vAcc1 = vmlal_s16(vAcc1, vget_low_s16(vCoef), vld1_s16(px1 + 1));
+      vAcc1 = vmlal_s16(vAcc1, vget_high_s16(vCoef), vld1_s16(px1 + 5));
+      vAcc2 = vmlal_s16(vAcc2, vget_low_s16(vCoef), vld1_s16(px1 + 2));
+      vAcc2 = vmlal_s16(vAcc2, vget_high_s16(vCoef), vld1_s16(px1 + 6));
+      vAcc3 = vmlal_s16(vAcc3, vget_low_s16(vCoef), vld1_s16(px1 + 3));
+      vAcc3 = vmlal_s16(vAcc3, vget_high_s16(vCoef), vld1_s16(px1 + 7));
+      px1 += 8u;
+      pc += 8u;
+
+      tapCnt--;
+    }
+
+    /* Reduce the 4 accumulators to {acc0, acc1, acc2, acc3} */
+    vst1q_s32(acc, vpaddq_s32(vpaddq_s32(vAcc0, vAcc1), vpaddq_s32(vAcc2, vAcc3)));
+
+#endif /* #if defined (ARM_MATH_SSE2) */
+
+    /* Compute the remaining 1 to 7 taps for all 4 outputs */
+    tapCnt = numTaps % 0x8u;
+
+    while(tapCnt > 0u)
+    {
+      c0 = *pc++;
+      acc[0] += (q31_t) px1[0] * c0;
+      acc[1] += (q31_t) px1[1] * c0;
+      acc[2] += (q31_t) px1[2] * c0;
+      acc[3] += (q31_t) px1[3] * c0;
+      px1++;
+
+      tapCnt--;
+    }
+
+    /* The results in the 4 accumulators are in 2.30 format.  Convert to 1.15 and store. */
+    *pDst++ = (q15_t) (acc[0] >> 15);
+    *pDst++ = (q15_t) (acc[1] >> 15);
+    *pDst++ = (q15_t) (acc[2] >> 15);
+    *pDst++ = (q15_t) (acc[3] >> 15);
+
+    /* Advance the state pointer by 4 to process the next group of 4 samples */
+    pState = pState + 4;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Compute the remaining 1 to 3 output samples */
+  blkCnt = blockSize % 0x4u;
+
+  while(blkCnt > 0u)
+  {
+    acc0 = 0;
+    px1 = pState;
+    pc = pCoeffs;
+
+    for (i = 0u; i < numTaps; i++)
+    {
+      acc0 += (q31_t) px1[i] * pc[i];
+    }
+
+    *pDst++ = (q15_t) (acc0 >> 15);
+
+    /* Advance state pointer by 1 for the next sample */
+    pState = pState + 1;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Copy the last numTaps - 1 samples to the start of the state buffer */
+  arm_copy_q15(pState, S->pState, numTaps - 1u);
+
+#else
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  q31_t *pb;                                     /* Temporary pointer for coefficient buffer */
+  q31_t *px2;                                    /* Temporary q31 pointer for SIMD state buffer accesses */
+  q31_t x0, x1, x2, x3;                          /* Temporary variables to hold SIMD state values */
+  q31_t acc1, acc2, acc3;                        /* Accumulators */
+
+  /* Use the kernel generated for this tap count, if there is one (arm_fir_fixed_q15.c) */
+  if(arm_fir_fixed_fast_q15(S, pSrc, pDst, blockSize) == ARM_MATH_SUCCESS)
+  {
+    return;
+  }
+
   /* S->pState points to buffer which contains previous frame (numTaps - 1) samples */
   /* pStateCurnt points to the location where the new input data should be written */
   pStateCurnt = &(S->pState[(numTaps - 1u)]);
@@ -272,6 +470,9 @@ void arm_fir_fast_q15(
     /* Decrement the loop counter */
     tapCnt--;
   }
+
+#endif /* #if defined (ARM_MATH_SSE2) || defined (ARM_MATH_NEON) */
+
 }
 
 /**   
@@ -0,0 +1,776 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_fixed_q15.c
+*
+* Description:	Q15 FIR kernels specialized for fixed tap counts.
+*
+*               GENERATED by Scripts/arm_fir_fixed_gen.py from
+*               Scripts/arm_fir_fixed.cfg.  Do not edit.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR
+ * @{
+ */
+
+#ifndef ARM_MATH_CM0
+
+/* Run the below code for Cortex-M4 and Cortex-M3 */
+
+/**
+ * @brief Fast Q15 FIR filter for numTaps = 56 and blockSize = 512.
+ */
+
+static void arm_fir_fast_q15_56x512(
+  const arm_fir_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst)
+{
+  q15_t *pState = S->pState;                     /* State pointer */
+  q31_t *pb = (q31_t *) S->pCoeffs;              /* Coefficient pairs */
+  q15_t *pStateCurnt;                            /* Points to the current sample of the state */
+  q31_t x0, x1, x2, x3, c0;                      /* State and coefficient pairs */
+  q31_t acc0, acc1, acc2, acc3;                  /* Accumulators */
+  uint32_t blkCnt;                               /* Loop counter */
+
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = &(S->pState[55u]);
+
+  /* Compute 4 outputs at a time */
+  blkCnt = 128u;
+
+  while(blkCnt > 0u)
+  {
+    /* Copy four new input samples into the state buffer */
+    *__SIMD32(pStateCurnt)++ = *__SIMD32(pSrc)++;
+    *__SIMD32(pStateCurnt)++ = *__SIMD32(pSrc)++;
+
+    acc0 = 0;
+    acc1 = 0;
+    acc2 = 0;
+    acc3 = 0;
+
+    x0 = *(q31_t *) (pState + 0);
+    x1 = *(q31_t *) (pState + 1);
+
+    c0 = pb[0u];
+    x2 = *(q31_t *) (pState + 2);
+    x3 = *(q31_t *) (pState + 3);
+    acc0 = __SMLAD(x0, c0, acc0);
+    acc1 = __SMLAD(x1, c0, acc1);
+    acc2 = __SMLAD(x2, c0, acc2);
+    acc3 = __SMLAD(x3, c0, acc3);
+
+    c0 = pb[1u];
+    x0 = *(q31_t *) (pState + 4);
+    x1 = *(q31_t *) (pState + 5);
+    acc0 = __SMLAD(x2, c0, acc0);
+    acc1 = __SMLAD(x3, c0, acc1);
+    acc2 = __SMLAD(x0, c0, acc2);
+    acc3 = __SMLAD(x1, c0, acc3);
+
+    c0 = pb[2u];
+    x2 = *(q31_t *) (pState + 6);
+    x3 = *(q31_t *) (pState + 7);
+    acc0 = __SMLAD(x0, c0, acc0);
+    acc1 = __SMLAD(x1, c0, acc1);
+    acc2 = __SMLAD(x2, c0, acc2);
+    acc3 = __SMLAD(x3, c0, acc3);
+
+    c0 = pb[3u];
+    x0 = *(q31_t *) (pState + 8);
+    x1 = *(q31_t *) (pState + 9);
+    acc0 = __SMLAD(x2, c0, acc0);
+    acc1 = __SMLAD(x3, c0, acc1);
+    acc2 = __SMLAD(x0, c0, acc2);
+    acc3 = __SMLAD(x1, c0, acc3);
+
+    c0 = pb[4u];
+    x2 = *(q31_t *) (pState + 10);
+    x3 = *(q31_t *) (pState + 11);
+    acc0 = __SMLAD(x0, c0, acc0);
+    acc1 = __SMLAD(x1, c0, acc1);
+    acc2 = __SMLAD(x2, c0, acc2);
+    acc3 = __SMLAD(x3, c0, acc3);
+
+    c0 = pb[5u];
+    x0 = *(q31_t *) (pState + 12);
+    x1 = *(q31_t *) (pState + 13);
+    acc0 = __SMLAD(x2, c0, acc0);
+    acc1 = __SMLAD(x3, c0, acc1);
+    acc2 = __SMLAD(x0, c0, acc2);
+    acc3 = __SMLAD(x1, c0, acc3);
+
+    c0 = pb[6u];
+    x2 = *(q31_t *) (pState + 14);
+    x3 = *(q31_t *) (pState + 15);
+    acc0 = __SMLAD(x0, c0, acc0);
+    acc1 = __SMLAD(x1, c0, acc1);
+    acc2 = __SMLAD(x2, c0, acc2);
+    acc3 = __SMLAD(x3, c0, acc3);
+
+    c0 = pb[7u];
+    x0 = *(q31_t *) (pState + 16);
+    x1 = *(q31_t *) (pState + 17);
+    acc0 = __SMLAD(x2, c0, acc0);
+    acc1 = __SMLAD(x3, c0, acc1);
+    acc2 = __SMLAD(x0, c0, acc2);
+    acc3 = __SMLAD(x1, c0, acc3);
+
+    c0 = pb[8u];
+    x2 = *(q31_t *) (pState + 18);
+    x3 = *(q31_t *) (pState + 19);
+    acc0 = __SMLAD(x0, c0, acc0);
+    acc1 = __SMLAD(x1, c0, acc1);
+    acc2 = __SMLAD(x2, c0, acc2);
+    acc3 = __SMLAD(x3, c0, acc3);
+
+    c0 = pb[9u];
+    x0 = *(q31_t *) (pState + 20);
+    x1 = *(q31_t *) (pState + 21);
+    acc0 = __SMLAD(x2, c0, acc0);
+    acc1 = __SMLAD(x3, c0, acc1);
+    acc2 = __SMLAD(x0, c0, acc2);
+    acc3 = __SMLAD(x1, c0, acc3);
+
+    c0 = pb[10u];
+    x2 = *(q31_t *) (pState + 22);
+    x3 = *(q31_t *) (pState + 23);
+    acc0 = __SMLAD(x0, c0, acc0);
+    acc1 = __SMLAD(x1, c0, acc1);
+    acc2 = __SMLAD(x2, c0, acc2);
+    acc3 = __SMLAD(x3, c0, acc3);
+
+    c0 = pb[11u];
+    x0 = *(q31_t *) (pState + 24);
+    x1 = *(q31_t *) (pState + 25);
+    acc0 = __SMLAD(x2, c0, acc0);
+    acc1 = __SMLAD(x3, c0, acc1);
+    acc2 = __SMLAD(x0, c0, acc2);
+    acc3 = __SMLAD(x1, c0, acc3);
+
+    c0 = pb[12u];
+    x2 = *(q31_t *) (pState + 26);
+    x3 = *(q31_t *) (pState + 27);
+    acc0 = __SMLAD(x0, c0, acc0);
+    acc1 = __SMLAD(x1, c0, acc1);
+    acc2 = __SMLAD(x2, c0, acc2);
+    acc3 = __SMLAD(x3, c0, acc3);
+
+    c0 = pb[13u];
+    x0 = *(q31_t *) (pState + 28);
+    x1 = *(q31_t *) (pState + 29);
+    acc0 = __SMLAD(x2, c0, acc0);
+    acc1 = __SMLAD(x3, c0, acc1);
+    acc2 = __SMLAD(x0, c0, acc2);
+    acc3 = __SMLAD(x1, c0, acc3);
+
+    c0 = pb[14u];
+    x2 = *(q31_t *) (pState + 30);
+    x3 = *(q31_t *) (pState + 31);
+    acc0 = __SMLAD(x0, c0, acc0);
+    acc1 = __SMLAD(x1, c0, acc1);
+    acc2 = __SMLAD(x2, c0, acc2);
+    acc3 = __SMLAD(x3, c0, acc3);
+
+    c0 = pb[15u];
+    x0 = *(q31_t *) (pState + 32);
+    x1 = *(q31_t *) (pState + 33);
+    acc0 = __SMLAD(x2, c0, acc0);
+    acc1 = __SMLAD(x3, c0, acc1);
+    acc2 = __SMLAD(x0, c0, acc2);
+    acc3 = __SMLAD(x1, c0, acc3);
+
+    c0 = pb[16u];
+    x2 = *(q31_t *) (pState + 34);
+    x3 = *(q31_t *) (pState + 35);
+    acc0 = __SMLAD(x0, c0, acc0);
+    acc1 = __SMLAD(x1, c0, acc1);
+    acc2 = __SMLAD(x2, c0, acc2);
+    acc3 = __SMLAD(x3, c0, acc3);
+
+    c0 = pb[17u];
+    x0 = *(q31_t *) (pState + 36);
+    x1 = *(q31_t *) (pState + 37);
+    acc0 = __SMLAD(x2, c0, acc0);
+    acc1 = __SMLAD(x3, c0, acc1);
+    acc2 = __SMLAD(x0, c0, acc2);
+    acc3 = __SMLAD(x1, c0, acc3);
+
+    c0 = pb[18u];
+    x2 = *(q31_t *) (pState + 38);
+    x3 = *(q31_t *) (pState + 39);
+    acc0 = __SMLAD(x0, c0, acc0);
+    acc1 = __SMLAD(x1, c0, acc1);
+    acc2 = __SMLAD(x2, c0, acc2);
+    acc3 = __SMLAD(x3, c0, acc3);
+
+    c0 = pb[19u];
+    x0 = *(q31_t *) (pState + 40);
+    x1 = *(q31_t *) (pState + 41);
+    acc0 = __SMLAD(x2, c0, acc0);
+    acc1 = __SMLAD(x3, c0, acc1);
+    acc2 = __SMLAD(x0, c0, acc2);
+    acc3 = __SMLAD(x1, c0, acc3);
+
+    c0 = pb[20u];
+    x2 = *(q31_t *) (pState + 42);
+    x3 = *(q31_t *) (pState + 43);
+    acc0 = __SMLAD(x0, c0, acc0);
+    acc1 = __SMLAD(x1, c0, acc1);
+    acc2 = __SMLAD(x2, c0, acc2);
+    acc3 = __SMLAD(x3, c0, acc3);
+
+    c0 = pb[21u];
+    x0 = *(q31_t *) (pState + 44);
+    x1 = *(q31_t *) (pState + 45);
+    acc0 = __SMLAD(x2, c0, acc0);
+    acc1 = __SMLAD(x3, c0, acc1);
+    acc2 = __SMLAD(x0, c0, acc2);
+    acc3 = __SMLAD(x1, c0, acc3);
+
+    c0 = pb[22u];
+    x2 = *(q31_t *) (pState + 46);
+    x3 = *(q31_t *) (pState + 47);
+    acc0 = __SMLAD(x0, c0, acc0);
+    acc1 = __SMLAD(x1, c0, acc1);
+    acc2 = __SMLAD(x2, c0, acc2);
+    acc3 = __SMLAD(x3, c0, acc3);
+
+    c0 = pb[23u];
+    x0 = *(q31_t *) (pState + 48);
+    x1 = *(q31_t *) (pState + 49);
+    acc0 = __SMLAD(x2, c0, acc0);
+    acc1 = __SMLAD(x3, c0, acc1);
+    acc2 = __SMLAD(x0, c0, acc2);
+    acc3 = __SMLAD(x1, c0, acc3);
+
+    c0 = pb[24u];
+    x2 = *(q31_t *) (pState + 50);
+    x3 = *(q31_t *) (pState + 51);
+    acc0 = __SMLAD(x0, c0, acc0);
+    acc1 = __SMLAD(x1, c0, acc1);
+    acc2 = __SMLAD(x2, c0, acc2);
+    acc3 = __SMLAD(x3, c0, acc3);
+
+    c0 = pb[25u];
+    x0 = *(q31_t *) (pState + 52);
+    x1 = *(q31_t *) (pState + 53);
+    acc0 = __SMLAD(x2, c0, acc0);
+    acc1 = __SMLAD(x3, c0, acc1);
+    acc2 = __SMLAD(x0, c0, acc2);
+    acc3 = __SMLAD(x1, c0, acc3);
+
+    c0 = pb[26u];
+    x2 = *(q31_t *) (pState + 54);
+    x3 = *(q31_t *) (pState + 55);
+    acc0 = __SMLAD(x0, c0, acc0);
+    acc1 = __SMLAD(x1, c0, acc1);
+    acc2 = __SMLAD(x2, c0, acc2);
+    acc3 = __SMLAD(x3, c0, acc3);
+
+    c0 = pb[27u];
+    x0 = *(q31_t *) (pState + 56);
+    x1 = *(q31_t *) (pState + 57);
+    acc0 = __SMLAD(x2, c0, acc0);
+    acc1 = __SMLAD(x3, c0, acc1);
+    acc2 = __SMLAD(x0, c0, acc2);
+    acc3 = __SMLAD(x1, c0, acc3);
+
+    /* Store the 4 outputs */
+#ifndef ARM_MATH_BIG_ENDIAN
+
+    *__SIMD32(pDst)++ = __PKHBT((acc0 >> 15), (acc1 >> 15), 16);
+    *__SIMD32(pDst)++ = __PKHBT((acc2 >> 15), (acc3 >> 15), 16);
+
+#else
+
+    *__SIMD32(pDst)++ = __PKHBT((acc1 >> 15), (acc0 >> 15), 16);
+    *__SIMD32(pDst)++ = __PKHBT((acc3 >> 15), (acc2 >> 15), 16);
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+    pState = pState + 4;
+
+    blkCnt--;
+  }
+
+  /* Copy the last 55 samples to the start of the state buffer */
+  pStateCurnt = S->pState;
+
+  *(q31_t *) (pStateCurnt + 0) = *(q31_t *) (pState + 0);
+  *(q31_t *) (pStateCurnt + 2) = *(q31_t *) (pState + 2);
+  *(q31_t *) (pStateCurnt + 4) = *(q31_t *) (pState + 4);
+  *(q31_t *) (pStateCurnt + 6) = *(q31_t *) (pState + 6);
+  *(q31_t *) (pStateCurnt + 8) = *(q31_t *) (pState + 8);
+  *(q31_t *) (pStateCurnt + 10) = *(q31_t *) (pState + 10);
+  *(q31_t *) (pStateCurnt + 12) = *(q31_t *) (pState + 12);
+  *(q31_t *) (pStateCurnt + 14) = *(q31_t *) (pState + 14);
+  *(q31_t *) (pStateCurnt + 16) = *(q31_t *) (pState + 16);
+  *(q31_t *) (pStateCurnt + 18) = *(q31_t *) (pState + 18);
+  *(q31_t *) (pStateCurnt + 20) = *(q31_t *) (pState + 20);
+  *(q31_t *) (pStateCurnt + 22) = *(q31_t *) (pState + 22);
+  *(q31_t *) (pStateCurnt + 24) = *(q31_t *) (pState + 24);
+  *(q31_t *) (pStateCurnt + 26) = *(q31_t *) (pState + 26);
+  *(q31_t *) (pStateCurnt + 28) = *(q31_t *) (pState + 28);
+  *(q31_t *) (pStateCurnt + 30) = *(q31_t *) (pState + 30);
+  *(q31_t *) (pStateCurnt + 32) = *(q31_t *) (pState + 32);
+  *(q31_t *) (pStateCurnt + 34) = *(q31_t *) (pState + 34);
+  *(q31_t *) (pStateCurnt + 36) = *(q31_t *) (pState + 36);
+  *(q31_t *) (pStateCurnt + 38) = *(q31_t *) (pState + 38);
+  *(q31_t *) (pStateCurnt + 40) = *(q31_t *) (pState + 40);
+  *(q31_t *) (pStateCurnt + 42) = *(q31_t *) (pState + 42);
+  *(q31_t *) (pStateCurnt + 44) = *(q31_t *) (pState + 44);
+  *(q31_t *) (pStateCurnt + 46) = *(q31_t *) (pState + 46);
+  *(q31_t *) (pStateCurnt + 48) = *(q31_t *) (pState + 48);
+  *(q31_t *) (pStateCurnt + 50) = *(q31_t *) (pState + 50);
+  *(q31_t *) (pStateCurnt + 52) = *(q31_t *) (pState + 52);
+  pStateCurnt[54u] = pState[54u];
+}
+
+/**
+ * @brief Q15 FIR filter for numTaps = 56.
+ */
+
+static void arm_fir_q15_56(
+  const arm_fir_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pState = S->pState;                     /* State pointer */
+  q31_t *pb = (q31_t *) S->pCoeffs;              /* Coefficient pairs */
+  q15_t *pStateCurnt;                            /* Points to the current sample of the state */
+  q31_t x0, x1, x2, x3, c0;                      /* State and coefficient pairs */
+  q63_t acc0, acc1, acc2, acc3;                  /* Accumulators */
+  uint32_t blkCnt;                               /* Loop counter */
+
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = &(S->pState[55u]);
+
+  /* Compute 4 outputs at a time */
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    /* Copy four new input samples into the state buffer */
+    *__SIMD32(pStateCurnt)++ = *__SIMD32(pSrc)++;
+    *__SIMD32(pStateCurnt)++ = *__SIMD32(pSrc)++;
+
+    acc0 = 0;
+    acc1 = 0;
+    acc2 = 0;
+    acc3 = 0;
+
+    x0 = *(q31_t *) (pState + 0);
+    x1 = *(q31_t *) (pState + 1);
+
+    c0 = pb[0u];
+    x2 = *(q31_t *) (pState + 2);
+    x3 = *(q31_t *) (pState + 3);
+    acc0 = __SMLALD(x0, c0, acc0);
+    acc1 = __SMLALD(x1, c0, acc1);
+    acc2 = __SMLALD(x2, c0, acc2);
+    acc3 = __SMLALD(x3, c0, acc3);
+
+    c0 = pb[1u];
+    x0 = *(q31_t *) (pState + 4);
+    x1 = *(q31_t *) (pState + 5);
+    acc0 = __SMLALD(x2, c0, acc0);
+    acc1 = __SMLALD(x3, c0, acc1);
+    acc2 = __SMLALD(x0, c0, acc2);
+    acc3 = __SMLALD(x1, c0, acc3);
+
+    c0 = pb[2u];
+    x2 = *(q31_t *) (pState + 6);
+    x3 = *(q31_t *) (pState + 7);
+    acc0 = __SMLALD(x0, c0, acc0);
+    acc1 = __SMLALD(x1, c0, acc1);
+    acc2 = __SMLALD(x2, c0, acc2);
+    acc3 = __SMLALD(x3, c0, acc3);
+
+    c0 = pb[3u];
+    x0 = *(q31_t *) (pState + 8);
+    x1 = *(q31_t *) (pState + 9);
+    acc0 = __SMLALD(x2, c0, acc0);
+    acc1 = __SMLALD(x3, c0, acc1);
+    acc2 = __SMLALD(x0, c0, acc2);
+    acc3 = __SMLALD(x1, c0, acc3);
+
+    c0 = pb[4u];
+    x2 = *(q31_t *) (pState + 10);
+    x3 = *(q31_t *) (pState + 11);
+    acc0 = __SMLALD(x0, c0, acc0);
+    acc1 = __SMLALD(x1, c0, acc1);
+    acc2 = __SMLALD(x2, c0, acc2);
+    acc3 = __SMLALD(x3, c0, acc3);
+
+    c0 = pb[5u];
+    x0 = *(q31_t *) (pState + 12);
+    x1 = *(q31_t *) (pState + 13);
+    acc0 = __SMLALD(x2, c0, acc0);
+    acc1 = __SMLALD(x3, c0, acc1);
+    acc2 = __SMLALD(x0, c0, acc2);
+    acc3 = __SMLALD(x1, c0, acc3);
+
+    c0 = pb[6u];
+    x2 = *(q31_t *) (pState + 14);
+    x3 = *(q31_t *) (pState + 15);
+    acc0 = __SMLALD(x0, c0, acc0);
+    acc1 = __SMLALD(x1, c0, acc1);
+    acc2 = __SMLALD(x2, c0, acc2);
+    acc3 = __SMLALD(x3, c0, acc3);
+
+    c0 = pb[7u];
+    x0 = *(q31_t *) (pState + 16);
+    x1 = *(q31_t *) (pState + 17);
+    acc0 = __SMLALD(x2, c0, acc0);
+    acc1 = __SMLALD(x3, c0, acc1);
+    acc2 = __SMLALD(x0, c0, acc2);
+    acc3 = __SMLALD(x1, c0, acc3);
+
+    c0 = pb[8u];
+    x2 = *(q31_t *) (pState + 18);
+    x3 = *(q31_t *) (pState + 19);
+    acc0 = __SMLALD(x0, c0, acc0);
+    acc1 = __SMLALD(x1, c0, acc1);
+    acc2 = __SMLALD(x2, c0, acc2);
+    acc3 = __SMLALD(x3, c0, acc3);
+
+    c0 = pb[9u];
+    x0 = *(q31_t *) (pState + 20);
+    x1 = *(q31_t *) (pState + 21);
+    acc0 = __SMLALD(x2, c0, acc0);
+    acc1 = __SMLALD(x3, c0, acc1);
+    acc2 = __SMLALD(x0, c0, acc2);
+    acc3 = __SMLALD(x1, c0, acc3);
+
+    c0 = pb[10u];
+    x2 = *(q31_t *) (pState + 22);
+    x3 = *(q31_t *) (pState + 23);
+    acc0 = __SMLALD(x0, c0, acc0);
+    acc1 = __SMLALD(x1, c0, acc1);
+    acc2 = __SMLALD(x2, c0, acc2);
+    acc3 = __SMLALD(x3, c0, acc3);
+
+    c0 = pb[11u];
+    x0 = *(q31_t *) (pState + 24);
+    x1 = *(q31_t *) (pState + 25);
+    acc0 = __SMLALD(x2, c0, acc0);
+    acc1 = __SMLALD(x3, c0, acc1);
+    acc2 = __SMLALD(x0, c0, acc2);
+    acc3 = __SMLALD(x1, c0, acc3);
+
+    c0 = pb[12u];
+    x2 = *(q31_t *) (pState + 26);
+    x3 = *(q31_t *) (pState + 27);
+    acc0 = __SMLALD(x0, c0, acc0);
+    acc1 = __SMLALD(x1, c0, acc1);
+    acc2 = __SMLALD(x2, c0, acc2);
+    acc3 = __SMLALD(x3, c0, acc3);
+
+    c0 = pb[13u];
+    x0 = *(q31_t *) (pState + 28);
+    x1 = *(q31_t *) (pState + 29);
+    acc0 = __SMLALD(x2, c0, acc0);
+    acc1 = __SMLALD(x3, c0, acc1);
+    acc2 = __SMLALD(x0, c0, acc2);
+    acc3 = __SMLALD(x1, c0, acc3);
+
+    c0 = pb[14u];
+    x2 = *(q31_t *) (pState + 30);
+    x3 = *(q31_t *) (pState + 31);
+    acc0 = __SMLALD(x0, c0, acc0);
+    acc1 = __SMLALD(x1, c0, acc1);
+    acc2 = __SMLALD(x2, c0, acc2);
+    acc3 = __SMLALD(x3, c0, acc3);
+
+    c0 = pb[15u];
+    x0 = *(q31_t *) (pState + 32);
+    x1 = *(q31_t *) (pState + 33);
+    acc0 = __SMLALD(x2, c0, acc0);
+    acc1 = __SMLALD(x3, c0, acc1);
+    acc2 = __SMLALD(x0, c0, acc2);
+    acc3 = __SMLALD(x1, c0, acc3);
+
+    c0 = pb[16u];
+    x2 = *(q31_t *) (pState + 34);
+    x3 = *(q31_t *) (pState + 35);
+    acc0 = __SMLALD(x0, c0, acc0);
+    acc1 = __SMLALD(x1, c0, acc1);
+    acc2 = __SMLALD(x2, c0, acc2);
+    acc3 = __SMLALD(x3, c0, acc3);
+
+    c0 = pb[17u];
+    x0 = *(q31_t *) (pState + 36);
+    x1 = *(q31_t *) (pState + 37);
+    acc0 = __SMLALD(x2, c0, acc0);
+    acc1 = __SMLALD(x3, c0, acc1);
+    acc2 = __SMLALD(x0, c0, acc2);
+    acc3 = __SMLALD(x1, c0, acc3);
+
+    c0 = pb[18u];
+    x2 = *(q31_t *) (pState + 38);
+    x3 = *(q31_t *) (pState + 39);
+    acc0 = __SMLALD(x0, c0, acc0);
+    acc1 = __SMLALD(x1, c0, acc1);
+    acc2 = __SMLALD(x2, c0, acc2);
+    acc3 = __SMLALD(x3, c0, acc3);
+
+    c0 = pb[19u];
+    x0 = *(q31_t *) (pState + 40);
+    x1 = *(q31_t *) (pState + 41);
+    acc0 = __SMLALD(x2, c0, acc0);
+    acc1 = __SMLALD(x3, c0, acc1);
+    acc2 = __SMLALD(x0, c0, acc2);
+    acc3 = __SMLALD(x1, c0, acc3);
+
+    c0 = pb[20u];
+    x2 = *(q31_t *) (pState + 42);
+    x3 = *(q31_t *) (pState + 43);
+    acc0 = __SMLALD(x0, c0, acc0);
+    acc1 = __SMLALD(x1, c0, acc1);
+    acc2 = __SMLALD(x2, c0, acc2);
+    acc3 = __SMLALD(x3, c0, acc3);
+
+    c0 = pb[21u];
+    x0 = *(q31_t *) (pState + 44);
+    x1 = *(q31_t *) (pState + 45);
+    acc0 = __SMLALD(x2, c0, acc0);
+    acc1 = __SMLALD(x3, c0, acc1);
+    acc2 = __SMLALD(x0, c0, acc2);
+    acc3 = __SMLALD(x1, c0, acc3);
+
+    c0 = pb[22u];
+    x2 = *(q31_t *) (pState + 46);
+    x3 = *(q31_t *) (pState + 47);
+    acc0 = __SMLALD(x0, c0, acc0);
+    acc1 = __SMLALD(x1, c0, acc1);
+    acc2 = __SMLALD(x2, c0, acc2);
+    acc3 = __SMLALD(x3, c0, acc3);
+
+    c0 = pb[23u];
+    x0 = *(q31_t *) (pState + 48);
+    x1 = *(q31_t *) (pState + 49);
+    acc0 = __SMLALD(x2, c0, acc0);
+    acc1 = __SMLALD(x3, c0, acc1);
+    acc2 = __SMLALD(x0, c0, acc2);
+    acc3 = __SMLALD(x1, c0, acc3);
+
+    c0 = pb[24u];
+    x2 = *(q31_t *) (pState + 50);
+    x3 = *(q31_t *) (pState + 51);
+    acc0 = __SMLALD(x0, c0, acc0);
+    acc1 = __SMLALD(x1, c0, acc1);
+    acc2 = __SMLALD(x2, c0, acc2);
+    acc3 = __SMLALD(x3, c0, acc3);
+
+    c0 = pb[25u];
+    x0 = *(q31_t *) (pState + 52);
+    x1 = *(q31_t *) (pState + 53);
+    acc0 = __SMLALD(x2, c0, acc0);
+    acc1 = __SMLALD(x3, c0, acc1);
+    acc2 = __SMLALD(x0, c0, acc2);
+    acc3 = __SMLALD(x1, c0, acc3);
+
+    c0 = pb[26u];
+    x2 = *(q31_t *) (pState + 54);
+    x3 = *(q31_t *) (pState + 55);
+    acc0 = __SMLALD(x0, c0, acc0);
+    acc1 = __SMLALD(x1, c0, acc1);
+    acc2 = __SMLALD(x2, c0, acc2);
+    acc3 = __SMLALD(x3, c0, acc3);
+
+    c0 = pb[27u];
+    x0 = *(q31_t *) (pState + 56);
+    x1 = *(q31_t *) (pState + 57);
+    acc0 = __SMLALD(x2, c0, acc0);
+    acc1 = __SMLALD(x3, c0, acc1);
+    acc2 = __SMLALD(x0, c0, acc2);
+    acc3 = __SMLALD(x1, c0, acc3);
+
+    /* Store the 4 outputs */
+#ifndef ARM_MATH_BIG_ENDIAN
+
+    *__SIMD32(pDst)++ = __PKHBT(__SSAT((acc0 >> 15), 16), __SSAT((acc1 >> 15), 16), 16);
+    *__SIMD32(pDst)++ = __PKHBT(__SSAT((acc2 >> 15), 16), __SSAT((acc3 >> 15), 16), 16);
+
+#else
+
+    *__SIMD32(pDst)++ = __PKHBT(__SSAT((acc1 >> 15), 16), __SSAT((acc0 >> 15), 16), 16);
+    *__SIMD32(pDst)++ = __PKHBT(__SSAT((acc3 >> 15), 16), __SSAT((acc2 >> 15), 16), 16);
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+    pState = pState + 4;
+
+    blkCnt--;
+  }
+
+  /* Compute the remaining 1 to 3 outputs */
+  blkCnt = blockSize % 0x4u;
+
+  while(blkCnt > 0u)
+  {
+    *pStateCurnt++ = *pSrc++;
+
+    acc0 = 0;
+
+    acc0 = __SMLALD(*(q31_t *) (pState + 0), pb[0u], acc0);
+    acc0 = __SMLALD(*(q31_t *) (pState + 2), pb[1u], acc0);
+    acc0 = __SMLALD(*(q31_t *) (pState + 4), pb[2u], acc0);
+    acc0 = __SMLALD(*(q31_t *) (pState + 6), pb[3u], acc0);
+    acc0 = __SMLALD(*(q31_t *) (pState + 8), pb[4u], acc0);
+    acc0 = __SMLALD(*(q31_t *) (pState + 10), pb[5u], acc0);
+    acc0 = __SMLALD(*(q31_t *) (pState + 12), pb[6u], acc0);
+    acc0 = __SMLALD(*(q31_t *) (pState + 14), pb[7u], acc0);
+    acc0 = __SMLALD(*(q31_t *) (pState + 16), pb[8u], acc0);
+    acc0 = __SMLALD(*(q31_t *) (pState + 18), pb[9u], acc0);
+    acc0 = __SMLALD(*(q31_t *) (pState + 20), pb[10u], acc0);
+    acc0 = __SMLALD(*(q31_t *) (pState + 22), pb[11u], acc0);
+    acc0 = __SMLALD(*(q31_t *) (pState + 24), pb[12u], acc0);
+    acc0 = __SMLALD(*(q31_t *) (pState + 26), pb[13u], acc0);
+    acc0 = __SMLALD(*(q31_t *) (pState + 28), pb[14u], acc0);
+    acc0 = __SMLALD(*(q31_t *) (pState + 30), pb[15u], acc0);
+    acc0 = __SMLALD(*(q31_t *) (pState + 32), pb[16u], acc0);
+    acc0 = __SMLALD(*(q31_t *) (pState + 34), pb[17u], acc0);
+    acc0 = __SMLALD(*(q31_t *) (pState + 36), pb[18u], acc0);
+    acc0 = __SMLALD(*(q31_t *) (pState + 38), pb[19u], acc0);
+    acc0 = __SMLALD(*(q31_t *) (pState + 40), pb[20u], acc0);
+    acc0 = __SMLALD(*(q31_t *) (pState + 42), pb[21u], acc0);
+    acc0 = __SMLALD(*(q31_t *) (pState + 44), pb[22u], acc0);
+    acc0 = __SMLALD(*(q31_t *) (pState + 46), pb[23u], acc0);
+    acc0 = __SMLALD(*(q31_t *) (pState + 48), pb[24u], acc0);
+    acc0 = __SMLALD(*(q31_t *) (pState + 50), pb[25u], acc0);
+    acc0 = __SMLALD(*(q31_t *) (pState + 52), pb[26u], acc0);
+    acc0 = __SMLALD(*(q31_t *) (pState + 54), pb[27u], acc0);
+
+    *pDst++ = (q15_t) (__SSAT((acc0 >> 15), 16));
+
+    pState = pState + 1;
+
+    blkCnt--;
+  }
+
+  /* Copy the last 55 samples to the start of the state buffer */
+  pStateCurnt = S->pState;
+
+  *(q31_t *) (pStateCurnt + 0) = *(q31_t *) (pState + 0);
+  *(q31_t *) (pStateCurnt + 2) = *(q31_t *) (pState + 2);
+  *(q31_t *) (pStateCurnt + 4) = *(q31_t *) (pState + 4);
+  *(q31_t *) (pStateCurnt + 6) = *(q31_t *) (pState + 6);
+  *(q31_t *) (pStateCurnt + 8) = *(q31_t *) (pState + 8);
+  *(q31_t *) (pStateCurnt + 10) = *(q31_t *) (pState + 10);
+  *(q31_t *) (pStateCurnt + 12) = *(q31_t *) (pState + 12);
+  *(q31_t *) (pStateCurnt + 14) = *(q31_t *) (pState + 14);
+  *(q31_t *) (pStateCurnt + 16) = *(q31_t *) (pState + 16);
+  *(q31_t *) (pStateCurnt + 18) = *(q31_t *) (pState + 18);
+  *(q31_t *) (pStateCurnt + 20) = *(q31_t *) (pState + 20);
+  *(q31_t *) (pStateCurnt + 22) = *(q31_t *) (pState + 22);
+  *(q31_t *) (pStateCurnt + 24) = *(q31_t *) (pState + 24);
+  *(q31_t *) (pStateCurnt + 26) = *(q31_t *) (pState + 26);
+  *(q31_t *) (pStateCurnt + 28) = *(q31_t *) (pState + 28);
+  *(q31_t *) (pStateCurnt + 30) = *(q31_t *) (pState + 30);
+  *(q31_t *) (pStateCurnt + 32) = *(q31_t *) (pState + 32);
+  *(q31_t *) (pStateCurnt + 34) = *(q31_t *) (pState + 34);
+  *(q31_t *) (pStateCurnt + 36) = *(q31_t *) (pState + 36);
+  *(q31_t *) (pStateCurnt + 38) = *(q31_t *) (pState + 38);
+  *(q31_t *) (pStateCurnt + 40) = *(q31_t *) (pState + 40);
+  *(q31_t *) (pStateCurnt + 42) = *(q31_t *) (pState + 42);
+  *(q31_t *) (pStateCurnt + 44) = *(q31_t *) (pState + 44);
+  *(q31_t *) (pStateCurnt + 46) = *(q31_t *) (pState + 46);
+  *(q31_t *) (pStateCurnt + 48) = *(q31_t *) (pState + 48);
+  *(q31_t *) (pStateCurnt + 50) = *(q31_t *) (pState + 50);
+  *(q31_t *) (pStateCurnt + 52) = *(q31_t *) (pState + 52);
+  pStateCurnt[54u] = pState[54u];
+}
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+/**
+ * @brief Runs the generated kernel of <code>arm_fir_q15()</code> for this instance, if any.
+ * @param[in]  *S points to an instance of the Q15 FIR filter structure.
+ * @param[in]  *pSrc points to the block of input data.
+ * @param[out] *pDst points to the block of output data.
+ * @param[in]  blockSize number of samples to process per call.
+ * @return     ARM_MATH_SUCCESS if a kernel processed the block, ARM_MATH_ARGUMENT_ERROR if
+ * there is none for <code>numTaps</code> and <code>blockSize</code>.  Nothing is done then.
+ */
+
+arm_status arm_fir_fixed_q15(
+  const arm_fir_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+#ifndef ARM_MATH_CM0
+
+  if(S->numTaps == 56u)
+  {
+    arm_fir_q15_56(S, pSrc, pDst, blockSize);
+    return (ARM_MATH_SUCCESS);
+  }
+
+#else
+
+  /* No kernel is generated for Cortex-M0 */
+  (void) S;
+  (void) pSrc;
+  (void) pDst;
+  (void) blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  return (ARM_MATH_ARGUMENT_ERROR);
+}
+
+/**
+ * @brief Runs the generated kernel of <code>arm_fir_fast_q15()</code> for this instance, if any.
+ * @param[in]  *S points to an instance of the Q15 FIR filter structure.
+ * @param[in]  *pSrc points to the block of input data.
+ * @param[out] *pDst points to the block of output data.
+ * @param[in]  blockSize number of samples to process per call.
+ * @return     ARM_MATH_SUCCESS if a kernel processed the block, ARM_MATH_ARGUMENT_ERROR if
+ * there is none for <code>numTaps</code> and <code>blockSize</code>.  Nothing is done then.
+ */
+
+arm_status arm_fir_fixed_fast_q15(
+  const arm_fir_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+#ifndef ARM_MATH_CM0
+
+  if((S->numTaps == 56u) && (blockSize == 512u))
+  {
+    arm_fir_fast_q15_56x512(S, pSrc, pDst);
+    return (ARM_MATH_SUCCESS);
+  }
+
+#else
+
+  /* No kernel is generated for Cortex-M0 */
+  (void) S;
+  (void) pSrc;
+  (void) pDst;
+  (void) blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  return (ARM_MATH_ARGUMENT_ERROR);
+}
+
+/**
+ * @} end of FIR group
+ */
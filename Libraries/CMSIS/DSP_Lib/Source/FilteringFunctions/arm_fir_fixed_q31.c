@@ -0,0 +1,53 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_fixed_q31.c
+*
+* Description:	Q31 FIR kernels specialized for fixed tap counts.
+*
+*               GENERATED by Scripts/arm_fir_fixed_gen.py from
+*               Scripts/arm_fir_fixed.cfg.  Do not edit.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR
+ * @{
+ */
+
+/**
+ * @brief Runs the generated kernel of <code>arm_fir_q31()</code> for this instance, if any.
+ * @param[in]  *S points to an instance of the Q31 FIR filter structure.
+ * @param[in]  *pSrc points to the block of input data.
+ * @param[out] *pDst points to the block of output data.
+ * @param[in]  blockSize number of samples to process per call.
+ * @return     ARM_MATH_SUCCESS if a kernel processed the block, ARM_MATH_ARGUMENT_ERROR if
+ * there is none for <code>numTaps</code> and <code>blockSize</code>.  Nothing is done then.
+ */
+
+arm_status arm_fir_fixed_q31(
+  const arm_fir_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  /* No kernel is generated for this type */
+  (void) S;
+  (void) pSrc;
+  (void) pDst;
+  (void) blockSize;
+
+  return (ARM_MATH_ARGUMENT_ERROR);
+}
+
+/**
+ * @} end of FIR group
+ */
@@ -0,0 +1,273 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_halfband_decimate_f32.c
+*
+* Description:	Floating-point half-band FIR decimator processing function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup FIR_Halfband Half-Band FIR Decimator and Interpolator
+ *
+ * These functions decimate and interpolate by 2 with a half-band lowpass filter: a symmetric
+ * filter of <code>numTaps=4k+3</code> coefficients, cutoff at a quarter of the sample rate,
+ * whose coefficients at an even distance from the center are zero.  Apart from the center
+ * coefficient <code>h[2k+1]</code> only the even coefficients <code>h[0], h[2], ..., h[4k+2]</code>
+ * are non-zero, and they are symmetric.  The functions skip the zero coefficients and add the
+ * samples of each symmetric pair before multiplying, so they need <code>k+2</code> multiplications
+ * per output of the decimator and per input of the interpolator (for 2 outputs), about a quarter of
+ * \ref FIR_decimate and half of \ref FIR_Interpolate.
+ *
+ * \par
+ * <code>pCoeffs</code> points to the <code>k+2 = (numTaps+5)/4</code> non-zero coefficients of the first half and the center:
+ * <pre>
+ *     {h[0], h[2], ..., h[2k], h[2k+1]}
+ * </pre>
+ * The coefficients in between are taken as zero whatever the filter design gives for them.
+ *
+ * \par
+ * The decimator computes the same outputs as \ref FIR_decimate with the full coefficient array and <code>M=2</code>:
+ * output <code>n</code> is the filter output at the input sample <code>x[2n]</code>.  It keeps the even
+ * and the odd input samples in two separate parts of the state, so that the samples of the even
+ * coefficients are adjacent.  <code>pState</code> points to a state array of size <code>numTaps + blockSize - 1</code>,
+ * and <code>blockSize</code> must be even.
+ *
+ * \par
+ * The interpolator computes the same outputs as \ref FIR_Interpolate with <code>L=2</code>: the output
+ * for the input <code>x[n]</code> is
+ * <pre>
+ *     y[2n]   = h[0] * x[n] + h[2] * x[n-1] + ... + h[4k+2] * x[n-2k-1]
+ *     y[2n+1] = h[2k+1] * x[n-k]
+ * </pre>
+ * <code>pState</code> points to a state array of size <code>(numTaps-1)/2 + blockSize</code>.
+ * An interpolator filter has a DC gain of 2, so its center coefficient is 1.0: for the fixed-point
+ * versions the coefficients are scaled by 1/2 and so is the output, as with \ref FIR_Interpolate.
+ *
+ * \par Instance Structure
+ * The coefficients and state variables for a filter are stored together in an instance data structure.
+ * A separate instance structure must be defined for each filter.
+ * Coefficient arrays may be shared among several instances while state variable arrays cannot be shared.
+ *
+ * \par Initialization Functions
+ * There is also an associated initialization function for each data type.
+ * The initialization function performs the following operations:
+ * - Sets the values of the internal structure fields.
+ * - Zeros out the values in the state buffer.
+ * - Checks that <code>numTaps</code> is of the form <code>4k+3</code> and, for the decimators, that <code>blockSize</code> is even.
+ * \par
+ * To statically initialize the instance structures, clear the state buffer and use
+ * <pre>
+ *     arm_fir_halfband_decimate_instance_f32 S1 = {numTaps, pCoeffs, pState};
+ *     arm_fir_halfband_interpolate_instance_f32 S2 = {numTaps, pCoeffs, pState};
+ * </pre>
+ *
+ * \par Fixed-Point Behavior
+ * As for \ref FIR_Symmetric, the Q31 and Q15 functions add the two samples of each pair with
+ * saturation and use 64-bit accumulators.  When the input is scaled down by 1 bit the outputs are the
+ * same as those of the general decimators and interpolators.
+ */
+
+/**
+ * @addtogroup FIR_Halfband
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point half-band FIR decimator.
+ * @param[in]  *S        points to an instance of the floating-point half-band FIR decimator structure.
+ * @param[in]  *pSrc     points to the block of input data.
+ * @param[out] *pDst     points to the block of output data, <code>blockSize/2</code> values.
+ * @param[in]  blockSize number of input samples to process per call, even.
+ * @return     none.
+ *
+ * \par
+ * The state holds the <code>2k+1</code> previous even samples followed by the even samples of the block,
+ * then the <code>k+1</code> previous odd samples followed by the odd samples of the block.
+ * Between the calls the two histories are at the start of the state.
+ */
+
+void arm_fir_halfband_decimate_f32(
+  const arm_fir_halfband_decimate_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  uint32_t evenHist = (S->numTaps - 1u) >> 1u;   /* Previous even samples, 2k+1 */
+  uint32_t pairs = (S->numTaps + 1u) >> 2u;      /* Non-zero coefficient pairs, k+1 */
+  uint32_t outCnt = blockSize >> 1u;             /* Number of outputs */
+  float32_t *pEven = S->pState;                  /* Even samples */
+  float32_t *pOdd = pEven + evenHist + outCnt;   /* Odd samples */
+  float32_t *pStateCurnt, *pOddCurnt;            /* Copy pointers */
+  float32_t *px, *pe, *pb;                       /* Front and back of the window, coefficient pointer */
+  float32_t acc0, hc;                            /* Accumulator and center coefficient */
+  uint32_t tapCnt, blkCnt;                       /* Loop counters */
+
+  /* Move the k+1 previous odd samples after the room for the even samples of this block */
+  tapCnt = pairs;
+  pStateCurnt = S->pState + evenHist + tapCnt;
+  pOddCurnt = pOdd + tapCnt;
+
+  while(tapCnt > 0u)
+  {
+    *--pOddCurnt = *--pStateCurnt;
+    tapCnt--;
+  }
+
+  /* Split the input samples between the two phases */
+  pStateCurnt = pEven + evenHist;
+  pOddCurnt = pOdd + pairs;
+  blkCnt = outCnt;
+
+  while(blkCnt > 0u)
+  {
+    *pStateCurnt++ = *pSrc++;
+    *pOddCurnt++ = *pSrc++;
+    blkCnt--;
+  }
+
+  hc = pCoeffs[pairs];
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  {
+    float32_t acc1, acc2, acc3;                  /* Accumulators */
+    float32_t c0;                                /* Coefficient */
+    float32_t f0, f1, f2, f3;                    /* Front samples of the 4 windows */
+    float32_t b0, b1, b2, b3;                    /* Back samples of the 4 windows */
+
+    /* Apply loop unrolling and compute 4 output values simultaneously,
+     * as in arm_fir_sym_f32() on the even samples */
+    blkCnt = outCnt >> 2u;
+
+    while(blkCnt > 0u)
+    {
+      px = pEven;
+      pe = pEven + evenHist;
+      pb = pCoeffs;
+
+      /* Center coefficient on the odd samples */
+      acc0 = hc * pOdd[0];
+      acc1 = hc * pOdd[1];
+      acc2 = hc * pOdd[2];
+      acc3 = hc * pOdd[3];
+
+      f0 = px[0];
+      f1 = px[1];
+      f2 = px[2];
+      b1 = pe[1];
+      b2 = pe[2];
+      b3 = pe[3];
+
+      tapCnt = pairs;
+
+      while(tapCnt > 0u)
+      {
+        c0 = *pb++;
+        f3 = px[3];
+        b0 = *pe;
+
+        acc0 += c0 * (f0 + b0);
+        acc1 += c0 * (f1 + b1);
+        acc2 += c0 * (f2 + b2);
+        acc3 += c0 * (f3 + b3);
+
+        f0 = f1;
+        f1 = f2;
+        f2 = f3;
+        b3 = b2;
+        b2 = b1;
+        b1 = b0;
+
+        px++;
+        pe--;
+
+        tapCnt--;
+      }
+
+      *pDst++ = acc0;
+      *pDst++ = acc1;
+      *pDst++ = acc2;
+      *pDst++ = acc3;
+
+      pEven += 4u;
+      pOdd += 4u;
+
+      blkCnt--;
+    }
+
+    /* If the number of outputs is not a multiple of 4, compute the remaining ones here. */
+    blkCnt = outCnt & 0x3u;
+  }
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  blkCnt = outCnt;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    px = pEven;
+    pe = pEven + evenHist;
+    pb = pCoeffs;
+
+    /* y[n] = h[2k+1] * x[2n-2k-1] + sum(h[2i] * (x[2n-2i] + x[2n-4k-2+2i])) */
+    acc0 = hc * *pOdd;
+
+    tapCnt = pairs;
+
+    while(tapCnt > 0u)
+    {
+      acc0 += *pb++ * (*px++ + *pe--);
+      tapCnt--;
+    }
+
+    *pDst++ = acc0;
+
+    pEven++;
+    pOdd++;
+
+    blkCnt--;
+  }
+
+  /* Processing is complete.
+   ** Copy the last 2k+1 even samples and the last k+1 odd samples to the start of the state buffer,
+   ** one after the other.  The even samples are copied first: the odd samples are after them. */
+  pStateCurnt = S->pState;
+  tapCnt = evenHist;
+
+  while(tapCnt > 0u)
+  {
+    *pStateCurnt++ = *pEven++;
+    tapCnt--;
+  }
+
+  tapCnt = pairs;
+
+  while(tapCnt > 0u)
+  {
+    *pStateCurnt++ = *pOdd++;
+    tapCnt--;
+  }
+}
+
+/**
+ * @} end of FIR_Halfband group
+ */
@@ -0,0 +1,212 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_halfband_decimate_q15.c
+*
+* Description:	Q15 half-band FIR decimator processing function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Halfband
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q15 half-band FIR decimator.
+ * @param[in]  *S        points to an instance of the Q15 half-band FIR decimator structure.
+ * @param[in]  *pSrc     points to the block of input data.
+ * @param[out] *pDst     points to the block of output data, <code>blockSize/2</code> values.
+ * @param[in]  blockSize number of input samples to process per call, even.
+ * @return     none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The two samples of each coefficient pair are added with saturation to 1.15 format, two pairs at a
+ * time with <code>__QADD16</code>, and accumulated with <code>__SMLALD</code> into a 64-bit accumulator in
+ * 34.30 format, as <code>arm_fir_decimate_q15()</code>.  The result is shifted right by 15 bits, truncated
+ * and saturated to 1.15 format.
+ * The state is arranged as for <code>arm_fir_halfband_decimate_f32()</code>.
+ */
+
+void arm_fir_halfband_decimate_q15(
+  const arm_fir_halfband_decimate_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  uint32_t evenHist = (S->numTaps - 1u) >> 1u;   /* Previous even samples, 2k+1 */
+  uint32_t pairs = (S->numTaps + 1u) >> 2u;      /* Non-zero coefficient pairs, k+1 */
+  uint32_t outCnt = blockSize >> 1u;             /* Number of outputs */
+  q15_t *pEven = S->pState;                      /* Even samples */
+  q15_t *pOdd = pEven + evenHist + outCnt;       /* Odd samples */
+  q15_t *pStateCurnt, *pOddCurnt;                /* Copy pointers */
+  q15_t *px, *pe, *pb;                           /* Front and back of the window, coefficient pointer */
+  q63_t acc0;                                    /* Accumulator */
+  q15_t hc;                                      /* Center coefficient */
+  uint32_t tapCnt, blkCnt;                       /* Loop counters */
+
+  /* Move the k+1 previous odd samples after the room for the even samples of this block */
+  tapCnt = pairs;
+  pStateCurnt = S->pState + evenHist + tapCnt;
+  pOddCurnt = pOdd + tapCnt;
+
+  while(tapCnt > 0u)
+  {
+    *--pOddCurnt = *--pStateCurnt;
+    tapCnt--;
+  }
+
+  /* Split the input samples between the two phases */
+  pStateCurnt = pEven + evenHist;
+  pOddCurnt = pOdd + pairs;
+  blkCnt = outCnt;
+
+  while(blkCnt > 0u)
+  {
+    *pStateCurnt++ = *pSrc++;
+    *pOddCurnt++ = *pSrc++;
+    blkCnt--;
+  }
+
+  hc = pCoeffs[pairs];
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  {
+    q63_t acc1;                                  /* Accumulator */
+    q31_t c01;                                   /* Packed coefficients h[2i], h[2i+2] */
+    q31_t front, back;                           /* Packed samples from both ends of the window */
+
+    /* Apply loop unrolling and compute 2 output values simultaneously,
+     * as in arm_fir_sym_q15() on the even samples: the coefficients are read two at a time,
+     * with the samples of both ends of the window, the back word with its halfwords swapped. */
+    blkCnt = outCnt >> 1u;
+
+    while(blkCnt > 0u)
+    {
+      px = pEven;
+      pe = pEven + (evenHist - 1u);
+      pb = pCoeffs;
+
+      /* Center coefficient on the odd samples */
+      acc0 = (q31_t) hc *pOdd[0];
+      acc1 = (q31_t) hc *pOdd[1];
+
+      tapCnt = pairs >> 1u;
+
+      while(tapCnt > 0u)
+      {
+        c01 = *__SIMD32(pb)++;
+
+        /* First output */
+        front = *__SIMD32(px);
+        back = *__SIMD32(pe);
+        back = (q31_t) (((uint32_t) back >> 16) | ((uint32_t) back << 16));
+        acc0 = __SMLALD(c01, __QADD16(front, back), acc0);
+
+        /* Second output: the window one even sample later */
+        front = *(q31_t *) (px + 1);
+        back = *(q31_t *) (pe + 1);
+        back = (q31_t) (((uint32_t) back >> 16) | ((uint32_t) back << 16));
+        acc1 = __SMLALD(c01, __QADD16(front, back), acc1);
+
+        px += 2u;
+        pe -= 2;
+
+        tapCnt--;
+      }
+
+      /* The last pair if the number of pairs is odd: back of its window is pe[1] */
+      if((pairs & 0x1u) != 0u)
+      {
+        acc0 += (q31_t) * pb * (q31_t) clip_q31_to_q15((q31_t) px[0] + pe[1]);
+        acc1 += (q31_t) * pb * (q31_t) clip_q31_to_q15((q31_t) px[1] + pe[2]);
+      }
+
+      /* The results are in 34.30 format; convert them to 1.15 with saturation */
+      *pDst++ = (q15_t) (__SSAT((acc0 >> 15), 16));
+      *pDst++ = (q15_t) (__SSAT((acc1 >> 15), 16));
+
+      pEven += 2u;
+      pOdd += 2u;
+
+      blkCnt--;
+    }
+
+    /* Compute the last output if the number of outputs is odd */
+    blkCnt = outCnt & 0x1u;
+  }
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  blkCnt = outCnt;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    px = pEven;
+    pe = pEven + evenHist;
+    pb = pCoeffs;
+
+    /* y[n] = h[2k+1] * x[2n-2k-1] + sum(h[2i] * (x[2n-2i] + x[2n-4k-2+2i])) */
+    acc0 = (q31_t) hc * *pOdd;
+
+    tapCnt = pairs;
+
+    while(tapCnt > 0u)
+    {
+      acc0 += (q31_t) * pb++ * (q31_t) clip_q31_to_q15((q31_t) * px++ + *pe--);
+      tapCnt--;
+    }
+
+    /* The result is in 34.30 format; convert it to 1.15 with saturation */
+    *pDst++ = (q15_t) (__SSAT((acc0 >> 15), 16));
+
+    pEven++;
+    pOdd++;
+
+    blkCnt--;
+  }
+
+  /* Processing is complete.
+   ** Copy the last 2k+1 even samples and the last k+1 odd samples to the start of the state buffer,
+   ** one after the other.  The even samples are copied first: the odd samples are after them. */
+  pStateCurnt = S->pState;
+  tapCnt = evenHist;
+
+  while(tapCnt > 0u)
+  {
+    *pStateCurnt++ = *pEven++;
+    tapCnt--;
+  }
+
+  tapCnt = pairs;
+
+  while(tapCnt > 0u)
+  {
+    *pStateCurnt++ = *pOdd++;
+    tapCnt--;
+  }
+}
+
+/**
+ * @} end of FIR_Halfband group
+ */
@@ -0,0 +1,203 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_halfband_decimate_q31.c
+*
+* Description:	Q31 half-band FIR decimator processing function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Halfband
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q31 half-band FIR decimator.
+ * @param[in]  *S        points to an instance of the Q31 half-band FIR decimator structure.
+ * @param[in]  *pSrc     points to the block of input data.
+ * @param[out] *pDst     points to the block of output data, <code>blockSize/2</code> values.
+ * @param[in]  blockSize number of input samples to process per call, even.
+ * @return     none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The two samples of each coefficient pair are added with saturation to 1.31 format.
+ * The function is implemented using an internal 64-bit accumulator in 2.62 format, as
+ * <code>arm_fir_decimate_q31()</code>, and the result is truncated to 1.31 format by discarding the low 31 bits.
+ * The state is arranged as for <code>arm_fir_halfband_decimate_f32()</code>.
+ */
+
+void arm_fir_halfband_decimate_q31(
+  const arm_fir_halfband_decimate_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  uint32_t evenHist = (S->numTaps - 1u) >> 1u;   /* Previous even samples, 2k+1 */
+  uint32_t pairs = (S->numTaps + 1u) >> 2u;      /* Non-zero coefficient pairs, k+1 */
+  uint32_t outCnt = blockSize >> 1u;             /* Number of outputs */
+  q31_t *pEven = S->pState;                      /* Even samples */
+  q31_t *pOdd = pEven + evenHist + outCnt;       /* Odd samples */
+  q31_t *pStateCurnt, *pOddCurnt;                /* Copy pointers */
+  q31_t *px, *pe, *pb;                           /* Front and back of the window, coefficient pointer */
+  q63_t acc0;                                    /* Accumulator */
+  q31_t hc;                                      /* Center coefficient */
+  uint32_t tapCnt, blkCnt;                       /* Loop counters */
+
+  /* Move the k+1 previous odd samples after the room for the even samples of this block */
+  tapCnt = pairs;
+  pStateCurnt = S->pState + evenHist + tapCnt;
+  pOddCurnt = pOdd + tapCnt;
+
+  while(tapCnt > 0u)
+  {
+    *--pOddCurnt = *--pStateCurnt;
+    tapCnt--;
+  }
+
+  /* Split the input samples between the two phases */
+  pStateCurnt = pEven + evenHist;
+  pOddCurnt = pOdd + pairs;
+  blkCnt = outCnt;
+
+  while(blkCnt > 0u)
+  {
+    *pStateCurnt++ = *pSrc++;
+    *pOddCurnt++ = *pSrc++;
+    blkCnt--;
+  }
+
+  hc = pCoeffs[pairs];
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  {
+    q63_t acc1;                                  /* Accumulator */
+    q31_t c0;                                    /* Coefficient */
+    q31_t f0, f1;                                /* Front samples of the 2 windows */
+    q31_t b0, b1;                                /* Back samples of the 2 windows */
+
+    /* Apply loop unrolling and compute 2 output values simultaneously,
+     * as in arm_fir_sym_q31() on the even samples */
+    blkCnt = outCnt >> 1u;
+
+    while(blkCnt > 0u)
+    {
+      px = pEven;
+      pe = pEven + evenHist;
+      pb = pCoeffs;
+
+      /* Center coefficient on the odd samples */
+      acc0 = (q63_t) hc *pOdd[0];
+      acc1 = (q63_t) hc *pOdd[1];
+
+      f0 = px[0];
+      b1 = pe[1];
+
+      tapCnt = pairs;
+
+      while(tapCnt > 0u)
+      {
+        c0 = *pb++;
+        f1 = px[1];
+        b0 = *pe;
+
+        acc0 += (q63_t) c0 *__QADD(f0, b0);
+        acc1 += (q63_t) c0 *__QADD(f1, b1);
+
+        f0 = f1;
+        b1 = b0;
+
+        px++;
+        pe--;
+
+        tapCnt--;
+      }
+
+      /* The results are converted from 2.62 to 1.31 format by discarding the low 31 bits */
+      *pDst++ = (q31_t) (acc0 >> 31u);
+      *pDst++ = (q31_t) (acc1 >> 31u);
+
+      pEven += 2u;
+      pOdd += 2u;
+
+      blkCnt--;
+    }
+
+    /* Compute the last output if the number of outputs is odd */
+    blkCnt = outCnt & 0x1u;
+  }
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  blkCnt = outCnt;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    px = pEven;
+    pe = pEven + evenHist;
+    pb = pCoeffs;
+
+    /* y[n] = h[2k+1] * x[2n-2k-1] + sum(h[2i] * (x[2n-2i] + x[2n-4k-2+2i])) */
+    acc0 = (q63_t) hc * *pOdd;
+
+    tapCnt = pairs;
+
+    while(tapCnt > 0u)
+    {
+      acc0 += (q63_t) * pb++ * __QADD(*px++, *pe--);
+      tapCnt--;
+    }
+
+    /* The result is converted from 2.62 to 1.31 format by discarding the low 31 bits */
+    *pDst++ = (q31_t) (acc0 >> 31u);
+
+    pEven++;
+    pOdd++;
+
+    blkCnt--;
+  }
+
+  /* Processing is complete.
+   ** Copy the last 2k+1 even samples and the last k+1 odd samples to the start of the state buffer,
+   ** one after the other.  The even samples are copied first: the odd samples are after them. */
+  pStateCurnt = S->pState;
+  tapCnt = evenHist;
+
+  while(tapCnt > 0u)
+  {
+    *pStateCurnt++ = *pEven++;
+    tapCnt--;
+  }
+
+  tapCnt = pairs;
+
+  while(tapCnt > 0u)
+  {
+    *pStateCurnt++ = *pOdd++;
+    tapCnt--;
+  }
+}
+
+/**
+ * @} end of FIR_Halfband group
+ */
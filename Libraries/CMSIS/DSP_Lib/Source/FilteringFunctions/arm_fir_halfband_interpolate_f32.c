@@ -0,0 +1,197 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_halfband_interpolate_f32.c
+*
+* Description:	Floating-point half-band FIR interpolator processing function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Halfband
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point half-band FIR interpolator.
+ * @param[in]  *S        points to an instance of the floating-point half-band FIR interpolator structure.
+ * @param[in]  *pSrc     points to the block of input data.
+ * @param[out] *pDst     points to the block of output data, <code>2*blockSize</code> values.
+ * @param[in]  blockSize number of input samples to process per call.
+ * @return     none.
+ *
+ * \par
+ * The even outputs are those of a symmetric filter of <code>2k+2</code> coefficients on the input,
+ * computed as in <code>arm_fir_sym_f32()</code>, and the odd outputs are the input delayed by
+ * <code>k</code> samples, multiplied by the center coefficient.
+ */
+
+void arm_fir_halfband_interpolate_f32(
+  const arm_fir_halfband_interpolate_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  float32_t *pStateCurnt;                        /* Points to the current sample of the state */
+  float32_t *px, *pe, *pb;                       /* Front and back of the window, coefficient pointer */
+  float32_t acc0, hc;                            /* Accumulator and center coefficient */
+  uint32_t history = (S->numTaps - 1u) >> 1u;    /* Previous input samples, 2k+1 */
+  uint32_t pairs = (S->numTaps + 1u) >> 2u;      /* Non-zero coefficient pairs, k+1 */
+  uint32_t tapCnt, blkCnt;                       /* Loop counters */
+
+  /* Copy the new input samples after the 2k+1 previous ones */
+  pStateCurnt = pState + history;
+  blkCnt = blockSize;
+
+  while(blkCnt > 0u)
+  {
+    *pStateCurnt++ = *pSrc++;
+    blkCnt--;
+  }
+
+  hc = pCoeffs[pairs];
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  {
+    float32_t acc1, acc2, acc3;                  /* Accumulators */
+    float32_t c0;                                /* Coefficient */
+    float32_t f0, f1, f2, f3;                    /* Front samples of the 4 windows */
+    float32_t b0, b1, b2, b3;                    /* Back samples of the 4 windows */
+
+    /* Apply loop unrolling and compute the even outputs of 4 input samples simultaneously */
+    blkCnt = blockSize >> 2u;
+
+    while(blkCnt > 0u)
+    {
+      acc0 = 0.0f;
+      acc1 = 0.0f;
+      acc2 = 0.0f;
+      acc3 = 0.0f;
+
+      px = pState;
+      pe = pState + history;
+      pb = pCoeffs;
+
+      f0 = px[0];
+      f1 = px[1];
+      f2 = px[2];
+      b1 = pe[1];
+      b2 = pe[2];
+      b3 = pe[3];
+
+      tapCnt = pairs;
+
+      while(tapCnt > 0u)
+      {
+        c0 = *pb++;
+        f3 = px[3];
+        b0 = *pe;
+
+        acc0 += c0 * (f0 + b0);
+        acc1 += c0 * (f1 + b1);
+        acc2 += c0 * (f2 + b2);
+        acc3 += c0 * (f3 + b3);
+
+        f0 = f1;
+        f1 = f2;
+        f2 = f3;
+        b3 = b2;
+        b2 = b1;
+        b1 = b0;
+
+        px++;
+        pe--;
+
+        tapCnt--;
+      }
+
+      /* px is now at the center sample x[n-k] of the first window */
+      *pDst++ = acc0;
+      *pDst++ = hc * px[0];
+      *pDst++ = acc1;
+      *pDst++ = hc * px[1];
+      *pDst++ = acc2;
+      *pDst++ = hc * px[2];
+      *pDst++ = acc3;
+      *pDst++ = hc * px[3];
+
+      /* Advance the state pointer by 4 to process the next group of 4 samples */
+      pState = pState + 4u;
+
+      blkCnt--;
+    }
+
+    /* If the blockSize is not a multiple of 4, compute the remaining outputs here. */
+    blkCnt = blockSize & 0x3u;
+  }
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    acc0 = 0.0f;
+
+    px = pState;
+    pe = pState + history;
+    pb = pCoeffs;
+
+    tapCnt = pairs;
+
+    while(tapCnt > 0u)
+    {
+      /* y[2n] = sum(h[2i] * (x[n-i] + x[n-2k-1+i])) */
+      acc0 += *pb++ * (*px++ + *pe--);
+      tapCnt--;
+    }
+
+    /* y[2n+1] = h[2k+1] * x[n-k] */
+    *pDst++ = acc0;
+    *pDst++ = hc * *px;
+
+    /* Advance state pointer by 1 for the next sample */
+    pState = pState + 1u;
+
+    blkCnt--;
+  }
+
+  /* Processing is complete.
+   ** Now copy the last 2k+1 samples to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+
+  /* Points to the start of the state buffer */
+  pStateCurnt = S->pState;
+
+  tapCnt = history;
+
+  while(tapCnt > 0u)
+  {
+    *pStateCurnt++ = *pState++;
+    tapCnt--;
+  }
+}
+
+/**
+ * @} end of FIR_Halfband group
+ */
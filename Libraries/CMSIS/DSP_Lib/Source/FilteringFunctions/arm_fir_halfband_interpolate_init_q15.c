@@ -0,0 +1,87 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_halfband_interpolate_init_q15.c
+*
+* Description:	Initialization function for the Q15 half-band FIR interpolator.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Halfband
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 half-band FIR interpolator.
+ * @param[in,out] *S        points to an instance of the Q15 half-band FIR interpolator structure.
+ * @param[in]     numTaps   number of filter coefficients in the filter, of the form <code>4k+3</code>.
+ * @param[in]     *pCoeffs  points to the non-zero filter coefficients.
+ * @param[in]     *pState   points to the state buffer.
+ * @param[in]     blockSize number of input samples to process per call.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_ARGUMENT_ERROR if
+ * <code>numTaps</code> is not of the form <code>4k+3</code>.
+ *
+ * <b>Description:</b>
+ * \par
+ * <code>pCoeffs</code> points to the <code>(numTaps+5)/4</code> non-zero coefficients of the first half
+ * and the center coefficient:
+ * <pre>
+ *    {h[0], h[2], ..., h[(numTaps-3)/2], h[(numTaps-1)/2]}
+ * </pre>
+ * \par
+ * <code>pState</code> points to the array of state variables.
+ * <code>pState</code> is of length <code>(numTaps-1)/2+blockSize</code> samples, where <code>blockSize</code> is the number of input samples
+ * processed by each call to <code>arm_fir_halfband_interpolate_q15()</code>.
+ */
+
+arm_status arm_fir_halfband_interpolate_init_q15(
+  arm_fir_halfband_interpolate_instance_q15 * S,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  uint32_t blockSize)
+{
+  arm_status status;
+
+  /* The filter must be a half-band filter of 4k+3 coefficients */
+  if((numTaps & 0x3u) != 0x3u)
+  {
+    /* Set status as ARM_MATH_ARGUMENT_ERROR */
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    /* Assign filter taps */
+    S->numTaps = numTaps;
+
+    /* Assign coefficient pointer */
+    S->pCoeffs = pCoeffs;
+
+    /* Clear the state buffer.  The size of buffer is always (blockSize + (numTaps - 1) / 2) */
+    memset(pState, 0, (blockSize + ((uint32_t) numTaps - 1u) / 2u) * sizeof(q15_t));
+
+    /* Assign state pointer */
+    S->pState = pState;
+
+    status = ARM_MATH_SUCCESS;
+  }
+
+  return (status);
+
+}
+
+/**
+ * @} end of FIR_Halfband group
+ */
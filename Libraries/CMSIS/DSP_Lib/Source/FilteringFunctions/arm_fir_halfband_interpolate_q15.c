@@ -0,0 +1,200 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_halfband_interpolate_q15.c
+*
+* Description:	Q15 half-band FIR interpolator processing function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Halfband
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q15 half-band FIR interpolator.
+ * @param[in]  *S        points to an instance of the Q15 half-band FIR interpolator structure.
+ * @param[in]  *pSrc     points to the block of input data.
+ * @param[out] *pDst     points to the block of output data, <code>2*blockSize</code> values.
+ * @param[in]  blockSize number of input samples to process per call.
+ * @return     none.
+ *
+ * \par
+ * The even outputs are those of a symmetric filter of <code>2k+2</code> coefficients on the input,
+ * computed as in <code>arm_fir_sym_q15()</code>, and the odd outputs are the input delayed by
+ * <code>k</code> samples, multiplied by the center coefficient.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The two samples of each coefficient pair are added with saturation to 1.15 format, two pairs at a
+ * time with <code>__QADD16</code>, and accumulated with <code>__SMLALD</code> into a 64-bit accumulator in
+ * 34.30 format, as <code>arm_fir_interpolate_q15()</code>.  The result is shifted right by 15 bits, truncated
+ * and saturated to 1.15 format.
+ */
+
+void arm_fir_halfband_interpolate_q15(
+  const arm_fir_halfband_interpolate_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pState = S->pState;                     /* State pointer */
+  q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q15_t *pStateCurnt;                            /* Points to the current sample of the state */
+  q15_t *px, *pe, *pb;                           /* Front and back of the window, coefficient pointer */
+  q63_t acc0;                                    /* Accumulator */
+  q15_t hc;                                      /* Center coefficient */
+  uint32_t history = (S->numTaps - 1u) >> 1u;    /* Previous input samples, 2k+1 */
+  uint32_t pairs = (S->numTaps + 1u) >> 2u;      /* Non-zero coefficient pairs, k+1 */
+  uint32_t tapCnt, blkCnt;                       /* Loop counters */
+
+  /* Copy the new input samples after the 2k+1 previous ones */
+  pStateCurnt = pState + history;
+  blkCnt = blockSize;
+
+  while(blkCnt > 0u)
+  {
+    *pStateCurnt++ = *pSrc++;
+    blkCnt--;
+  }
+
+  hc = pCoeffs[pairs];
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  {
+    q63_t acc1;                                  /* Accumulator */
+    q31_t c01;                                   /* Packed coefficients h[2i], h[2i+2] */
+    q31_t front, back;                           /* Packed samples from both ends of the window */
+
+    /* Apply loop unrolling and compute the even outputs of 2 input samples simultaneously,
+     * with the coefficients read two at a time as in arm_fir_sym_q15() */
+    blkCnt = blockSize >> 1u;
+
+    while(blkCnt > 0u)
+    {
+      acc0 = 0;
+      acc1 = 0;
+
+      px = pState;
+      pe = pState + (history - 1u);
+      pb = pCoeffs;
+
+      tapCnt = pairs >> 1u;
+
+      while(tapCnt > 0u)
+      {
+        c01 = *__SIMD32(pb)++;
+
+        /* First output */
+        front = *__SIMD32(px);
+        back = *__SIMD32(pe);
+        back = (q31_t) (((uint32_t) back >> 16) | ((uint32_t) back << 16));
+        acc0 = __SMLALD(c01, __QADD16(front, back), acc0);
+
+        /* Second output: the window one sample later */
+        front = *(q31_t *) (px + 1);
+        back = *(q31_t *) (pe + 1);
+        back = (q31_t) (((uint32_t) back >> 16) | ((uint32_t) back << 16));
+        acc1 = __SMLALD(c01, __QADD16(front, back), acc1);
+
+        px += 2u;
+        pe -= 2;
+
+        tapCnt--;
+      }
+
+      /* The last pair if the number of pairs is odd: back of its window is pe[1] */
+      if((pairs & 0x1u) != 0u)
+      {
+        acc0 += (q31_t) * pb * (q31_t) clip_q31_to_q15((q31_t) px[0] + pe[1]);
+        acc1 += (q31_t) * pb * (q31_t) clip_q31_to_q15((q31_t) px[1] + pe[2]);
+
+        px++;
+      }
+
+      /* px is now at the center sample x[n-k] of the first window.
+       * The results are in 34.30 format; convert them to 1.15 with saturation */
+      *pDst++ = (q15_t) (__SSAT((acc0 >> 15), 16));
+      *pDst++ = (q15_t) (__SSAT((((q31_t) hc * px[0]) >> 15), 16));
+      *pDst++ = (q15_t) (__SSAT((acc1 >> 15), 16));
+      *pDst++ = (q15_t) (__SSAT((((q31_t) hc * px[1]) >> 15), 16));
+
+      /* Advance the state pointer by 2 to process the next group of 2 samples */
+      pState = pState + 2u;
+
+      blkCnt--;
+    }
+
+    /* Compute the last outputs if the blockSize is odd */
+    blkCnt = blockSize & 0x1u;
+  }
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    acc0 = 0;
+
+    px = pState;
+    pe = pState + history;
+    pb = pCoeffs;
+
+    tapCnt = pairs;
+
+    while(tapCnt > 0u)
+    {
+      /* y[2n] = sum(h[2i] * (x[n-i] + x[n-2k-1+i])) */
+      acc0 += (q31_t) * pb++ * (q31_t) clip_q31_to_q15((q31_t) * px++ + *pe--);
+      tapCnt--;
+    }
+
+    /* y[2n+1] = h[2k+1] * x[n-k], both converted from 34.30 to 1.15 format */
+    *pDst++ = (q15_t) (__SSAT((acc0 >> 15), 16));
+    *pDst++ = (q15_t) (__SSAT((((q31_t) hc * *px) >> 15), 16));
+
+    /* Advance state pointer by 1 for the next sample */
+    pState = pState + 1u;
+
+    blkCnt--;
+  }
+
+  /* Processing is complete.
+   ** Now copy the last 2k+1 samples to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+
+  /* Points to the start of the state buffer */
+  pStateCurnt = S->pState;
+
+  tapCnt = history;
+
+  while(tapCnt > 0u)
+  {
+    *pStateCurnt++ = *pState++;
+    tapCnt--;
+  }
+}
+
+/**
+ * @} end of FIR_Halfband group
+ */
@@ -0,0 +1,189 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_halfband_interpolate_q31.c
+*
+* Description:	Q31 half-band FIR interpolator processing function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Halfband
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q31 half-band FIR interpolator.
+ * @param[in]  *S        points to an instance of the Q31 half-band FIR interpolator structure.
+ * @param[in]  *pSrc     points to the block of input data.
+ * @param[out] *pDst     points to the block of output data, <code>2*blockSize</code> values.
+ * @param[in]  blockSize number of input samples to process per call.
+ * @return     none.
+ *
+ * \par
+ * The even outputs are those of a symmetric filter of <code>2k+2</code> coefficients on the input,
+ * computed as in <code>arm_fir_sym_q31()</code>, and the odd outputs are the input delayed by
+ * <code>k</code> samples, multiplied by the center coefficient.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The two samples of each coefficient pair are added with saturation to 1.31 format.
+ * The function is implemented using an internal 64-bit accumulator in 2.62 format, as
+ * <code>arm_fir_interpolate_q31()</code>, and the result is truncated to 1.31 format by discarding the low 31 bits.
+ */
+
+void arm_fir_halfband_interpolate_q31(
+  const arm_fir_halfband_interpolate_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t *pState = S->pState;                     /* State pointer */
+  q31_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q31_t *pStateCurnt;                            /* Points to the current sample of the state */
+  q31_t *px, *pe, *pb;                           /* Front and back of the window, coefficient pointer */
+  q63_t acc0;                                    /* Accumulator */
+  q31_t hc;                                      /* Center coefficient */
+  uint32_t history = (S->numTaps - 1u) >> 1u;    /* Previous input samples, 2k+1 */
+  uint32_t pairs = (S->numTaps + 1u) >> 2u;      /* Non-zero coefficient pairs, k+1 */
+  uint32_t tapCnt, blkCnt;                       /* Loop counters */
+
+  /* Copy the new input samples after the 2k+1 previous ones */
+  pStateCurnt = pState + history;
+  blkCnt = blockSize;
+
+  while(blkCnt > 0u)
+  {
+    *pStateCurnt++ = *pSrc++;
+    blkCnt--;
+  }
+
+  hc = pCoeffs[pairs];
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  {
+    q63_t acc1;                                  /* Accumulator */
+    q31_t c0;                                    /* Coefficient */
+    q31_t f0, f1;                                /* Front samples of the 2 windows */
+    q31_t b0, b1;                                /* Back samples of the 2 windows */
+
+    /* Apply loop unrolling and compute the even outputs of 2 input samples simultaneously */
+    blkCnt = blockSize >> 1u;
+
+    while(blkCnt > 0u)
+    {
+      acc0 = 0;
+      acc1 = 0;
+
+      px = pState;
+      pe = pState + history;
+      pb = pCoeffs;
+
+      f0 = px[0];
+      b1 = pe[1];
+
+      tapCnt = pairs;
+
+      while(tapCnt > 0u)
+      {
+        c0 = *pb++;
+        f1 = px[1];
+        b0 = *pe;
+
+        acc0 += (q63_t) c0 *__QADD(f0, b0);
+        acc1 += (q63_t) c0 *__QADD(f1, b1);
+
+        f0 = f1;
+        b1 = b0;
+
+        px++;
+        pe--;
+
+        tapCnt--;
+      }
+
+      /* px is now at the center sample x[n-k] of the first window.
+       * The results are converted from 2.62 to 1.31 format by discarding the low 31 bits */
+      *pDst++ = (q31_t) (acc0 >> 31u);
+      *pDst++ = (q31_t) (((q63_t) hc * px[0]) >> 31u);
+      *pDst++ = (q31_t) (acc1 >> 31u);
+      *pDst++ = (q31_t) (((q63_t) hc * px[1]) >> 31u);
+
+      /* Advance the state pointer by 2 to process the next group of 2 samples */
+      pState = pState + 2u;
+
+      blkCnt--;
+    }
+
+    /* Compute the last outputs if the blockSize is odd */
+    blkCnt = blockSize & 0x1u;
+  }
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    acc0 = 0;
+
+    px = pState;
+    pe = pState + history;
+    pb = pCoeffs;
+
+    tapCnt = pairs;
+
+    while(tapCnt > 0u)
+    {
+      /* y[2n] = sum(h[2i] * (x[n-i] + x[n-2k-1+i])) */
+      acc0 += (q63_t) * pb++ * __QADD(*px++, *pe--);
+      tapCnt--;
+    }
+
+    /* y[2n+1] = h[2k+1] * x[n-k], both converted from 2.62 to 1.31 format */
+    *pDst++ = (q31_t) (acc0 >> 31u);
+    *pDst++ = (q31_t) (((q63_t) hc * *px) >> 31u);
+
+    /* Advance state pointer by 1 for the next sample */
+    pState = pState + 1u;
+
+    blkCnt--;
+  }
+
+  /* Processing is complete.
+   ** Now copy the last 2k+1 samples to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+
+  /* Points to the start of the state buffer */
+  pStateCurnt = S->pState;
+
+  tapCnt = history;
+
+  while(tapCnt > 0u)
+  {
+    *pStateCurnt++ = *pState++;
+    tapCnt--;
+  }
+}
+
+/**
+ * @} end of FIR_Halfband group
+ */
@@ -0,0 +1,326 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_multi_f32.c
+*
+* Description:	Floating-point multichannel FIR filter processing function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup FIRMulti Multichannel FIR Filters
+ *
+ * These functions filter <code>numChannels</code> channels with one shared set of
+ * coefficients in a single call.  They compute the same outputs as calling the
+ * corresponding single channel FIR function (\ref FIR) once per channel, but every
+ * coefficient is loaded once per output sample for a group of channels rather than
+ * once per channel, which makes stereo cheaper than two mono filters and lets the
+ * host build filter many channels with one vector load per tap.
+ *
+ * \par Data layout
+ * <code>pSrc</code> and <code>pDst</code> hold <code>blockSize</code> samples of every
+ * channel, either planar (<code>ARM_MULTI_PLANAR</code>: channel <code>c</code> is the
+ * contiguous block <code>p[c*blockSize]</code> ... <code>p[c*blockSize+blockSize-1]</code>)
+ * or interleaved (<code>ARM_MULTI_INTERLEAVED</code>: sample <code>n</code> of channel
+ * <code>c</code> is <code>p[n*numChannels+c]</code>).  The layout is chosen when the
+ * instance is initialized and applies to both buffers.
+ *
+ * \par
+ * The state buffer is kept as frames of <code>numChannels</code> values, oldest frame
+ * first, so the samples of all channels at one time step are contiguous whatever the
+ * input layout.  It holds <code>numTaps+blockSize-1</code> frames.
+ *
+ * \par
+ * The coefficients are stored in time reversed order, as for the single channel FIR:
+ * <pre>
+ *    {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}
+ * </pre>
+ *
+ * \par Fixed-Point Behavior
+ * The Q15 and Q31 versions accumulate in 64 bits and round like
+ * <code>arm_fir_q15()</code> and <code>arm_fir_q31()</code>: Q15 outputs are
+ * saturated, Q31 outputs are truncated and wrap on overflow.
+ */
+
+/**
+ * @addtogroup FIRMulti
+ * @{
+ */
+
+/**
+ * @param[in]  *S points to an instance of the floating-point multichannel FIR structure.
+ * @param[in]  *pSrc points to the block of input data, blockSize samples of every channel.
+ * @param[out] *pDst points to the block of output data, blockSize samples of every channel.
+ * @param[in]  blockSize number of samples per channel to process per call.
+ * @return     none.
+ */
+
+void arm_fir_multi_f32(
+  const arm_fir_multi_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  float32_t *pStateCurnt;                        /* Points to the current sample of the state */
+  float32_t *px, *pb;                            /* Temporary pointers for state and coefficient buffers */
+  float32_t *pOut;                               /* Output pointer */
+  float32_t acc0, acc1, acc2, acc3, c0;          /* Accumulators and current coefficient */
+  uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+  uint32_t numCh = S->numChannels;               /* Number of channels */
+  uint32_t sampleStep, chStep;                   /* Distance between samples and between channels in pSrc/pDst */
+  uint32_t n, ch, i, tapCnt;                     /* Loop counters */
+
+  if(S->layout == ARM_MULTI_INTERLEAVED)
+  {
+    sampleStep = numCh;
+    chStep = 1u;
+  }
+  else
+  {
+    sampleStep = 1u;
+    chStep = blockSize;
+  }
+
+  /* S->pState holds the previous (numTaps - 1) frames.
+   ** Append one frame of numChannels samples per input sample. */
+  pStateCurnt = pState + ((numTaps - 1u) * numCh);
+
+  for (n = 0u; n < blockSize; n++)
+  {
+    for (ch = 0u; ch < numCh; ch++)
+    {
+      *pStateCurnt++ = pSrc[(n * sampleStep) + (ch * chStep)];
+    }
+  }
+
+  for (n = 0u; n < blockSize; n++)
+  {
+    ch = 0u;
+
+#if defined (ARM_MATH_SSE2)
+
+    /* Host build: 4 (AVX2: 8) channels per vector, one broadcast per tap */
+    {
+      float32_t out[8];
+      __m128 vAcc;
+
+#if defined (ARM_MATH_AVX2)
+      __m256 vAcc8;
+
+      while((numCh - ch) >= 8u)
+      {
+        px = pState + (n * numCh) + ch;
+        pb = pCoeffs;
+        vAcc8 = _mm256_setzero_ps();
+
+        tapCnt = numTaps;
+
+        while(tapCnt > 0u)
+        {
+          vAcc8 = _mm256_add_ps(vAcc8, _mm256_mul_ps(_mm256_set1_ps(*pb++), _mm256_loadu_ps(px)));
+          px += numCh;
+
+          tapCnt--;
+        }
+
+        _mm256_storeu_ps(out, vAcc8);
+
+        pOut = pDst + (n * sampleStep) + (ch * chStep);
+        for (i = 0u; i < 8u; i++)
+        {
+          pOut[i * chStep] = out[i];
+        }
+
+        ch += 8u;
+      }
+#endif /* #if defined (ARM_MATH_AVX2) */
+
+      while((numCh - ch) >= 4u)
+      {
+        px = pState + (n * numCh) + ch;
+        pb = pCoeffs;
+        vAcc = _mm_setzero_ps();
+
+        tapCnt = numTaps;
+
+        while(tapCnt > 0u)
+        {
+          vAcc = _mm_add_ps(vAcc, _mm_mul_ps(_mm_set1_ps(*pb++), _mm_loadu_ps(px)));
+          px += numCh;
+
+          tapCnt--;
+        }
+
+        _mm_storeu_ps(out, vAcc);
+
+        pOut = pDst + (n * sampleStep) + (ch * chStep);
+        for (i = 0u; i < 4u; i++)
+        {
+          pOut[i * chStep] = out[i];
+        }
+
+        ch += 4u;
+      }
+    }
+
+#elif defined (ARM_MATH_NEON)
+
+    /* Host build: 4 channels per vector, one broadcast per tap */
+    {
+      float32_t out[4];
+      float32x4_t vAcc;
+
+      while((numCh - ch) >= 4u)
+      {
+        px = pState + (n * numCh) + ch;
+        pb = pCoeffs;
+        vAcc = vdupq_n_f32(0.0f);
+
+        tapCnt = numTaps;
+
+        while(tapCnt > 0u)
+        {
+          vAcc = vmlaq_n_f32(vAcc, vld1q_f32(px), *pb++);
+          px += numCh;
+
+          tapCnt--;
+        }
+
+        vst1q_f32(out, vAcc);
+
+        pOut = pDst + (n * sampleStep) + (ch * chStep);
+        for (i = 0u; i < 4u; i++)
+        {
+          pOut[i * chStep] = out[i];
+        }
+
+        ch += 4u;
+      }
+    }
+
+#endif /* #if defined (ARM_MATH_SSE2) */
+
+    /* Process 4 channels at a time, each coefficient is loaded once for all four */
+    while((numCh - ch) >= 4u)
+    {
+      px = pState + (n * numCh) + ch;
+      pb = pCoeffs;
+
+      acc0 = 0.0f;
+      acc1 = 0.0f;
+      acc2 = 0.0f;
+      acc3 = 0.0f;
+
+      tapCnt = numTaps;
+
+      while(tapCnt > 0u)
+      {
+        c0 = *pb++;
+
+        acc0 += c0 * px[0];
+        acc1 += c0 * px[1];
+        acc2 += c0 * px[2];
+        acc3 += c0 * px[3];
+
+        /* Move to the same channels in the next frame */
+        px += numCh;
+
+        tapCnt--;
+      }
+
+      pOut = pDst + (n * sampleStep) + (ch * chStep);
+      pOut[0] = acc0;
+      pOut[chStep] = acc1;
+      pOut[2u * chStep] = acc2;
+      pOut[3u * chStep] = acc3;
+
+      ch += 4u;
+    }
+
+    /* Process a remaining pair of channels (stereo) the same way */
+    if((numCh - ch) >= 2u)
+    {
+      px = pState + (n * numCh) + ch;
+      pb = pCoeffs;
+
+      acc0 = 0.0f;
+      acc1 = 0.0f;
+
+      tapCnt = numTaps;
+
+      while(tapCnt > 0u)
+      {
+        c0 = *pb++;
+
+        acc0 += c0 * px[0];
+        acc1 += c0 * px[1];
+
+        /* Move to the same channels in the next frame */
+        px += numCh;
+
+        tapCnt--;
+      }
+
+      pOut = pDst + (n * sampleStep) + (ch * chStep);
+      pOut[0] = acc0;
+      pOut[chStep] = acc1;
+
+      ch += 2u;
+    }
+
+    /* Process the last channel of an odd channel count */
+    if(ch < numCh)
+    {
+      px = pState + (n * numCh) + ch;
+      pb = pCoeffs;
+
+      acc0 = 0.0f;
+
+      tapCnt = numTaps;
+
+      while(tapCnt > 0u)
+      {
+        acc0 += *pb++ * *px;
+        px += numCh;
+
+        tapCnt--;
+      }
+
+      pDst[(n * sampleStep) + (ch * chStep)] = acc0;
+
+      ch++;
+    }
+  }
+
+  /* Processing is complete.
+   ** Now copy the last (numTaps - 1) frames to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+  px = pState + (blockSize * numCh);
+  pStateCurnt = pState;
+
+  i = (numTaps - 1u) * numCh;
+
+  while(i > 0u)
+  {
+    *pStateCurnt++ = *px++;
+
+    i--;
+  }
+}
+
+/**
+ * @} end of FIRMulti group
+ */
@@ -0,0 +1,78 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:        arm_fir_multi_init_q15.c
+*
+* Description:  Q15 multichannel FIR filter initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIRMulti
+ * @{
+ */
+
+/**
+ * @details
+ *
+ * @param[in,out] *S points to an instance of the Q15 multichannel FIR filter structure.
+ * @param[in]     numTaps  Number of filter coefficients in the filter.
+ * @param[in]     numChannels number of channels filtered by each call.
+ * @param[in]     layout  channel layout of the input and output buffers: ARM_MULTI_PLANAR or ARM_MULTI_INTERLEAVED.
+ * @param[in]     *pCoeffs points to the filter coefficients buffer, shared by all channels.
+ * @param[in]     *pState points to the state buffer.
+ * @param[in]     blockSize number of samples per channel that are processed per call.
+ * @return        none.
+ *
+ * <b>Description:</b>
+ * \par
+ * <code>pCoeffs</code> points to the array of filter coefficients stored in time reversed order:
+ * <pre>
+ *    {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}
+ * </pre>
+ * \par
+ * <code>pState</code> points to the array of state variables.
+ * <code>pState</code> is of length <code>(numTaps+blockSize-1)*numChannels</code> samples, where <code>blockSize</code> is the number of samples per channel processed by each call to <code>arm_fir_multi_q15()</code>.
+ */
+
+void arm_fir_multi_init_q15(
+  arm_fir_multi_instance_q15 * S,
+  uint16_t numTaps,
+  uint16_t numChannels,
+  arm_multi_layout layout,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  uint32_t blockSize)
+{
+  /* Assign filter taps */
+  S->numTaps = numTaps;
+
+  /* Assign the number of channels and their layout */
+  S->numChannels = numChannels;
+  S->layout = layout;
+
+  /* Assign coefficient pointer */
+  S->pCoeffs = pCoeffs;
+
+  /* Clear state buffer and the size of state buffer is (blockSize + numTaps - 1) frames of numChannels samples */
+  memset(pState, 0, ((numTaps + (blockSize - 1u)) * numChannels) * sizeof(q15_t));
+
+  /* Assign state pointer */
+  S->pState = pState;
+
+}
+
+/**
+ * @} end of FIRMulti group
+ */
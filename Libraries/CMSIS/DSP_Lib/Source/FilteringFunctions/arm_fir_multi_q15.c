@@ -0,0 +1,189 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_multi_q15.c
+*
+* Description:	Q15 multichannel FIR filter processing function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIRMulti
+ * @{
+ */
+
+/**
+ * @param[in]  *S points to an instance of the Q15 multichannel FIR structure.
+ * @param[in]  *pSrc points to the block of input data, blockSize samples of every channel.
+ * @param[out] *pDst points to the block of output data, blockSize samples of every channel.
+ * @param[in]  blockSize number of samples per channel to process per call.
+ * @return     none.
+ */
+
+void arm_fir_multi_q15(
+  const arm_fir_multi_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pState = S->pState;                     /* State pointer */
+  q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q15_t *pStateCurnt;                            /* Points to the current sample of the state */
+  q15_t *px, *pb;                                /* Temporary pointers for state and coefficient buffers */
+  q15_t *pOut;                                   /* Output pointer */
+  q63_t acc0, acc1, acc2, acc3;                  /* Accumulators */
+  q15_t c0;                                      /* Current coefficient */
+  uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+  uint32_t numCh = S->numChannels;               /* Number of channels */
+  uint32_t sampleStep, chStep;                   /* Distance between samples and between channels in pSrc/pDst */
+  uint32_t n, ch, i, tapCnt;                     /* Loop counters */
+
+  if(S->layout == ARM_MULTI_INTERLEAVED)
+  {
+    sampleStep = numCh;
+    chStep = 1u;
+  }
+  else
+  {
+    sampleStep = 1u;
+    chStep = blockSize;
+  }
+
+  /* S->pState holds the previous (numTaps - 1) frames.
+   ** Append one frame of numChannels samples per input sample. */
+  pStateCurnt = pState + ((numTaps - 1u) * numCh);
+
+  for (n = 0u; n < blockSize; n++)
+  {
+    for (ch = 0u; ch < numCh; ch++)
+    {
+      *pStateCurnt++ = pSrc[(n * sampleStep) + (ch * chStep)];
+    }
+  }
+
+  for (n = 0u; n < blockSize; n++)
+  {
+    ch = 0u;
+
+    /* Process 4 channels at a time, each coefficient is loaded once for all four */
+    while((numCh - ch) >= 4u)
+    {
+      px = pState + (n * numCh) + ch;
+      pb = pCoeffs;
+
+      acc0 = 0;
+      acc1 = 0;
+      acc2 = 0;
+      acc3 = 0;
+
+      tapCnt = numTaps;
+
+      while(tapCnt > 0u)
+      {
+        c0 = *pb++;
+
+        acc0 += (q31_t) c0 * px[0];
+        acc1 += (q31_t) c0 * px[1];
+        acc2 += (q31_t) c0 * px[2];
+        acc3 += (q31_t) c0 * px[3];
+
+        /* Move to the same channels in the next frame */
+        px += numCh;
+
+        tapCnt--;
+      }
+
+      pOut = pDst + (n * sampleStep) + (ch * chStep);
+      pOut[0] = (q15_t) __SSAT((acc0 >> 15), 16);
+      pOut[chStep] = (q15_t) __SSAT((acc1 >> 15), 16);
+      pOut[2u * chStep] = (q15_t) __SSAT((acc2 >> 15), 16);
+      pOut[3u * chStep] = (q15_t) __SSAT((acc3 >> 15), 16);
+
+      ch += 4u;
+    }
+
+    /* Process a remaining pair of channels (stereo) the same way */
+    if((numCh - ch) >= 2u)
+    {
+      px = pState + (n * numCh) + ch;
+      pb = pCoeffs;
+
+      acc0 = 0;
+      acc1 = 0;
+
+      tapCnt = numTaps;
+
+      while(tapCnt > 0u)
+      {
+        c0 = *pb++;
+
+        acc0 += (q31_t) c0 * px[0];
+        acc1 += (q31_t) c0 * px[1];
+
+        /* Move to the same channels in the next frame */
+        px += numCh;
+
+        tapCnt--;
+      }
+
+      pOut = pDst + (n * sampleStep) + (ch * chStep);
+      pOut[0] = (q15_t) __SSAT((acc0 >> 15), 16);
+      pOut[chStep] = (q15_t) __SSAT((acc1 >> 15), 16);
+
+      ch += 2u;
+    }
+
+    /* Process the last channel of an odd channel count */
+    if(ch < numCh)
+    {
+      px = pState + (n * numCh) + ch;
+      pb = pCoeffs;
+
+      acc0 = 0;
+
+      tapCnt = numTaps;
+
+      while(tapCnt > 0u)
+      {
+        acc0 += (q31_t) * pb++ * *px;
+        px += numCh;
+
+        tapCnt--;
+      }
+
+      pDst[(n * sampleStep) + (ch * chStep)] = (q15_t) __SSAT((acc0 >> 15), 16);
+
+      ch++;
+    }
+  }
+
+  /* Processing is complete.
+   ** Now copy the last (numTaps - 1) frames to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+  px = pState + (blockSize * numCh);
+  pStateCurnt = pState;
+
+  i = (numTaps - 1u) * numCh;
+
+  while(i > 0u)
+  {
+    *pStateCurnt++ = *px++;
+
+    i--;
+  }
+}
+
+/**
+ * @} end of FIRMulti group
+ */
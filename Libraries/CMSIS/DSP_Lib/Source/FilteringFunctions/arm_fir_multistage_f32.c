@@ -0,0 +1,112 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_multistage_f32.c
+*
+* Description:	Floating-point multistage FIR decimator and interpolator processing function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Multistage
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point multistage FIR decimator or interpolator.
+ * @param[in]  *S        points to an instance of the multistage structure.
+ * @param[in]  *pSrc     points to the block of input data.
+ * @param[out] *pDst     points to the block of output data, <code>blockSize/ratio</code> values for a decimator
+ * and <code>blockSize*ratio</code> for an interpolator.
+ * @param[in]  blockSize number of input samples to process per call, at most the block size given to the
+ * initialization function, and a multiple of the ratio for a decimator.
+ * @return none.
+ *
+ * \par
+ * The stages run one after the other on the whole block, through the two buffers of the arena.
+ * <code>pSrc</code> and <code>pDst</code> must not overlap.
+ */
+
+void arm_fir_multistage_f32(
+  const arm_fir_multistage_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  const arm_fir_multistage_stage_f32 *pStage;    /* Current stage */
+  float32_t *pIn = pSrc, *pOut;                  /* Input and output of the current stage */
+  uint32_t i, blockOut;                          /* Stage counter and output block size */
+
+  for (i = 0u; i < S->numStages; i++)
+  {
+    pStage = &S->stage[i];
+
+    /* The last stage writes the destination, the others alternate between the two buffers */
+    if((i + 1u) == S->numStages)
+    {
+      pOut = pDst;
+    }
+    else
+    {
+      pOut = ((i & 0x1u) == 0u) ? S->pScratchA : S->pScratchB;
+    }
+
+    if(S->interpolateFlag == 0u)
+    {
+      blockOut = blockSize / pStage->factor;
+
+      if(pStage->halfBand != 0u)
+      {
+        arm_fir_halfband_decimate_instance_f32 H = { pStage->numTaps, pStage->pCoeffs, pStage->pState };
+
+        arm_fir_halfband_decimate_f32(&H, pIn, pOut, blockSize);
+      }
+      else
+      {
+        arm_fir_decimate_instance_f32 D = { pStage->factor, pStage->numTaps, pStage->pCoeffs,
+          pStage->pState
+        };
+
+        arm_fir_decimate_f32(&D, pIn, pOut, blockSize);
+      }
+    }
+    else
+    {
+      blockOut = blockSize * pStage->factor;
+
+      if(pStage->halfBand != 0u)
+      {
+        arm_fir_halfband_interpolate_instance_f32 H = { pStage->numTaps, pStage->pCoeffs, pStage->pState };
+
+        arm_fir_halfband_interpolate_f32(&H, pIn, pOut, blockSize);
+      }
+      else
+      {
+        arm_fir_interpolate_instance_f32 I = { pStage->factor,
+          (uint16_t) (pStage->numTaps / pStage->factor), pStage->pCoeffs, pStage->pState
+        };
+
+        arm_fir_interpolate_f32(&I, pIn, pOut, blockSize);
+      }
+    }
+
+    /* The output of this stage is the input of the next one */
+    pIn = pOut;
+    blockSize = blockOut;
+  }
+}
+
+/**
+ * @} end of FIR_Multistage group
+ */
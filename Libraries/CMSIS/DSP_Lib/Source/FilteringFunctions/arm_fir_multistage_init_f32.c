@@ -0,0 +1,248 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_multistage_init_f32.c
+*
+* Description:	Floating-point multistage FIR decimator and interpolator initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Multistage
+ * @{
+ */
+
+/**
+ * @brief Modified Bessel function of the first kind and order 0, from its power series.
+ */
+
+static float32_t arm_fir_multistage_bessel_i0(
+  float32_t x)
+{
+  float32_t sum = 1.0f, term = 1.0f, half = 0.5f * x;
+  uint32_t k = 1u;
+
+  /* I0(x) = sum((x/2)^k / k!)^2, the terms fall below the float precision after a few dozen */
+  do
+  {
+    term *= half / (float32_t) k;
+    sum += term * term;
+    k++;
+  } while((term * term) > (1.0e-9f * sum));
+
+  return (sum);
+}
+
+/**
+ * @brief Designs the lowpass filter of one stage: a Kaiser windowed sinc with the cutoff at half the
+ * Nyquist frequency of the low rate of the stage.
+ * @param[out] *pCoeffs    filter coefficients, <code>numTaps</code> values, or the <code>(numTaps+5)/4</code>
+ * non-zero coefficients of a half-band filter in the order of \ref FIR_Halfband.
+ * @param[in]  numTaps     filter length.
+ * @param[in]  factor      factor of the stage.
+ * @param[in]  gain        DC gain, 1 for a decimator and <code>factor</code> for an interpolator.
+ * @param[in]  attenuation stopband attenuation in dB.
+ *
+ * The coefficients are symmetric, so the time reversed order of the FIR functions is the same array.
+ * The coefficients of a half-band filter at an even distance from the center are exactly zero and
+ * are not stored, nor the second half.
+ */
+
+static void arm_fir_multistage_design(
+  float32_t * pCoeffs,
+  uint32_t numTaps,
+  uint32_t factor,
+  float32_t gain,
+  float32_t attenuation)
+{
+  float32_t beta, center, cutoff, t, r, h, sum = 0.0f, i0Beta;
+  float32_t *pOut = pCoeffs;
+  uint32_t n, lastTap, period = 4u * factor, phase;
+
+  /* Kaiser window parameter for the attenuation */
+  if(attenuation > 50.0f)
+  {
+    beta = 0.1102f * (attenuation - 8.7f);
+  }
+  else if(attenuation > 21.0f)
+  {
+    /* 0.5842 * t^0.4 + 0.07886 * t, t^0.4 by Newton iterations on r^5 = t^2 */
+    t = attenuation - 21.0f;
+    arm_sqrt_f32(t, &r);
+
+    for (n = 0u; n < 8u; n++)
+    {
+      r -= ((r * r * r * r * r) - (t * t)) / (5.0f * r * r * r * r);
+    }
+
+    beta = (0.5842f * r) + (0.07886f * t);
+  }
+  else
+  {
+    beta = 0.0f;
+  }
+
+  i0Beta = arm_fir_multistage_bessel_i0(beta);
+  center = 0.5f * (float32_t) (numTaps - 1u);
+  cutoff = 1.0f / (float32_t) factor;
+
+  /* A half-band filter stops at its center coefficient */
+  lastTap = (factor == 2u) ? ((numTaps - 1u) >> 1u) : (numTaps - 1u);
+
+  for (n = 0u; n <= lastTap; n++)
+  {
+    t = (float32_t) n - center;
+
+    /* sinc(cutoff * t), cutoff relative to the Nyquist frequency of the high rate */
+    if(t == 0.0f)
+    {
+      h = cutoff;
+    }
+    else if((factor == 2u) && ((n & 0x1u) != 0u))
+    {
+      /* Odd n other than the center, at an even distance from it: zero of a half-band filter */
+      continue;
+    }
+    else
+    {
+      /* The sine has a period of 4*factor in 2*t, which is an integer: reduce it exactly
+       ** so that the argument stays small for long filters */
+      phase = ((2u * n) + period - ((numTaps - 1u) % period)) % period;
+      h = arm_sin_f32((PI * 0.5f * cutoff) * (float32_t) phase) / (PI * t);
+    }
+
+    /* Kaiser window */
+    r = 1.0f - ((t * t) / (center * center));
+    arm_sqrt_f32((r > 0.0f) ? r : 0.0f, &r);
+    h *= arm_fir_multistage_bessel_i0(beta * r) / i0Beta;
+
+    *pOut++ = h;
+
+    /* The half-band coefficients other than the center stand for a symmetric pair */
+    sum += ((factor == 2u) && (t != 0.0f)) ? (2.0f * h) : h;
+  }
+
+  /* Normalize the DC gain */
+  arm_scale_f32(pCoeffs, gain / sum, pCoeffs, (uint32_t) (pOut - pCoeffs));
+}
+
+/**
+ * @brief  Initialization function for the floating-point multistage FIR decimator or interpolator.
+ * @param[in,out] *S        points to an instance of the multistage structure.
+ * @param[in]     *P        points to the plan, from <code>arm_fir_multistage_plan_f32()</code>.
+ * @param[in]     blockSize largest number of input samples per call.
+ * @param[in]     *pArena   points to the arena that holds the coefficients, states and buffers of all stages.
+ * @param[in]     arenaSize number of float32_t values in the arena.
+ * @return        ARM_MATH_SUCCESS, ARM_MATH_LENGTH_ERROR if the arena is shorter than
+ * <code>arm_fir_multistage_arena_size_f32(P, blockSize)</code> or ARM_MATH_ARGUMENT_ERROR if the
+ * block size of a decimator is not a multiple of the ratio.
+ *
+ * <b>Description:</b>
+ * \par
+ * Designs the filter of each stage into the arena and zeros the state of each stage.
+ * The design uses the sine and square root functions of the library and takes
+ * a few milliseconds for filters of a few hundred taps, so it should not run in the processing loop.
+ * The plan is not referenced after the call.
+ */
+
+arm_status arm_fir_multistage_init_f32(
+  arm_fir_multistage_instance_f32 * S,
+  const arm_fir_multistage_plan_instance_f32 * P,
+  uint32_t blockSize,
+  float32_t * pArena,
+  uint32_t arenaSize)
+{
+  arm_fir_multistage_stage_f32 *pStage;
+  uint32_t i, numTaps, factor, stateSize, blockIn = blockSize, blockOut;
+  uint32_t scratchA = 0u, scratchB = 0u;
+  float32_t *pNext = pArena;
+
+  if(arenaSize < arm_fir_multistage_arena_size_f32(P, blockSize))
+  {
+    return (ARM_MATH_LENGTH_ERROR);
+  }
+
+  if((P->interpolateFlag == 0u) && ((blockSize % P->ratio) != 0u))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->interpolateFlag = P->interpolateFlag;
+  S->numStages = P->numStages;
+  S->ratio = P->ratio;
+  S->blockSize = blockSize;
+
+  /* Coefficients of all stages first */
+  for (i = 0u; i < P->numStages; i++)
+  {
+    pStage = &S->stage[i];
+    pStage->factor = P->factor[i];
+    pStage->halfBand = P->halfBand[i];
+    pStage->numTaps = P->numTaps[i];
+    pStage->pCoeffs = pNext;
+
+    arm_fir_multistage_design(pNext, pStage->numTaps, pStage->factor,
+                              (P->interpolateFlag == 0u) ? 1.0f : (float32_t) pStage->factor,
+                              P->attenuation);
+
+    pNext += (pStage->halfBand != 0u) ? ((pStage->numTaps + 5u) >> 2u) : pStage->numTaps;
+  }
+
+  /* Then the states, cleared, and the sizes of the buffers between the stages */
+  for (i = 0u; i < P->numStages; i++)
+  {
+    pStage = &S->stage[i];
+    numTaps = pStage->numTaps;
+    factor = pStage->factor;
+
+    if(P->interpolateFlag == 0u)
+    {
+      blockOut = blockIn / factor;
+      stateSize = numTaps + blockIn - 1u;
+    }
+    else
+    {
+      blockOut = blockIn * factor;
+      stateSize = (pStage->halfBand != 0u) ? (((numTaps - 1u) >> 1u) + blockIn) : ((numTaps / factor) + blockIn - 1u);
+    }
+
+    pStage->pState = pNext;
+    memset(pNext, 0, stateSize * sizeof(float32_t));
+    pNext += stateSize;
+
+    if((i + 1u) < P->numStages)
+    {
+      if((i & 0x1u) == 0u)
+      {
+        scratchA = (blockOut > scratchA) ? blockOut : scratchA;
+      }
+      else
+      {
+        scratchB = (blockOut > scratchB) ? blockOut : scratchB;
+      }
+    }
+
+    blockIn = blockOut;
+  }
+
+  /* And the two buffers between the stages */
+  S->pScratchA = pNext;
+  S->pScratchB = pNext + scratchA;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of FIR_Multistage group
+ */
@@ -0,0 +1,398 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_multistage_plan_f32.c
+*
+* Description:	Chooses the stages of a multistage FIR decimator or interpolator.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup FIR_Multistage Multistage FIR Decimator and Interpolator
+ *
+ * These functions change the sample rate by a large integer factor with a chain of
+ * 1 to 4 \ref FIR_decimate or \ref FIR_Interpolate stages, and design the filters themselves.
+ * A single stage decimator by <code>R</code> needs a filter whose transition band is a small
+ * fraction of its input rate, which takes a very long filter and <code>numTaps</code>
+ * multiplications per output sample.  Splitting the ratio into stages lets the first stages of a
+ * decimator (the last stages of an interpolator) run with wide transition bands and short filters,
+ * and only the stage at the low rate needs a sharp filter.
+ *
+ * \par Planning
+ * <code>arm_fir_multistage_plan_f32()</code> takes the ratio, the passband edge as a fraction of
+ * the Nyquist frequency of the low rate and the stopband attenuation.  It tries every ordering of
+ * every factorization of the ratio into at most <code>maxStages</code> factors, estimates the length
+ * of each stage filter with the Kaiser formula and keeps the chain with the fewest multiplications
+ * per output sample.  The plan also records the cost of a single stage for comparison.
+ * The Kaiser estimate can be 1 to 3 dB short of the attenuation for short filters, and
+ * the floating-point coefficients and arithmetic limit the attenuation to about 120 dB.
+ *
+ * \par
+ * With the low rate as the unit, each stage between the rates <code>Fl</code> and
+ * <code>Fh = factor*Fl</code> keeps the passband <code>[0, fp]</code> and rejects everything
+ * that would alias or image into it, above <code>Fl - fp</code>.  Aliasing into the
+ * transition band between <code>fp</code> and the Nyquist frequency of the low rate is allowed.
+ * The transition band of a stage is therefore centered on <code>Fl/2</code>, and a factor of 2
+ * stage is a half-band filter: every other coefficient is zero apart from the center one.
+ * The half-band stages skip the zero coefficients and add the two samples of each symmetric
+ * pair before multiplying, so they cost about a quarter of the multiplications of a general stage of the same length.
+ *
+ * \par Execution
+ * <code>arm_fir_multistage_init_f32()</code> designs the filters (Kaiser windowed sinc) and lays
+ * the coefficients, the state of each stage and the buffers between the stages out in one
+ * arena supplied by the caller, of <code>arm_fir_multistage_arena_size_f32()</code> values.
+ * <code>arm_fir_multistage_f32()</code> runs the chain on a block of input samples.
+ * The general stages run <code>arm_fir_decimate_f32()</code> or <code>arm_fir_interpolate_f32()</code>
+ * and the half-band stages the functions of \ref FIR_Halfband.
+ * A decimator consumes <code>blockSize</code> samples, a multiple of the ratio, and produces
+ * <code>blockSize/ratio</code>; an interpolator produces <code>blockSize*ratio</code>.
+ *
+ * \par
+ * For example, 48 kHz to 8 kHz with the passband up to 3.4 kHz and 80 dB of attenuation:
+ * <pre>
+ *     arm_fir_multistage_plan_instance_f32 plan;
+ *     arm_fir_multistage_instance_f32 S;
+ *     static float32_t arena[ARENA_SIZE];
+ *
+ *     arm_fir_multistage_plan_f32(&plan, 6, 0, 0.85f, 80.0f, 4);
+ *     if(arm_fir_multistage_arena_size_f32(&plan, 480) <= ARENA_SIZE)
+ *     {
+ *         arm_fir_multistage_init_f32(&S, &plan, 480, arena, ARENA_SIZE);
+ *     }
+ *     ...
+ *     arm_fir_multistage_f32(&S, pIn48k, pOut8k, 480);
+ * </pre>
+ */
+
+/**
+ * @addtogroup FIR_Multistage
+ * @{
+ */
+
+/**
+ * @brief Length of a stage filter from the Kaiser estimate.
+ * @param[in] width        transition band width in cycles per sample of the high rate.
+ * @param[in] attenuation  stopband attenuation in dB.
+ * @param[in] factor       factor of the stage.
+ * @param[in] interpolateFlag 1 if the stage interpolates.
+ * @return    filter length, 0 if it does not fit the stage.
+ *
+ * Half-band filters have <code>4k+3</code> coefficients, so that the coefficients next to the
+ * center are not zero; the filters of the other interpolation stages have a multiple of
+ * <code>factor</code> coefficients as <code>arm_fir_interpolate_f32()</code> requires.
+ */
+
+static uint32_t arm_fir_multistage_taps(
+  float32_t width,
+  float32_t attenuation,
+  uint32_t factor,
+  uint8_t interpolateFlag)
+{
+  float32_t est;
+  uint32_t numTaps;
+
+  /* Kaiser: N - 1 = (A - 7.95) / (14.36 * width), and 0.9222 / width below 21 dB */
+  est = (attenuation > 21.0f) ? ((attenuation - 7.95f) / (14.36f * width)) : (0.9222f / width);
+
+  if(est > 65000.0f)
+  {
+    return (0u);
+  }
+
+  numTaps = (uint32_t) est + 2u;
+
+  if(factor == 2u)
+  {
+    /* Half-band: round up to 4k+3 */
+    numTaps |= 3u;
+  }
+  else if(interpolateFlag != 0u)
+  {
+    numTaps = ((numTaps + factor - 1u) / factor) * factor;
+  }
+
+  return (numTaps);
+}
+
+/**
+ * @brief Multiplications per sample at the rate where the stage does its work: per output of a
+ * decimator stage, per input of an interpolator stage (numTaps/L per output, L outputs).
+ */
+
+static float32_t arm_fir_multistage_stage_macs(
+  uint32_t numTaps,
+  uint32_t factor)
+{
+  if(factor == 2u)
+  {
+    /* One multiplication per symmetric pair of non-zero coefficients, plus the center one */
+    return ((float32_t) ((numTaps + 5u) >> 2u));
+  }
+
+  return ((float32_t) numTaps);
+}
+
+/**
+ * @brief Search state of arm_fir_multistage_plan_f32().
+ */
+
+typedef struct
+{
+  arm_fir_multistage_plan_instance_f32 *pBest;  /**< best plan so far. */
+  uint8_t factor[ARM_FIR_MULTISTAGE_MAX_STAGES];       /**< factors of the chain being built. */
+  uint8_t maxStages;                   /**< largest number of stages. */
+  uint8_t found;                       /**< 1 once a chain has been stored in pBest. */
+} arm_fir_multistage_search;
+
+/**
+ * @brief Evaluates the chain of <code>numStages</code> factors in the search state and keeps it if it is the cheapest so far.
+ */
+
+static void arm_fir_multistage_evaluate(
+  arm_fir_multistage_search * pSearch,
+  uint32_t numStages)
+{
+  arm_fir_multistage_plan_instance_f32 *P = pSearch->pBest;
+  uint16_t numTaps[ARM_FIR_MULTISTAGE_MAX_STAGES];
+  float32_t macs = 0.0f, low, high, width;
+  uint32_t i, factor, rate;
+
+  /* Low rate of each stage with the low rate of the chain as the unit.
+   * A decimator runs from the high rate down: stage i is between
+   * prod(factor[j], j > i) and prod(factor[j], j >= i).
+   * An interpolator runs from the low rate up: stage i is between
+   * prod(factor[j], j < i) and prod(factor[j], j <= i). */
+  for (i = 0u; i < numStages; i++)
+  {
+    factor = pSearch->factor[i];
+    rate = 1u;
+
+    if(P->interpolateFlag == 0u)
+    {
+      uint32_t j;
+
+      for (j = i + 1u; j < numStages; j++)
+      {
+        rate *= pSearch->factor[j];
+      }
+    }
+    else
+    {
+      uint32_t j;
+
+      for (j = 0u; j < i; j++)
+      {
+        rate *= pSearch->factor[j];
+      }
+    }
+
+    low = (float32_t) rate;
+    high = low * (float32_t) factor;
+
+    /* Passband [0, fp], stopband from low - fp, fp = passband / 2 */
+    width = (low - P->passband) / high;
+    numTaps[i] = (uint16_t) arm_fir_multistage_taps(width, P->attenuation, factor,
+                                                     P->interpolateFlag);
+
+    if(numTaps[i] == 0u)
+    {
+      return;
+    }
+
+    /* Scale the cost to the rate of the chain output */
+    if(P->interpolateFlag == 0u)
+    {
+      macs += arm_fir_multistage_stage_macs(numTaps[i], factor) * low;
+    }
+    else
+    {
+      macs += arm_fir_multistage_stage_macs(numTaps[i], factor) * (low / (float32_t) P->ratio);
+    }
+  }
+
+  /* Keep the cheapest chain, and the shorter one of two that cost the same */
+  if((pSearch->found == 0u) || (macs < P->macsPerOutput) ||
+     ((macs == P->macsPerOutput) && (numStages < P->numStages)))
+  {
+    P->numStages = (uint8_t) numStages;
+    P->macsPerOutput = macs;
+
+    for (i = 0u; i < numStages; i++)
+    {
+      P->factor[i] = pSearch->factor[i];
+      P->halfBand[i] = (pSearch->factor[i] == 2u) ? 1u : 0u;
+      P->numTaps[i] = numTaps[i];
+    }
+
+    pSearch->found = 1u;
+  }
+}
+
+/**
+ * @brief Tries every ordered factorization of <code>remaining</code> into at most
+ * <code>maxStages - depth</code> factors after the <code>depth</code> factors already chosen.
+ */
+
+static void arm_fir_multistage_factor(
+  arm_fir_multistage_search * pSearch,
+  uint32_t remaining,
+  uint32_t depth)
+{
+  uint32_t f;
+
+  if(remaining == 1u)
+  {
+    arm_fir_multistage_evaluate(pSearch, depth);
+    return;
+  }
+
+  if(depth == pSearch->maxStages)
+  {
+    return;
+  }
+
+  for (f = 2u; (f <= remaining) && (f <= 255u); f++)
+  {
+    if((remaining % f) == 0u)
+    {
+      pSearch->factor[depth] = (uint8_t) f;
+      arm_fir_multistage_factor(pSearch, remaining / f, depth + 1u);
+    }
+  }
+}
+
+/**
+ * @brief  Chooses the stages of a multistage FIR decimator or interpolator.
+ * @param[out] *P              points to the plan.
+ * @param[in]  ratio           overall decimation or interpolation factor, at least 2.
+ * @param[in]  interpolateFlag 0 for a decimator, 1 for an interpolator.
+ * @param[in]  passband        passband edge as a fraction of the Nyquist frequency of the low rate, in (0, 1).
+ * @param[in]  attenuation     stopband attenuation in dB.
+ * @param[in]  maxStages       largest number of stages to consider, 1 to ARM_FIR_MULTISTAGE_MAX_STAGES.
+ * @return     ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if the arguments are out of range or no chain
+ * has filters of at most 65535 coefficients and factors of at most 255.
+ *
+ * \par
+ * The plan can be inspected before anything is allocated: <code>P->macsPerOutput</code> against
+ * <code>P->singleStageMacsPerOutput</code> is the saving of the chain, and
+ * <code>arm_fir_multistage_arena_size_f32()</code> gives its memory.  The single stage figures
+ * are those of <code>arm_fir_decimate_f32()</code> or <code>arm_fir_interpolate_f32()</code>
+ * with the same specification, whether or not its factor fits in their <code>uint8_t</code>.
+ */
+
+arm_status arm_fir_multistage_plan_f32(
+  arm_fir_multistage_plan_instance_f32 * P,
+  uint16_t ratio,
+  uint8_t interpolateFlag,
+  float32_t passband,
+  float32_t attenuation,
+  uint8_t maxStages)
+{
+  arm_fir_multistage_search search;
+  uint32_t numTaps;
+
+  if((ratio < 2u) || (passband <= 0.0f) || (passband >= 1.0f) || (attenuation <= 0.0f) ||
+     (maxStages == 0u) || (maxStages > ARM_FIR_MULTISTAGE_MAX_STAGES))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  memset(P, 0, sizeof(arm_fir_multistage_plan_instance_f32));
+
+  P->ratio = ratio;
+  P->interpolateFlag = interpolateFlag;
+  P->passband = passband;
+  P->attenuation = attenuation;
+
+  /* Single stage reference, its general filter even for a ratio of 2 */
+  numTaps = arm_fir_multistage_taps((1.0f - passband) / (float32_t) ratio, attenuation, 0u, 0u);
+  P->singleStageNumTaps = (uint16_t) numTaps;
+  P->singleStageMacsPerOutput = (interpolateFlag == 0u) ? (float32_t) numTaps :
+    ((float32_t) numTaps / (float32_t) ratio);
+
+  search.pBest = P;
+  search.maxStages = maxStages;
+  search.found = 0u;
+
+  arm_fir_multistage_factor(&search, ratio, 0u);
+
+  return ((search.found != 0u) ? ARM_MATH_SUCCESS : ARM_MATH_ARGUMENT_ERROR);
+}
+
+/**
+ * @brief  Number of float32_t values of the arena of a multistage FIR decimator or interpolator.
+ * @param[in] *P        points to the plan.
+ * @param[in] blockSize largest number of input samples per call.
+ * @return    arena length.
+ *
+ * \par
+ * The arena holds, in this order, the coefficients of every stage (<code>numTaps</code> values, or the
+ * <code>(numTaps+5)/4</code> non-zero ones of a half-band stage), the state of every stage
+ * and the two buffers between the stages.  Stage <code>i</code> runs on <code>Bi</code> input samples,
+ * <code>blockSize</code> divided or multiplied by the factors of the stages before it.
+ * Its state is <code>numTaps+Bi-1</code> values for a decimator stage, <code>numTaps/L+Bi-1</code>
+ * for a general interpolator stage and <code>(numTaps-1)/2+Bi</code> for a half-band interpolator stage.
+ * The output of stage <code>i</code> goes to the first buffer for even <code>i</code> and to the second
+ * for odd <code>i</code>, and the last stage writes the destination buffer.
+ */
+
+uint32_t arm_fir_multistage_arena_size_f32(
+  const arm_fir_multistage_plan_instance_f32 * P,
+  uint32_t blockSize)
+{
+  uint32_t size = 0u, scratchA = 0u, scratchB = 0u;
+  uint32_t i, numTaps, factor, blockIn = blockSize, blockOut;
+
+  for (i = 0u; i < P->numStages; i++)
+  {
+    numTaps = P->numTaps[i];
+    factor = P->factor[i];
+
+    /* Coefficients */
+    size += (P->halfBand[i] != 0u) ? ((numTaps + 5u) >> 2u) : numTaps;
+
+    /* State */
+    if(P->interpolateFlag == 0u)
+    {
+      blockOut = blockIn / factor;
+      size += numTaps + blockIn - 1u;
+    }
+    else
+    {
+      blockOut = blockIn * factor;
+      size += (P->halfBand[i] != 0u) ? (((numTaps - 1u) >> 1u) + blockIn) : ((numTaps / factor) + blockIn - 1u);
+    }
+
+    /* Output buffer of the stages before the last one */
+    if((i + 1u) < P->numStages)
+    {
+      if((i & 0x1u) == 0u)
+      {
+        scratchA = (blockOut > scratchA) ? blockOut : scratchA;
+      }
+      else
+      {
+        scratchB = (blockOut > scratchB) ? blockOut : scratchB;
+      }
+    }
+
+    blockIn = blockOut;
+  }
+
+  return (size + scratchA + scratchB);
+}
+
+/**
+ * @} end of FIR_Multistage group
+ */
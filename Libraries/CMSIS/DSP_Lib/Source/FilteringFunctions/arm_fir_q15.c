@@ -88,6 +88,12 @@ void arm_fir_q15(
   uint32_t numTaps = S->numTaps;                 /* Number of taps in the filter */
   uint32_t tapCnt, blkCnt;                       /* Loop counters */
 
+  /* Use the kernel generated for this tap count, if there is one (arm_fir_fixed_q15.c) */
+  if(arm_fir_fixed_q15(S, pSrc, pDst, blockSize) == ARM_MATH_SUCCESS)
+  {
+    return;
+  }
+
   /* S->pState points to state array which contains previous frame (numTaps - 1) samples */
   /* pStateCurnt points to the location where the new input data should be written */
   pStateCurnt = &(S->pState[(numTaps - 1u)]);
@@ -87,6 +87,12 @@ void arm_fir_q31(
   uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
   uint32_t i, tapCnt, blkCnt;                    /* Loop counters */
 
+  /* Use the kernel generated for this tap count, if there is one (arm_fir_fixed_q31.c) */
+  if(arm_fir_fixed_q31(S, pSrc, pDst, blockSize) == ARM_MATH_SUCCESS)
+  {
+    return;
+  }
+
   /* S->pState points to state array which contains previous frame (numTaps - 1) samples */
   /* pStateCurnt points to the location where the new input data should be written */
   pStateCurnt = &(S->pState[(numTaps - 1u)]);
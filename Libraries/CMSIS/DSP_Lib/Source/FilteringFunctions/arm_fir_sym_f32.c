@@ -0,0 +1,256 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_sym_f32.c
+*
+* Description:	Floating-point symmetric FIR filter processing function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup FIR_Symmetric Symmetric FIR Filters
+ *
+ * These functions implement linear phase FIR filters, whose coefficients are symmetric:
+ * <code>b[k] = b[numTaps-1-k]</code>.  The samples that meet the same coefficient are
+ * added before the multiplication, which halves the number of multiplications:
+ * <pre>
+ *     y[n] = b[0] * (x[n] + x[n-numTaps+1]) + b[1] * (x[n-1] + x[n-numTaps+2]) + ...
+ * </pre>
+ * and, for an odd <code>numTaps</code>, the center coefficient <code>b[(numTaps-1)/2]</code>
+ * multiplies a single sample.  The output is the same as that of \ref FIR with the full
+ * coefficient array, apart from the rounding and the saturation of the fixed-point pre-add.
+ *
+ * \par
+ * <code>pCoeffs</code> points to the first half of the coefficients, <code>(numTaps+1)/2</code> values:
+ * <pre>
+ *     {b[0], b[1], ..., b[(numTaps-1)/2]}
+ * </pre>
+ * The order does not matter for the time reversal of \ref FIR, since the filter is symmetric.
+ * <code>pState</code> points to a state array of size <code>numTaps + blockSize - 1</code>,
+ * ordered as for \ref FIR.
+ *
+ * \par
+ * Half-band filters are symmetric as well, and every other coefficient of them is zero;
+ * \ref FIR_Halfband skips these as well.
+ *
+ * \par Instance Structure
+ * The coefficients and state variables for a filter are stored together in an instance data structure.
+ * A separate instance structure must be defined for each filter.
+ * Coefficient arrays may be shared among several instances while state variable arrays cannot be shared.
+ *
+ * \par Initialization Functions
+ * There is also an associated initialization function for each data type.
+ * The initialization function performs the following operations:
+ * - Sets the values of the internal structure fields.
+ * - Zeros out the values in the state buffer.
+ * \par
+ * To statically initialize the instance structure, clear the state buffer and use
+ * <pre>
+ *     arm_fir_sym_instance_f32 S = {numTaps, pState, pCoeffs};
+ * </pre>
+ *
+ * \par Fixed-Point Behavior
+ * The Q31 and Q15 functions add the two samples with saturation, so the input signal must be
+ * scaled down by 1 bit, as well as by the bits of growth the filter requires, for the output to be the
+ * same as that of <code>arm_fir_q31()</code> or <code>arm_fir_q15()</code>.
+ * The accumulators are the same 64-bit accumulators.
+ */
+
+/**
+ * @addtogroup FIR_Symmetric
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point symmetric FIR filter.
+ * @param[in]  *S        points to an instance of the floating-point symmetric FIR structure.
+ * @param[in]  *pSrc     points to the block of input data.
+ * @param[out] *pDst     points to the block of output data.
+ * @param[in]  blockSize number of samples to process per call.
+ * @return     none.
+ */
+
+void arm_fir_sym_f32(
+  const arm_fir_sym_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  float32_t *pStateCurnt;                        /* Points to the current sample of the state */
+  float32_t *px, *pe, *pb;                       /* Front and back of the window, coefficient pointer */
+  float32_t acc0;                                /* Accumulator */
+  uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+  uint32_t pairs = numTaps >> 1u;                /* Number of symmetric pairs of coefficients */
+  uint32_t tapCnt, blkCnt;                       /* Loop counters */
+
+  /* S->pState points to state array which contains previous frame (numTaps - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = &(S->pState[(numTaps - 1u)]);
+
+  /* Copy the new input samples into the state buffer */
+  blkCnt = blockSize;
+
+  while(blkCnt > 0u)
+  {
+    *pStateCurnt++ = *pSrc++;
+    blkCnt--;
+  }
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  {
+    float32_t acc1, acc2, acc3;                  /* Accumulators */
+    float32_t c0;                                /* Coefficient */
+    float32_t f0, f1, f2, f3;                    /* Front samples of the 4 windows */
+    float32_t b0, b1, b2, b3;                    /* Back samples of the 4 windows */
+
+    /* Apply loop unrolling and compute 4 output values simultaneously.
+     * The front samples of the 4 windows move forward and the back samples move
+     * backward by one sample per coefficient, so each coefficient reads 2 new samples. */
+    blkCnt = blockSize >> 2u;
+
+    while(blkCnt > 0u)
+    {
+      acc0 = 0.0f;
+      acc1 = 0.0f;
+      acc2 = 0.0f;
+      acc3 = 0.0f;
+
+      px = pState;
+      pe = pState + (numTaps - 1u);
+      pb = pCoeffs;
+
+      f0 = px[0];
+      f1 = px[1];
+      f2 = px[2];
+      b1 = pe[1];
+      b2 = pe[2];
+      b3 = pe[3];
+
+      tapCnt = pairs;
+
+      while(tapCnt > 0u)
+      {
+        c0 = *pb++;
+        f3 = px[3];
+        b0 = *pe;
+
+        /* acc += b[k] * (x[n-k] + x[n-numTaps+1+k]) for the 4 outputs */
+        acc0 += c0 * (f0 + b0);
+        acc1 += c0 * (f1 + b1);
+        acc2 += c0 * (f2 + b2);
+        acc3 += c0 * (f3 + b3);
+
+        f0 = f1;
+        f1 = f2;
+        f2 = f3;
+        b3 = b2;
+        b2 = b1;
+        b1 = b0;
+
+        px++;
+        pe--;
+
+        tapCnt--;
+      }
+
+      /* Center coefficient of an odd length filter */
+      if((numTaps & 0x1u) != 0u)
+      {
+        c0 = *pb;
+
+        acc0 += c0 * f0;
+        acc1 += c0 * f1;
+        acc2 += c0 * f2;
+        acc3 += c0 * px[3];
+      }
+
+      *pDst++ = acc0;
+      *pDst++ = acc1;
+      *pDst++ = acc2;
+      *pDst++ = acc3;
+
+      /* Advance the state pointer by 4 to process the next group of 4 samples */
+      pState = pState + 4u;
+
+      blkCnt--;
+    }
+
+    /* If the blockSize is not a multiple of 4, compute any remaining output samples here. */
+    blkCnt = blockSize & 0x3u;
+  }
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    acc0 = 0.0f;
+
+    px = pState;
+    pe = pState + (numTaps - 1u);
+    pb = pCoeffs;
+
+    tapCnt = pairs;
+
+    while(tapCnt > 0u)
+    {
+      /* acc += b[k] * (x[n-k] + x[n-numTaps+1+k]) */
+      acc0 += *pb++ * (*px++ + *pe--);
+
+      tapCnt--;
+    }
+
+    /* Center coefficient of an odd length filter */
+    if((numTaps & 0x1u) != 0u)
+    {
+      acc0 += *pb * *px;
+    }
+
+    *pDst++ = acc0;
+
+    /* Advance state pointer by 1 for the next sample */
+    pState = pState + 1u;
+
+    blkCnt--;
+  }
+
+  /* Processing is complete.
+   ** Now copy the last numTaps - 1 samples to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+
+  /* Points to the start of the state buffer */
+  pStateCurnt = S->pState;
+
+  tapCnt = numTaps - 1u;
+
+  while(tapCnt > 0u)
+  {
+    *pStateCurnt++ = *pState++;
+    tapCnt--;
+  }
+}
+
+/**
+ * @} end of FIR_Symmetric group
+ */
@@ -0,0 +1,215 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_sym_q15.c
+*
+* Description:	Q15 symmetric FIR filter processing function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Symmetric
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q15 symmetric FIR filter.
+ * @param[in]  *S        points to an instance of the Q15 symmetric FIR structure.
+ * @param[in]  *pSrc     points to the block of input data.
+ * @param[out] *pDst     points to the block of output data.
+ * @param[in]  blockSize number of samples to process per call.
+ * @return     none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The two samples that meet the same coefficient are added with saturation to 1.15 format,
+ * two pairs at a time with <code>__QADD16</code>, and multiplied and accumulated two at a time
+ * with <code>__SMLALD</code> into a 64-bit accumulator in 34.30 format, as <code>arm_fir_q15()</code>.
+ * The accumulator cannot overflow; the result is shifted right by 15 bits, truncated and saturated
+ * to 1.15 format.  When the input signal is scaled down by 1 bit the pre-add cannot saturate and
+ * the output is the same as that of <code>arm_fir_q15()</code>.
+ *
+ * \par
+ * The state buffer holds <code>numTaps + blockSize - 1</code> values on every core.
+ */
+
+void arm_fir_sym_q15(
+  const arm_fir_sym_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pState = S->pState;                     /* State pointer */
+  q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q15_t *pStateCurnt;                            /* Points to the current sample of the state */
+  q15_t *px, *pe, *pb;                           /* Front and back of the window, coefficient pointer */
+  q63_t acc0;                                    /* Accumulator */
+  uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+  uint32_t pairs = numTaps >> 1u;                /* Number of symmetric pairs of coefficients */
+  uint32_t tapCnt, blkCnt;                       /* Loop counters */
+
+  /* S->pState points to state array which contains previous frame (numTaps - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = &(S->pState[(numTaps - 1u)]);
+
+  /* Copy the new input samples into the state buffer */
+  blkCnt = blockSize;
+
+  while(blkCnt > 0u)
+  {
+    *pStateCurnt++ = *pSrc++;
+    blkCnt--;
+  }
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  {
+    q63_t acc1;                                  /* Accumulator */
+    q31_t c01;                                   /* Packed coefficients b[k], b[k+1] */
+    q31_t front, back;                           /* Packed samples from both ends of the window */
+
+    /* Apply loop unrolling and compute 2 output values simultaneously.
+     * The taps are processed two at a time: the samples x[n-k], x[n-k-1] are read as one word
+     * from the front of the window and x[n-numTaps+2+k], x[n-numTaps+1+k] from the back.
+     * The halfwords of the back word are swapped so that each lane holds the two samples of
+     * one coefficient, the lanes are added with __QADD16 and multiplied with __SMLALD.
+     * Both words are read in memory order, so the lanes match on either endianness. */
+    blkCnt = blockSize >> 1u;
+
+    while(blkCnt > 0u)
+    {
+      acc0 = 0;
+      acc1 = 0;
+
+      px = pState;
+      pe = pState + (numTaps - 2u);
+      pb = pCoeffs;
+
+      tapCnt = pairs >> 1u;
+
+      while(tapCnt > 0u)
+      {
+        c01 = *__SIMD32(pb)++;
+
+        /* First output: front x[0], x[1] and back x[N-1], x[N-2] of its window */
+        front = *__SIMD32(px);
+        back = *__SIMD32(pe);
+        back = (q31_t) (((uint32_t) back >> 16) | ((uint32_t) back << 16));
+        acc0 = __SMLALD(c01, __QADD16(front, back), acc0);
+
+        /* Second output: the window one sample later */
+        front = *(q31_t *) (px + 1);
+        back = *(q31_t *) (pe + 1);
+        back = (q31_t) (((uint32_t) back >> 16) | ((uint32_t) back << 16));
+        acc1 = __SMLALD(c01, __QADD16(front, back), acc1);
+
+        px += 2u;
+        pe -= 2;
+
+        tapCnt--;
+      }
+
+      /* The last pair if the number of pairs is odd: back of its window is pe[1] */
+      if((pairs & 0x1u) != 0u)
+      {
+        acc0 += (q31_t) * pb * (q31_t) clip_q31_to_q15((q31_t) px[0] + pe[1]);
+        acc1 += (q31_t) * pb * (q31_t) clip_q31_to_q15((q31_t) px[1] + pe[2]);
+
+        pb++;
+        px++;
+      }
+
+      /* Center coefficient of an odd length filter */
+      if((numTaps & 0x1u) != 0u)
+      {
+        acc0 += (q31_t) * pb * px[0];
+        acc1 += (q31_t) * pb * px[1];
+      }
+
+      /* The results are in 34.30 format; convert them to 1.15 with saturation */
+      *pDst++ = (q15_t) (__SSAT((acc0 >> 15), 16));
+      *pDst++ = (q15_t) (__SSAT((acc1 >> 15), 16));
+
+      /* Advance the state pointer by 2 to process the next group of 2 samples */
+      pState = pState + 2u;
+
+      blkCnt--;
+    }
+
+    /* Compute the last output if the blockSize is odd */
+    blkCnt = blockSize & 0x1u;
+  }
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    acc0 = 0;
+
+    px = pState;
+    pe = pState + (numTaps - 1u);
+    pb = pCoeffs;
+
+    tapCnt = pairs;
+
+    while(tapCnt > 0u)
+    {
+      /* acc += b[k] * sat(x[n-k] + x[n-numTaps+1+k]) */
+      acc0 += (q31_t) * pb++ * (q31_t) clip_q31_to_q15((q31_t) * px++ + *pe--);
+
+      tapCnt--;
+    }
+
+    /* Center coefficient of an odd length filter */
+    if((numTaps & 0x1u) != 0u)
+    {
+      acc0 += (q31_t) * pb * *px;
+    }
+
+    /* The result is in 34.30 format; convert it to 1.15 with saturation */
+    *pDst++ = (q15_t) (__SSAT((acc0 >> 15), 16));
+
+    /* Advance state pointer by 1 for the next sample */
+    pState = pState + 1u;
+
+    blkCnt--;
+  }
+
+  /* Processing is complete.
+   ** Now copy the last numTaps - 1 samples to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+
+  /* Points to the start of the state buffer */
+  pStateCurnt = S->pState;
+
+  tapCnt = numTaps - 1u;
+
+  while(tapCnt > 0u)
+  {
+    *pStateCurnt++ = *pState++;
+    tapCnt--;
+  }
+}
+
+/**
+ * @} end of FIR_Symmetric group
+ */
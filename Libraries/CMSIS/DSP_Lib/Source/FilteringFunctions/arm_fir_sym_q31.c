@@ -0,0 +1,200 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_sym_q31.c
+*
+* Description:	Q31 symmetric FIR filter processing function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Symmetric
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q31 symmetric FIR filter.
+ * @param[in]  *S        points to an instance of the Q31 symmetric FIR structure.
+ * @param[in]  *pSrc     points to the block of input data.
+ * @param[out] *pDst     points to the block of output data.
+ * @param[in]  blockSize number of samples to process per call.
+ * @return     none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The two samples that meet the same coefficient are added with saturation to 1.31 format.
+ * The function is implemented using an internal 64-bit accumulator in 2.62 format, as
+ * <code>arm_fir_q31()</code>, and the result is truncated to 1.31 format by discarding the low 31 bits.
+ * The input signal should be scaled down by log2(numTaps) bits, which also keeps the pre-add
+ * from saturating, and the output is then the same as that of <code>arm_fir_q31()</code>.
+ */
+
+void arm_fir_sym_q31(
+  const arm_fir_sym_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t *pState = S->pState;                     /* State pointer */
+  q31_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q31_t *pStateCurnt;                            /* Points to the current sample of the state */
+  q31_t *px, *pe, *pb;                           /* Front and back of the window, coefficient pointer */
+  q63_t acc0;                                    /* Accumulator */
+  uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+  uint32_t pairs = numTaps >> 1u;                /* Number of symmetric pairs of coefficients */
+  uint32_t tapCnt, blkCnt;                       /* Loop counters */
+
+  /* S->pState points to state array which contains previous frame (numTaps - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = &(S->pState[(numTaps - 1u)]);
+
+  /* Copy the new input samples into the state buffer */
+  blkCnt = blockSize;
+
+  while(blkCnt > 0u)
+  {
+    *pStateCurnt++ = *pSrc++;
+    blkCnt--;
+  }
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  {
+    q63_t acc1;                                  /* Accumulator */
+    q31_t c0;                                    /* Coefficient */
+    q31_t f0, f1;                                /* Front samples of the 2 windows */
+    q31_t b0, b1;                                /* Back samples of the 2 windows */
+
+    /* Apply loop unrolling and compute 2 output values simultaneously,
+     * which keeps the two 64-bit accumulators and the samples in registers. */
+    blkCnt = blockSize >> 1u;
+
+    while(blkCnt > 0u)
+    {
+      acc0 = 0;
+      acc1 = 0;
+
+      px = pState;
+      pe = pState + (numTaps - 1u);
+      pb = pCoeffs;
+
+      f0 = px[0];
+      b1 = pe[1];
+
+      tapCnt = pairs;
+
+      while(tapCnt > 0u)
+      {
+        c0 = *pb++;
+        f1 = px[1];
+        b0 = *pe;
+
+        /* acc += b[k] * (x[n-k] + x[n-numTaps+1+k]) for the 2 outputs */
+        acc0 += (q63_t) c0 *__QADD(f0, b0);
+        acc1 += (q63_t) c0 *__QADD(f1, b1);
+
+        f0 = f1;
+        b1 = b0;
+
+        px++;
+        pe--;
+
+        tapCnt--;
+      }
+
+      /* Center coefficient of an odd length filter */
+      if((numTaps & 0x1u) != 0u)
+      {
+        c0 = *pb;
+
+        acc0 += (q63_t) c0 *f0;
+        acc1 += (q63_t) c0 *px[1];
+      }
+
+      /* The results are converted from 2.62 to 1.31 format by discarding the low 31 bits */
+      *pDst++ = (q31_t) (acc0 >> 31u);
+      *pDst++ = (q31_t) (acc1 >> 31u);
+
+      /* Advance the state pointer by 2 to process the next group of 2 samples */
+      pState = pState + 2u;
+
+      blkCnt--;
+    }
+
+    /* Compute the last output if the blockSize is odd */
+    blkCnt = blockSize & 0x1u;
+  }
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    acc0 = 0;
+
+    px = pState;
+    pe = pState + (numTaps - 1u);
+    pb = pCoeffs;
+
+    tapCnt = pairs;
+
+    while(tapCnt > 0u)
+    {
+      /* acc += b[k] * (x[n-k] + x[n-numTaps+1+k]) */
+      acc0 += (q63_t) * pb++ * __QADD(*px++, *pe--);
+
+      tapCnt--;
+    }
+
+    /* Center coefficient of an odd length filter */
+    if((numTaps & 0x1u) != 0u)
+    {
+      acc0 += (q63_t) * pb * *px;
+    }
+
+    /* The result is converted from 2.62 to 1.31 format by discarding the low 31 bits */
+    *pDst++ = (q31_t) (acc0 >> 31u);
+
+    /* Advance state pointer by 1 for the next sample */
+    pState = pState + 1u;
+
+    blkCnt--;
+  }
+
+  /* Processing is complete.
+   ** Now copy the last numTaps - 1 samples to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+
+  /* Points to the start of the state buffer */
+  pStateCurnt = S->pState;
+
+  tapCnt = numTaps - 1u;
+
+  while(tapCnt > 0u)
+  {
+    *pStateCurnt++ = *pState++;
+    tapCnt--;
+  }
+}
+
+/**
+ * @} end of FIR_Symmetric group
+ */
@@ -2,6 +2,9 @@
 SET TMP=C:\Temp
 SET TEMP=C:\Temp
 
+REM Regenerate the FIR kernels for fixed tap counts from ..\..\Scripts\arm_fir_fixed.cfg
+python ..\..\Scripts\arm_fir_fixed_gen.py
+
 SET UVEXE=C:\Keil\UV4\UV4.EXE
 
 %UVEXE% -rb arm_cortexM0x_math.uvproj -t"DSP_Lib CM0 LE" -o"DSP_Lib CM0 LE.txt"
@@ -0,0 +1,126 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_ldlt_f32.c
+*
+* Description:	Floating-point LDL' (square root free Cholesky) decomposition.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixLDLT LDL' Decomposition
+ *
+ * Factors a symmetric matrix as <code>A = L * D * L'</code> and solves linear systems
+ * with the factors.
+ *
+ * This is the Cholesky decomposition without its square roots: <code>L</code> is lower
+ * triangular with a unit diagonal and <code>D</code> is diagonal.  It is meant for
+ * symmetric positive definite matrices such as covariance and autocorrelation matrices
+ * (the normal equations of least-squares filter design, beamformer weights), for which it
+ * is stable without pivoting and takes half the operations of arm_mat_lu_f32().
+ *
+ * Only the lower triangle and the diagonal of <code>A</code> are read.  The decomposition
+ * works in place: <code>D</code> replaces the diagonal, <code>L</code>, without its
+ * diagonal, the strict lower triangle, and the strict upper triangle receives
+ * <code>D * L'</code>.  The matrix then holds the same layout as the output of
+ * arm_mat_lu_f32() with no row exchanges, <code>U = D * L'</code>, which is what
+ * arm_mat_ldlt_solve_f32() uses.
+ *
+ * \par Algorithm
+ * At step <code>k</code>, <code>d(k)</code> is the diagonal element of the remaining
+ * matrix, the row <code>k</code> of <code>D * L'</code> is the column <code>k</code>
+ * below it, and the lower triangle of the remaining matrix is updated with the outer
+ * product of the two.  A zero <code>d(k)</code> stops the decomposition with
+ * <code>ARM_MATH_SINGULAR</code>.  A negative one means the matrix is not positive
+ * definite; the factors are still computed but may be inaccurate.
+ */
+
+/**
+ * @addtogroup MatrixLDLT
+ * @{
+ */
+
+/**
+ * @brief Floating-point LDL' decomposition.
+ * @param[in,out]   *pSrc points to the symmetric matrix structure, overwritten by the factors
+ * @return     		The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the
+ * matrix is not square, <code>ARM_MATH_SINGULAR</code> if an element of <code>D</code>
+ * is zero and <code>ARM_MATH_SUCCESS</code> otherwise.
+ */
+
+arm_status arm_mat_ldlt_f32(
+  arm_matrix_instance_f32 * pSrc)
+{
+  float32_t *pRowK, *pRowI;                      /* row of D * L' and row being updated */
+  float32_t in, inv;                             /* Temporary variables */
+  uint32_t numRows = pSrc->numRows;              /* number of rows of the matrix */
+  uint32_t k, i, j;                              /* loop counters */
+  arm_status status;                             /* status of the decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if(pSrc->numRows != pSrc->numCols)
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    status = ARM_MATH_SUCCESS;
+
+    for (k = 0u; (k < numRows) && (status == ARM_MATH_SUCCESS); k++)
+    {
+      pRowK = pSrc->pData + (k * numRows);
+
+      if(pRowK[k] == 0.0f)
+      {
+        /* Set status as ARM_MATH_SINGULAR */
+        status = ARM_MATH_SINGULAR;
+      }
+      else
+      {
+        inv = 1.0f / pRowK[k];
+
+        /* The row k of D * L' is the column k below the diagonal */
+        for (j = k + 1u; j < numRows; j++)
+        {
+          pRowK[j] = pSrc->pData[(j * numRows) + k];
+        }
+
+        /* Store the column k of L and update the lower triangle of the rows below */
+        for (i = k + 1u; i < numRows; i++)
+        {
+          pRowI = pSrc->pData + (i * numRows);
+          in = pRowK[i] * inv;
+          pRowI[k] = in;
+
+          for (j = k + 1u; j <= i; j++)
+          {
+            pRowI[j] -= in * pRowK[j];
+          }
+        }
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixLDLT group
+ */
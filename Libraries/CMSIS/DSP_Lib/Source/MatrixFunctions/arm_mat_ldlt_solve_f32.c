@@ -0,0 +1,60 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_ldlt_solve_f32.c
+*
+* Description:	Floating-point linear system solve with the LDL' factors.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixLDLT
+ * @{
+ */
+
+/**
+ * @brief Floating-point linear system solve with the LDL' factors.
+ * @param[in]       *pLDLT points to the factors computed by arm_mat_ldlt_f32()
+ * @param[in]       *pB points to the N x M right-hand side matrix structure
+ * @param[out]      *pX points to the N x M solution matrix structure, which may be pB
+ * @return     		The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the
+ * dimensions do not match, <code>ARM_MATH_SINGULAR</code> if <code>D</code> has a zero
+ * element and <code>ARM_MATH_SUCCESS</code> otherwise.
+ *
+ * \par
+ * Solves <code>L * Y = B</code> with the unit lower triangle, then
+ * <code>(D * L') * X = Y</code> with the upper triangle left by arm_mat_ldlt_f32().
+ */
+
+arm_status arm_mat_ldlt_solve_f32(
+  const arm_matrix_instance_f32 * pLDLT,
+  const arm_matrix_instance_f32 * pB,
+  arm_matrix_instance_f32 * pX)
+{
+  arm_status status;                             /* status of the solve */
+
+  status = arm_mat_solve_lower_triangular_f32(pLDLT, pB, pX, 1u);
+
+  if(status == ARM_MATH_SUCCESS)
+  {
+    status = arm_mat_solve_upper_triangular_f32(pLDLT, pX, pX, 0u);
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixLDLT group
+ */
@@ -0,0 +1,157 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_lu_f32.c
+*
+* Description:	Floating-point LU decomposition with partial pivoting.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixLU LU Decomposition
+ *
+ * Factors a square matrix as <code>P * A = L * U</code> and solves linear systems
+ * with the factors.
+ *
+ * <code>L</code> is lower triangular with a unit diagonal, <code>U</code> is upper
+ * triangular and <code>P</code> is a row permutation.  The decomposition works in place:
+ * <code>U</code> replaces the upper triangle and the diagonal of <code>A</code>, and
+ * <code>L</code>, without its diagonal, the strict lower triangle.  The permutation is
+ * returned as the list of the rows of <code>A</code> in their order in <code>P * A</code>.
+ *
+ * Solving <code>A * X = B</code> with the factors costs two triangular solves per
+ * right-hand side, against the <code>N^3</code> operations of forming the inverse with
+ * arm_mat_inverse_f32() and multiplying by it.  The decomposition takes
+ * <code>2/3 N^3</code> operations and is computed once for all the right-hand sides.
+ *
+ * \par Algorithm
+ * Gaussian elimination with partial pivoting: at step <code>k</code> the row with the
+ * largest magnitude in column <code>k</code> on or below the diagonal is swapped into
+ * row <code>k</code>, so every multiplier stored in <code>L</code> is at most 1 in
+ * magnitude and the rounding errors do not grow with them.  A pivot of zero means the
+ * matrix is singular and stops the decomposition with <code>ARM_MATH_SINGULAR</code>.
+ */
+
+/**
+ * @addtogroup MatrixLU
+ * @{
+ */
+
+/**
+ * @brief Floating-point LU decomposition with partial pivoting.
+ * @param[in,out]   *pSrc points to the square matrix structure, overwritten by the factors
+ * @param[out]      *pPerm points to numRows values, the permutation of the rows
+ * @return     		The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the
+ * matrix is not square, <code>ARM_MATH_SINGULAR</code> if it is singular and
+ * <code>ARM_MATH_SUCCESS</code> otherwise.
+ */
+
+arm_status arm_mat_lu_f32(
+  arm_matrix_instance_f32 * pSrc,
+  uint16_t * pPerm)
+{
+  float32_t *pRowK, *pRowI;                      /* pivot row and row being eliminated */
+  float32_t maxVal, in, inv;                     /* Temporary variables */
+  uint32_t numRows = pSrc->numRows;              /* number of rows of the matrix */
+  uint32_t k, i, j, pivot;                       /* loop counters */
+  uint16_t tmp;                                  /* Temporary variable for the permutation */
+  arm_status status;                             /* status of the decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if(pSrc->numRows != pSrc->numCols)
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    status = ARM_MATH_SUCCESS;
+
+    for (i = 0u; i < numRows; i++)
+    {
+      pPerm[i] = (uint16_t) i;
+    }
+
+    for (k = 0u; (k < numRows) && (status == ARM_MATH_SUCCESS); k++)
+    {
+      /* Find the largest element of column k on or below the diagonal */
+      pivot = k;
+      maxVal = fabsf(pSrc->pData[(k * numRows) + k]);
+
+      for (i = k + 1u; i < numRows; i++)
+      {
+        in = fabsf(pSrc->pData[(i * numRows) + k]);
+
+        if(in > maxVal)
+        {
+          maxVal = in;
+          pivot = i;
+        }
+      }
+
+      if(maxVal == 0.0f)
+      {
+        /* Set status as ARM_MATH_SINGULAR */
+        status = ARM_MATH_SINGULAR;
+      }
+      else
+      {
+        pRowK = pSrc->pData + (k * numRows);
+
+        /* Swap the pivot row into row k */
+        if(pivot != k)
+        {
+          pRowI = pSrc->pData + (pivot * numRows);
+
+          for (j = 0u; j < numRows; j++)
+          {
+            in = pRowK[j];
+            pRowK[j] = pRowI[j];
+            pRowI[j] = in;
+          }
+
+          tmp = pPerm[k];
+          pPerm[k] = pPerm[pivot];
+          pPerm[pivot] = tmp;
+        }
+
+        inv = 1.0f / pRowK[k];
+
+        /* Eliminate column k from the rows below, keeping the multipliers in L */
+        for (i = k + 1u; i < numRows; i++)
+        {
+          pRowI = pSrc->pData + (i * numRows);
+          in = pRowI[k] * inv;
+          pRowI[k] = in;
+
+          for (j = k + 1u; j < numRows; j++)
+          {
+            pRowI[j] -= in * pRowK[j];
+          }
+        }
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixLU group
+ */
@@ -0,0 +1,87 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_lu_solve_f32.c
+*
+* Description:	Floating-point linear system solve with the LU factors.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixLU
+ * @{
+ */
+
+/**
+ * @brief Floating-point linear system solve with the LU factors.
+ * @param[in]       *pLU points to the factors computed by arm_mat_lu_f32()
+ * @param[in]       *pPerm points to the permutation computed by arm_mat_lu_f32()
+ * @param[in]       *pB points to the N x M right-hand side matrix structure
+ * @param[out]      *pX points to the N x M solution matrix structure, distinct from pB
+ * @return     		The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the
+ * dimensions do not match, <code>ARM_MATH_SINGULAR</code> if <code>U</code> has a zero
+ * on its diagonal and <code>ARM_MATH_SUCCESS</code> otherwise.
+ *
+ * \par
+ * The rows of <code>B</code> are permuted into <code>X</code>, which is then solved in
+ * place with <code>L</code> and <code>U</code> by arm_mat_solve_lower_triangular_f32()
+ * and arm_mat_solve_upper_triangular_f32().
+ */
+
+arm_status arm_mat_lu_solve_f32(
+  const arm_matrix_instance_f32 * pLU,
+  const uint16_t * pPerm,
+  const arm_matrix_instance_f32 * pB,
+  arm_matrix_instance_f32 * pX)
+{
+  uint32_t numRows = pLU->numRows;               /* number of rows of the system */
+  uint32_t numCols = pB->numCols;                /* number of right-hand sides */
+  uint32_t i;                                    /* loop counter */
+  arm_status status;                             /* status of the solve */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pLU->numRows != pLU->numCols) || (pB->numRows != pLU->numRows) ||
+     (pX->numRows != pB->numRows) || (pX->numCols != pB->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    /* X = P * B */
+    for (i = 0u; i < numRows; i++)
+    {
+      arm_copy_f32(pB->pData + ((uint32_t) pPerm[i] * numCols), pX->pData + (i * numCols), numCols);
+    }
+
+    /* L * Y = P * B, then U * X = Y */
+    status = arm_mat_solve_lower_triangular_f32(pLU, pX, pX, 1u);
+
+    if(status == ARM_MATH_SUCCESS)
+    {
+      status = arm_mat_solve_upper_triangular_f32(pLU, pX, pX, 0u);
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixLU group
+ */
@@ -0,0 +1,320 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_mult_blocked_f32.c
+*
+* Description:	Cache blocked core of the floating-point matrix multiplication.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/* Rows of A per tile, held in registers together with the ARM_MAT_PACK_COLS columns of a
+ * panel of B, and the depth and rows of the blocks that are kept in the cache */
+#if defined (ARM_MATH_AVX2)
+#define ARM_MAT_TILE_ROWS   8u
+#elif defined (ARM_MATH_SSE2) || defined (ARM_MATH_NEON)
+#define ARM_MAT_TILE_ROWS   4u
+#else
+#define ARM_MAT_TILE_ROWS   1u
+#endif
+
+#if defined (ARM_MATH_SSE2) || defined (ARM_MATH_NEON)
+#define ARM_MAT_BLOCK_DEPTH 256u
+#define ARM_MAT_BLOCK_ROWS  64u
+#else
+#define ARM_MAT_BLOCK_DEPTH 32u
+#define ARM_MAT_BLOCK_ROWS  16u
+#endif
+
+/**
+ * @brief  Multiplies a tile of rows of A with a panel of B.
+ * @param[in]      *pA points to the first row of the tile in A, at the first column of the block.
+ * @param[in]      strideA number of columns of A.
+ * @param[in]      *pPanel points to depth rows of ARM_MAT_PACK_COLS values of B.
+ * @param[in,out]  *pC points to the first element of the tile in the output.
+ * @param[in]      strideC number of columns of the output.
+ * @param[in]      depth number of columns of A and rows of the panel to multiply.
+ * @param[in]      numRows rows of the tile, 1 to ARM_MAT_TILE_ROWS.
+ * @param[in]      numCols columns of the tile, 1 to ARM_MAT_PACK_COLS.
+ * @param[in]      accumulate set to add the products to the output instead of storing them.
+ * @return none.
+ *
+ * The tile is computed in registers.  The rows past numRows read the last row again and
+ * their results are dropped, as are the columns past numCols, which are zero in the panel.
+ */
+
+static void arm_mat_mult_tile_f32(
+  const float32_t * pA,
+  uint32_t strideA,
+  const float32_t * pPanel,
+  float32_t * pC,
+  uint32_t strideC,
+  uint32_t depth,
+  uint32_t numRows,
+  uint32_t numCols,
+  uint32_t accumulate)
+{
+  float32_t tile[ARM_MAT_TILE_ROWS * ARM_MAT_PACK_COLS];        /* the tile, before it is added to the output */
+  const float32_t *pRow[ARM_MAT_TILE_ROWS];      /* rows of A */
+  float32_t *pOut;                               /* output pointer */
+  uint32_t r, c, k;                              /* loop counters */
+
+  for (r = 0u; r < ARM_MAT_TILE_ROWS; r++)
+  {
+    pRow[r] = pA + (((r < numRows) ? r : (numRows - 1u)) * strideA);
+  }
+
+#if defined (ARM_MATH_AVX2)
+
+  /* Host build: 8 rows of one 8 column AVX2 vector, one broadcast of A per row and column */
+  {
+    __m256 vB;
+    __m256 vAcc0 = _mm256_setzero_ps(), vAcc1 = _mm256_setzero_ps();
+    __m256 vAcc2 = _mm256_setzero_ps(), vAcc3 = _mm256_setzero_ps();
+    __m256 vAcc4 = _mm256_setzero_ps(), vAcc5 = _mm256_setzero_ps();
+    __m256 vAcc6 = _mm256_setzero_ps(), vAcc7 = _mm256_setzero_ps();
+
+    for (k = 0u; k < depth; k++)
+    {
+      vB = _mm256_loadu_ps(pPanel);
+      vAcc0 = _mm256_add_ps(vAcc0, _mm256_mul_ps(_mm256_set1_ps(pRow[0][k]), vB));
+      vAcc1 = _mm256_add_ps(vAcc1, _mm256_mul_ps(_mm256_set1_ps(pRow[1][k]), vB));
+      vAcc2 = _mm256_add_ps(vAcc2, _mm256_mul_ps(_mm256_set1_ps(pRow[2][k]), vB));
+      vAcc3 = _mm256_add_ps(vAcc3, _mm256_mul_ps(_mm256_set1_ps(pRow[3][k]), vB));
+      vAcc4 = _mm256_add_ps(vAcc4, _mm256_mul_ps(_mm256_set1_ps(pRow[4][k]), vB));
+      vAcc5 = _mm256_add_ps(vAcc5, _mm256_mul_ps(_mm256_set1_ps(pRow[5][k]), vB));
+      vAcc6 = _mm256_add_ps(vAcc6, _mm256_mul_ps(_mm256_set1_ps(pRow[6][k]), vB));
+      vAcc7 = _mm256_add_ps(vAcc7, _mm256_mul_ps(_mm256_set1_ps(pRow[7][k]), vB));
+      pPanel += ARM_MAT_PACK_COLS;
+    }
+
+    _mm256_storeu_ps(tile, vAcc0);
+    _mm256_storeu_ps(tile + 8, vAcc1);
+    _mm256_storeu_ps(tile + 16, vAcc2);
+    _mm256_storeu_ps(tile + 24, vAcc3);
+    _mm256_storeu_ps(tile + 32, vAcc4);
+    _mm256_storeu_ps(tile + 40, vAcc5);
+    _mm256_storeu_ps(tile + 48, vAcc6);
+    _mm256_storeu_ps(tile + 56, vAcc7);
+  }
+
+#elif defined (ARM_MATH_SSE2)
+
+  /* Host build: 4 rows of two 4 column SSE2 vectors, one broadcast of A per row and column */
+  {
+    __m128 vB0, vB1, vA;
+    __m128 vAcc00 = _mm_setzero_ps(), vAcc01 = _mm_setzero_ps();
+    __m128 vAcc10 = _mm_setzero_ps(), vAcc11 = _mm_setzero_ps();
+    __m128 vAcc20 = _mm_setzero_ps(), vAcc21 = _mm_setzero_ps();
+    __m128 vAcc30 = _mm_setzero_ps(), vAcc31 = _mm_setzero_ps();
+
+    for (k = 0u; k < depth; k++)
+    {
+      vB0 = _mm_loadu_ps(pPanel);
+      vB1 = _mm_loadu_ps(pPanel + 4);
+      vA = _mm_set1_ps(pRow[0][k]);
+      vAcc00 = _mm_add_ps(vAcc00, _mm_mul_ps(vA, vB0));
+      vAcc01 = _mm_add_ps(vAcc01, _mm_mul_ps(vA, vB1));
+      vA = _mm_set1_ps(pRow[1][k]);
+      vAcc10 = _mm_add_ps(vAcc10, _mm_mul_ps(vA, vB0));
+      vAcc11 = _mm_add_ps(vAcc11, _mm_mul_ps(vA, vB1));
+      vA = _mm_set1_ps(pRow[2][k]);
+      vAcc20 = _mm_add_ps(vAcc20, _mm_mul_ps(vA, vB0));
+      vAcc21 = _mm_add_ps(vAcc21, _mm_mul_ps(vA, vB1));
+      vA = _mm_set1_ps(pRow[3][k]);
+      vAcc30 = _mm_add_ps(vAcc30, _mm_mul_ps(vA, vB0));
+      vAcc31 = _mm_add_ps(vAcc31, _mm_mul_ps(vA, vB1));
+      pPanel += ARM_MAT_PACK_COLS;
+    }
+
+    _mm_storeu_ps(tile, vAcc00);
+    _mm_storeu_ps(tile + 4, vAcc01);
+    _mm_storeu_ps(tile + 8, vAcc10);
+    _mm_storeu_ps(tile + 12, vAcc11);
+    _mm_storeu_ps(tile + 16, vAcc20);
+    _mm_storeu_ps(tile + 20, vAcc21);
+    _mm_storeu_ps(tile + 24, vAcc30);
+    _mm_storeu_ps(tile + 28, vAcc31);
+  }
+
+#elif defined (ARM_MATH_NEON)
+
+  /* Host build: 4 rows of two 4 column NEON vectors, one multiply-accumulate by a scalar of A
+   ** per row and column */
+  {
+    float32x4_t vB0, vB1;
+    float32x4_t vAcc00 = vdupq_n_f32(0.0f), vAcc01 = vdupq_n_f32(0.0f);
+    float32x4_t vAcc10 = vdupq_n_f32(0.0f), vAcc11 = vdupq_n_f32(0.0f);
+    float32x4_t vAcc20 = vdupq_n_f32(0.0f), vAcc21 = vdupq_n_f32(0.0f);
+    float32x4_t vAcc30 = vdupq_n_f32(0.0f), vAcc31 = vdupq_n_f32(0.0f);
+
+    for (k = 0u; k < depth; k++)
+    {
+      vB0 = vld1q_f32(pPanel);
+      vB1 = vld1q_f32(pPanel + 4);
+      vAcc00 = vmlaq_n_f32(vAcc00, vB0, pRow[0][k]);
+      vAcc01 = vmlaq_n_f32(vAcc01, vB1, pRow[0][k]);
+      vAcc10 = vmlaq_n_f32(vAcc10, vB0, pRow[1][k]);
+      vAcc11 = vmlaq_n_f32(vAcc11, vB1, pRow[1][k]);
+      vAcc20 = vmlaq_n_f32(vAcc20, vB0, pRow[2][k]);
+      vAcc21 = vmlaq_n_f32(vAcc21, vB1, pRow[2][k]);
+      vAcc30 = vmlaq_n_f32(vAcc30, vB0, pRow[3][k]);
+      vAcc31 = vmlaq_n_f32(vAcc31, vB1, pRow[3][k]);
+      pPanel += ARM_MAT_PACK_COLS;
+    }
+
+    vst1q_f32(tile, vAcc00);
+    vst1q_f32(tile + 4, vAcc01);
+    vst1q_f32(tile + 8, vAcc10);
+    vst1q_f32(tile + 12, vAcc11);
+    vst1q_f32(tile + 16, vAcc20);
+    vst1q_f32(tile + 20, vAcc21);
+    vst1q_f32(tile + 24, vAcc30);
+    vst1q_f32(tile + 28, vAcc31);
+  }
+
+#else
+
+  /* One row of ARM_MAT_PACK_COLS accumulators, one load of A per column */
+  {
+    float32_t a;
+    float32_t acc0 = 0.0f, acc1 = 0.0f, acc2 = 0.0f, acc3 = 0.0f;
+    float32_t acc4 = 0.0f, acc5 = 0.0f, acc6 = 0.0f, acc7 = 0.0f;
+
+    for (k = 0u; k < depth; k++)
+    {
+      a = pRow[0][k];
+      acc0 += a * pPanel[0];
+      acc1 += a * pPanel[1];
+      acc2 += a * pPanel[2];
+      acc3 += a * pPanel[3];
+      acc4 += a * pPanel[4];
+      acc5 += a * pPanel[5];
+      acc6 += a * pPanel[6];
+      acc7 += a * pPanel[7];
+      pPanel += ARM_MAT_PACK_COLS;
+    }
+
+    tile[0] = acc0;
+    tile[1] = acc1;
+    tile[2] = acc2;
+    tile[3] = acc3;
+    tile[4] = acc4;
+    tile[5] = acc5;
+    tile[6] = acc6;
+    tile[7] = acc7;
+  }
+
+#endif /* #if defined (ARM_MATH_AVX2) */
+
+  for (r = 0u; r < numRows; r++)
+  {
+    pOut = pC + (r * strideC);
+
+    for (c = 0u; c < numCols; c++)
+    {
+      pOut[c] = (accumulate != 0u) ? (pOut[c] + tile[(r * ARM_MAT_PACK_COLS) + c]) :
+        tile[(r * ARM_MAT_PACK_COLS) + c];
+    }
+  }
+}
+
+/**
+ * @brief  Cache blocked core of the floating-point matrix multiplication.
+ * @param[in]      *pA points to the numRowsA x numColsA values of the first matrix.
+ * @param[in]      *pB points to the second matrix, in rows or packed by arm_mat_pack_f32().
+ * @param[out]     *pC points to the numRowsA x numColsB values of the output.
+ * @param[in]      numRowsA number of rows of the first matrix.
+ * @param[in]      numColsA number of columns of the first matrix and rows of the second.
+ * @param[in]      numColsB number of columns of the second matrix.
+ * @param[in]      packedB set if pB is packed, clear if it is stored in rows.
+ * @return none.
+ *
+ * The second matrix is multiplied as panels of ARM_MAT_PACK_COLS columns, each read as
+ * contiguous rows of ARM_MAT_PACK_COLS values.  A matrix stored in rows is copied panel by
+ * panel into such a buffer on the stack, while a packed matrix is read in place.  The
+ * products are computed in blocks of ARM_MAT_BLOCK_DEPTH columns of A, so that a slice of a
+ * panel stays in the first level cache, and of ARM_MAT_BLOCK_ROWS rows, so that the block of
+ * A stays in the second level cache while it is multiplied with every panel.  Within a block
+ * each tile of ARM_MAT_TILE_ROWS x ARM_MAT_PACK_COLS outputs is accumulated in registers.
+ */
+
+void arm_mat_mult_blocked_f32(
+  const float32_t * pA,
+  const float32_t * pB,
+  float32_t * pC,
+  uint32_t numRowsA,
+  uint32_t numColsA,
+  uint32_t numColsB,
+  uint8_t packedB)
+{
+  float32_t panel[ARM_MAT_BLOCK_DEPTH * ARM_MAT_PACK_COLS];     /* slice of a panel of B stored in rows */
+  const float32_t *pPanel;                       /* slice of the current panel */
+  const float32_t *pIn;                          /* input pointer */
+  float32_t *pOut;                               /* output pointer */
+  uint32_t blockRow, blockCol;                   /* first row and column of A of the block */
+  uint32_t rows, depth;                          /* size of the block */
+  uint32_t row, col, numCols;                    /* tile position and width */
+  uint32_t k, c;                                 /* loop counters */
+
+  /* An empty inner dimension gives a zero output, as with the unblocked functions */
+  if(numColsA == 0u)
+  {
+    arm_fill_f32(0.0f, pC, numRowsA * numColsB);
+    return;
+  }
+
+  for (blockCol = 0u; blockCol < numColsA; blockCol += ARM_MAT_BLOCK_DEPTH)
+  {
+    depth = ((numColsA - blockCol) < ARM_MAT_BLOCK_DEPTH) ? (numColsA - blockCol) : ARM_MAT_BLOCK_DEPTH;
+
+    for (blockRow = 0u; blockRow < numRowsA; blockRow += ARM_MAT_BLOCK_ROWS)
+    {
+      rows = ((numRowsA - blockRow) < ARM_MAT_BLOCK_ROWS) ? (numRowsA - blockRow) : ARM_MAT_BLOCK_ROWS;
+
+      for (col = 0u; col < numColsB; col += ARM_MAT_PACK_COLS)
+      {
+        numCols = ((numColsB - col) < ARM_MAT_PACK_COLS) ? (numColsB - col) : ARM_MAT_PACK_COLS;
+
+        if(packedB != 0u)
+        {
+          /* The panel of the columns col... holds numColsA rows */
+          pPanel = pB + (col * numColsA) + (blockCol * ARM_MAT_PACK_COLS);
+        }
+        else
+        {
+          /* Copy the slice of the panel, with the missing columns of the last one set to zero */
+          pIn = pB + (blockCol * numColsB) + col;
+          pOut = panel;
+
+          for (k = 0u; k < depth; k++)
+          {
+            for (c = 0u; c < ARM_MAT_PACK_COLS; c++)
+            {
+              pOut[c] = (c < numCols) ? pIn[c] : 0.0f;
+            }
+
+            pIn += numColsB;
+            pOut += ARM_MAT_PACK_COLS;
+          }
+
+          pPanel = panel;
+        }
+
+        for (row = blockRow; row < (blockRow + rows); row += ARM_MAT_TILE_ROWS)
+        {
+          arm_mat_mult_tile_f32(pA + (row * numColsA) + blockCol, numColsA, pPanel,
+                                pC + (row * numColsB) + col, numColsB, depth,
+                                (((blockRow + rows) - row) < ARM_MAT_TILE_ROWS) ? ((blockRow + rows) - row) : ARM_MAT_TILE_ROWS,
+                                numCols, blockCol);
+        }
+      }
+    }
+  }
+}
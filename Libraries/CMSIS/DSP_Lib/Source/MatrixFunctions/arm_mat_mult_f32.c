@@ -186,6 +186,27 @@ arm_status arm_mat_mult_f32(
   uint16_t col, i = 0u, row = numRowsA, colCnt;  /* loop counters */
   arm_status status;                             /* status of matrix multiplication */
 
+#if defined (ARM_MATH_SSE2) || defined (ARM_MATH_NEON)
+
+  /* Host build: the cache blocked multiplication, with SIMD tiles kept in registers */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrcA->numCols != pSrcB->numRows) ||
+     (pSrcA->numRows != pDst->numRows) || (pSrcB->numCols != pDst->numCols))
+  {
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  arm_mat_mult_blocked_f32(pIn1, pInB, pOut, numRowsA, numColsA, numColsB, 0u);
+
+  return (ARM_MATH_SUCCESS);
+
+#endif /* #if defined (ARM_MATH_SSE2) || defined (ARM_MATH_NEON) */
+
 #ifdef ARM_MATH_MATRIX_CHECK
 
   /* Check for matrix mismatch condition */
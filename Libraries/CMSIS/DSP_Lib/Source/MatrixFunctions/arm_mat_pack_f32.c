@@ -0,0 +1,71 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_pack_f32.c
+*
+* Description:	Floating-point matrix packing for arm_mat_mult_packed_f32().
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixMult
+ * @{
+ */
+
+/**
+ * @brief Packs the second operand of arm_mat_mult_packed_f32().
+ * @param[in]       *pSrc points to the matrix to pack.
+ * @param[out]      *pPacked points to ARM_MAT_PACKED_SIZE_F32(numRows, numCols) values.
+ * @return none.
+ *
+ * \par
+ * The columns of the matrix are stored as panels of <code>ARM_MAT_PACK_COLS</code> columns,
+ * one after the other.  A panel holds the <code>numRows</code> rows of its columns in turn,
+ * and the columns of the last panel past <code>numCols</code> are set to zero:
+ * <pre>
+ *     pPacked[(j / ARM_MAT_PACK_COLS) * numRows * ARM_MAT_PACK_COLS + i * ARM_MAT_PACK_COLS + (j % ARM_MAT_PACK_COLS)] = B(i, j)
+ * </pre>
+ * A matrix that is multiplied many times, such as a set of filter weights, is packed once.
+ */
+
+void arm_mat_pack_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  float32_t * pPacked)
+{
+  float32_t *pIn;                                /* input data matrix pointer */
+  uint16_t numRows = pSrc->numRows;              /* number of rows of the matrix */
+  uint16_t numCols = pSrc->numCols;              /* number of columns of the matrix */
+  uint32_t col, row, c;                          /* loop counters */
+
+  /* panel loop */
+  for (col = 0u; col < numCols; col += ARM_MAT_PACK_COLS)
+  {
+    pIn = pSrc->pData + col;
+
+    /* row loop */
+    for (row = 0u; row < numRows; row++)
+    {
+      for (c = 0u; c < ARM_MAT_PACK_COLS; c++)
+      {
+        *pPacked++ = ((col + c) < numCols) ? pIn[c] : 0.0f;
+      }
+
+      pIn += numCols;
+    }
+  }
+}
+
+/**
+ * @} end of MatrixMult group
+ */
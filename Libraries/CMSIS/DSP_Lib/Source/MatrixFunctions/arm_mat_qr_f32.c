@@ -0,0 +1,173 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_qr_f32.c
+*
+* Description:	Floating-point Householder QR decomposition.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixQR QR Decomposition
+ *
+ * Factors an <code>M x N</code> matrix, <code>M >= N</code>, as <code>A = Q * R</code>
+ * and solves linear least-squares problems with the factors.
+ *
+ * <code>Q</code> is an <code>M x M</code> orthogonal matrix and <code>R</code> an
+ * <code>M x N</code> upper triangular one.  As <code>Q</code> does not change the norm
+ * of a vector, the least-squares solution of <code>A * X = B</code> is found from
+ * <code>R * X = Q' * B</code> without forming the normal equations
+ * <code>A' * A * X = A' * B</code>, which square the condition number of the problem.
+ * The decomposition takes about twice the operations of arm_mat_lu_f32() on a square
+ * matrix and is the most robust of the three decompositions.
+ *
+ * The decomposition works in place.  <code>R</code> replaces the upper triangle and the
+ * diagonal of <code>A</code>.  <code>Q</code> is kept as the product of <code>N</code>
+ * Householder reflections <code>H(k) = I - tau(k) * v * v'</code>, where
+ * <code>v(k) = 1</code>, the elements of <code>v</code> below <code>k</code> are stored
+ * below the diagonal in column <code>k</code> and <code>tau(k)</code> is returned in
+ * <code>pTau</code>.
+ *
+ * \par Algorithm
+ * The reflection <code>H(k)</code> maps the column <code>k</code> on and below the
+ * diagonal to <code>beta * e(k)</code>, with <code>|beta|</code> the norm of the column
+ * and the sign of <code>beta</code> opposite to that of the diagonal element, so that no
+ * cancellation occurs, and is applied to the columns on the right.  A column that is
+ * already zero below the diagonal gives <code>tau(k) = 0</code>.
+ */
+
+/**
+ * @addtogroup MatrixQR
+ * @{
+ */
+
+/**
+ * @brief Floating-point Householder QR decomposition.
+ * @param[in,out]   *pSrc points to the M x N matrix structure, overwritten by the factors
+ * @param[out]      *pTau points to N values, the scale factors of the reflections
+ * @return     		The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the
+ * matrix has fewer rows than columns and <code>ARM_MATH_SUCCESS</code> otherwise.
+ *
+ * \par
+ * A rank deficient matrix is decomposed as well and shows as zeros on the diagonal of
+ * <code>R</code>, which arm_mat_qr_solve_f32() reports.
+ */
+
+arm_status arm_mat_qr_f32(
+  arm_matrix_instance_f32 * pSrc,
+  float32_t * pTau)
+{
+  float32_t *pRowK, *pRowI;                      /* row k and row below it */
+  float32_t alpha, beta, sumSq, in, tau;         /* Temporary variables */
+  uint32_t numRows = pSrc->numRows;              /* number of rows of the matrix */
+  uint32_t numCols = pSrc->numCols;              /* number of columns of the matrix */
+  uint32_t k, i, j;                              /* loop counters */
+  arm_status status;                             /* status of the decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if(pSrc->numRows < pSrc->numCols)
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    for (k = 0u; k < numCols; k++)
+    {
+      pRowK = pSrc->pData + (k * numCols);
+      alpha = pRowK[k];
+
+      /* Sum of the squares of the column below the diagonal */
+      sumSq = 0.0f;
+
+      for (i = k + 1u; i < numRows; i++)
+      {
+        in = pSrc->pData[(i * numCols) + k];
+        sumSq += in * in;
+      }
+
+      if(sumSq == 0.0f)
+      {
+        /* Nothing to eliminate, H(k) = I */
+        pTau[k] = 0.0f;
+      }
+      else
+      {
+        arm_sqrt_f32((alpha * alpha) + sumSq, &beta);
+        beta = (alpha >= 0.0f) ? -beta : beta;
+        tau = (beta - alpha) / beta;
+        pTau[k] = tau;
+
+        /* v = x / (alpha - beta), with v(k) = 1 implied */
+        in = 1.0f / (alpha - beta);
+
+        for (i = k + 1u; i < numRows; i++)
+        {
+          pSrc->pData[(i * numCols) + k] *= in;
+        }
+
+        pRowK[k] = beta;
+
+        /* Apply H(k) to the columns on the right: w' = v' * A, A -= tau * v * w'.
+         ** w is kept in the entries of pTau that are not computed yet. */
+        for (j = k + 1u; j < numCols; j++)
+        {
+          pTau[j] = pRowK[j];
+        }
+
+        for (i = k + 1u; i < numRows; i++)
+        {
+          pRowI = pSrc->pData + (i * numCols);
+          in = pRowI[k];
+
+          for (j = k + 1u; j < numCols; j++)
+          {
+            pTau[j] += in * pRowI[j];
+          }
+        }
+
+        for (j = k + 1u; j < numCols; j++)
+        {
+          pTau[j] *= tau;
+          pRowK[j] -= pTau[j];
+        }
+
+        for (i = k + 1u; i < numRows; i++)
+        {
+          pRowI = pSrc->pData + (i * numCols);
+          in = pRowI[k];
+
+          for (j = k + 1u; j < numCols; j++)
+          {
+            pRowI[j] -= in * pTau[j];
+          }
+        }
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixQR group
+ */
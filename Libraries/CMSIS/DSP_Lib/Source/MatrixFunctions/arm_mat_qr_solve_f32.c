@@ -0,0 +1,118 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_qr_solve_f32.c
+*
+* Description:	Floating-point least-squares solve with the QR factors.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixQR
+ * @{
+ */
+
+/**
+ * @brief Floating-point least-squares solve with the QR factors.
+ * @param[in]       *pQR points to the M x N factors computed by arm_mat_qr_f32()
+ * @param[in]       *pTau points to the N scale factors computed by arm_mat_qr_f32()
+ * @param[in]       *pB points to the M x P right-hand side matrix structure
+ * @param[out]      *pX points to the N x P solution matrix structure
+ * @param[in]       *pScratch points to a work buffer of M values
+ * @return     		The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the
+ * dimensions do not match, <code>ARM_MATH_SINGULAR</code> if <code>R</code> has a zero
+ * on its diagonal and <code>ARM_MATH_SUCCESS</code> otherwise.
+ *
+ * \par
+ * Each column of <code>X</code> minimizes the norm of the residual
+ * <code>A * x - b</code> for the same column of <code>B</code>; for a square
+ * <code>A</code> it is the solution of the system.  The reflections are applied to each
+ * column of <code>B</code> in <code>pScratch</code>, and <code>R * X = Q' * B</code> is
+ * solved by arm_mat_solve_upper_triangular_f32() on the first <code>N</code> rows.
+ */
+
+arm_status arm_mat_qr_solve_f32(
+  const arm_matrix_instance_f32 * pQR,
+  const float32_t * pTau,
+  const arm_matrix_instance_f32 * pB,
+  arm_matrix_instance_f32 * pX,
+  float32_t * pScratch)
+{
+  arm_matrix_instance_f32 R;                     /* the N x N upper triangle of the factors */
+  float32_t *pV;                                 /* column k of the reflections */
+  float32_t w;                                   /* Temporary variable */
+  uint32_t numRows = pQR->numRows;               /* number of rows of the system */
+  uint32_t numCols = pQR->numCols;               /* number of unknowns */
+  uint32_t numRhs = pB->numCols;                 /* number of right-hand sides */
+  uint32_t c, k, i;                              /* loop counters */
+  arm_status status;                             /* status of the solve */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pQR->numRows < pQR->numCols) || (pB->numRows != pQR->numRows) ||
+     (pX->numRows != pQR->numCols) || (pX->numCols != pB->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    for (c = 0u; c < numRhs; c++)
+    {
+      for (i = 0u; i < numRows; i++)
+      {
+        pScratch[i] = pB->pData[(i * numRhs) + c];
+      }
+
+      /* y = Q' * b = H(N - 1) * ... * H(0) * b */
+      for (k = 0u; k < numCols; k++)
+      {
+        pV = pQR->pData + k;
+        w = pScratch[k];
+
+        for (i = k + 1u; i < numRows; i++)
+        {
+          w += pV[i * numCols] * pScratch[i];
+        }
+
+        w *= pTau[k];
+        pScratch[k] -= w;
+
+        for (i = k + 1u; i < numRows; i++)
+        {
+          pScratch[i] -= pV[i * numCols] * w;
+        }
+      }
+
+      for (i = 0u; i < numCols; i++)
+      {
+        pX->pData[(i * numRhs) + c] = pScratch[i];
+      }
+    }
+
+    /* R * X = the first N rows of Q' * B */
+    arm_mat_init_f32(&R, (uint16_t) numCols, (uint16_t) numCols, pQR->pData);
+    status = arm_mat_solve_upper_triangular_f32(&R, pX, pX, 0u);
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixQR group
+ */
@@ -0,0 +1,140 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_solve_lower_triangular_f32.c
+*
+* Description:	Floating-point forward substitution.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixTriSolve Triangular Solve
+ *
+ * Solves <code>T * X = B</code> for a triangular matrix <code>T</code>.
+ *
+ * <code>T</code> is an <code>N x N</code> matrix of which only the lower (forward
+ * substitution) or the upper (back substitution) triangle is read, so the factors left
+ * in place by arm_mat_lu_f32() and arm_mat_ldlt_f32() and the <code>R</code> factor of
+ * arm_mat_qr_f32() can be passed as they are.  With <code>unitDiagonal</code> set the
+ * diagonal is not read either and is taken as 1.
+ * <code>B</code> and <code>X</code> are <code>N x M</code> matrices, so <code>M</code>
+ * systems sharing <code>T</code> are solved in one call, and <code>X</code> may be the
+ * same matrix as <code>B</code>.
+ *
+ * \par Algorithm
+ * Forward substitution computes the rows of <code>X</code> from the first one:
+ * <pre>
+ *     X(i, :) = (B(i, :) - sum(T(i, j) * X(j, :), j = 0 .. i - 1)) / T(i, i)
+ * </pre>
+ * and back substitution from the last one, with the sum over <code>j > i</code>.
+ * Each step updates a whole row of <code>X</code>, so the inner loops run over
+ * contiguous data.  A zero on the diagonal stops the solve and returns
+ * <code>ARM_MATH_SINGULAR</code>.
+ */
+
+/**
+ * @addtogroup MatrixTriSolve
+ * @{
+ */
+
+/**
+ * @brief Floating-point forward substitution.
+ * @param[in]       *pL points to the lower triangular matrix structure
+ * @param[in]       *pB points to the right-hand side matrix structure
+ * @param[out]      *pX points to the solution matrix structure, which may be pB
+ * @param[in]       unitDiagonal set if the diagonal of pL is 1 and not stored.
+ * @return     		The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the
+ * dimensions do not match, <code>ARM_MATH_SINGULAR</code> if a diagonal element is zero
+ * and <code>ARM_MATH_SUCCESS</code> otherwise.
+ */
+
+arm_status arm_mat_solve_lower_triangular_f32(
+  const arm_matrix_instance_f32 * pL,
+  const arm_matrix_instance_f32 * pB,
+  arm_matrix_instance_f32 * pX,
+  uint8_t unitDiagonal)
+{
+  float32_t *pRowL;                              /* row of the triangular matrix */
+  float32_t *pRowX;                              /* row of the solution being computed */
+  float32_t *pPrevX;                             /* row of the solution already computed */
+  float32_t in;                                  /* Temporary variable */
+  uint32_t numRows = pL->numRows;                /* number of rows of the system */
+  uint32_t numCols = pB->numCols;                /* number of right-hand sides */
+  uint32_t i, j, c;                              /* loop counters */
+  arm_status status;                             /* status of the solve */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pL->numRows != pL->numCols) || (pB->numRows != pL->numRows) ||
+     (pX->numRows != pB->numRows) || (pX->numCols != pB->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    status = ARM_MATH_SUCCESS;
+
+    for (i = 0u; (i < numRows) && (status == ARM_MATH_SUCCESS); i++)
+    {
+      pRowL = pL->pData + (i * numRows);
+      pRowX = pX->pData + (i * numCols);
+
+      if(pX->pData != pB->pData)
+      {
+        arm_copy_f32(pB->pData + (i * numCols), pRowX, numCols);
+      }
+
+      /* X(i, :) -= T(i, j) * X(j, :) for the rows already solved */
+      for (j = 0u; j < i; j++)
+      {
+        in = pRowL[j];
+        pPrevX = pX->pData + (j * numCols);
+
+        for (c = 0u; c < numCols; c++)
+        {
+          pRowX[c] -= in * pPrevX[c];
+        }
+      }
+
+      if(unitDiagonal == 0u)
+      {
+        in = pRowL[i];
+
+        if(in == 0.0f)
+        {
+          /* Set status as ARM_MATH_SINGULAR */
+          status = ARM_MATH_SINGULAR;
+        }
+        else
+        {
+          for (c = 0u; c < numCols; c++)
+          {
+            pRowX[c] /= in;
+          }
+        }
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixTriSolve group
+ */
@@ -0,0 +1,115 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_solve_upper_triangular_f32.c
+*
+* Description:	Floating-point back substitution.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixTriSolve
+ * @{
+ */
+
+/**
+ * @brief Floating-point back substitution.
+ * @param[in]       *pU points to the upper triangular matrix structure
+ * @param[in]       *pB points to the right-hand side matrix structure
+ * @param[out]      *pX points to the solution matrix structure, which may be pB
+ * @param[in]       unitDiagonal set if the diagonal of pU is 1 and not stored.
+ * @return     		The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the
+ * dimensions do not match, <code>ARM_MATH_SINGULAR</code> if a diagonal element is zero
+ * and <code>ARM_MATH_SUCCESS</code> otherwise.
+ */
+
+arm_status arm_mat_solve_upper_triangular_f32(
+  const arm_matrix_instance_f32 * pU,
+  const arm_matrix_instance_f32 * pB,
+  arm_matrix_instance_f32 * pX,
+  uint8_t unitDiagonal)
+{
+  float32_t *pRowU;                              /* row of the triangular matrix */
+  float32_t *pRowX;                              /* row of the solution being computed */
+  float32_t *pPrevX;                             /* row of the solution already computed */
+  float32_t in;                                  /* Temporary variable */
+  uint32_t numRows = pU->numRows;                /* number of rows of the system */
+  uint32_t numCols = pB->numCols;                /* number of right-hand sides */
+  uint32_t i, j, c;                              /* loop counters */
+  arm_status status;                             /* status of the solve */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pU->numRows != pU->numCols) || (pB->numRows != pU->numRows) ||
+     (pX->numRows != pB->numRows) || (pX->numCols != pB->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    status = ARM_MATH_SUCCESS;
+
+    for (i = numRows; (i > 0u) && (status == ARM_MATH_SUCCESS); i--)
+    {
+      pRowU = pU->pData + ((i - 1u) * numRows);
+      pRowX = pX->pData + ((i - 1u) * numCols);
+
+      if(pX->pData != pB->pData)
+      {
+        arm_copy_f32(pB->pData + ((i - 1u) * numCols), pRowX, numCols);
+      }
+
+      /* X(i, :) -= T(i, j) * X(j, :) for the rows already solved */
+      for (j = i; j < numRows; j++)
+      {
+        in = pRowU[j];
+        pPrevX = pX->pData + (j * numCols);
+
+        for (c = 0u; c < numCols; c++)
+        {
+          pRowX[c] -= in * pPrevX[c];
+        }
+      }
+
+      if(unitDiagonal == 0u)
+      {
+        in = pRowU[i - 1u];
+
+        if(in == 0.0f)
+        {
+          /* Set status as ARM_MATH_SINGULAR */
+          status = ARM_MATH_SINGULAR;
+        }
+        else
+        {
+          for (c = 0u; c < numCols; c++)
+          {
+            pRowX[c] /= in;
+          }
+        }
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixTriSolve group
+ */
@@ -0,0 +1,130 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_histogram_f32.c
+*
+* Description:	Histogram of floating-point data.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @defgroup Histogram Histogram
+ *
+ * Counts the samples of a stream in equally spaced bins.  The counts live in an array
+ * supplied by the user which is cleared by the init function, and each call adds the
+ * samples of one block, with one pass over the block.
+ *
+ * Two histograms with the same bins can be merged by adding their counts, so the
+ * histogram of a long record can be built in parts, on several tasks or cores.
+ *
+ * The floating-point histogram covers any range from <code>minVal</code> to
+ * <code>maxVal</code> with any number of bins; the samples outside the range are
+ * counted in the first or the last bin.  The fixed-point histograms cover the whole
+ * range of the data type with a power of 2 number of bins, so the bin of a sample is
+ * its offset binary value shifted right, and no sample can fall outside.
+ */
+
+/**
+ * @addtogroup Histogram
+ * @{
+ */
+
+/**
+ * @brief Adds a block of floating-point samples to a histogram.
+ * @param[in,out]   *S points to an instance of the floating-point histogram
+ * @param[in]       *pSrc points to the block of input data
+ * @param[in]       blockSize number of samples in the block
+ * @return none.
+ */
+
+void arm_histogram_f32(
+  const arm_histogram_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize)
+{
+  uint32_t *pCounts = S->pCounts;                /* Bin counts */
+  float32_t minVal = S->minVal;                  /* Lower edge of the first bin */
+  float32_t scale = S->scale;                    /* Bins per unit */
+  float32_t last = (float32_t) (S->numBins - 1u);        /* Index of the last bin */
+  float32_t bin;                                 /* Bin of the current sample */
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 samples at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* Clamp to the edge bins, a NaN to the first one, before the conversion to an index */
+    bin = (*pSrc++ - minVal) * scale;
+    bin = (bin >= 0.0f) ? bin : 0.0f;
+    bin = (bin <= last) ? bin : last;
+    pCounts[(uint32_t) bin]++;
+
+    /* Clamp to the edge bins, a NaN to the first one, before the conversion to an index */
+    bin = (*pSrc++ - minVal) * scale;
+    bin = (bin >= 0.0f) ? bin : 0.0f;
+    bin = (bin <= last) ? bin : last;
+    pCounts[(uint32_t) bin]++;
+
+    /* Clamp to the edge bins, a NaN to the first one, before the conversion to an index */
+    bin = (*pSrc++ - minVal) * scale;
+    bin = (bin >= 0.0f) ? bin : 0.0f;
+    bin = (bin <= last) ? bin : last;
+    pCounts[(uint32_t) bin]++;
+
+    /* Clamp to the edge bins, a NaN to the first one, before the conversion to an index */
+    bin = (*pSrc++ - minVal) * scale;
+    bin = (bin >= 0.0f) ? bin : 0.0f;
+    bin = (bin <= last) ? bin : last;
+    pCounts[(uint32_t) bin]++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    /* Clamp to the edge bins, a NaN to the first one, before the conversion to an index */
+    bin = (*pSrc++ - minVal) * scale;
+    bin = (bin >= 0.0f) ? bin : 0.0f;
+    bin = (bin <= last) ? bin : last;
+    pCounts[(uint32_t) bin]++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of Histogram group
+ */
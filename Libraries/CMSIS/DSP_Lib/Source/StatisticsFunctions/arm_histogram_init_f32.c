@@ -0,0 +1,66 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_histogram_init_f32.c
+*
+* Description:	Floating-point histogram initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Histogram
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point histogram.
+ * @param[out] *S points to an instance of the floating-point histogram.
+ * @param[in]  numBins number of bins.
+ * @param[in]  minVal lower edge of the first bin.
+ * @param[in]  maxVal upper edge of the last bin.
+ * @param[in]  *pCounts points to an array of <code>numBins</code> counts.
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+ * <code>numBins</code> is 0 or <code>maxVal</code> is not above <code>minVal</code>.
+ */
+
+arm_status arm_histogram_init_f32(
+  arm_histogram_instance_f32 * S,
+  uint32_t numBins,
+  float32_t minVal,
+  float32_t maxVal,
+  uint32_t * pCounts)
+{
+  if((numBins == 0u) || !(maxVal > minVal))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->numBins = numBins;
+  S->minVal = minVal;
+
+  /* The bin of a sample is (x - minVal) * scale, truncated */
+  S->scale = (float32_t) numBins / (maxVal - minVal);
+
+  /* Clear the counts */
+  memset(pCounts, 0, numBins * sizeof(uint32_t));
+
+  /* Assign the count pointer */
+  S->pCounts = pCounts;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Histogram group
+ */
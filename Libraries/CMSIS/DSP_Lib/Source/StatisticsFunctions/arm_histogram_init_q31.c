@@ -0,0 +1,69 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_histogram_init_q31.c
+*
+* Description:	Q31 histogram initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Histogram
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 histogram.
+ * @param[out] *S points to an instance of the Q31 histogram.
+ * @param[in]  numBins number of bins, a power of 2 from 1 to 65536.
+ * @param[in]  *pCounts points to an array of <code>numBins</code> counts.
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+ * <code>numBins</code> is not a power of 2 from 1 to 65536.
+ */
+
+arm_status arm_histogram_init_q31(
+  arm_histogram_instance_q31 * S,
+  uint32_t numBins,
+  uint32_t * pCounts)
+{
+  uint8_t shift = 16u;                           /* Shift of a 16-bit offset binary sample to its bin */
+  uint32_t bins = 1u;                            /* Number of bins for the shift */
+
+  /* Find the shift which leaves numBins values */
+  while((bins < numBins) && (shift > 0u))
+  {
+    bins <<= 1u;
+    shift--;
+  }
+
+  if(bins != numBins)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->numBins = numBins;
+  S->shift = shift;
+
+  /* Clear the counts */
+  memset(pCounts, 0, numBins * sizeof(uint32_t));
+
+  /* Assign the count pointer */
+  S->pCounts = pCounts;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Histogram group
+ */
@@ -0,0 +1,65 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_histogram_merge_f32.c
+*
+* Description:	Merges two floating-point histograms.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Histogram
+ * @{
+ */
+
+/**
+ * @brief Adds the counts of a floating-point histogram to another one with the same bins.
+ * @param[in,out]   *S points to the histogram that receives the counts
+ * @param[in]       *pOther points to the histogram that is added
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_SIZE_MISMATCH if the two
+ * histograms do not have the same number of bins over the same range.
+ */
+
+arm_status arm_histogram_merge_f32(
+  const arm_histogram_instance_f32 * S,
+  const arm_histogram_instance_f32 * pOther)
+{
+  uint32_t *pDst;                                /* Counts of the merged histogram */
+  uint32_t *pSrc;                                /* Counts of the added histogram */
+  uint32_t blkCnt;                               /* loop counter */
+
+  if((S->numBins != pOther->numBins) || (S->minVal != pOther->minVal) || (S->scale != pOther->scale))
+  {
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+  /* Add the counts bin by bin */
+  pDst = S->pCounts;
+  pSrc = pOther->pCounts;
+  blkCnt = S->numBins;
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ += *pSrc++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Histogram group
+ */
@@ -0,0 +1,99 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_histogram_q31.c
+*
+* Description:	Histogram of Q31 data.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Histogram
+ * @{
+ */
+
+/**
+ * @brief Adds a block of Q31 samples to a histogram.
+ * @param[in,out]   *S points to an instance of the Q31 histogram
+ * @param[in]       *pSrc points to the block of input data
+ * @param[in]       blockSize number of samples in the block
+ * @return none.
+ *
+ * \par
+ * Bin k counts the samples from -1 + k * 2 / numBins up to, but not including,
+ * -1 + (k + 1) * 2 / numBins.
+ */
+
+void arm_histogram_q31(
+  const arm_histogram_instance_q31 * S,
+  q31_t * pSrc,
+  uint32_t blockSize)
+{
+  uint32_t *pCounts = S->pCounts;                /* Bin counts */
+  uint8_t shift = S->shift;                      /* Shift of the offset binary sample to its bin */
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 samples at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* Offset binary value of the sample, truncated to 16 bits and shifted to its bin */
+    pCounts[(((uint32_t) *pSrc++ + 0x80000000u) >> 16u) >> shift]++;
+
+    /* Offset binary value of the sample, truncated to 16 bits and shifted to its bin */
+    pCounts[(((uint32_t) *pSrc++ + 0x80000000u) >> 16u) >> shift]++;
+
+    /* Offset binary value of the sample, truncated to 16 bits and shifted to its bin */
+    pCounts[(((uint32_t) *pSrc++ + 0x80000000u) >> 16u) >> shift]++;
+
+    /* Offset binary value of the sample, truncated to 16 bits and shifted to its bin */
+    pCounts[(((uint32_t) *pSrc++ + 0x80000000u) >> 16u) >> shift]++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    /* Offset binary value of the sample, truncated to 16 bits and shifted to its bin */
+    pCounts[(((uint32_t) *pSrc++ + 0x80000000u) >> 16u) >> shift]++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of Histogram group
+ */
@@ -98,9 +98,63 @@ void arm_mean_f32(
 
   /* Run the below code for Cortex-M0 */
 
+#if defined (ARM_MATH_SSE2)
+
+  /* Host build: sum 4 samples per SSE2 operation */
+  {
+    __m128 vSum = _mm_setzero_ps();
+
+    blkCnt = blockSize >> 2u;
+
+    while(blkCnt > 0u)
+    {
+      vSum = _mm_add_ps(vSum, _mm_loadu_ps(pSrc));
+      pSrc += 4u;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Add the 4 partial sums */
+    vSum = _mm_add_ps(vSum, _mm_movehl_ps(vSum, vSum));
+    vSum = _mm_add_ss(vSum, _mm_shuffle_ps(vSum, vSum, 0x55));
+    sum = _mm_cvtss_f32(vSum);
+  }
+
+  /* Compute the remaining 1 to 3 samples below */
+  blkCnt = blockSize % 0x4u;
+
+#elif defined (ARM_MATH_NEON)
+
+  /* Host build: sum 4 samples per NEON operation */
+  {
+    float32x4_t vSum = vdupq_n_f32(0.0f);
+
+    blkCnt = blockSize >> 2u;
+
+    while(blkCnt > 0u)
+    {
+      vSum = vaddq_f32(vSum, vld1q_f32(pSrc));
+      pSrc += 4u;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Add the 4 partial sums */
+    sum = vaddvq_f32(vSum);
+  }
+
+  /* Compute the remaining 1 to 3 samples below */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
   /* Loop over blockSize number of values */
   blkCnt = blockSize;
 
+#endif /* #if defined (ARM_MATH_SSE2) */
+
 #endif /* #ifndef ARM_MATH_CM0 */
 
   while(blkCnt > 0u)
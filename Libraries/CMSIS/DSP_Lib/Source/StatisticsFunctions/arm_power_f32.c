@@ -109,9 +109,65 @@ void arm_power_f32(
 
   /* Run the below code for Cortex-M0 */
 
+#if defined (ARM_MATH_SSE2)
+
+  /* Host build: square and accumulate 4 samples per SSE2 operation */
+  {
+    __m128 vIn, vSum = _mm_setzero_ps();
+
+    blkCnt = blockSize >> 2u;
+
+    while(blkCnt > 0u)
+    {
+      vIn = _mm_loadu_ps(pSrc);
+      vSum = _mm_add_ps(vSum, _mm_mul_ps(vIn, vIn));
+      pSrc += 4u;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Add the 4 partial sums */
+    vSum = _mm_add_ps(vSum, _mm_movehl_ps(vSum, vSum));
+    vSum = _mm_add_ss(vSum, _mm_shuffle_ps(vSum, vSum, 0x55));
+    sum = _mm_cvtss_f32(vSum);
+  }
+
+  /* Compute the remaining 1 to 3 samples below */
+  blkCnt = blockSize % 0x4u;
+
+#elif defined (ARM_MATH_NEON)
+
+  /* Host build: square and accumulate 4 samples per NEON operation */
+  {
+    float32x4_t vIn, vSum = vdupq_n_f32(0.0f);
+
+    blkCnt = blockSize >> 2u;
+
+    while(blkCnt > 0u)
+    {
+      vIn = vld1q_f32(pSrc);
+      vSum = vmlaq_f32(vSum, vIn, vIn);
+      pSrc += 4u;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Add the 4 partial sums */
+    sum = vaddvq_f32(vSum);
+  }
+
+  /* Compute the remaining 1 to 3 samples below */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
   /* Loop over blockSize number of values */
   blkCnt = blockSize;
 
+#endif /* #if defined (ARM_MATH_SSE2) */
+
 #endif /* #ifndef ARM_MATH_CM0 */
 
 
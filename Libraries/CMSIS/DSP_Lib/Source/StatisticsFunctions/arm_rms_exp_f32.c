@@ -0,0 +1,130 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_rms_exp_f32.c
+*
+* Description:	Exponential RMS of floating-point data.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @defgroup ExpRMS Exponential RMS
+ *
+ * Tracks the RMS level of a stream with a first order recursive average of the squares:
+ * <pre>
+ *     ms[n] = ms[n-1] + coeff * (x[n]^2 - ms[n-1])
+ *     rms[n] = sqrt(ms[n])
+ * </pre>
+ * The state carries over from block to block, so the result does not depend on how the
+ * stream is cut into blocks, and the square root is only taken once per block, for the
+ * last sample.  The time constant is about 1 / coeff samples; a coefficient of
+ * 1 - exp(-1 / (tau * fs)) gives a time constant of tau seconds at the sample rate fs.
+ *
+ * The average is ordered in time, so two instances cannot be merged like the streaming
+ * statistics accumulators.
+ *
+ * \par Fixed-Point Behavior
+ * The coefficient is in 1.31 format for both fixed-point versions.  The Q15 version
+ * keeps the mean of the squares in 2.30 format, exact for the squares of the samples.
+ * The Q31 version truncates the squares to 1.31 format, saturating the square of
+ * 0x80000000, and keeps the mean of the squares in 1.31 format.  The product with the
+ * coefficient is truncated, which lets the average of a silent input decay to zero.
+ */
+
+/**
+ * @addtogroup ExpRMS
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point exponential RMS.
+ * @param[in,out]   *S points to an instance of the floating-point exponential RMS
+ * @param[in]       *pSrc points to the block of input data
+ * @param[in]       blockSize number of samples in the block
+ * @param[out]      *pResult RMS after the last sample of the block
+ * @return none.
+ */
+
+void arm_rms_exp_f32(
+  arm_rms_exp_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pResult)
+{
+  float32_t coeff = S->coeff;                    /* Smoothing coefficient */
+  float32_t meanSquare = S->meanSquare;          /* Smoothed mean of the squares */
+  float32_t in;                                  /* Temporary variable */
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 samples at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* ms += coeff * (x^2 - ms) */
+    in = *pSrc++;
+    meanSquare += coeff * (in * in - meanSquare);
+
+    /* ms += coeff * (x^2 - ms) */
+    in = *pSrc++;
+    meanSquare += coeff * (in * in - meanSquare);
+
+    /* ms += coeff * (x^2 - ms) */
+    in = *pSrc++;
+    meanSquare += coeff * (in * in - meanSquare);
+
+    /* ms += coeff * (x^2 - ms) */
+    in = *pSrc++;
+    meanSquare += coeff * (in * in - meanSquare);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    /* ms += coeff * (x^2 - ms) */
+    in = *pSrc++;
+    meanSquare += coeff * (in * in - meanSquare);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  S->meanSquare = meanSquare;
+  arm_sqrt_f32(meanSquare, pResult);
+}
+
+/**
+ * @} end of ExpRMS group
+ */
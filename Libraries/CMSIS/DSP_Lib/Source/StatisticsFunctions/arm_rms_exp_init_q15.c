@@ -0,0 +1,46 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_rms_exp_init_q15.c
+*
+* Description:	Q15 exponential RMS initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup ExpRMS
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 exponential RMS.
+ * @param[out] *S points to an instance of the Q15 exponential RMS.
+ * @param[in]  coeff smoothing coefficient per sample, in 1.31 format.
+ * @return none.
+ */
+
+void arm_rms_exp_init_q15(
+  arm_rms_exp_instance_q15 * S,
+  q31_t coeff)
+{
+  /* Assign the smoothing coefficient */
+  S->coeff = coeff;
+
+  /* The average starts from silence */
+  S->meanSquare = 0;
+}
+
+/**
+ * @} end of ExpRMS group
+ */
@@ -0,0 +1,114 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_rms_exp_q15.c
+*
+* Description:	Exponential RMS of Q15 data.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup ExpRMS
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q15 exponential RMS.
+ * @param[in,out]   *S points to an instance of the Q15 exponential RMS
+ * @param[in]       *pSrc points to the block of input data
+ * @param[in]       blockSize number of samples in the block
+ * @param[out]      *pResult RMS after the last sample of the block
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The squares are computed in 2.30 format and the difference with the mean of the
+ * squares cannot overflow 32 bits.  The RMS is the square root of the 2.30 mean of the
+ * squares, saturated to 1.31 format, truncated to 1.15 format.
+ */
+
+void arm_rms_exp_q15(
+  arm_rms_exp_instance_q15 * S,
+  q15_t * pSrc,
+  uint32_t blockSize,
+  q15_t * pResult)
+{
+  q31_t coeff = S->coeff;                        /* Smoothing coefficient */
+  q31_t meanSquare = S->meanSquare;              /* Smoothed mean of the squares */
+  q31_t root;                                    /* Square root in 1.31 format */
+  q15_t in;                                      /* Temporary variable */
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 samples at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* ms += coeff * (x^2 - ms) */
+    in = *pSrc++;
+    meanSquare += (q31_t) (((q63_t) coeff * (((q31_t) in * in) - meanSquare)) >> 31);
+
+    /* ms += coeff * (x^2 - ms) */
+    in = *pSrc++;
+    meanSquare += (q31_t) (((q63_t) coeff * (((q31_t) in * in) - meanSquare)) >> 31);
+
+    /* ms += coeff * (x^2 - ms) */
+    in = *pSrc++;
+    meanSquare += (q31_t) (((q63_t) coeff * (((q31_t) in * in) - meanSquare)) >> 31);
+
+    /* ms += coeff * (x^2 - ms) */
+    in = *pSrc++;
+    meanSquare += (q31_t) (((q63_t) coeff * (((q31_t) in * in) - meanSquare)) >> 31);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    /* ms += coeff * (x^2 - ms) */
+    in = *pSrc++;
+    meanSquare += (q31_t) (((q63_t) coeff * (((q31_t) in * in) - meanSquare)) >> 31);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  S->meanSquare = meanSquare;
+  arm_sqrt_q31(clip_q63_to_q31((q63_t) meanSquare << 1), &root);
+  *pResult = (q15_t) (root >> 16);
+}
+
+/**
+ * @} end of ExpRMS group
+ */
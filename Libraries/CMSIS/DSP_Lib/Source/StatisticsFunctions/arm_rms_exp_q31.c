@@ -0,0 +1,116 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_rms_exp_q31.c
+*
+* Description:	Exponential RMS of Q31 data.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup ExpRMS
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q31 exponential RMS.
+ * @param[in,out]   *S points to an instance of the Q31 exponential RMS
+ * @param[in]       *pSrc points to the block of input data
+ * @param[in]       blockSize number of samples in the block
+ * @param[out]      *pResult RMS after the last sample of the block
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The squares are truncated to 1.31 format and saturated.  The squares and the mean of
+ * the squares are positive, so their difference cannot overflow 32 bits.
+ */
+
+void arm_rms_exp_q31(
+  arm_rms_exp_instance_q31 * S,
+  q31_t * pSrc,
+  uint32_t blockSize,
+  q31_t * pResult)
+{
+  q31_t coeff = S->coeff;                        /* Smoothing coefficient */
+  q31_t meanSquare = S->meanSquare;              /* Smoothed mean of the squares */
+  q31_t in;                                      /* Temporary variable */
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 samples at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* ms += coeff * (x^2 - ms) */
+    in = *pSrc++;
+    in = clip_q63_to_q31(((q63_t) in * in) >> 31);
+    meanSquare += (q31_t) (((q63_t) coeff * (in - meanSquare)) >> 31);
+
+    /* ms += coeff * (x^2 - ms) */
+    in = *pSrc++;
+    in = clip_q63_to_q31(((q63_t) in * in) >> 31);
+    meanSquare += (q31_t) (((q63_t) coeff * (in - meanSquare)) >> 31);
+
+    /* ms += coeff * (x^2 - ms) */
+    in = *pSrc++;
+    in = clip_q63_to_q31(((q63_t) in * in) >> 31);
+    meanSquare += (q31_t) (((q63_t) coeff * (in - meanSquare)) >> 31);
+
+    /* ms += coeff * (x^2 - ms) */
+    in = *pSrc++;
+    in = clip_q63_to_q31(((q63_t) in * in) >> 31);
+    meanSquare += (q31_t) (((q63_t) coeff * (in - meanSquare)) >> 31);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    /* ms += coeff * (x^2 - ms) */
+    in = *pSrc++;
+    in = clip_q63_to_q31(((q63_t) in * in) >> 31);
+    meanSquare += (q31_t) (((q63_t) coeff * (in - meanSquare)) >> 31);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  S->meanSquare = meanSquare;
+  arm_sqrt_q31(meanSquare, pResult);
+}
+
+/**
+ * @} end of ExpRMS group
+ */
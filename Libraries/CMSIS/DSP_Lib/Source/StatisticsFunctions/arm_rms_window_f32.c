@@ -0,0 +1,89 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_rms_window_f32.c
+*
+* Description:	Windowed RMS of floating-point data.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @defgroup WindowRMS Windowed RMS
+ *
+ * Computes the RMS level of the last <code>numBlocks</code> blocks of a stream, a
+ * sliding rectangular window which moves by one block per call.  The sum of the
+ * squares of each block is computed once, when the block arrives, and kept in a ring
+ * of <code>numBlocks</code> values supplied by the user, so the cost per call is one
+ * pass over the new block whatever the length of the window.  Until the ring is full
+ * the RMS is that of the blocks received so far.
+ *
+ * All the blocks must have the same length.  The window is ordered in time, so two
+ * instances cannot be merged like the streaming statistics accumulators.
+ *
+ * \par Fixed-Point Behavior
+ * The Q15 and Q31 versions keep the exact sum of the values of the ring in a 64-bit
+ * accumulator, updated as blocks enter and leave the window.  The floating-point version
+ * sums the ring on each call instead, so that rounding errors do not build up.
+ */
+
+/**
+ * @addtogroup WindowRMS
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point windowed RMS.
+ * @param[in,out]   *S points to an instance of the floating-point windowed RMS
+ * @param[in]       *pSrc points to the block of input data
+ * @param[in]       blockSize number of samples in the block, the same for every call
+ * @param[out]      *pResult RMS of the blocks in the window
+ * @return none.
+ */
+
+void arm_rms_window_f32(
+  arm_rms_window_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pResult)
+{
+  float32_t power;                               /* Sum of the squares of the block */
+  float32_t mean;                                /* Mean sum of the squares of the blocks in the window */
+
+  /* Sum of the squares of the new block */
+  arm_power_f32(pSrc, blockSize, &power);
+
+  /* Replace the oldest block of a full window, or append to a filling one */
+  if(S->numFilled < S->numBlocks)
+  {
+    S->numFilled++;
+  }
+
+  S->pBlockPower[S->blockIndex] = power;
+
+  /* Advance the ring to the next oldest block */
+  S->blockIndex++;
+
+  if(S->blockIndex == S->numBlocks)
+  {
+    S->blockIndex = 0u;
+  }
+
+  /* Mean of the squares of all the samples of the window */
+  arm_mean_f32(S->pBlockPower, S->numFilled, &mean);
+  arm_sqrt_f32(mean / (float32_t) blockSize, pResult);
+}
+
+/**
+ * @} end of WindowRMS group
+ */
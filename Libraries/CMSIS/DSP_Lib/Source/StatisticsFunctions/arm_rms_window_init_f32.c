@@ -0,0 +1,55 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_rms_window_init_f32.c
+*
+* Description:	Floating-point windowed RMS initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup WindowRMS
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point windowed RMS.
+ * @param[out] *S points to an instance of the floating-point windowed RMS.
+ * @param[in]  numBlocks number of blocks in the window.
+ * @param[in]  *pBlockPower points to an array of <code>numBlocks</code> values for the sums of squares of the blocks.
+ * @return none.
+ */
+
+void arm_rms_window_init_f32(
+  arm_rms_window_instance_f32 * S,
+  uint16_t numBlocks,
+  float32_t * pBlockPower)
+{
+  /* Assign the window length */
+  S->numBlocks = numBlocks;
+
+  /* The window starts empty */
+  S->blockIndex = 0u;
+  S->numFilled = 0u;
+
+  /* Clear the block powers */
+  memset(pBlockPower, 0, (uint32_t) numBlocks * sizeof(float32_t));
+
+  /* Assign the block power pointer */
+  S->pBlockPower = pBlockPower;
+}
+
+/**
+ * @} end of WindowRMS group
+ */
@@ -0,0 +1,81 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_rms_window_q15.c
+*
+* Description:	Windowed RMS of Q15 data.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup WindowRMS
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q15 windowed RMS.
+ * @param[in,out]   *S points to an instance of the Q15 windowed RMS
+ * @param[in]       *pSrc points to the block of input data
+ * @param[in]       blockSize number of samples in the block, the same for every call
+ * @param[out]      *pResult RMS of the blocks in the window
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The sum of the squares of each block is computed by arm_power_q15() in 34.30 format,
+ * and the window total cannot overflow.  The mean of the squares is computed in 2.30
+ * format, and the RMS is its square root saturated to 1.31 format, truncated to 1.15 format.
+ */
+
+void arm_rms_window_q15(
+  arm_rms_window_instance_q15 * S,
+  q15_t * pSrc,
+  uint32_t blockSize,
+  q15_t * pResult)
+{
+  q63_t power;                                   /* Sum of the squares of the block */
+  q31_t root;                                    /* Square root in 1.31 format */
+
+  /* Sum of the squares of the new block in 34.30 format */
+  arm_power_q15(pSrc, blockSize, &power);
+
+  /* Replace the oldest block of a full window, or append to a filling one */
+  if(S->numFilled == S->numBlocks)
+  {
+    S->total -= S->pBlockPower[S->blockIndex];
+  }
+  else
+  {
+    S->numFilled++;
+  }
+
+  S->pBlockPower[S->blockIndex] = power;
+  S->total += power;
+
+  /* Advance the ring to the next oldest block */
+  S->blockIndex++;
+
+  if(S->blockIndex == S->numBlocks)
+  {
+    S->blockIndex = 0u;
+  }
+
+  /* Mean of the squares of all the samples of the window in 2.30 format */
+  arm_sqrt_q31(clip_q63_to_q31((S->total / ((q63_t) S->numFilled * blockSize)) << 1), &root);
+  *pResult = (q15_t) (root >> 16);
+}
+
+/**
+ * @} end of WindowRMS group
+ */
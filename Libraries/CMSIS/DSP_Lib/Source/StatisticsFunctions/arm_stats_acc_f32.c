@@ -0,0 +1,258 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_stats_acc_f32.c
+*
+* Description:	Streaming statistics accumulator for floating-point data.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @defgroup StreamStats Streaming Statistics
+ *
+ * Accumulates the mean, variance, power, minimum and maximum of a stream of samples
+ * that arrives block by block, and derives the statistics of all the samples seen
+ * so far at any time.
+ *
+ * The state lives in an instance structure which is cleared by the init function.
+ * Each call of the update function reads its block once, so the cost of the
+ * accumulation is that of one pass over the data, and the statistics are derived
+ * only when the get function is called.  The get function fills the same result
+ * structures as the fused statistics functions, with the indexes counted from the
+ * first sample of the stream.
+ *
+ * Two accumulators can be merged into one which holds the statistics of both streams,
+ * as if the samples of the second followed those of the first.  This lets a long
+ * record be split across tasks or cores, and partial results be combined in any order
+ * of the partitions.
+ *
+ * \par Algorithm
+ * The floating-point accumulator keeps the count, the mean and the sum of the squared
+ * deviations from the mean (Welford's method).  Each block is reduced around a
+ * shift, the current mean or the first sample of the stream, and combined with the
+ * state with the pairwise update of Chan et al., which is also the merge rule.  This
+ * avoids the cancellation of the textbook sum-of-squares formula on signals with a
+ * large DC component.
+ *
+ * \par
+ * The fixed-point accumulators keep integer sums of the samples and of their squares in
+ * 64-bit accumulators, and derive the variance from the two sums at the end.  Integer
+ * sums are associative, so a merged Q15 state is bit exact with the state of the
+ * concatenated stream; the Q31 squares are truncated once per chunk of samples, so a
+ * merged Q31 state can differ from it in the last bits of the sum of the squares.
+ *
+ * \par Fixed-Point Behavior
+ * Refer to the function specific documentation below for the formats of the sums and
+ * of the results.
+ */
+
+/**
+ * @addtogroup StreamStats
+ * @{
+ */
+
+/**
+ * @brief Adds a block of floating-point samples to the streaming statistics accumulator.
+ * @param[in,out]   *S points to an instance of the floating-point accumulator
+ * @param[in]       *pSrc points to the block of input data
+ * @param[in]       blockSize number of samples in the block
+ * @return none.
+ */
+
+void arm_stats_acc_f32(
+  arm_stats_acc_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize)
+{
+  float32_t shift;                               /* Value the block is reduced around */
+  float32_t sum = 0.0f;                          /* Sum of the deviations from the shift */
+  float32_t sumOfSquares = 0.0f;                 /* Sum of the squared deviations from the shift */
+  float32_t in, d, minVal, maxVal;               /* Temporary variables */
+  float32_t mean, delta, count;                  /* Block mean and its distance to the state mean */
+  uint32_t minIndex, maxIndex;                   /* Indexes of the minimum and the maximum */
+  uint32_t i;                                    /* Index of the current sample in the stream */
+  uint32_t blkCnt;                               /* loop counter */
+
+  if(blockSize == 0u)
+  {
+    return;
+  }
+
+  /* The first sample of the stream is the reference for the shift and the comparisons */
+  if(S->count == 0u)
+  {
+    S->mean = *pSrc;
+    S->min = *pSrc;
+    S->max = *pSrc;
+    S->minIndex = 0u;
+    S->maxIndex = 0u;
+  }
+
+  shift = S->mean;
+  minVal = S->min;
+  maxVal = S->max;
+  minIndex = S->minIndex;
+  maxIndex = S->maxIndex;
+  i = S->count;
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 samples at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+    d = in - shift;
+    sum += d;
+    sumOfSquares += d * d;
+    if(in < minVal)
+    {
+      minVal = in;
+      minIndex = i;
+    }
+    if(in > maxVal)
+    {
+      maxVal = in;
+      maxIndex = i;
+    }
+
+    in = *pSrc++;
+    d = in - shift;
+    sum += d;
+    sumOfSquares += d * d;
+    if(in < minVal)
+    {
+      minVal = in;
+      minIndex = i + 1u;
+    }
+    if(in > maxVal)
+    {
+      maxVal = in;
+      maxIndex = i + 1u;
+    }
+
+    in = *pSrc++;
+    d = in - shift;
+    sum += d;
+    sumOfSquares += d * d;
+    if(in < minVal)
+    {
+      minVal = in;
+      minIndex = i + 2u;
+    }
+    if(in > maxVal)
+    {
+      maxVal = in;
+      maxIndex = i + 2u;
+    }
+
+    in = *pSrc++;
+    d = in - shift;
+    sum += d;
+    sumOfSquares += d * d;
+    if(in < minVal)
+    {
+      minVal = in;
+      minIndex = i + 3u;
+    }
+    if(in > maxVal)
+    {
+      maxVal = in;
+      maxIndex = i + 3u;
+    }
+
+    i += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+    d = in - shift;
+    sum += d;
+    sumOfSquares += d * d;
+
+    /* The comparisons are strict, so the first of equal extremes is kept */
+    if(in < minVal)
+    {
+      minVal = in;
+      minIndex = i;
+    }
+    if(in > maxVal)
+    {
+      maxVal = in;
+      maxIndex = i;
+    }
+
+    i++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Mean of the block and sum of the squared deviations from it */
+  count = (float32_t) blockSize;
+  mean = shift + sum / count;
+  sumOfSquares -= (sum * sum) / count;
+
+  if(sumOfSquares < 0.0f)
+  {
+    sumOfSquares = 0.0f;
+  }
+
+  /* Combine the block with the state: the shift is the state mean, so the distance
+   * between the two means is the mean deviation of the block */
+  delta = sum / count;
+
+  if(S->count == 0u)
+  {
+    S->mean = mean;
+    S->m2 = sumOfSquares;
+  }
+  else
+  {
+    S->mean = mean - delta * ((float32_t) S->count / (float32_t) i);
+    S->m2 += sumOfSquares + delta * delta * ((float32_t) S->count * count / (float32_t) i);
+  }
+
+  S->count = i;
+  S->min = minVal;
+  S->max = maxVal;
+  S->minIndex = minIndex;
+  S->maxIndex = maxIndex;
+}
+
+/**
+ * @} end of StreamStats group
+ */
@@ -0,0 +1,74 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_stats_acc_get_f32.c
+*
+* Description:	Statistics of a floating-point streaming statistics accumulator.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup StreamStats
+ * @{
+ */
+
+/**
+ * @brief Statistics of all the samples of a floating-point streaming statistics accumulator.
+ * @param[in]       *S points to an instance of the floating-point accumulator
+ * @param[out]      *pResult statistics returned here
+ * @return none.
+ *
+ * \par
+ * The variance is the unbiased estimate, zero for a single sample, and the power is the
+ * sum of the squares of the samples.  All the results are zero while the accumulator
+ * is empty.
+ */
+
+void arm_stats_acc_get_f32(
+  const arm_stats_acc_instance_f32 * S,
+  arm_stats_result_f32 * pResult)
+{
+  float32_t count;                               /* Sample count as a floating-point value */
+  float32_t var = 0.0f;                          /* Variance */
+
+  if(S->count == 0u)
+  {
+    memset(pResult, 0, sizeof(arm_stats_result_f32));
+    return;
+  }
+
+  count = (float32_t) S->count;
+
+  if(S->count > 1u)
+  {
+    var = S->m2 / (count - 1.0f);
+  }
+
+  pResult->mean = S->mean;
+  pResult->var = var;
+  arm_sqrt_f32(var, &pResult->std);
+
+  /* The sum of the squares is the sum of the squared deviations plus N times the squared mean */
+  pResult->power = S->m2 + count * S->mean * S->mean;
+  arm_sqrt_f32(pResult->power / count, &pResult->rms);
+
+  pResult->min = S->min;
+  pResult->max = S->max;
+  pResult->minIndex = S->minIndex;
+  pResult->maxIndex = S->maxIndex;
+}
+
+/**
+ * @} end of StreamStats group
+ */
@@ -0,0 +1,91 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_stats_acc_get_q15.c
+*
+* Description:	Statistics of a Q15 streaming statistics accumulator.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup StreamStats
+ * @{
+ */
+
+/**
+ * @brief Statistics of all the samples of a Q15 streaming statistics accumulator.
+ * @param[in]       *S points to an instance of the Q15 accumulator
+ * @param[out]      *pResult statistics returned here
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The results have the formats of arm_stats_q15().  The mean is the sum divided by the
+ * count, truncated toward zero.  The mean of the squares and the unbiased variance are
+ * computed in 2.30 format from the two sums; the variance is truncated to 1.15 format
+ * without saturation, and the RMS and the standard deviation are the square roots of the
+ * 2.30 values, saturated to 1.31 format, truncated to 1.15 format.  The power is the sum
+ * of the squares in 34.30 format.  All the results are zero while the accumulator is empty.
+ */
+
+void arm_stats_acc_get_q15(
+  const arm_stats_acc_instance_q15 * S,
+  arm_stats_result_q15 * pResult)
+{
+  q63_t mean;                                    /* Mean in 2.30 format */
+  q63_t var = 0;                                 /* Variance in 2.30 format */
+  q31_t root;                                    /* Square root in 1.31 format */
+  q63_t count;                                   /* Number of samples */
+
+  if(S->count == 0u)
+  {
+    memset(pResult, 0, sizeof(arm_stats_result_q15));
+    return;
+  }
+
+  count = (q63_t) S->count;
+
+  pResult->mean = (q15_t) (S->sum / count);
+  pResult->power = S->sumOfSquares;
+
+  /* RMS: the mean of the squares in 2.30 format */
+  arm_sqrt_q31(clip_q63_to_q31((S->sumOfSquares / count) << 1), &root);
+  pResult->rms = (q15_t) (root >> 16);
+
+  /* Variance in 2.30 format: (sum(x^2) - N * mean^2) / (N - 1) */
+  if(S->count > 1u)
+  {
+    mean = (S->sum << 15) / count;
+    var = (S->sumOfSquares - ((mean * mean) >> 30) * count) / (count - 1);
+
+    /* The truncation of the mean can make the variance of a constant stream slightly negative */
+    if(var < 0)
+    {
+      var = 0;
+    }
+  }
+
+  pResult->var = (q31_t) (var >> 15);
+  arm_sqrt_q31(clip_q63_to_q31(var << 1), &root);
+  pResult->std = (q15_t) (root >> 16);
+
+  pResult->min = S->min;
+  pResult->max = S->max;
+  pResult->minIndex = S->minIndex;
+  pResult->maxIndex = S->maxIndex;
+}
+
+/**
+ * @} end of StreamStats group
+ */
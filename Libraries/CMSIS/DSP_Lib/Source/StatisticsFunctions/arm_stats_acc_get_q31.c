@@ -0,0 +1,92 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_stats_acc_get_q31.c
+*
+* Description:	Statistics of a Q31 streaming statistics accumulator.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup StreamStats
+ * @{
+ */
+
+/**
+ * @brief Statistics of all the samples of a Q31 streaming statistics accumulator.
+ * @param[in]       *S points to an instance of the Q31 accumulator
+ * @param[out]      *pResult statistics returned here
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The results have the formats of arm_stats_q31(), except the power: it is the sum of the
+ * squares in 33.31 format shifted to 16.48 format and saturated, as a stream can be far
+ * longer than the blocks of arm_stats_q31().  The mean is the sum divided by the count,
+ * truncated toward zero.  The mean of the squares and the unbiased variance are computed
+ * in 1.31 format from the two sums, and the RMS and the standard deviation are their
+ * square roots.  All the results are zero while the accumulator is empty.
+ */
+
+void arm_stats_acc_get_q31(
+  const arm_stats_acc_instance_q31 * S,
+  arm_stats_result_q31 * pResult)
+{
+  q31_t mean;                                    /* Mean in 1.31 format */
+  q63_t var = 0;                                 /* Variance in 1.31 format */
+  q63_t count;                                   /* Number of samples */
+
+  if(S->count == 0u)
+  {
+    memset(pResult, 0, sizeof(arm_stats_result_q31));
+    return;
+  }
+
+  count = (q63_t) S->count;
+
+  mean = (q31_t) (S->sum / count);
+  pResult->mean = mean;
+
+  /* Power in 16.48 format, saturated */
+  pResult->power = (S->sumOfSquares > (0x7FFFFFFFFFFFFFFFLL >> 17)) ?
+    0x7FFFFFFFFFFFFFFFLL : (S->sumOfSquares << 17);
+
+  /* RMS: the mean of the squares in 1.31 format */
+  arm_sqrt_q31(clip_q63_to_q31(S->sumOfSquares / count), &pResult->rms);
+
+  /* Variance in 1.31 format: (sum(x^2) - N * mean^2) / (N - 1).  The square of the mean
+   * of the whole stream cannot overflow, where the square of the sum could. */
+  if(S->count > 1u)
+  {
+    var = (S->sumOfSquares - (((q63_t) mean * mean) >> 31) * count) / (count - 1);
+
+    /* The truncation of the mean and of the squares can make the variance of a constant stream slightly negative */
+    if(var < 0)
+    {
+      var = 0;
+    }
+  }
+
+  pResult->var = var;
+  arm_sqrt_q31(clip_q63_to_q31(var), &pResult->std);
+
+  pResult->min = S->min;
+  pResult->max = S->max;
+  pResult->minIndex = S->minIndex;
+  pResult->maxIndex = S->maxIndex;
+}
+
+/**
+ * @} end of StreamStats group
+ */
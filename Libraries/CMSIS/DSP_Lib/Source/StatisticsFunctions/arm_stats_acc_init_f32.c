@@ -0,0 +1,41 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_stats_acc_init_f32.c
+*
+* Description:	Floating-point streaming statistics accumulator initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup StreamStats
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point streaming statistics accumulator.
+ * @param[out] *S points to an instance of the floating-point accumulator.
+ * @return none.
+ */
+
+void arm_stats_acc_init_f32(
+  arm_stats_acc_instance_f32 * S)
+{
+  /* Clear the count and the sums; the extremes are set by the first sample */
+  memset(S, 0, sizeof(arm_stats_acc_instance_f32));
+}
+
+/**
+ * @} end of StreamStats group
+ */
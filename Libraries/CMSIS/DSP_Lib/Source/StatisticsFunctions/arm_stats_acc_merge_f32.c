@@ -0,0 +1,82 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_stats_acc_merge_f32.c
+*
+* Description:	Merges two floating-point streaming statistics accumulators.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup StreamStats
+ * @{
+ */
+
+/**
+ * @brief Merges two floating-point streaming statistics accumulators.
+ * @param[in,out]   *S points to the accumulator that receives the merged state
+ * @param[in]       *pOther points to the accumulator that is added
+ * @return none.
+ *
+ * \par
+ * The merged state is that of the samples of <code>S</code> followed by the samples of
+ * <code>pOther</code>: the indexes of the extremes of <code>pOther</code> are offset by
+ * the count of <code>S</code>, and the extremes of <code>S</code> win the ties.
+ */
+
+void arm_stats_acc_merge_f32(
+  arm_stats_acc_instance_f32 * S,
+  const arm_stats_acc_instance_f32 * pOther)
+{
+  float32_t delta;                               /* Distance between the two means */
+  float32_t countA, countB, count;               /* Sample counts as floating-point values */
+
+  if(pOther->count == 0u)
+  {
+    return;
+  }
+
+  if(S->count == 0u)
+  {
+    *S = *pOther;
+    return;
+  }
+
+  countA = (float32_t) S->count;
+  countB = (float32_t) pOther->count;
+  count = countA + countB;
+
+  /* Pairwise combination of the means and of the sums of squared deviations */
+  delta = pOther->mean - S->mean;
+  S->mean += delta * (countB / count);
+  S->m2 += pOther->m2 + delta * delta * (countA * countB / count);
+
+  /* The comparisons are strict, so the extreme of the first stream is kept on ties */
+  if(pOther->min < S->min)
+  {
+    S->min = pOther->min;
+    S->minIndex = pOther->minIndex + S->count;
+  }
+  if(pOther->max > S->max)
+  {
+    S->max = pOther->max;
+    S->maxIndex = pOther->maxIndex + S->count;
+  }
+
+  S->count += pOther->count;
+}
+
+/**
+ * @} end of StreamStats group
+ */
@@ -0,0 +1,74 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_stats_acc_merge_q31.c
+*
+* Description:	Merges two Q31 streaming statistics accumulators.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup StreamStats
+ * @{
+ */
+
+/**
+ * @brief Merges two Q31 streaming statistics accumulators.
+ * @param[in,out]   *S points to the accumulator that receives the merged state
+ * @param[in]       *pOther points to the accumulator that is added
+ * @return none.
+ *
+ * \par
+ * The merged state is that of the samples of <code>S</code> followed by the samples of
+ * <code>pOther</code>: the indexes of the extremes of <code>pOther</code> are offset by
+ * the count of <code>S</code>, and the extremes of <code>S</code> win the ties.
+ */
+
+void arm_stats_acc_merge_q31(
+  arm_stats_acc_instance_q31 * S,
+  const arm_stats_acc_instance_q31 * pOther)
+{
+  if(pOther->count == 0u)
+  {
+    return;
+  }
+
+  if(S->count == 0u)
+  {
+    *S = *pOther;
+    return;
+  }
+
+  /* The sums are integers, so the merge is exact */
+  S->sum += pOther->sum;
+  S->sumOfSquares += pOther->sumOfSquares;
+
+  /* The comparisons are strict, so the extreme of the first stream is kept on ties */
+  if(pOther->min < S->min)
+  {
+    S->min = pOther->min;
+    S->minIndex = pOther->minIndex + S->count;
+  }
+  if(pOther->max > S->max)
+  {
+    S->max = pOther->max;
+    S->maxIndex = pOther->maxIndex + S->count;
+  }
+
+  S->count += pOther->count;
+}
+
+/**
+ * @} end of StreamStats group
+ */
@@ -0,0 +1,211 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_stats_acc_q15.c
+*
+* Description:	Streaming statistics accumulator for Q15 data.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup StreamStats
+ * @{
+ */
+
+/**
+ * @brief Adds a block of Q15 samples to the streaming statistics accumulator.
+ * @param[in,out]   *S points to an instance of the Q15 accumulator
+ * @param[in]       *pSrc points to the block of input data
+ * @param[in]       blockSize number of samples in the block
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The samples are accumulated in a 64-bit accumulator in 49.15 format and their squares
+ * in a 64-bit accumulator in 34.30 format.  Neither can overflow for a stream of fewer
+ * than 2^32 samples, the limit of the sample count.
+ */
+
+void arm_stats_acc_q15(
+  arm_stats_acc_instance_q15 * S,
+  q15_t * pSrc,
+  uint32_t blockSize)
+{
+  q63_t sum;                                     /* Sum of the samples */
+  q63_t sumOfSquares;                            /* Sum of the squares */
+  q15_t in, minVal, maxVal;                      /* Temporary variables */
+  uint32_t minIndex, maxIndex;                   /* Indexes of the minimum and the maximum */
+  uint32_t i;                                    /* Index of the current sample in the stream */
+  uint32_t blkCnt;                               /* loop counter */
+
+  if(blockSize == 0u)
+  {
+    return;
+  }
+
+  /* The first sample of the stream is the reference for the comparisons */
+  if(S->count == 0u)
+  {
+    S->min = *pSrc;
+    S->max = *pSrc;
+    S->minIndex = 0u;
+    S->maxIndex = 0u;
+  }
+
+  sum = S->sum;
+  sumOfSquares = S->sumOfSquares;
+  minVal = S->min;
+  maxVal = S->max;
+  minIndex = S->minIndex;
+  maxIndex = S->maxIndex;
+  i = S->count;
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  {
+    q31_t in1;                                   /* Two packed samples */
+    q15_t x0, x1;                                /* The two samples */
+
+    /*loop Unrolling */
+    blkCnt = blockSize >> 2u;
+
+    /* First part of the processing with loop unrolling.  Compute 4 samples at a time.
+     ** a second loop below computes the remaining 1 to 3 samples. */
+    while(blkCnt > 0u)
+    {
+      /* Sum and sum of squares of two samples per instruction */
+      in1 = *__SIMD32(pSrc)++;
+      sum = __SMLALD(in1, 0x00010001, sum);
+      sumOfSquares = __SMLALD(in1, in1, sumOfSquares);
+
+#ifndef ARM_MATH_BIG_ENDIAN
+      x0 = (q15_t) in1;
+      x1 = (q15_t) (in1 >> 16);
+#else
+      x0 = (q15_t) (in1 >> 16);
+      x1 = (q15_t) in1;
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+      if(x0 < minVal)
+      {
+        minVal = x0;
+        minIndex = i;
+      }
+      if(x0 > maxVal)
+      {
+        maxVal = x0;
+        maxIndex = i;
+      }
+      if(x1 < minVal)
+      {
+        minVal = x1;
+        minIndex = i + 1u;
+      }
+      if(x1 > maxVal)
+      {
+        maxVal = x1;
+        maxIndex = i + 1u;
+      }
+
+      in1 = *__SIMD32(pSrc)++;
+      sum = __SMLALD(in1, 0x00010001, sum);
+      sumOfSquares = __SMLALD(in1, in1, sumOfSquares);
+
+#ifndef ARM_MATH_BIG_ENDIAN
+      x0 = (q15_t) in1;
+      x1 = (q15_t) (in1 >> 16);
+#else
+      x0 = (q15_t) (in1 >> 16);
+      x1 = (q15_t) in1;
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+      if(x0 < minVal)
+      {
+        minVal = x0;
+        minIndex = i + 2u;
+      }
+      if(x0 > maxVal)
+      {
+        maxVal = x0;
+        maxIndex = i + 2u;
+      }
+      if(x1 < minVal)
+      {
+        minVal = x1;
+        minIndex = i + 3u;
+      }
+      if(x1 > maxVal)
+      {
+        maxVal = x1;
+        maxIndex = i + 3u;
+      }
+
+      i += 4u;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* If the blockSize is not a multiple of 4, compute any remaining samples here.
+     ** No loop unrolling is used. */
+    blkCnt = blockSize % 0x4u;
+  }
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+    sum += in;
+    sumOfSquares += (q31_t) in * in;
+
+    /* The comparisons are strict, so the first of equal extremes is kept */
+    if(in < minVal)
+    {
+      minVal = in;
+      minIndex = i;
+    }
+    if(in > maxVal)
+    {
+      maxVal = in;
+      maxIndex = i;
+    }
+
+    i++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  S->count = i;
+  S->sum = sum;
+  S->sumOfSquares = sumOfSquares;
+  S->min = minVal;
+  S->max = maxVal;
+  S->minIndex = minIndex;
+  S->maxIndex = maxIndex;
+}
+
+/**
+ * @} end of StreamStats group
+ */
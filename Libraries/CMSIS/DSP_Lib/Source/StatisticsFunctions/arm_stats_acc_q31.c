@@ -0,0 +1,209 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_stats_acc_q31.c
+*
+* Description:	Streaming statistics accumulator for Q31 data.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup StreamStats
+ * @{
+ */
+
+/**
+ * @brief Adds a block of Q31 samples to the streaming statistics accumulator.
+ * @param[in,out]   *S points to an instance of the Q31 accumulator
+ * @param[in]       *pSrc points to the block of input data
+ * @param[in]       blockSize number of samples in the block
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The samples are accumulated in a 64-bit accumulator in 33.31 format.  The squares are
+ * truncated to 2.48 format and accumulated in 16.48 format, as in arm_power_q31(), over
+ * chunks of at most 16384 samples, which cannot overflow; each chunk is then truncated
+ * to 33.31 format and added to the sum of the squares.  Neither sum can overflow for a
+ * stream of fewer than 2^32 samples, the limit of the sample count.
+ */
+
+void arm_stats_acc_q31(
+  arm_stats_acc_instance_q31 * S,
+  q31_t * pSrc,
+  uint32_t blockSize)
+{
+  q63_t sum;                                     /* Sum of the samples */
+  q63_t sumOfSquares;                            /* Sum of the squares in 33.31 format */
+  q63_t chunkSquares;                            /* Sum of the squares of a chunk in 16.48 format */
+  q31_t in, minVal, maxVal;                      /* Temporary variables */
+  uint32_t minIndex, maxIndex;                   /* Indexes of the minimum and the maximum */
+  uint32_t i;                                    /* Index of the current sample in the stream */
+  uint32_t chunkSize;                            /* Number of samples in the current chunk */
+  uint32_t blkCnt;                               /* loop counter */
+
+  if(blockSize == 0u)
+  {
+    return;
+  }
+
+  /* The first sample of the stream is the reference for the comparisons */
+  if(S->count == 0u)
+  {
+    S->min = *pSrc;
+    S->max = *pSrc;
+    S->minIndex = 0u;
+    S->maxIndex = 0u;
+  }
+
+  sum = S->sum;
+  sumOfSquares = S->sumOfSquares;
+  minVal = S->min;
+  maxVal = S->max;
+  minIndex = S->minIndex;
+  maxIndex = S->maxIndex;
+  i = S->count;
+
+  while(blockSize > 0u)
+  {
+    chunkSize = (blockSize < 16384u) ? blockSize : 16384u;
+    blockSize -= chunkSize;
+    chunkSquares = 0;
+
+#ifndef ARM_MATH_CM0
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /*loop Unrolling */
+    blkCnt = chunkSize >> 2u;
+
+    /* First part of the processing with loop unrolling.  Compute 4 samples at a time.
+     ** a second loop below computes the remaining 1 to 3 samples. */
+    while(blkCnt > 0u)
+    {
+      in = *pSrc++;
+      sum += in;
+      chunkSquares += ((q63_t) in * in) >> 14u;
+      if(in < minVal)
+      {
+        minVal = in;
+        minIndex = i;
+      }
+      if(in > maxVal)
+      {
+        maxVal = in;
+        maxIndex = i;
+      }
+
+      in = *pSrc++;
+      sum += in;
+      chunkSquares += ((q63_t) in * in) >> 14u;
+      if(in < minVal)
+      {
+        minVal = in;
+        minIndex = i + 1u;
+      }
+      if(in > maxVal)
+      {
+        maxVal = in;
+        maxIndex = i + 1u;
+      }
+
+      in = *pSrc++;
+      sum += in;
+      chunkSquares += ((q63_t) in * in) >> 14u;
+      if(in < minVal)
+      {
+        minVal = in;
+        minIndex = i + 2u;
+      }
+      if(in > maxVal)
+      {
+        maxVal = in;
+        maxIndex = i + 2u;
+      }
+
+      in = *pSrc++;
+      sum += in;
+      chunkSquares += ((q63_t) in * in) >> 14u;
+      if(in < minVal)
+      {
+        minVal = in;
+        minIndex = i + 3u;
+      }
+      if(in > maxVal)
+      {
+        maxVal = in;
+        maxIndex = i + 3u;
+      }
+
+      i += 4u;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* If the chunkSize is not a multiple of 4, compute any remaining samples here.
+     ** No loop unrolling is used. */
+    blkCnt = chunkSize % 0x4u;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    /* Loop over chunkSize number of values */
+    blkCnt = chunkSize;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+    while(blkCnt > 0u)
+    {
+      in = *pSrc++;
+      sum += in;
+      chunkSquares += ((q63_t) in * in) >> 14u;
+
+      /* The comparisons are strict, so the first of equal extremes is kept */
+      if(in < minVal)
+      {
+        minVal = in;
+        minIndex = i;
+      }
+      if(in > maxVal)
+      {
+        maxVal = in;
+        maxIndex = i;
+      }
+
+      i++;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Fold the chunk into the sum of the squares in 33.31 format */
+    sumOfSquares += chunkSquares >> 17u;
+  }
+
+  S->count = i;
+  S->sum = sum;
+  S->sumOfSquares = sumOfSquares;
+  S->min = minVal;
+  S->max = maxVal;
+  S->minIndex = minIndex;
+  S->maxIndex = maxIndex;
+}
+
+/**
+ * @} end of StreamStats group
+ */
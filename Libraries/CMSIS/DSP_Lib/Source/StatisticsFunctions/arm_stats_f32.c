@@ -0,0 +1,370 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_stats_f32.c
+*
+* Description:	Fused statistics of a floating-point vector.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @defgroup FusedStats Fused Statistics
+ *
+ * Computes the statistics of the other functions of this group together, reading the input
+ * vector once: the sum and the sum of the squares are accumulated and the minimum and the
+ * maximum are tracked with their indexes in the same loop, and the results are derived from them.
+ * <pre>
+ *     mean  = sum / blockSize
+ *     power = sumOfSquares
+ *     rms   = sqrt(sumOfSquares / blockSize)
+ *     var   = (sumOfSquares - sum * sum / blockSize) / (blockSize - 1)
+ *     std   = sqrt(var)
+ * </pre>
+ * When a block needs several statistics this saves a pass over the data per statistic; the
+ * variance and the standard deviation functions in particular already compute both sums.
+ * The variance of a single sample is 0.
+ *
+ * \par
+ * The minimum and the maximum are those of \ref Min and \ref Max, with the index of their
+ * first occurrence.  The fixed-point power is the same as that of \ref power, and the
+ * fixed-point mean is the sum divided by <code>blockSize</code>, truncated toward zero.
+ * The fixed-point variance, standard deviation and RMS are computed from the full precision
+ * sums without the intermediate saturation of \ref variance, \ref STD and \ref RMS, and are
+ * more accurate for long blocks.
+ *
+ * \par
+ * The Cortex-M4 versions accumulate two Q15 or Q7 samples per instruction with
+ * <code>__SMLAD</code> and <code>__SMLALD</code>.  The host builds (ARM_MATH_HOST) of the
+ * floating-point and Q15 versions keep the sums and a minimum and a maximum per vector lane,
+ * with the index of the update, and merge the lanes at the end.
+ */
+
+/**
+ * @addtogroup FusedStats
+ * @{
+ */
+
+/**
+ * @brief Mean, variance, standard deviation, RMS, power, minimum and maximum of a floating-point vector in one pass.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       blockSize length of the input vector
+ * @param[out]      *pResult statistics returned here
+ * @return none.
+ *
+ * \par
+ * The host builds add the samples in a different order, so their sums may differ from
+ * arm_mean_f32() and arm_power_f32() in the last bits.
+ */
+
+void arm_stats_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  arm_stats_result_f32 * pResult)
+{
+  float32_t sum = 0.0f;                          /* Sum of the samples */
+  float32_t sumOfSquares = 0.0f;                 /* Sum of the squares */
+  float32_t in, minVal, maxVal, var;             /* Temporary variables */
+  uint32_t minIndex = 0u, maxIndex = 0u;         /* Indexes of the minimum and the maximum */
+  uint32_t i = 0u;                               /* Index of the current sample */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* The first sample is the reference for the comparisons */
+  minVal = *pSrc;
+  maxVal = *pSrc;
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 samples at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+    sum += in;
+    sumOfSquares += in * in;
+    if(in < minVal)
+    {
+      minVal = in;
+      minIndex = i;
+    }
+    if(in > maxVal)
+    {
+      maxVal = in;
+      maxIndex = i;
+    }
+
+    in = *pSrc++;
+    sum += in;
+    sumOfSquares += in * in;
+    if(in < minVal)
+    {
+      minVal = in;
+      minIndex = i + 1u;
+    }
+    if(in > maxVal)
+    {
+      maxVal = in;
+      maxIndex = i + 1u;
+    }
+
+    in = *pSrc++;
+    sum += in;
+    sumOfSquares += in * in;
+    if(in < minVal)
+    {
+      minVal = in;
+      minIndex = i + 2u;
+    }
+    if(in > maxVal)
+    {
+      maxVal = in;
+      maxIndex = i + 2u;
+    }
+
+    in = *pSrc++;
+    sum += in;
+    sumOfSquares += in * in;
+    if(in < minVal)
+    {
+      minVal = in;
+      minIndex = i + 3u;
+    }
+    if(in > maxVal)
+    {
+      maxVal = in;
+      maxIndex = i + 3u;
+    }
+
+    i += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+#if defined (ARM_MATH_SSE2) || defined (ARM_MATH_NEON)
+
+  /* Host build: 4 lanes, each with its sums, its extremes and the sample index of their last update */
+  blkCnt = blockSize;
+
+  if(blockSize >= 4u)
+  {
+    float32_t laneMin[4], laneMax[4];            /* Extremes of the lanes */
+    uint32_t laneMinIdx[4], laneMaxIdx[4];       /* Their indexes */
+    uint32_t k;                                  /* Lane counter */
+
+#if defined (ARM_MATH_SSE2)
+
+    __m128 vIn, vSum, vSq, vMin, vMax;
+    __m128i vIdx, vMinIdx, vMaxIdx, vMask;
+
+    /* The first 4 samples initialize the lanes */
+    vIn = _mm_loadu_ps(pSrc);
+    vSum = vIn;
+    vSq = _mm_mul_ps(vIn, vIn);
+    vMin = vIn;
+    vMax = vIn;
+    vIdx = _mm_setr_epi32(0, 1, 2, 3);
+    vMinIdx = vIdx;
+    vMaxIdx = vIdx;
+    pSrc += 4u;
+
+    blkCnt = (blockSize >> 2u) - 1u;
+
+    while(blkCnt > 0u)
+    {
+      vIdx = _mm_add_epi32(vIdx, _mm_set1_epi32(4));
+      vIn = _mm_loadu_ps(pSrc);
+      vSum = _mm_add_ps(vSum, vIn);
+      vSq = _mm_add_ps(vSq, _mm_mul_ps(vIn, vIn));
+
+      /* Only a smaller or a larger sample moves the index of a lane, so each lane keeps its first extreme */
+      vMask = _mm_castps_si128(_mm_cmplt_ps(vIn, vMin));
+      vMin = _mm_min_ps(vIn, vMin);
+      vMinIdx = _mm_or_si128(_mm_and_si128(vMask, vIdx), _mm_andnot_si128(vMask, vMinIdx));
+
+      vMask = _mm_castps_si128(_mm_cmpgt_ps(vIn, vMax));
+      vMax = _mm_max_ps(vIn, vMax);
+      vMaxIdx = _mm_or_si128(_mm_and_si128(vMask, vIdx), _mm_andnot_si128(vMask, vMaxIdx));
+
+      pSrc += 4u;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Add the 4 partial sums */
+    vSum = _mm_add_ps(vSum, _mm_movehl_ps(vSum, vSum));
+    vSum = _mm_add_ss(vSum, _mm_shuffle_ps(vSum, vSum, 0x55));
+    sum = _mm_cvtss_f32(vSum);
+    vSq = _mm_add_ps(vSq, _mm_movehl_ps(vSq, vSq));
+    vSq = _mm_add_ss(vSq, _mm_shuffle_ps(vSq, vSq, 0x55));
+    sumOfSquares = _mm_cvtss_f32(vSq);
+
+    _mm_storeu_ps(laneMin, vMin);
+    _mm_storeu_ps(laneMax, vMax);
+    _mm_storeu_si128((__m128i *) laneMinIdx, vMinIdx);
+    _mm_storeu_si128((__m128i *) laneMaxIdx, vMaxIdx);
+
+#else
+
+    float32x4_t vIn, vSum, vSq, vMin, vMax;
+    uint32x4_t vIdx, vMinIdx, vMaxIdx, vMask;
+    static const uint32_t idx0[4] = { 0u, 1u, 2u, 3u };
+
+    /* The first 4 samples initialize the lanes */
+    vIn = vld1q_f32(pSrc);
+    vSum = vIn;
+    vSq = vmulq_f32(vIn, vIn);
+    vMin = vIn;
+    vMax = vIn;
+    vIdx = vld1q_u32(idx0);
+    vMinIdx = vIdx;
+    vMaxIdx = vIdx;
+    pSrc += 4u;
+
+    blkCnt = (blockSize >> 2u) - 1u;
+
+    while(blkCnt > 0u)
+    {
+      vIdx = vaddq_u32(vIdx, vdupq_n_u32(4u));
+      vIn = vld1q_f32(pSrc);
+      vSum = vaddq_f32(vSum, vIn);
+      vSq = vmlaq_f32(vSq, vIn, vIn);
+
+      /* Only a smaller or a larger sample moves the index of a lane, so each lane keeps its first extreme */
+      vMask = vcltq_f32(vIn, vMin);
+      vMin = vbslq_f32(vMask, vIn, vMin);
+      vMinIdx = vbslq_u32(vMask, vIdx, vMinIdx);
+
+      vMask = vcgtq_f32(vIn, vMax);
+      vMax = vbslq_f32(vMask, vIn, vMax);
+      vMaxIdx = vbslq_u32(vMask, vIdx, vMaxIdx);
+
+      pSrc += 4u;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Add the 4 partial sums */
+    sum = vaddvq_f32(vSum);
+    sumOfSquares = vaddvq_f32(vSq);
+
+    vst1q_f32(laneMin, vMin);
+    vst1q_f32(laneMax, vMax);
+    vst1q_u32(laneMinIdx, vMinIdx);
+    vst1q_u32(laneMaxIdx, vMaxIdx);
+
+#endif /* #if defined (ARM_MATH_SSE2) */
+
+    /* Merge the lanes: the extreme value, and the smallest index among the lanes that hold it */
+    minVal = laneMin[0];
+    minIndex = laneMinIdx[0];
+    maxVal = laneMax[0];
+    maxIndex = laneMaxIdx[0];
+
+    for (k = 1u; k < 4u; k++)
+    {
+      if((laneMin[k] < minVal) || ((laneMin[k] == minVal) && (laneMinIdx[k] < minIndex)))
+      {
+        minVal = laneMin[k];
+        minIndex = laneMinIdx[k];
+      }
+      if((laneMax[k] > maxVal) || ((laneMax[k] == maxVal) && (laneMaxIdx[k] < maxIndex)))
+      {
+        maxVal = laneMax[k];
+        maxIndex = laneMaxIdx[k];
+      }
+    }
+
+    /* Compute the remaining 1 to 3 samples below */
+    i = blockSize & ~0x3u;
+    blkCnt = blockSize % 0x4u;
+  }
+
+#else
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_SSE2) || defined (ARM_MATH_NEON) */
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+    sum += in;
+    sumOfSquares += in * in;
+
+    /* The comparisons are strict, so the first of equal extremes is kept */
+    if(in < minVal)
+    {
+      minVal = in;
+      minIndex = i;
+    }
+    if(in > maxVal)
+    {
+      maxVal = in;
+      maxIndex = i;
+    }
+
+    i++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Derive the statistics from the two sums */
+  pResult->mean = sum / (float32_t) blockSize;
+  pResult->power = sumOfSquares;
+  arm_sqrt_f32(sumOfSquares / (float32_t) blockSize, &pResult->rms);
+
+  var = 0.0f;
+
+  if(blockSize > 1u)
+  {
+    var = (sumOfSquares - (sum * sum) / (float32_t) blockSize) / (float32_t) (blockSize - 1u);
+
+    /* Rounding can make the variance of a constant vector slightly negative */
+    if(var < 0.0f)
+    {
+      var = 0.0f;
+    }
+  }
+
+  pResult->var = var;
+  arm_sqrt_f32(var, &pResult->std);
+
+  pResult->min = minVal;
+  pResult->max = maxVal;
+  pResult->minIndex = minIndex;
+  pResult->maxIndex = maxIndex;
+}
+
+/**
+ * @} end of FusedStats group
+ */
@@ -0,0 +1,386 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_stats_q15.c
+*
+* Description:	Fused statistics of a Q15 vector.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup FusedStats
+ * @{
+ */
+
+/**
+ * @brief Mean, variance, standard deviation, RMS, power, minimum and maximum of a Q15 vector in one pass.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       blockSize length of the input vector
+ * @param[out]      *pResult statistics returned here
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The sum is accumulated in a 32-bit accumulator in 17.15 format, which limits
+ * <code>blockSize</code> to 65536 as for arm_mean_q15().  The squares are accumulated in a
+ * 64-bit accumulator in 34.30 format without risk of overflow, and this sum is the power.
+ * The mean of the squares and the variance are computed in 2.30 format from the two sums;
+ * the variance is truncated to 1.15 format without saturation, as a variance of up to 2 is
+ * possible.  The RMS and the standard deviation are the square roots of the 2.30 values,
+ * saturated to 1.31 format, truncated to 1.15 format.
+ */
+
+void arm_stats_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  arm_stats_result_q15 * pResult)
+{
+  q31_t sum = 0;                                 /* Sum of the samples */
+  q63_t sumOfSquares = 0;                        /* Sum of the squares */
+  q63_t var;                                     /* Variance in 2.30 format */
+  q31_t root;                                    /* Square root in 1.31 format */
+  q15_t in, minVal, maxVal;                      /* Temporary variables */
+  uint32_t minIndex = 0u, maxIndex = 0u;         /* Indexes of the minimum and the maximum */
+  uint32_t i = 0u;                               /* Index of the current sample */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* The first sample is the reference for the comparisons */
+  minVal = *pSrc;
+  maxVal = *pSrc;
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  {
+    q31_t in1;                                   /* Two packed samples */
+    q15_t x0, x1;                                /* The two samples */
+
+    /*loop Unrolling */
+    blkCnt = blockSize >> 2u;
+
+    /* First part of the processing with loop unrolling.  Compute 4 samples at a time.
+     ** a second loop below computes the remaining 1 to 3 samples. */
+    while(blkCnt > 0u)
+    {
+      /* Sum and sum of squares of two samples per instruction */
+      in1 = *__SIMD32(pSrc)++;
+      sum = __SMLAD(in1, 0x00010001, sum);
+      sumOfSquares = __SMLALD(in1, in1, sumOfSquares);
+
+#ifndef ARM_MATH_BIG_ENDIAN
+      x0 = (q15_t) in1;
+      x1 = (q15_t) (in1 >> 16);
+#else
+      x0 = (q15_t) (in1 >> 16);
+      x1 = (q15_t) in1;
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+      if(x0 < minVal)
+      {
+        minVal = x0;
+        minIndex = i;
+      }
+      if(x0 > maxVal)
+      {
+        maxVal = x0;
+        maxIndex = i;
+      }
+      if(x1 < minVal)
+      {
+        minVal = x1;
+        minIndex = i + 1u;
+      }
+      if(x1 > maxVal)
+      {
+        maxVal = x1;
+        maxIndex = i + 1u;
+      }
+
+      in1 = *__SIMD32(pSrc)++;
+      sum = __SMLAD(in1, 0x00010001, sum);
+      sumOfSquares = __SMLALD(in1, in1, sumOfSquares);
+
+#ifndef ARM_MATH_BIG_ENDIAN
+      x0 = (q15_t) in1;
+      x1 = (q15_t) (in1 >> 16);
+#else
+      x0 = (q15_t) (in1 >> 16);
+      x1 = (q15_t) in1;
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+      if(x0 < minVal)
+      {
+        minVal = x0;
+        minIndex = i + 2u;
+      }
+      if(x0 > maxVal)
+      {
+        maxVal = x0;
+        maxIndex = i + 2u;
+      }
+      if(x1 < minVal)
+      {
+        minVal = x1;
+        minIndex = i + 3u;
+      }
+      if(x1 > maxVal)
+      {
+        maxVal = x1;
+        maxIndex = i + 3u;
+      }
+
+      i += 4u;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* If the blockSize is not a multiple of 4, compute any remaining samples here.
+     ** No loop unrolling is used. */
+    blkCnt = blockSize % 0x4u;
+  }
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+#if defined (ARM_MATH_SSE2) || defined (ARM_MATH_NEON)
+
+  /* Host build: 8 lanes, each with its sums, its extremes and the iteration of their last update.
+   * The iteration is kept in 16 bits, so at most 65536 iterations run in the lanes. */
+  blkCnt = blockSize;
+
+  if(blockSize >= 8u)
+  {
+    q15_t laneMin[8], laneMax[8];                /* Extremes of the lanes */
+    uint16_t laneMinIter[8], laneMaxIter[8];     /* Iterations of their last update */
+    uint32_t iterations, k, idx;                 /* Iterations in the lanes, lane counter, sample index */
+
+    iterations = blockSize >> 3u;
+    if(iterations > 65536u)
+    {
+      iterations = 65536u;
+    }
+
+#if defined (ARM_MATH_SSE2)
+
+    {
+      __m128i vIn, vSum, vSq, vSq32, vMin, vMax, vIter, vMinIter, vMaxIter, vMask;
+      const __m128i vOnes = _mm_set1_epi16(1);
+      const __m128i vZero = _mm_setzero_si128();
+      q31_t laneSum[4];
+      q63_t laneSq[2];
+
+      /* The first 8 samples initialize the lanes at iteration 0 */
+      vIn = _mm_loadu_si128((__m128i *) pSrc);
+      vSum = _mm_madd_epi16(vIn, vOnes);
+      vSq32 = _mm_madd_epi16(vIn, vIn);
+      vSq = _mm_add_epi64(_mm_unpacklo_epi32(vSq32, vZero), _mm_unpackhi_epi32(vSq32, vZero));
+      vMin = vIn;
+      vMax = vIn;
+      vIter = vZero;
+      vMinIter = vZero;
+      vMaxIter = vZero;
+      pSrc += 8u;
+
+      blkCnt = iterations - 1u;
+
+      while(blkCnt > 0u)
+      {
+        vIter = _mm_add_epi16(vIter, vOnes);
+        vIn = _mm_loadu_si128((__m128i *) pSrc);
+
+        /* Pairwise sums of the samples, and of the squares: two squares add up to at most
+         * 2^31, which is exact as an unsigned 32-bit value and is widened to 64 bits */
+        vSum = _mm_add_epi32(vSum, _mm_madd_epi16(vIn, vOnes));
+        vSq32 = _mm_madd_epi16(vIn, vIn);
+        vSq = _mm_add_epi64(vSq, _mm_unpacklo_epi32(vSq32, vZero));
+        vSq = _mm_add_epi64(vSq, _mm_unpackhi_epi32(vSq32, vZero));
+
+        /* Only a smaller or a larger sample moves the iteration of a lane, so each lane keeps its first extreme */
+        vMask = _mm_cmplt_epi16(vIn, vMin);
+        vMin = _mm_min_epi16(vIn, vMin);
+        vMinIter = _mm_or_si128(_mm_and_si128(vMask, vIter), _mm_andnot_si128(vMask, vMinIter));
+
+        vMask = _mm_cmpgt_epi16(vIn, vMax);
+        vMax = _mm_max_epi16(vIn, vMax);
+        vMaxIter = _mm_or_si128(_mm_and_si128(vMask, vIter), _mm_andnot_si128(vMask, vMaxIter));
+
+        pSrc += 8u;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+      }
+
+      /* Add the partial sums */
+      _mm_storeu_si128((__m128i *) laneSum, vSum);
+      _mm_storeu_si128((__m128i *) laneSq, vSq);
+      sum = laneSum[0] + laneSum[1] + laneSum[2] + laneSum[3];
+      sumOfSquares = laneSq[0] + laneSq[1];
+
+      _mm_storeu_si128((__m128i *) laneMin, vMin);
+      _mm_storeu_si128((__m128i *) laneMax, vMax);
+      _mm_storeu_si128((__m128i *) laneMinIter, vMinIter);
+      _mm_storeu_si128((__m128i *) laneMaxIter, vMaxIter);
+    }
+
+#else
+
+    {
+      int16x8_t vIn, vMin, vMax;
+      int32x4_t vSum;
+      int64x2_t vSq;
+      uint16x8_t vIter, vMinIter, vMaxIter, vMask;
+
+      /* The first 8 samples initialize the lanes at iteration 0 */
+      vIn = vld1q_s16(pSrc);
+      vSum = vpaddlq_s16(vIn);
+      vSq = vpaddlq_s32(vmull_s16(vget_low_s16(vIn), vget_low_s16(vIn)));
+      vSq = vpadalq_s32(vSq, vmull_s16(vget_high_s16(vIn), vget_high_s16(vIn)));
+      vMin = vIn;
+      vMax = vIn;
+      vIter = vdupq_n_u16(0u);
+      vMinIter = vIter;
+      vMaxIter = vIter;
+      pSrc += 8u;
+
+      blkCnt = iterations - 1u;
+
+      while(blkCnt > 0u)
+      {
+        vIter = vaddq_u16(vIter, vdupq_n_u16(1u));
+        vIn = vld1q_s16(pSrc);
+
+        /* Pairwise sums of the samples, and of the squares in 64 bits */
+        vSum = vpadalq_s16(vSum, vIn);
+        vSq = vpadalq_s32(vSq, vmull_s16(vget_low_s16(vIn), vget_low_s16(vIn)));
+        vSq = vpadalq_s32(vSq, vmull_s16(vget_high_s16(vIn), vget_high_s16(vIn)));
+
+        /* Only a smaller or a larger sample moves the iteration of a lane, so each lane keeps its first extreme */
+        vMask = vcltq_s16(vIn, vMin);
+        vMin = vminq_s16(vIn, vMin);
+        vMinIter = vbslq_u16(vMask, vIter, vMinIter);
+
+        vMask = vcgtq_s16(vIn, vMax);
+        vMax = vmaxq_s16(vIn, vMax);
+        vMaxIter = vbslq_u16(vMask, vIter, vMaxIter);
+
+        pSrc += 8u;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+      }
+
+      /* Add the partial sums */
+      sum = vaddvq_s32(vSum);
+      sumOfSquares = vaddvq_s64(vSq);
+
+      vst1q_s16(laneMin, vMin);
+      vst1q_s16(laneMax, vMax);
+      vst1q_u16(laneMinIter, vMinIter);
+      vst1q_u16(laneMaxIter, vMaxIter);
+    }
+
+#endif /* #if defined (ARM_MATH_SSE2) */
+
+    /* Merge the lanes: the extreme value, and the smallest index among the lanes that hold it */
+    minVal = laneMin[0];
+    minIndex = (uint32_t) laneMinIter[0] * 8u;
+    maxVal = laneMax[0];
+    maxIndex = (uint32_t) laneMaxIter[0] * 8u;
+
+    for (k = 1u; k < 8u; k++)
+    {
+      idx = (uint32_t) laneMinIter[k] * 8u + k;
+      if((laneMin[k] < minVal) || ((laneMin[k] == minVal) && (idx < minIndex)))
+      {
+        minVal = laneMin[k];
+        minIndex = idx;
+      }
+      idx = (uint32_t) laneMaxIter[k] * 8u + k;
+      if((laneMax[k] > maxVal) || ((laneMax[k] == maxVal) && (idx < maxIndex)))
+      {
+        maxVal = laneMax[k];
+        maxIndex = idx;
+      }
+    }
+
+    /* Compute the remaining samples below */
+    i = iterations * 8u;
+    blkCnt = blockSize - i;
+  }
+
+#else
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_SSE2) || defined (ARM_MATH_NEON) */
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+    sum += in;
+    sumOfSquares += (q31_t) in * in;
+
+    /* The comparisons are strict, so the first of equal extremes is kept */
+    if(in < minVal)
+    {
+      minVal = in;
+      minIndex = i;
+    }
+    if(in > maxVal)
+    {
+      maxVal = in;
+      maxIndex = i;
+    }
+
+    i++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Derive the statistics from the two sums */
+  pResult->mean = (q15_t) (sum / (q31_t) blockSize);
+  pResult->power = sumOfSquares;
+
+  /* RMS: the mean of the squares in 2.30 format, its square root in 1.31 format */
+  arm_sqrt_q31(clip_q63_to_q31((sumOfSquares / (q31_t) blockSize) << 1), &root);
+  pResult->rms = (q15_t) (root >> 16);
+
+  /* Variance in 2.30 format: (sum(x^2) - sum(x)^2 / N) / (N - 1) */
+  var = 0;
+
+  if(blockSize > 1u)
+  {
+    var = (sumOfSquares - ((q63_t) sum * sum) / (q31_t) blockSize) / (q31_t) (blockSize - 1u);
+  }
+
+  pResult->var = (q31_t) (var >> 15);
+  arm_sqrt_q31(clip_q63_to_q31(var << 1), &root);
+  pResult->std = (q15_t) (root >> 16);
+
+  pResult->min = minVal;
+  pResult->max = maxVal;
+  pResult->minIndex = minIndex;
+  pResult->maxIndex = maxIndex;
+}
+
+/**
+ * @} end of FusedStats group
+ */
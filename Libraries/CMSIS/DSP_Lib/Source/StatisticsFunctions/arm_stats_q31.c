@@ -0,0 +1,202 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_stats_q31.c
+*
+* Description:	Fused statistics of a Q31 vector.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup FusedStats
+ * @{
+ */
+
+/**
+ * @brief Mean, variance, standard deviation, RMS, power, minimum and maximum of a Q31 vector in one pass.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       blockSize length of the input vector
+ * @param[out]      *pResult statistics returned here
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The sum is accumulated in a 64-bit accumulator in 33.31 format.  The squares are
+ * truncated to 2.48 format and accumulated in a 64-bit accumulator in 16.48 format, as in
+ * arm_power_q31(), which keeps <code>blockSize</code> below 32768 at full scale; this sum is
+ * the power.  The mean of the squares and the variance are computed in 16.48 format and
+ * truncated to 1.31 format; the variance is returned without saturation.  The RMS and the
+ * standard deviation are the square roots of the 1.31 values, saturated.
+ */
+
+void arm_stats_q31(
+  q31_t * pSrc,
+  uint32_t blockSize,
+  arm_stats_result_q31 * pResult)
+{
+  q63_t sum = 0;                                 /* Sum of the samples */
+  q63_t sumOfSquares = 0;                        /* Sum of the squares */
+  q63_t var;                                     /* Variance in 16.48 format */
+  q31_t in, minVal, maxVal, mean;                /* Temporary variables */
+  uint32_t minIndex = 0u, maxIndex = 0u;         /* Indexes of the minimum and the maximum */
+  uint32_t i = 0u;                               /* Index of the current sample */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* The first sample is the reference for the comparisons */
+  minVal = *pSrc;
+  maxVal = *pSrc;
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 samples at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+    sum += in;
+    sumOfSquares += ((q63_t) in * in) >> 14u;
+    if(in < minVal)
+    {
+      minVal = in;
+      minIndex = i;
+    }
+    if(in > maxVal)
+    {
+      maxVal = in;
+      maxIndex = i;
+    }
+
+    in = *pSrc++;
+    sum += in;
+    sumOfSquares += ((q63_t) in * in) >> 14u;
+    if(in < minVal)
+    {
+      minVal = in;
+      minIndex = i + 1u;
+    }
+    if(in > maxVal)
+    {
+      maxVal = in;
+      maxIndex = i + 1u;
+    }
+
+    in = *pSrc++;
+    sum += in;
+    sumOfSquares += ((q63_t) in * in) >> 14u;
+    if(in < minVal)
+    {
+      minVal = in;
+      minIndex = i + 2u;
+    }
+    if(in > maxVal)
+    {
+      maxVal = in;
+      maxIndex = i + 2u;
+    }
+
+    in = *pSrc++;
+    sum += in;
+    sumOfSquares += ((q63_t) in * in) >> 14u;
+    if(in < minVal)
+    {
+      minVal = in;
+      minIndex = i + 3u;
+    }
+    if(in > maxVal)
+    {
+      maxVal = in;
+      maxIndex = i + 3u;
+    }
+
+    i += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+    sum += in;
+    sumOfSquares += ((q63_t) in * in) >> 14u;
+
+    /* The comparisons are strict, so the first of equal extremes is kept */
+    if(in < minVal)
+    {
+      minVal = in;
+      minIndex = i;
+    }
+    if(in > maxVal)
+    {
+      maxVal = in;
+      maxIndex = i;
+    }
+
+    i++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Derive the statistics from the two sums */
+  mean = (q31_t) (sum / (q31_t) blockSize);
+  pResult->mean = mean;
+  pResult->power = sumOfSquares;
+  arm_sqrt_q31(clip_q63_to_q31((sumOfSquares / (q31_t) blockSize) >> 17), &pResult->rms);
+
+  /* Variance in 16.48 format: (sum(x^2) - N * mean^2) / (N - 1).  The square of the mean
+   * of the whole vector cannot overflow, where the square of the sum could. */
+  var = 0;
+
+  if(blockSize > 1u)
+  {
+    var = (sumOfSquares - (((q63_t) mean * mean) >> 14u) * (q31_t) blockSize) / (q31_t) (blockSize - 1u);
+
+    /* The truncation of the mean and of the squares can make the variance of a constant vector slightly negative */
+    if(var < 0)
+    {
+      var = 0;
+    }
+  }
+
+  pResult->var = var >> 17u;
+  arm_sqrt_q31(clip_q63_to_q31(var >> 17u), &pResult->std);
+
+  pResult->min = minVal;
+  pResult->max = maxVal;
+  pResult->minIndex = minIndex;
+  pResult->maxIndex = maxIndex;
+}
+
+/**
+ * @} end of FusedStats group
+ */
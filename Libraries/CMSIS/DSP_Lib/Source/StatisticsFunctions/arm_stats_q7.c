@@ -0,0 +1,202 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_stats_q7.c
+*
+* Description:	Fused statistics of a Q7 vector.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup FusedStats
+ * @{
+ */
+
+/**
+ * @brief Mean, variance, standard deviation, RMS, power, minimum and maximum of a Q7 vector in one pass.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       blockSize length of the input vector
+ * @param[out]      *pResult statistics returned here
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The sum is accumulated in a 32-bit accumulator in 25.7 format and the squares in a 32-bit
+ * accumulator in 18.14 format, as in arm_power_q7(), which keeps <code>blockSize</code> below
+ * 131072; the sum of the squares is the power.  The mean of the squares and the variance are
+ * computed in 18.14 format; the variance is returned in 1.15 format, saturated.  The RMS and
+ * the standard deviation are the square roots of the 2.14 values, truncated to 1.7 format.
+ */
+
+void arm_stats_q7(
+  q7_t * pSrc,
+  uint32_t blockSize,
+  arm_stats_result_q7 * pResult)
+{
+  q31_t sum = 0;                                 /* Sum of the samples */
+  q31_t sumOfSquares = 0;                        /* Sum of the squares */
+  q31_t var;                                     /* Variance in 18.14 format */
+  q31_t root;                                    /* Square root in 1.31 format */
+  q7_t in, minVal, maxVal;                       /* Temporary variables */
+  uint32_t minIndex = 0u, maxIndex = 0u;         /* Indexes of the minimum and the maximum */
+  uint32_t i = 0u;                               /* Index of the current sample */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* The first sample is the reference for the comparisons */
+  minVal = *pSrc;
+  maxVal = *pSrc;
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  {
+    q31_t input1;                                /* Two packed samples */
+    q7_t x0, x1;                                 /* The two samples */
+
+    /*loop Unrolling */
+    blkCnt = blockSize >> 2u;
+
+    /* First part of the processing with loop unrolling.  Compute 4 samples at a time.
+     ** a second loop below computes the remaining 1 to 3 samples. */
+    while(blkCnt > 0u)
+    {
+      /* Pack two samples as in arm_power_q7() for the sum and the sum of squares of two samples per instruction */
+      x0 = *pSrc++;
+      x1 = *pSrc++;
+      input1 = ((q31_t) x0 & 0x0000FFFF) | ((q31_t) x1 << 16);
+      sum = __SMLAD(input1, 0x00010001, sum);
+      sumOfSquares = __SMLAD(input1, input1, sumOfSquares);
+
+      if(x0 < minVal)
+      {
+        minVal = x0;
+        minIndex = i;
+      }
+      if(x0 > maxVal)
+      {
+        maxVal = x0;
+        maxIndex = i;
+      }
+      if(x1 < minVal)
+      {
+        minVal = x1;
+        minIndex = i + 1u;
+      }
+      if(x1 > maxVal)
+      {
+        maxVal = x1;
+        maxIndex = i + 1u;
+      }
+
+      x0 = *pSrc++;
+      x1 = *pSrc++;
+      input1 = ((q31_t) x0 & 0x0000FFFF) | ((q31_t) x1 << 16);
+      sum = __SMLAD(input1, 0x00010001, sum);
+      sumOfSquares = __SMLAD(input1, input1, sumOfSquares);
+
+      if(x0 < minVal)
+      {
+        minVal = x0;
+        minIndex = i + 2u;
+      }
+      if(x0 > maxVal)
+      {
+        maxVal = x0;
+        maxIndex = i + 2u;
+      }
+      if(x1 < minVal)
+      {
+        minVal = x1;
+        minIndex = i + 3u;
+      }
+      if(x1 > maxVal)
+      {
+        maxVal = x1;
+        maxIndex = i + 3u;
+      }
+
+      i += 4u;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* If the blockSize is not a multiple of 4, compute any remaining samples here.
+     ** No loop unrolling is used. */
+    blkCnt = blockSize % 0x4u;
+  }
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+    sum += in;
+    sumOfSquares += (q15_t) in * in;
+
+    /* The comparisons are strict, so the first of equal extremes is kept */
+    if(in < minVal)
+    {
+      minVal = in;
+      minIndex = i;
+    }
+    if(in > maxVal)
+    {
+      maxVal = in;
+      maxIndex = i;
+    }
+
+    i++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Derive the statistics from the two sums */
+  pResult->mean = (q7_t) (sum / (q31_t) blockSize);
+  pResult->power = sumOfSquares;
+
+  /* RMS: the mean of the squares in 2.14 format, its square root in 1.31 format */
+  arm_sqrt_q31(clip_q63_to_q31((q63_t) (sumOfSquares / (q31_t) blockSize) << 17), &root);
+  pResult->rms = (q7_t) (root >> 24);
+
+  /* Variance in 18.14 format: (sum(x^2) - sum(x)^2 / N) / (N - 1) */
+  var = 0;
+
+  if(blockSize > 1u)
+  {
+    var = (q31_t) ((sumOfSquares - ((q63_t) sum * sum) / (q31_t) blockSize) / (q31_t) (blockSize - 1u));
+  }
+
+  pResult->var = (q15_t) __SSAT(var << 1, 16);
+  arm_sqrt_q31(clip_q63_to_q31((q63_t) var << 17), &root);
+  pResult->std = (q7_t) (root >> 24);
+
+  pResult->min = minVal;
+  pResult->max = maxVal;
+  pResult->minIndex = minIndex;
+  pResult->maxIndex = maxIndex;
+}
+
+/**
+ * @} end of FusedStats group
+ */
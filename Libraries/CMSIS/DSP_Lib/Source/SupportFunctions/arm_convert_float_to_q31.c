@@ -0,0 +1,398 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_convert_float_to_q31.c
+*
+* Description:	Floating-point to Q31 conversion with dither and saturation count.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup DitherConvert
+ * @{
+ */
+
+/**
+ * @brief  Saturates a scaled floating-point value to Q31 and counts the saturation.
+ * @param[in]      in value scaled by 2^31.
+ * @param[in,out]  *pSatCnt points to the count of saturated samples.
+ * @return the Q31 value.
+ *
+ * The comparisons are made before the conversion, which is not defined outside of the
+ * 32 bit range and costs a library call in 64 bits.
+ */
+
+static __INLINE q31_t arm_convert_clip_q31(
+  float32_t in,
+  uint32_t * pSatCnt)
+{
+  if(in >= 2147483648.0f)
+  {
+    (*pSatCnt)++;
+    return (0x7FFFFFFF);
+  }
+  else if(in < -2147483648.0f)
+  {
+    (*pSatCnt)++;
+    return ((q31_t) 0x80000000);
+  }
+  else
+  {
+    return ((q31_t) in);
+  }
+}
+
+/**
+ * @brief  Converts the elements of the floating-point vector to Q31 vector with dither.
+ * @param[in,out] *S points to an instance of the conversion structure.
+ * @param[in]  *pSrc points to the floating-point input vector.
+ * @param[out] *pDst points to the Q31 output vector.
+ * @param[in]  blockSize length of the input vector.
+ * @return number of saturated samples, 0 if the count is disabled.
+ *
+ * \par Description:
+ * The equation used for the conversion process is:
+ * <pre>
+ * 	pDst[n] = (q31_t)(pSrc[n] * 2147483648 + dither + rounding);   0 <= n < blockSize.
+ * </pre>
+ * \par
+ * A floating-point value holds 24 significant bits, so the dither and the rounding only
+ * change the results for inputs of magnitude below about 2^-8, where the spacing of the
+ * floating-point values reaches the Q31 LSB.  They matter for signals that fade out.
+ * \par Scaling and Overflow Behavior:
+ * \par
+ * Results outside of the Q31 range [0x80000000 0x7FFFFFFF] are saturated and counted.
+ */
+
+uint32_t arm_convert_float_to_q31(
+  arm_convert_instance * S,
+  float32_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pIn = pSrc;                         /* Src pointer */
+  float32_t in;                                  /* Temporary variable */
+  uint32_t state[8];                             /* dither generator states */
+  uint32_t dither = (S->mode == ARM_CONVERT_DITHER_TPDF);       /* dither flag */
+  uint32_t rounding = (S->mode != ARM_CONVERT_TRUNCATE);        /* rounding flag */
+  uint32_t counting = (S->countFlag != 0u);      /* count flag */
+  uint32_t satCnt = 0u;                          /* number of saturated samples */
+  uint32_t blkCnt;                               /* loop counter */
+  uint32_t r = 0u;                               /* dither generator value */
+  uint32_t i = 0u;                               /* dither index, sample modulo 16 */
+  uint32_t k;                                    /* generator index */
+
+#ifndef ARM_MATH_CM0
+
+  float32_t in1, in2, in3;                       /* Temporary variables */
+  uint32_t r1;                                   /* dither generator value */
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  for (k = 0u; k < 8u; k++)
+  {
+    state[k] = S->state[k];
+  }
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C = A * 2147483648 */
+    in = pIn[0] * 2147483648.0f;
+    in1 = pIn[1] * 2147483648.0f;
+    in2 = pIn[2] * 2147483648.0f;
+    in3 = pIn[3] * 2147483648.0f;
+    pIn += 4u;
+
+    if(dither != 0u)
+    {
+      /* Add the dither of the next two generators, scaled from 2^-8 LSB to LSB */
+      r = arm_convert_xorshift(&state[i >> 1]);
+      r1 = arm_convert_xorshift(&state[(i >> 1) + 1u]);
+      i = (i + 4u) & 0xFu;
+
+      in += (float32_t) arm_convert_tpdf(r) * 0.00390625f;
+      in1 += (float32_t) arm_convert_tpdf(r >> 16) * 0.00390625f;
+      in2 += (float32_t) arm_convert_tpdf(r1) * 0.00390625f;
+      in3 += (float32_t) arm_convert_tpdf(r1 >> 16) * 0.00390625f;
+    }
+
+    if(rounding != 0u)
+    {
+      /* Add +0.5 to positive and -0.5 to the other values */
+      in += in > 0.0f ? 0.5f : -0.5f;
+      in1 += in1 > 0.0f ? 0.5f : -0.5f;
+      in2 += in2 > 0.0f ? 0.5f : -0.5f;
+      in3 += in3 > 0.0f ? 0.5f : -0.5f;
+    }
+
+    /* Saturate, count the saturated samples and truncate to 32 bits */
+    pDst[0] = arm_convert_clip_q31(in, &satCnt);
+    pDst[1] = arm_convert_clip_q31(in1, &satCnt);
+    pDst[2] = arm_convert_clip_q31(in2, &satCnt);
+    pDst[3] = arm_convert_clip_q31(in3, &satCnt);
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+#if defined (ARM_MATH_SSE2)
+
+  /* Host build: convert 16 samples per SSE2 operation.  The eight generators run in the
+   ** lanes of two vectors and step once per 16 samples.  _mm_cvttps_epi32 returns
+   ** 0x80000000 for the values beyond the range, which the mask of the positive ones turns
+   ** into 0x7FFFFFFF. */
+  {
+    __m128 vIn0, vIn1, vIn2, vIn3, vPos0, vPos1, vPos2, vPos3;
+    __m128i vState0, vState1, vSat;
+    const __m128 vScale = _mm_set1_ps(2147483648.0f);
+    const __m128 vMin = _mm_set1_ps(-2147483648.0f);
+    const __m128 vDitherScale = _mm_set1_ps(0.00390625f);
+    const __m128 vHalf = _mm_set1_ps(0.5f);
+    const __m128 vSign = _mm_set1_ps(-0.0f);
+    const __m128i vPair = _mm_set1_epi32(0xFFFF0001);
+
+    vState0 = _mm_loadu_si128((__m128i *) state);
+    vState1 = _mm_loadu_si128((__m128i *) (state + 4));
+    vSat = _mm_setzero_si128();
+
+    blkCnt = blockSize >> 4u;
+
+    while(blkCnt > 0u)
+    {
+      /* C = A * 2147483648 */
+      vIn0 = _mm_mul_ps(_mm_loadu_ps(pIn), vScale);
+      vIn1 = _mm_mul_ps(_mm_loadu_ps(pIn + 4), vScale);
+      vIn2 = _mm_mul_ps(_mm_loadu_ps(pIn + 8), vScale);
+      vIn3 = _mm_mul_ps(_mm_loadu_ps(pIn + 12), vScale);
+
+      if(dither != 0u)
+      {
+        /* Step the generators */
+        vState0 = _mm_xor_si128(vState0, _mm_slli_epi32(vState0, 13));
+        vState1 = _mm_xor_si128(vState1, _mm_slli_epi32(vState1, 13));
+        vState0 = _mm_xor_si128(vState0, _mm_srli_epi32(vState0, 17));
+        vState1 = _mm_xor_si128(vState1, _mm_srli_epi32(vState1, 17));
+        vState0 = _mm_xor_si128(vState0, _mm_slli_epi32(vState0, 5));
+        vState1 = _mm_xor_si128(vState1, _mm_slli_epi32(vState1, 5));
+
+        /* Add the differences of the byte pairs of the values, scaled from 2^-8 LSB to LSB */
+        vIn0 = _mm_add_ps(vIn0, _mm_mul_ps(_mm_cvtepi32_ps(_mm_madd_epi16(_mm_unpacklo_epi8(vState0, _mm_setzero_si128()), vPair)), vDitherScale));
+        vIn1 = _mm_add_ps(vIn1, _mm_mul_ps(_mm_cvtepi32_ps(_mm_madd_epi16(_mm_unpackhi_epi8(vState0, _mm_setzero_si128()), vPair)), vDitherScale));
+        vIn2 = _mm_add_ps(vIn2, _mm_mul_ps(_mm_cvtepi32_ps(_mm_madd_epi16(_mm_unpacklo_epi8(vState1, _mm_setzero_si128()), vPair)), vDitherScale));
+        vIn3 = _mm_add_ps(vIn3, _mm_mul_ps(_mm_cvtepi32_ps(_mm_madd_epi16(_mm_unpackhi_epi8(vState1, _mm_setzero_si128()), vPair)), vDitherScale));
+      }
+
+      if(rounding != 0u)
+      {
+        /* Add 0.5 with the sign of the value, which truncates the same as the scalar code */
+        vIn0 = _mm_add_ps(vIn0, _mm_or_ps(vHalf, _mm_and_ps(vIn0, vSign)));
+        vIn1 = _mm_add_ps(vIn1, _mm_or_ps(vHalf, _mm_and_ps(vIn1, vSign)));
+        vIn2 = _mm_add_ps(vIn2, _mm_or_ps(vHalf, _mm_and_ps(vIn2, vSign)));
+        vIn3 = _mm_add_ps(vIn3, _mm_or_ps(vHalf, _mm_and_ps(vIn3, vSign)));
+      }
+
+      /* Find the positive lanes outside of the Q31 range and count all of these lanes */
+      vPos0 = _mm_cmpge_ps(vIn0, vScale);
+      vPos1 = _mm_cmpge_ps(vIn1, vScale);
+      vPos2 = _mm_cmpge_ps(vIn2, vScale);
+      vPos3 = _mm_cmpge_ps(vIn3, vScale);
+
+      if(counting != 0u)
+      {
+        vSat = _mm_sub_epi32(vSat, _mm_castps_si128(_mm_or_ps(vPos0, _mm_cmplt_ps(vIn0, vMin))));
+        vSat = _mm_sub_epi32(vSat, _mm_castps_si128(_mm_or_ps(vPos1, _mm_cmplt_ps(vIn1, vMin))));
+        vSat = _mm_sub_epi32(vSat, _mm_castps_si128(_mm_or_ps(vPos2, _mm_cmplt_ps(vIn2, vMin))));
+        vSat = _mm_sub_epi32(vSat, _mm_castps_si128(_mm_or_ps(vPos3, _mm_cmplt_ps(vIn3, vMin))));
+      }
+
+      /* Truncate to 32 bits and saturate the positive lanes */
+      _mm_storeu_si128((__m128i *) pDst, _mm_xor_si128(_mm_cvttps_epi32(vIn0), _mm_castps_si128(vPos0)));
+      _mm_storeu_si128((__m128i *) (pDst + 4), _mm_xor_si128(_mm_cvttps_epi32(vIn1), _mm_castps_si128(vPos1)));
+      _mm_storeu_si128((__m128i *) (pDst + 8), _mm_xor_si128(_mm_cvttps_epi32(vIn2), _mm_castps_si128(vPos2)));
+      _mm_storeu_si128((__m128i *) (pDst + 12), _mm_xor_si128(_mm_cvttps_epi32(vIn3), _mm_castps_si128(vPos3)));
+
+      pIn += 16u;
+      pDst += 16u;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Sum the counts of the lanes */
+    vSat = _mm_add_epi32(vSat, _mm_shuffle_epi32(vSat, 0x4E));
+    vSat = _mm_add_epi32(vSat, _mm_shuffle_epi32(vSat, 0xB1));
+    satCnt = (uint32_t) _mm_cvtsi128_si32(vSat);
+
+    _mm_storeu_si128((__m128i *) state, vState0);
+    _mm_storeu_si128((__m128i *) (state + 4), vState1);
+  }
+
+  /* Compute the remaining 1 to 15 samples below */
+  blkCnt = blockSize % 0x10u;
+
+#elif defined (ARM_MATH_NEON)
+
+  /* Host build: convert 16 samples per NEON operation.  The eight generators run in the
+   ** lanes of two vectors and step once per 16 samples.  vcvtq_s32_f32 saturates, so the
+   ** range is only compared to count the saturated lanes. */
+  {
+    float32x4_t vIn0, vIn1, vIn2, vIn3;
+    int16x8_t vD0, vD1;
+    uint32x4_t vState0, vState1, vSat;
+
+    vState0 = vld1q_u32(state);
+    vState1 = vld1q_u32(state + 4);
+    vSat = vdupq_n_u32(0u);
+
+    blkCnt = blockSize >> 4u;
+
+    while(blkCnt > 0u)
+    {
+      /* C = A * 2147483648 */
+      vIn0 = vmulq_n_f32(vld1q_f32(pIn), 2147483648.0f);
+      vIn1 = vmulq_n_f32(vld1q_f32(pIn + 4), 2147483648.0f);
+      vIn2 = vmulq_n_f32(vld1q_f32(pIn + 8), 2147483648.0f);
+      vIn3 = vmulq_n_f32(vld1q_f32(pIn + 12), 2147483648.0f);
+
+      if(dither != 0u)
+      {
+        /* Step the generators */
+        vState0 = veorq_u32(vState0, vshlq_n_u32(vState0, 13));
+        vState1 = veorq_u32(vState1, vshlq_n_u32(vState1, 13));
+        vState0 = veorq_u32(vState0, vshrq_n_u32(vState0, 17));
+        vState1 = veorq_u32(vState1, vshrq_n_u32(vState1, 17));
+        vState0 = veorq_u32(vState0, vshlq_n_u32(vState0, 5));
+        vState1 = veorq_u32(vState1, vshlq_n_u32(vState1, 5));
+
+        /* Subtract the bytes of the values in pairs */
+        vD0 = vsubq_s16(vreinterpretq_s16_u16(vandq_u16(vreinterpretq_u16_u32(vState0), vdupq_n_u16(0xFFu))),
+                        vreinterpretq_s16_u16(vshrq_n_u16(vreinterpretq_u16_u32(vState0), 8)));
+        vD1 = vsubq_s16(vreinterpretq_s16_u16(vandq_u16(vreinterpretq_u16_u32(vState1), vdupq_n_u16(0xFFu))),
+                        vreinterpretq_s16_u16(vshrq_n_u16(vreinterpretq_u16_u32(vState1), 8)));
+
+        /* Add the dither, scaled from 2^-8 LSB to LSB */
+        vIn0 = vaddq_f32(vIn0, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(vD0))), 0.00390625f));
+        vIn1 = vaddq_f32(vIn1, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(vD0))), 0.00390625f));
+        vIn2 = vaddq_f32(vIn2, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(vD1))), 0.00390625f));
+        vIn3 = vaddq_f32(vIn3, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(vD1))), 0.00390625f));
+      }
+
+      if(rounding != 0u)
+      {
+        /* Add +0.5 to positive and -0.5 to the other values */
+        vIn0 = vaddq_f32(vIn0, vbslq_f32(vcgtq_f32(vIn0, vdupq_n_f32(0.0f)), vdupq_n_f32(0.5f), vdupq_n_f32(-0.5f)));
+        vIn1 = vaddq_f32(vIn1, vbslq_f32(vcgtq_f32(vIn1, vdupq_n_f32(0.0f)), vdupq_n_f32(0.5f), vdupq_n_f32(-0.5f)));
+        vIn2 = vaddq_f32(vIn2, vbslq_f32(vcgtq_f32(vIn2, vdupq_n_f32(0.0f)), vdupq_n_f32(0.5f), vdupq_n_f32(-0.5f)));
+        vIn3 = vaddq_f32(vIn3, vbslq_f32(vcgtq_f32(vIn3, vdupq_n_f32(0.0f)), vdupq_n_f32(0.5f), vdupq_n_f32(-0.5f)));
+      }
+
+      if(counting != 0u)
+      {
+        /* Count the lanes outside of the Q31 range */
+        vSat = vsubq_u32(vSat, vorrq_u32(vcgeq_f32(vIn0, vdupq_n_f32(2147483648.0f)), vcltq_f32(vIn0, vdupq_n_f32(-2147483648.0f))));
+        vSat = vsubq_u32(vSat, vorrq_u32(vcgeq_f32(vIn1, vdupq_n_f32(2147483648.0f)), vcltq_f32(vIn1, vdupq_n_f32(-2147483648.0f))));
+        vSat = vsubq_u32(vSat, vorrq_u32(vcgeq_f32(vIn2, vdupq_n_f32(2147483648.0f)), vcltq_f32(vIn2, vdupq_n_f32(-2147483648.0f))));
+        vSat = vsubq_u32(vSat, vorrq_u32(vcgeq_f32(vIn3, vdupq_n_f32(2147483648.0f)), vcltq_f32(vIn3, vdupq_n_f32(-2147483648.0f))));
+      }
+
+      /* Truncate and saturate to 32 bits */
+      vst1q_s32(pDst, vcvtq_s32_f32(vIn0));
+      vst1q_s32(pDst + 4, vcvtq_s32_f32(vIn1));
+      vst1q_s32(pDst + 8, vcvtq_s32_f32(vIn2));
+      vst1q_s32(pDst + 12, vcvtq_s32_f32(vIn3));
+
+      pIn += 16u;
+      pDst += 16u;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Sum the counts of the lanes */
+    satCnt = vgetq_lane_u32(vSat, 0) + vgetq_lane_u32(vSat, 1) +
+      vgetq_lane_u32(vSat, 2) + vgetq_lane_u32(vSat, 3);
+
+    vst1q_u32(state, vState0);
+    vst1q_u32(state + 4, vState1);
+  }
+
+  /* Compute the remaining 1 to 15 samples below */
+  blkCnt = blockSize % 0x10u;
+
+#else
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_SSE2) */
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    /* C = A * 2147483648 */
+    in = *pIn++ * 2147483648.0f;
+
+    if(dither != 0u)
+    {
+      /* Add the dither of the lower half of a new value of the next generator, then of
+       ** its upper half */
+      r = ((i & 1u) == 0u) ? arm_convert_xorshift(&state[i >> 1]) : (r >> 16);
+      i = (i + 1u) & 0xFu;
+      in += (float32_t) arm_convert_tpdf(r) * 0.00390625f;
+    }
+
+    if(rounding != 0u)
+    {
+      /* Add +0.5 to positive and -0.5 to the other values */
+      in += in > 0.0f ? 0.5f : -0.5f;
+    }
+
+    /* Saturate, count the saturated samples and truncate to 32 bits */
+    *pDst++ = arm_convert_clip_q31(in, &satCnt);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Save the generator states for the next call */
+  for (k = 0u; k < 8u; k++)
+  {
+    S->state[k] = state[k];
+  }
+
+  return ((counting != 0u) ? satCnt : 0u);
+}
+
+/**
+ * @} end of DitherConvert group
+ */
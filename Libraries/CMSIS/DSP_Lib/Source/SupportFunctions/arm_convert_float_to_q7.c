@@ -0,0 +1,480 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_convert_float_to_q7.c
+*
+* Description:	Floating-point to Q7 conversion with dither and saturation count.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup DitherConvert
+ * @{
+ */
+
+/**
+ * @brief  Converts the elements of the floating-point vector to Q7 vector with dither.
+ * @param[in,out] *S points to an instance of the conversion structure.
+ * @param[in]  *pSrc points to the floating-point input vector.
+ * @param[out] *pDst points to the Q7 output vector.
+ * @param[in]  blockSize length of the input vector.
+ * @return number of saturated samples, 0 if the count is disabled.
+ *
+ * \par Description:
+ * The equation used for the conversion process is:
+ * <pre>
+ * 	pDst[n] = (q7_t)(pSrc[n] * 128 + rounding);   0 <= n < blockSize.
+ * </pre>
+ * and with dither, in units of 2^-8 LSB:
+ * <pre>
+ * 	pDst[n] = (q7_t)(((q31_t)(pSrc[n] * 2^15) + dither + 0x80) >> 8);   0 <= n < blockSize.
+ * </pre>
+ * \par Scaling and Overflow Behavior:
+ * \par
+ * Results outside of the Q7 range [0x80 0x7F] are saturated and counted.  Inputs
+ * are expected to lie within +/-2^24, or +/-65535 with dither, beyond which the
+ * conversion to 32 bits is not defined.
+ */
+
+uint32_t arm_convert_float_to_q7(
+  arm_convert_instance * S,
+  float32_t * pSrc,
+  q7_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pIn = pSrc;                         /* Src pointer */
+  float32_t in;                                  /* Temporary variable */
+  q31_t out;                                     /* output before saturation */
+  uint32_t state[8];                             /* dither generator states */
+  uint32_t dither = (S->mode == ARM_CONVERT_DITHER_TPDF);       /* dither flag */
+  uint32_t rounding = (S->mode != ARM_CONVERT_TRUNCATE);        /* rounding flag */
+  uint32_t counting = (S->countFlag != 0u);      /* count flag */
+  uint32_t satCnt = 0u;                          /* number of saturated samples */
+  uint32_t blkCnt;                               /* loop counter */
+  uint32_t r = 0u;                               /* dither generator value */
+  uint32_t i = 0u;                               /* dither index, sample modulo 16 */
+  uint32_t k;                                    /* generator index */
+
+#ifndef ARM_MATH_CM0
+
+  float32_t in1, in2, in3;                       /* Temporary variables */
+  q31_t out1, out2, out3;                        /* outputs before saturation */
+  q31_t sat, sat1, sat2, sat3;                   /* saturated outputs */
+  uint32_t r1;                                   /* dither generator value */
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  for (k = 0u; k < 8u; k++)
+  {
+    state[k] = S->state[k];
+  }
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    if(dither != 0u)
+    {
+      /* Take the dither of the next two generators */
+      r = arm_convert_xorshift(&state[i >> 1]);
+      r1 = arm_convert_xorshift(&state[(i >> 1) + 1u]);
+      i = (i + 4u) & 0xFu;
+
+      /* C = ((q31_t) (A * 2^15) + dither + 0x80) >> 8, in units of 2^-8 LSB */
+      out = ((q31_t) (pIn[0] * 32768.0f) + arm_convert_tpdf(r) + 0x80) >> 8;
+      out1 = ((q31_t) (pIn[1] * 32768.0f) + arm_convert_tpdf(r >> 16) + 0x80) >> 8;
+      out2 = ((q31_t) (pIn[2] * 32768.0f) + arm_convert_tpdf(r1) + 0x80) >> 8;
+      out3 = ((q31_t) (pIn[3] * 32768.0f) + arm_convert_tpdf(r1 >> 16) + 0x80) >> 8;
+    }
+    else
+    {
+      /* C = A * 128 */
+      in = pIn[0] * 128.0f;
+      in1 = pIn[1] * 128.0f;
+      in2 = pIn[2] * 128.0f;
+      in3 = pIn[3] * 128.0f;
+
+      if(rounding != 0u)
+      {
+        /* Add +0.5 to positive and -0.5 to the other values */
+        in += in > 0.0f ? 0.5f : -0.5f;
+        in1 += in1 > 0.0f ? 0.5f : -0.5f;
+        in2 += in2 > 0.0f ? 0.5f : -0.5f;
+        in3 += in3 > 0.0f ? 0.5f : -0.5f;
+      }
+
+      /* Truncate to 32 bits */
+      out = (q31_t) in;
+      out1 = (q31_t) in1;
+      out2 = (q31_t) in2;
+      out3 = (q31_t) in3;
+    }
+
+    pIn += 4u;
+
+    /* Saturate to 8 bits and count the saturated samples */
+    sat = __SSAT(out, 8);
+    sat1 = __SSAT(out1, 8);
+    sat2 = __SSAT(out2, 8);
+    sat3 = __SSAT(out3, 8);
+
+    satCnt += (uint32_t) (sat != out) + (uint32_t) (sat1 != out1) +
+      (uint32_t) (sat2 != out2) + (uint32_t) (sat3 != out3);
+
+    /* Store the four results with one write */
+    *__SIMD32(pDst)++ = __PACKq7(sat, sat1, sat2, sat3);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+#if defined (ARM_MATH_SSE2)
+
+  /* Host build: convert 16 samples per SSE2 operation.  The eight generators run in the
+   ** lanes of two vectors and step once per 16 samples. */
+  {
+    __m128 vIn0, vIn1, vIn2, vIn3;
+    __m128i vOut0, vOut1, vOut2, vOut3, vState0, vState1, vLo, vSat;
+    const __m128 vScale = _mm_set1_ps(128.0f);
+    const __m128 vDitherScale = _mm_set1_ps(32768.0f);
+    const __m128 vHalf = _mm_set1_ps(0.5f);
+    const __m128 vSign = _mm_set1_ps(-0.0f);
+    const __m128i vRound = _mm_set1_epi32(0x80);
+    const __m128i vPair = _mm_set1_epi32(0xFFFF0001);
+    const __m128i vOne = _mm_set1_epi8(1);
+    const __m128i vWrap = _mm_set1_epi8((char) 0x81);
+    const __m128i vBias = _mm_set1_epi32((q31_t) 0x80000080);
+    const __m128i vLimit = _mm_set1_epi32((q31_t) 0x800000FF);
+
+    vSat = _mm_setzero_si128();
+
+    blkCnt = blockSize >> 4u;
+
+    if(dither != 0u)
+    {
+      vState0 = _mm_loadu_si128((__m128i *) state);
+      vState1 = _mm_loadu_si128((__m128i *) (state + 4));
+
+      while(blkCnt > 0u)
+      {
+        /* Step the generators */
+        vState0 = _mm_xor_si128(vState0, _mm_slli_epi32(vState0, 13));
+        vState1 = _mm_xor_si128(vState1, _mm_slli_epi32(vState1, 13));
+        vState0 = _mm_xor_si128(vState0, _mm_srli_epi32(vState0, 17));
+        vState1 = _mm_xor_si128(vState1, _mm_srli_epi32(vState1, 17));
+        vState0 = _mm_xor_si128(vState0, _mm_slli_epi32(vState0, 5));
+        vState1 = _mm_xor_si128(vState1, _mm_slli_epi32(vState1, 5));
+
+        /* Widen the bytes of the values, subtract them in pairs and add 0x80 */
+        vOut0 = _mm_add_epi32(_mm_madd_epi16(_mm_unpacklo_epi8(vState0, _mm_setzero_si128()), vPair), vRound);
+        vOut1 = _mm_add_epi32(_mm_madd_epi16(_mm_unpackhi_epi8(vState0, _mm_setzero_si128()), vPair), vRound);
+        vOut2 = _mm_add_epi32(_mm_madd_epi16(_mm_unpacklo_epi8(vState1, _mm_setzero_si128()), vPair), vRound);
+        vOut3 = _mm_add_epi32(_mm_madd_epi16(_mm_unpackhi_epi8(vState1, _mm_setzero_si128()), vPair), vRound);
+
+        /* C = ((q31_t) (A * 2^15) + dither + 0x80) >> 8, in units of 2^-8 LSB */
+        vOut0 = _mm_srai_epi32(_mm_add_epi32(_mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(pIn), vDitherScale)), vOut0), 8);
+        vOut1 = _mm_srai_epi32(_mm_add_epi32(_mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(pIn + 4), vDitherScale)), vOut1), 8);
+        vOut2 = _mm_srai_epi32(_mm_add_epi32(_mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(pIn + 8), vDitherScale)), vOut2), 8);
+        vOut3 = _mm_srai_epi32(_mm_add_epi32(_mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(pIn + 12), vDitherScale)), vOut3), 8);
+
+        if(counting != 0u)
+        {
+          /* Count the lanes outside of the 8 bit range, the ones where A + 0x80 exceeds
+           ** 0xFF as an unsigned value */
+          vSat = _mm_sub_epi32(vSat, _mm_cmpgt_epi32(_mm_add_epi32(vOut0, vBias), vLimit));
+          vSat = _mm_sub_epi32(vSat, _mm_cmpgt_epi32(_mm_add_epi32(vOut1, vBias), vLimit));
+          vSat = _mm_sub_epi32(vSat, _mm_cmpgt_epi32(_mm_add_epi32(vOut2, vBias), vLimit));
+          vSat = _mm_sub_epi32(vSat, _mm_cmpgt_epi32(_mm_add_epi32(vOut3, vBias), vLimit));
+        }
+
+        /* Saturate to 16 and then to 8 bits */
+        _mm_storeu_si128((__m128i *) pDst, _mm_packs_epi16(_mm_packs_epi32(vOut0, vOut1), _mm_packs_epi32(vOut2, vOut3)));
+
+        pIn += 16u;
+        pDst += 16u;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+      }
+
+      _mm_storeu_si128((__m128i *) state, vState0);
+      _mm_storeu_si128((__m128i *) (state + 4), vState1);
+    }
+    else if((rounding == 0u) && (counting == 0u))
+    {
+      /* The loop without rounding and without the count */
+      while(blkCnt > 0u)
+      {
+        /* C = A * 128 */
+        vIn0 = _mm_mul_ps(_mm_loadu_ps(pIn), vScale);
+        vIn1 = _mm_mul_ps(_mm_loadu_ps(pIn + 4), vScale);
+        vIn2 = _mm_mul_ps(_mm_loadu_ps(pIn + 8), vScale);
+        vIn3 = _mm_mul_ps(_mm_loadu_ps(pIn + 12), vScale);
+
+        /* Truncate to 32 bits and saturate to 16 and then to 8 bits */
+        _mm_storeu_si128((__m128i *) pDst, _mm_packs_epi16(_mm_packs_epi32(_mm_cvttps_epi32(vIn0), _mm_cvttps_epi32(vIn1)),
+                                                           _mm_packs_epi32(_mm_cvttps_epi32(vIn2), _mm_cvttps_epi32(vIn3))));
+
+        pIn += 16u;
+        pDst += 16u;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+      }
+    }
+    else
+    {
+      /* Rounding, or truncation with the count.  The count keeps the smallest result plus
+       ** 0x81 as an unsigned byte, which wraps both full scale values to the bottom of the
+       ** range, and counts the samples in a second pass when these were reached. */
+      vLo = _mm_set1_epi8((char) 0xFF);
+
+      while(blkCnt > 0u)
+      {
+        /* C = A * 128 */
+        vIn0 = _mm_mul_ps(_mm_loadu_ps(pIn), vScale);
+        vIn1 = _mm_mul_ps(_mm_loadu_ps(pIn + 4), vScale);
+        vIn2 = _mm_mul_ps(_mm_loadu_ps(pIn + 8), vScale);
+        vIn3 = _mm_mul_ps(_mm_loadu_ps(pIn + 12), vScale);
+
+        if(rounding != 0u)
+        {
+          /* Add 0.5 with the sign of the value */
+          vIn0 = _mm_add_ps(vIn0, _mm_or_ps(vHalf, _mm_and_ps(vIn0, vSign)));
+          vIn1 = _mm_add_ps(vIn1, _mm_or_ps(vHalf, _mm_and_ps(vIn1, vSign)));
+          vIn2 = _mm_add_ps(vIn2, _mm_or_ps(vHalf, _mm_and_ps(vIn2, vSign)));
+          vIn3 = _mm_add_ps(vIn3, _mm_or_ps(vHalf, _mm_and_ps(vIn3, vSign)));
+        }
+
+        /* Truncate to 32 bits and saturate to 16 and then to 8 bits */
+        vOut0 = _mm_packs_epi32(_mm_cvttps_epi32(vIn0), _mm_cvttps_epi32(vIn1));
+        vOut1 = _mm_packs_epi32(_mm_cvttps_epi32(vIn2), _mm_cvttps_epi32(vIn3));
+        vOut2 = _mm_packs_epi16(vOut0, vOut1);
+        _mm_storeu_si128((__m128i *) pDst, vOut2);
+
+        if(counting != 0u)
+        {
+          vLo = _mm_min_epu8(vLo, _mm_add_epi8(vOut2, vWrap));
+        }
+
+        pIn += 16u;
+        pDst += 16u;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+      }
+
+      if(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_min_epu8(vLo, vOne), vLo)) != 0)
+      {
+        /* Count the lanes outside of the 8 bit range, the ones where A + 0x80 exceeds 0xFF
+         ** as an unsigned value */
+        pIn = pSrc;
+        blkCnt = (blockSize >> 4u) << 2u;
+
+        while(blkCnt > 0u)
+        {
+          vIn0 = _mm_mul_ps(_mm_loadu_ps(pIn), vScale);
+
+          if(rounding != 0u)
+          {
+            vIn0 = _mm_add_ps(vIn0, _mm_or_ps(vHalf, _mm_and_ps(vIn0, vSign)));
+          }
+
+          vSat = _mm_sub_epi32(vSat, _mm_cmpgt_epi32(_mm_add_epi32(_mm_cvttps_epi32(vIn0), vBias), vLimit));
+
+          pIn += 4u;
+
+          /* Decrement the loop counter */
+          blkCnt--;
+        }
+      }
+    }
+
+    /* Sum the counts of the lanes */
+    vSat = _mm_add_epi32(vSat, _mm_shuffle_epi32(vSat, 0x4E));
+    vSat = _mm_add_epi32(vSat, _mm_shuffle_epi32(vSat, 0xB1));
+    satCnt = (uint32_t) _mm_cvtsi128_si32(vSat);
+  }
+
+  /* Compute the remaining 1 to 15 samples below */
+  blkCnt = blockSize % 0x10u;
+
+#elif defined (ARM_MATH_NEON)
+
+  /* Host build: convert 16 samples per NEON operation.  The eight generators run in the
+   ** lanes of two vectors and step once per 16 samples. */
+  {
+    float32x4_t vIn0, vIn1, vIn2, vIn3;
+    int32x4_t vOut0, vOut1, vOut2, vOut3;
+    int16x8_t vD0, vD1;
+    uint32x4_t vState0, vState1, vSat;
+
+    vState0 = vld1q_u32(state);
+    vState1 = vld1q_u32(state + 4);
+    vSat = vdupq_n_u32(0u);
+
+    blkCnt = blockSize >> 4u;
+
+    while(blkCnt > 0u)
+    {
+      if(dither != 0u)
+      {
+        /* Step the generators */
+        vState0 = veorq_u32(vState0, vshlq_n_u32(vState0, 13));
+        vState1 = veorq_u32(vState1, vshlq_n_u32(vState1, 13));
+        vState0 = veorq_u32(vState0, vshrq_n_u32(vState0, 17));
+        vState1 = veorq_u32(vState1, vshrq_n_u32(vState1, 17));
+        vState0 = veorq_u32(vState0, vshlq_n_u32(vState0, 5));
+        vState1 = veorq_u32(vState1, vshlq_n_u32(vState1, 5));
+
+        /* Subtract the bytes of the values in pairs */
+        vD0 = vsubq_s16(vreinterpretq_s16_u16(vandq_u16(vreinterpretq_u16_u32(vState0), vdupq_n_u16(0xFFu))),
+                        vreinterpretq_s16_u16(vshrq_n_u16(vreinterpretq_u16_u32(vState0), 8)));
+        vD1 = vsubq_s16(vreinterpretq_s16_u16(vandq_u16(vreinterpretq_u16_u32(vState1), vdupq_n_u16(0xFFu))),
+                        vreinterpretq_s16_u16(vshrq_n_u16(vreinterpretq_u16_u32(vState1), 8)));
+
+        /* C = ((q31_t) (A * 2^15) + dither + 0x80) >> 8, in units of 2^-8 LSB */
+        vOut0 = vshrq_n_s32(vaddq_s32(vcvtq_s32_f32(vmulq_n_f32(vld1q_f32(pIn), 32768.0f)),
+                                      vaddw_s16(vdupq_n_s32(0x80), vget_low_s16(vD0))), 8);
+        vOut1 = vshrq_n_s32(vaddq_s32(vcvtq_s32_f32(vmulq_n_f32(vld1q_f32(pIn + 4), 32768.0f)),
+                                      vaddw_s16(vdupq_n_s32(0x80), vget_high_s16(vD0))), 8);
+        vOut2 = vshrq_n_s32(vaddq_s32(vcvtq_s32_f32(vmulq_n_f32(vld1q_f32(pIn + 8), 32768.0f)),
+                                      vaddw_s16(vdupq_n_s32(0x80), vget_low_s16(vD1))), 8);
+        vOut3 = vshrq_n_s32(vaddq_s32(vcvtq_s32_f32(vmulq_n_f32(vld1q_f32(pIn + 12), 32768.0f)),
+                                      vaddw_s16(vdupq_n_s32(0x80), vget_high_s16(vD1))), 8);
+      }
+      else
+      {
+        /* C = A * 128 */
+        vIn0 = vmulq_n_f32(vld1q_f32(pIn), 128.0f);
+        vIn1 = vmulq_n_f32(vld1q_f32(pIn + 4), 128.0f);
+        vIn2 = vmulq_n_f32(vld1q_f32(pIn + 8), 128.0f);
+        vIn3 = vmulq_n_f32(vld1q_f32(pIn + 12), 128.0f);
+
+        if(rounding != 0u)
+        {
+          /* Add +0.5 to positive and -0.5 to the other values */
+          vIn0 = vaddq_f32(vIn0, vbslq_f32(vcgtq_f32(vIn0, vdupq_n_f32(0.0f)), vdupq_n_f32(0.5f), vdupq_n_f32(-0.5f)));
+          vIn1 = vaddq_f32(vIn1, vbslq_f32(vcgtq_f32(vIn1, vdupq_n_f32(0.0f)), vdupq_n_f32(0.5f), vdupq_n_f32(-0.5f)));
+          vIn2 = vaddq_f32(vIn2, vbslq_f32(vcgtq_f32(vIn2, vdupq_n_f32(0.0f)), vdupq_n_f32(0.5f), vdupq_n_f32(-0.5f)));
+          vIn3 = vaddq_f32(vIn3, vbslq_f32(vcgtq_f32(vIn3, vdupq_n_f32(0.0f)), vdupq_n_f32(0.5f), vdupq_n_f32(-0.5f)));
+        }
+
+        /* Truncate to 32 bits */
+        vOut0 = vcvtq_s32_f32(vIn0);
+        vOut1 = vcvtq_s32_f32(vIn1);
+        vOut2 = vcvtq_s32_f32(vIn2);
+        vOut3 = vcvtq_s32_f32(vIn3);
+      }
+
+      if(counting != 0u)
+      {
+        /* Count the lanes outside of the 8 bit range */
+        vSat = vsubq_u32(vSat, vorrq_u32(vcgtq_s32(vOut0, vdupq_n_s32(0x7F)), vcltq_s32(vOut0, vdupq_n_s32(-0x80))));
+        vSat = vsubq_u32(vSat, vorrq_u32(vcgtq_s32(vOut1, vdupq_n_s32(0x7F)), vcltq_s32(vOut1, vdupq_n_s32(-0x80))));
+        vSat = vsubq_u32(vSat, vorrq_u32(vcgtq_s32(vOut2, vdupq_n_s32(0x7F)), vcltq_s32(vOut2, vdupq_n_s32(-0x80))));
+        vSat = vsubq_u32(vSat, vorrq_u32(vcgtq_s32(vOut3, vdupq_n_s32(0x7F)), vcltq_s32(vOut3, vdupq_n_s32(-0x80))));
+      }
+
+      /* Saturate to 16 and then to 8 bits */
+      vst1_s8(pDst, vqmovn_s16(vcombine_s16(vqmovn_s32(vOut0), vqmovn_s32(vOut1))));
+      vst1_s8(pDst + 8, vqmovn_s16(vcombine_s16(vqmovn_s32(vOut2), vqmovn_s32(vOut3))));
+
+      pIn += 16u;
+      pDst += 16u;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Sum the counts of the lanes */
+    satCnt = vgetq_lane_u32(vSat, 0) + vgetq_lane_u32(vSat, 1) +
+      vgetq_lane_u32(vSat, 2) + vgetq_lane_u32(vSat, 3);
+
+    vst1q_u32(state, vState0);
+    vst1q_u32(state + 4, vState1);
+  }
+
+  /* Compute the remaining 1 to 15 samples below */
+  blkCnt = blockSize % 0x10u;
+
+#else
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_SSE2) */
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    if(dither != 0u)
+    {
+      /* C = ((q31_t) (A * 2^15) + dither + 0x80) >> 8, with the dither of the lower half
+       ** of a new value of the next generator, then of its upper half */
+      r = ((i & 1u) == 0u) ? arm_convert_xorshift(&state[i >> 1]) : (r >> 16);
+      i = (i + 1u) & 0xFu;
+      out = ((q31_t) (*pIn++ * 32768.0f) + arm_convert_tpdf(r) + 0x80) >> 8;
+    }
+    else
+    {
+      /* C = A * 128 */
+      in = *pIn++ * 128.0f;
+
+      if(rounding != 0u)
+      {
+        /* Add +0.5 to positive and -0.5 to the other values */
+        in += in > 0.0f ? 0.5f : -0.5f;
+      }
+
+      /* Truncate to 32 bits */
+      out = (q31_t) in;
+    }
+
+    /* Saturate to 8 bits and count the saturated samples */
+    *pDst = (q7_t) __SSAT(out, 8);
+    satCnt += (uint32_t) (*pDst++ != out);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Save the generator states for the next call */
+  for (k = 0u; k < 8u; k++)
+  {
+    S->state[k] = state[k];
+  }
+
+  return ((counting != 0u) ? satCnt : 0u);
+}
+
+/**
+ * @} end of DitherConvert group
+ */
@@ -0,0 +1,121 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_convert_init.c
+*
+* Description:	Initialization function for the dithered conversions.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @defgroup DitherConvert Dithered Conversion
+ *
+ * Converts floating-point vectors to fixed-point and Q31 vectors to Q15 with a choice of
+ * rounding, optional TPDF dither and a count of the saturated samples.
+ *
+ * The float_to_x and q31_to_x functions truncate, or round when the library is rebuilt
+ * with <code>ARM_MATH_ROUNDING</code>, and give no hint of clipping.  Truncation and
+ * rounding both leave a quantization error that is correlated with the signal: a fade or
+ * a low-level tone turns into harmonic distortion rather than noise.  These functions
+ * select the behaviour at run time with the <code>mode</code> of the instance:
+ *
+ * - <code>ARM_CONVERT_TRUNCATE</code> gives the results of the legacy functions:
+ *   floating-point values are truncated toward zero, Q31 values toward minus infinity.
+ * - <code>ARM_CONVERT_ROUND</code> rounds to the nearest value, halves away from zero for
+ *   floating-point values and up for Q31 values.
+ * - <code>ARM_CONVERT_DITHER_TPDF</code> adds triangular dither of +/-1 LSB of the output
+ *   before it rounds.  The error then has no dependency on the signal: its mean is zero
+ *   and its power is 1/4 LSB^2 (1/12 from the rounding, 1/6 from the dither) whatever the
+ *   input.  The Q15 and Q7 results of floating-point values are computed in integers:
+ *   the scaled value is truncated to units of 2^-8 LSB, and the dither and half an LSB
+ *   are added before the shift to the output, as for Q31 values.
+ *
+ * With <code>countFlag</code> set, every function returns the number of samples of the
+ * call that were saturated, which can be accumulated to meter clipping without a second
+ * pass over the data.  Without it the functions return 0 and skip the count.
+ *
+ * \par Performance
+ * In truncation mode without the count, the host build runs the loop of arm_float_to_q15()
+ * for the conversion to Q15 and a plain shift and pack loop for the conversion from Q31.
+ * The count adds a few operations per vector, and a second pass over blocks that reach
+ * full scale.  The dither steps a vector of generators with six dependent shifts and
+ * exclusive ors per 16 samples and expands the values, which costs more than the whole
+ * SSE2 loop of arm_float_to_q15().  Against that loop the conversion of floating-point
+ * values to Q15 is therefore only as fast in truncation mode without the count, and
+ * about 1.2, 2 and 4 times slower with the count, in rounding mode and with dither.  The
+ * other conversions are faster than arm_float_to_q7(), arm_float_to_q31() and
+ * arm_q31_to_q15(), whose loops are scalar, in every mode.
+ *
+ * \par Dither generator
+ * The dither comes from eight xorshift32 generators in the instance, each value of which
+ * gives the dither of two samples: <code>(r & 0xFF) - ((r >> 8) & 0xFF)</code> for the
+ * first and the same of <code>r >> 16</code> for the second, in units of 2^-8 LSB.  The
+ * difference of two uniform bytes has the triangular distribution.  Samples
+ * <code>2k</code> and <code>2k + 1</code> of every 16 samples of a call take generator
+ * <code>k</code>, which lets the vector code step all eight in two vectors, and the results
+ * are the same on every target.  The state carries over from call to call, so a stream
+ * can be converted in blocks of any length; only the phase of the generators depends on
+ * the block length, and a call of odd length leaves the upper half of its last value
+ * unused.
+ *
+ * \par Init Function
+ * arm_convert_init() sets the mode and seeds the generators.  Instances converting
+ * different channels should be given different seeds.
+ */
+
+/**
+ * @addtogroup DitherConvert
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the dithered conversions.
+ * @param[out]  *S points to an instance of the conversion structure.
+ * @param[in]   mode rounding mode of the conversions.
+ * @param[in]   countFlag flag that enables (countFlag=1) or disables (countFlag=0) the saturation count.
+ * @param[in]   seed seed of the dither generators, any value.
+ * @return none.
+ */
+
+void arm_convert_init(
+  arm_convert_instance * S,
+  arm_convert_mode mode,
+  uint8_t countFlag,
+  uint32_t seed)
+{
+  uint32_t x;                                    /* Temporary variable */
+  uint32_t i;                                    /* loop counter */
+
+  /* Assign the rounding mode */
+  S->mode = mode;
+
+  /* Assign the count flag */
+  S->countFlag = countFlag;
+
+  /* Derive eight different states from the seed.  The finalizer of MurmurHash3 spreads
+   ** the seed over all bits, and a zero state, which xorshift never leaves, is replaced. */
+  for (i = 0u; i < 8u; i++)
+  {
+    x = seed + (i + 1u) * 0x9E3779B9u;
+    x = (x ^ (x >> 16)) * 0x85EBCA6Bu;
+    x = (x ^ (x >> 13)) * 0xC2B2AE35u;
+    x = x ^ (x >> 16);
+
+    S->state[i] = (x != 0u) ? x : 0x6C078965u;
+  }
+}
+
+/**
+ * @} end of DitherConvert group
+ */
@@ -0,0 +1,485 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_convert_q31_to_q15.c
+*
+* Description:	Q31 to Q15 conversion with dither and saturation count.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup DitherConvert
+ * @{
+ */
+
+/**
+ * @brief  Converts the elements of the Q31 vector to Q15 vector with dither.
+ * @param[in,out] *S points to an instance of the conversion structure.
+ * @param[in]  *pSrc points to the Q31 input vector.
+ * @param[out] *pDst points to the Q15 output vector.
+ * @param[in]  blockSize length of the input vector.
+ * @return number of saturated samples, 0 if the count is disabled.
+ *
+ * \par Description:
+ * The equation used for the conversion process is:
+ * <pre>
+ * 	pDst[n] = (q15_t)((pSrc[n] + dither + 0x8000) >> 16);   0 <= n < blockSize.
+ * </pre>
+ * with neither the dither nor the rounding constant when the mode is
+ * <code>ARM_CONVERT_TRUNCATE</code>.
+ * \par Scaling and Overflow Behavior:
+ * \par
+ * The dither and the rounding constant are multiples of 2^8, so the sum is computed
+ * without overflow and without loss from the input shifted right by 8 bits.  Only the
+ * values at the ends of the range can be rounded or dithered beyond it, and those are
+ * saturated and counted; truncation never saturates.
+ */
+
+uint32_t arm_convert_q31_to_q15(
+  arm_convert_instance * S,
+  q31_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t *pIn = pSrc;                             /* Src pointer */
+  q31_t in, out;                                 /* Temporary variables */
+  uint32_t state[8];                             /* dither generator states */
+  uint32_t dither = (S->mode == ARM_CONVERT_DITHER_TPDF);       /* dither flag */
+  uint32_t rounding = (S->mode != ARM_CONVERT_TRUNCATE);        /* rounding flag */
+  uint32_t counting = (S->countFlag != 0u);      /* count flag */
+  uint32_t satCnt = 0u;                          /* number of saturated samples */
+  uint32_t blkCnt;                               /* loop counter */
+  uint32_t r = 0u;                               /* dither generator value */
+  uint32_t i = 0u;                               /* dither index, sample modulo 16 */
+  uint32_t k;                                    /* generator index */
+
+#ifndef ARM_MATH_CM0
+
+  q31_t in1, in2, in3;                           /* Temporary variables */
+  q31_t out1, out2, out3;                        /* outputs before saturation */
+  q31_t sat, sat1, sat2, sat3;                   /* saturated outputs */
+  q31_t d, d1, d2, d3;                           /* dither and rounding constants */
+  uint32_t r1;                                   /* dither generator value */
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  for (k = 0u; k < 8u; k++)
+  {
+    state[k] = S->state[k];
+  }
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    in = pIn[0];
+    in1 = pIn[1];
+    in2 = pIn[2];
+    in3 = pIn[3];
+    pIn += 4u;
+
+    if(rounding != 0u)
+    {
+      d = 0x80;
+      d1 = 0x80;
+      d2 = 0x80;
+      d3 = 0x80;
+
+      if(dither != 0u)
+      {
+        /* Add the dither of the next two generators */
+        r = arm_convert_xorshift(&state[i >> 1]);
+        r1 = arm_convert_xorshift(&state[(i >> 1) + 1u]);
+        i = (i + 4u) & 0xFu;
+
+        d += arm_convert_tpdf(r);
+        d1 += arm_convert_tpdf(r >> 16);
+        d2 += arm_convert_tpdf(r1);
+        d3 += arm_convert_tpdf(r1 >> 16);
+      }
+
+      /* C = (q15_t) ((A >> 8) + dither + 0x80) >> 8, in units of 2^-8 LSB */
+      out = ((in >> 8) + d) >> 8;
+      out1 = ((in1 >> 8) + d1) >> 8;
+      out2 = ((in2 >> 8) + d2) >> 8;
+      out3 = ((in3 >> 8) + d3) >> 8;
+    }
+    else
+    {
+      /* C = (q15_t) A >> 16 */
+      out = in >> 16;
+      out1 = in1 >> 16;
+      out2 = in2 >> 16;
+      out3 = in3 >> 16;
+    }
+
+    /* Saturate to 16 bits and count the saturated samples */
+    sat = __SSAT(out, 16);
+    sat1 = __SSAT(out1, 16);
+    sat2 = __SSAT(out2, 16);
+    sat3 = __SSAT(out3, 16);
+
+    satCnt += (uint32_t) (sat != out) + (uint32_t) (sat1 != out1) +
+      (uint32_t) (sat2 != out2) + (uint32_t) (sat3 != out3);
+
+    /* Store the results as two pairs */
+#ifndef ARM_MATH_BIG_ENDIAN
+
+    *__SIMD32(pDst)++ = __PKHBT(sat, sat1, 16);
+    *__SIMD32(pDst)++ = __PKHBT(sat2, sat3, 16);
+
+#else
+
+    *__SIMD32(pDst)++ = __PKHBT(sat1, sat, 16);
+    *__SIMD32(pDst)++ = __PKHBT(sat3, sat2, 16);
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+#if defined (ARM_MATH_SSE2)
+
+  /* Host build: convert 16 samples per SSE2 operation.  The eight generators run in the
+   ** lanes of two vectors and step once per 16 samples.  With the count the loop only keeps
+   ** the smallest result plus one, which wraps both full scale values to the bottom of the
+   ** range, and the samples are counted in a second pass when these were reached.  Truncation,
+   ** which cannot leave the range, has a loop of its own. */
+  {
+    __m128i vIn0, vIn1, vIn2, vIn3, vD0, vD1, vD2, vD3, vOut0, vOut1;
+    __m128i vState0, vState1, vLo, vSat;
+    const __m128i vRound = _mm_set1_epi32(0x4000);
+    const __m128i vPair = _mm_set1_epi32((q31_t) 0xFF800080);
+    const __m128i vRound16 = _mm_set1_epi16(0x80);
+    const __m128i vByte = _mm_set1_epi16(0xFF);
+    const __m128i vByte32 = _mm_set1_epi32(0xFF);
+    const __m128i vOne = _mm_set1_epi16(1);
+    const __m128i vBias = _mm_set1_epi32((q31_t) 0x80008000);
+    const __m128i vLimit = _mm_set1_epi32((q31_t) 0x8000FFFF);
+
+    vState0 = _mm_loadu_si128((__m128i *) state);
+    vState1 = _mm_loadu_si128((__m128i *) (state + 4));
+    vLo = _mm_set1_epi16(0x7FFF);
+    vSat = _mm_setzero_si128();
+
+    blkCnt = blockSize >> 4u;
+
+    if(rounding == 0u)
+    {
+      /* C = (q15_t) A >> 16, which never leaves the 16 bit range */
+      while(blkCnt > 0u)
+      {
+        vIn0 = _mm_srai_epi32(_mm_loadu_si128((__m128i *) pIn), 16);
+        vIn1 = _mm_srai_epi32(_mm_loadu_si128((__m128i *) (pIn + 4)), 16);
+        vIn2 = _mm_srai_epi32(_mm_loadu_si128((__m128i *) (pIn + 8)), 16);
+        vIn3 = _mm_srai_epi32(_mm_loadu_si128((__m128i *) (pIn + 12)), 16);
+
+        _mm_storeu_si128((__m128i *) pDst, _mm_packs_epi32(vIn0, vIn1));
+        _mm_storeu_si128((__m128i *) (pDst + 8), _mm_packs_epi32(vIn2, vIn3));
+
+        pIn += 16u;
+        pDst += 16u;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+      }
+    }
+    else
+    {
+      while(blkCnt > 0u)
+      {
+        vIn0 = _mm_loadu_si128((__m128i *) pIn);
+        vIn1 = _mm_loadu_si128((__m128i *) (pIn + 4));
+        vIn2 = _mm_loadu_si128((__m128i *) (pIn + 8));
+        vIn3 = _mm_loadu_si128((__m128i *) (pIn + 12));
+
+        if(dither != 0u)
+        {
+          /* Step the generators */
+          vState0 = _mm_xor_si128(vState0, _mm_slli_epi32(vState0, 13));
+          vState1 = _mm_xor_si128(vState1, _mm_slli_epi32(vState1, 13));
+          vState0 = _mm_xor_si128(vState0, _mm_srli_epi32(vState0, 17));
+          vState1 = _mm_xor_si128(vState1, _mm_srli_epi32(vState1, 17));
+          vState0 = _mm_xor_si128(vState0, _mm_slli_epi32(vState0, 5));
+          vState1 = _mm_xor_si128(vState1, _mm_slli_epi32(vState1, 5));
+
+          /* The upper 16 bits of the inputs take a carry of -1 to 2 from bits 8 to 15, the
+           ** dither and the rounding constant, which is computed on 16 bit lanes:
+           ** C = (q15_t) (A >> 16) + ((((A >> 8) & 0xFF) + dither + 0x80) >> 8) */
+          vD0 = _mm_add_epi16(_mm_sub_epi16(_mm_and_si128(vState0, vByte), _mm_srli_epi16(vState0, 8)), vRound16);
+          vD1 = _mm_add_epi16(_mm_sub_epi16(_mm_and_si128(vState1, vByte), _mm_srli_epi16(vState1, 8)), vRound16);
+          vD0 = _mm_srai_epi16(_mm_add_epi16(_mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(vIn0, 8), vByte32),
+                                                             _mm_and_si128(_mm_srli_epi32(vIn1, 8), vByte32)), vD0), 8);
+          vD1 = _mm_srai_epi16(_mm_add_epi16(_mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(vIn2, 8), vByte32),
+                                                             _mm_and_si128(_mm_srli_epi32(vIn3, 8), vByte32)), vD1), 8);
+          vOut0 = _mm_adds_epi16(_mm_packs_epi32(_mm_srai_epi32(vIn0, 16), _mm_srai_epi32(vIn1, 16)), vD0);
+          vOut1 = _mm_adds_epi16(_mm_packs_epi32(_mm_srai_epi32(vIn2, 16), _mm_srai_epi32(vIn3, 16)), vD1);
+        }
+        else
+        {
+          /* C = ((A >> 1) + 0x4000) >> 15, the same as (A + 0x8000) >> 16 */
+          vIn0 = _mm_srai_epi32(_mm_add_epi32(_mm_srai_epi32(vIn0, 1), vRound), 15);
+          vIn1 = _mm_srai_epi32(_mm_add_epi32(_mm_srai_epi32(vIn1, 1), vRound), 15);
+          vIn2 = _mm_srai_epi32(_mm_add_epi32(_mm_srai_epi32(vIn2, 1), vRound), 15);
+          vIn3 = _mm_srai_epi32(_mm_add_epi32(_mm_srai_epi32(vIn3, 1), vRound), 15);
+
+          /* Saturate to 16 bits */
+          vOut0 = _mm_packs_epi32(vIn0, vIn1);
+          vOut1 = _mm_packs_epi32(vIn2, vIn3);
+        }
+
+        _mm_storeu_si128((__m128i *) pDst, vOut0);
+        _mm_storeu_si128((__m128i *) (pDst + 8), vOut1);
+
+        if(counting != 0u)
+        {
+          vLo = _mm_min_epi16(vLo, _mm_min_epi16(_mm_add_epi16(vOut0, vOne), _mm_add_epi16(vOut1, vOne)));
+        }
+
+        pIn += 16u;
+        pDst += 16u;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+      }
+
+      if(_mm_movemask_epi8(_mm_cmplt_epi16(vLo, _mm_set1_epi16(-0x7FFE))) != 0)
+      {
+        /* Repeat the sums from the saved states, from the inputs shifted right by 1 bit which
+         ** leaves room for the dither scaled by 2^7 and for the rounding constant, and count
+         ** the lanes outside of the 16 bit range, the ones where A + 0x8000 exceeds 0xFFFF as
+         ** an unsigned value */
+        vState0 = _mm_loadu_si128((__m128i *) state);
+        vState1 = _mm_loadu_si128((__m128i *) (state + 4));
+        pIn = pSrc;
+        blkCnt = blockSize >> 4u;
+
+        while(blkCnt > 0u)
+        {
+          vD0 = vRound;
+          vD1 = vRound;
+          vD2 = vRound;
+          vD3 = vRound;
+
+          if(dither != 0u)
+          {
+            vState0 = _mm_xor_si128(vState0, _mm_slli_epi32(vState0, 13));
+            vState1 = _mm_xor_si128(vState1, _mm_slli_epi32(vState1, 13));
+            vState0 = _mm_xor_si128(vState0, _mm_srli_epi32(vState0, 17));
+            vState1 = _mm_xor_si128(vState1, _mm_srli_epi32(vState1, 17));
+            vState0 = _mm_xor_si128(vState0, _mm_slli_epi32(vState0, 5));
+            vState1 = _mm_xor_si128(vState1, _mm_slli_epi32(vState1, 5));
+
+            vD0 = _mm_add_epi32(vD0, _mm_madd_epi16(_mm_unpacklo_epi8(vState0, _mm_setzero_si128()), vPair));
+            vD1 = _mm_add_epi32(vD1, _mm_madd_epi16(_mm_unpackhi_epi8(vState0, _mm_setzero_si128()), vPair));
+            vD2 = _mm_add_epi32(vD2, _mm_madd_epi16(_mm_unpacklo_epi8(vState1, _mm_setzero_si128()), vPair));
+            vD3 = _mm_add_epi32(vD3, _mm_madd_epi16(_mm_unpackhi_epi8(vState1, _mm_setzero_si128()), vPair));
+          }
+
+          vIn0 = _mm_srai_epi32(_mm_add_epi32(_mm_srai_epi32(_mm_loadu_si128((__m128i *) pIn), 1), vD0), 15);
+          vIn1 = _mm_srai_epi32(_mm_add_epi32(_mm_srai_epi32(_mm_loadu_si128((__m128i *) (pIn + 4)), 1), vD1), 15);
+          vIn2 = _mm_srai_epi32(_mm_add_epi32(_mm_srai_epi32(_mm_loadu_si128((__m128i *) (pIn + 8)), 1), vD2), 15);
+          vIn3 = _mm_srai_epi32(_mm_add_epi32(_mm_srai_epi32(_mm_loadu_si128((__m128i *) (pIn + 12)), 1), vD3), 15);
+
+          vSat = _mm_sub_epi32(vSat, _mm_cmpgt_epi32(_mm_add_epi32(vIn0, vBias), vLimit));
+          vSat = _mm_sub_epi32(vSat, _mm_cmpgt_epi32(_mm_add_epi32(vIn1, vBias), vLimit));
+          vSat = _mm_sub_epi32(vSat, _mm_cmpgt_epi32(_mm_add_epi32(vIn2, vBias), vLimit));
+          vSat = _mm_sub_epi32(vSat, _mm_cmpgt_epi32(_mm_add_epi32(vIn3, vBias), vLimit));
+
+          pIn += 16u;
+
+          /* Decrement the loop counter */
+          blkCnt--;
+        }
+
+        /* Sum the counts of the lanes */
+        vSat = _mm_add_epi32(vSat, _mm_shuffle_epi32(vSat, 0x4E));
+        vSat = _mm_add_epi32(vSat, _mm_shuffle_epi32(vSat, 0xB1));
+        satCnt = (uint32_t) _mm_cvtsi128_si32(vSat);
+      }
+    }
+
+    _mm_storeu_si128((__m128i *) state, vState0);
+    _mm_storeu_si128((__m128i *) (state + 4), vState1);
+  }
+
+  /* Compute the remaining 1 to 15 samples below */
+  blkCnt = blockSize % 0x10u;
+
+#elif defined (ARM_MATH_NEON)
+
+  /* Host build: convert 16 samples per NEON operation.  The eight generators run in the
+   ** lanes of two vectors and step once per 16 samples. */
+  {
+    int32x4_t vIn0, vIn1, vIn2, vIn3, vOut0, vOut1, vOut2, vOut3, vD0, vD1, vD2, vD3;
+    int16x8_t vB0, vB1;
+    uint32x4_t vState0, vState1, vSat;
+
+    vState0 = vld1q_u32(state);
+    vState1 = vld1q_u32(state + 4);
+    vSat = vdupq_n_u32(0u);
+
+    blkCnt = blockSize >> 4u;
+
+    while(blkCnt > 0u)
+    {
+      vIn0 = vld1q_s32(pIn);
+      vIn1 = vld1q_s32(pIn + 4);
+      vIn2 = vld1q_s32(pIn + 8);
+      vIn3 = vld1q_s32(pIn + 12);
+
+      if(rounding != 0u)
+      {
+        vD0 = vdupq_n_s32(0x80);
+        vD1 = vdupq_n_s32(0x80);
+        vD2 = vdupq_n_s32(0x80);
+        vD3 = vdupq_n_s32(0x80);
+
+        if(dither != 0u)
+        {
+          /* Step the generators */
+          vState0 = veorq_u32(vState0, vshlq_n_u32(vState0, 13));
+          vState1 = veorq_u32(vState1, vshlq_n_u32(vState1, 13));
+          vState0 = veorq_u32(vState0, vshrq_n_u32(vState0, 17));
+          vState1 = veorq_u32(vState1, vshrq_n_u32(vState1, 17));
+          vState0 = veorq_u32(vState0, vshlq_n_u32(vState0, 5));
+          vState1 = veorq_u32(vState1, vshlq_n_u32(vState1, 5));
+
+          /* Subtract the bytes of the values in pairs */
+          vB0 = vsubq_s16(vreinterpretq_s16_u16(vandq_u16(vreinterpretq_u16_u32(vState0), vdupq_n_u16(0xFFu))),
+                          vreinterpretq_s16_u16(vshrq_n_u16(vreinterpretq_u16_u32(vState0), 8)));
+          vB1 = vsubq_s16(vreinterpretq_s16_u16(vandq_u16(vreinterpretq_u16_u32(vState1), vdupq_n_u16(0xFFu))),
+                          vreinterpretq_s16_u16(vshrq_n_u16(vreinterpretq_u16_u32(vState1), 8)));
+
+          /* Add the dither */
+          vD0 = vaddw_s16(vD0, vget_low_s16(vB0));
+          vD1 = vaddw_s16(vD1, vget_high_s16(vB0));
+          vD2 = vaddw_s16(vD2, vget_low_s16(vB1));
+          vD3 = vaddw_s16(vD3, vget_high_s16(vB1));
+        }
+
+        /* C = (q15_t) ((A >> 8) + dither + 0x80) >> 8, in units of 2^-8 LSB */
+        vOut0 = vshrq_n_s32(vaddq_s32(vshrq_n_s32(vIn0, 8), vD0), 8);
+        vOut1 = vshrq_n_s32(vaddq_s32(vshrq_n_s32(vIn1, 8), vD1), 8);
+        vOut2 = vshrq_n_s32(vaddq_s32(vshrq_n_s32(vIn2, 8), vD2), 8);
+        vOut3 = vshrq_n_s32(vaddq_s32(vshrq_n_s32(vIn3, 8), vD3), 8);
+
+        if(counting != 0u)
+        {
+          /* Count the lanes outside of the 16 bit range */
+          vSat = vsubq_u32(vSat, vorrq_u32(vcgtq_s32(vOut0, vdupq_n_s32(0x7FFF)), vcltq_s32(vOut0, vdupq_n_s32(-0x8000))));
+          vSat = vsubq_u32(vSat, vorrq_u32(vcgtq_s32(vOut1, vdupq_n_s32(0x7FFF)), vcltq_s32(vOut1, vdupq_n_s32(-0x8000))));
+          vSat = vsubq_u32(vSat, vorrq_u32(vcgtq_s32(vOut2, vdupq_n_s32(0x7FFF)), vcltq_s32(vOut2, vdupq_n_s32(-0x8000))));
+          vSat = vsubq_u32(vSat, vorrq_u32(vcgtq_s32(vOut3, vdupq_n_s32(0x7FFF)), vcltq_s32(vOut3, vdupq_n_s32(-0x8000))));
+        }
+      }
+      else
+      {
+        /* C = (q15_t) A >> 16 */
+        vOut0 = vshrq_n_s32(vIn0, 16);
+        vOut1 = vshrq_n_s32(vIn1, 16);
+        vOut2 = vshrq_n_s32(vIn2, 16);
+        vOut3 = vshrq_n_s32(vIn3, 16);
+      }
+
+      /* Saturate to 16 bits */
+      vst1q_s16(pDst, vcombine_s16(vqmovn_s32(vOut0), vqmovn_s32(vOut1)));
+      vst1q_s16(pDst + 8, vcombine_s16(vqmovn_s32(vOut2), vqmovn_s32(vOut3)));
+
+      pIn += 16u;
+      pDst += 16u;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Sum the counts of the lanes */
+    satCnt = vgetq_lane_u32(vSat, 0) + vgetq_lane_u32(vSat, 1) +
+      vgetq_lane_u32(vSat, 2) + vgetq_lane_u32(vSat, 3);
+
+    vst1q_u32(state, vState0);
+    vst1q_u32(state + 4, vState1);
+  }
+
+  /* Compute the remaining 1 to 15 samples below */
+  blkCnt = blockSize % 0x10u;
+
+#else
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_SSE2) */
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    in = *pIn++;
+
+    if(dither != 0u)
+    {
+      /* C = (q15_t) ((A >> 8) + dither + 0x80) >> 8, with the dither of the lower half of
+       ** a new value of the next generator, then of its upper half */
+      r = ((i & 1u) == 0u) ? arm_convert_xorshift(&state[i >> 1]) : (r >> 16);
+      i = (i + 1u) & 0xFu;
+      out = ((in >> 8) + arm_convert_tpdf(r) + 0x80) >> 8;
+    }
+    else if(rounding != 0u)
+    {
+      /* C = (q15_t) ((A >> 8) + 0x80) >> 8 */
+      out = ((in >> 8) + 0x80) >> 8;
+    }
+    else
+    {
+      /* C = (q15_t) A >> 16 */
+      out = in >> 16;
+    }
+
+    /* Saturate to 16 bits and count the saturated samples */
+    *pDst = (q15_t) __SSAT(out, 16);
+    satCnt += (uint32_t) (*pDst++ != out);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Save the generator states for the next call */
+  for (k = 0u; k < 8u; k++)
+  {
+    S->state[k] = state[k];
+  }
+
+  return ((counting != 0u) ? satCnt : 0u);
+}
+
+/**
+ * @} end of DitherConvert group
+ */
@@ -158,9 +158,87 @@ void arm_float_to_q15(
 
   /* Run the below code for Cortex-M0 */
 
+#if defined (ARM_MATH_SSE2)
+
+  /* Host build: convert 8 samples per SSE2 operation */
+  {
+    __m128 vIn0, vIn1;
+    const __m128 vScale = _mm_set1_ps(32768.0f);
+
+#ifdef ARM_MATH_ROUNDING
+    const __m128 vHalf = _mm_set1_ps(0.5f);
+    const __m128 vSign = _mm_set1_ps(-0.0f);
+#endif /*      #ifdef ARM_MATH_ROUNDING        */
+
+    blkCnt = blockSize >> 3u;
+
+    while(blkCnt > 0u)
+    {
+      /* C = A * 32768 */
+      vIn0 = _mm_mul_ps(_mm_loadu_ps(pIn), vScale);
+      vIn1 = _mm_mul_ps(_mm_loadu_ps(pIn + 4), vScale);
+
+#ifdef ARM_MATH_ROUNDING
+      /* Add +0.5 to positive and -0.5 to the other values */
+      vIn0 = _mm_add_ps(vIn0, _mm_or_ps(vHalf, _mm_and_ps(_mm_cmple_ps(vIn0, _mm_setzero_ps()), vSign)));
+      vIn1 = _mm_add_ps(vIn1, _mm_or_ps(vHalf, _mm_and_ps(_mm_cmple_ps(vIn1, _mm_setzero_ps()), vSign)));
+#endif /*      #ifdef ARM_MATH_ROUNDING        */
+
+      /* Truncate to 32 bits and saturate to 16 bits */
+      _mm_storeu_si128((__m128i *) pDst, _mm_packs_epi32(_mm_cvttps_epi32(vIn0), _mm_cvttps_epi32(vIn1)));
+
+      pIn += 8u;
+      pDst += 8u;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+
+  /* Compute the remaining 1 to 7 samples below */
+  blkCnt = blockSize % 0x8u;
+
+#elif defined (ARM_MATH_NEON)
+
+  /* Host build: convert 8 samples per NEON operation */
+  {
+    float32x4_t vIn0, vIn1;
+
+    blkCnt = blockSize >> 3u;
+
+    while(blkCnt > 0u)
+    {
+      /* C = A * 32768 */
+      vIn0 = vmulq_n_f32(vld1q_f32(pIn), 32768.0f);
+      vIn1 = vmulq_n_f32(vld1q_f32(pIn + 4), 32768.0f);
+
+#ifdef ARM_MATH_ROUNDING
+      /* Add +0.5 to positive and -0.5 to the other values */
+      vIn0 = vaddq_f32(vIn0, vbslq_f32(vcgtq_f32(vIn0, vdupq_n_f32(0.0f)), vdupq_n_f32(0.5f), vdupq_n_f32(-0.5f)));
+      vIn1 = vaddq_f32(vIn1, vbslq_f32(vcgtq_f32(vIn1, vdupq_n_f32(0.0f)), vdupq_n_f32(0.5f), vdupq_n_f32(-0.5f)));
+#endif /*      #ifdef ARM_MATH_ROUNDING        */
+
+      /* Truncate to 32 bits and saturate to 16 bits */
+      vst1q_s16(pDst, vcombine_s16(vqmovn_s32(vcvtq_s32_f32(vIn0)), vqmovn_s32(vcvtq_s32_f32(vIn1))));
+
+      pIn += 8u;
+      pDst += 8u;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+
+  /* Compute the remaining 1 to 7 samples below */
+  blkCnt = blockSize % 0x8u;
+
+#else
+
   /* Loop over blockSize number of values */
   blkCnt = blockSize;
 
+#endif /* #if defined (ARM_MATH_SSE2) */
+
   while(blkCnt > 0u)
   {
 
@@ -102,9 +102,66 @@ void arm_q15_to_float(
 
   /* Run the below code for Cortex-M0 */
 
+#if defined (ARM_MATH_SSE2)
+
+  /* Host build: convert 8 samples per SSE2 operation */
+  {
+    __m128i vIn;
+    const __m128 vScale = _mm_set1_ps(1.0f / 32768.0f);
+
+    blkCnt = blockSize >> 3u;
+
+    while(blkCnt > 0u)
+    {
+      /* Sign extend the q15 samples to 32 bits and scale by 2^-15 */
+      vIn = _mm_loadu_si128((__m128i *) pIn);
+      _mm_storeu_ps(pDst, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(vIn, vIn), 16)), vScale));
+      _mm_storeu_ps(pDst + 4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(vIn, vIn), 16)), vScale));
+
+      pIn += 8u;
+      pDst += 8u;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+
+  /* Compute the remaining 1 to 7 samples below */
+  blkCnt = blockSize % 0x8u;
+
+#elif defined (ARM_MATH_NEON)
+
+  /* Host build: convert 8 samples per NEON operation */
+  {
+    int16x8_t vIn;
+
+    blkCnt = blockSize >> 3u;
+
+    while(blkCnt > 0u)
+    {
+      /* Sign extend the q15 samples to 32 bits and scale by 2^-15 */
+      vIn = vld1q_s16(pIn);
+      vst1q_f32(pDst, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(vIn))), 1.0f / 32768.0f));
+      vst1q_f32(pDst + 4, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(vIn))), 1.0f / 32768.0f));
+
+      pIn += 8u;
+      pDst += 8u;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+
+  /* Compute the remaining 1 to 7 samples below */
+  blkCnt = blockSize % 0x8u;
+
+#else
+
   /* Loop over blockSize number of values */
   blkCnt = blockSize;
 
+#endif /* #if defined (ARM_MATH_SSE2) */
+
 #endif /* #ifndef ARM_MATH_CM0 */
 
   while(blkCnt > 0u)
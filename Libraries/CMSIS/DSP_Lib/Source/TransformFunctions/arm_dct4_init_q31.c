@@ -2186,8 +2186,12 @@ arm_status arm_dct4_init_q31(
     status = ARM_MATH_ARGUMENT_ERROR;
   }
 
-  /* Initialize the RFFT/RIFFT Function */
-  arm_rfft_init_q31(S->pRfft, S->pCfft, S->N, 0, 1);
+  /* Initialize the RFFT/RIFFT Function.   
+   * The Q31 RFFT tables stop at 512 points, so report the lengths it rejects. */
+  if(arm_rfft_init_q31(S->pRfft, S->pCfft, S->N, 0, 1) != ARM_MATH_SUCCESS)
+  {
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
 
   /* return the status of DCT4 Init function */
   return (status);
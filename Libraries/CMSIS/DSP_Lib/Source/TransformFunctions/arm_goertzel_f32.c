@@ -0,0 +1,270 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_goertzel_f32.c
+*
+* Description:	Goertzel filter bank for floating-point data.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup Goertzel Goertzel Filter Bank
+ *
+ * The Goertzel algorithm evaluates single bins of the discrete Fourier transform of
+ * a window of <code>N</code> samples with one second order resonator per bin:
+ * <pre>
+ *     s(n) = x(n) + 2 * cos(w) * s(n-1) - s(n-2)
+ *     X    = s(N-1) - exp(-j * w) * s(N-2)
+ * </pre>
+ * where <code>w = 2 * pi * f</code> is the bin frequency as a fraction <code>f</code>
+ * of the sample rate.  The frequencies need not be multiples of 1/N.  Each resonator
+ * costs one multiply-accumulate per sample, against the log2(N) butterflies per
+ * sample of an FFT, so a bank of K bins is cheaper than the FFT as long as K is
+ * below about log2(N); the benchmark shows the crossover for each data type.
+ * Typical uses are tone and DTMF detection, where a handful of known frequencies is
+ * watched on a continuous stream.
+ *
+ * \par Streaming windows
+ * The window is independent of the block size.  The resonator states are kept in
+ * the instance between calls, so a window can start anywhere in a block and span
+ * any number of blocks.  Whenever a window is complete the function writes the
+ * power <code>|X|^2</code> of every bin to the output, clears the resonators and
+ * starts the next window; it returns the number of windows completed by the call,
+ * so the output must have room for <code>numBins</code> values per window that can
+ * end in the block.  Overlapping windows are obtained with a second instance that
+ * starts half a window later.
+ *
+ * \par Bank processing
+ * The bins are processed in groups in one pass over the samples, so every sample
+ * loaded feeds several resonators whose states stay in registers: four bins per pass
+ * for floating-point data, two for Q31 and Q15 data, and one on the Cortex-M0.
+ *
+ * \par Instance Structure
+ * The bin count, the window length, the position in the window and pointers to the
+ * coefficient and state arrays are stored in an instance structure.  The init
+ * function fills the coefficient array with the cosine and the sine of each bin
+ * frequency and clears the state array, which holds the last two resonator outputs of
+ * each bin.  Use a separate instance structure for each stream.
+ *
+ * \par Fixed-Point Behavior
+ * The Q15 resonators run in 32-bit states in Q15 units and the Q31 resonators in
+ * 64-bit states in Q31 units.  Both return <code>|X|^2</code> in 34.30 format, as
+ * the power functions do, i.e. a full scale sine at a bin frequency gives
+ * <code>(N / 2)^2</code>.  A resonator output is bounded by
+ * <code>N * min(N, 1 / |sin(w)|)</code> times the largest input, which must stay
+ * below 2^16 for the Q15 function: e.g. windows of up to 1024 samples for bins
+ * above 1% of the sample rate.  The window length must be below 65536 for the Q31
+ * function.
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the floating-point Goertzel filter bank.
+ * @param[in,out] *S points to an instance of the floating-point Goertzel filter bank.
+ * @param[in]     *pSrc points to the block of input data.
+ * @param[out]    *pDst points to the bin powers, <code>numBins</code> values per completed window.
+ * @param[in]     blockSize number of samples to process.
+ * @return The function returns the number of windows completed in the block.
+ */
+
+uint32_t arm_goertzel_f32(
+  arm_goertzel_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState;                             /* State pointer */
+  float32_t *pCoeffs;                            /* Coefficient pointer */
+  float32_t *px;                                 /* Input pointer of a pass over the samples */
+  float32_t in, t;                               /* Input sample and resonator output */
+  float32_t a1, a2;                              /* Last two resonator outputs of the first bin */
+#ifndef ARM_MATH_CM0
+  float32_t b1, b2, c1, c2, d1, d2;              /* Last two resonator outputs of three more bins */
+  float32_t cb, cc, cd;                          /* Twice the cosines of three more bins */
+#endif
+  float32_t ca;                                  /* Twice the cosine of the first bin */
+  float32_t re, im;                              /* Real and imaginary parts of a bin */
+  uint32_t numSamples;                           /* Samples up to the end of the window */
+  uint32_t numWindows = 0u;                      /* Number of completed windows */
+  uint32_t binCnt, sampleCnt;                    /* loop counters */
+
+  while(blockSize > 0u)
+  {
+    /* The samples of the block that belong to the current window */
+    numSamples = (uint32_t) S->windowLength - S->count;
+
+    if(numSamples > blockSize)
+    {
+      numSamples = blockSize;
+    }
+
+    pState = S->pState;
+    pCoeffs = S->pCoeffs;
+
+#ifndef ARM_MATH_CM0
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Four bins per pass over the samples: every sample loaded feeds four
+     ** resonators whose states stay in registers for the whole pass */
+    binCnt = (uint32_t) S->numBins >> 2u;
+
+    while(binCnt > 0u)
+    {
+      a1 = pState[0];
+      a2 = pState[1];
+      b1 = pState[2];
+      b2 = pState[3];
+      c1 = pState[4];
+      c2 = pState[5];
+      d1 = pState[6];
+      d2 = pState[7];
+
+      ca = 2.0f * pCoeffs[0];
+      cb = 2.0f * pCoeffs[2];
+      cc = 2.0f * pCoeffs[4];
+      cd = 2.0f * pCoeffs[6];
+
+      px = pSrc;
+      sampleCnt = numSamples;
+
+      while(sampleCnt > 0u)
+      {
+        in = *px++;
+
+        /* s(n) = x(n) + 2 * cos(w) * s(n-1) - s(n-2) */
+        t = (in + (ca * a1)) - a2;
+        a2 = a1;
+        a1 = t;
+
+        t = (in + (cb * b1)) - b2;
+        b2 = b1;
+        b1 = t;
+
+        t = (in + (cc * c1)) - c2;
+        c2 = c1;
+        c1 = t;
+
+        t = (in + (cd * d1)) - d2;
+        d2 = d1;
+        d1 = t;
+
+        /* Decrement the loop counter */
+        sampleCnt--;
+      }
+
+      pState[0] = a1;
+      pState[1] = a2;
+      pState[2] = b1;
+      pState[3] = b2;
+      pState[4] = c1;
+      pState[5] = c2;
+      pState[6] = d1;
+      pState[7] = d2;
+
+      pState += 8u;
+      pCoeffs += 8u;
+
+      /* Decrement the loop counter */
+      binCnt--;
+    }
+
+    /* If the number of bins is not a multiple of 4, process the remaining 1 to 3 bins here */
+    binCnt = (uint32_t) S->numBins % 0x4u;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    /* One bin per pass over the samples */
+    binCnt = (uint32_t) S->numBins;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+    while(binCnt > 0u)
+    {
+      a1 = pState[0];
+      a2 = pState[1];
+      ca = 2.0f * pCoeffs[0];
+
+      px = pSrc;
+      sampleCnt = numSamples;
+
+      while(sampleCnt > 0u)
+      {
+        in = *px++;
+
+        /* s(n) = x(n) + 2 * cos(w) * s(n-1) - s(n-2) */
+        t = (in + (ca * a1)) - a2;
+        a2 = a1;
+        a1 = t;
+
+        /* Decrement the loop counter */
+        sampleCnt--;
+      }
+
+      pState[0] = a1;
+      pState[1] = a2;
+
+      pState += 2u;
+      pCoeffs += 2u;
+
+      /* Decrement the loop counter */
+      binCnt--;
+    }
+
+    pSrc += numSamples;
+    blockSize -= numSamples;
+    S->count += (uint16_t) numSamples;
+
+    /* At the end of a window, output the bin powers and restart the resonators */
+    if(S->count == S->windowLength)
+    {
+      pState = S->pState;
+      pCoeffs = S->pCoeffs;
+      binCnt = (uint32_t) S->numBins;
+
+      while(binCnt > 0u)
+      {
+        /* X = s(N-1) - exp(-jw) * s(N-2) */
+        re = pState[0] - (pCoeffs[0] * pState[1]);
+        im = pCoeffs[1] * pState[1];
+
+        *pDst++ = (re * re) + (im * im);
+
+        pState[0] = 0.0f;
+        pState[1] = 0.0f;
+
+        pState += 2u;
+        pCoeffs += 2u;
+
+        /* Decrement the loop counter */
+        binCnt--;
+      }
+
+      S->count = 0u;
+      numWindows++;
+    }
+  }
+
+  return (numWindows);
+}
+
+/**
+ * @} end of Goertzel group
+ */
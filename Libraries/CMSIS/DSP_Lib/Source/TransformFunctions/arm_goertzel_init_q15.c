@@ -0,0 +1,80 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_goertzel_init_q15.c
+*
+* Description:	Initialization function for the Q15 Goertzel filter bank.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 Goertzel filter bank.
+ * @param[out] *S points to an instance of the Q15 Goertzel filter bank.
+ * @param[in]  numBins number of frequency bins.
+ * @param[in]  windowLength number of samples per window.
+ * @param[in]  *pFreqs points to the bin frequencies as fractions of the sample rate in 1.15 format, in [0 0.5).
+ * @param[out] *pCoeffs points to an array of <code>2*numBins</code> values for the cosine and the sine of each bin.
+ * @param[in]  *pState points to an array of <code>2*numBins</code> values for the state.
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>windowLength</code> is zero.
+ */
+
+arm_status arm_goertzel_init_q15(
+  arm_goertzel_instance_q15 * S,
+  uint16_t numBins,
+  uint16_t windowLength,
+  q15_t * pFreqs,
+  q15_t * pCoeffs,
+  q31_t * pState)
+{
+  uint32_t i;                                    /* Loop counter */
+
+  if(windowLength == 0u)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Assign the bin count and the window length */
+  S->numBins = numBins;
+  S->windowLength = windowLength;
+
+  /* The first window starts with the next sample */
+  S->count = 0u;
+
+  /* The cosine and the sine of each bin frequency */
+  for (i = 0u; i < numBins; i++)
+  {
+    /* The Q31 functions are rounded to Q15, as the error of the Q15 ones would move the
+     * resonator frequencies */
+    pCoeffs[2u * i] = (q15_t) __SSAT(((arm_cos_q31((q31_t) pFreqs[i] << 16) >> 15) + 1) >> 1, 16);
+    pCoeffs[(2u * i) + 1u] = (q15_t) __SSAT(((arm_sin_q31((q31_t) pFreqs[i] << 16) >> 15) + 1) >> 1, 16);
+  }
+
+  /* Clear the resonators */
+  memset(pState, 0, (2u * (uint32_t) numBins) * sizeof(q31_t));
+
+  /* Assign the coefficient and state pointers */
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Goertzel group
+ */
@@ -0,0 +1,210 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_goertzel_q31.c
+*
+* Description:	Goertzel filter bank for Q31 data.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the Q31 Goertzel filter bank.
+ * @param[in,out] *S points to an instance of the Q31 Goertzel filter bank.
+ * @param[in]     *pSrc points to the block of input data.
+ * @param[out]    *pDst points to the bin powers in 34.30 format, <code>numBins</code> values per completed window.
+ * @param[in]     blockSize number of samples to process.
+ * @return The function returns the number of windows completed in the block.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The resonators run in 64-bit states in Q31 units; the products with the 1.31
+ * cosine keep the upper 64 bits of the 96-bit result, so the states lose their 2
+ * lowest bits per step.  The real and imaginary parts of a bin are reduced to Q15
+ * units and the power is returned in 34.30 format, the format of the Q15 function.
+ * The window length must be below 65536 so the power fits in 64 bits.
+ */
+
+uint32_t arm_goertzel_q31(
+  arm_goertzel_instance_q31 * S,
+  q31_t * pSrc,
+  q63_t * pDst,
+  uint32_t blockSize)
+{
+  q63_t *pState;                                 /* State pointer */
+  q31_t *pCoeffs;                                /* Coefficient pointer */
+  q31_t *px;                                     /* Input pointer of a pass over the samples */
+  q63_t in, t;                                   /* Input sample and resonator output */
+  q63_t a1, a2;                                  /* Last two resonator outputs of the first bin */
+#ifndef ARM_MATH_CM0
+  q63_t b1, b2;                                  /* Last two resonator outputs of the second bin */
+  q31_t cb;                                      /* Cosine of the second bin */
+#endif
+  q31_t ca;                                      /* Cosine of the first bin */
+  q63_t re, im;                                  /* Real and imaginary parts of a bin in Q15 units */
+  uint32_t numSamples;                           /* Samples up to the end of the window */
+  uint32_t numWindows = 0u;                      /* Number of completed windows */
+  uint32_t binCnt, sampleCnt;                    /* loop counters */
+
+  while(blockSize > 0u)
+  {
+    /* The samples of the block that belong to the current window */
+    numSamples = (uint32_t) S->windowLength - S->count;
+
+    if(numSamples > blockSize)
+    {
+      numSamples = blockSize;
+    }
+
+    pState = S->pState;
+    pCoeffs = S->pCoeffs;
+
+#ifndef ARM_MATH_CM0
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Two bins per pass over the samples: every sample loaded feeds two
+     ** resonators whose states stay in registers for the whole pass */
+    binCnt = (uint32_t) S->numBins >> 1u;
+
+    while(binCnt > 0u)
+    {
+      a1 = pState[0];
+      a2 = pState[1];
+      b1 = pState[2];
+      b2 = pState[3];
+
+      ca = pCoeffs[0];
+      cb = pCoeffs[2];
+
+      px = pSrc;
+      sampleCnt = numSamples;
+
+      while(sampleCnt > 0u)
+      {
+        in = (q63_t) *px++;
+
+        /* s(n) = x(n) + 2 * cos(w) * s(n-1) - s(n-2) */
+        t = (in + (mult32x64(a1, ca) * 4)) - a2;
+        a2 = a1;
+        a1 = t;
+
+        t = (in + (mult32x64(b1, cb) * 4)) - b2;
+        b2 = b1;
+        b1 = t;
+
+        /* Decrement the loop counter */
+        sampleCnt--;
+      }
+
+      pState[0] = a1;
+      pState[1] = a2;
+      pState[2] = b1;
+      pState[3] = b2;
+
+      pState += 4u;
+      pCoeffs += 4u;
+
+      /* Decrement the loop counter */
+      binCnt--;
+    }
+
+    /* If the number of bins is odd, process the last bin here */
+    binCnt = (uint32_t) S->numBins & 0x1u;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    /* One bin per pass over the samples */
+    binCnt = (uint32_t) S->numBins;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+    while(binCnt > 0u)
+    {
+      a1 = pState[0];
+      a2 = pState[1];
+      ca = pCoeffs[0];
+
+      px = pSrc;
+      sampleCnt = numSamples;
+
+      while(sampleCnt > 0u)
+      {
+        in = (q63_t) *px++;
+
+        /* s(n) = x(n) + 2 * cos(w) * s(n-1) - s(n-2) */
+        t = (in + (mult32x64(a1, ca) * 4)) - a2;
+        a2 = a1;
+        a1 = t;
+
+        /* Decrement the loop counter */
+        sampleCnt--;
+      }
+
+      pState[0] = a1;
+      pState[1] = a2;
+
+      pState += 2u;
+      pCoeffs += 2u;
+
+      /* Decrement the loop counter */
+      binCnt--;
+    }
+
+    pSrc += numSamples;
+    blockSize -= numSamples;
+    S->count += (uint16_t) numSamples;
+
+    /* At the end of a window, output the bin powers and restart the resonators */
+    if(S->count == S->windowLength)
+    {
+      pState = S->pState;
+      pCoeffs = S->pCoeffs;
+      binCnt = (uint32_t) S->numBins;
+
+      while(binCnt > 0u)
+      {
+        /* X = s(N-1) - exp(-jw) * s(N-2) */
+        re = (pState[0] - (mult32x64(pState[1], pCoeffs[0]) * 2)) >> 16;
+        im = (mult32x64(pState[1], pCoeffs[1]) * 2) >> 16;
+
+        *pDst++ = (re * re) + (im * im);
+
+        pState[0] = 0;
+        pState[1] = 0;
+
+        pState += 2u;
+        pCoeffs += 2u;
+
+        /* Decrement the loop counter */
+        binCnt--;
+      }
+
+      S->count = 0u;
+      numWindows++;
+    }
+  }
+
+  return (numWindows);
+}
+
+/**
+ * @} end of Goertzel group
+ */
@@ -31,5 +31,11 @@ extern q15_t armRecipTableQ15[64];
 extern q31_t armRecipTableQ31[64]; 
 extern const q31_t realCoefAQ31[1024];
 extern const q31_t realCoefBQ31[1024];
+extern const float32_t sinTable_f32[259];
+extern const q31_t sinTable_q31[259];
+extern const q15_t sinTable_q15[259];
+extern const q31_t log2Table_q31[257];
+extern const q31_t exp2Table_q31[257];
+extern const q31_t rsqrtTable_q31[49];
  
 #endif /*  ARM_COMMON_TABLES_H */ 
@@ -113,12 +113,28 @@
    * <b>ARM_MATH_ROUNDING:</b>
    * Define macro for rounding on support functions
    *
+   * <b>ARM_MATH_HOST:</b>
+   * Define macro to build the library for a host processor (x86 or aarch64), e.g. for offline tools and simulation.
+   * The portable Cortex-M0 code paths are used and the vector unit of the host is selected at compile time:
+   * ARM_MATH_AVX2 and ARM_MATH_SSE2 on x86 (from <code>__AVX2__</code>/<code>__SSE2__</code>) and ARM_MATH_NEON on aarch64 (from <code>__ARM_NEON</code>).
+   * The vector paths can also be forced by defining ARM_MATH_SSE2, ARM_MATH_AVX2 or ARM_MATH_NEON directly, or disabled with ARM_MATH_HOST_SCALAR.
+   * Fixed-point results are bit exact with the scalar paths; floating-point results may differ in the last bits
+   * because the vector paths accumulate in a different order.
+   *
    * <b>__FPU_PRESENT:</b>
    * Initialize macro __FPU_PRESENT = 1 when building on FPU supported Targets. Enable this macro for M4bf and M4lf libraries 
    *
    *
    * The project can be built by opening the appropriate project in MDK-ARM 4.21 chain and defining the optional pre processor MACROs detailed above.
    *
+   * <b>Benchmarking the Library</b>
+   *
+   * The <code>CMSIS\DSP_Lib\Benchmark</code> folder contains a micro-benchmark that times every library function for each data type
+   * over a sweep of block sizes and tap counts, with text, CSV or JSON output and a comparison against a saved CSV baseline.
+   * It is built for the host with <code>arm_bench_Build.sh</code>; see \ref groupBenchmark.
+   * The same folder holds an accuracy harness that measures SNR, maximum error and overflows of the normal and fast
+   * filtering and transform variants against double precision references; see \ref groupAccuracy.
+   *
    * <b>Copyright Notice</b>
    *
    * Copyright (C) 2010 ARM Limited. All rights reserved.
@@ -253,6 +269,26 @@
 
 #define __CMSIS_GENERIC              /* disable NVIC and Systick functions */
 
+#if defined (ARM_MATH_HOST)
+  /* Host builds reuse the portable Cortex-M0 code paths and add vector loops on top */
+  #ifndef ARM_MATH_CM0
+    #define ARM_MATH_CM0
+  #endif
+  #if !defined (ARM_MATH_SSE2) && !defined (ARM_MATH_NEON) && !defined (ARM_MATH_HOST_SCALAR)
+    #if defined (__AVX2__) && !defined (ARM_MATH_AVX2)
+      #define ARM_MATH_AVX2
+    #endif
+    #if defined (__SSE2__) || defined (_M_X64) || (defined (_M_IX86_FP) && (_M_IX86_FP >= 2))
+      #define ARM_MATH_SSE2
+    #elif defined (__ARM_NEON) || defined (__ARM_NEON__)
+      #define ARM_MATH_NEON
+    #endif
+  #endif
+  #if defined (ARM_MATH_AVX2) && !defined (ARM_MATH_SSE2)
+    #define ARM_MATH_SSE2
+  #endif
+#endif
+
 #if defined (ARM_MATH_CM4)
   #include "core_cm4.h"
 #elif defined (ARM_MATH_CM3)
@@ -267,6 +303,14 @@
 #undef  __CMSIS_GENERIC              /* enable NVIC and Systick functions */
 #include "string.h"
     #include "math.h"
+
+#if defined (ARM_MATH_AVX2)
+  #include <immintrin.h>
+#elif defined (ARM_MATH_SSE2)
+  #include <emmintrin.h>
+#elif defined (ARM_MATH_NEON)
+  #include <arm_neon.h>
+#endif
 #ifdef	__cplusplus
 extern "C"
 {
@@ -569,31 +613,19 @@ extern "C"
 			       uint32_t y)
   {
     int32_t posMax, negMin;
-    uint32_t i;
 
-    posMax = 1;
-    for (i = 0; i < (y - 1); i++)
-      {
-	posMax = posMax * 2;
-      }
+    /* 2^(y - 1) - 1 and -2^(y - 1), with a shift rather than a loop so that the
+     * bounds are constants when y is */
+    posMax = (int32_t) ((1u << (y - 1u)) - 1u);
+    negMin = -posMax - 1;
 
-    if(x > 0)
+    if(x > posMax)
       {
-	posMax = (posMax - 1);
-
-	if(x > posMax)
-	  {
-	    x = posMax;
-	  }
+	x = posMax;
       }
-    else
+    else if(x < negMin)
       {
-	negMin = -posMax;
-
-	if(x < negMin)
-	  {
-	    x = negMin;
-	  }
+	x = negMin;
       }
     return (x);
 
@@ -1163,6 +1195,193 @@ extern "C"
 			float32_t * pState,
 			uint32_t blockSize);
 
+  /**
+   * @brief Generated floating-point FIR kernels for fixed tap counts, called by <code>arm_fir_f32()</code>.
+   * @param[in] *S points to an instance of the floating-point FIR filter structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in] blockSize number of samples to process.
+   * @return ARM_MATH_SUCCESS if a kernel for <code>numTaps</code> and <code>blockSize</code> processed the block,
+   * ARM_MATH_ARGUMENT_ERROR if there is none.  The kernels are listed in DSP_Lib/Scripts/arm_fir_fixed.cfg.
+   */
+  arm_status arm_fir_fixed_f32(
+			       const arm_fir_instance_f32 * S,
+			       float32_t * pSrc,
+			       float32_t * pDst,
+			       uint32_t blockSize);
+
+  /**
+   * @brief Generated Q31 FIR kernels for fixed tap counts, called by <code>arm_fir_q31()</code>.
+   * @param[in] *S points to an instance of the Q31 FIR filter structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in] blockSize number of samples to process.
+   * @return ARM_MATH_SUCCESS if a kernel processed the block, ARM_MATH_ARGUMENT_ERROR if there is none.
+   */
+  arm_status arm_fir_fixed_q31(
+			       const arm_fir_instance_q31 * S,
+			       q31_t * pSrc,
+			       q31_t * pDst,
+			       uint32_t blockSize);
+
+  /**
+   * @brief Generated Q15 FIR kernels for fixed tap counts, called by <code>arm_fir_q15()</code>.
+   * @param[in] *S points to an instance of the Q15 FIR filter structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in] blockSize number of samples to process.
+   * @return ARM_MATH_SUCCESS if a kernel processed the block, ARM_MATH_ARGUMENT_ERROR if there is none.
+   */
+  arm_status arm_fir_fixed_q15(
+			       const arm_fir_instance_q15 * S,
+			       q15_t * pSrc,
+			       q15_t * pDst,
+			       uint32_t blockSize);
+
+  /**
+   * @brief Generated fast Q15 FIR kernels for fixed tap counts, called by <code>arm_fir_fast_q15()</code>.
+   * @param[in] *S points to an instance of the Q15 FIR filter structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in] blockSize number of samples to process.
+   * @return ARM_MATH_SUCCESS if a kernel processed the block, ARM_MATH_ARGUMENT_ERROR if there is none.
+   */
+  arm_status arm_fir_fixed_fast_q15(
+				    const arm_fir_instance_q15 * S,
+				    q15_t * pSrc,
+				    q15_t * pDst,
+				    uint32_t blockSize);
+
+
+  /**
+   * @brief Instance structure for the Q15 circular state FIR filter.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;         /**< number of filter coefficients in the filter. */
+    uint16_t delayLen;        /**< length of the delay line, a power of 2 greater than or equal to numTaps. */
+    uint16_t stateIndex;      /**< index in the delay line where the next input sample is written. */
+    q15_t *pState;            /**< points to the state variable array. The array is of length 2*delayLen. */
+    q15_t *pCoeffs;           /**< points to the coefficient array. The array is of length numTaps.*/
+  } arm_fir_circ_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q31 circular state FIR filter.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;         /**< number of filter coefficients in the filter. */
+    uint16_t delayLen;        /**< length of the delay line, a power of 2 greater than or equal to numTaps. */
+    uint16_t stateIndex;      /**< index in the delay line where the next input sample is written. */
+    q31_t *pState;            /**< points to the state variable array. The array is of length 2*delayLen. */
+    q31_t *pCoeffs;           /**< points to the coefficient array. The array is of length numTaps.*/
+  } arm_fir_circ_instance_q31;
+
+  /**
+   * @brief Instance structure for the floating-point circular state FIR filter.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;         /**< number of filter coefficients in the filter. */
+    uint16_t delayLen;        /**< length of the delay line, a power of 2 greater than or equal to numTaps. */
+    uint16_t stateIndex;      /**< index in the delay line where the next input sample is written. */
+    float32_t *pState;        /**< points to the state variable array. The array is of length 2*delayLen. */
+    float32_t *pCoeffs;       /**< points to the coefficient array. The array is of length numTaps.*/
+  } arm_fir_circ_instance_f32;
+
+  /**
+   * @brief Processing function for the Q15 circular state FIR filter.
+   * @param[in,out] *S points to an instance of the Q15 circular state FIR structure.
+   * @param[in]  *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in]  blockSize number of samples to process per call.
+   * @return     none.
+   */
+  void arm_fir_circ_q15(
+			arm_fir_circ_instance_q15 * S,
+			 q15_t * pSrc,
+			q15_t * pDst,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 circular state FIR filter.
+   * @param[in,out] *S points to an instance of the Q15 circular state FIR filter structure.
+   * @param[in]     numTaps  Number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs points to the filter coefficients buffer.
+   * @param[in]     *pState points to the state buffer.
+   * @param[in]     delayLen length of the delay line, a power of 2 greater than or equal to numTaps.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if
+   * <code>delayLen</code> is not a power of 2 greater than or equal to <code>numTaps</code>.
+   */
+  arm_status arm_fir_circ_init_q15(
+				 arm_fir_circ_instance_q15 * S,
+				 uint16_t numTaps,
+				 q15_t * pCoeffs,
+				 q15_t * pState,
+				 uint16_t delayLen);
+
+  /**
+   * @brief Processing function for the Q31 circular state FIR filter.
+   * @param[in,out] *S points to an instance of the Q31 circular state FIR structure.
+   * @param[in]  *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in]  blockSize number of samples to process per call.
+   * @return     none.
+   */
+  void arm_fir_circ_q31(
+			arm_fir_circ_instance_q31 * S,
+			 q31_t * pSrc,
+			q31_t * pDst,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 circular state FIR filter.
+   * @param[in,out] *S points to an instance of the Q31 circular state FIR filter structure.
+   * @param[in]     numTaps  Number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs points to the filter coefficients buffer.
+   * @param[in]     *pState points to the state buffer.
+   * @param[in]     delayLen length of the delay line, a power of 2 greater than or equal to numTaps.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if
+   * <code>delayLen</code> is not a power of 2 greater than or equal to <code>numTaps</code>.
+   */
+  arm_status arm_fir_circ_init_q31(
+				 arm_fir_circ_instance_q31 * S,
+				 uint16_t numTaps,
+				 q31_t * pCoeffs,
+				 q31_t * pState,
+				 uint16_t delayLen);
+
+  /**
+   * @brief Processing function for the floating-point circular state FIR filter.
+   * @param[in,out] *S points to an instance of the floating-point circular state FIR structure.
+   * @param[in]  *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in]  blockSize number of samples to process per call.
+   * @return     none.
+   */
+  void arm_fir_circ_f32(
+			arm_fir_circ_instance_f32 * S,
+			 float32_t * pSrc,
+			float32_t * pDst,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point circular state FIR filter.
+   * @param[in,out] *S points to an instance of the floating-point circular state FIR filter structure.
+   * @param[in]     numTaps  Number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs points to the filter coefficients buffer.
+   * @param[in]     *pState points to the state buffer.
+   * @param[in]     delayLen length of the delay line, a power of 2 greater than or equal to numTaps.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if
+   * <code>delayLen</code> is not a power of 2 greater than or equal to <code>numTaps</code>.
+   */
+  arm_status arm_fir_circ_init_f32(
+				 arm_fir_circ_instance_f32 * S,
+				 uint16_t numTaps,
+				 float32_t * pCoeffs,
+				 float32_t * pState,
+				 uint16_t delayLen);
+
 
   /**
    * @brief Instance structure for the Q15 Biquad cascade filter.
@@ -1462,6 +1681,42 @@ extern "C"
 			      const arm_matrix_instance_f32 * pSrcB,
 			      arm_matrix_instance_f32 * pDst);
 
+  /**
+   * @brief Number of columns per panel of a matrix packed by arm_mat_pack_f32().
+   */
+#define ARM_MAT_PACK_COLS 8u
+
+  /**
+   * @brief Number of values of a numRows x numCols matrix packed by arm_mat_pack_f32().
+   */
+#define ARM_MAT_PACKED_SIZE_F32(numRows, numCols) \
+  ((uint32_t) (numRows) * ((((uint32_t) (numCols) + ARM_MAT_PACK_COLS) - 1u) & ~(ARM_MAT_PACK_COLS - 1u)))
+
+  /**
+   * @brief Packs the second operand of arm_mat_mult_packed_f32().
+   * @param[in]       *pSrc points to the matrix to pack.
+   * @param[out]      *pPacked points to ARM_MAT_PACKED_SIZE_F32(numRows, numCols) values.
+   * @return none.
+   */
+
+  void arm_mat_pack_f32(
+			const arm_matrix_instance_f32 * pSrc,
+			float32_t * pPacked);
+
+  /**
+   * @brief Floating-point matrix multiplication by a packed matrix
+   * @param[in]       *pSrcA points to the first input matrix structure
+   * @param[in]       *pSrcB points to the second input matrix structure, with the data packed by arm_mat_pack_f32()
+   * @param[out]      *pDst points to output matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+
+  arm_status arm_mat_mult_packed_f32(
+				     const arm_matrix_instance_f32 * pSrcA,
+				     const arm_matrix_instance_f32 * pSrcB,
+				     arm_matrix_instance_f32 * pDst);
+
   /**
    * @brief Q15 matrix multiplication
    * @param[in]       *pSrcA points to the first input matrix structure
@@ -2428,6 +2683,144 @@ extern "C"
 		    q15_t * pState,
 		    q15_t * pInlineBuffer);
 
+  /**
+   * @brief Instance structure for the floating-point Goertzel filter bank.
+   */
+  typedef struct
+  {
+    uint16_t numBins;             /**< number of frequency bins. */
+    uint16_t windowLength;        /**< number of samples per window. */
+    uint16_t count;               /**< number of samples of the current window processed so far. */
+    float32_t *pCoeffs;           /**< points to the cosine and the sine of each bin. The array is of length 2*numBins. */
+    float32_t *pState;            /**< points to the last two resonator outputs of each bin. The array is of length 2*numBins. */
+  } arm_goertzel_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point Goertzel filter bank.
+   * @param[out] *S points to an instance of the floating-point Goertzel filter bank.
+   * @param[in]  numBins number of frequency bins.
+   * @param[in]  windowLength number of samples per window.
+   * @param[in]  *pFreqs points to the bin frequencies as fractions of the sample rate.
+   * @param[out] *pCoeffs points to an array of 2*numBins values for the cosine and the sine of each bin.
+   * @param[in]  *pState points to an array of 2*numBins values for the state.
+   * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if windowLength is zero.
+   */
+
+  arm_status arm_goertzel_init_f32(
+		   arm_goertzel_instance_f32 * S,
+		   uint16_t numBins,
+		   uint16_t windowLength,
+		   float32_t * pFreqs,
+		   float32_t * pCoeffs,
+		   float32_t * pState);
+
+  /**
+   * @brief  Processing function for the floating-point Goertzel filter bank.
+   * @param[in,out] *S points to an instance of the floating-point Goertzel filter bank.
+   * @param[in]     *pSrc points to the block of input data.
+   * @param[out]    *pDst points to the bin powers, numBins values per completed window.
+   * @param[in]     blockSize number of samples to process.
+   * @return The function returns the number of windows completed in the block.
+   */
+
+  uint32_t arm_goertzel_f32(
+		   arm_goertzel_instance_f32 * S,
+		   float32_t * pSrc,
+		   float32_t * pDst,
+		   uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the Q31 Goertzel filter bank.
+   */
+  typedef struct
+  {
+    uint16_t numBins;             /**< number of frequency bins. */
+    uint16_t windowLength;        /**< number of samples per window. */
+    uint16_t count;               /**< number of samples of the current window processed so far. */
+    q31_t *pCoeffs;               /**< points to the cosine and the sine of each bin. The array is of length 2*numBins. */
+    q63_t *pState;                /**< points to the last two resonator outputs of each bin. The array is of length 2*numBins. */
+  } arm_goertzel_instance_q31;
+
+  /**
+   * @brief  Initialization function for the Q31 Goertzel filter bank.
+   * @param[out] *S points to an instance of the Q31 Goertzel filter bank.
+   * @param[in]  numBins number of frequency bins.
+   * @param[in]  windowLength number of samples per window.
+   * @param[in]  *pFreqs points to the bin frequencies as fractions of the sample rate.
+   * @param[out] *pCoeffs points to an array of 2*numBins values for the cosine and the sine of each bin.
+   * @param[in]  *pState points to an array of 2*numBins values for the state.
+   * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if windowLength is zero.
+   */
+
+  arm_status arm_goertzel_init_q31(
+		   arm_goertzel_instance_q31 * S,
+		   uint16_t numBins,
+		   uint16_t windowLength,
+		   q31_t * pFreqs,
+		   q31_t * pCoeffs,
+		   q63_t * pState);
+
+  /**
+   * @brief  Processing function for the Q31 Goertzel filter bank.
+   * @param[in,out] *S points to an instance of the Q31 Goertzel filter bank.
+   * @param[in]     *pSrc points to the block of input data.
+   * @param[out]    *pDst points to the bin powers in 34.30 format, numBins values per completed window.
+   * @param[in]     blockSize number of samples to process.
+   * @return The function returns the number of windows completed in the block.
+   */
+
+  uint32_t arm_goertzel_q31(
+		   arm_goertzel_instance_q31 * S,
+		   q31_t * pSrc,
+		   q63_t * pDst,
+		   uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the Q15 Goertzel filter bank.
+   */
+  typedef struct
+  {
+    uint16_t numBins;             /**< number of frequency bins. */
+    uint16_t windowLength;        /**< number of samples per window. */
+    uint16_t count;               /**< number of samples of the current window processed so far. */
+    q15_t *pCoeffs;               /**< points to the cosine and the sine of each bin. The array is of length 2*numBins. */
+    q31_t *pState;                /**< points to the last two resonator outputs of each bin. The array is of length 2*numBins. */
+  } arm_goertzel_instance_q15;
+
+  /**
+   * @brief  Initialization function for the Q15 Goertzel filter bank.
+   * @param[out] *S points to an instance of the Q15 Goertzel filter bank.
+   * @param[in]  numBins number of frequency bins.
+   * @param[in]  windowLength number of samples per window.
+   * @param[in]  *pFreqs points to the bin frequencies as fractions of the sample rate.
+   * @param[out] *pCoeffs points to an array of 2*numBins values for the cosine and the sine of each bin.
+   * @param[in]  *pState points to an array of 2*numBins values for the state.
+   * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if windowLength is zero.
+   */
+
+  arm_status arm_goertzel_init_q15(
+		   arm_goertzel_instance_q15 * S,
+		   uint16_t numBins,
+		   uint16_t windowLength,
+		   q15_t * pFreqs,
+		   q15_t * pCoeffs,
+		   q31_t * pState);
+
+  /**
+   * @brief  Processing function for the Q15 Goertzel filter bank.
+   * @param[in,out] *S points to an instance of the Q15 Goertzel filter bank.
+   * @param[in]     *pSrc points to the block of input data.
+   * @param[out]    *pDst points to the bin powers in 34.30 format, numBins values per completed window.
+   * @param[in]     blockSize number of samples to process.
+   * @return The function returns the number of windows completed in the block.
+   */
+
+  uint32_t arm_goertzel_q15(
+		   arm_goertzel_instance_q15 * S,
+		   q15_t * pSrc,
+		   q63_t * pDst,
+		   uint32_t blockSize);
+
   /**
    * @brief Floating-point vector addition.
    * @param[in]       *pSrcA points to the first input vector
@@ -3360,7 +3753,7 @@ extern "C"
    */
 
   void arm_fir_decimate_fast_q31(
-				 arm_fir_decimate_instance_q31 * S,
+				 const arm_fir_decimate_instance_q31 * S,
 				  q31_t * pSrc,
 				 q31_t * pDst,
 				 uint32_t blockSize);
@@ -3533,1105 +3926,2301 @@ extern "C"
 					  uint32_t blockSize);
 
   /**
-   * @brief Instance structure for the high precision Q31 Biquad cascade filter.
+   * @brief Instance structure for the floating-point symmetric FIR filter.
    */
-
   typedef struct
   {
-    uint8_t numStages;       /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
-    q63_t *pState;           /**< points to the array of state coefficients.  The array is of length 4*numStages. */
-    q31_t *pCoeffs;          /**< points to the array of coefficients.  The array is of length 5*numStages. */
-    uint8_t postShift;       /**< additional shift, in bits, applied to each output sample. */
-
-  } arm_biquad_cas_df1_32x64_ins_q31;
-
-
-  /**
-   * @param[in]  *S        points to an instance of the high precision Q31 Biquad cascade filter structure.
-   * @param[in]  *pSrc     points to the block of input data.
-   * @param[out] *pDst     points to the block of output data
-   * @param[in]  blockSize number of samples to process.
-   * @return none.
-   */
-
-  void arm_biquad_cas_df1_32x64_q31(
-				    const arm_biquad_cas_df1_32x64_ins_q31 * S,
-				     q31_t * pSrc,
-				    q31_t * pDst,
-				    uint32_t blockSize);
-
+    uint16_t numTaps;         /**< number of filter coefficients in the filter. */
+    float32_t *pState;        /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+    float32_t *pCoeffs;       /**< points to the first half of the coefficient array, of length (numTaps+1)/2. */
+  } arm_fir_sym_instance_f32;
 
   /**
-   * @param[in,out] *S           points to an instance of the high precision Q31 Biquad cascade filter structure.
-   * @param[in]     numStages    number of 2nd order stages in the filter.
-   * @param[in]     *pCoeffs     points to the filter coefficients.
-   * @param[in]     *pState      points to the state buffer.
-   * @param[in]     postShift    shift to be applied to the output. Varies according to the coefficients format
-   * @return        none
+   * @brief Instance structure for the Q31 symmetric FIR filter.
    */
-
-  void arm_biquad_cas_df1_32x64_init_q31(
-					 arm_biquad_cas_df1_32x64_ins_q31 * S,
-					 uint8_t numStages,
-					 q31_t * pCoeffs,
-					 q63_t * pState,
-					 uint8_t postShift);
-
-
+  typedef struct
+  {
+    uint16_t numTaps;         /**< number of filter coefficients in the filter. */
+    q31_t *pState;            /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+    q31_t *pCoeffs;           /**< points to the first half of the coefficient array, of length (numTaps+1)/2. */
+  } arm_fir_sym_instance_q31;
 
   /**
-   * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter.
+   * @brief Instance structure for the Q15 symmetric FIR filter.
    */
-
   typedef struct
   {
-    uint8_t   numStages;       /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
-    float32_t *pState;         /**< points to the array of state coefficients.  The array is of length 2*numStages. */
-    float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
-  } arm_biquad_cascade_df2T_instance_f32;
-
+    uint16_t numTaps;         /**< number of filter coefficients in the filter. */
+    q15_t *pState;            /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+    q15_t *pCoeffs;           /**< points to the first half of the coefficient array, of length (numTaps+1)/2. */
+  } arm_fir_sym_instance_q15;
 
   /**
-   * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter.
-   * @param[in]  *S        points to an instance of the filter data structure.
+   * @brief Processing function for the floating-point symmetric FIR filter.
+   * @param[in]  *S        points to an instance of the floating-point symmetric FIR structure.
    * @param[in]  *pSrc     points to the block of input data.
-   * @param[out] *pDst     points to the block of output data
-   * @param[in]  blockSize number of samples to process.
-   * @return none.
+   * @param[out] *pDst     points to the block of output data.
+   * @param[in]  blockSize number of samples to process per call.
+   * @return     none.
    */
+  void arm_fir_sym_f32(
+		      const arm_fir_sym_instance_f32 * S,
+		      float32_t * pSrc,
+		      float32_t * pDst,
+		      uint32_t blockSize);
 
-  void arm_biquad_cascade_df2T_f32(
-				   const arm_biquad_cascade_df2T_instance_f32 * S,
-				    float32_t * pSrc,
-				   float32_t * pDst,
-				   uint32_t blockSize);
-
+  /**
+   * @brief  Initialization function for the floating-point symmetric FIR filter.
+   * @param[in,out] *S        points to an instance of the floating-point symmetric FIR structure.
+   * @param[in]     numTaps   number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs  points to the first (numTaps+1)/2 filter coefficients.
+   * @param[in]     *pState   points to the state buffer.
+   * @param[in]     blockSize number of samples that are processed per call.
+   * @return        none.
+   */
+  void arm_fir_sym_init_f32(
+			   arm_fir_sym_instance_f32 * S,
+			   uint16_t numTaps,
+			   float32_t * pCoeffs,
+			   float32_t * pState,
+			   uint32_t blockSize);
 
   /**
-   * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter.
-   * @param[in,out] *S           points to an instance of the filter data structure.
-   * @param[in]     numStages    number of 2nd order stages in the filter.
-   * @param[in]     *pCoeffs     points to the filter coefficients.
-   * @param[in]     *pState      points to the state buffer.
-   * @return        none
+   * @brief Processing function for the Q31 symmetric FIR filter.
+   * @param[in]  *S        points to an instance of the Q31 symmetric FIR structure.
+   * @param[in]  *pSrc     points to the block of input data.
+   * @param[out] *pDst     points to the block of output data.
+   * @param[in]  blockSize number of samples to process per call.
+   * @return     none.
    */
+  void arm_fir_sym_q31(
+		      const arm_fir_sym_instance_q31 * S,
+		      q31_t * pSrc,
+		      q31_t * pDst,
+		      uint32_t blockSize);
 
-  void arm_biquad_cascade_df2T_init_f32(
-					arm_biquad_cascade_df2T_instance_f32 * S,
-					uint8_t numStages,
-					float32_t * pCoeffs,
-					float32_t * pState);
+  /**
+   * @brief  Initialization function for the Q31 symmetric FIR filter.
+   * @param[in,out] *S        points to an instance of the Q31 symmetric FIR structure.
+   * @param[in]     numTaps   number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs  points to the first (numTaps+1)/2 filter coefficients.
+   * @param[in]     *pState   points to the state buffer.
+   * @param[in]     blockSize number of samples that are processed per call.
+   * @return        none.
+   */
+  void arm_fir_sym_init_q31(
+			   arm_fir_sym_instance_q31 * S,
+			   uint16_t numTaps,
+			   q31_t * pCoeffs,
+			   q31_t * pState,
+			   uint32_t blockSize);
 
+  /**
+   * @brief Processing function for the Q15 symmetric FIR filter.
+   * @param[in]  *S        points to an instance of the Q15 symmetric FIR structure.
+   * @param[in]  *pSrc     points to the block of input data.
+   * @param[out] *pDst     points to the block of output data.
+   * @param[in]  blockSize number of samples to process per call.
+   * @return     none.
+   */
+  void arm_fir_sym_q15(
+		      const arm_fir_sym_instance_q15 * S,
+		      q15_t * pSrc,
+		      q15_t * pDst,
+		      uint32_t blockSize);
 
+  /**
+   * @brief  Initialization function for the Q15 symmetric FIR filter.
+   * @param[in,out] *S        points to an instance of the Q15 symmetric FIR structure.
+   * @param[in]     numTaps   number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs  points to the first (numTaps+1)/2 filter coefficients.
+   * @param[in]     *pState   points to the state buffer.
+   * @param[in]     blockSize number of samples that are processed per call.
+   * @return        none.
+   */
+  void arm_fir_sym_init_q15(
+			   arm_fir_sym_instance_q15 * S,
+			   uint16_t numTaps,
+			   q15_t * pCoeffs,
+			   q15_t * pState,
+			   uint32_t blockSize);
 
   /**
-   * @brief Instance structure for the Q15 FIR lattice filter.
+   * @brief Instance structure for the floating-point half-band FIR decimator.
    */
-
   typedef struct
   {
-    uint16_t numStages;                          /**< number of filter stages. */
-    q15_t *pState;                               /**< points to the state variable array. The array is of length numStages. */
-    q15_t *pCoeffs;                              /**< points to the coefficient array. The array is of length numStages. */
-  } arm_fir_lattice_instance_q15;
+    uint16_t numTaps;         /**< number of filter coefficients in the filter, 4k+3. */
+    float32_t *pCoeffs;       /**< points to the (numTaps+5)/4 non-zero coefficients {h[0], h[2], ..., h[numTaps/2-1], h[numTaps/2]}. */
+    float32_t *pState;        /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+  } arm_fir_halfband_decimate_instance_f32;
 
   /**
-   * @brief Instance structure for the Q31 FIR lattice filter.
+   * @brief Instance structure for the Q31 half-band FIR decimator.
    */
-
   typedef struct
   {
-    uint16_t numStages;                          /**< number of filter stages. */
-    q31_t *pState;                               /**< points to the state variable array. The array is of length numStages. */
-    q31_t *pCoeffs;                              /**< points to the coefficient array. The array is of length numStages. */
-  } arm_fir_lattice_instance_q31;
+    uint16_t numTaps;         /**< number of filter coefficients in the filter, 4k+3. */
+    q31_t *pCoeffs;           /**< points to the (numTaps+5)/4 non-zero coefficients {h[0], h[2], ..., h[numTaps/2-1], h[numTaps/2]}. */
+    q31_t *pState;            /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+  } arm_fir_halfband_decimate_instance_q31;
 
   /**
-   * @brief Instance structure for the floating-point FIR lattice filter.
+   * @brief Instance structure for the Q15 half-band FIR decimator.
    */
-
   typedef struct
   {
-    uint16_t numStages;                  /**< number of filter stages. */
-    float32_t *pState;                   /**< points to the state variable array. The array is of length numStages. */
-    float32_t *pCoeffs;                  /**< points to the coefficient array. The array is of length numStages. */
-  } arm_fir_lattice_instance_f32;
+    uint16_t numTaps;         /**< number of filter coefficients in the filter, 4k+3. */
+    q15_t *pCoeffs;           /**< points to the (numTaps+5)/4 non-zero coefficients {h[0], h[2], ..., h[numTaps/2-1], h[numTaps/2]}. */
+    q15_t *pState;            /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+  } arm_fir_halfband_decimate_instance_q15;
 
   /**
-   * @brief Initialization function for the Q15 FIR lattice filter.
-   * @param[in] *S points to an instance of the Q15 FIR lattice structure.
-   * @param[in] numStages  number of filter stages.
-   * @param[in] *pCoeffs points to the coefficient buffer.  The array is of length numStages. 
-   * @param[in] *pState points to the state buffer.  The array is of length numStages. 
-   * @return none.
+   * @brief Processing function for the floating-point half-band FIR decimator.
+   * @param[in]  *S        points to an instance of the floating-point half-band FIR decimator structure.
+   * @param[in]  *pSrc     points to the block of input data.
+   * @param[out] *pDst     points to the block of output data.
+   * @param[in]  blockSize number of input samples to process per call, even.
+   * @return     none.
    */
-
-  void arm_fir_lattice_init_q15(
-				arm_fir_lattice_instance_q15 * S,
-				uint16_t numStages,
-				q15_t * pCoeffs,
-				q15_t * pState);
-
+  void arm_fir_halfband_decimate_f32(
+				  const arm_fir_halfband_decimate_instance_f32 * S,
+				  float32_t * pSrc,
+				  float32_t * pDst,
+				  uint32_t blockSize);
 
   /**
-   * @brief Processing function for the Q15 FIR lattice filter.
-   * @param[in] *S points to an instance of the Q15 FIR lattice structure.
-   * @param[in] *pSrc points to the block of input data.
-   * @param[out] *pDst points to the block of output data.
-   * @param[in] blockSize number of samples to process.
-   * @return none.
+   * @brief  Initialization function for the floating-point half-band FIR decimator.
+   * @param[in,out] *S        points to an instance of the floating-point half-band FIR decimator structure.
+   * @param[in]     numTaps   number of filter coefficients in the filter, 4k+3.
+   * @param[in]     *pCoeffs  points to the (numTaps+5)/4 non-zero filter coefficients.
+   * @param[in]     *pState   points to the state buffer.
+   * @param[in]     blockSize number of input samples to process per call, even.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if
+   * <code>numTaps</code> is not of the form 4k+3 or <code>blockSize</code> is odd.
    */
-  void arm_fir_lattice_q15(
-			   const arm_fir_lattice_instance_q15 * S,
-			    q15_t * pSrc,
-			   q15_t * pDst,
-			   uint32_t blockSize);
+  arm_status arm_fir_halfband_decimate_init_f32(
+					     arm_fir_halfband_decimate_instance_f32 * S,
+					     uint16_t numTaps,
+					     float32_t * pCoeffs,
+					     float32_t * pState,
+					     uint32_t blockSize);
 
   /**
-   * @brief Initialization function for the Q31 FIR lattice filter.
-   * @param[in] *S points to an instance of the Q31 FIR lattice structure.
-   * @param[in] numStages  number of filter stages.
-   * @param[in] *pCoeffs points to the coefficient buffer.  The array is of length numStages.
-   * @param[in] *pState points to the state buffer.   The array is of length numStages.
-   * @return none.
+   * @brief Processing function for the Q31 half-band FIR decimator.
+   * @param[in]  *S        points to an instance of the Q31 half-band FIR decimator structure.
+   * @param[in]  *pSrc     points to the block of input data.
+   * @param[out] *pDst     points to the block of output data.
+   * @param[in]  blockSize number of input samples to process per call, even.
+   * @return     none.
    */
-
-  void arm_fir_lattice_init_q31(
-				arm_fir_lattice_instance_q31 * S,
-				uint16_t numStages,
-				q31_t * pCoeffs,
-				q31_t * pState);
-
+  void arm_fir_halfband_decimate_q31(
+				  const arm_fir_halfband_decimate_instance_q31 * S,
+				  q31_t * pSrc,
+				  q31_t * pDst,
+				  uint32_t blockSize);
 
   /**
-   * @brief Processing function for the Q31 FIR lattice filter.
-   * @param[in]  *S        points to an instance of the Q31 FIR lattice structure.
-   * @param[in]  *pSrc     points to the block of input data.
-   * @param[out] *pDst     points to the block of output data
-   * @param[in]  blockSize number of samples to process.
-   * @return none.
+   * @brief  Initialization function for the Q31 half-band FIR decimator.
+   * @param[in,out] *S        points to an instance of the Q31 half-band FIR decimator structure.
+   * @param[in]     numTaps   number of filter coefficients in the filter, 4k+3.
+   * @param[in]     *pCoeffs  points to the (numTaps+5)/4 non-zero filter coefficients.
+   * @param[in]     *pState   points to the state buffer.
+   * @param[in]     blockSize number of input samples to process per call, even.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if
+   * <code>numTaps</code> is not of the form 4k+3 or <code>blockSize</code> is odd.
    */
-
-  void arm_fir_lattice_q31(
-			   const arm_fir_lattice_instance_q31 * S,
-			    q31_t * pSrc,
-			   q31_t * pDst,
-			   uint32_t blockSize);
-
-/**
- * @brief Initialization function for the floating-point FIR lattice filter.
- * @param[in] *S points to an instance of the floating-point FIR lattice structure.
- * @param[in] numStages  number of filter stages.
- * @param[in] *pCoeffs points to the coefficient buffer.  The array is of length numStages.
- * @param[in] *pState points to the state buffer.  The array is of length numStages.
- * @return none.
- */
-
-  void arm_fir_lattice_init_f32(
-				arm_fir_lattice_instance_f32 * S,
-				uint16_t numStages,
-				float32_t * pCoeffs,
-				float32_t * pState);
+  arm_status arm_fir_halfband_decimate_init_q31(
+					     arm_fir_halfband_decimate_instance_q31 * S,
+					     uint16_t numTaps,
+					     q31_t * pCoeffs,
+					     q31_t * pState,
+					     uint32_t blockSize);
 
   /**
-   * @brief Processing function for the floating-point FIR lattice filter.
-   * @param[in]  *S        points to an instance of the floating-point FIR lattice structure.
+   * @brief Processing function for the Q15 half-band FIR decimator.
+   * @param[in]  *S        points to an instance of the Q15 half-band FIR decimator structure.
    * @param[in]  *pSrc     points to the block of input data.
-   * @param[out] *pDst     points to the block of output data
-   * @param[in]  blockSize number of samples to process.
-   * @return none.
+   * @param[out] *pDst     points to the block of output data.
+   * @param[in]  blockSize number of input samples to process per call, even.
+   * @return     none.
    */
+  void arm_fir_halfband_decimate_q15(
+				  const arm_fir_halfband_decimate_instance_q15 * S,
+				  q15_t * pSrc,
+				  q15_t * pDst,
+				  uint32_t blockSize);
 
-  void arm_fir_lattice_f32(
-			   const arm_fir_lattice_instance_f32 * S,
-			    float32_t * pSrc,
-			   float32_t * pDst,
-			   uint32_t blockSize);
+  /**
+   * @brief  Initialization function for the Q15 half-band FIR decimator.
+   * @param[in,out] *S        points to an instance of the Q15 half-band FIR decimator structure.
+   * @param[in]     numTaps   number of filter coefficients in the filter, 4k+3.
+   * @param[in]     *pCoeffs  points to the (numTaps+5)/4 non-zero filter coefficients.
+   * @param[in]     *pState   points to the state buffer.
+   * @param[in]     blockSize number of input samples to process per call, even.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if
+   * <code>numTaps</code> is not of the form 4k+3 or <code>blockSize</code> is odd.
+   */
+  arm_status arm_fir_halfband_decimate_init_q15(
+					     arm_fir_halfband_decimate_instance_q15 * S,
+					     uint16_t numTaps,
+					     q15_t * pCoeffs,
+					     q15_t * pState,
+					     uint32_t blockSize);
 
   /**
-   * @brief Instance structure for the Q15 IIR lattice filter.
+   * @brief Instance structure for the floating-point half-band FIR interpolator.
    */
   typedef struct
   {
-    uint16_t numStages;                         /**< number of stages in the filter. */
-    q15_t *pState;                              /**< points to the state variable array. The array is of length numStages+blockSize. */
-    q15_t *pkCoeffs;                            /**< points to the reflection coefficient array. The array is of length numStages. */
-    q15_t *pvCoeffs;                            /**< points to the ladder coefficient array. The array is of length numStages+1. */
-  } arm_iir_lattice_instance_q15;
+    uint16_t numTaps;         /**< number of filter coefficients in the filter, 4k+3. */
+    float32_t *pCoeffs;       /**< points to the (numTaps+5)/4 non-zero coefficients {h[0], h[2], ..., h[numTaps/2-1], h[numTaps/2]}. */
+    float32_t *pState;        /**< points to the state variable array. The array is of length (numTaps-1)/2+blockSize. */
+  } arm_fir_halfband_interpolate_instance_f32;
 
   /**
-   * @brief Instance structure for the Q31 IIR lattice filter.
+   * @brief Instance structure for the Q31 half-band FIR interpolator.
    */
   typedef struct
   {
-    uint16_t numStages;                         /**< number of stages in the filter. */
-    q31_t *pState;                              /**< points to the state variable array. The array is of length numStages+blockSize. */
-    q31_t *pkCoeffs;                            /**< points to the reflection coefficient array. The array is of length numStages. */
-    q31_t *pvCoeffs;                            /**< points to the ladder coefficient array. The array is of length numStages+1. */
-  } arm_iir_lattice_instance_q31;
+    uint16_t numTaps;         /**< number of filter coefficients in the filter, 4k+3. */
+    q31_t *pCoeffs;           /**< points to the (numTaps+5)/4 non-zero coefficients {h[0], h[2], ..., h[numTaps/2-1], h[numTaps/2]}. */
+    q31_t *pState;            /**< points to the state variable array. The array is of length (numTaps-1)/2+blockSize. */
+  } arm_fir_halfband_interpolate_instance_q31;
 
   /**
-   * @brief Instance structure for the floating-point IIR lattice filter.
+   * @brief Instance structure for the Q15 half-band FIR interpolator.
    */
   typedef struct
   {
-    uint16_t numStages;                         /**< number of stages in the filter. */
-    float32_t *pState;                          /**< points to the state variable array. The array is of length numStages+blockSize. */
-    float32_t *pkCoeffs;                        /**< points to the reflection coefficient array. The array is of length numStages. */
-    float32_t *pvCoeffs;                        /**< points to the ladder coefficient array. The array is of length numStages+1. */
-  } arm_iir_lattice_instance_f32;
+    uint16_t numTaps;         /**< number of filter coefficients in the filter, 4k+3. */
+    q15_t *pCoeffs;           /**< points to the (numTaps+5)/4 non-zero coefficients {h[0], h[2], ..., h[numTaps/2-1], h[numTaps/2]}. */
+    q15_t *pState;            /**< points to the state variable array. The array is of length (numTaps-1)/2+blockSize. */
+  } arm_fir_halfband_interpolate_instance_q15;
 
   /**
-   * @brief Processing function for the floating-point IIR lattice filter.
-   * @param[in] *S points to an instance of the floating-point IIR lattice structure.
-   * @param[in] *pSrc points to the block of input data.
-   * @param[out] *pDst points to the block of output data.
-   * @param[in] blockSize number of samples to process.
-   * @return none.
+   * @brief Processing function for the floating-point half-band FIR interpolator.
+   * @param[in]  *S        points to an instance of the floating-point half-band FIR interpolator structure.
+   * @param[in]  *pSrc     points to the block of input data.
+   * @param[out] *pDst     points to the block of output data.
+   * @param[in]  blockSize number of input samples to process per call.
+   * @return     none.
    */
-
-  void arm_iir_lattice_f32(
-			   const arm_iir_lattice_instance_f32 * S,
-			    float32_t * pSrc,
-			   float32_t * pDst,
-			   uint32_t blockSize);
+  void arm_fir_halfband_interpolate_f32(
+				  const arm_fir_halfband_interpolate_instance_f32 * S,
+				  float32_t * pSrc,
+				  float32_t * pDst,
+				  uint32_t blockSize);
 
   /**
-   * @brief Initialization function for the floating-point IIR lattice filter.
-   * @param[in] *S points to an instance of the floating-point IIR lattice structure.
-   * @param[in] numStages number of stages in the filter.
-   * @param[in] *pkCoeffs points to the reflection coefficient buffer.  The array is of length numStages.
-   * @param[in] *pvCoeffs points to the ladder coefficient buffer.  The array is of length numStages+1.
-   * @param[in] *pState points to the state buffer.  The array is of length numStages+blockSize-1.
-   * @param[in] blockSize number of samples to process.
-   * @return none.
+   * @brief  Initialization function for the floating-point half-band FIR interpolator.
+   * @param[in,out] *S        points to an instance of the floating-point half-band FIR interpolator structure.
+   * @param[in]     numTaps   number of filter coefficients in the filter, 4k+3.
+   * @param[in]     *pCoeffs  points to the (numTaps+5)/4 non-zero filter coefficients.
+   * @param[in]     *pState   points to the state buffer.
+   * @param[in]     blockSize number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if
+   * <code>numTaps</code> is not of the form 4k+3.
    */
+  arm_status arm_fir_halfband_interpolate_init_f32(
+					     arm_fir_halfband_interpolate_instance_f32 * S,
+					     uint16_t numTaps,
+					     float32_t * pCoeffs,
+					     float32_t * pState,
+					     uint32_t blockSize);
 
-  void arm_iir_lattice_init_f32(
-				arm_iir_lattice_instance_f32 * S,
-				uint16_t numStages,
-				float32_t *pkCoeffs,
-				float32_t *pvCoeffs,
-				float32_t *pState,
-				uint32_t blockSize);
-
+  /**
+   * @brief Processing function for the Q31 half-band FIR interpolator.
+   * @param[in]  *S        points to an instance of the Q31 half-band FIR interpolator structure.
+   * @param[in]  *pSrc     points to the block of input data.
+   * @param[out] *pDst     points to the block of output data.
+   * @param[in]  blockSize number of input samples to process per call.
+   * @return     none.
+   */
+  void arm_fir_halfband_interpolate_q31(
+				  const arm_fir_halfband_interpolate_instance_q31 * S,
+				  q31_t * pSrc,
+				  q31_t * pDst,
+				  uint32_t blockSize);
 
   /**
-   * @brief Processing function for the Q31 IIR lattice filter.
-   * @param[in] *S points to an instance of the Q31 IIR lattice structure.
-   * @param[in] *pSrc points to the block of input data.
-   * @param[out] *pDst points to the block of output data.
-   * @param[in] blockSize number of samples to process.
-   * @return none.
+   * @brief  Initialization function for the Q31 half-band FIR interpolator.
+   * @param[in,out] *S        points to an instance of the Q31 half-band FIR interpolator structure.
+   * @param[in]     numTaps   number of filter coefficients in the filter, 4k+3.
+   * @param[in]     *pCoeffs  points to the (numTaps+5)/4 non-zero filter coefficients.
+   * @param[in]     *pState   points to the state buffer.
+   * @param[in]     blockSize number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if
+   * <code>numTaps</code> is not of the form 4k+3.
    */
+  arm_status arm_fir_halfband_interpolate_init_q31(
+					     arm_fir_halfband_interpolate_instance_q31 * S,
+					     uint16_t numTaps,
+					     q31_t * pCoeffs,
+					     q31_t * pState,
+					     uint32_t blockSize);
 
-  void arm_iir_lattice_q31(
-			   const arm_iir_lattice_instance_q31 * S,
-			    q31_t * pSrc,
-			   q31_t * pDst,
-			   uint32_t blockSize);
+  /**
+   * @brief Processing function for the Q15 half-band FIR interpolator.
+   * @param[in]  *S        points to an instance of the Q15 half-band FIR interpolator structure.
+   * @param[in]  *pSrc     points to the block of input data.
+   * @param[out] *pDst     points to the block of output data.
+   * @param[in]  blockSize number of input samples to process per call.
+   * @return     none.
+   */
+  void arm_fir_halfband_interpolate_q15(
+				  const arm_fir_halfband_interpolate_instance_q15 * S,
+				  q15_t * pSrc,
+				  q15_t * pDst,
+				  uint32_t blockSize);
 
+  /**
+   * @brief  Initialization function for the Q15 half-band FIR interpolator.
+   * @param[in,out] *S        points to an instance of the Q15 half-band FIR interpolator structure.
+   * @param[in]     numTaps   number of filter coefficients in the filter, 4k+3.
+   * @param[in]     *pCoeffs  points to the (numTaps+5)/4 non-zero filter coefficients.
+   * @param[in]     *pState   points to the state buffer.
+   * @param[in]     blockSize number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if
+   * <code>numTaps</code> is not of the form 4k+3.
+   */
+  arm_status arm_fir_halfband_interpolate_init_q15(
+					     arm_fir_halfband_interpolate_instance_q15 * S,
+					     uint16_t numTaps,
+					     q15_t * pCoeffs,
+					     q15_t * pState,
+					     uint32_t blockSize);
 
   /**
-   * @brief Initialization function for the Q31 IIR lattice filter.
-   * @param[in] *S points to an instance of the Q31 IIR lattice structure.
-   * @param[in] numStages number of stages in the filter.
-   * @param[in] *pkCoeffs points to the reflection coefficient buffer.  The array is of length numStages.
-   * @param[in] *pvCoeffs points to the ladder coefficient buffer.  The array is of length numStages+1.
-   * @param[in] *pState points to the state buffer.  The array is of length numStages+blockSize.
-   * @param[in] blockSize number of samples to process.
-   * @return none.
+   * @brief Largest number of stages of a multistage FIR decimator or interpolator.
    */
+#define ARM_FIR_MULTISTAGE_MAX_STAGES 4u
 
-  void arm_iir_lattice_init_q31(
-				arm_iir_lattice_instance_q31 * S,
-				uint16_t numStages,
-				q31_t *pkCoeffs,
-				q31_t *pvCoeffs,
-				q31_t *pState,
-				uint32_t blockSize);
+  /**
+   * @brief Plan of a multistage FIR decimator or interpolator, as chosen by arm_fir_multistage_plan_f32().
+   */
 
+  typedef struct
+  {
+    uint16_t ratio;                /**< overall decimation or interpolation factor. */
+    uint8_t interpolateFlag;       /**< 0 for a decimator, 1 for an interpolator. */
+    uint8_t numStages;             /**< number of stages, 1 to ARM_FIR_MULTISTAGE_MAX_STAGES. */
+    uint8_t factor[ARM_FIR_MULTISTAGE_MAX_STAGES];     /**< factor of each stage, in processing order. */
+    uint8_t halfBand[ARM_FIR_MULTISTAGE_MAX_STAGES];   /**< 1 for the half-band stages (factor 2). */
+    uint16_t numTaps[ARM_FIR_MULTISTAGE_MAX_STAGES];   /**< filter length of each stage. */
+    float32_t passband;            /**< passband edge as a fraction of the Nyquist frequency of the low rate. */
+    float32_t attenuation;         /**< stopband attenuation in dB. */
+    float32_t macsPerOutput;       /**< multiplications per output sample of the chain. */
+    float32_t singleStageMacsPerOutput;        /**< the same for a single stage arm_fir_decimate_f32() or arm_fir_interpolate_f32(). */
+    uint16_t singleStageNumTaps;   /**< filter length of that single stage. */
+  } arm_fir_multistage_plan_instance_f32;
 
   /**
-   * @brief Processing function for the Q15 IIR lattice filter.
-   * @param[in] *S points to an instance of the Q15 IIR lattice structure.
-   * @param[in] *pSrc points to the block of input data.
-   * @param[out] *pDst points to the block of output data.
-   * @param[in] blockSize number of samples to process.
-   * @return none.
+   * @brief One stage of a floating-point multistage FIR decimator or interpolator.
    */
 
-  void arm_iir_lattice_q15(
-			   const arm_iir_lattice_instance_q15 * S,
-			    q15_t * pSrc,
-			   q15_t * pDst,
-			   uint32_t blockSize);
+  typedef struct
+  {
+    uint8_t factor;                /**< decimation or interpolation factor of the stage. */
+    uint8_t halfBand;              /**< 1 if the filter is a half-band filter. */
+    uint16_t numTaps;              /**< number of filter coefficients. */
+    float32_t *pCoeffs;            /**< points to the coefficient array, in the arena, in the order of the half-band functions for a half-band filter. */
+    float32_t *pState;             /**< points to the state array, in the arena. */
+  } arm_fir_multistage_stage_f32;
 
+  /**
+   * @brief Instance structure for the floating-point multistage FIR decimator or interpolator.
+   */
 
-/**
- * @brief Initialization function for the Q15 IIR lattice filter.
- * @param[in] *S points to an instance of the fixed-point Q15 IIR lattice structure.
- * @param[in] numStages  number of stages in the filter.
- * @param[in] *pkCoeffs points to reflection coefficient buffer.  The array is of length numStages.
- * @param[in] *pvCoeffs points to ladder coefficient buffer.  The array is of length numStages+1.
- * @param[in] *pState points to state buffer.  The array is of length numStages+blockSize.
- * @param[in] blockSize number of samples to process per call.
- * @return none.
- */
+  typedef struct
+  {
+    uint8_t interpolateFlag;       /**< 0 for a decimator, 1 for an interpolator. */
+    uint8_t numStages;             /**< number of stages. */
+    uint16_t ratio;                /**< overall decimation or interpolation factor. */
+    uint32_t blockSize;            /**< largest number of input samples per call. */
+    arm_fir_multistage_stage_f32 stage[ARM_FIR_MULTISTAGE_MAX_STAGES];        /**< the stages, in processing order. */
+    float32_t *pScratchA;          /**< buffer between stages 1 and 2 and between stages 3 and 4. */
+    float32_t *pScratchB;          /**< buffer between stages 2 and 3. */
+  } arm_fir_multistage_instance_f32;
+
+  /**
+   * @brief  Chooses the stages of a multistage FIR decimator or interpolator.
+   * @param[out] *P              points to the plan.
+   * @param[in]  ratio           overall decimation or interpolation factor.
+   * @param[in]  interpolateFlag 0 for a decimator, 1 for an interpolator.
+   * @param[in]  passband        passband edge as a fraction of the Nyquist frequency of the low rate, in (0, 1).
+   * @param[in]  attenuation     stopband attenuation in dB.
+   * @param[in]  maxStages       largest number of stages to consider, 1 to ARM_FIR_MULTISTAGE_MAX_STAGES.
+   * @return     ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if no chain meets the specification.
+   */
+
+  arm_status arm_fir_multistage_plan_f32(
+					 arm_fir_multistage_plan_instance_f32 * P,
+					 uint16_t ratio,
+					 uint8_t interpolateFlag,
+					 float32_t passband,
+					 float32_t attenuation,
+					 uint8_t maxStages);
+
+  /**
+   * @brief  Number of float32_t values of the arena of a multistage FIR decimator or interpolator.
+   * @param[in] *P        points to the plan.
+   * @param[in] blockSize largest number of input samples per call.
+   * @return    arena length.
+   */
+
+  uint32_t arm_fir_multistage_arena_size_f32(
+					     const arm_fir_multistage_plan_instance_f32 * P,
+					     uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point multistage FIR decimator or interpolator.
+   * @param[in,out] *S        points to an instance of the multistage structure.
+   * @param[in]     *P        points to the plan.
+   * @param[in]     blockSize largest number of input samples per call.
+   * @param[in]     *pArena   points to the arena that holds the coefficients, states and buffers of all stages.
+   * @param[in]     arenaSize number of float32_t values in the arena.
+   * @return        ARM_MATH_SUCCESS, ARM_MATH_LENGTH_ERROR if the arena is too small or
+   * ARM_MATH_ARGUMENT_ERROR if the block size of a decimator is not a multiple of the ratio.
+   */
+
+  arm_status arm_fir_multistage_init_f32(
+					 arm_fir_multistage_instance_f32 * S,
+					 const arm_fir_multistage_plan_instance_f32 * P,
+					 uint32_t blockSize,
+					 float32_t * pArena,
+					 uint32_t arenaSize);
+
+  /**
+   * @brief Processing function for the floating-point multistage FIR decimator or interpolator.
+   * @param[in]  *S        points to an instance of the multistage structure.
+   * @param[in]  *pSrc     points to the block of input data.
+   * @param[out] *pDst     points to the block of output data.
+   * @param[in]  blockSize number of input samples to process per call.
+   * @return none.
+   */
 
-  void arm_iir_lattice_init_q15(
-				arm_iir_lattice_instance_q15 * S,
-				uint16_t numStages,
-				q15_t *pkCoeffs,
-				q15_t *pvCoeffs,
-				q15_t *pState,
-				uint32_t blockSize);
+  void arm_fir_multistage_f32(
+			      const arm_fir_multistage_instance_f32 * S,
+			      float32_t * pSrc,
+			      float32_t * pDst,
+			      uint32_t blockSize);
 
   /**
-   * @brief Instance structure for the floating-point LMS filter.
+   * @brief Instance structure for the high precision Q31 Biquad cascade filter.
    */
 
   typedef struct
   {
-    uint16_t numTaps;    /**< number of coefficients in the filter. */
-    float32_t *pState;   /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
-    float32_t *pCoeffs;  /**< points to the coefficient array. The array is of length numTaps. */
-    float32_t mu;        /**< step size that controls filter coefficient updates. */
-  } arm_lms_instance_f32;
-
-  /**
-   * @brief Processing function for floating-point LMS filter.
-   * @param[in]  *S points to an instance of the floating-point LMS filter structure.
-   * @param[in]  *pSrc points to the block of input data.
-   * @param[in]  *pRef points to the block of reference data.
-   * @param[out] *pOut points to the block of output data.
-   * @param[out] *pErr points to the block of error data.
+    uint8_t numStages;       /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    q63_t *pState;           /**< points to the array of state coefficients.  The array is of length 4*numStages. */
+    q31_t *pCoeffs;          /**< points to the array of coefficients.  The array is of length 5*numStages. */
+    uint8_t postShift;       /**< additional shift, in bits, applied to each output sample. */
+
+  } arm_biquad_cas_df1_32x64_ins_q31;
+
+
+  /**
+   * @param[in]  *S        points to an instance of the high precision Q31 Biquad cascade filter structure.
+   * @param[in]  *pSrc     points to the block of input data.
+   * @param[out] *pDst     points to the block of output data
    * @param[in]  blockSize number of samples to process.
-   * @return     none.
+   * @return none.
    */
 
-  void arm_lms_f32(
-		   const arm_lms_instance_f32 * S,
-		    float32_t * pSrc,
-		    float32_t * pRef,
-		   float32_t * pOut,
-		   float32_t * pErr,
-		   uint32_t blockSize);
+  void arm_biquad_cas_df1_32x64_q31(
+				    const arm_biquad_cas_df1_32x64_ins_q31 * S,
+				     q31_t * pSrc,
+				    q31_t * pDst,
+				    uint32_t blockSize);
+
 
   /**
-   * @brief Initialization function for floating-point LMS filter.
-   * @param[in] *S points to an instance of the floating-point LMS filter structure.
-   * @param[in] numTaps  number of filter coefficients.
-   * @param[in] *pCoeffs points to the coefficient buffer.
-   * @param[in] *pState points to state buffer.
-   * @param[in] mu step size that controls filter coefficient updates.
-   * @param[in] blockSize number of samples to process.
-   * @return none.
+   * @param[in,out] *S           points to an instance of the high precision Q31 Biquad cascade filter structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     *pCoeffs     points to the filter coefficients.
+   * @param[in]     *pState      points to the state buffer.
+   * @param[in]     postShift    shift to be applied to the output. Varies according to the coefficients format
+   * @return        none
    */
 
-  void arm_lms_init_f32(
-			arm_lms_instance_f32 * S,
-			uint16_t numTaps,
-			float32_t * pCoeffs,
-			float32_t * pState,
-			float32_t mu,
-			uint32_t blockSize);
+  void arm_biquad_cas_df1_32x64_init_q31(
+					 arm_biquad_cas_df1_32x64_ins_q31 * S,
+					 uint8_t numStages,
+					 q31_t * pCoeffs,
+					 q63_t * pState,
+					 uint8_t postShift);
+
 
   /**
-   * @brief Instance structure for the Q15 LMS filter.
+   * @brief Instance structure for the Q31 Biquad cascade filter with error feedback.
    */
 
   typedef struct
   {
-    uint16_t numTaps;    /**< number of coefficients in the filter. */
-    q15_t *pState;       /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
-    q15_t *pCoeffs;      /**< points to the coefficient array. The array is of length numTaps. */
-    q15_t mu;            /**< step size that controls filter coefficient updates. */
-    uint32_t postShift;  /**< bit shift applied to coefficients. */
-  } arm_lms_instance_q15;
+    uint8_t numStages;       /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    q31_t *pState;           /**< points to the array of state coefficients.  The array is of length 6*numStages. */
+    q31_t *pCoeffs;          /**< points to the array of coefficients.  The array is of length 5*numStages. */
+    uint8_t postShift;       /**< additional shift, in bits, applied to each output sample. */
+    uint8_t efOrder;         /**< order of the error feedback, 0, 1 or 2. */
 
+  } arm_biquad_cas_df1_ef_ins_q31;
 
   /**
-   * @brief Initialization function for the Q15 LMS filter.
-   * @param[in] *S points to an instance of the Q15 LMS filter structure.
-   * @param[in] numTaps  number of filter coefficients.
-   * @param[in] *pCoeffs points to the coefficient buffer.
-   * @param[in] *pState points to the state buffer.
-   * @param[in] mu step size that controls filter coefficient updates.
-   * @param[in] blockSize number of samples to process.
-   * @param[in] postShift bit shift applied to coefficients.
-   * @return    none.
+   * @brief Instance structure for the Q15 Biquad cascade filter with error feedback.
    */
 
-  void arm_lms_init_q15(
-			arm_lms_instance_q15 * S,
-			uint16_t numTaps,
-			q15_t * pCoeffs,
-			q15_t * pState,
-			q15_t mu,
-			uint32_t blockSize,
-			uint32_t postShift);
+  typedef struct
+  {
+    int8_t numStages;        /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    q15_t *pState;           /**< points to the array of state coefficients.  The array is of length 6*numStages. */
+    q15_t *pCoeffs;          /**< points to the array of coefficients.  The array is of length 6*numStages. */
+    int8_t postShift;        /**< additional shift, in bits, applied to each output sample. */
+    uint8_t efOrder;         /**< order of the error feedback, 0, 1 or 2. */
+
+  } arm_biquad_cas_df1_ef_ins_q15;
+
 
   /**
-   * @brief Processing function for Q15 LMS filter.
-   * @param[in] *S points to an instance of the Q15 LMS filter structure.
-   * @param[in] *pSrc points to the block of input data.
-   * @param[in] *pRef points to the block of reference data.
-   * @param[out] *pOut points to the block of output data.
-   * @param[out] *pErr points to the block of error data.
-   * @param[in] blockSize number of samples to process.
+   * @param[in]  *S        points to an instance of the Q31 Biquad cascade filter with error feedback.
+   * @param[in]  *pSrc     points to the block of input data.
+   * @param[out] *pDst     points to the block of output data
+   * @param[in]  blockSize number of samples to process.
    * @return none.
    */
 
-  void arm_lms_q15(
-		   const arm_lms_instance_q15 * S,
-		    q15_t * pSrc,
-		    q15_t * pRef,
-		   q15_t * pOut,
-		   q15_t * pErr,
-		   uint32_t blockSize);
+  void arm_biquad_cas_df1_ef_q31(
+				 const arm_biquad_cas_df1_ef_ins_q31 * S,
+				 q31_t * pSrc,
+				 q31_t * pDst,
+				 uint32_t blockSize);
 
 
   /**
-   * @brief Instance structure for the Q31 LMS filter.
+   * @param[in,out] *S           points to an instance of the Q31 Biquad cascade filter with error feedback.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     *pCoeffs     points to the filter coefficients.
+   * @param[in]     *pState      points to the state buffer.
+   * @param[in]     postShift    shift to be applied to the output. Varies according to the coefficients format
+   * @param[in]     efOrder      order of the error feedback: 0 (none), 1 or 2.
+   * @return        none
    */
 
-  typedef struct
-  {
-    uint16_t numTaps;    /**< number of coefficients in the filter. */
-    q31_t *pState;       /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
-    q31_t *pCoeffs;      /**< points to the coefficient array. The array is of length numTaps. */
-    q31_t mu;            /**< step size that controls filter coefficient updates. */
-    uint32_t postShift;  /**< bit shift applied to coefficients. */
+  void arm_biquad_cas_df1_ef_init_q31(
+				      arm_biquad_cas_df1_ef_ins_q31 * S,
+				      uint8_t numStages,
+				      q31_t * pCoeffs,
+				      q31_t * pState,
+				      uint8_t postShift,
+				      uint8_t efOrder);
 
-  } arm_lms_instance_q31;
 
   /**
-   * @brief Processing function for Q31 LMS filter.
-   * @param[in]  *S points to an instance of the Q15 LMS filter structure.
-   * @param[in]  *pSrc points to the block of input data.
-   * @param[in]  *pRef points to the block of reference data.
-   * @param[out] *pOut points to the block of output data.
-   * @param[out] *pErr points to the block of error data.
+   * @param[in]  *S        points to an instance of the Q15 Biquad cascade filter with error feedback.
+   * @param[in]  *pSrc     points to the block of input data.
+   * @param[out] *pDst     points to the block of output data
    * @param[in]  blockSize number of samples to process.
-   * @return     none.
+   * @return none.
    */
 
-  void arm_lms_q31(
-		   const arm_lms_instance_q31 * S,
-		    q31_t * pSrc,
-		    q31_t * pRef,
-		   q31_t * pOut,
-		   q31_t * pErr,
-		   uint32_t blockSize);
+  void arm_biquad_cas_df1_ef_q15(
+				 const arm_biquad_cas_df1_ef_ins_q15 * S,
+				 q15_t * pSrc,
+				 q15_t * pDst,
+				 uint32_t blockSize);
+
 
   /**
-   * @brief Initialization function for Q31 LMS filter.
-   * @param[in] *S points to an instance of the Q31 LMS filter structure.
-   * @param[in] numTaps  number of filter coefficients.
-   * @param[in] *pCoeffs points to coefficient buffer.
-   * @param[in] *pState points to state buffer.
-   * @param[in] mu step size that controls filter coefficient updates.
-   * @param[in] blockSize number of samples to process.
-   * @param[in] postShift bit shift applied to coefficients.
-   * @return none.
+   * @param[in,out] *S           points to an instance of the Q15 Biquad cascade filter with error feedback.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     *pCoeffs     points to the filter coefficients.
+   * @param[in]     *pState      points to the state buffer.
+   * @param[in]     postShift    shift to be applied to the output. Varies according to the coefficients format
+   * @param[in]     efOrder      order of the error feedback: 0 (none), 1 or 2.
+   * @return        none
    */
 
-  void arm_lms_init_q31(
-			arm_lms_instance_q31 * S,
-			uint16_t numTaps,
-			q31_t *pCoeffs,
-			q31_t *pState,
-			q31_t mu,
-			uint32_t blockSize,
-			uint32_t postShift);
+  void arm_biquad_cas_df1_ef_init_q15(
+				      arm_biquad_cas_df1_ef_ins_q15 * S,
+				      uint8_t numStages,
+				      q15_t * pCoeffs,
+				      q15_t * pState,
+				      int8_t postShift,
+				      uint8_t efOrder);
+
+
 
   /**
-   * @brief Instance structure for the floating-point normalized LMS filter.
+   * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter.
    */
 
   typedef struct
   {
-    uint16_t  numTaps;    /**< number of coefficients in the filter. */
-    float32_t *pState;    /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
-    float32_t *pCoeffs;   /**< points to the coefficient array. The array is of length numTaps. */
-    float32_t mu;        /**< step size that control filter coefficient updates. */
-    float32_t energy;    /**< saves previous frame energy. */
-    float32_t x0;        /**< saves previous input sample. */
-  } arm_lms_norm_instance_f32;
+    uint8_t   numStages;       /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    float32_t *pState;         /**< points to the array of state coefficients.  The array is of length 2*numStages. */
+    float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
+  } arm_biquad_cascade_df2T_instance_f32;
+
 
   /**
-   * @brief Processing function for floating-point normalized LMS filter.
-   * @param[in] *S points to an instance of the floating-point normalized LMS filter structure.
-   * @param[in] *pSrc points to the block of input data.
-   * @param[in] *pRef points to the block of reference data.
-   * @param[out] *pOut points to the block of output data.
-   * @param[out] *pErr points to the block of error data.
-   * @param[in] blockSize number of samples to process.
+   * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter.
+   * @param[in]  *S        points to an instance of the filter data structure.
+   * @param[in]  *pSrc     points to the block of input data.
+   * @param[out] *pDst     points to the block of output data
+   * @param[in]  blockSize number of samples to process.
    * @return none.
    */
 
-  void arm_lms_norm_f32(
-			arm_lms_norm_instance_f32 * S,
-			 float32_t * pSrc,
-			 float32_t * pRef,
-			float32_t * pOut,
-			float32_t * pErr,
-			uint32_t blockSize);
+  void arm_biquad_cascade_df2T_f32(
+				   const arm_biquad_cascade_df2T_instance_f32 * S,
+				    float32_t * pSrc,
+				   float32_t * pDst,
+				   uint32_t blockSize);
+
 
   /**
-   * @brief Initialization function for floating-point normalized LMS filter.
-   * @param[in] *S points to an instance of the floating-point LMS filter structure.
-   * @param[in] numTaps  number of filter coefficients.
-   * @param[in] *pCoeffs points to coefficient buffer.
-   * @param[in] *pState points to state buffer.
-   * @param[in] mu step size that controls filter coefficient updates.
-   * @param[in] blockSize number of samples to process.
-   * @return none.
+   * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter.
+   * @param[in,out] *S           points to an instance of the filter data structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     *pCoeffs     points to the filter coefficients.
+   * @param[in]     *pState      points to the state buffer.
+   * @return        none
    */
 
-  void arm_lms_norm_init_f32(
-			     arm_lms_norm_instance_f32 * S,
-			     uint16_t numTaps,
-			     float32_t * pCoeffs,
-			     float32_t * pState,
-			     float32_t mu,
-			     uint32_t blockSize);
-
+  void arm_biquad_cascade_df2T_init_f32(
+					arm_biquad_cascade_df2T_instance_f32 * S,
+					uint8_t numStages,
+					float32_t * pCoeffs,
+					float32_t * pState);
 
   /**
-   * @brief Instance structure for the Q31 normalized LMS filter.
+   * @brief Instance structure for the Q31 transposed direct form II Biquad cascade filter.
    */
+
   typedef struct
   {
-    uint16_t numTaps;     /**< number of coefficients in the filter. */
-    q31_t *pState;        /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
-    q31_t *pCoeffs;       /**< points to the coefficient array. The array is of length numTaps. */
-    q31_t mu;             /**< step size that controls filter coefficient updates. */
-    uint8_t postShift;    /**< bit shift applied to coefficients. */
-    q31_t *recipTable;    /**< points to the reciprocal initial value table. */
-    q31_t energy;         /**< saves previous frame energy. */
-    q31_t x0;             /**< saves previous input sample. */
-  } arm_lms_norm_instance_q31;
+    uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    q31_t *pState;             /**< points to the array of state variables.  The array is of length 2*numStages. */
+    q31_t *pCoeffs;            /**< points to the array of coefficients.  The array is of length 5*numStages. */
+    uint8_t postShift;         /**< additional shift, in bits, applied to each output sample and state variable. */
+  } arm_biquad_cascade_df2T_instance_q31;
 
   /**
-   * @brief Processing function for Q31 normalized LMS filter.
-   * @param[in] *S points to an instance of the Q31 normalized LMS filter structure.
-   * @param[in] *pSrc points to the block of input data.
-   * @param[in] *pRef points to the block of reference data.
-   * @param[out] *pOut points to the block of output data.
-   * @param[out] *pErr points to the block of error data.
-   * @param[in] blockSize number of samples to process.
-   * @return none.
+   * @brief Instance structure for the Q15 transposed direct form II Biquad cascade filter.
    */
 
-  void arm_lms_norm_q31(
-			arm_lms_norm_instance_q31 * S,
-			 q31_t * pSrc,
-			 q31_t * pRef,
-			q31_t * pOut,
-			q31_t * pErr,
-			uint32_t blockSize);
-
-  /**
-   * @brief Initialization function for Q31 normalized LMS filter.
-   * @param[in] *S points to an instance of the Q31 normalized LMS filter structure.
-   * @param[in] numTaps  number of filter coefficients.
-   * @param[in] *pCoeffs points to coefficient buffer.
-   * @param[in] *pState points to state buffer.
-   * @param[in] mu step size that controls filter coefficient updates.
-   * @param[in] blockSize number of samples to process.
-   * @param[in] postShift bit shift applied to coefficients.
-   * @return none.
-   */
-
-  void arm_lms_norm_init_q31(
-			     arm_lms_norm_instance_q31 * S,
-			     uint16_t numTaps,
-			     q31_t * pCoeffs,
-			     q31_t * pState,
-			     q31_t mu,
-			     uint32_t blockSize,
-			     uint8_t postShift);
+  typedef struct
+  {
+    int8_t numStages;          /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    q31_t *pState;             /**< points to the array of state variables, in 2.30 format.  The array is of length 2*numStages. */
+    q15_t *pCoeffs;            /**< points to the array of coefficients.  The array is of length 6*numStages. */
+    int8_t postShift;          /**< additional shift, in bits, applied to each output sample. */
+  } arm_biquad_cascade_df2T_instance_q15;
 
   /**
-   * @brief Instance structure for the Q15 normalized LMS filter.
+   * @brief Instance structure for the floating-point stereo transposed direct form II Biquad cascade filter.
    */
 
   typedef struct
   {
-    uint16_t numTaps;    /**< Number of coefficients in the filter. */
-    q15_t *pState;        /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
-    q15_t *pCoeffs;       /**< points to the coefficient array. The array is of length numTaps. */
-    q15_t mu;            /**< step size that controls filter coefficient updates. */
-    uint8_t postShift;   /**< bit shift applied to coefficients. */
-    q15_t *recipTable;   /**< Points to the reciprocal initial value table. */
-    q15_t energy;        /**< saves previous frame energy. */
-    q15_t x0;            /**< saves previous input sample. */
-  } arm_lms_norm_instance_q15;
+    uint8_t   numStages;       /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    float32_t *pState;         /**< points to the array of state variables.  The array is of length 4*numStages. */
+    float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
+  } arm_biquad_cascade_stereo_df2T_instance_f32;
 
   /**
-   * @brief Processing function for Q15 normalized LMS filter.
-   * @param[in] *S points to an instance of the Q15 normalized LMS filter structure.
-   * @param[in] *pSrc points to the block of input data.
-   * @param[in] *pRef points to the block of reference data.
-   * @param[out] *pOut points to the block of output data.
-   * @param[out] *pErr points to the block of error data.
-   * @param[in] blockSize number of samples to process.
+   * @brief Processing function for the Q31 transposed direct form II Biquad cascade filter.
+   * @param[in]  *S        points to an instance of the filter data structure.
+   * @param[in]  *pSrc     points to the block of input data.
+   * @param[out] *pDst     points to the block of output data
+   * @param[in]  blockSize number of samples to process.
    * @return none.
    */
 
-  void arm_lms_norm_q15(
-			arm_lms_norm_instance_q15 * S,
-			 q15_t * pSrc,
-			 q15_t * pRef,
-			q15_t * pOut,
-			q15_t * pErr,
-			uint32_t blockSize);
-
+  void arm_biquad_cascade_df2T_q31(
+				   const arm_biquad_cascade_df2T_instance_q31 * S,
+				   q31_t * pSrc,
+				   q31_t * pDst,
+				   uint32_t blockSize);
 
   /**
-   * @brief Initialization function for Q15 normalized LMS filter.
-   * @param[in] *S points to an instance of the Q15 normalized LMS filter structure.
-   * @param[in] numTaps  number of filter coefficients.
-   * @param[in] *pCoeffs points to coefficient buffer.
-   * @param[in] *pState points to state buffer.
-   * @param[in] mu step size that controls filter coefficient updates.
-   * @param[in] blockSize number of samples to process.
-   * @param[in] postShift bit shift applied to coefficients.
-   * @return none.
+   * @brief  Initialization function for the Q31 transposed direct form II Biquad cascade filter.
+   * @param[in,out] *S           points to an instance of the filter data structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     *pCoeffs     points to the filter coefficients.
+   * @param[in]     *pState      points to the state buffer.
+   * @param[in]     postShift    shift to be applied to the output and state variables.  Varies according to the coefficients format.
+   * @return        none
    */
 
-  void arm_lms_norm_init_q15(
-			     arm_lms_norm_instance_q15 * S,
-			     uint16_t numTaps,
-			     q15_t * pCoeffs,
-			     q15_t * pState,
-			     q15_t mu,
-			     uint32_t blockSize,
-			     uint8_t postShift);
+  void arm_biquad_cascade_df2T_init_q31(
+					arm_biquad_cascade_df2T_instance_q31 * S,
+					uint8_t numStages,
+					q31_t * pCoeffs,
+					q31_t * pState,
+					int8_t postShift);
 
   /**
-   * @brief Correlation of floating-point sequences.
-   * @param[in] *pSrcA points to the first input sequence.
-   * @param[in] srcALen length of the first input sequence.
-   * @param[in] *pSrcB points to the second input sequence.
-   * @param[in] srcBLen length of the second input sequence.
-   * @param[out] *pDst points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @brief Processing function for the Q15 transposed direct form II Biquad cascade filter.
+   * @param[in]  *S        points to an instance of the filter data structure.
+   * @param[in]  *pSrc     points to the block of input data.
+   * @param[out] *pDst     points to the block of output data
+   * @param[in]  blockSize number of samples to process.
    * @return none.
    */
 
-  void arm_correlate_f32(
-			  float32_t * pSrcA,
-			 uint32_t srcALen,
-			  float32_t * pSrcB,
-			 uint32_t srcBLen,
-			 float32_t * pDst);
+  void arm_biquad_cascade_df2T_q15(
+				   const arm_biquad_cascade_df2T_instance_q15 * S,
+				   q15_t * pSrc,
+				   q15_t * pDst,
+				   uint32_t blockSize);
 
   /**
-   * @brief Correlation of Q15 sequences.
-   * @param[in] *pSrcA points to the first input sequence.
-   * @param[in] srcALen length of the first input sequence.
-   * @param[in] *pSrcB points to the second input sequence.
-   * @param[in] srcBLen length of the second input sequence.
-   * @param[out] *pDst points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
-   * @return none.
+   * @brief  Initialization function for the Q15 transposed direct form II Biquad cascade filter.
+   * @param[in,out] *S           points to an instance of the filter data structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     *pCoeffs     points to the filter coefficients.
+   * @param[in]     *pState      points to the state buffer.
+   * @param[in]     postShift    shift to be applied to the output.  Varies according to the coefficients format.
+   * @return        none
    */
 
-  void arm_correlate_q15(
-			  q15_t * pSrcA,
-			 uint32_t srcALen,
-			  q15_t * pSrcB,
-			 uint32_t srcBLen,
-			 q15_t * pDst);
+  void arm_biquad_cascade_df2T_init_q15(
+					arm_biquad_cascade_df2T_instance_q15 * S,
+					uint8_t numStages,
+					q15_t * pCoeffs,
+					q31_t * pState,
+					int8_t postShift);
 
   /**
-   * @brief Correlation of Q15 sequences (fast version) for Cortex-M3 and Cortex-M4.
-   * @param[in] *pSrcA points to the first input sequence.
-   * @param[in] srcALen length of the first input sequence.
-   * @param[in] *pSrcB points to the second input sequence.
-   * @param[in] srcBLen length of the second input sequence.
-   * @param[out] *pDst points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @brief Processing function for the floating-point stereo transposed direct form II Biquad cascade filter.
+   * @param[in]  *S        points to an instance of the filter data structure.
+   * @param[in]  *pSrc     points to the block of interleaved stereo input data.
+   * @param[out] *pDst     points to the block of interleaved stereo output data.
+   * @param[in]  blockSize number of stereo sample pairs to process.
    * @return none.
    */
 
-  void arm_correlate_fast_q15(
-			       q15_t * pSrcA,
-			      uint32_t srcALen,
-			       q15_t * pSrcB,
-			      uint32_t srcBLen,
-			      q15_t * pDst);
+  void arm_biquad_cascade_stereo_df2T_f32(
+					  const arm_biquad_cascade_stereo_df2T_instance_f32 * S,
+					  float32_t * pSrc,
+					  float32_t * pDst,
+					  uint32_t blockSize);
 
   /**
-   * @brief Correlation of Q31 sequences.
-   * @param[in] *pSrcA points to the first input sequence.
-   * @param[in] srcALen length of the first input sequence.
-   * @param[in] *pSrcB points to the second input sequence.
-   * @param[in] srcBLen length of the second input sequence.
-   * @param[out] *pDst points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
-   * @return none.
+   * @brief  Initialization function for the floating-point stereo transposed direct form II Biquad cascade filter.
+   * @param[in,out] *S           points to an instance of the filter data structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     *pCoeffs     points to the filter coefficients, shared by both channels.
+   * @param[in]     *pState      points to the state buffer.
+   * @return        none
    */
 
-  void arm_correlate_q31(
-			  q31_t * pSrcA,
-			 uint32_t srcALen,
-			  q31_t * pSrcB,
-			 uint32_t srcBLen,
-			 q31_t * pDst);
+  void arm_biquad_cascade_stereo_df2T_init_f32(
+					       arm_biquad_cascade_stereo_df2T_instance_f32 * S,
+					       uint8_t numStages,
+					       float32_t * pCoeffs,
+					       float32_t * pState);
+
 
-  /**
-   * @brief Correlation of Q31 sequences (fast version) for Cortex-M3 and Cortex-M4
-   * @param[in] *pSrcA points to the first input sequence.
-   * @param[in] srcALen length of the first input sequence.
-   * @param[in] *pSrcB points to the second input sequence.
-   * @param[in] srcBLen length of the second input sequence.
-   * @param[out] *pDst points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
-   * @return none.
-   */
 
-  void arm_correlate_fast_q31(
-			       q31_t * pSrcA,
-			      uint32_t srcALen,
-			       q31_t * pSrcB,
-			      uint32_t srcBLen,
-			      q31_t * pDst);
 
   /**
-   * @brief Correlation of Q7 sequences.
-   * @param[in] *pSrcA points to the first input sequence.
-   * @param[in] srcALen length of the first input sequence.
-   * @param[in] *pSrcB points to the second input sequence.
-   * @param[in] srcBLen length of the second input sequence.
-   * @param[out] *pDst points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
-   * @return none.
+   * @brief Channel layout of the buffers passed to the multichannel filters.
    */
 
-  void arm_correlate_q7(
-			 q7_t * pSrcA,
-			uint32_t srcALen,
-			 q7_t * pSrcB,
-			uint32_t srcBLen,
-			q7_t * pDst);
+  typedef enum
+  {
+    ARM_MULTI_PLANAR = 0,        /**< each channel is a contiguous block of blockSize samples. */
+    ARM_MULTI_INTERLEAVED = 1    /**< the samples of all channels at one time step are contiguous. */
+  } arm_multi_layout;
 
   /**
-   * @brief Instance structure for the floating-point sparse FIR filter.
+   * @brief Instance structure for the Q15 multichannel FIR filter.
    */
   typedef struct
   {
-    uint16_t numTaps;             /**< number of coefficients in the filter. */
-    uint16_t stateIndex;          /**< state buffer index.  Points to the oldest sample in the state buffer. */
-    float32_t *pState;            /**< points to the state buffer array. The array is of length maxDelay+blockSize-1. */
-    float32_t *pCoeffs;           /**< points to the coefficient array. The array is of length numTaps.*/
-    uint16_t maxDelay;            /**< maximum offset specified by the pTapDelay array. */
-    int32_t *pTapDelay;           /**< points to the array of delay values.  The array is of length numTaps. */
-  } arm_fir_sparse_instance_f32;
+    uint16_t numTaps;         /**< number of filter coefficients in the filter. */
+    uint16_t numChannels;     /**< number of channels filtered by each call. */
+    arm_multi_layout layout;  /**< channel layout of the input and output buffers. */
+    q15_t *pState;            /**< points to the state variable array. The array is of length (numTaps+blockSize-1)*numChannels. */
+    q15_t *pCoeffs;           /**< points to the coefficient array. The array is of length numTaps, shared by all channels.*/
+  } arm_fir_multi_instance_q15;
 
   /**
-   * @brief Instance structure for the Q31 sparse FIR filter.
+   * @brief Instance structure for the Q31 multichannel FIR filter.
    */
-
   typedef struct
   {
-    uint16_t numTaps;             /**< number of coefficients in the filter. */
-    uint16_t stateIndex;          /**< state buffer index.  Points to the oldest sample in the state buffer. */
-    q31_t *pState;                /**< points to the state buffer array. The array is of length maxDelay+blockSize-1. */
-    q31_t *pCoeffs;               /**< points to the coefficient array. The array is of length numTaps.*/
-    uint16_t maxDelay;            /**< maximum offset specified by the pTapDelay array. */
-    int32_t *pTapDelay;           /**< points to the array of delay values.  The array is of length numTaps. */
-  } arm_fir_sparse_instance_q31;
+    uint16_t numTaps;         /**< number of filter coefficients in the filter. */
+    uint16_t numChannels;     /**< number of channels filtered by each call. */
+    arm_multi_layout layout;  /**< channel layout of the input and output buffers. */
+    q31_t *pState;            /**< points to the state variable array. The array is of length (numTaps+blockSize-1)*numChannels. */
+    q31_t *pCoeffs;           /**< points to the coefficient array. The array is of length numTaps, shared by all channels.*/
+  } arm_fir_multi_instance_q31;
 
   /**
-   * @brief Instance structure for the Q15 sparse FIR filter.
+   * @brief Instance structure for the floating-point multichannel FIR filter.
    */
-
   typedef struct
   {
-    uint16_t numTaps;             /**< number of coefficients in the filter. */
-    uint16_t stateIndex;          /**< state buffer index.  Points to the oldest sample in the state buffer. */
-    q15_t *pState;                /**< points to the state buffer array. The array is of length maxDelay+blockSize-1. */
-    q15_t *pCoeffs;               /**< points to the coefficient array. The array is of length numTaps.*/
-    uint16_t maxDelay;            /**< maximum offset specified by the pTapDelay array. */
-    int32_t *pTapDelay;           /**< points to the array of delay values.  The array is of length numTaps. */
-  } arm_fir_sparse_instance_q15;
+    uint16_t numTaps;         /**< number of filter coefficients in the filter. */
+    uint16_t numChannels;     /**< number of channels filtered by each call. */
+    arm_multi_layout layout;  /**< channel layout of the input and output buffers. */
+    float32_t *pState;        /**< points to the state variable array. The array is of length (numTaps+blockSize-1)*numChannels. */
+    float32_t *pCoeffs;       /**< points to the coefficient array. The array is of length numTaps, shared by all channels. */
+  } arm_fir_multi_instance_f32;
+
 
   /**
-   * @brief Instance structure for the Q7 sparse FIR filter.
+   * @brief Processing function for the Q15 multichannel FIR filter.
+   * @param[in]  *S points to an instance of the Q15 multichannel FIR structure.
+   * @param[in]  *pSrc points to the block of input data, blockSize samples of every channel.
+   * @param[out] *pDst points to the block of output data, blockSize samples of every channel.
+   * @param[in]  blockSize number of samples per channel to process per call.
+   * @return     none.
    */
+  void arm_fir_multi_q15(
+			 const arm_fir_multi_instance_q15 * S,
+			  q15_t * pSrc,
+			 q15_t * pDst,
+			 uint32_t blockSize);
 
-  typedef struct
-  {
-    uint16_t numTaps;             /**< number of coefficients in the filter. */
-    uint16_t stateIndex;          /**< state buffer index.  Points to the oldest sample in the state buffer. */
-    q7_t *pState;                 /**< points to the state buffer array. The array is of length maxDelay+blockSize-1. */
-    q7_t *pCoeffs;                /**< points to the coefficient array. The array is of length numTaps.*/
-    uint16_t maxDelay;            /**< maximum offset specified by the pTapDelay array. */
-    int32_t *pTapDelay;           /**< points to the array of delay values.  The array is of length numTaps. */
-  } arm_fir_sparse_instance_q7;
+  /**
+   * @brief  Initialization function for the Q15 multichannel FIR filter.
+   * @param[in,out] *S points to an instance of the Q15 multichannel FIR filter structure.
+   * @param[in]     numTaps  Number of filter coefficients in the filter.
+   * @param[in]     numChannels number of channels filtered by each call.
+   * @param[in]     layout  channel layout of the input and output buffers.
+   * @param[in]     *pCoeffs points to the filter coefficients buffer.
+   * @param[in]     *pState points to the state buffer.
+   * @param[in]     blockSize number of samples per channel that are processed per call.
+   * @return        none.
+   */
+  void arm_fir_multi_init_q15(
+			      arm_fir_multi_instance_q15 * S,
+			      uint16_t numTaps,
+			      uint16_t numChannels,
+			      arm_multi_layout layout,
+			      q15_t * pCoeffs,
+			      q15_t * pState,
+			      uint32_t blockSize);
 
   /**
-   * @brief Processing function for the floating-point sparse FIR filter.
-   * @param[in]  *S          points to an instance of the floating-point sparse FIR structure.
-   * @param[in]  *pSrc       points to the block of input data.
-   * @param[out] *pDst       points to the block of output data
-   * @param[in]  *pScratchIn points to a temporary buffer of size blockSize.
-   * @param[in]  blockSize   number of input samples to process per call.
-   * @return none.
+   * @brief Processing function for the Q31 multichannel FIR filter.
+   * @param[in]  *S points to an instance of the Q31 multichannel FIR structure.
+   * @param[in]  *pSrc points to the block of input data, blockSize samples of every channel.
+   * @param[out] *pDst points to the block of output data, blockSize samples of every channel.
+   * @param[in]  blockSize number of samples per channel to process per call.
+   * @return     none.
    */
+  void arm_fir_multi_q31(
+			 const arm_fir_multi_instance_q31 * S,
+			  q31_t * pSrc,
+			 q31_t * pDst,
+			 uint32_t blockSize);
 
-  void arm_fir_sparse_f32(
-			  arm_fir_sparse_instance_f32 * S,
-			   float32_t * pSrc,
-			  float32_t * pDst,
-			  float32_t * pScratchIn,
-			  uint32_t blockSize);
+  /**
+   * @brief  Initialization function for the Q31 multichannel FIR filter.
+   * @param[in,out] *S points to an instance of the Q31 multichannel FIR filter structure.
+   * @param[in]     numTaps  Number of filter coefficients in the filter.
+   * @param[in]     numChannels number of channels filtered by each call.
+   * @param[in]     layout  channel layout of the input and output buffers.
+   * @param[in]     *pCoeffs points to the filter coefficients buffer.
+   * @param[in]     *pState points to the state buffer.
+   * @param[in]     blockSize number of samples per channel that are processed per call.
+   * @return        none.
+   */
+  void arm_fir_multi_init_q31(
+			      arm_fir_multi_instance_q31 * S,
+			      uint16_t numTaps,
+			      uint16_t numChannels,
+			      arm_multi_layout layout,
+			      q31_t * pCoeffs,
+			      q31_t * pState,
+			      uint32_t blockSize);
 
   /**
-   * @brief  Initialization function for the floating-point sparse FIR filter.
-   * @param[in,out] *S         points to an instance of the floating-point sparse FIR structure.
-   * @param[in]     numTaps    number of nonzero coefficients in the filter.
-   * @param[in]     *pCoeffs   points to the array of filter coefficients.
-   * @param[in]     *pState    points to the state buffer.
-   * @param[in]     *pTapDelay points to the array of offset times.
-   * @param[in]     maxDelay   maximum offset time supported.
-   * @param[in]     blockSize  number of samples that will be processed per block.
-   * @return none
+   * @brief Processing function for the floating-point multichannel FIR filter.
+   * @param[in]  *S points to an instance of the floating-point multichannel FIR structure.
+   * @param[in]  *pSrc points to the block of input data, blockSize samples of every channel.
+   * @param[out] *pDst points to the block of output data, blockSize samples of every channel.
+   * @param[in]  blockSize number of samples per channel to process per call.
+   * @return     none.
    */
-
-  void arm_fir_sparse_init_f32(
-			       arm_fir_sparse_instance_f32 * S,
-			       uint16_t numTaps,
-			       float32_t * pCoeffs,
-			       float32_t * pState,
-			       int32_t * pTapDelay,
-			       uint16_t maxDelay,
-			       uint32_t blockSize);
+  void arm_fir_multi_f32(
+			 const arm_fir_multi_instance_f32 * S,
+			  float32_t * pSrc,
+			 float32_t * pDst,
+			 uint32_t blockSize);
 
   /**
-   * @brief Processing function for the Q31 sparse FIR filter.
-   * @param[in]  *S          points to an instance of the Q31 sparse FIR structure.
-   * @param[in]  *pSrc       points to the block of input data.
-   * @param[out] *pDst       points to the block of output data
-   * @param[in]  *pScratchIn points to a temporary buffer of size blockSize.
-   * @param[in]  blockSize   number of input samples to process per call.
-   * @return none.
+   * @brief  Initialization function for the floating-point multichannel FIR filter.
+   * @param[in,out] *S points to an instance of the floating-point multichannel FIR filter structure.
+   * @param[in]     numTaps  Number of filter coefficients in the filter.
+   * @param[in]     numChannels number of channels filtered by each call.
+   * @param[in]     layout  channel layout of the input and output buffers.
+   * @param[in]     *pCoeffs points to the filter coefficients buffer.
+   * @param[in]     *pState points to the state buffer.
+   * @param[in]     blockSize number of samples per channel that are processed per call.
+   * @return        none.
    */
+  void arm_fir_multi_init_f32(
+			      arm_fir_multi_instance_f32 * S,
+			      uint16_t numTaps,
+			      uint16_t numChannels,
+			      arm_multi_layout layout,
+			      float32_t * pCoeffs,
+			      float32_t * pState,
+			      uint32_t blockSize);
 
-  void arm_fir_sparse_q31(
-			  arm_fir_sparse_instance_q31 * S,
-			   q31_t * pSrc,
-			  q31_t * pDst,
-			  q31_t * pScratchIn,
-			  uint32_t blockSize);
 
   /**
-   * @brief  Initialization function for the Q31 sparse FIR filter.
-   * @param[in,out] *S         points to an instance of the Q31 sparse FIR structure.
-   * @param[in]     numTaps    number of nonzero coefficients in the filter.
-   * @param[in]     *pCoeffs   points to the array of filter coefficients.
-   * @param[in]     *pState    points to the state buffer.
-   * @param[in]     *pTapDelay points to the array of offset times.
-   * @param[in]     maxDelay   maximum offset time supported.
-   * @param[in]     blockSize  number of samples that will be processed per block.
-   * @return none
+   * @brief Instance structure for the Q15 multichannel Biquad cascade filter.
    */
 
-  void arm_fir_sparse_init_q31(
-			       arm_fir_sparse_instance_q31 * S,
-			       uint16_t numTaps,
-			       q31_t * pCoeffs,
-			       q31_t * pState,
-			       int32_t * pTapDelay,
-			       uint16_t maxDelay,
-			       uint32_t blockSize);
+  typedef struct
+  {
+    uint32_t numStages;       /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    uint16_t numChannels;     /**< number of channels filtered by each call. */
+    arm_multi_layout layout;  /**< channel layout of the input and output buffers. */
+    q15_t *pState;            /**< Points to the array of state coefficients.  The array is of length 4*numStages*numChannels. */
+    q15_t *pCoeffs;           /**< Points to the array of coefficients.  The array is of length 6*numStages. */
+    int8_t postShift;         /**< Additional shift, in bits, applied to each output sample. */
+
+  } arm_biquad_casd_df1_multi_inst_q15;
+
 
   /**
-   * @brief Processing function for the Q15 sparse FIR filter.
-   * @param[in]  *S           points to an instance of the Q15 sparse FIR structure.
-   * @param[in]  *pSrc        points to the block of input data.
-   * @param[out] *pDst        points to the block of output data
-   * @param[in]  *pScratchIn  points to a temporary buffer of size blockSize.
-   * @param[in]  *pScratchOut points to a temporary buffer of size blockSize.
-   * @param[in]  blockSize    number of input samples to process per call.
-   * @return none.
+   * @brief Instance structure for the Q31 multichannel Biquad cascade filter.
    */
 
-  void arm_fir_sparse_q15(
-			  arm_fir_sparse_instance_q15 * S,
-			   q15_t * pSrc,
-			  q15_t * pDst,
-			  q15_t * pScratchIn,
-			  q31_t * pScratchOut,
-			  uint32_t blockSize);
+  typedef struct
+  {
+    uint32_t numStages;       /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    uint16_t numChannels;     /**< number of channels filtered by each call. */
+    arm_multi_layout layout;  /**< channel layout of the input and output buffers. */
+    q31_t *pState;            /**< Points to the array of state coefficients.  The array is of length 4*numStages*numChannels. */
+    q31_t *pCoeffs;           /**< Points to the array of coefficients.  The array is of length 5*numStages. */
+    uint8_t postShift;        /**< Additional shift, in bits, applied to each output sample. */
 
+  } arm_biquad_casd_df1_multi_inst_q31;
 
   /**
-   * @brief  Initialization function for the Q15 sparse FIR filter.
-   * @param[in,out] *S         points to an instance of the Q15 sparse FIR structure.
-   * @param[in]     numTaps    number of nonzero coefficients in the filter.
-   * @param[in]     *pCoeffs   points to the array of filter coefficients.
-   * @param[in]     *pState    points to the state buffer.
-   * @param[in]     *pTapDelay points to the array of offset times.
-   * @param[in]     maxDelay   maximum offset time supported.
-   * @param[in]     blockSize  number of samples that will be processed per block.
-   * @return none
+   * @brief Instance structure for the floating-point multichannel Biquad cascade filter.
    */
+  typedef struct
+  {
+    uint32_t numStages;       /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    uint16_t numChannels;     /**< number of channels filtered by each call. */
+    arm_multi_layout layout;  /**< channel layout of the input and output buffers. */
+    float32_t *pState;        /**< Points to the array of state coefficients.  The array is of length 4*numStages*numChannels. */
+    float32_t *pCoeffs;       /**< Points to the array of coefficients.  The array is of length 5*numStages. */
+
+  } arm_biquad_casd_df1_multi_inst_f32;
 
-  void arm_fir_sparse_init_q15(
-			       arm_fir_sparse_instance_q15 * S,
-			       uint16_t numTaps,
-			       q15_t * pCoeffs,
-			       q15_t * pState,
-			       int32_t * pTapDelay,
-			       uint16_t maxDelay,
-			       uint32_t blockSize);
 
   /**
-   * @brief Processing function for the Q7 sparse FIR filter.
-   * @param[in]  *S           points to an instance of the Q7 sparse FIR structure.
-   * @param[in]  *pSrc        points to the block of input data.
-   * @param[out] *pDst        points to the block of output data
-   * @param[in]  *pScratchIn  points to a temporary buffer of size blockSize.
-   * @param[in]  *pScratchOut points to a temporary buffer of size blockSize.
-   * @param[in]  blockSize    number of input samples to process per call.
-   * @return none.
+   * @brief Processing function for the Q15 multichannel Biquad cascade filter.
+   * @param[in]  *S         points to an instance of the Q15 multichannel Biquad cascade structure.
+   * @param[in]  *pSrc      points to the block of input data, blockSize samples of every channel.
+   * @param[out] *pDst      points to the block of output data, blockSize samples of every channel.
+   * @param[in]  blockSize  number of samples per channel to process per call.
+   * @return     none.
    */
 
-  void arm_fir_sparse_q7(
-			 arm_fir_sparse_instance_q7 * S,
-			  q7_t * pSrc,
-			 q7_t * pDst,
-			 q7_t * pScratchIn,
-			 q31_t * pScratchOut,
-			 uint32_t blockSize);
+  void arm_biquad_cascade_df1_multi_q15(
+					const arm_biquad_casd_df1_multi_inst_q15 * S,
+					q15_t * pSrc,
+					q15_t * pDst,
+					uint32_t blockSize);
 
   /**
-   * @brief  Initialization function for the Q7 sparse FIR filter.
-   * @param[in,out] *S         points to an instance of the Q7 sparse FIR structure.
-   * @param[in]     numTaps    number of nonzero coefficients in the filter.
-   * @param[in]     *pCoeffs   points to the array of filter coefficients.
-   * @param[in]     *pState    points to the state buffer.
-   * @param[in]     *pTapDelay points to the array of offset times.
-   * @param[in]     maxDelay   maximum offset time supported.
-   * @param[in]     blockSize  number of samples that will be processed per block.
-   * @return none
+   * @brief  Initialization function for the Q15 multichannel Biquad cascade filter.
+   * @param[in,out] *S           points to an instance of the Q15 multichannel Biquad cascade structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     numChannels  number of channels filtered by each call.
+   * @param[in]     layout       channel layout of the input and output buffers.
+   * @param[in]     *pCoeffs     points to the filter coefficients.
+   * @param[in]     *pState      points to the state buffer.
+   * @param[in]     postShift    Shift to be applied to the output. Varies according to the coefficients format
+   * @return        none
    */
 
-  void arm_fir_sparse_init_q7(
-			      arm_fir_sparse_instance_q7 * S,
-			      uint16_t numTaps,
-			      q7_t * pCoeffs,
-			      q7_t * pState,
-			      int32_t *pTapDelay,
-			      uint16_t maxDelay,
-			      uint32_t blockSize);
-
+  void arm_biquad_cascade_df1_multi_init_q15(
+					     arm_biquad_casd_df1_multi_inst_q15 * S,
+					     uint8_t numStages,
+					     uint16_t numChannels,
+					     arm_multi_layout layout,
+					     q15_t * pCoeffs,
+					     q15_t * pState,
+					     int8_t postShift);
 
-  /*
-   * @brief  Floating-point sin_cos function.
-   * @param[in]  theta    input value in degrees 
-   * @param[out] *pSinVal points to the processed sine output. 
-   * @param[out] *pCosVal points to the processed cos output. 
-   * @return none.
+  /**
+   * @brief Processing function for the Q31 multichannel Biquad cascade filter.
+   * @param[in]  *S         points to an instance of the Q31 multichannel Biquad cascade structure.
+   * @param[in]  *pSrc      points to the block of input data, blockSize samples of every channel.
+   * @param[out] *pDst      points to the block of output data, blockSize samples of every channel.
+   * @param[in]  blockSize  number of samples per channel to process per call.
+   * @return     none.
    */
 
-  void arm_sin_cos_f32(
-		       float32_t theta,
-		       float32_t *pSinVal,
-		       float32_t *pCcosVal);
+  void arm_biquad_cascade_df1_multi_q31(
+					const arm_biquad_casd_df1_multi_inst_q31 * S,
+					q31_t * pSrc,
+					q31_t * pDst,
+					uint32_t blockSize);
 
-  /*
-   * @brief  Q31 sin_cos function.
-   * @param[in]  theta    scaled input value in degrees 
-   * @param[out] *pSinVal points to the processed sine output. 
-   * @param[out] *pCosVal points to the processed cosine output. 
-   * @return none.
+  /**
+   * @brief  Initialization function for the Q31 multichannel Biquad cascade filter.
+   * @param[in,out] *S           points to an instance of the Q31 multichannel Biquad cascade structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     numChannels  number of channels filtered by each call.
+   * @param[in]     layout       channel layout of the input and output buffers.
+   * @param[in]     *pCoeffs     points to the filter coefficients.
+   * @param[in]     *pState      points to the state buffer.
+   * @param[in]     postShift    Shift to be applied to the output. Varies according to the coefficients format
+   * @return        none
    */
 
-  void arm_sin_cos_q31(
-		       q31_t theta,
-		       q31_t *pSinVal,
-		       q31_t *pCosVal);
-
+  void arm_biquad_cascade_df1_multi_init_q31(
+					     arm_biquad_casd_df1_multi_inst_q31 * S,
+					     uint8_t numStages,
+					     uint16_t numChannels,
+					     arm_multi_layout layout,
+					     q31_t * pCoeffs,
+					     q31_t * pState,
+					     int8_t postShift);
 
   /**
-   * @brief  Floating-point complex conjugate.
-   * @param[in]  *pSrc points to the input vector
-   * @param[out]  *pDst points to the output vector
-   * @param[in]  numSamples number of complex samples in each vector
-   * @return none.
+   * @brief Processing function for the floating-point multichannel Biquad cascade filter.
+   * @param[in]  *S         points to an instance of the floating-point multichannel Biquad cascade structure.
+   * @param[in]  *pSrc      points to the block of input data, blockSize samples of every channel.
+   * @param[out] *pDst      points to the block of output data, blockSize samples of every channel.
+   * @param[in]  blockSize  number of samples per channel to process per call.
+   * @return     none.
    */
 
-  void arm_cmplx_conj_f32(
-			   float32_t * pSrc,
-			  float32_t * pDst,
-			  uint32_t numSamples);
+  void arm_biquad_cascade_df1_multi_f32(
+					const arm_biquad_casd_df1_multi_inst_f32 * S,
+					float32_t * pSrc,
+					float32_t * pDst,
+					uint32_t blockSize);
 
   /**
-   * @brief  Q31 complex conjugate.
-   * @param[in]  *pSrc points to the input vector
-   * @param[out]  *pDst points to the output vector
-   * @param[in]  numSamples number of complex samples in each vector
-   * @return none.
+   * @brief  Initialization function for the floating-point multichannel Biquad cascade filter.
+   * @param[in,out] *S           points to an instance of the floating-point multichannel Biquad cascade structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     numChannels  number of channels filtered by each call.
+   * @param[in]     layout       channel layout of the input and output buffers.
+   * @param[in]     *pCoeffs     points to the filter coefficients.
+   * @param[in]     *pState      points to the state buffer.
+   * @return        none
    */
 
-  void arm_cmplx_conj_q31(
-			   q31_t * pSrc,
-			  q31_t * pDst,
-			  uint32_t numSamples);
+  void arm_biquad_cascade_df1_multi_init_f32(
+					     arm_biquad_casd_df1_multi_inst_f32 * S,
+					     uint8_t numStages,
+					     uint16_t numChannels,
+					     arm_multi_layout layout,
+					     float32_t * pCoeffs,
+					     float32_t * pState);
+
 
   /**
-   * @brief  Q15 complex conjugate.
-   * @param[in]  *pSrc points to the input vector
-   * @param[out]  *pDst points to the output vector
-   * @param[in]  numSamples number of complex samples in each vector
-   * @return none.
+   * @brief Instance structure for the Q15 FIR lattice filter.
    */
 
-  void arm_cmplx_conj_q15(
-			   q15_t * pSrc,
-			  q15_t * pDst,
-			  uint32_t numSamples);
-
-
+  typedef struct
+  {
+    uint16_t numStages;                          /**< number of filter stages. */
+    q15_t *pState;                               /**< points to the state variable array. The array is of length numStages. */
+    q15_t *pCoeffs;                              /**< points to the coefficient array. The array is of length numStages. */
+  } arm_fir_lattice_instance_q15;
 
   /**
-   * @brief  Floating-point complex magnitude squared
-   * @param[in]  *pSrc points to the complex input vector
-   * @param[out]  *pDst points to the real output vector
-   * @param[in]  numSamples number of complex samples in the input vector
-   * @return none.
+   * @brief Instance structure for the Q31 FIR lattice filter.
    */
 
-  void arm_cmplx_mag_squared_f32(
-				  float32_t * pSrc,
-				 float32_t * pDst,
-				 uint32_t numSamples);
+  typedef struct
+  {
+    uint16_t numStages;                          /**< number of filter stages. */
+    q31_t *pState;                               /**< points to the state variable array. The array is of length numStages. */
+    q31_t *pCoeffs;                              /**< points to the coefficient array. The array is of length numStages. */
+  } arm_fir_lattice_instance_q31;
 
   /**
-   * @brief  Q31 complex magnitude squared
-   * @param[in]  *pSrc points to the complex input vector
-   * @param[out]  *pDst points to the real output vector
-   * @param[in]  numSamples number of complex samples in the input vector
-   * @return none.
+   * @brief Instance structure for the floating-point FIR lattice filter.
    */
 
-  void arm_cmplx_mag_squared_q31(
-				  q31_t * pSrc,
-				 q31_t * pDst,
-				 uint32_t numSamples);
+  typedef struct
+  {
+    uint16_t numStages;                  /**< number of filter stages. */
+    float32_t *pState;                   /**< points to the state variable array. The array is of length numStages. */
+    float32_t *pCoeffs;                  /**< points to the coefficient array. The array is of length numStages. */
+  } arm_fir_lattice_instance_f32;
 
   /**
-   * @brief  Q15 complex magnitude squared
-   * @param[in]  *pSrc points to the complex input vector
-   * @param[out]  *pDst points to the real output vector
-   * @param[in]  numSamples number of complex samples in the input vector
+   * @brief Initialization function for the Q15 FIR lattice filter.
+   * @param[in] *S points to an instance of the Q15 FIR lattice structure.
+   * @param[in] numStages  number of filter stages.
+   * @param[in] *pCoeffs points to the coefficient buffer.  The array is of length numStages. 
+   * @param[in] *pState points to the state buffer.  The array is of length numStages. 
    * @return none.
    */
 
-  void arm_cmplx_mag_squared_q15(
-				  q15_t * pSrc,
-				 q15_t * pDst,
-				 uint32_t numSamples);
+  void arm_fir_lattice_init_q15(
+				arm_fir_lattice_instance_q15 * S,
+				uint16_t numStages,
+				q15_t * pCoeffs,
+				q15_t * pState);
+
+
+  /**
+   * @brief Processing function for the Q15 FIR lattice filter.
+   * @param[in] *S points to an instance of the Q15 FIR lattice structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+  void arm_fir_lattice_q15(
+			   const arm_fir_lattice_instance_q15 * S,
+			    q15_t * pSrc,
+			   q15_t * pDst,
+			   uint32_t blockSize);
+
+  /**
+   * @brief Initialization function for the Q31 FIR lattice filter.
+   * @param[in] *S points to an instance of the Q31 FIR lattice structure.
+   * @param[in] numStages  number of filter stages.
+   * @param[in] *pCoeffs points to the coefficient buffer.  The array is of length numStages.
+   * @param[in] *pState points to the state buffer.   The array is of length numStages.
+   * @return none.
+   */
+
+  void arm_fir_lattice_init_q31(
+				arm_fir_lattice_instance_q31 * S,
+				uint16_t numStages,
+				q31_t * pCoeffs,
+				q31_t * pState);
+
+
+  /**
+   * @brief Processing function for the Q31 FIR lattice filter.
+   * @param[in]  *S        points to an instance of the Q31 FIR lattice structure.
+   * @param[in]  *pSrc     points to the block of input data.
+   * @param[out] *pDst     points to the block of output data
+   * @param[in]  blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_fir_lattice_q31(
+			   const arm_fir_lattice_instance_q31 * S,
+			    q31_t * pSrc,
+			   q31_t * pDst,
+			   uint32_t blockSize);
+
+/**
+ * @brief Initialization function for the floating-point FIR lattice filter.
+ * @param[in] *S points to an instance of the floating-point FIR lattice structure.
+ * @param[in] numStages  number of filter stages.
+ * @param[in] *pCoeffs points to the coefficient buffer.  The array is of length numStages.
+ * @param[in] *pState points to the state buffer.  The array is of length numStages.
+ * @return none.
+ */
+
+  void arm_fir_lattice_init_f32(
+				arm_fir_lattice_instance_f32 * S,
+				uint16_t numStages,
+				float32_t * pCoeffs,
+				float32_t * pState);
+
+  /**
+   * @brief Processing function for the floating-point FIR lattice filter.
+   * @param[in]  *S        points to an instance of the floating-point FIR lattice structure.
+   * @param[in]  *pSrc     points to the block of input data.
+   * @param[out] *pDst     points to the block of output data
+   * @param[in]  blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_fir_lattice_f32(
+			   const arm_fir_lattice_instance_f32 * S,
+			    float32_t * pSrc,
+			   float32_t * pDst,
+			   uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the Q15 IIR lattice filter.
+   */
+  typedef struct
+  {
+    uint16_t numStages;                         /**< number of stages in the filter. */
+    q15_t *pState;                              /**< points to the state variable array. The array is of length numStages+blockSize. */
+    q15_t *pkCoeffs;                            /**< points to the reflection coefficient array. The array is of length numStages. */
+    q15_t *pvCoeffs;                            /**< points to the ladder coefficient array. The array is of length numStages+1. */
+  } arm_iir_lattice_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q31 IIR lattice filter.
+   */
+  typedef struct
+  {
+    uint16_t numStages;                         /**< number of stages in the filter. */
+    q31_t *pState;                              /**< points to the state variable array. The array is of length numStages+blockSize. */
+    q31_t *pkCoeffs;                            /**< points to the reflection coefficient array. The array is of length numStages. */
+    q31_t *pvCoeffs;                            /**< points to the ladder coefficient array. The array is of length numStages+1. */
+  } arm_iir_lattice_instance_q31;
+
+  /**
+   * @brief Instance structure for the floating-point IIR lattice filter.
+   */
+  typedef struct
+  {
+    uint16_t numStages;                         /**< number of stages in the filter. */
+    float32_t *pState;                          /**< points to the state variable array. The array is of length numStages+blockSize. */
+    float32_t *pkCoeffs;                        /**< points to the reflection coefficient array. The array is of length numStages. */
+    float32_t *pvCoeffs;                        /**< points to the ladder coefficient array. The array is of length numStages+1. */
+  } arm_iir_lattice_instance_f32;
+
+  /**
+   * @brief Processing function for the floating-point IIR lattice filter.
+   * @param[in] *S points to an instance of the floating-point IIR lattice structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_iir_lattice_f32(
+			   const arm_iir_lattice_instance_f32 * S,
+			    float32_t * pSrc,
+			   float32_t * pDst,
+			   uint32_t blockSize);
+
+  /**
+   * @brief Initialization function for the floating-point IIR lattice filter.
+   * @param[in] *S points to an instance of the floating-point IIR lattice structure.
+   * @param[in] numStages number of stages in the filter.
+   * @param[in] *pkCoeffs points to the reflection coefficient buffer.  The array is of length numStages.
+   * @param[in] *pvCoeffs points to the ladder coefficient buffer.  The array is of length numStages+1.
+   * @param[in] *pState points to the state buffer.  The array is of length numStages+blockSize-1.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_iir_lattice_init_f32(
+				arm_iir_lattice_instance_f32 * S,
+				uint16_t numStages,
+				float32_t *pkCoeffs,
+				float32_t *pvCoeffs,
+				float32_t *pState,
+				uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the Q31 IIR lattice filter.
+   * @param[in] *S points to an instance of the Q31 IIR lattice structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_iir_lattice_q31(
+			   const arm_iir_lattice_instance_q31 * S,
+			    q31_t * pSrc,
+			   q31_t * pDst,
+			   uint32_t blockSize);
+
+
+  /**
+   * @brief Initialization function for the Q31 IIR lattice filter.
+   * @param[in] *S points to an instance of the Q31 IIR lattice structure.
+   * @param[in] numStages number of stages in the filter.
+   * @param[in] *pkCoeffs points to the reflection coefficient buffer.  The array is of length numStages.
+   * @param[in] *pvCoeffs points to the ladder coefficient buffer.  The array is of length numStages+1.
+   * @param[in] *pState points to the state buffer.  The array is of length numStages+blockSize.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_iir_lattice_init_q31(
+				arm_iir_lattice_instance_q31 * S,
+				uint16_t numStages,
+				q31_t *pkCoeffs,
+				q31_t *pvCoeffs,
+				q31_t *pState,
+				uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the Q15 IIR lattice filter.
+   * @param[in] *S points to an instance of the Q15 IIR lattice structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_iir_lattice_q15(
+			   const arm_iir_lattice_instance_q15 * S,
+			    q15_t * pSrc,
+			   q15_t * pDst,
+			   uint32_t blockSize);
+
+
+/**
+ * @brief Initialization function for the Q15 IIR lattice filter.
+ * @param[in] *S points to an instance of the fixed-point Q15 IIR lattice structure.
+ * @param[in] numStages  number of stages in the filter.
+ * @param[in] *pkCoeffs points to reflection coefficient buffer.  The array is of length numStages.
+ * @param[in] *pvCoeffs points to ladder coefficient buffer.  The array is of length numStages+1.
+ * @param[in] *pState points to state buffer.  The array is of length numStages+blockSize.
+ * @param[in] blockSize number of samples to process per call.
+ * @return none.
+ */
+
+  void arm_iir_lattice_init_q15(
+				arm_iir_lattice_instance_q15 * S,
+				uint16_t numStages,
+				q15_t *pkCoeffs,
+				q15_t *pvCoeffs,
+				q15_t *pState,
+				uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the floating-point LMS filter.
+   */
+
+  typedef struct
+  {
+    uint16_t numTaps;    /**< number of coefficients in the filter. */
+    float32_t *pState;   /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+    float32_t *pCoeffs;  /**< points to the coefficient array. The array is of length numTaps. */
+    float32_t mu;        /**< step size that controls filter coefficient updates. */
+  } arm_lms_instance_f32;
+
+  /**
+   * @brief Processing function for floating-point LMS filter.
+   * @param[in]  *S points to an instance of the floating-point LMS filter structure.
+   * @param[in]  *pSrc points to the block of input data.
+   * @param[in]  *pRef points to the block of reference data.
+   * @param[out] *pOut points to the block of output data.
+   * @param[out] *pErr points to the block of error data.
+   * @param[in]  blockSize number of samples to process.
+   * @return     none.
+   */
+
+  void arm_lms_f32(
+		   const arm_lms_instance_f32 * S,
+		    float32_t * pSrc,
+		    float32_t * pRef,
+		   float32_t * pOut,
+		   float32_t * pErr,
+		   uint32_t blockSize);
+
+  /**
+   * @brief Initialization function for floating-point LMS filter.
+   * @param[in] *S points to an instance of the floating-point LMS filter structure.
+   * @param[in] numTaps  number of filter coefficients.
+   * @param[in] *pCoeffs points to the coefficient buffer.
+   * @param[in] *pState points to state buffer.
+   * @param[in] mu step size that controls filter coefficient updates.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_lms_init_f32(
+			arm_lms_instance_f32 * S,
+			uint16_t numTaps,
+			float32_t * pCoeffs,
+			float32_t * pState,
+			float32_t mu,
+			uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the Q15 LMS filter.
+   */
+
+  typedef struct
+  {
+    uint16_t numTaps;    /**< number of coefficients in the filter. */
+    q15_t *pState;       /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+    q15_t *pCoeffs;      /**< points to the coefficient array. The array is of length numTaps. */
+    q15_t mu;            /**< step size that controls filter coefficient updates. */
+    uint32_t postShift;  /**< bit shift applied to coefficients. */
+  } arm_lms_instance_q15;
+
+
+  /**
+   * @brief Initialization function for the Q15 LMS filter.
+   * @param[in] *S points to an instance of the Q15 LMS filter structure.
+   * @param[in] numTaps  number of filter coefficients.
+   * @param[in] *pCoeffs points to the coefficient buffer.
+   * @param[in] *pState points to the state buffer.
+   * @param[in] mu step size that controls filter coefficient updates.
+   * @param[in] blockSize number of samples to process.
+   * @param[in] postShift bit shift applied to coefficients.
+   * @return    none.
+   */
+
+  void arm_lms_init_q15(
+			arm_lms_instance_q15 * S,
+			uint16_t numTaps,
+			q15_t * pCoeffs,
+			q15_t * pState,
+			q15_t mu,
+			uint32_t blockSize,
+			uint32_t postShift);
+
+  /**
+   * @brief Processing function for Q15 LMS filter.
+   * @param[in] *S points to an instance of the Q15 LMS filter structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[in] *pRef points to the block of reference data.
+   * @param[out] *pOut points to the block of output data.
+   * @param[out] *pErr points to the block of error data.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_lms_q15(
+		   const arm_lms_instance_q15 * S,
+		    q15_t * pSrc,
+		    q15_t * pRef,
+		   q15_t * pOut,
+		   q15_t * pErr,
+		   uint32_t blockSize);
+
+
+  /**
+   * @brief Instance structure for the Q31 LMS filter.
+   */
+
+  typedef struct
+  {
+    uint16_t numTaps;    /**< number of coefficients in the filter. */
+    q31_t *pState;       /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+    q31_t *pCoeffs;      /**< points to the coefficient array. The array is of length numTaps. */
+    q31_t mu;            /**< step size that controls filter coefficient updates. */
+    uint32_t postShift;  /**< bit shift applied to coefficients. */
+
+  } arm_lms_instance_q31;
+
+  /**
+   * @brief Processing function for Q31 LMS filter.
+   * @param[in]  *S points to an instance of the Q15 LMS filter structure.
+   * @param[in]  *pSrc points to the block of input data.
+   * @param[in]  *pRef points to the block of reference data.
+   * @param[out] *pOut points to the block of output data.
+   * @param[out] *pErr points to the block of error data.
+   * @param[in]  blockSize number of samples to process.
+   * @return     none.
+   */
+
+  void arm_lms_q31(
+		   const arm_lms_instance_q31 * S,
+		    q31_t * pSrc,
+		    q31_t * pRef,
+		   q31_t * pOut,
+		   q31_t * pErr,
+		   uint32_t blockSize);
+
+  /**
+   * @brief Initialization function for Q31 LMS filter.
+   * @param[in] *S points to an instance of the Q31 LMS filter structure.
+   * @param[in] numTaps  number of filter coefficients.
+   * @param[in] *pCoeffs points to coefficient buffer.
+   * @param[in] *pState points to state buffer.
+   * @param[in] mu step size that controls filter coefficient updates.
+   * @param[in] blockSize number of samples to process.
+   * @param[in] postShift bit shift applied to coefficients.
+   * @return none.
+   */
+
+  void arm_lms_init_q31(
+			arm_lms_instance_q31 * S,
+			uint16_t numTaps,
+			q31_t *pCoeffs,
+			q31_t *pState,
+			q31_t mu,
+			uint32_t blockSize,
+			uint32_t postShift);
+
+  /**
+   * @brief Instance structure for the floating-point normalized LMS filter.
+   */
+
+  typedef struct
+  {
+    uint16_t  numTaps;    /**< number of coefficients in the filter. */
+    float32_t *pState;    /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+    float32_t *pCoeffs;   /**< points to the coefficient array. The array is of length numTaps. */
+    float32_t mu;        /**< step size that control filter coefficient updates. */
+    float32_t energy;    /**< saves previous frame energy. */
+    float32_t x0;        /**< saves previous input sample. */
+  } arm_lms_norm_instance_f32;
+
+  /**
+   * @brief Processing function for floating-point normalized LMS filter.
+   * @param[in] *S points to an instance of the floating-point normalized LMS filter structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[in] *pRef points to the block of reference data.
+   * @param[out] *pOut points to the block of output data.
+   * @param[out] *pErr points to the block of error data.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_lms_norm_f32(
+			arm_lms_norm_instance_f32 * S,
+			 float32_t * pSrc,
+			 float32_t * pRef,
+			float32_t * pOut,
+			float32_t * pErr,
+			uint32_t blockSize);
+
+  /**
+   * @brief Initialization function for floating-point normalized LMS filter.
+   * @param[in] *S points to an instance of the floating-point LMS filter structure.
+   * @param[in] numTaps  number of filter coefficients.
+   * @param[in] *pCoeffs points to coefficient buffer.
+   * @param[in] *pState points to state buffer.
+   * @param[in] mu step size that controls filter coefficient updates.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_lms_norm_init_f32(
+			     arm_lms_norm_instance_f32 * S,
+			     uint16_t numTaps,
+			     float32_t * pCoeffs,
+			     float32_t * pState,
+			     float32_t mu,
+			     uint32_t blockSize);
+
+
+  /**
+   * @brief Instance structure for the Q31 normalized LMS filter.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;     /**< number of coefficients in the filter. */
+    q31_t *pState;        /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+    q31_t *pCoeffs;       /**< points to the coefficient array. The array is of length numTaps. */
+    q31_t mu;             /**< step size that controls filter coefficient updates. */
+    uint8_t postShift;    /**< bit shift applied to coefficients. */
+    q31_t *recipTable;    /**< points to the reciprocal initial value table. */
+    q31_t energy;         /**< saves previous frame energy. */
+    q31_t x0;             /**< saves previous input sample. */
+  } arm_lms_norm_instance_q31;
+
+  /**
+   * @brief Processing function for Q31 normalized LMS filter.
+   * @param[in] *S points to an instance of the Q31 normalized LMS filter structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[in] *pRef points to the block of reference data.
+   * @param[out] *pOut points to the block of output data.
+   * @param[out] *pErr points to the block of error data.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_lms_norm_q31(
+			arm_lms_norm_instance_q31 * S,
+			 q31_t * pSrc,
+			 q31_t * pRef,
+			q31_t * pOut,
+			q31_t * pErr,
+			uint32_t blockSize);
+
+  /**
+   * @brief Initialization function for Q31 normalized LMS filter.
+   * @param[in] *S points to an instance of the Q31 normalized LMS filter structure.
+   * @param[in] numTaps  number of filter coefficients.
+   * @param[in] *pCoeffs points to coefficient buffer.
+   * @param[in] *pState points to state buffer.
+   * @param[in] mu step size that controls filter coefficient updates.
+   * @param[in] blockSize number of samples to process.
+   * @param[in] postShift bit shift applied to coefficients.
+   * @return none.
+   */
+
+  void arm_lms_norm_init_q31(
+			     arm_lms_norm_instance_q31 * S,
+			     uint16_t numTaps,
+			     q31_t * pCoeffs,
+			     q31_t * pState,
+			     q31_t mu,
+			     uint32_t blockSize,
+			     uint8_t postShift);
+
+  /**
+   * @brief Instance structure for the Q15 normalized LMS filter.
+   */
+
+  typedef struct
+  {
+    uint16_t numTaps;    /**< Number of coefficients in the filter. */
+    q15_t *pState;        /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+    q15_t *pCoeffs;       /**< points to the coefficient array. The array is of length numTaps. */
+    q15_t mu;            /**< step size that controls filter coefficient updates. */
+    uint8_t postShift;   /**< bit shift applied to coefficients. */
+    q15_t *recipTable;   /**< Points to the reciprocal initial value table. */
+    q15_t energy;        /**< saves previous frame energy. */
+    q15_t x0;            /**< saves previous input sample. */
+  } arm_lms_norm_instance_q15;
+
+  /**
+   * @brief Processing function for Q15 normalized LMS filter.
+   * @param[in] *S points to an instance of the Q15 normalized LMS filter structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[in] *pRef points to the block of reference data.
+   * @param[out] *pOut points to the block of output data.
+   * @param[out] *pErr points to the block of error data.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_lms_norm_q15(
+			arm_lms_norm_instance_q15 * S,
+			 q15_t * pSrc,
+			 q15_t * pRef,
+			q15_t * pOut,
+			q15_t * pErr,
+			uint32_t blockSize);
+
+
+  /**
+   * @brief Initialization function for Q15 normalized LMS filter.
+   * @param[in] *S points to an instance of the Q15 normalized LMS filter structure.
+   * @param[in] numTaps  number of filter coefficients.
+   * @param[in] *pCoeffs points to coefficient buffer.
+   * @param[in] *pState points to state buffer.
+   * @param[in] mu step size that controls filter coefficient updates.
+   * @param[in] blockSize number of samples to process.
+   * @param[in] postShift bit shift applied to coefficients.
+   * @return none.
+   */
+
+  void arm_lms_norm_init_q15(
+			     arm_lms_norm_instance_q15 * S,
+			     uint16_t numTaps,
+			     q15_t * pCoeffs,
+			     q15_t * pState,
+			     q15_t mu,
+			     uint32_t blockSize,
+			     uint8_t postShift);
+
+  /**
+   * @brief Correlation of floating-point sequences.
+   * @param[in] *pSrcA points to the first input sequence.
+   * @param[in] srcALen length of the first input sequence.
+   * @param[in] *pSrcB points to the second input sequence.
+   * @param[in] srcBLen length of the second input sequence.
+   * @param[out] *pDst points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @return none.
+   */
+
+  void arm_correlate_f32(
+			  float32_t * pSrcA,
+			 uint32_t srcALen,
+			  float32_t * pSrcB,
+			 uint32_t srcBLen,
+			 float32_t * pDst);
+
+  /**
+   * @brief Correlation of Q15 sequences.
+   * @param[in] *pSrcA points to the first input sequence.
+   * @param[in] srcALen length of the first input sequence.
+   * @param[in] *pSrcB points to the second input sequence.
+   * @param[in] srcBLen length of the second input sequence.
+   * @param[out] *pDst points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @return none.
+   */
+
+  void arm_correlate_q15(
+			  q15_t * pSrcA,
+			 uint32_t srcALen,
+			  q15_t * pSrcB,
+			 uint32_t srcBLen,
+			 q15_t * pDst);
+
+  /**
+   * @brief Correlation of Q15 sequences (fast version) for Cortex-M3 and Cortex-M4.
+   * @param[in] *pSrcA points to the first input sequence.
+   * @param[in] srcALen length of the first input sequence.
+   * @param[in] *pSrcB points to the second input sequence.
+   * @param[in] srcBLen length of the second input sequence.
+   * @param[out] *pDst points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @return none.
+   */
+
+  void arm_correlate_fast_q15(
+			       q15_t * pSrcA,
+			      uint32_t srcALen,
+			       q15_t * pSrcB,
+			      uint32_t srcBLen,
+			      q15_t * pDst);
+
+  /**
+   * @brief Correlation of Q31 sequences.
+   * @param[in] *pSrcA points to the first input sequence.
+   * @param[in] srcALen length of the first input sequence.
+   * @param[in] *pSrcB points to the second input sequence.
+   * @param[in] srcBLen length of the second input sequence.
+   * @param[out] *pDst points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @return none.
+   */
+
+  void arm_correlate_q31(
+			  q31_t * pSrcA,
+			 uint32_t srcALen,
+			  q31_t * pSrcB,
+			 uint32_t srcBLen,
+			 q31_t * pDst);
+
+  /**
+   * @brief Correlation of Q31 sequences (fast version) for Cortex-M3 and Cortex-M4
+   * @param[in] *pSrcA points to the first input sequence.
+   * @param[in] srcALen length of the first input sequence.
+   * @param[in] *pSrcB points to the second input sequence.
+   * @param[in] srcBLen length of the second input sequence.
+   * @param[out] *pDst points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @return none.
+   */
+
+  void arm_correlate_fast_q31(
+			       q31_t * pSrcA,
+			      uint32_t srcALen,
+			       q31_t * pSrcB,
+			      uint32_t srcBLen,
+			      q31_t * pDst);
+
+  /**
+   * @brief Correlation of Q7 sequences.
+   * @param[in] *pSrcA points to the first input sequence.
+   * @param[in] srcALen length of the first input sequence.
+   * @param[in] *pSrcB points to the second input sequence.
+   * @param[in] srcBLen length of the second input sequence.
+   * @param[out] *pDst points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @return none.
+   */
+
+  void arm_correlate_q7(
+			 q7_t * pSrcA,
+			uint32_t srcALen,
+			 q7_t * pSrcB,
+			uint32_t srcBLen,
+			q7_t * pDst);
+
+  /**
+   * @brief  FFT length the floating-point FFT convolution and correlation use for the given lengths.
+   * @param[in] srcALen length of the first input sequence.
+   * @param[in] srcBLen length of the second input sequence.
+   * @return The function returns the real FFT length, 128, 512 or 2048, or 0 when the direct algorithm is cheaper.
+   */
+
+  uint16_t arm_conv_fft_len_f32(
+			   uint32_t srcALen,
+			   uint32_t srcBLen);
+
+  /**
+   * @brief  FFT length the Q15 FFT convolution and correlation use for the given lengths.
+   * @param[in] srcALen length of the first input sequence.
+   * @param[in] srcBLen length of the second input sequence.
+   * @return The function returns the real FFT length, 128, 512 or 2048, or 0 when the direct algorithm is cheaper.
+   */
+
+  uint16_t arm_conv_fft_len_q15(
+			   uint32_t srcALen,
+			   uint32_t srcBLen);
+
+  /**
+   * @brief Convolution of floating-point sequences with the direct or the FFT algorithm.
+   * @param[in] *pSrcA points to the first input sequence.
+   * @param[in] srcALen length of the first input sequence.
+   * @param[in] *pSrcB points to the second input sequence.
+   * @param[in] srcBLen length of the second input sequence.
+   * @param[out] *pDst points to the block of output data  Length srcALen+srcBLen-1.
+   * @param[in] *pScratch points to a scratch buffer of 4*fftLen+4 values, where fftLen is returned by arm_conv_fft_len_f32().
+   * @return none.
+   */
+
+  void arm_conv_fft_f32(
+			float32_t * pSrcA,
+			uint32_t srcALen,
+			float32_t * pSrcB,
+			uint32_t srcBLen,
+			float32_t * pDst,
+			float32_t * pScratch);
+
+  /**
+   * @brief Convolution of Q15 sequences with the direct or the FFT algorithm.
+   * @param[in] *pSrcA points to the first input sequence.
+   * @param[in] srcALen length of the first input sequence.
+   * @param[in] *pSrcB points to the second input sequence.
+   * @param[in] srcBLen length of the second input sequence.
+   * @param[out] *pDst points to the block of output data  Length srcALen+srcBLen-1.
+   * @param[in] *pScratch points to a scratch buffer of 4*fftLen+4+srcALen+srcBLen-1 values, where fftLen is returned by arm_conv_fft_len_q15().
+   * @return none.
+   */
+
+  void arm_conv_fft_q15(
+			q15_t * pSrcA,
+			uint32_t srcALen,
+			q15_t * pSrcB,
+			uint32_t srcBLen,
+			q15_t * pDst,
+			float32_t * pScratch);
+
+  /**
+   * @brief Correlation of floating-point sequences with the direct or the FFT algorithm.
+   * @param[in] *pSrcA points to the first input sequence.
+   * @param[in] srcALen length of the first input sequence.
+   * @param[in] *pSrcB points to the second input sequence.
+   * @param[in] srcBLen length of the second input sequence.
+   * @param[out] *pDst points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @param[in] *pScratch points to a scratch buffer of 4*fftLen+4 values, where fftLen is returned by arm_conv_fft_len_f32().
+   * @return none.
+   */
+
+  void arm_correlate_fft_f32(
+			     float32_t * pSrcA,
+			     uint32_t srcALen,
+			     float32_t * pSrcB,
+			     uint32_t srcBLen,
+			     float32_t * pDst,
+			     float32_t * pScratch);
+
+  /**
+   * @brief Correlation of Q15 sequences with the direct or the FFT algorithm.
+   * @param[in] *pSrcA points to the first input sequence.
+   * @param[in] srcALen length of the first input sequence.
+   * @param[in] *pSrcB points to the second input sequence.
+   * @param[in] srcBLen length of the second input sequence.
+   * @param[out] *pDst points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @param[in] *pScratch points to a scratch buffer of 4*fftLen+4+srcALen+srcBLen-1 values, where fftLen is returned by arm_conv_fft_len_q15().
+   * @return none.
+   */
+
+  void arm_correlate_fft_q15(
+			     q15_t * pSrcA,
+			     uint32_t srcALen,
+			     q15_t * pSrcB,
+			     uint32_t srcBLen,
+			     q15_t * pDst,
+			     float32_t * pScratch);
+
+  /*----------------------------------------------------------------------
+   *		Internal functions prototypes matrix multiplication
+   ----------------------------------------------------------------------*/
+
+  /**
+   * @brief  Cache blocked core of the floating-point matrix multiplication.
+   * @param[in]      *pA       points to the numRowsA x numColsA values of the first matrix.
+   * @param[in]      *pB       points to the second matrix, in rows or packed by arm_mat_pack_f32().
+   * @param[out]     *pC       points to the numRowsA x numColsB values of the output.
+   * @param[in]      numRowsA  number of rows of the first matrix.
+   * @param[in]      numColsA  number of columns of the first matrix and rows of the second.
+   * @param[in]      numColsB  number of columns of the second matrix.
+   * @param[in]      packedB   set if pB is packed, clear if it is stored in rows.
+   * @return none.
+   */
+
+  void arm_mat_mult_blocked_f32(
+				const float32_t * pA,
+				const float32_t * pB,
+				float32_t * pC,
+				uint32_t numRowsA,
+				uint32_t numColsA,
+				uint32_t numColsB,
+				uint8_t packedB);
+
+  /*----------------------------------------------------------------------
+   *		Internal functions prototypes FFT convolution
+   ----------------------------------------------------------------------*/
+
+  /**
+   * @brief  Core of the floating-point FFT convolution and correlation.
+   * @param[in]      *pSrcA    points to the first input sequence.
+   * @param[in]      srcALen   length of the first input sequence.
+   * @param[in]      *pSrcB    points to the second input sequence.
+   * @param[in]      srcBLen   length of the second input sequence.
+   * @param[in,out]  *pDst     points to the srcALen+srcBLen-1 outputs the convolution is added to.
+   * @param[in]      *pScratch points to a scratch buffer of 4*fftLen+4 values.
+   * @param[in]      fftLen    real FFT length, 128, 512 or 2048.
+   * @param[in]      reverseB  set to convolve with the second sequence reversed in time.
+   * @return none.
+   */
+
+  void arm_conv_fft_core_f32(
+			     float32_t * pSrcA,
+			     uint32_t srcALen,
+			     float32_t * pSrcB,
+			     uint32_t srcBLen,
+			     float32_t * pDst,
+			     float32_t * pScratch,
+			     uint16_t fftLen,
+			     uint8_t reverseB);
+
+  /**
+   * @brief  Core of the Q15 FFT convolution and correlation.
+   * @param[in]      *pSrcA    points to the first input sequence.
+   * @param[in]      srcALen   length of the first input sequence.
+   * @param[in]      *pSrcB    points to the second input sequence.
+   * @param[in]      srcBLen   length of the second input sequence.
+   * @param[in,out]  *pDst     points to the srcALen+srcBLen-1 floating-point outputs the convolution is added to.
+   * @param[in]      *pScratch points to a scratch buffer of 4*fftLen+4 values.
+   * @param[in]      fftLen    real FFT length, 128, 512 or 2048.
+   * @param[in]      reverseB  set to convolve with the second sequence reversed in time.
+   * @return none.
+   */
+
+  void arm_conv_fft_core_q15(
+			     q15_t * pSrcA,
+			     uint32_t srcALen,
+			     q15_t * pSrcB,
+			     uint32_t srcBLen,
+			     float32_t * pDst,
+			     float32_t * pScratch,
+			     uint16_t fftLen,
+			     uint8_t reverseB);
+
+  /**
+   * @brief  Conversion of the floating-point outputs of the Q15 FFT convolution and correlation.
+   * @param[in]  *pSrc     points to the floating-point outputs.
+   * @param[out] *pDst     points to the Q15 outputs.
+   * @param[in]  blockSize number of outputs.
+   * @return none.
+   */
+
+  void arm_conv_fft_to_q15(
+			   float32_t * pSrc,
+			   q15_t * pDst,
+			   uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the floating-point sparse FIR filter.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;             /**< number of coefficients in the filter. */
+    uint16_t stateIndex;          /**< state buffer index.  Points to the oldest sample in the state buffer. */
+    float32_t *pState;            /**< points to the state buffer array. The array is of length maxDelay+blockSize-1. */
+    float32_t *pCoeffs;           /**< points to the coefficient array. The array is of length numTaps.*/
+    uint16_t maxDelay;            /**< maximum offset specified by the pTapDelay array. */
+    int32_t *pTapDelay;           /**< points to the array of delay values.  The array is of length numTaps. */
+  } arm_fir_sparse_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 sparse FIR filter.
+   */
+
+  typedef struct
+  {
+    uint16_t numTaps;             /**< number of coefficients in the filter. */
+    uint16_t stateIndex;          /**< state buffer index.  Points to the oldest sample in the state buffer. */
+    q31_t *pState;                /**< points to the state buffer array. The array is of length maxDelay+blockSize-1. */
+    q31_t *pCoeffs;               /**< points to the coefficient array. The array is of length numTaps.*/
+    uint16_t maxDelay;            /**< maximum offset specified by the pTapDelay array. */
+    int32_t *pTapDelay;           /**< points to the array of delay values.  The array is of length numTaps. */
+  } arm_fir_sparse_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 sparse FIR filter.
+   */
+
+  typedef struct
+  {
+    uint16_t numTaps;             /**< number of coefficients in the filter. */
+    uint16_t stateIndex;          /**< state buffer index.  Points to the oldest sample in the state buffer. */
+    q15_t *pState;                /**< points to the state buffer array. The array is of length maxDelay+blockSize-1. */
+    q15_t *pCoeffs;               /**< points to the coefficient array. The array is of length numTaps.*/
+    uint16_t maxDelay;            /**< maximum offset specified by the pTapDelay array. */
+    int32_t *pTapDelay;           /**< points to the array of delay values.  The array is of length numTaps. */
+  } arm_fir_sparse_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q7 sparse FIR filter.
+   */
+
+  typedef struct
+  {
+    uint16_t numTaps;             /**< number of coefficients in the filter. */
+    uint16_t stateIndex;          /**< state buffer index.  Points to the oldest sample in the state buffer. */
+    q7_t *pState;                 /**< points to the state buffer array. The array is of length maxDelay+blockSize-1. */
+    q7_t *pCoeffs;                /**< points to the coefficient array. The array is of length numTaps.*/
+    uint16_t maxDelay;            /**< maximum offset specified by the pTapDelay array. */
+    int32_t *pTapDelay;           /**< points to the array of delay values.  The array is of length numTaps. */
+  } arm_fir_sparse_instance_q7;
+
+  /**
+   * @brief Processing function for the floating-point sparse FIR filter.
+   * @param[in]  *S          points to an instance of the floating-point sparse FIR structure.
+   * @param[in]  *pSrc       points to the block of input data.
+   * @param[out] *pDst       points to the block of output data
+   * @param[in]  *pScratchIn points to a temporary buffer of size blockSize.
+   * @param[in]  blockSize   number of input samples to process per call.
+   * @return none.
+   */
+
+  void arm_fir_sparse_f32(
+			  arm_fir_sparse_instance_f32 * S,
+			   float32_t * pSrc,
+			  float32_t * pDst,
+			  float32_t * pScratchIn,
+			  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point sparse FIR filter.
+   * @param[in,out] *S         points to an instance of the floating-point sparse FIR structure.
+   * @param[in]     numTaps    number of nonzero coefficients in the filter.
+   * @param[in]     *pCoeffs   points to the array of filter coefficients.
+   * @param[in]     *pState    points to the state buffer.
+   * @param[in]     *pTapDelay points to the array of offset times.
+   * @param[in]     maxDelay   maximum offset time supported.
+   * @param[in]     blockSize  number of samples that will be processed per block.
+   * @return none
+   */
+
+  void arm_fir_sparse_init_f32(
+			       arm_fir_sparse_instance_f32 * S,
+			       uint16_t numTaps,
+			       float32_t * pCoeffs,
+			       float32_t * pState,
+			       int32_t * pTapDelay,
+			       uint16_t maxDelay,
+			       uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the Q31 sparse FIR filter.
+   * @param[in]  *S          points to an instance of the Q31 sparse FIR structure.
+   * @param[in]  *pSrc       points to the block of input data.
+   * @param[out] *pDst       points to the block of output data
+   * @param[in]  *pScratchIn points to a temporary buffer of size blockSize.
+   * @param[in]  blockSize   number of input samples to process per call.
+   * @return none.
+   */
+
+  void arm_fir_sparse_q31(
+			  arm_fir_sparse_instance_q31 * S,
+			   q31_t * pSrc,
+			  q31_t * pDst,
+			  q31_t * pScratchIn,
+			  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 sparse FIR filter.
+   * @param[in,out] *S         points to an instance of the Q31 sparse FIR structure.
+   * @param[in]     numTaps    number of nonzero coefficients in the filter.
+   * @param[in]     *pCoeffs   points to the array of filter coefficients.
+   * @param[in]     *pState    points to the state buffer.
+   * @param[in]     *pTapDelay points to the array of offset times.
+   * @param[in]     maxDelay   maximum offset time supported.
+   * @param[in]     blockSize  number of samples that will be processed per block.
+   * @return none
+   */
+
+  void arm_fir_sparse_init_q31(
+			       arm_fir_sparse_instance_q31 * S,
+			       uint16_t numTaps,
+			       q31_t * pCoeffs,
+			       q31_t * pState,
+			       int32_t * pTapDelay,
+			       uint16_t maxDelay,
+			       uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the Q15 sparse FIR filter.
+   * @param[in]  *S           points to an instance of the Q15 sparse FIR structure.
+   * @param[in]  *pSrc        points to the block of input data.
+   * @param[out] *pDst        points to the block of output data
+   * @param[in]  *pScratchIn  points to a temporary buffer of size blockSize.
+   * @param[in]  *pScratchOut points to a temporary buffer of size blockSize.
+   * @param[in]  blockSize    number of input samples to process per call.
+   * @return none.
+   */
+
+  void arm_fir_sparse_q15(
+			  arm_fir_sparse_instance_q15 * S,
+			   q15_t * pSrc,
+			  q15_t * pDst,
+			  q15_t * pScratchIn,
+			  q31_t * pScratchOut,
+			  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q15 sparse FIR filter.
+   * @param[in,out] *S         points to an instance of the Q15 sparse FIR structure.
+   * @param[in]     numTaps    number of nonzero coefficients in the filter.
+   * @param[in]     *pCoeffs   points to the array of filter coefficients.
+   * @param[in]     *pState    points to the state buffer.
+   * @param[in]     *pTapDelay points to the array of offset times.
+   * @param[in]     maxDelay   maximum offset time supported.
+   * @param[in]     blockSize  number of samples that will be processed per block.
+   * @return none
+   */
+
+  void arm_fir_sparse_init_q15(
+			       arm_fir_sparse_instance_q15 * S,
+			       uint16_t numTaps,
+			       q15_t * pCoeffs,
+			       q15_t * pState,
+			       int32_t * pTapDelay,
+			       uint16_t maxDelay,
+			       uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the Q7 sparse FIR filter.
+   * @param[in]  *S           points to an instance of the Q7 sparse FIR structure.
+   * @param[in]  *pSrc        points to the block of input data.
+   * @param[out] *pDst        points to the block of output data
+   * @param[in]  *pScratchIn  points to a temporary buffer of size blockSize.
+   * @param[in]  *pScratchOut points to a temporary buffer of size blockSize.
+   * @param[in]  blockSize    number of input samples to process per call.
+   * @return none.
+   */
+
+  void arm_fir_sparse_q7(
+			 arm_fir_sparse_instance_q7 * S,
+			  q7_t * pSrc,
+			 q7_t * pDst,
+			 q7_t * pScratchIn,
+			 q31_t * pScratchOut,
+			 uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q7 sparse FIR filter.
+   * @param[in,out] *S         points to an instance of the Q7 sparse FIR structure.
+   * @param[in]     numTaps    number of nonzero coefficients in the filter.
+   * @param[in]     *pCoeffs   points to the array of filter coefficients.
+   * @param[in]     *pState    points to the state buffer.
+   * @param[in]     *pTapDelay points to the array of offset times.
+   * @param[in]     maxDelay   maximum offset time supported.
+   * @param[in]     blockSize  number of samples that will be processed per block.
+   * @return none
+   */
+
+  void arm_fir_sparse_init_q7(
+			      arm_fir_sparse_instance_q7 * S,
+			      uint16_t numTaps,
+			      q7_t * pCoeffs,
+			      q7_t * pState,
+			      int32_t *pTapDelay,
+			      uint16_t maxDelay,
+			      uint32_t blockSize);
+
+
+  /*
+   * @brief  Floating-point sin_cos function.
+   * @param[in]  theta    input value in degrees 
+   * @param[out] *pSinVal points to the processed sine output. 
+   * @param[out] *pCosVal points to the processed cos output. 
+   * @return none.
+   */
+
+  void arm_sin_cos_f32(
+		       float32_t theta,
+		       float32_t *pSinVal,
+		       float32_t *pCcosVal);
+
+  /*
+   * @brief  Q31 sin_cos function.
+   * @param[in]  theta    scaled input value in degrees 
+   * @param[out] *pSinVal points to the processed sine output. 
+   * @param[out] *pCosVal points to the processed cosine output. 
+   * @return none.
+   */
+
+  void arm_sin_cos_q31(
+		       q31_t theta,
+		       q31_t *pSinVal,
+		       q31_t *pCosVal);
+
+
+  /**
+   * @brief  Floating-point complex conjugate.
+   * @param[in]  *pSrc points to the input vector
+   * @param[out]  *pDst points to the output vector
+   * @param[in]  numSamples number of complex samples in each vector
+   * @return none.
+   */
+
+  void arm_cmplx_conj_f32(
+			   float32_t * pSrc,
+			  float32_t * pDst,
+			  uint32_t numSamples);
+
+  /**
+   * @brief  Q31 complex conjugate.
+   * @param[in]  *pSrc points to the input vector
+   * @param[out]  *pDst points to the output vector
+   * @param[in]  numSamples number of complex samples in each vector
+   * @return none.
+   */
+
+  void arm_cmplx_conj_q31(
+			   q31_t * pSrc,
+			  q31_t * pDst,
+			  uint32_t numSamples);
+
+  /**
+   * @brief  Q15 complex conjugate.
+   * @param[in]  *pSrc points to the input vector
+   * @param[out]  *pDst points to the output vector
+   * @param[in]  numSamples number of complex samples in each vector
+   * @return none.
+   */
+
+  void arm_cmplx_conj_q15(
+			   q15_t * pSrc,
+			  q15_t * pDst,
+			  uint32_t numSamples);
+
+
+
+  /**
+   * @brief  Floating-point complex magnitude squared
+   * @param[in]  *pSrc points to the complex input vector
+   * @param[out]  *pDst points to the real output vector
+   * @param[in]  numSamples number of complex samples in the input vector
+   * @return none.
+   */
+
+  void arm_cmplx_mag_squared_f32(
+				  float32_t * pSrc,
+				 float32_t * pDst,
+				 uint32_t numSamples);
+
+  /**
+   * @brief  Q31 complex magnitude squared
+   * @param[in]  *pSrc points to the complex input vector
+   * @param[out]  *pDst points to the real output vector
+   * @param[in]  numSamples number of complex samples in the input vector
+   * @return none.
+   */
+
+  void arm_cmplx_mag_squared_q31(
+				  q31_t * pSrc,
+				 q31_t * pDst,
+				 uint32_t numSamples);
+
+  /**
+   * @brief  Q15 complex magnitude squared
+   * @param[in]  *pSrc points to the complex input vector
+   * @param[out]  *pDst points to the real output vector
+   * @param[in]  numSamples number of complex samples in the input vector
+   * @return none.
+   */
+
+  void arm_cmplx_mag_squared_q15(
+				  q15_t * pSrc,
+				 q15_t * pDst,
+				 uint32_t numSamples);
 
 
  /**
@@ -4639,1887 +6228,3691 @@ extern "C"
    */
 
   /**
-   * @defgroup PID PID Motor Control
-   *
-   * A Proportional Integral Derivative (PID) controller is a generic feedback control 
-   * loop mechanism widely used in industrial control systems.
-   * A PID controller is the most commonly used type of feedback controller.
-   *
-   * This set of functions implements (PID) controllers
-   * for Q15, Q31, and floating-point data types.  The functions operate on a single sample
-   * of data and each call to the function returns a single processed value.
-   * <code>S</code> points to an instance of the PID control data structure.  <code>in</code>
-   * is the input sample value. The functions return the output value.
-   *
-   * \par Algorithm:
-   * <pre>
-   *    y[n] = y[n-1] + A0 * x[n] + A1 * x[n-1] + A2 * x[n-2]
-   *    A0 = Kp + Ki + Kd
-   *    A1 = (-Kp ) - (2 * Kd )
-   *    A2 = Kd  </pre>
+   * @defgroup PID PID Motor Control
+   *
+   * A Proportional Integral Derivative (PID) controller is a generic feedback control 
+   * loop mechanism widely used in industrial control systems.
+   * A PID controller is the most commonly used type of feedback controller.
+   *
+   * This set of functions implements (PID) controllers
+   * for Q15, Q31, and floating-point data types.  The functions operate on a single sample
+   * of data and each call to the function returns a single processed value.
+   * <code>S</code> points to an instance of the PID control data structure.  <code>in</code>
+   * is the input sample value. The functions return the output value.
+   *
+   * \par Algorithm:
+   * <pre>
+   *    y[n] = y[n-1] + A0 * x[n] + A1 * x[n-1] + A2 * x[n-2]
+   *    A0 = Kp + Ki + Kd
+   *    A1 = (-Kp ) - (2 * Kd )
+   *    A2 = Kd  </pre>
+   *
+   * \par
+   * where \c Kp is proportional constant, \c Ki is Integral constant and \c Kd is Derivative constant
+   * 
+   * \par 
+   * \image html PID.gif "Proportional Integral Derivative Controller" 
+   *
+   * \par
+   * The PID controller calculates an "error" value as the difference between
+   * the measured output and the reference input.
+   * The controller attempts to minimize the error by adjusting the process control inputs.  
+   * The proportional value determines the reaction to the current error, 
+   * the integral value determines the reaction based on the sum of recent errors, 
+   * and the derivative value determines the reaction based on the rate at which the error has been changing.
+   *
+   * \par Instance Structure 
+   * The Gains A0, A1, A2 and state variables for a PID controller are stored together in an instance data structure. 
+   * A separate instance structure must be defined for each PID Controller. 
+   * There are separate instance structure declarations for each of the 3 supported data types. 
+   * 
+   * \par Reset Functions 
+   * There is also an associated reset function for each data type which clears the state array. 
+   *
+   * \par Initialization Functions 
+   * There is also an associated initialization function for each data type. 
+   * The initialization function performs the following operations: 
+   * - Initializes the Gains A0, A1, A2 from Kp,Ki, Kd gains.
+   * - Zeros out the values in the state buffer.   
+   * 
+   * \par 
+   * Instance structure cannot be placed into a const data section and it is recommended to use the initialization function. 
+   *
+   * \par Fixed-Point Behavior 
+   * Care must be taken when using the fixed-point versions of the PID Controller functions. 
+   * In particular, the overflow and saturation behavior of the accumulator used in each function must be considered. 
+   * Refer to the function specific documentation below for usage guidelines. 
+   */
+
+  /**
+   * @addtogroup PID
+   * @{
+   */
+
+  /**
+   * @brief  Process function for the floating-point PID Control.
+   * @param[in,out] *S is an instance of the floating-point PID Control structure
+   * @param[in] in input sample to process
+   * @return out processed output sample.
+   */
+
+
+  static __INLINE float32_t arm_pid_f32(
+					arm_pid_instance_f32 * S,
+					float32_t in)
+  {
+    float32_t out;
+
+    /* y[n] = y[n-1] + A0 * x[n] + A1 * x[n-1] + A2 * x[n-2]  */
+    out = (S->A0 * in) +
+      (S->A1 * S->state[0]) + (S->A2 * S->state[1]) + (S->state[2]);
+
+    /* Update state */
+    S->state[1] = S->state[0];
+    S->state[0] = in;
+    S->state[2] = out;
+
+    /* return to application */
+    return (out);
+
+  }
+
+  /**
+   * @brief  Process function for the Q31 PID Control.
+   * @param[in,out] *S points to an instance of the Q31 PID Control structure
+   * @param[in] in input sample to process
+   * @return out processed output sample.
+   *
+   * <b>Scaling and Overflow Behavior:</b> 
+   * \par 
+   * The function is implemented using an internal 64-bit accumulator. 
+   * The accumulator has a 2.62 format and maintains full precision of the intermediate multiplication results but provides only a single guard bit. 
+   * Thus, if the accumulator result overflows it wraps around rather than clip. 
+   * In order to avoid overflows completely the input signal must be scaled down by 2 bits as there are four additions. 
+   * After all multiply-accumulates are performed, the 2.62 accumulator is truncated to 1.32 format and then saturated to 1.31 format. 
+   */
+
+  static __INLINE q31_t arm_pid_q31(
+				    arm_pid_instance_q31 * S,
+				    q31_t in)
+  {
+    q63_t acc;
+	q31_t out;
+
+    /* acc = A0 * x[n]  */
+    acc = (q63_t) S->A0 * in;
+
+    /* acc += A1 * x[n-1] */
+    acc += (q63_t) S->A1 * S->state[0];
+
+    /* acc += A2 * x[n-2]  */
+    acc += (q63_t) S->A2 * S->state[1];
+
+    /* convert output to 1.31 format to add y[n-1] */
+    out = (q31_t) (acc >> 31u);
+
+    /* out += y[n-1] */
+    out += S->state[2];
+
+    /* Update state */
+    S->state[1] = S->state[0];
+    S->state[0] = in;
+    S->state[2] = out;
+
+    /* return to application */
+    return (out);
+
+  }
+
+  /**
+   * @brief  Process function for the Q15 PID Control.
+   * @param[in,out] *S points to an instance of the Q15 PID Control structure
+   * @param[in] in input sample to process
+   * @return out processed output sample.
+   *
+   * <b>Scaling and Overflow Behavior:</b> 
+   * \par 
+   * The function is implemented using a 64-bit internal accumulator. 
+   * Both Gains and state variables are represented in 1.15 format and multiplications yield a 2.30 result. 
+   * The 2.30 intermediate results are accumulated in a 64-bit accumulator in 34.30 format. 
+   * There is no risk of internal overflow with this approach and the full precision of intermediate multiplications is preserved. 
+   * After all additions have been performed, the accumulator is truncated to 34.15 format by discarding low 15 bits. 
+   * Lastly, the accumulator is saturated to yield a result in 1.15 format.
+   */
+
+  static __INLINE q15_t arm_pid_q15(
+				    arm_pid_instance_q15 * S,
+				    q15_t in)
+  {
+    q63_t acc;
+    q15_t out;
+
+    /* Implementation of PID controller */
+
+	#ifdef ARM_MATH_CM0
+
+ 	/* acc = A0 * x[n]  */
+	acc = ((q31_t) S->A0 )* in ;
+
+    #else
+				
+    /* acc = A0 * x[n]  */
+    acc = (q31_t) __SMUAD(S->A0, in);
+	
+	#endif
+
+	#ifdef ARM_MATH_CM0
+						   
+	/* acc += A1 * x[n-1] + A2 * x[n-2]  */
+	acc += (q31_t) S->A1  *  S->state[0] ;
+	acc += (q31_t) S->A2  *  S->state[1] ;
+
+	#else
+
+    /* acc += A1 * x[n-1] + A2 * x[n-2]  */
+    acc = __SMLALD(S->A1, (q31_t)__SIMD32(S->state), acc);
+
+	#endif
+
+    /* acc += y[n-1] */
+    acc += (q31_t) S->state[2] << 15;
+
+    /* saturate the output */
+    out = (q15_t) (__SSAT((acc >> 15), 16));
+
+    /* Update state */
+    S->state[1] = S->state[0];
+    S->state[0] = in;
+    S->state[2] = out;
+
+    /* return to application */
+    return (out);
+
+  }
+  
+  /**
+   * @} end of PID group
+   */
+
+
+  /**
+   * @ingroup groupFilters
+   */
+
+  /**
+   * @addtogroup FIR
+   * @{
+   */
+
+  /**
+   * @brief  Processes one sample through the floating-point FIR filter.
+   * @param[in,out] *S points to an instance of the floating-point FIR filter structure.
+   * @param[in] in input sample to process.
+   * @return out processed output sample.
+   *
+   * \par
+   * For sample by sample processing, for example in an interrupt handler, where a call of
+   * <code>arm_fir_f32()</code> with <code>blockSize = 1</code> would spend more on loop setup
+   * and on the state copy than on the filter.  The new sample is appended to the previous
+   * <code>numTaps-1</code> and every sample moves down the state buffer in the same pass as its
+   * multiply-accumulate.  The state layout is the one
+   * <code>arm_fir_f32()</code> leaves between calls, so both functions can be used on the
+   * same instance.  The sample functions of the other filters below work the same way.
+   */
+
+  static __INLINE float32_t arm_fir_sample_f32(
+					       const arm_fir_instance_f32 * S,
+					       float32_t in)
+  {
+    float32_t *px = S->pState;
+    float32_t *pb = S->pCoeffs;
+    float32_t acc = 0.0f;
+    uint32_t tapCnt = S->numTaps - 1u;
+
+    /* Append the new sample to the previous numTaps - 1 */
+    px[S->numTaps - 1u] = in;
+
+    /* acc += b[numTaps-1-k] * x[n-numTaps+1+k], moving each sample down by one as it is used */
+    while(tapCnt > 0u)
+    {
+      acc += *px * *pb++;
+      *px = px[1];
+      px++;
+
+      tapCnt--;
+    }
+
+    /* acc += b[0] * x[n] */
+    acc += *px * *pb;
+
+    return (acc);
+  }
+
+  /**
+   * @brief  Processes one sample through the Q31 FIR filter.
+   * @param[in,out] *S points to an instance of the Q31 FIR filter structure.
+   * @param[in] in input sample to process.
+   * @return out processed output sample.
+   *
+   * The arithmetic is the one of <code>arm_fir_q31()</code>.
+   */
+
+  static __INLINE q31_t arm_fir_sample_q31(
+					   const arm_fir_instance_q31 * S,
+					   q31_t in)
+  {
+    q31_t *px = S->pState;
+    q31_t *pb = S->pCoeffs;
+    q63_t acc = 0;
+    uint32_t tapCnt = S->numTaps - 1u;
+
+    /* Append the new sample to the previous numTaps - 1 */
+    px[S->numTaps - 1u] = in;
+
+    /* acc += b[numTaps-1-k] * x[n-numTaps+1+k], moving each sample down by one as it is used */
+    while(tapCnt > 0u)
+    {
+      acc += (q63_t) * px * *pb++;
+      *px = px[1];
+      px++;
+
+      tapCnt--;
+    }
+
+    /* acc += b[0] * x[n] */
+    acc += (q63_t) * px * *pb;
+
+    /* The result is in 2.62 format.  Convert to 1.31 */
+    return ((q31_t) (acc >> 31u));
+  }
+
+  /**
+   * @brief  Processes one sample through the Q15 FIR filter.
+   * @param[in,out] *S points to an instance of the Q15 FIR filter structure.
+   * @param[in] in input sample to process.
+   * @return out processed output sample.
+   *
+   * The arithmetic is the one of <code>arm_fir_q15()</code>.
+   */
+
+  static __INLINE q15_t arm_fir_sample_q15(
+					   const arm_fir_instance_q15 * S,
+					   q15_t in)
+  {
+    q15_t *px = S->pState;
+    q15_t *pb = S->pCoeffs;
+    q63_t acc = 0;
+    uint32_t tapCnt = S->numTaps - 1u;
+
+    /* Append the new sample to the previous numTaps - 1 */
+    px[S->numTaps - 1u] = in;
+
+    /* acc += b[numTaps-1-k] * x[n-numTaps+1+k], moving each sample down by one as it is used */
+    while(tapCnt > 0u)
+    {
+      acc += (q31_t) * px * *pb++;
+      *px = px[1];
+      px++;
+
+      tapCnt--;
+    }
+
+    /* acc += b[0] * x[n] */
+    acc += (q31_t) * px * *pb;
+
+    /* The result is in 2.30 format.  Convert to 1.15 with saturation */
+    return ((q15_t) __SSAT((acc >> 15), 16));
+  }
+
+  /**
+   * @} end of FIR group
+   */
+
+  /**
+   * @addtogroup BiquadCascadeDF1
+   * @{
+   */
+
+  /**
+   * @brief  Processes one sample through the floating-point Biquad cascade filter.
+   * @param[in,out] *S points to an instance of the floating-point Biquad cascade structure.
+   * @param[in] in input sample to process.
+   * @return out processed output sample.
+   */
+
+  static __INLINE float32_t arm_biquad_cascade_df1_sample_f32(
+							      const arm_biquad_casd_df1_inst_f32 * S,
+							      float32_t in)
+  {
+    float32_t *pState = S->pState;
+    float32_t *pCoeffs = S->pCoeffs;
+    float32_t acc;
+    uint32_t stage = S->numStages;
+
+    do
+    {
+      /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+      acc = (pCoeffs[0] * in) + (pCoeffs[1] * pState[0]) + (pCoeffs[2] * pState[1]) +
+        (pCoeffs[3] * pState[2]) + (pCoeffs[4] * pState[3]);
+
+      /* Update the state {x[n-1], x[n-2], y[n-1], y[n-2]} of the stage */
+      pState[1] = pState[0];
+      pState[0] = in;
+      pState[3] = pState[2];
+      pState[2] = acc;
+
+      /* The output of the stage is the input of the next one */
+      in = acc;
+
+      pState += 4u;
+      pCoeffs += 5u;
+
+      stage--;
+
+    } while(stage > 0u);
+
+    return (acc);
+  }
+
+  /**
+   * @brief  Processes one sample through the Q31 Biquad cascade filter.
+   * @param[in,out] *S points to an instance of the Q31 Biquad cascade structure.
+   * @param[in] in input sample to process.
+   * @return out processed output sample.
+   *
+   * The arithmetic is the one of <code>arm_biquad_cascade_df1_q31()</code>.
+   */
+
+  static __INLINE q31_t arm_biquad_cascade_df1_sample_q31(
+							  const arm_biquad_casd_df1_inst_q31 * S,
+							  q31_t in)
+  {
+    q31_t *pState = S->pState;
+    q31_t *pCoeffs = S->pCoeffs;
+    q63_t acc;
+    q31_t out;
+    uint32_t shift = 32u - ((uint32_t) S->postShift + 1u);
+    uint32_t stage = S->numStages;
+
+    do
+    {
+      acc = (q63_t) pCoeffs[0] * in;
+      acc += (q63_t) pCoeffs[1] * pState[0];
+      acc += (q63_t) pCoeffs[2] * pState[1];
+      acc += (q63_t) pCoeffs[3] * pState[2];
+      acc += (q63_t) pCoeffs[4] * pState[3];
+
+      /* The result is converted to 1.31 */
+      out = (q31_t) (acc >> shift);
+
+      pState[1] = pState[0];
+      pState[0] = in;
+      pState[3] = pState[2];
+      pState[2] = out;
+
+      in = out;
+
+      pState += 4u;
+      pCoeffs += 5u;
+
+      stage--;
+
+    } while(stage > 0u);
+
+    return (out);
+  }
+
+  /**
+   * @brief  Processes one sample through the Q15 Biquad cascade filter.
+   * @param[in,out] *S points to an instance of the Q15 Biquad cascade structure.
+   * @param[in] in input sample to process.
+   * @return out processed output sample.
+   *
+   * The arithmetic is the one of <code>arm_biquad_cascade_df1_q15()</code>.
+   */
+
+  static __INLINE q15_t arm_biquad_cascade_df1_sample_q15(
+							  const arm_biquad_casd_df1_inst_q15 * S,
+							  q15_t in)
+  {
+    q15_t *pState = S->pState;
+    q15_t *pCoeffs = S->pCoeffs;
+    q63_t acc;
+    q15_t out;
+    int32_t shift = (15 - (int32_t) S->postShift);
+    uint32_t stage = S->numStages;
+
+    do
+    {
+      /* pCoeffs[1] is the zero between b0 and b1 */
+      acc = (q31_t) pCoeffs[0] * in;
+      acc += (q31_t) pCoeffs[2] * pState[0];
+      acc += (q31_t) pCoeffs[3] * pState[1];
+      acc += (q31_t) pCoeffs[4] * pState[2];
+      acc += (q31_t) pCoeffs[5] * pState[3];
+
+      /* The result is converted to 1.15 with saturation */
+      out = (q15_t) __SSAT((acc >> shift), 16);
+
+      pState[1] = pState[0];
+      pState[0] = in;
+      pState[3] = pState[2];
+      pState[2] = out;
+
+      in = out;
+
+      pState += 4u;
+      pCoeffs += 6u;
+
+      stage--;
+
+    } while(stage > 0u);
+
+    return (out);
+  }
+
+  /**
+   * @} end of BiquadCascadeDF1 group
+   */
+
+  /**
+   * @addtogroup BiquadCascadeDF2T
+   * @{
+   */
+
+  /**
+   * @brief  Processes one sample through the floating-point transposed direct form II Biquad cascade filter.
+   * @param[in,out] *S points to an instance of the filter data structure.
+   * @param[in] in input sample to process.
+   * @return out processed output sample.
+   */
+
+  static __INLINE float32_t arm_biquad_cascade_df2T_sample_f32(
+							       const arm_biquad_cascade_df2T_instance_f32 * S,
+							       float32_t in)
+  {
+    float32_t *pState = S->pState;
+    float32_t *pCoeffs = S->pCoeffs;
+    float32_t acc;
+    uint32_t stage = S->numStages;
+
+    do
+    {
+      /* y[n] = b0 * x[n] + d1 */
+      acc = (pCoeffs[0] * in) + pState[0];
+
+      /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+      pState[0] = ((pCoeffs[1] * in) + (pCoeffs[3] * acc)) + pState[1];
+
+      /* d2 = b2 * x[n] + a2 * y[n] */
+      pState[1] = (pCoeffs[2] * in) + (pCoeffs[4] * acc);
+
+      in = acc;
+
+      pState += 2u;
+      pCoeffs += 5u;
+
+      stage--;
+
+    } while(stage > 0u);
+
+    return (acc);
+  }
+
+  /**
+   * @} end of BiquadCascadeDF2T group
+   */
+
+  /**
+   * @addtogroup LMS
+   * @{
+   */
+
+  /**
+   * @brief  Processes one sample through the floating-point LMS filter.
+   * @param[in]  *S points to an instance of the floating-point LMS filter structure.
+   * @param[in]  in input sample to process.
+   * @param[in]  ref reference sample.
+   * @param[out] *pErr points to the error sample.
+   * @return     out processed output sample.
+   *
+   * The arithmetic is the one of <code>arm_lms_f32()</code>.
+   */
+
+  static __INLINE float32_t arm_lms_sample_f32(
+					       const arm_lms_instance_f32 * S,
+					       float32_t in,
+					       float32_t ref,
+					       float32_t * pErr)
+  {
+    float32_t *px = S->pState;
+    float32_t *pb = S->pCoeffs;
+    float32_t acc = 0.0f, w;
+    uint32_t tapCnt = S->numTaps;
+
+    /* Append the new sample to the previous numTaps - 1 */
+    px[S->numTaps - 1u] = in;
+
+    while(tapCnt > 0u)
+    {
+      acc += *px++ * *pb++;
+
+      tapCnt--;
+    }
+
+    /* Compute the error and the weighting factor */
+    *pErr = ref - acc;
+    w = *pErr * S->mu;
+
+    /* Update the coefficients, moving each sample down by one as it is used */
+    px = S->pState;
+    pb = S->pCoeffs;
+    tapCnt = S->numTaps;
+
+    while(tapCnt > 0u)
+    {
+      *pb++ += w * *px;
+
+      if(tapCnt > 1u)
+      {
+        *px = px[1];
+      }
+
+      px++;
+
+      tapCnt--;
+    }
+
+    return (acc);
+  }
+
+  /**
+   * @brief  Processes one sample through the Q31 LMS filter.
+   * @param[in]  *S points to an instance of the Q31 LMS filter structure.
+   * @param[in]  in input sample to process.
+   * @param[in]  ref reference sample.
+   * @param[out] *pErr points to the error sample.
+   * @return     out processed output sample.
+   *
+   * The arithmetic is the one of <code>arm_lms_q31()</code>.
+   */
+
+  static __INLINE q31_t arm_lms_sample_q31(
+					   const arm_lms_instance_q31 * S,
+					   q31_t in,
+					   q31_t ref,
+					   q31_t * pErr)
+  {
+    q31_t *px = S->pState;
+    q31_t *pb = S->pCoeffs;
+    q31_t out, e, alpha, coef;
+    q63_t acc = 0;
+    uint32_t shift = 32u - (S->postShift + 1u);
+    uint32_t tapCnt = S->numTaps;
+
+    px[S->numTaps - 1u] = in;
+
+    while(tapCnt > 0u)
+    {
+      acc += (q63_t) * px++ * *pb++;
+
+      tapCnt--;
+    }
+
+    /* Converting the result to 1.31 format */
+    out = (q31_t) (acc >> shift);
+
+    e = ref - out;
+    *pErr = e;
+
+    alpha = (q31_t) (((q63_t) e * S->mu) >> 31);
+
+    px = S->pState;
+    pb = S->pCoeffs;
+    tapCnt = S->numTaps;
+
+    while(tapCnt > 0u)
+    {
+      /* coef is in 2.30 format */
+      coef = (q31_t) (((q63_t) alpha * *px) >> 32);
+
+#ifndef ARM_MATH_CM0
+
+      *pb = clip_q63_to_q31((q63_t) * pb + (coef << 1u));
+
+#else
+
+      *pb += (coef << 1u);
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+      pb++;
+
+      if(tapCnt > 1u)
+      {
+        *px = px[1];
+      }
+
+      px++;
+
+      tapCnt--;
+    }
+
+    return (out);
+  }
+
+  /**
+   * @brief  Processes one sample through the Q15 LMS filter.
+   * @param[in]  *S points to an instance of the Q15 LMS filter structure.
+   * @param[in]  in input sample to process.
+   * @param[in]  ref reference sample.
+   * @param[out] *pErr points to the error sample.
+   * @return     out processed output sample.
+   *
+   * The arithmetic is the one of <code>arm_lms_q15()</code>.
+   */
+
+  static __INLINE q15_t arm_lms_sample_q15(
+					   const arm_lms_instance_q15 * S,
+					   q15_t in,
+					   q15_t ref,
+					   q15_t * pErr)
+  {
+    q15_t *px = S->pState;
+    q15_t *pb = S->pCoeffs;
+    q15_t out, e, alpha;
+    q63_t acc = 0;
+    uint32_t shift = S->postShift + 1u;
+    uint32_t tapCnt = S->numTaps;
+
+    px[S->numTaps - 1u] = in;
+
+    while(tapCnt > 0u)
+    {
+      acc += (q63_t) ((q31_t) * px++ * *pb++);
+
+      tapCnt--;
+    }
+
+    /* Converting the result to 1.15 format and saturate the output */
+    out = (q15_t) __SSAT((acc >> (16 - shift)), 16);
+
+    e = ref - out;
+    *pErr = e;
+
+    alpha = (q15_t) (((q31_t) e * (S->mu)) >> 15);
+
+    px = S->pState;
+    pb = S->pCoeffs;
+    tapCnt = S->numTaps;
+
+    while(tapCnt > 0u)
+    {
+
+#ifndef ARM_MATH_CM0
+
+      *pb = (q15_t) __SSAT(((q31_t) * pb + (((q31_t) alpha * *px) >> 15)), 16);
+
+#else
+
+      *pb += (q15_t) (((q31_t) alpha * *px) >> 15);
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+      pb++;
+
+      if(tapCnt > 1u)
+      {
+        *px = px[1];
+      }
+
+      px++;
+
+      tapCnt--;
+    }
+
+    return (out);
+  }
+
+  /**
+   * @} end of LMS group
+   */
+
+
+  /**
+   * @brief Floating-point matrix inverse.
+   * @param[in]  *src points to the instance of the input floating-point matrix structure.
+   * @param[out] *dst points to the instance of the output floating-point matrix structure.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If the input matrix is singular (does not have an inverse), then the algorithm terminates and returns error status ARM_MATH_SINGULAR.
+   */
+
+  arm_status arm_mat_inverse_f32(
+				 const arm_matrix_instance_f32 * src,
+				 arm_matrix_instance_f32 * dst);
+
+  /**
+   * @brief Floating-point forward substitution.
+   * @param[in]  *pL points to the lower triangular matrix structure.
+   * @param[in]  *pB points to the right-hand side matrix structure.
+   * @param[out] *pX points to the solution matrix structure, which may be pB.
+   * @param[in]  unitDiagonal set if the diagonal of pL is 1 and not stored.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match,
+   * or ARM_MATH_SINGULAR if a diagonal element is zero.
+   */
+
+  arm_status arm_mat_solve_lower_triangular_f32(
+						const arm_matrix_instance_f32 * pL,
+						const arm_matrix_instance_f32 * pB,
+						arm_matrix_instance_f32 * pX,
+						uint8_t unitDiagonal);
+
+  /**
+   * @brief Floating-point back substitution.
+   * @param[in]  *pU points to the upper triangular matrix structure.
+   * @param[in]  *pB points to the right-hand side matrix structure.
+   * @param[out] *pX points to the solution matrix structure, which may be pB.
+   * @param[in]  unitDiagonal set if the diagonal of pU is 1 and not stored.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match,
+   * or ARM_MATH_SINGULAR if a diagonal element is zero.
+   */
+
+  arm_status arm_mat_solve_upper_triangular_f32(
+						const arm_matrix_instance_f32 * pU,
+						const arm_matrix_instance_f32 * pB,
+						arm_matrix_instance_f32 * pX,
+						uint8_t unitDiagonal);
+
+  /**
+   * @brief Floating-point LU decomposition with partial pivoting, in place.
+   * @param[in,out] *pSrc points to the square matrix structure, overwritten by L and U.
+   * @param[out]    *pPerm points to numRows values, the permutation of the rows.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the matrix is not square,
+   * or ARM_MATH_SINGULAR if the matrix is singular.
+   */
+
+  arm_status arm_mat_lu_f32(
+			    arm_matrix_instance_f32 * pSrc,
+			    uint16_t * pPerm);
+
+  /**
+   * @brief Floating-point linear system solve with the LU factors.
+   * @param[in]  *pLU points to the factors computed by arm_mat_lu_f32().
+   * @param[in]  *pPerm points to the permutation computed by arm_mat_lu_f32().
+   * @param[in]  *pB points to the right-hand side matrix structure.
+   * @param[out] *pX points to the solution matrix structure, distinct from pB.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match,
+   * or ARM_MATH_SINGULAR if U has a zero on its diagonal.
+   */
+
+  arm_status arm_mat_lu_solve_f32(
+				  const arm_matrix_instance_f32 * pLU,
+				  const uint16_t * pPerm,
+				  const arm_matrix_instance_f32 * pB,
+				  arm_matrix_instance_f32 * pX);
+
+  /**
+   * @brief Floating-point LDL' decomposition of a symmetric matrix, in place.
+   * @param[in,out] *pSrc points to the symmetric matrix structure, overwritten by the factors.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the matrix is not square,
+   * or ARM_MATH_SINGULAR if an element of D is zero.
+   */
+
+  arm_status arm_mat_ldlt_f32(
+			      arm_matrix_instance_f32 * pSrc);
+
+  /**
+   * @brief Floating-point linear system solve with the LDL' factors.
+   * @param[in]  *pLDLT points to the factors computed by arm_mat_ldlt_f32().
+   * @param[in]  *pB points to the right-hand side matrix structure.
+   * @param[out] *pX points to the solution matrix structure, which may be pB.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match,
+   * or ARM_MATH_SINGULAR if D has a zero element.
+   */
+
+  arm_status arm_mat_ldlt_solve_f32(
+				    const arm_matrix_instance_f32 * pLDLT,
+				    const arm_matrix_instance_f32 * pB,
+				    arm_matrix_instance_f32 * pX);
+
+  /**
+   * @brief Floating-point Householder QR decomposition, in place.
+   * @param[in,out] *pSrc points to the M x N matrix structure, M >= N, overwritten by the factors.
+   * @param[out]    *pTau points to N values, the scale factors of the reflections.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the matrix has fewer rows than columns.
+   */
+
+  arm_status arm_mat_qr_f32(
+			    arm_matrix_instance_f32 * pSrc,
+			    float32_t * pTau);
+
+  /**
+   * @brief Floating-point least-squares solve with the QR factors.
+   * @param[in]  *pQR points to the M x N factors computed by arm_mat_qr_f32().
+   * @param[in]  *pTau points to the N scale factors computed by arm_mat_qr_f32().
+   * @param[in]  *pB points to the M x P right-hand side matrix structure.
+   * @param[out] *pX points to the N x P solution matrix structure.
+   * @param[in]  *pScratch points to a work buffer of M values.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match,
+   * or ARM_MATH_SINGULAR if R has a zero on its diagonal.
+   */
+
+  arm_status arm_mat_qr_solve_f32(
+				  const arm_matrix_instance_f32 * pQR,
+				  const float32_t * pTau,
+				  const arm_matrix_instance_f32 * pB,
+				  arm_matrix_instance_f32 * pX,
+				  float32_t * pScratch);
+
+  
+ 
+  /**
+   * @ingroup groupController
+   */
+
+
+  /**
+   * @defgroup clarke Vector Clarke Transform
+   * Forward Clarke transform converts the instantaneous stator phases into a two-coordinate time invariant vector.
+   * Generally the Clarke transform uses three-phase currents <code>Ia, Ib and Ic</code> to calculate currents
+   * in the two-phase orthogonal stator axis <code>Ialpha</code> and <code>Ibeta</code>.
+   * When <code>Ialpha</code> is superposed with <code>Ia</code> as shown in the figure below
+   * \image html clarke.gif Stator current space vector and its components in (a,b).
+   * and <code>Ia + Ib + Ic = 0</code>, in this condition <code>Ialpha</code> and <code>Ibeta</code>
+   * can be calculated using only <code>Ia</code> and <code>Ib</code>.
+   *
+   * The function operates on a single sample of data and each call to the function returns the processed output. 
+   * The library provides separate functions for Q31 and floating-point data types.
+   * \par Algorithm
+   * \image html clarkeFormula.gif
+   * where <code>Ia</code> and <code>Ib</code> are the instantaneous stator phases and
+   * <code>pIalpha</code> and <code>pIbeta</code> are the two coordinates of time invariant vector.
+   * \par Fixed-Point Behavior
+   * Care must be taken when using the Q31 version of the Clarke transform.
+   * In particular, the overflow and saturation behavior of the accumulator used must be considered.
+   * Refer to the function specific documentation below for usage guidelines.
+   */
+
+  /**
+   * @addtogroup clarke
+   * @{
+   */
+
+  /**
+   *
+   * @brief  Floating-point Clarke transform
+   * @param[in]       Ia       input three-phase coordinate <code>a</code>
+   * @param[in]       Ib       input three-phase coordinate <code>b</code>
+   * @param[out]      *pIalpha points to output two-phase orthogonal vector axis alpha
+   * @param[out]      *pIbeta  points to output two-phase orthogonal vector axis beta
+   * @return none.
+   */
+
+  static __INLINE void arm_clarke_f32(
+				      float32_t Ia,
+				      float32_t Ib,
+				      float32_t * pIalpha,
+				      float32_t * pIbeta)
+  {
+    /* Calculate pIalpha using the equation, pIalpha = Ia */
+    *pIalpha = Ia;
+
+    /* Calculate pIbeta using the equation, pIbeta = (1/sqrt(3)) * Ia + (2/sqrt(3)) * Ib */
+    *pIbeta = ((float32_t) 0.57735026919 * Ia + (float32_t) 1.15470053838 * Ib);
+
+  }
+
+  /**
+   * @brief  Clarke transform for Q31 version
+   * @param[in]       Ia       input three-phase coordinate <code>a</code>
+   * @param[in]       Ib       input three-phase coordinate <code>b</code>
+   * @param[out]      *pIalpha points to output two-phase orthogonal vector axis alpha
+   * @param[out]      *pIbeta  points to output two-phase orthogonal vector axis beta
+   * @return none.
+   *
+   * <b>Scaling and Overflow Behavior:</b>
+   * \par
+   * The function is implemented using an internal 32-bit accumulator.
+   * The accumulator maintains 1.31 format by truncating lower 31 bits of the intermediate multiplication in 2.62 format.
+   * There is saturation on the addition, hence there is no risk of overflow.
+   */
+
+  static __INLINE void arm_clarke_q31(
+				      q31_t Ia,
+				      q31_t Ib,
+				      q31_t * pIalpha,
+				      q31_t * pIbeta)
+  {
+    q31_t product1, product2;                    /* Temporary variables used to store intermediate results */
+
+    /* Calculating pIalpha from Ia by equation pIalpha = Ia */
+    *pIalpha = Ia;
+
+    /* Intermediate product is calculated by (1/(sqrt(3)) * Ia) */
+    product1 = (q31_t) (((q63_t) Ia * 0x24F34E8B) >> 30);
+
+    /* Intermediate product is calculated by (2/sqrt(3) * Ib) */
+    product2 = (q31_t) (((q63_t) Ib * 0x49E69D16) >> 30);
+
+    /* pIbeta is calculated by adding the intermediate products */
+    *pIbeta = __QADD(product1, product2);
+  }
+
+  /**
+   * @} end of clarke group
+   */
+
+  /**
+   * @brief  Converts the elements of the Q7 vector to Q31 vector.
+   * @param[in]  *pSrc     input pointer
+   * @param[out]  *pDst    output pointer
+   * @param[in]  blockSize number of samples to process
+   * @return none.
+   */
+  void arm_q7_to_q31(
+		     q7_t * pSrc,
+		     q31_t * pDst,
+		     uint32_t blockSize);
+
+
+ 
+
+  /**
+   * @ingroup groupController
+   */
+
+  /**
+   * @defgroup inv_clarke Vector Inverse Clarke Transform
+   * Inverse Clarke transform converts the two-coordinate time invariant vector into instantaneous stator phases.
+   * 
+   * The function operates on a single sample of data and each call to the function returns the processed output. 
+   * The library provides separate functions for Q31 and floating-point data types.
+   * \par Algorithm
+   * \image html clarkeInvFormula.gif
+   * where <code>pIa</code> and <code>pIb</code> are the instantaneous stator phases and
+   * <code>Ialpha</code> and <code>Ibeta</code> are the two coordinates of time invariant vector.
+   * \par Fixed-Point Behavior
+   * Care must be taken when using the Q31 version of the Clarke transform.
+   * In particular, the overflow and saturation behavior of the accumulator used must be considered.
+   * Refer to the function specific documentation below for usage guidelines.
+   */
+
+  /**
+   * @addtogroup inv_clarke
+   * @{
+   */
+
+   /**
+   * @brief  Floating-point Inverse Clarke transform
+   * @param[in]       Ialpha  input two-phase orthogonal vector axis alpha
+   * @param[in]       Ibeta   input two-phase orthogonal vector axis beta
+   * @param[out]      *pIa    points to output three-phase coordinate <code>a</code>
+   * @param[out]      *pIb    points to output three-phase coordinate <code>b</code>
+   * @return none.
+   */
+
+
+  static __INLINE void arm_inv_clarke_f32(
+					  float32_t Ialpha,
+					  float32_t Ibeta,
+					  float32_t * pIa,
+					  float32_t * pIb)
+  {
+    /* Calculating pIa from Ialpha by equation pIa = Ialpha */
+    *pIa = Ialpha;
+
+    /* Calculating pIb from Ialpha and Ibeta by equation pIb = -(1/2) * Ialpha + (sqrt(3)/2) * Ibeta */
+    *pIb = -0.5 * Ialpha + (float32_t) 0.8660254039 *Ibeta;
+
+  }
+
+  /**
+   * @brief  Inverse Clarke transform for Q31 version 
+   * @param[in]       Ialpha  input two-phase orthogonal vector axis alpha
+   * @param[in]       Ibeta   input two-phase orthogonal vector axis beta
+   * @param[out]      *pIa    points to output three-phase coordinate <code>a</code>
+   * @param[out]      *pIb    points to output three-phase coordinate <code>b</code>
+   * @return none.
+   *
+   * <b>Scaling and Overflow Behavior:</b>
+   * \par
+   * The function is implemented using an internal 32-bit accumulator.
+   * The accumulator maintains 1.31 format by truncating lower 31 bits of the intermediate multiplication in 2.62 format.
+   * There is saturation on the subtraction, hence there is no risk of overflow.
+   */
+
+  static __INLINE void arm_inv_clarke_q31(
+					  q31_t Ialpha,
+					  q31_t Ibeta,
+					  q31_t * pIa,
+					  q31_t * pIb)
+  {
+    q31_t product1, product2;                    /* Temporary variables used to store intermediate results */
+
+    /* Calculating pIa from Ialpha by equation pIa = Ialpha */
+    *pIa = Ialpha;
+
+    /* Intermediate product is calculated by (1/(2*sqrt(3)) * Ia) */
+    product1 = (q31_t) (((q63_t) (Ialpha) * (0x40000000)) >> 31);
+
+    /* Intermediate product is calculated by (1/sqrt(3) * pIb) */
+    product2 = (q31_t) (((q63_t) (Ibeta) * (0x6ED9EBA1)) >> 31);
+
+    /* pIb is calculated by subtracting the products */
+    *pIb = __QSUB(product2, product1);
+
+  }
+
+  /**
+   * @} end of inv_clarke group
+   */
+
+  /**
+   * @brief  Converts the elements of the Q7 vector to Q15 vector.
+   * @param[in]  *pSrc     input pointer
+   * @param[out] *pDst     output pointer
+   * @param[in]  blockSize number of samples to process
+   * @return none.
+   */
+  void arm_q7_to_q15(
+		      q7_t * pSrc,
+		     q15_t * pDst,
+		     uint32_t blockSize);
+
+  
+
+  /**
+   * @ingroup groupController
+   */
+
+  /**
+   * @defgroup park Vector Park Transform
+   *
+   * Forward Park transform converts the input two-coordinate vector to flux and torque components.
+   * The Park transform can be used to realize the transformation of the <code>Ialpha</code> and the <code>Ibeta</code> currents 
+   * from the stationary to the moving reference frame and control the spatial relationship between 
+   * the stator vector current and rotor flux vector.
+   * If we consider the d axis aligned with the rotor flux, the diagram below shows the 
+   * current vector and the relationship from the two reference frames:
+   * \image html park.gif "Stator current space vector and its component in (a,b) and in the d,q rotating reference frame"
+   *
+   * The function operates on a single sample of data and each call to the function returns the processed output. 
+   * The library provides separate functions for Q31 and floating-point data types.
+   * \par Algorithm
+   * \image html parkFormula.gif
+   * where <code>Ialpha</code> and <code>Ibeta</code> are the stator vector components,  
+   * <code>pId</code> and <code>pIq</code> are rotor vector components and <code>cosVal</code> and <code>sinVal</code> are the 
+   * cosine and sine values of theta (rotor flux position).
+   * \par Fixed-Point Behavior
+   * Care must be taken when using the Q31 version of the Park transform.
+   * In particular, the overflow and saturation behavior of the accumulator used must be considered.
+   * Refer to the function specific documentation below for usage guidelines.
+   */
+
+  /**
+   * @addtogroup park
+   * @{
+   */
+
+  /**
+   * @brief Floating-point Park transform
+   * @param[in]       Ialpha input two-phase vector coordinate alpha
+   * @param[in]       Ibeta  input two-phase vector coordinate beta
+   * @param[out]      *pId   points to output	rotor reference frame d
+   * @param[out]      *pIq   points to output	rotor reference frame q
+   * @param[in]       sinVal sine value of rotation angle theta
+   * @param[in]       cosVal cosine value of rotation angle theta
+   * @return none.
+   *
+   * The function implements the forward Park transform.
+   *
+   */
+
+  static __INLINE void arm_park_f32(
+				    float32_t Ialpha,
+				    float32_t Ibeta,
+				    float32_t * pId,
+				    float32_t * pIq,
+				    float32_t sinVal,
+				    float32_t cosVal)
+  {
+    /* Calculate pId using the equation, pId = Ialpha * cosVal + Ibeta * sinVal */
+    *pId = Ialpha * cosVal + Ibeta * sinVal;
+
+    /* Calculate pIq using the equation, pIq = - Ialpha * sinVal + Ibeta * cosVal */
+    *pIq = -Ialpha * sinVal + Ibeta * cosVal;
+
+  }
+
+  /**
+   * @brief  Park transform for Q31 version 
+   * @param[in]       Ialpha input two-phase vector coordinate alpha
+   * @param[in]       Ibeta  input two-phase vector coordinate beta
+   * @param[out]      *pId   points to output rotor reference frame d
+   * @param[out]      *pIq   points to output rotor reference frame q
+   * @param[in]       sinVal sine value of rotation angle theta
+   * @param[in]       cosVal cosine value of rotation angle theta
+   * @return none.
    *
+   * <b>Scaling and Overflow Behavior:</b>
    * \par
-   * where \c Kp is proportional constant, \c Ki is Integral constant and \c Kd is Derivative constant
-   * 
-   * \par 
-   * \image html PID.gif "Proportional Integral Derivative Controller" 
+   * The function is implemented using an internal 32-bit accumulator.
+   * The accumulator maintains 1.31 format by truncating lower 31 bits of the intermediate multiplication in 2.62 format.
+   * There is saturation on the addition and subtraction, hence there is no risk of overflow.
+   */
+
+
+  static __INLINE void arm_park_q31(
+				    q31_t Ialpha,
+				    q31_t Ibeta,
+				    q31_t * pId,
+				    q31_t * pIq,
+				    q31_t sinVal,
+				    q31_t cosVal)
+  {
+    q31_t product1, product2;                    /* Temporary variables used to store intermediate results */
+    q31_t product3, product4;                    /* Temporary variables used to store intermediate results */
+
+    /* Intermediate product is calculated by (Ialpha * cosVal) */
+    product1 = (q31_t) (((q63_t) (Ialpha) * (cosVal)) >> 31);
+
+    /* Intermediate product is calculated by (Ibeta * sinVal) */
+    product2 = (q31_t) (((q63_t) (Ibeta) * (sinVal)) >> 31);
+
+
+    /* Intermediate product is calculated by (Ialpha * sinVal) */
+    product3 = (q31_t) (((q63_t) (Ialpha) * (sinVal)) >> 31);
+
+    /* Intermediate product is calculated by (Ibeta * cosVal) */
+    product4 = (q31_t) (((q63_t) (Ibeta) * (cosVal)) >> 31);
+
+    /* Calculate pId by adding the two intermediate products 1 and 2 */
+    *pId = __QADD(product1, product2);
+
+    /* Calculate pIq by subtracting the two intermediate products 3 from 4 */
+    *pIq = __QSUB(product4, product3);
+  }
+
+  /**
+   * @} end of park group
+   */
+
+  /**
+   * @brief  Converts the elements of the Q7 vector to floating-point vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[out]  *pDst is output pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @return none.
+   */
+  void arm_q7_to_float(
+		        q7_t * pSrc,
+		       float32_t * pDst,
+		       uint32_t blockSize);
+
+ 
+  /**
+   * @ingroup groupController
+   */
+
+  /**
+   * @defgroup inv_park Vector Inverse Park transform
+   * Inverse Park transform converts the input flux and torque components to two-coordinate vector.
    *
-   * \par
-   * The PID controller calculates an "error" value as the difference between
-   * the measured output and the reference input.
-   * The controller attempts to minimize the error by adjusting the process control inputs.  
-   * The proportional value determines the reaction to the current error, 
-   * the integral value determines the reaction based on the sum of recent errors, 
-   * and the derivative value determines the reaction based on the rate at which the error has been changing.
+   * The function operates on a single sample of data and each call to the function returns the processed output. 
+   * The library provides separate functions for Q31 and floating-point data types.
+   * \par Algorithm
+   * \image html parkInvFormula.gif
+   * where <code>pIalpha</code> and <code>pIbeta</code> are the stator vector components,  
+   * <code>Id</code> and <code>Iq</code> are rotor vector components and <code>cosVal</code> and <code>sinVal</code> are the 
+   * cosine and sine values of theta (rotor flux position).
+   * \par Fixed-Point Behavior
+   * Care must be taken when using the Q31 version of the Park transform.
+   * In particular, the overflow and saturation behavior of the accumulator used must be considered.
+   * Refer to the function specific documentation below for usage guidelines.
+   */
+
+  /**
+   * @addtogroup inv_park
+   * @{
+   */
+
+   /**
+   * @brief  Floating-point Inverse Park transform
+   * @param[in]       Id        input coordinate of rotor reference frame d
+   * @param[in]       Iq        input coordinate of rotor reference frame q
+   * @param[out]      *pIalpha  points to output two-phase orthogonal vector axis alpha
+   * @param[out]      *pIbeta   points to output two-phase orthogonal vector axis beta
+   * @param[in]       sinVal    sine value of rotation angle theta
+   * @param[in]       cosVal    cosine value of rotation angle theta
+   * @return none.
+   */
+
+  static __INLINE void arm_inv_park_f32(
+					float32_t Id,
+					float32_t Iq,
+					float32_t * pIalpha,
+					float32_t * pIbeta,
+					float32_t sinVal,
+					float32_t cosVal)
+  {
+    /* Calculate pIalpha using the equation, pIalpha = Id * cosVal - Iq * sinVal */
+    *pIalpha = Id * cosVal - Iq * sinVal;
+
+    /* Calculate pIbeta using the equation, pIbeta = Id * sinVal + Iq * cosVal */
+    *pIbeta = Id * sinVal + Iq * cosVal;
+
+  }
+
+
+  /**
+   * @brief  Inverse Park transform for	Q31 version 
+   * @param[in]       Id        input coordinate of rotor reference frame d
+   * @param[in]       Iq        input coordinate of rotor reference frame q
+   * @param[out]      *pIalpha  points to output two-phase orthogonal vector axis alpha
+   * @param[out]      *pIbeta   points to output two-phase orthogonal vector axis beta
+   * @param[in]       sinVal    sine value of rotation angle theta
+   * @param[in]       cosVal    cosine value of rotation angle theta
+   * @return none.
    *
-   * \par Instance Structure 
-   * The Gains A0, A1, A2 and state variables for a PID controller are stored together in an instance data structure. 
-   * A separate instance structure must be defined for each PID Controller. 
-   * There are separate instance structure declarations for each of the 3 supported data types. 
-   * 
-   * \par Reset Functions 
-   * There is also an associated reset function for each data type which clears the state array. 
+   * <b>Scaling and Overflow Behavior:</b>
+   * \par
+   * The function is implemented using an internal 32-bit accumulator.
+   * The accumulator maintains 1.31 format by truncating lower 31 bits of the intermediate multiplication in 2.62 format.
+   * There is saturation on the addition, hence there is no risk of overflow.
+   */
+
+
+  static __INLINE void arm_inv_park_q31(
+					q31_t Id,
+					q31_t Iq,
+					q31_t * pIalpha,
+					q31_t * pIbeta,
+					q31_t sinVal,
+					q31_t cosVal)
+  {
+    q31_t product1, product2;                    /* Temporary variables used to store intermediate results */
+    q31_t product3, product4;                    /* Temporary variables used to store intermediate results */
+
+    /* Intermediate product is calculated by (Id * cosVal) */
+    product1 = (q31_t) (((q63_t) (Id) * (cosVal)) >> 31);
+
+    /* Intermediate product is calculated by (Iq * sinVal) */
+    product2 = (q31_t) (((q63_t) (Iq) * (sinVal)) >> 31);
+
+
+    /* Intermediate product is calculated by (Id * sinVal) */
+    product3 = (q31_t) (((q63_t) (Id) * (sinVal)) >> 31);
+
+    /* Intermediate product is calculated by (Iq * cosVal) */
+    product4 = (q31_t) (((q63_t) (Iq) * (cosVal)) >> 31);
+
+    /* Calculate pIalpha by using the two intermediate products 1 and 2 */
+    *pIalpha = __QSUB(product1, product2);
+
+    /* Calculate pIbeta by using the two intermediate products 3 and 4 */
+    *pIbeta = __QADD(product4, product3);
+
+  }
+
+  /**
+   * @} end of Inverse park group
+   */
+
+   
+  /**
+   * @brief  Converts the elements of the Q31 vector to floating-point vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[out]  *pDst is output pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @return none.
+   */
+  void arm_q31_to_float(
+			 q31_t * pSrc,
+			float32_t * pDst,
+			uint32_t blockSize);
+
+  /**
+   * @ingroup groupInterpolation
+   */
+
+  /**
+   * @defgroup LinearInterpolate Linear Interpolation
+   *
+   * Linear interpolation is a method of curve fitting using linear polynomials.
+   * Linear interpolation works by effectively drawing a straight line between two neighboring samples and returning the appropriate point along that line
    *
-   * \par Initialization Functions 
-   * There is also an associated initialization function for each data type. 
-   * The initialization function performs the following operations: 
-   * - Initializes the Gains A0, A1, A2 from Kp,Ki, Kd gains.
-   * - Zeros out the values in the state buffer.   
-   * 
    * \par 
-   * Instance structure cannot be placed into a const data section and it is recommended to use the initialization function. 
+   * \image html LinearInterp.gif "Linear interpolation"
    *
-   * \par Fixed-Point Behavior 
-   * Care must be taken when using the fixed-point versions of the PID Controller functions. 
-   * In particular, the overflow and saturation behavior of the accumulator used in each function must be considered. 
-   * Refer to the function specific documentation below for usage guidelines. 
+   * \par
+   * A  Linear Interpolate function calculates an output value(y), for the input(x)
+   * using linear interpolation of the input values x0, x1( nearest input values) and the output values y0 and y1(nearest output values)
+   *
+   * \par Algorithm:
+   * <pre>
+   *       y = y0 + (x - x0) * ((y1 - y0)/(x1-x0))
+   *       where x0, x1 are nearest values of input x
+   *             y0, y1 are nearest values to output y
+   * </pre>
+   *
+   * \par
+   * This set of functions implements Linear interpolation process
+   * for Q7, Q15, Q31, and floating-point data types.  The functions operate on a single
+   * sample of data and each call to the function returns a single processed value.
+   * <code>S</code> points to an instance of the Linear Interpolate function data structure.
+   * <code>x</code> is the input sample value. The functions returns the output value.
+   * 
+   * \par
+   * if x is outside of the table boundary, Linear interpolation returns first value of the table 
+   * if x is below input range and returns last value of table if x is above range.  
    */
 
   /**
-   * @addtogroup PID
+   * @addtogroup LinearInterpolate
    * @{
    */
 
   /**
-   * @brief  Process function for the floating-point PID Control.
-   * @param[in,out] *S is an instance of the floating-point PID Control structure
-   * @param[in] in input sample to process
-   * @return out processed output sample.
+   * @brief  Process function for the floating-point Linear Interpolation Function.
+   * @param[in,out] *S is an instance of the floating-point Linear Interpolation structure
+   * @param[in] x input sample to process
+   * @return y processed output sample.
+   *
    */
 
+  static __INLINE float32_t arm_linear_interp_f32(
+						  arm_linear_interp_instance_f32 * S,
+						  float32_t x)
+  {
 
-  static __INLINE float32_t arm_pid_f32(
-					arm_pid_instance_f32 * S,
-					float32_t in)
+	  float32_t y;
+	  float32_t x0, x1;						/* Nearest input values */
+	  float32_t y0, y1;	  					/* Nearest output values */
+	  float32_t xSpacing = S->xSpacing;		/* spacing between input values */
+	  int32_t i;  							/* Index variable */
+	  float32_t *pYData = S->pYData;	    /* pointer to output table */
+
+	  /* Calculation of index */
+	  i =   (x - S->x1) / xSpacing;
+
+	  if(i < 0)
+	  {
+	     /* Iniatilize output for below specified range as least output value of table */
+		 y = pYData[0];
+	  }
+	  else if(i >= S->nValues)
+	  {
+	  	  /* Iniatilize output for above specified range as last output value of table */
+	  	  y = pYData[S->nValues-1];	
+	  }
+	  else
+	  {	 
+	  	  /* Calculation of nearest input values */
+		  x0 = S->x1 + i * xSpacing;
+		  x1 = S->x1 + (i +1) * xSpacing;
+		 
+		 /* Read of nearest output values */
+		  y0 = pYData[i];
+		  y1 = pYData[i + 1];
+		
+		  /* Calculation of output */
+		  y = y0 + (x - x0) * ((y1 - y0)/(x1-x0));	
+		
+	  }
+
+      /* returns output value */
+	  return (y);
+  }
+
+   /**
+   *
+   * @brief  Process function for the Q31 Linear Interpolation Function.
+   * @param[in] *pYData  pointer to Q31 Linear Interpolation table
+   * @param[in] x input sample to process
+   * @param[in] nValues number of table values
+   * @return y processed output sample.
+   *
+   * \par
+   * Input sample <code>x</code> is in 12.20 format which contains 12 bits for table index and 20 bits for fractional part.
+   * This function can support maximum of table size 2^12.
+   *
+   */
+
+
+  static __INLINE q31_t arm_linear_interp_q31(q31_t *pYData,
+					      q31_t x, uint32_t nValues)
   {
-    float32_t out;
+    q31_t y;                                   /* output */
+    q31_t y0, y1;                                /* Nearest output values */
+    q31_t fract;                                 /* fractional part */
+    int32_t index;                              /* Index to read nearest output values */
+    
+    /* Input is in 12.20 format */
+    /* 12 bits for the table index */
+    /* Index value calculation */
+    index = ((x & 0xFFF00000) >> 20);
 
-    /* y[n] = y[n-1] + A0 * x[n] + A1 * x[n-1] + A2 * x[n-2]  */
-    out = (S->A0 * in) +
-      (S->A1 * S->state[0]) + (S->A2 * S->state[1]) + (S->state[2]);
+	if(index >= (nValues - 1))
+	{
+		return(pYData[nValues - 1]);
+	}
+	else if(index < 0)
+	{
+		return(pYData[0]);
+	}
+	else
+	{
 
-    /* Update state */
-    S->state[1] = S->state[0];
-    S->state[0] = in;
-    S->state[2] = out;
+	    /* 20 bits for the fractional part */
+	    /* shift left by 11 to keep fract in 1.31 format */
+	    fract = (x & 0x000FFFFF) << 11;
+	
+	    /* Read two nearest output values from the index in 1.31(q31) format */
+	    y0 = pYData[index];
+	    y1 = pYData[index + 1u];
+	
+	    /* Calculation of y0 * (1-fract) and y is in 2.30 format */
+	    y = ((q31_t) ((q63_t) y0 * (0x7FFFFFFF - fract) >> 32));
+	
+	    /* Calculation of y0 * (1-fract) + y1 *fract and y is in 2.30 format */
+	    y += ((q31_t) (((q63_t) y1 * fract) >> 32));
+	
+	    /* Convert y to 1.31 format */
+	    return (y << 1u);
 
-    /* return to application */
-    return (out);
+	}
 
   }
 
   /**
-   * @brief  Process function for the Q31 PID Control.
-   * @param[in,out] *S points to an instance of the Q31 PID Control structure
-   * @param[in] in input sample to process
-   * @return out processed output sample.
    *
-   * <b>Scaling and Overflow Behavior:</b> 
-   * \par 
-   * The function is implemented using an internal 64-bit accumulator. 
-   * The accumulator has a 2.62 format and maintains full precision of the intermediate multiplication results but provides only a single guard bit. 
-   * Thus, if the accumulator result overflows it wraps around rather than clip. 
-   * In order to avoid overflows completely the input signal must be scaled down by 2 bits as there are four additions. 
-   * After all multiply-accumulates are performed, the 2.62 accumulator is truncated to 1.32 format and then saturated to 1.31 format. 
+   * @brief  Process function for the Q15 Linear Interpolation Function.
+   * @param[in] *pYData  pointer to Q15 Linear Interpolation table
+   * @param[in] x input sample to process
+   * @param[in] nValues number of table values
+   * @return y processed output sample.
+   *
+   * \par
+   * Input sample <code>x</code> is in 12.20 format which contains 12 bits for table index and 20 bits for fractional part.
+   * This function can support maximum of table size 2^12. 
+   *
    */
 
-  static __INLINE q31_t arm_pid_q31(
-				    arm_pid_instance_q31 * S,
-				    q31_t in)
+
+  static __INLINE q15_t arm_linear_interp_q15(q15_t *pYData, q31_t x, uint32_t nValues)
   {
-    q63_t acc;
-	q31_t out;
+    q63_t y;                                   /* output */
+    q15_t y0, y1;                              /* Nearest output values */
+    q31_t fract;                               /* fractional part */
+    int32_t index;                            /* Index to read nearest output values */ 
 
-    /* acc = A0 * x[n]  */
-    acc = (q63_t) S->A0 * in;
+    /* Input is in 12.20 format */
+    /* 12 bits for the table index */
+    /* Index value calculation */
+    index = ((x & 0xFFF00000) >> 20u); 
 
-    /* acc += A1 * x[n-1] */
-    acc += (q63_t) S->A1 * S->state[0];
+	if(index >= (nValues - 1))
+	{
+		return(pYData[nValues - 1]);
+	}
+	else if(index < 0)
+	{
+		return(pYData[0]);
+	}
+	else
+	{	
+	    /* 20 bits for the fractional part */
+	    /* fract is in 12.20 format */
+	    fract = (x & 0x000FFFFF);
+	
+	    /* Read two nearest output values from the index */
+	    y0 = pYData[index];
+	    y1 = pYData[index + 1u];
+	
+	    /* Calculation of y0 * (1-fract) and y is in 13.35 format */
+	    y = ((q63_t) y0 * (0xFFFFF - fract));
+	
+	    /* Calculation of (y0 * (1-fract) + y1 * fract) and y is in 13.35 format */
+	    y += ((q63_t) y1 * (fract));
+	
+	    /* convert y to 1.15 format */
+	    return (y >> 20);
+	}
 
-    /* acc += A2 * x[n-2]  */
-    acc += (q63_t) S->A2 * S->state[1];
 
-    /* convert output to 1.31 format to add y[n-1] */
-    out = (q31_t) (acc >> 31u);
+  }
 
-    /* out += y[n-1] */
-    out += S->state[2];
+  /**
+   *
+   * @brief  Process function for the Q7 Linear Interpolation Function.
+   * @param[in] *pYData  pointer to Q7 Linear Interpolation table
+   * @param[in] x input sample to process
+   * @param[in] nValues number of table values
+   * @return y processed output sample.
+   *
+   * \par
+   * Input sample <code>x</code> is in 12.20 format which contains 12 bits for table index and 20 bits for fractional part.
+   * This function can support maximum of table size 2^12.
+   */
+
+
+  static __INLINE q7_t arm_linear_interp_q7(q7_t *pYData, q31_t x,  uint32_t nValues)
+  {
+    q31_t y;                                   /* output */
+    q7_t y0, y1;                                 /* Nearest output values */
+    q31_t fract;                                 /* fractional part */
+    int32_t index;                              /* Index to read nearest output values */
+    
+    /* Input is in 12.20 format */
+    /* 12 bits for the table index */
+    /* Index value calculation */
+    index = ((x & 0xFFF00000) >> 20u);
+
+
+    if(index >= (nValues - 1))
+	{
+		return(pYData[nValues - 1]);
+	}
+	else if(index < 0)
+	{
+		return(pYData[0]);
+	}
+	else
+	{
 
-    /* Update state */
-    S->state[1] = S->state[0];
-    S->state[0] = in;
-    S->state[2] = out;
+	    /* 20 bits for the fractional part */
+	    /* fract is in 12.20 format */
+	    fract = (x & 0x000FFFFF);
+	
+	    /* Read two nearest output values from the index and are in 1.7(q7) format */
+	    y0 = pYData[index];
+	    y1 = pYData[index + 1u];
+	
+	    /* Calculation of y0 * (1-fract ) and y is in 13.27(q27) format */
+	    y = ((y0 * (0xFFFFF - fract)));
+	
+	    /* Calculation of y1 * fract + y0 * (1-fract) and y is in 13.27(q27) format */
+	    y += (y1 * fract);
+	
+	    /* convert y to 1.7(q7) format */
+	    return (y >> 20u);
 
-    /* return to application */
-    return (out);
+	}
 
   }
-
   /**
-   * @brief  Process function for the Q15 PID Control.
-   * @param[in,out] *S points to an instance of the Q15 PID Control structure
-   * @param[in] in input sample to process
-   * @return out processed output sample.
-   *
-   * <b>Scaling and Overflow Behavior:</b> 
-   * \par 
-   * The function is implemented using a 64-bit internal accumulator. 
-   * Both Gains and state variables are represented in 1.15 format and multiplications yield a 2.30 result. 
-   * The 2.30 intermediate results are accumulated in a 64-bit accumulator in 34.30 format. 
-   * There is no risk of internal overflow with this approach and the full precision of intermediate multiplications is preserved. 
-   * After all additions have been performed, the accumulator is truncated to 34.15 format by discarding low 15 bits. 
-   * Lastly, the accumulator is saturated to yield a result in 1.15 format.
+   * @} end of LinearInterpolate group
    */
 
-  static __INLINE q15_t arm_pid_q15(
-				    arm_pid_instance_q15 * S,
-				    q15_t in)
-  {
-    q63_t acc;
-    q15_t out;
-
-    /* Implementation of PID controller */
+  /**
+   * @brief  Fast approximation to the trigonometric sine function for floating-point data.
+   * @param[in] x input value in radians.
+   * @return  sin(x).
+   */
 
-	#ifdef ARM_MATH_CM0
+  float32_t arm_sin_f32(
+			 float32_t x);
 
- 	/* acc = A0 * x[n]  */
-	acc = ((q31_t) S->A0 )* in ;
+  /**
+   * @brief  Fast approximation to the trigonometric sine function for Q31 data.
+   * @param[in] x Scaled input value in radians.
+   * @return  sin(x).
+   */
 
-    #else
-				
-    /* acc = A0 * x[n]  */
-    acc = (q31_t) __SMUAD(S->A0, in);
-	
-	#endif
+  q31_t arm_sin_q31(
+		     q31_t x);
 
-	#ifdef ARM_MATH_CM0
-						   
-	/* acc += A1 * x[n-1] + A2 * x[n-2]  */
-	acc += (q31_t) S->A1  *  S->state[0] ;
-	acc += (q31_t) S->A2  *  S->state[1] ;
+  /**
+   * @brief  Fast approximation to the trigonometric sine function for Q15 data.
+   * @param[in] x Scaled input value in radians.
+   * @return  sin(x).
+   */
 
-	#else
+  q15_t arm_sin_q15(
+		     q15_t x);
 
-    /* acc += A1 * x[n-1] + A2 * x[n-2]  */
-    acc = __SMLALD(S->A1, (q31_t)__SIMD32(S->state), acc);
+  /**
+   * @brief  Fast approximation to the trigonometric cosine function for floating-point data.
+   * @param[in] x input value in radians.
+   * @return  cos(x).
+   */
 
-	#endif
+  float32_t arm_cos_f32(
+			 float32_t x);
 
-    /* acc += y[n-1] */
-    acc += (q31_t) S->state[2] << 15;
+  /**
+   * @brief Fast approximation to the trigonometric cosine function for Q31 data.
+   * @param[in] x Scaled input value in radians.
+   * @return  cos(x).
+   */
 
-    /* saturate the output */
-    out = (q15_t) (__SSAT((acc >> 15), 16));
+  q31_t arm_cos_q31(
+		     q31_t x);
 
-    /* Update state */
-    S->state[1] = S->state[0];
-    S->state[0] = in;
-    S->state[2] = out;
+  /**
+   * @brief  Fast approximation to the trigonometric cosine function for Q15 data.
+   * @param[in] x Scaled input value in radians.
+   * @return  cos(x).
+   */
 
-    /* return to application */
-    return (out);
+  q15_t arm_cos_q15(
+		     q15_t x);
 
-  }
-  
   /**
-   * @} end of PID group
+   * @brief  Fast approximation to the trigonometric sine function for a block of floating-point data.
+   * @param[in]  *pSrc points to the input values in radians.
+   * @param[out] *pDst points to the output values.
+   * @param[in]  blockSize number of values to compute.
+   * @return none.
    */
 
+  void arm_sin_block_f32(
+		   float32_t * pSrc,
+		   float32_t * pDst,
+		   uint32_t blockSize);
 
   /**
-   * @brief Floating-point matrix inverse.
-   * @param[in]  *src points to the instance of the input floating-point matrix structure.
-   * @param[out] *dst points to the instance of the output floating-point matrix structure.
-   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
-   * If the input matrix is singular (does not have an inverse), then the algorithm terminates and returns error status ARM_MATH_SINGULAR.
+   * @brief  Fast approximation to the trigonometric sine function for a block of Q31 data.
+   * @param[in]  *pSrc points to the scaled input values, [0 +1) mapping to [0 2*pi).
+   * @param[out] *pDst points to the output values.
+   * @param[in]  blockSize number of values to compute.
+   * @return none.
    */
 
-  arm_status arm_mat_inverse_f32(
-				 const arm_matrix_instance_f32 * src,
-				 arm_matrix_instance_f32 * dst);
+  void arm_sin_block_q31(
+		   q31_t * pSrc,
+		   q31_t * pDst,
+		   uint32_t blockSize);
 
-  
- 
   /**
-   * @ingroup groupController
+   * @brief  Fast approximation to the trigonometric sine function for a block of Q15 data.
+   * @param[in]  *pSrc points to the scaled input values, [0 +1) mapping to [0 2*pi).
+   * @param[out] *pDst points to the output values.
+   * @param[in]  blockSize number of values to compute.
+   * @return none.
    */
 
+  void arm_sin_block_q15(
+		   q15_t * pSrc,
+		   q15_t * pDst,
+		   uint32_t blockSize);
 
   /**
-   * @defgroup clarke Vector Clarke Transform
-   * Forward Clarke transform converts the instantaneous stator phases into a two-coordinate time invariant vector.
-   * Generally the Clarke transform uses three-phase currents <code>Ia, Ib and Ic</code> to calculate currents
-   * in the two-phase orthogonal stator axis <code>Ialpha</code> and <code>Ibeta</code>.
-   * When <code>Ialpha</code> is superposed with <code>Ia</code> as shown in the figure below
-   * \image html clarke.gif Stator current space vector and its components in (a,b).
-   * and <code>Ia + Ib + Ic = 0</code>, in this condition <code>Ialpha</code> and <code>Ibeta</code>
-   * can be calculated using only <code>Ia</code> and <code>Ib</code>.
-   *
-   * The function operates on a single sample of data and each call to the function returns the processed output. 
-   * The library provides separate functions for Q31 and floating-point data types.
-   * \par Algorithm
-   * \image html clarkeFormula.gif
-   * where <code>Ia</code> and <code>Ib</code> are the instantaneous stator phases and
-   * <code>pIalpha</code> and <code>pIbeta</code> are the two coordinates of time invariant vector.
-   * \par Fixed-Point Behavior
-   * Care must be taken when using the Q31 version of the Clarke transform.
-   * In particular, the overflow and saturation behavior of the accumulator used must be considered.
-   * Refer to the function specific documentation below for usage guidelines.
+   * @brief  Fast approximation to the trigonometric cosine function for a block of floating-point data.
+   * @param[in]  *pSrc points to the input values in radians.
+   * @param[out] *pDst points to the output values.
+   * @param[in]  blockSize number of values to compute.
+   * @return none.
    */
 
+  void arm_cos_block_f32(
+		   float32_t * pSrc,
+		   float32_t * pDst,
+		   uint32_t blockSize);
+
   /**
-   * @addtogroup clarke
-   * @{
+   * @brief  Fast approximation to the trigonometric cosine function for a block of Q31 data.
+   * @param[in]  *pSrc points to the scaled input values, [0 +1) mapping to [0 2*pi).
+   * @param[out] *pDst points to the output values.
+   * @param[in]  blockSize number of values to compute.
+   * @return none.
    */
 
+  void arm_cos_block_q31(
+		   q31_t * pSrc,
+		   q31_t * pDst,
+		   uint32_t blockSize);
+
   /**
-   *
-   * @brief  Floating-point Clarke transform
-   * @param[in]       Ia       input three-phase coordinate <code>a</code>
-   * @param[in]       Ib       input three-phase coordinate <code>b</code>
-   * @param[out]      *pIalpha points to output two-phase orthogonal vector axis alpha
-   * @param[out]      *pIbeta  points to output two-phase orthogonal vector axis beta
+   * @brief  Fast approximation to the trigonometric cosine function for a block of Q15 data.
+   * @param[in]  *pSrc points to the scaled input values, [0 +1) mapping to [0 2*pi).
+   * @param[out] *pDst points to the output values.
+   * @param[in]  blockSize number of values to compute.
    * @return none.
    */
 
-  static __INLINE void arm_clarke_f32(
-				      float32_t Ia,
-				      float32_t Ib,
-				      float32_t * pIalpha,
-				      float32_t * pIbeta)
-  {
-    /* Calculate pIalpha using the equation, pIalpha = Ia */
-    *pIalpha = Ia;
+  void arm_cos_block_q15(
+		   q15_t * pSrc,
+		   q15_t * pDst,
+		   uint32_t blockSize);
 
-    /* Calculate pIbeta using the equation, pIbeta = (1/sqrt(3)) * Ia + (2/sqrt(3)) * Ib */
-    *pIbeta = ((float32_t) 0.57735026919 * Ia + (float32_t) 1.15470053838 * Ib);
 
-  }
+  /**
+   * @ingroup groupFastMath
+   */
+
 
   /**
-   * @brief  Clarke transform for Q31 version
-   * @param[in]       Ia       input three-phase coordinate <code>a</code>
-   * @param[in]       Ib       input three-phase coordinate <code>b</code>
-   * @param[out]      *pIalpha points to output two-phase orthogonal vector axis alpha
-   * @param[out]      *pIbeta  points to output two-phase orthogonal vector axis beta
-   * @return none.
+   * @defgroup SQRT Square Root
    *
-   * <b>Scaling and Overflow Behavior:</b>
-   * \par
-   * The function is implemented using an internal 32-bit accumulator.
-   * The accumulator maintains 1.31 format by truncating lower 31 bits of the intermediate multiplication in 2.62 format.
-   * There is saturation on the addition, hence there is no risk of overflow.
+   * Computes the square root of a number.
+   * There are separate functions for Q15, Q31, and floating-point data types.  
+   * The square root function is computed using the Newton-Raphson algorithm.
+   * This is an iterative algorithm of the form:
+   * <pre>
+   *      x1 = x0 - f(x0)/f'(x0)
+   * </pre>
+   * where <code>x1</code> is the current estimate,
+   * <code>x0</code> is the previous estimate and
+   * <code>f'(x0)</code> is the derivative of <code>f()</code> evaluated at <code>x0</code>.
+   * For the square root function, the algorithm reduces to:
+   * <pre>
+   *     x0 = in/2                         [initial guess]
+   *     x1 = 1/2 * ( x0 + in / x0)        [each iteration]
+   * </pre>
    */
 
-  static __INLINE void arm_clarke_q31(
-				      q31_t Ia,
-				      q31_t Ib,
-				      q31_t * pIalpha,
-				      q31_t * pIbeta)
-  {
-    q31_t product1, product2;                    /* Temporary variables used to store intermediate results */
 
-    /* Calculating pIalpha from Ia by equation pIalpha = Ia */
-    *pIalpha = Ia;
+  /**
+   * @addtogroup SQRT
+   * @{
+   */
 
-    /* Intermediate product is calculated by (1/(sqrt(3)) * Ia) */
-    product1 = (q31_t) (((q63_t) Ia * 0x24F34E8B) >> 30);
+  /**
+   * @brief  Floating-point square root function.
+   * @param[in]  in     input value.
+   * @param[out] *pOut  square root of input value.
+   * @return The function returns ARM_MATH_SUCCESS if input value is positive value or ARM_MATH_ARGUMENT_ERROR if
+   * <code>in</code> is negative value and returns zero output for negative values.
+   */
+
+  static __INLINE arm_status  arm_sqrt_f32(
+					  float32_t in, float32_t *pOut)
+  {
+  	if(in > 0)
+	{
+
+//	#if __FPU_USED
+    #if (__FPU_USED == 1) && defined ( __CC_ARM   )
+		*pOut = __sqrtf(in);
+	#else	  
+		*pOut = sqrtf(in);
+	#endif
 
-    /* Intermediate product is calculated by (2/sqrt(3) * Ib) */
-    product2 = (q31_t) (((q63_t) Ib * 0x49E69D16) >> 30);
+		return (ARM_MATH_SUCCESS);
+	}
+  	else
+	{
+		*pOut = 0.0f;
+		return (ARM_MATH_ARGUMENT_ERROR);
+	}
 
-    /* pIbeta is calculated by adding the intermediate products */
-    *pIbeta = __QADD(product1, product2);
   }
 
-  /**
-   * @} end of clarke group
-   */
 
   /**
-   * @brief  Converts the elements of the Q7 vector to Q31 vector.
-   * @param[in]  *pSrc     input pointer
-   * @param[out]  *pDst    output pointer
-   * @param[in]  blockSize number of samples to process
-   * @return none.
+   * @brief Q31 square root function.
+   * @param[in]   in    input value.  The range of the input value is [0 +1) or 0x00000000 to 0x7FFFFFFF.
+   * @param[out]  *pOut square root of input value.
+   * @return The function returns ARM_MATH_SUCCESS if input value is positive value or ARM_MATH_ARGUMENT_ERROR if
+   * <code>in</code> is negative value and returns zero output for negative values.
    */
-  void arm_q7_to_q31(
-		     q7_t * pSrc,
-		     q31_t * pDst,
-		     uint32_t blockSize);
-
-
- 
+  arm_status arm_sqrt_q31(
+		      q31_t in, q31_t *pOut);
 
   /**
-   * @ingroup groupController
+   * @brief  Q15 square root function.
+   * @param[in]   in     input value.  The range of the input value is [0 +1) or 0x0000 to 0x7FFF.
+   * @param[out]  *pOut  square root of input value.
+   * @return The function returns ARM_MATH_SUCCESS if input value is positive value or ARM_MATH_ARGUMENT_ERROR if
+   * <code>in</code> is negative value and returns zero output for negative values.
    */
+  arm_status arm_sqrt_q15(
+		      q15_t in, q15_t *pOut);
 
   /**
-   * @defgroup inv_clarke Vector Inverse Clarke Transform
-   * Inverse Clarke transform converts the two-coordinate time invariant vector into instantaneous stator phases.
-   * 
-   * The function operates on a single sample of data and each call to the function returns the processed output. 
-   * The library provides separate functions for Q31 and floating-point data types.
-   * \par Algorithm
-   * \image html clarkeInvFormula.gif
-   * where <code>pIa</code> and <code>pIb</code> are the instantaneous stator phases and
-   * <code>Ialpha</code> and <code>Ibeta</code> are the two coordinates of time invariant vector.
-   * \par Fixed-Point Behavior
-   * Care must be taken when using the Q31 version of the Clarke transform.
-   * In particular, the overflow and saturation behavior of the accumulator used must be considered.
-   * Refer to the function specific documentation below for usage guidelines.
+   * @} end of SQRT group
    */
 
-  /**
-   * @addtogroup inv_clarke
-   * @{
-   */
 
-   /**
-   * @brief  Floating-point Inverse Clarke transform
-   * @param[in]       Ialpha  input two-phase orthogonal vector axis alpha
-   * @param[in]       Ibeta   input two-phase orthogonal vector axis beta
-   * @param[out]      *pIa    points to output three-phase coordinate <code>a</code>
-   * @param[out]      *pIb    points to output three-phase coordinate <code>b</code>
+  /**
+   * @brief  Fast base-2 logarithm of a block of floating-point data.
+   * @param[in]  *pSrc points to the input values.
+   * @param[out] *pDst points to the output values.
+   * @param[in]  blockSize number of values to compute.
    * @return none.
    */
 
-
-  static __INLINE void arm_inv_clarke_f32(
-					  float32_t Ialpha,
-					  float32_t Ibeta,
-					  float32_t * pIa,
-					  float32_t * pIb)
-  {
-    /* Calculating pIa from Ialpha by equation pIa = Ialpha */
-    *pIa = Ialpha;
-
-    /* Calculating pIb from Ialpha and Ibeta by equation pIb = -(1/2) * Ialpha + (sqrt(3)/2) * Ibeta */
-    *pIb = -0.5 * Ialpha + (float32_t) 0.8660254039 *Ibeta;
-
-  }
+  void arm_log2_f32(
+		   float32_t * pSrc,
+		   float32_t * pDst,
+		   uint32_t blockSize);
 
   /**
-   * @brief  Inverse Clarke transform for Q31 version 
-   * @param[in]       Ialpha  input two-phase orthogonal vector axis alpha
-   * @param[in]       Ibeta   input two-phase orthogonal vector axis beta
-   * @param[out]      *pIa    points to output three-phase coordinate <code>a</code>
-   * @param[out]      *pIb    points to output three-phase coordinate <code>b</code>
+   * @brief  Fast natural logarithm of a block of floating-point data.
+   * @param[in]  *pSrc points to the input values.
+   * @param[out] *pDst points to the output values.
+   * @param[in]  blockSize number of values to compute.
    * @return none.
-   *
-   * <b>Scaling and Overflow Behavior:</b>
-   * \par
-   * The function is implemented using an internal 32-bit accumulator.
-   * The accumulator maintains 1.31 format by truncating lower 31 bits of the intermediate multiplication in 2.62 format.
-   * There is saturation on the subtraction, hence there is no risk of overflow.
    */
 
-  static __INLINE void arm_inv_clarke_q31(
-					  q31_t Ialpha,
-					  q31_t Ibeta,
-					  q31_t * pIa,
-					  q31_t * pIb)
-  {
-    q31_t product1, product2;                    /* Temporary variables used to store intermediate results */
-
-    /* Calculating pIa from Ialpha by equation pIa = Ialpha */
-    *pIa = Ialpha;
-
-    /* Intermediate product is calculated by (1/(2*sqrt(3)) * Ia) */
-    product1 = (q31_t) (((q63_t) (Ialpha) * (0x40000000)) >> 31);
-
-    /* Intermediate product is calculated by (1/sqrt(3) * pIb) */
-    product2 = (q31_t) (((q63_t) (Ibeta) * (0x6ED9EBA1)) >> 31);
-
-    /* pIb is calculated by subtracting the products */
-    *pIb = __QSUB(product2, product1);
-
-  }
+  void arm_ln_f32(
+		   float32_t * pSrc,
+		   float32_t * pDst,
+		   uint32_t blockSize);
 
   /**
-   * @} end of inv_clarke group
+   * @brief  Fast base-10 logarithm of a block of floating-point data.
+   * @param[in]  *pSrc points to the input values.
+   * @param[out] *pDst points to the output values.
+   * @param[in]  blockSize number of values to compute.
+   * @return none.
    */
 
+  void arm_log10_f32(
+		   float32_t * pSrc,
+		   float32_t * pDst,
+		   uint32_t blockSize);
+
   /**
-   * @brief  Converts the elements of the Q7 vector to Q15 vector.
-   * @param[in]  *pSrc     input pointer
-   * @param[out] *pDst     output pointer
-   * @param[in]  blockSize number of samples to process
+   * @brief  Fast base-2 logarithm of a block of Q31 data.
+   * @param[in]  *pSrc points to the input values.
+   * @param[out] *pDst points to the output values, log2(x) / 32 in 1.31 format.
+   * @param[in]  blockSize number of values to compute.
    * @return none.
    */
-  void arm_q7_to_q15(
-		      q7_t * pSrc,
-		     q15_t * pDst,
-		     uint32_t blockSize);
 
-  
+  void arm_log2_q31(
+		   q31_t * pSrc,
+		   q31_t * pDst,
+		   uint32_t blockSize);
 
   /**
-   * @ingroup groupController
+   * @brief  Fast base-2 logarithm of a block of Q15 data.
+   * @param[in]  *pSrc points to the input values.
+   * @param[out] *pDst points to the output values, log2(x) / 16 in 1.15 format.
+   * @param[in]  blockSize number of values to compute.
+   * @return none.
    */
 
+  void arm_log2_q15(
+		   q15_t * pSrc,
+		   q15_t * pDst,
+		   uint32_t blockSize);
+
   /**
-   * @defgroup park Vector Park Transform
-   *
-   * Forward Park transform converts the input two-coordinate vector to flux and torque components.
-   * The Park transform can be used to realize the transformation of the <code>Ialpha</code> and the <code>Ibeta</code> currents 
-   * from the stationary to the moving reference frame and control the spatial relationship between 
-   * the stator vector current and rotor flux vector.
-   * If we consider the d axis aligned with the rotor flux, the diagram below shows the 
-   * current vector and the relationship from the two reference frames:
-   * \image html park.gif "Stator current space vector and its component in (a,b) and in the d,q rotating reference frame"
-   *
-   * The function operates on a single sample of data and each call to the function returns the processed output. 
-   * The library provides separate functions for Q31 and floating-point data types.
-   * \par Algorithm
-   * \image html parkFormula.gif
-   * where <code>Ialpha</code> and <code>Ibeta</code> are the stator vector components,  
-   * <code>pId</code> and <code>pIq</code> are rotor vector components and <code>cosVal</code> and <code>sinVal</code> are the 
-   * cosine and sine values of theta (rotor flux position).
-   * \par Fixed-Point Behavior
-   * Care must be taken when using the Q31 version of the Park transform.
-   * In particular, the overflow and saturation behavior of the accumulator used must be considered.
-   * Refer to the function specific documentation below for usage guidelines.
+   * @brief  Fast base-2 exponential of a block of floating-point data.
+   * @param[in]  *pSrc points to the input values.
+   * @param[out] *pDst points to the output values.
+   * @param[in]  blockSize number of values to compute.
+   * @return none.
    */
 
+  void arm_exp2_f32(
+		   float32_t * pSrc,
+		   float32_t * pDst,
+		   uint32_t blockSize);
+
   /**
-   * @addtogroup park
-   * @{
+   * @brief  Fast natural exponential of a block of floating-point data.
+   * @param[in]  *pSrc points to the input values.
+   * @param[out] *pDst points to the output values.
+   * @param[in]  blockSize number of values to compute.
+   * @return none.
    */
 
+  void arm_exp_f32(
+		   float32_t * pSrc,
+		   float32_t * pDst,
+		   uint32_t blockSize);
+
   /**
-   * @brief Floating-point Park transform
-   * @param[in]       Ialpha input two-phase vector coordinate alpha
-   * @param[in]       Ibeta  input two-phase vector coordinate beta
-   * @param[out]      *pId   points to output	rotor reference frame d
-   * @param[out]      *pIq   points to output	rotor reference frame q
-   * @param[in]       sinVal sine value of rotation angle theta
-   * @param[in]       cosVal cosine value of rotation angle theta
+   * @brief  Fast base-2 exponential of a block of Q31 data.
+   * @param[in]  *pSrc points to the input values, x / 32 in 1.31 format.
+   * @param[out] *pDst points to the output values.
+   * @param[in]  blockSize number of values to compute.
    * @return none.
-   *
-   * The function implements the forward Park transform.
-   *
    */
 
-  static __INLINE void arm_park_f32(
-				    float32_t Ialpha,
-				    float32_t Ibeta,
-				    float32_t * pId,
-				    float32_t * pIq,
-				    float32_t sinVal,
-				    float32_t cosVal)
-  {
-    /* Calculate pId using the equation, pId = Ialpha * cosVal + Ibeta * sinVal */
-    *pId = Ialpha * cosVal + Ibeta * sinVal;
+  void arm_exp2_q31(
+		   q31_t * pSrc,
+		   q31_t * pDst,
+		   uint32_t blockSize);
 
-    /* Calculate pIq using the equation, pIq = - Ialpha * sinVal + Ibeta * cosVal */
-    *pIq = -Ialpha * sinVal + Ibeta * cosVal;
+  /**
+   * @brief  Fast base-2 exponential of a block of Q15 data.
+   * @param[in]  *pSrc points to the input values, x / 16 in 1.15 format.
+   * @param[out] *pDst points to the output values.
+   * @param[in]  blockSize number of values to compute.
+   * @return none.
+   */
 
-  }
+  void arm_exp2_q15(
+		   q15_t * pSrc,
+		   q15_t * pDst,
+		   uint32_t blockSize);
 
   /**
-   * @brief  Park transform for Q31 version 
-   * @param[in]       Ialpha input two-phase vector coordinate alpha
-   * @param[in]       Ibeta  input two-phase vector coordinate beta
-   * @param[out]      *pId   points to output rotor reference frame d
-   * @param[out]      *pIq   points to output rotor reference frame q
-   * @param[in]       sinVal sine value of rotation angle theta
-   * @param[in]       cosVal cosine value of rotation angle theta
+   * @brief  Converts a block of floating-point amplitudes to decibels.
+   * @param[in]  *pSrc points to the input values.
+   * @param[out] *pDst points to the output values.
+   * @param[in]  blockSize number of values to compute.
    * @return none.
-   *
-   * <b>Scaling and Overflow Behavior:</b>
-   * \par
-   * The function is implemented using an internal 32-bit accumulator.
-   * The accumulator maintains 1.31 format by truncating lower 31 bits of the intermediate multiplication in 2.62 format.
-   * There is saturation on the addition and subtraction, hence there is no risk of overflow.
    */
 
+  void arm_lin_to_db_f32(
+		   float32_t * pSrc,
+		   float32_t * pDst,
+		   uint32_t blockSize);
 
-  static __INLINE void arm_park_q31(
-				    q31_t Ialpha,
-				    q31_t Ibeta,
-				    q31_t * pId,
-				    q31_t * pIq,
-				    q31_t sinVal,
-				    q31_t cosVal)
-  {
-    q31_t product1, product2;                    /* Temporary variables used to store intermediate results */
-    q31_t product3, product4;                    /* Temporary variables used to store intermediate results */
+  /**
+   * @brief  Converts a block of levels in decibels to floating-point amplitudes.
+   * @param[in]  *pSrc points to the input values in dB.
+   * @param[out] *pDst points to the output values.
+   * @param[in]  blockSize number of values to compute.
+   * @return none.
+   */
 
-    /* Intermediate product is calculated by (Ialpha * cosVal) */
-    product1 = (q31_t) (((q63_t) (Ialpha) * (cosVal)) >> 31);
+  void arm_db_to_lin_f32(
+		   float32_t * pSrc,
+		   float32_t * pDst,
+		   uint32_t blockSize);
 
-    /* Intermediate product is calculated by (Ibeta * sinVal) */
-    product2 = (q31_t) (((q63_t) (Ibeta) * (sinVal)) >> 31);
+  /**
+   * @brief  Converts a block of Q31 amplitudes to decibels.
+   * @param[in]  *pSrc points to the input values.
+   * @param[out] *pDst points to the output values, dB / 256 in 1.31 format.
+   * @param[in]  blockSize number of values to compute.
+   * @return none.
+   */
 
+  void arm_lin_to_db_q31(
+		   q31_t * pSrc,
+		   q31_t * pDst,
+		   uint32_t blockSize);
 
-    /* Intermediate product is calculated by (Ialpha * sinVal) */
-    product3 = (q31_t) (((q63_t) (Ialpha) * (sinVal)) >> 31);
+  /**
+   * @brief  Converts a block of levels in decibels to Q31 amplitudes.
+   * @param[in]  *pSrc points to the input values, dB / 256 in 1.31 format.
+   * @param[out] *pDst points to the output values.
+   * @param[in]  blockSize number of values to compute.
+   * @return none.
+   */
 
-    /* Intermediate product is calculated by (Ibeta * cosVal) */
-    product4 = (q31_t) (((q63_t) (Ibeta) * (cosVal)) >> 31);
+  void arm_db_to_lin_q31(
+		   q31_t * pSrc,
+		   q31_t * pDst,
+		   uint32_t blockSize);
 
-    /* Calculate pId by adding the two intermediate products 1 and 2 */
-    *pId = __QADD(product1, product2);
+  /**
+   * @brief  Converts a block of Q15 amplitudes to decibels.
+   * @param[in]  *pSrc points to the input values.
+   * @param[out] *pDst points to the output values, dB / 128 in 1.15 format.
+   * @param[in]  blockSize number of values to compute.
+   * @return none.
+   */
 
-    /* Calculate pIq by subtracting the two intermediate products 3 from 4 */
-    *pIq = __QSUB(product4, product3);
-  }
+  void arm_lin_to_db_q15(
+		   q15_t * pSrc,
+		   q15_t * pDst,
+		   uint32_t blockSize);
 
   /**
-   * @} end of park group
+   * @brief  Converts a block of levels in decibels to Q15 amplitudes.
+   * @param[in]  *pSrc points to the input values, dB / 128 in 1.15 format.
+   * @param[out] *pDst points to the output values.
+   * @param[in]  blockSize number of values to compute.
+   * @return none.
    */
 
+  void arm_db_to_lin_q15(
+		   q15_t * pSrc,
+		   q15_t * pDst,
+		   uint32_t blockSize);
+
   /**
-   * @brief  Converts the elements of the Q7 vector to floating-point vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[out]  *pDst is output pointer
-   * @param[in]  blockSize is the number of samples to process
+   * @brief  Fast reciprocal square root of a block of floating-point data.
+   * @param[in]  *pSrc points to the input values.
+   * @param[out] *pDst points to the output values.
+   * @param[in]  blockSize number of values to compute.
    * @return none.
    */
-  void arm_q7_to_float(
-		        q7_t * pSrc,
-		       float32_t * pDst,
-		       uint32_t blockSize);
 
- 
-  /**
-   * @ingroup groupController
-   */
+  void arm_rsqrt_f32(
+		   float32_t * pSrc,
+		   float32_t * pDst,
+		   uint32_t blockSize);
 
   /**
-   * @defgroup inv_park Vector Inverse Park transform
-   * Inverse Park transform converts the input flux and torque components to two-coordinate vector.
-   *
-   * The function operates on a single sample of data and each call to the function returns the processed output. 
-   * The library provides separate functions for Q31 and floating-point data types.
-   * \par Algorithm
-   * \image html parkInvFormula.gif
-   * where <code>pIalpha</code> and <code>pIbeta</code> are the stator vector components,  
-   * <code>Id</code> and <code>Iq</code> are rotor vector components and <code>cosVal</code> and <code>sinVal</code> are the 
-   * cosine and sine values of theta (rotor flux position).
-   * \par Fixed-Point Behavior
-   * Care must be taken when using the Q31 version of the Park transform.
-   * In particular, the overflow and saturation behavior of the accumulator used must be considered.
-   * Refer to the function specific documentation below for usage guidelines.
+   * @brief  Fast reciprocal square root of a block of Q31 data.
+   * @param[in]  *pSrc points to the input values.
+   * @param[out] *pDst points to the output values, 1/sqrt(x) / 2^16 in 1.31 format.
+   * @param[in]  blockSize number of values to compute.
+   * @return none.
    */
 
+  void arm_rsqrt_q31(
+		   q31_t * pSrc,
+		   q31_t * pDst,
+		   uint32_t blockSize);
+
   /**
-   * @addtogroup inv_park
-   * @{
+   * @brief  Fast reciprocal square root of a block of Q15 data.
+   * @param[in]  *pSrc points to the input values.
+   * @param[out] *pDst points to the output values, 1/sqrt(x) / 2^16 in 1.31 format.
+   * @param[in]  blockSize number of values to compute.
+   * @return none.
    */
 
-   /**
-   * @brief  Floating-point Inverse Park transform
-   * @param[in]       Id        input coordinate of rotor reference frame d
-   * @param[in]       Iq        input coordinate of rotor reference frame q
-   * @param[out]      *pIalpha  points to output two-phase orthogonal vector axis alpha
-   * @param[out]      *pIbeta   points to output two-phase orthogonal vector axis beta
-   * @param[in]       sinVal    sine value of rotation angle theta
-   * @param[in]       cosVal    cosine value of rotation angle theta
-   * @return none.
+  void arm_rsqrt_q15(
+		   q15_t * pSrc,
+		   q31_t * pDst,
+		   uint32_t blockSize);
+
+
+
+
+
+
+  /**
+   * @brief floating-point Circular write function.
    */
 
-  static __INLINE void arm_inv_park_f32(
-					float32_t Id,
-					float32_t Iq,
-					float32_t * pIalpha,
-					float32_t * pIbeta,
-					float32_t sinVal,
-					float32_t cosVal)
+  static __INLINE void arm_circularWrite_f32(
+					     int32_t * circBuffer,
+					     int32_t L,
+					     uint16_t * writeOffset,
+					     int32_t bufferInc,
+					     const int32_t * src,
+					     int32_t srcInc,
+					     uint32_t blockSize)
   {
-    /* Calculate pIalpha using the equation, pIalpha = Id * cosVal - Iq * sinVal */
-    *pIalpha = Id * cosVal - Iq * sinVal;
+    uint32_t i = 0u;
+    int32_t wOffset;
 
-    /* Calculate pIbeta using the equation, pIbeta = Id * sinVal + Iq * cosVal */
-    *pIbeta = Id * sinVal + Iq * cosVal;
+    /* Copy the value of Index pointer that points
+     * to the current location where the input samples to be copied */
+    wOffset = *writeOffset;
+
+    /* Loop over the blockSize */
+    i = blockSize;
+
+    while(i > 0u)
+      {
+	/* copy the input sample to the circular buffer */
+	circBuffer[wOffset] = *src;
+
+	/* Update the input pointer */
+	src += srcInc;
+
+	/* Circularly update wOffset.  Watch out for positive and negative value */
+	wOffset += bufferInc;
+	if(wOffset >= L)
+	  wOffset -= L;
+
+	/* Decrement the loop counter */
+	i--;
+      }
 
+    /* Update the index pointer */
+    *writeOffset = wOffset;
   }
 
 
+
   /**
-   * @brief  Inverse Park transform for	Q31 version 
-   * @param[in]       Id        input coordinate of rotor reference frame d
-   * @param[in]       Iq        input coordinate of rotor reference frame q
-   * @param[out]      *pIalpha  points to output two-phase orthogonal vector axis alpha
-   * @param[out]      *pIbeta   points to output two-phase orthogonal vector axis beta
-   * @param[in]       sinVal    sine value of rotation angle theta
-   * @param[in]       cosVal    cosine value of rotation angle theta
-   * @return none.
-   *
-   * <b>Scaling and Overflow Behavior:</b>
-   * \par
-   * The function is implemented using an internal 32-bit accumulator.
-   * The accumulator maintains 1.31 format by truncating lower 31 bits of the intermediate multiplication in 2.62 format.
-   * There is saturation on the addition, hence there is no risk of overflow.
+   * @brief floating-point Circular Read function.
    */
-
-
-  static __INLINE void arm_inv_park_q31(
-					q31_t Id,
-					q31_t Iq,
-					q31_t * pIalpha,
-					q31_t * pIbeta,
-					q31_t sinVal,
-					q31_t cosVal)
+  static __INLINE void arm_circularRead_f32(
+					    int32_t * circBuffer,
+					    int32_t L,
+					    int32_t * readOffset,
+					    int32_t bufferInc,
+					    int32_t * dst,
+					    int32_t * dst_base,
+					    int32_t dst_length,
+					    int32_t dstInc,
+					    uint32_t blockSize)
   {
-    q31_t product1, product2;                    /* Temporary variables used to store intermediate results */
-    q31_t product3, product4;                    /* Temporary variables used to store intermediate results */
+    uint32_t i = 0u;
+    int32_t rOffset;
+    int32_t *dst_end;
 
-    /* Intermediate product is calculated by (Id * cosVal) */
-    product1 = (q31_t) (((q63_t) (Id) * (cosVal)) >> 31);
+    /* Copy the value of Index pointer that points
+     * to the current location from where the input samples to be read */
+    rOffset = *readOffset;
+    dst_end = dst_base + dst_length;
 
-    /* Intermediate product is calculated by (Iq * sinVal) */
-    product2 = (q31_t) (((q63_t) (Iq) * (sinVal)) >> 31);
+    /* Loop over the blockSize */
+    i = blockSize;
 
+    while(i > 0u)
+      {
+	/* copy the sample from the circular buffer to the destination buffer */
+	*dst = circBuffer[rOffset];
 
-    /* Intermediate product is calculated by (Id * sinVal) */
-    product3 = (q31_t) (((q63_t) (Id) * (sinVal)) >> 31);
+	/* Update the input pointer */
+	dst += dstInc;
 
-    /* Intermediate product is calculated by (Iq * cosVal) */
-    product4 = (q31_t) (((q63_t) (Iq) * (cosVal)) >> 31);
+	if(dst == dst_end)
+	  {
+	    dst = dst_base;
+	  }
 
-    /* Calculate pIalpha by using the two intermediate products 1 and 2 */
-    *pIalpha = __QSUB(product1, product2);
+	/* Circularly update rOffset.  Watch out for positive and negative value  */
+	rOffset += bufferInc;
 
-    /* Calculate pIbeta by using the two intermediate products 3 and 4 */
-    *pIbeta = __QADD(product4, product3);
+	if(rOffset >= L)
+	  {
+	    rOffset -= L;
+	  }
+
+	/* Decrement the loop counter */
+	i--;
+      }
 
+    /* Update the index pointer */
+    *readOffset = rOffset;
   }
 
   /**
-   * @} end of Inverse park group
+   * @brief Q15 Circular write function.
    */
 
-   
-  /**
-   * @brief  Converts the elements of the Q31 vector to floating-point vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[out]  *pDst is output pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @return none.
-   */
-  void arm_q31_to_float(
-			 q31_t * pSrc,
-			float32_t * pDst,
-			uint32_t blockSize);
+  static __INLINE void arm_circularWrite_q15(
+					     q15_t * circBuffer,
+					     int32_t L,
+					     uint16_t * writeOffset,
+					     int32_t bufferInc,
+					     const q15_t * src,
+					     int32_t srcInc,
+					     uint32_t blockSize)
+  {
+    uint32_t i = 0u;
+    int32_t wOffset;
 
-  /**
-   * @ingroup groupInterpolation
-   */
+    /* Copy the value of Index pointer that points
+     * to the current location where the input samples to be copied */
+    wOffset = *writeOffset;
+
+    /* Loop over the blockSize */
+    i = blockSize;
+
+    while(i > 0u)
+      {
+	/* copy the input sample to the circular buffer */
+	circBuffer[wOffset] = *src;
+
+	/* Update the input pointer */
+	src += srcInc;
+
+	/* Circularly update wOffset.  Watch out for positive and negative value */
+	wOffset += bufferInc;
+	if(wOffset >= L)
+	  wOffset -= L;
+
+	/* Decrement the loop counter */
+	i--;
+      }
+
+    /* Update the index pointer */
+    *writeOffset = wOffset;
+  }
 
-  /**
-   * @defgroup LinearInterpolate Linear Interpolation
-   *
-   * Linear interpolation is a method of curve fitting using linear polynomials.
-   * Linear interpolation works by effectively drawing a straight line between two neighboring samples and returning the appropriate point along that line
-   *
-   * \par 
-   * \image html LinearInterp.gif "Linear interpolation"
-   *
-   * \par
-   * A  Linear Interpolate function calculates an output value(y), for the input(x)
-   * using linear interpolation of the input values x0, x1( nearest input values) and the output values y0 and y1(nearest output values)
-   *
-   * \par Algorithm:
-   * <pre>
-   *       y = y0 + (x - x0) * ((y1 - y0)/(x1-x0))
-   *       where x0, x1 are nearest values of input x
-   *             y0, y1 are nearest values to output y
-   * </pre>
-   *
-   * \par
-   * This set of functions implements Linear interpolation process
-   * for Q7, Q15, Q31, and floating-point data types.  The functions operate on a single
-   * sample of data and each call to the function returns a single processed value.
-   * <code>S</code> points to an instance of the Linear Interpolate function data structure.
-   * <code>x</code> is the input sample value. The functions returns the output value.
-   * 
-   * \par
-   * if x is outside of the table boundary, Linear interpolation returns first value of the table 
-   * if x is below input range and returns last value of table if x is above range.  
-   */
 
-  /**
-   * @addtogroup LinearInterpolate
-   * @{
-   */
 
   /**
-   * @brief  Process function for the floating-point Linear Interpolation Function.
-   * @param[in,out] *S is an instance of the floating-point Linear Interpolation structure
-   * @param[in] x input sample to process
-   * @return y processed output sample.
-   *
+   * @brief Q15 Circular Read function.
    */
-
-  static __INLINE float32_t arm_linear_interp_f32(
-						  arm_linear_interp_instance_f32 * S,
-						  float32_t x)
+  static __INLINE void arm_circularRead_q15(
+					    q15_t * circBuffer,
+					    int32_t L,
+					    int32_t * readOffset,
+					    int32_t bufferInc,
+					    q15_t * dst,
+					    q15_t * dst_base,
+					    int32_t dst_length,
+					    int32_t dstInc,
+					    uint32_t blockSize)
   {
+    uint32_t i = 0;
+    int32_t rOffset;
+    q15_t *dst_end;
 
-	  float32_t y;
-	  float32_t x0, x1;						/* Nearest input values */
-	  float32_t y0, y1;	  					/* Nearest output values */
-	  float32_t xSpacing = S->xSpacing;		/* spacing between input values */
-	  int32_t i;  							/* Index variable */
-	  float32_t *pYData = S->pYData;	    /* pointer to output table */
+    /* Copy the value of Index pointer that points
+     * to the current location from where the input samples to be read */
+    rOffset = *readOffset;
 
-	  /* Calculation of index */
-	  i =   (x - S->x1) / xSpacing;
+    dst_end = dst_base + dst_length;
 
-	  if(i < 0)
+    /* Loop over the blockSize */
+    i = blockSize;
+
+    while(i > 0u)
+      {
+	/* copy the sample from the circular buffer to the destination buffer */
+	*dst = circBuffer[rOffset];
+
+	/* Update the input pointer */
+	dst += dstInc;
+
+	if(dst == dst_end)
 	  {
-	     /* Iniatilize output for below specified range as least output value of table */
-		 y = pYData[0];
+	    dst = dst_base;
 	  }
-	  else if(i >= S->nValues)
+
+	/* Circularly update wOffset.  Watch out for positive and negative value */
+	rOffset += bufferInc;
+
+	if(rOffset >= L)
 	  {
-	  	  /* Iniatilize output for above specified range as last output value of table */
-	  	  y = pYData[S->nValues-1];	
-	  }
-	  else
-	  {	 
-	  	  /* Calculation of nearest input values */
-		  x0 = S->x1 + i * xSpacing;
-		  x1 = S->x1 + (i +1) * xSpacing;
-		 
-		 /* Read of nearest output values */
-		  y0 = pYData[i];
-		  y1 = pYData[i + 1];
-		
-		  /* Calculation of output */
-		  y = y0 + (x - x0) * ((y1 - y0)/(x1-x0));	
-		
+	    rOffset -= L;
 	  }
 
-      /* returns output value */
-	  return (y);
+	/* Decrement the loop counter */
+	i--;
+      }
+
+    /* Update the index pointer */
+    *readOffset = rOffset;
   }
 
-   /**
-   *
-   * @brief  Process function for the Q31 Linear Interpolation Function.
-   * @param[in] *pYData  pointer to Q31 Linear Interpolation table
-   * @param[in] x input sample to process
-   * @param[in] nValues number of table values
-   * @return y processed output sample.
-   *
-   * \par
-   * Input sample <code>x</code> is in 12.20 format which contains 12 bits for table index and 20 bits for fractional part.
-   * This function can support maximum of table size 2^12.
-   *
-   */
 
+  /**
+   * @brief Q7 Circular write function.
+   */
 
-  static __INLINE q31_t arm_linear_interp_q31(q31_t *pYData,
-					      q31_t x, uint32_t nValues)
+  static __INLINE void arm_circularWrite_q7(
+					    q7_t * circBuffer,
+					    int32_t L,
+					    uint16_t * writeOffset,
+					    int32_t bufferInc,
+					    const q7_t * src,
+					    int32_t srcInc,
+					    uint32_t blockSize)
   {
-    q31_t y;                                   /* output */
-    q31_t y0, y1;                                /* Nearest output values */
-    q31_t fract;                                 /* fractional part */
-    int32_t index;                              /* Index to read nearest output values */
-    
-    /* Input is in 12.20 format */
-    /* 12 bits for the table index */
-    /* Index value calculation */
-    index = ((x & 0xFFF00000) >> 20);
-
-	if(index >= (nValues - 1))
-	{
-		return(pYData[nValues - 1]);
-	}
-	else if(index < 0)
-	{
-		return(pYData[0]);
-	}
-	else
-	{
-
-	    /* 20 bits for the fractional part */
-	    /* shift left by 11 to keep fract in 1.31 format */
-	    fract = (x & 0x000FFFFF) << 11;
-	
-	    /* Read two nearest output values from the index in 1.31(q31) format */
-	    y0 = pYData[index];
-	    y1 = pYData[index + 1u];
-	
-	    /* Calculation of y0 * (1-fract) and y is in 2.30 format */
-	    y = ((q31_t) ((q63_t) y0 * (0x7FFFFFFF - fract) >> 32));
-	
-	    /* Calculation of y0 * (1-fract) + y1 *fract and y is in 2.30 format */
-	    y += ((q31_t) (((q63_t) y1 * fract) >> 32));
-	
-	    /* Convert y to 1.31 format */
-	    return (y << 1u);
+    uint32_t i = 0u;
+    int32_t wOffset;
 
-	}
+    /* Copy the value of Index pointer that points
+     * to the current location where the input samples to be copied */
+    wOffset = *writeOffset;
 
-  }
+    /* Loop over the blockSize */
+    i = blockSize;
 
-  /**
-   *
-   * @brief  Process function for the Q15 Linear Interpolation Function.
-   * @param[in] *pYData  pointer to Q15 Linear Interpolation table
-   * @param[in] x input sample to process
-   * @param[in] nValues number of table values
-   * @return y processed output sample.
-   *
-   * \par
-   * Input sample <code>x</code> is in 12.20 format which contains 12 bits for table index and 20 bits for fractional part.
-   * This function can support maximum of table size 2^12. 
-   *
-   */
+    while(i > 0u)
+      {
+	/* copy the input sample to the circular buffer */
+	circBuffer[wOffset] = *src;
 
+	/* Update the input pointer */
+	src += srcInc;
 
-  static __INLINE q15_t arm_linear_interp_q15(q15_t *pYData, q31_t x, uint32_t nValues)
-  {
-    q63_t y;                                   /* output */
-    q15_t y0, y1;                              /* Nearest output values */
-    q31_t fract;                               /* fractional part */
-    int32_t index;                            /* Index to read nearest output values */ 
+	/* Circularly update wOffset.  Watch out for positive and negative value */
+	wOffset += bufferInc;
+	if(wOffset >= L)
+	  wOffset -= L;
 
-    /* Input is in 12.20 format */
-    /* 12 bits for the table index */
-    /* Index value calculation */
-    index = ((x & 0xFFF00000) >> 20u); 
+	/* Decrement the loop counter */
+	i--;
+      }
 
-	if(index >= (nValues - 1))
-	{
-		return(pYData[nValues - 1]);
-	}
-	else if(index < 0)
-	{
-		return(pYData[0]);
-	}
-	else
-	{	
-	    /* 20 bits for the fractional part */
-	    /* fract is in 12.20 format */
-	    fract = (x & 0x000FFFFF);
-	
-	    /* Read two nearest output values from the index */
-	    y0 = pYData[index];
-	    y1 = pYData[index + 1u];
-	
-	    /* Calculation of y0 * (1-fract) and y is in 13.35 format */
-	    y = ((q63_t) y0 * (0xFFFFF - fract));
-	
-	    /* Calculation of (y0 * (1-fract) + y1 * fract) and y is in 13.35 format */
-	    y += ((q63_t) y1 * (fract));
-	
-	    /* convert y to 1.15 format */
-	    return (y >> 20);
-	}
+    /* Update the index pointer */
+    *writeOffset = wOffset;
+  }
 
 
-  }
 
   /**
-   *
-   * @brief  Process function for the Q7 Linear Interpolation Function.
-   * @param[in] *pYData  pointer to Q7 Linear Interpolation table
-   * @param[in] x input sample to process
-   * @param[in] nValues number of table values
-   * @return y processed output sample.
-   *
-   * \par
-   * Input sample <code>x</code> is in 12.20 format which contains 12 bits for table index and 20 bits for fractional part.
-   * This function can support maximum of table size 2^12.
+   * @brief Q7 Circular Read function.
    */
+  static __INLINE void arm_circularRead_q7(
+					   q7_t * circBuffer,
+					   int32_t L,
+					   int32_t * readOffset,
+					   int32_t bufferInc,
+					   q7_t * dst,
+					   q7_t * dst_base,
+					   int32_t dst_length,
+					   int32_t dstInc,
+					   uint32_t blockSize)
+  {
+    uint32_t i = 0;
+    int32_t rOffset;
+    q7_t *dst_end;
+
+    /* Copy the value of Index pointer that points
+     * to the current location from where the input samples to be read */
+    rOffset = *readOffset;
 
+    dst_end = dst_base + dst_length;
 
-  static __INLINE q7_t arm_linear_interp_q7(q7_t *pYData, q31_t x,  uint32_t nValues)
-  {
-    q31_t y;                                   /* output */
-    q7_t y0, y1;                                 /* Nearest output values */
-    q31_t fract;                                 /* fractional part */
-    int32_t index;                              /* Index to read nearest output values */
-    
-    /* Input is in 12.20 format */
-    /* 12 bits for the table index */
-    /* Index value calculation */
-    index = ((x & 0xFFF00000) >> 20u);
+    /* Loop over the blockSize */
+    i = blockSize;
 
+    while(i > 0u)
+      {
+	/* copy the sample from the circular buffer to the destination buffer */
+	*dst = circBuffer[rOffset];
 
-    if(index >= (nValues - 1))
-	{
-		return(pYData[nValues - 1]);
-	}
-	else if(index < 0)
-	{
-		return(pYData[0]);
-	}
-	else
-	{
+	/* Update the input pointer */
+	dst += dstInc;
 
-	    /* 20 bits for the fractional part */
-	    /* fract is in 12.20 format */
-	    fract = (x & 0x000FFFFF);
-	
-	    /* Read two nearest output values from the index and are in 1.7(q7) format */
-	    y0 = pYData[index];
-	    y1 = pYData[index + 1u];
-	
-	    /* Calculation of y0 * (1-fract ) and y is in 13.27(q27) format */
-	    y = ((y0 * (0xFFFFF - fract)));
-	
-	    /* Calculation of y1 * fract + y0 * (1-fract) and y is in 13.27(q27) format */
-	    y += (y1 * fract);
-	
-	    /* convert y to 1.7(q7) format */
-	    return (y >> 20u);
+	if(dst == dst_end)
+	  {
+	    dst = dst_base;
+	  }
 
-	}
+	/* Circularly update rOffset.  Watch out for positive and negative value */
+	rOffset += bufferInc;
+
+	if(rOffset >= L)
+	  {
+	    rOffset -= L;
+	  }
+
+	/* Decrement the loop counter */
+	i--;
+      }
 
+    /* Update the index pointer */
+    *readOffset = rOffset;
   }
-  /**
-   * @} end of LinearInterpolate group
-   */
+
 
   /**
-   * @brief  Fast approximation to the trigonometric sine function for floating-point data.
-   * @param[in] x input value in radians.
-   * @return  sin(x).
+   * @brief  Sum of the squares of the elements of a Q31 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
    */
 
-  float32_t arm_sin_f32(
-			 float32_t x);
+  void arm_power_q31(
+		      q31_t * pSrc,
+		     uint32_t blockSize,
+		     q63_t * pResult);
 
   /**
-   * @brief  Fast approximation to the trigonometric sine function for Q31 data.
-   * @param[in] x Scaled input value in radians.
-   * @return  sin(x).
+   * @brief  Sum of the squares of the elements of a floating-point vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
    */
 
-  q31_t arm_sin_q31(
-		     q31_t x);
+  void arm_power_f32(
+		      float32_t * pSrc,
+		     uint32_t blockSize,
+		     float32_t * pResult);
 
   /**
-   * @brief  Fast approximation to the trigonometric sine function for Q15 data.
-   * @param[in] x Scaled input value in radians.
-   * @return  sin(x).
+   * @brief  Sum of the squares of the elements of a Q15 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
    */
 
-  q15_t arm_sin_q15(
-		     q15_t x);
+  void arm_power_q15(
+		      q15_t * pSrc,
+		     uint32_t blockSize,
+		     q63_t * pResult);
 
   /**
-   * @brief  Fast approximation to the trigonometric cosine function for floating-point data.
-   * @param[in] x input value in radians.
-   * @return  cos(x).
+   * @brief  Sum of the squares of the elements of a Q7 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
    */
 
-  float32_t arm_cos_f32(
-			 float32_t x);
+  void arm_power_q7(
+		     q7_t * pSrc,
+		    uint32_t blockSize,
+		    q31_t * pResult);
 
   /**
-   * @brief Fast approximation to the trigonometric cosine function for Q31 data.
-   * @param[in] x Scaled input value in radians.
-   * @return  cos(x).
+   * @brief  Mean value of a Q7 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
    */
 
-  q31_t arm_cos_q31(
-		     q31_t x);
+  void arm_mean_q7(
+		    q7_t * pSrc,
+		   uint32_t blockSize,
+		   q7_t * pResult);
 
   /**
-   * @brief  Fast approximation to the trigonometric cosine function for Q15 data.
-   * @param[in] x Scaled input value in radians.
-   * @return  cos(x).
+   * @brief  Mean value of a Q15 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
    */
-
-  q15_t arm_cos_q15(
-		     q15_t x);
-
+  void arm_mean_q15(
+		     q15_t * pSrc,
+		    uint32_t blockSize,
+		    q15_t * pResult);
 
   /**
-   * @ingroup groupFastMath
+   * @brief  Mean value of a Q31 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
    */
-
+  void arm_mean_q31(
+		     q31_t * pSrc,
+		    uint32_t blockSize,
+		    q31_t * pResult);
 
   /**
-   * @defgroup SQRT Square Root
-   *
-   * Computes the square root of a number.
-   * There are separate functions for Q15, Q31, and floating-point data types.  
-   * The square root function is computed using the Newton-Raphson algorithm.
-   * This is an iterative algorithm of the form:
-   * <pre>
-   *      x1 = x0 - f(x0)/f'(x0)
-   * </pre>
-   * where <code>x1</code> is the current estimate,
-   * <code>x0</code> is the previous estimate and
-   * <code>f'(x0)</code> is the derivative of <code>f()</code> evaluated at <code>x0</code>.
-   * For the square root function, the algorithm reduces to:
-   * <pre>
-   *     x0 = in/2                         [initial guess]
-   *     x1 = 1/2 * ( x0 + in / x0)        [each iteration]
-   * </pre>
+   * @brief  Mean value of a floating-point vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
    */
-
+  void arm_mean_f32(
+		     float32_t * pSrc,
+		    uint32_t blockSize,
+		    float32_t * pResult);
 
   /**
-   * @addtogroup SQRT
-   * @{
+   * @brief  Variance of the elements of a floating-point vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
    */
 
+  void arm_var_f32(
+		    float32_t * pSrc,
+		   uint32_t blockSize,
+		   float32_t * pResult);
+
   /**
-   * @brief  Floating-point square root function.
-   * @param[in]  in     input value.
-   * @param[out] *pOut  square root of input value.
-   * @return The function returns ARM_MATH_SUCCESS if input value is positive value or ARM_MATH_ARGUMENT_ERROR if
-   * <code>in</code> is negative value and returns zero output for negative values.
+   * @brief  Variance of the elements of a Q31 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
    */
 
-  static __INLINE arm_status  arm_sqrt_f32(
-					  float32_t in, float32_t *pOut)
-  {
-  	if(in > 0)
-	{
+  void arm_var_q31(
+		    q31_t * pSrc,
+		   uint32_t blockSize,
+		   q63_t * pResult);
 
-//	#if __FPU_USED
-    #if (__FPU_USED == 1) && defined ( __CC_ARM   )
-		*pOut = __sqrtf(in);
-	#else	  
-		*pOut = sqrtf(in);
-	#endif
+  /**
+   * @brief  Variance of the elements of a Q15 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
+   */
 
-		return (ARM_MATH_SUCCESS);
-	}
-  	else
-	{
-		*pOut = 0.0f;
-		return (ARM_MATH_ARGUMENT_ERROR);
-	}
+  void arm_var_q15(
+		    q15_t * pSrc,
+		   uint32_t blockSize,
+		   q31_t * pResult);
 
-  }
+  /**
+   * @brief  Root Mean Square of the elements of a floating-point vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
+   */
 
+  void arm_rms_f32(
+		    float32_t * pSrc,
+		   uint32_t blockSize,
+		   float32_t * pResult);
 
   /**
-   * @brief Q31 square root function.
-   * @param[in]   in    input value.  The range of the input value is [0 +1) or 0x00000000 to 0x7FFFFFFF.
-   * @param[out]  *pOut square root of input value.
-   * @return The function returns ARM_MATH_SUCCESS if input value is positive value or ARM_MATH_ARGUMENT_ERROR if
-   * <code>in</code> is negative value and returns zero output for negative values.
+   * @brief  Root Mean Square of the elements of a Q31 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
    */
-  arm_status arm_sqrt_q31(
-		      q31_t in, q31_t *pOut);
+
+  void arm_rms_q31(
+		    q31_t * pSrc,
+		   uint32_t blockSize,
+		   q31_t * pResult);
 
   /**
-   * @brief  Q15 square root function.
-   * @param[in]   in     input value.  The range of the input value is [0 +1) or 0x0000 to 0x7FFF.
-   * @param[out]  *pOut  square root of input value.
-   * @return The function returns ARM_MATH_SUCCESS if input value is positive value or ARM_MATH_ARGUMENT_ERROR if
-   * <code>in</code> is negative value and returns zero output for negative values.
+   * @brief  Root Mean Square of the elements of a Q15 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
    */
-  arm_status arm_sqrt_q15(
-		      q15_t in, q15_t *pOut);
+
+  void arm_rms_q15(
+		    q15_t * pSrc,
+		   uint32_t blockSize,
+		   q15_t * pResult);
 
   /**
-   * @} end of SQRT group
+   * @brief  Standard deviation of the elements of a floating-point vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
    */
 
+  void arm_std_f32(
+		    float32_t * pSrc,
+		   uint32_t blockSize,
+		   float32_t * pResult);
 
+  /**
+   * @brief  Standard deviation of the elements of a Q31 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
+   */
 
+  void arm_std_q31(
+		    q31_t * pSrc,
+		   uint32_t blockSize,
+		   q31_t * pResult);
 
+  /**
+   * @brief  Standard deviation of the elements of a Q15 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
+   */
 
+  void arm_std_q15(
+		    q15_t * pSrc,
+		   uint32_t blockSize,
+		   q15_t * pResult);
 
   /**
-   * @brief floating-point Circular write function.
+   * @brief  Floating-point complex magnitude
+   * @param[in]  *pSrc points to the complex input vector
+   * @param[out]  *pDst points to the real output vector
+   * @param[in]  numSamples number of complex samples in the input vector
+   * @return none.
    */
 
-  static __INLINE void arm_circularWrite_f32(
-					     int32_t * circBuffer,
-					     int32_t L,
-					     uint16_t * writeOffset,
-					     int32_t bufferInc,
-					     const int32_t * src,
-					     int32_t srcInc,
-					     uint32_t blockSize)
-  {
-    uint32_t i = 0u;
-    int32_t wOffset;
+  void arm_cmplx_mag_f32(
+			  float32_t * pSrc,
+			 float32_t * pDst,
+			 uint32_t numSamples);
 
-    /* Copy the value of Index pointer that points
-     * to the current location where the input samples to be copied */
-    wOffset = *writeOffset;
+  /**
+   * @brief  Q31 complex magnitude
+   * @param[in]  *pSrc points to the complex input vector
+   * @param[out]  *pDst points to the real output vector
+   * @param[in]  numSamples number of complex samples in the input vector
+   * @return none.
+   */
 
-    /* Loop over the blockSize */
-    i = blockSize;
+  void arm_cmplx_mag_q31(
+			  q31_t * pSrc,
+			 q31_t * pDst,
+			 uint32_t numSamples);
 
-    while(i > 0u)
-      {
-	/* copy the input sample to the circular buffer */
-	circBuffer[wOffset] = *src;
+  /**
+   * @brief  Q15 complex magnitude
+   * @param[in]  *pSrc points to the complex input vector
+   * @param[out]  *pDst points to the real output vector
+   * @param[in]  numSamples number of complex samples in the input vector
+   * @return none.
+   */
 
-	/* Update the input pointer */
-	src += srcInc;
+  void arm_cmplx_mag_q15(
+			  q15_t * pSrc,
+			 q15_t * pDst,
+			 uint32_t numSamples);
 
-	/* Circularly update wOffset.  Watch out for positive and negative value */
-	wOffset += bufferInc;
-	if(wOffset >= L)
-	  wOffset -= L;
+  /**
+   * @brief  Q15 complex dot product
+   * @param[in]  *pSrcA points to the first input vector
+   * @param[in]  *pSrcB points to the second input vector
+   * @param[in]  numSamples number of complex samples in each vector
+   * @param[out]  *realResult real part of the result returned here
+   * @param[out]  *imagResult imaginary part of the result returned here
+   * @return none.
+   */
 
-	/* Decrement the loop counter */
-	i--;
-      }
+  void arm_cmplx_dot_prod_q15(
+			       q15_t * pSrcA,
+			       q15_t * pSrcB,
+			      uint32_t numSamples,
+			      q31_t * realResult,
+			      q31_t * imagResult);
 
-    /* Update the index pointer */
-    *writeOffset = wOffset;
-  }
+  /**
+   * @brief  Q31 complex dot product
+   * @param[in]  *pSrcA points to the first input vector
+   * @param[in]  *pSrcB points to the second input vector
+   * @param[in]  numSamples number of complex samples in each vector
+   * @param[out]  *realResult real part of the result returned here
+   * @param[out]  *imagResult imaginary part of the result returned here
+   * @return none.
+   */
+
+  void arm_cmplx_dot_prod_q31(
+			       q31_t * pSrcA,
+			       q31_t * pSrcB,
+			      uint32_t numSamples,
+			      q63_t * realResult,
+			      q63_t * imagResult);
 
+  /**
+   * @brief  Floating-point complex dot product
+   * @param[in]  *pSrcA points to the first input vector
+   * @param[in]  *pSrcB points to the second input vector
+   * @param[in]  numSamples number of complex samples in each vector
+   * @param[out]  *realResult real part of the result returned here
+   * @param[out]  *imagResult imaginary part of the result returned here
+   * @return none.
+   */
 
+  void arm_cmplx_dot_prod_f32(
+			       float32_t * pSrcA,
+			       float32_t * pSrcB,
+			      uint32_t numSamples,
+			      float32_t * realResult,
+			      float32_t * imagResult);
 
   /**
-   * @brief floating-point Circular Read function.
+   * @brief  Q15 complex-by-real multiplication
+   * @param[in]  *pSrcCmplx points to the complex input vector
+   * @param[in]  *pSrcReal points to the real input vector
+   * @param[out]  *pCmplxDst points to the complex output vector
+   * @param[in]  numSamples number of samples in each vector
+   * @return none.
    */
-  static __INLINE void arm_circularRead_f32(
-					    int32_t * circBuffer,
-					    int32_t L,
-					    int32_t * readOffset,
-					    int32_t bufferInc,
-					    int32_t * dst,
-					    int32_t * dst_base,
-					    int32_t dst_length,
-					    int32_t dstInc,
-					    uint32_t blockSize)
-  {
-    uint32_t i = 0u;
-    int32_t rOffset, dst_end;
 
-    /* Copy the value of Index pointer that points
-     * to the current location from where the input samples to be read */
-    rOffset = *readOffset;
-    dst_end = (int32_t) (dst_base + dst_length);
+  void arm_cmplx_mult_real_q15(
+			        q15_t * pSrcCmplx,
+			        q15_t * pSrcReal,
+			       q15_t * pCmplxDst,
+			       uint32_t numSamples);
 
-    /* Loop over the blockSize */
-    i = blockSize;
+  /**
+   * @brief  Q31 complex-by-real multiplication
+   * @param[in]  *pSrcCmplx points to the complex input vector
+   * @param[in]  *pSrcReal points to the real input vector
+   * @param[out]  *pCmplxDst points to the complex output vector
+   * @param[in]  numSamples number of samples in each vector
+   * @return none.
+   */
 
-    while(i > 0u)
-      {
-	/* copy the sample from the circular buffer to the destination buffer */
-	*dst = circBuffer[rOffset];
+  void arm_cmplx_mult_real_q31(
+			        q31_t * pSrcCmplx,
+			        q31_t * pSrcReal,
+			       q31_t * pCmplxDst,
+			       uint32_t numSamples);
 
-	/* Update the input pointer */
-	dst += dstInc;
+  /**
+   * @brief  Floating-point complex-by-real multiplication
+   * @param[in]  *pSrcCmplx points to the complex input vector
+   * @param[in]  *pSrcReal points to the real input vector
+   * @param[out]  *pCmplxDst points to the complex output vector
+   * @param[in]  numSamples number of samples in each vector
+   * @return none.
+   */
 
-	if(dst == (int32_t *) dst_end)
-	  {
-	    dst = dst_base;
-	  }
+  void arm_cmplx_mult_real_f32(
+			        float32_t * pSrcCmplx,
+			        float32_t * pSrcReal,
+			       float32_t * pCmplxDst,
+			       uint32_t numSamples);
 
-	/* Circularly update rOffset.  Watch out for positive and negative value  */
-	rOffset += bufferInc;
+  /**
+   * @brief  Q15 complex multiply-accumulate
+   * @param[in]  *pSrcA points to the first input vector
+   * @param[in]  *pSrcB points to the second input vector
+   * @param[in,out]  *pDst points to the vector the products are added to
+   * @param[in]  numSamples number of complex samples in each vector
+   * @return none.
+   */
 
-	if(rOffset >= L)
-	  {
-	    rOffset -= L;
-	  }
+  void arm_cmplx_mac_q15(
+			q15_t * pSrcA,
+			q15_t * pSrcB,
+			q15_t * pDst,
+			uint32_t numSamples);
 
-	/* Decrement the loop counter */
-	i--;
-      }
+  /**
+   * @brief  Q31 complex multiply-accumulate
+   * @param[in]  *pSrcA points to the first input vector
+   * @param[in]  *pSrcB points to the second input vector
+   * @param[in,out]  *pDst points to the vector the products are added to
+   * @param[in]  numSamples number of complex samples in each vector
+   * @return none.
+   */
 
-    /* Update the index pointer */
-    *readOffset = rOffset;
-  }
+  void arm_cmplx_mac_q31(
+			q31_t * pSrcA,
+			q31_t * pSrcB,
+			q31_t * pDst,
+			uint32_t numSamples);
 
   /**
-   * @brief Q15 Circular write function.
+   * @brief  Floating-point complex multiply-accumulate
+   * @param[in]  *pSrcA points to the first input vector
+   * @param[in]  *pSrcB points to the second input vector
+   * @param[in,out]  *pDst points to the vector the products are added to
+   * @param[in]  numSamples number of complex samples in each vector
+   * @return none.
    */
 
-  static __INLINE void arm_circularWrite_q15(
-					     q15_t * circBuffer,
-					     int32_t L,
-					     uint16_t * writeOffset,
-					     int32_t bufferInc,
-					     const q15_t * src,
-					     int32_t srcInc,
-					     uint32_t blockSize)
-  {
-    uint32_t i = 0u;
-    int32_t wOffset;
+  void arm_cmplx_mac_f32(
+			float32_t * pSrcA,
+			float32_t * pSrcB,
+			float32_t * pDst,
+			uint32_t numSamples);
 
-    /* Copy the value of Index pointer that points
-     * to the current location where the input samples to be copied */
-    wOffset = *writeOffset;
+  /**
+   * @brief  Q15 complex multiply by the conjugate and accumulate
+   * @param[in]  *pSrcA points to the first input vector
+   * @param[in]  *pSrcB points to the second input vector, which is conjugated
+   * @param[in,out]  *pDst points to the vector the products are added to
+   * @param[in]  numSamples number of complex samples in each vector
+   * @return none.
+   */
 
-    /* Loop over the blockSize */
-    i = blockSize;
+  void arm_cmplx_conj_mac_q15(
+			q15_t * pSrcA,
+			q15_t * pSrcB,
+			q15_t * pDst,
+			uint32_t numSamples);
 
-    while(i > 0u)
-      {
-	/* copy the input sample to the circular buffer */
-	circBuffer[wOffset] = *src;
+  /**
+   * @brief  Q31 complex multiply by the conjugate and accumulate
+   * @param[in]  *pSrcA points to the first input vector
+   * @param[in]  *pSrcB points to the second input vector, which is conjugated
+   * @param[in,out]  *pDst points to the vector the products are added to
+   * @param[in]  numSamples number of complex samples in each vector
+   * @return none.
+   */
 
-	/* Update the input pointer */
-	src += srcInc;
+  void arm_cmplx_conj_mac_q31(
+			q31_t * pSrcA,
+			q31_t * pSrcB,
+			q31_t * pDst,
+			uint32_t numSamples);
 
-	/* Circularly update wOffset.  Watch out for positive and negative value */
-	wOffset += bufferInc;
-	if(wOffset >= L)
-	  wOffset -= L;
+  /**
+   * @brief  Floating-point complex multiply by the conjugate and accumulate
+   * @param[in]  *pSrcA points to the first input vector
+   * @param[in]  *pSrcB points to the second input vector, which is conjugated
+   * @param[in,out]  *pDst points to the vector the products are added to
+   * @param[in]  numSamples number of complex samples in each vector
+   * @return none.
+   */
 
-	/* Decrement the loop counter */
-	i--;
-      }
+  void arm_cmplx_conj_mac_f32(
+			float32_t * pSrcA,
+			float32_t * pSrcB,
+			float32_t * pDst,
+			uint32_t numSamples);
 
-    /* Update the index pointer */
-    *writeOffset = wOffset;
-  }
+  /**
+   * @brief  Q15 real gain applied to complex data in place
+   * @param[in,out]  *pCmplx points to the complex vector
+   * @param[in]  *pGain points to the real gains, one per complex sample
+   * @param[in]  numSamples number of complex samples in the vector
+   * @return none.
+   */
+
+  void arm_cmplx_gain_q15(
+			q15_t * pCmplx,
+			q15_t * pGain,
+			uint32_t numSamples);
 
+  /**
+   * @brief  Q31 real gain applied to complex data in place
+   * @param[in,out]  *pCmplx points to the complex vector
+   * @param[in]  *pGain points to the real gains, one per complex sample
+   * @param[in]  numSamples number of complex samples in the vector
+   * @return none.
+   */
 
+  void arm_cmplx_gain_q31(
+			q31_t * pCmplx,
+			q31_t * pGain,
+			uint32_t numSamples);
 
   /**
-   * @brief Q15 Circular Read function.
+   * @brief  Floating-point real gain applied to complex data in place
+   * @param[in,out]  *pCmplx points to the complex vector
+   * @param[in]  *pGain points to the real gains, one per complex sample
+   * @param[in]  numSamples number of complex samples in the vector
+   * @return none.
    */
-  static __INLINE void arm_circularRead_q15(
-					    q15_t * circBuffer,
-					    int32_t L,
-					    int32_t * readOffset,
-					    int32_t bufferInc,
-					    q15_t * dst,
-					    q15_t * dst_base,
-					    int32_t dst_length,
-					    int32_t dstInc,
-					    uint32_t blockSize)
-  {
-    uint32_t i = 0;
-    int32_t rOffset, dst_end;
 
-    /* Copy the value of Index pointer that points
-     * to the current location from where the input samples to be read */
-    rOffset = *readOffset;
+  void arm_cmplx_gain_f32(
+			float32_t * pCmplx,
+			float32_t * pGain,
+			uint32_t numSamples);
 
-    dst_end = (int32_t) (dst_base + dst_length);
+  /**
+   * @brief  Q15 complex magnitude squared with accumulation
+   * @param[in]  *pSrc points to the complex input vector
+   * @param[in,out]  *pDst points to the real vector the magnitudes squared are added to
+   * @param[in]  numSamples number of complex samples in the input vector
+   * @return none.
+   */
 
-    /* Loop over the blockSize */
-    i = blockSize;
+  void arm_cmplx_mag_squared_acc_q15(
+			q15_t * pSrc,
+			q15_t * pDst,
+			uint32_t numSamples);
 
-    while(i > 0u)
-      {
-	/* copy the sample from the circular buffer to the destination buffer */
-	*dst = circBuffer[rOffset];
+  /**
+   * @brief  Q31 complex magnitude squared with accumulation
+   * @param[in]  *pSrc points to the complex input vector
+   * @param[in,out]  *pDst points to the real vector the magnitudes squared are added to
+   * @param[in]  numSamples number of complex samples in the input vector
+   * @return none.
+   */
 
-	/* Update the input pointer */
-	dst += dstInc;
+  void arm_cmplx_mag_squared_acc_q31(
+			q31_t * pSrc,
+			q31_t * pDst,
+			uint32_t numSamples);
 
-	if(dst == (q15_t *) dst_end)
-	  {
-	    dst = dst_base;
-	  }
+  /**
+   * @brief  Floating-point complex magnitude squared with accumulation
+   * @param[in]  *pSrc points to the complex input vector
+   * @param[in,out]  *pDst points to the real vector the magnitudes squared are added to
+   * @param[in]  numSamples number of complex samples in the input vector
+   * @return none.
+   */
 
-	/* Circularly update wOffset.  Watch out for positive and negative value */
-	rOffset += bufferInc;
+  void arm_cmplx_mag_squared_acc_f32(
+			float32_t * pSrc,
+			float32_t * pDst,
+			uint32_t numSamples);
 
-	if(rOffset >= L)
-	  {
-	    rOffset -= L;
-	  }
+  /**
+   * @brief  Minimum value of a Q7 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *result is output pointer
+   * @param[in]  index is the array index of the minimum value in the input buffer.
+   * @return none.
+   */
 
-	/* Decrement the loop counter */
-	i--;
-      }
+  void arm_min_q7(
+		   q7_t * pSrc,
+		  uint32_t blockSize,
+		  q7_t * result,
+		  uint32_t * index);
 
-    /* Update the index pointer */
-    *readOffset = rOffset;
-  }
+  /**
+   * @brief  Minimum value of a Q15 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output pointer
+   * @param[in]  *pIndex is the array index of the minimum value in the input buffer.
+   * @return none.
+   */
 
+  void arm_min_q15(
+		    q15_t * pSrc,
+		   uint32_t blockSize,
+		   q15_t * pResult,
+		   uint32_t * pIndex);
 
   /**
-   * @brief Q7 Circular write function.
+   * @brief  Minimum value of a Q31 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output pointer
+   * @param[out]  *pIndex is the array index of the minimum value in the input buffer.
+   * @return none.
    */
+  void arm_min_q31(
+		    q31_t * pSrc,
+		   uint32_t blockSize,
+		   q31_t * pResult,
+		   uint32_t * pIndex);
 
-  static __INLINE void arm_circularWrite_q7(
-					    q7_t * circBuffer,
-					    int32_t L,
-					    uint16_t * writeOffset,
-					    int32_t bufferInc,
-					    const q7_t * src,
-					    int32_t srcInc,
-					    uint32_t blockSize)
-  {
-    uint32_t i = 0u;
-    int32_t wOffset;
+  /**
+   * @brief  Minimum value of a floating-point vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output pointer
+   * @param[out]  *pIndex is the array index of the minimum value in the input buffer.
+   * @return none.
+   */
 
-    /* Copy the value of Index pointer that points
-     * to the current location where the input samples to be copied */
-    wOffset = *writeOffset;
+  void arm_min_f32(
+		    float32_t * pSrc,
+		   uint32_t blockSize,
+		   float32_t * pResult,
+		   uint32_t * pIndex);
 
-    /* Loop over the blockSize */
-    i = blockSize;
+/**
+ * @brief Maximum value of a Q7 vector.
+ * @param[in]       *pSrc points to the input buffer
+ * @param[in]       blockSize length of the input vector
+ * @param[out]      *pResult maximum value returned here
+ * @param[out]      *pIndex index of maximum value returned here
+ * @return none.
+ */
 
-    while(i > 0u)
-      {
-	/* copy the input sample to the circular buffer */
-	circBuffer[wOffset] = *src;
+  void arm_max_q7(
+		   q7_t * pSrc,
+		  uint32_t blockSize,
+		  q7_t * pResult,
+		  uint32_t * pIndex);
 
-	/* Update the input pointer */
-	src += srcInc;
+/**
+ * @brief Maximum value of a Q15 vector.
+ * @param[in]       *pSrc points to the input buffer
+ * @param[in]       blockSize length of the input vector
+ * @param[out]      *pResult maximum value returned here
+ * @param[out]      *pIndex index of maximum value returned here
+ * @return none.
+ */
 
-	/* Circularly update wOffset.  Watch out for positive and negative value */
-	wOffset += bufferInc;
-	if(wOffset >= L)
-	  wOffset -= L;
+  void arm_max_q15(
+		    q15_t * pSrc,
+		   uint32_t blockSize,
+		   q15_t * pResult,
+		   uint32_t * pIndex);
+
+/**
+ * @brief Maximum value of a Q31 vector.
+ * @param[in]       *pSrc points to the input buffer
+ * @param[in]       blockSize length of the input vector
+ * @param[out]      *pResult maximum value returned here
+ * @param[out]      *pIndex index of maximum value returned here
+ * @return none.
+ */
+
+  void arm_max_q31(
+		    q31_t * pSrc,
+		   uint32_t blockSize,
+		   q31_t * pResult,
+		   uint32_t * pIndex);
+
+/**
+ * @brief Maximum value of a floating-point vector.
+ * @param[in]       *pSrc points to the input buffer
+ * @param[in]       blockSize length of the input vector
+ * @param[out]      *pResult maximum value returned here
+ * @param[out]      *pIndex index of maximum value returned here
+ * @return none.
+ */
 
-	/* Decrement the loop counter */
-	i--;
-      }
+  void arm_max_f32(
+		    float32_t * pSrc,
+		   uint32_t blockSize,
+		   float32_t * pResult,
+		   uint32_t * pIndex);
 
-    /* Update the index pointer */
-    *writeOffset = wOffset;
-  }
+  /**
+   * @brief Results of the floating-point fused statistics.
+   */
+  typedef struct
+  {
+    float32_t mean;               /**< mean value. */
+    float32_t var;                /**< variance, normalized by blockSize-1 as arm_var_f32(). */
+    float32_t std;                /**< standard deviation. */
+    float32_t rms;                /**< root mean square. */
+    float32_t power;              /**< sum of the squares. */
+    float32_t min;                /**< minimum value. */
+    float32_t max;                /**< maximum value. */
+    uint32_t minIndex;            /**< index of the first minimum. */
+    uint32_t maxIndex;            /**< index of the first maximum. */
+  } arm_stats_result_f32;
 
+  /**
+   * @brief Results of the Q31 fused statistics.
+   */
+  typedef struct
+  {
+    q31_t mean;                   /**< mean value in 1.31 format. */
+    q63_t var;                    /**< variance in 1.31 format. */
+    q31_t std;                    /**< standard deviation in 1.31 format. */
+    q31_t rms;                    /**< root mean square in 1.31 format. */
+    q63_t power;                  /**< sum of the squares in 16.48 format, as arm_power_q31(). */
+    q31_t min;                    /**< minimum value. */
+    q31_t max;                    /**< maximum value. */
+    uint32_t minIndex;            /**< index of the first minimum. */
+    uint32_t maxIndex;            /**< index of the first maximum. */
+  } arm_stats_result_q31;
 
+  /**
+   * @brief Results of the Q15 fused statistics.
+   */
+  typedef struct
+  {
+    q15_t mean;                   /**< mean value in 1.15 format. */
+    q31_t var;                    /**< variance in 1.15 format, not saturated. */
+    q15_t std;                    /**< standard deviation in 1.15 format. */
+    q15_t rms;                    /**< root mean square in 1.15 format. */
+    q63_t power;                  /**< sum of the squares in 34.30 format, as arm_power_q15(). */
+    q15_t min;                    /**< minimum value. */
+    q15_t max;                    /**< maximum value. */
+    uint32_t minIndex;            /**< index of the first minimum. */
+    uint32_t maxIndex;            /**< index of the first maximum. */
+  } arm_stats_result_q15;
 
   /**
-   * @brief Q7 Circular Read function.
+   * @brief Results of the Q7 fused statistics.
    */
-  static __INLINE void arm_circularRead_q7(
-					   q7_t * circBuffer,
-					   int32_t L,
-					   int32_t * readOffset,
-					   int32_t bufferInc,
-					   q7_t * dst,
-					   q7_t * dst_base,
-					   int32_t dst_length,
-					   int32_t dstInc,
-					   uint32_t blockSize)
+  typedef struct
   {
-    uint32_t i = 0;
-    int32_t rOffset, dst_end;
+    q7_t mean;                    /**< mean value in 1.7 format. */
+    q15_t var;                    /**< variance in 1.15 format. */
+    q7_t std;                     /**< standard deviation in 1.7 format. */
+    q7_t rms;                     /**< root mean square in 1.7 format. */
+    q31_t power;                  /**< sum of the squares in 18.14 format, as arm_power_q7(). */
+    q7_t min;                     /**< minimum value. */
+    q7_t max;                     /**< maximum value. */
+    uint32_t minIndex;            /**< index of the first minimum. */
+    uint32_t maxIndex;            /**< index of the first maximum. */
+  } arm_stats_result_q7;
 
-    /* Copy the value of Index pointer that points
-     * to the current location from where the input samples to be read */
-    rOffset = *readOffset;
+  /**
+   * @brief Mean, variance, standard deviation, RMS, power, minimum and maximum of a floating-point vector in one pass.
+   * @param[in]  *pSrc      points to the input vector.
+   * @param[in]  blockSize  length of the input vector.
+   * @param[out] *pResult   points to the results.
+   * @return none.
+   */
 
-    dst_end = (int32_t) (dst_base + dst_length);
+  void arm_stats_f32(
+		    float32_t * pSrc,
+		   uint32_t blockSize,
+		   arm_stats_result_f32 * pResult);
 
-    /* Loop over the blockSize */
-    i = blockSize;
+  /**
+   * @brief Mean, variance, standard deviation, RMS, power, minimum and maximum of a Q31 vector in one pass.
+   * @param[in]  *pSrc      points to the input vector.
+   * @param[in]  blockSize  length of the input vector.
+   * @param[out] *pResult   points to the results.
+   * @return none.
+   */
 
-    while(i > 0u)
-      {
-	/* copy the sample from the circular buffer to the destination buffer */
-	*dst = circBuffer[rOffset];
+  void arm_stats_q31(
+		    q31_t * pSrc,
+		   uint32_t blockSize,
+		   arm_stats_result_q31 * pResult);
 
-	/* Update the input pointer */
-	dst += dstInc;
+  /**
+   * @brief Mean, variance, standard deviation, RMS, power, minimum and maximum of a Q15 vector in one pass.
+   * @param[in]  *pSrc      points to the input vector.
+   * @param[in]  blockSize  length of the input vector.
+   * @param[out] *pResult   points to the results.
+   * @return none.
+   */
 
-	if(dst == (q7_t *) dst_end)
-	  {
-	    dst = dst_base;
-	  }
+  void arm_stats_q15(
+		    q15_t * pSrc,
+		   uint32_t blockSize,
+		   arm_stats_result_q15 * pResult);
 
-	/* Circularly update rOffset.  Watch out for positive and negative value */
-	rOffset += bufferInc;
+  /**
+   * @brief Mean, variance, standard deviation, RMS, power, minimum and maximum of a Q7 vector in one pass.
+   * @param[in]  *pSrc      points to the input vector.
+   * @param[in]  blockSize  length of the input vector.
+   * @param[out] *pResult   points to the results.
+   * @return none.
+   */
 
-	if(rOffset >= L)
-	  {
-	    rOffset -= L;
-	  }
+  void arm_stats_q7(
+		    q7_t * pSrc,
+		   uint32_t blockSize,
+		   arm_stats_result_q7 * pResult);
 
-	/* Decrement the loop counter */
-	i--;
-      }
+  /**
+   * @brief Instance structure for the floating-point streaming statistics accumulator.
+   */
+  typedef struct
+  {
+    uint32_t count;               /**< number of samples accumulated. */
+    float32_t mean;               /**< mean of the samples. */
+    float32_t m2;                 /**< sum of the squared deviations from the mean. */
+    float32_t min;                /**< minimum value. */
+    float32_t max;                /**< maximum value. */
+    uint32_t minIndex;            /**< sample index of the first minimum. */
+    uint32_t maxIndex;            /**< sample index of the first maximum. */
+  } arm_stats_acc_instance_f32;
 
-    /* Update the index pointer */
-    *readOffset = rOffset;
-  }
+  /**
+   * @brief Instance structure for the Q31 streaming statistics accumulator.
+   */
+  typedef struct
+  {
+    uint32_t count;               /**< number of samples accumulated. */
+    q63_t sum;                    /**< sum of the samples in 33.31 format. */
+    q63_t sumOfSquares;           /**< sum of the squares truncated to 1.31 format, in 33.31 format. */
+    q31_t min;                    /**< minimum value. */
+    q31_t max;                    /**< maximum value. */
+    uint32_t minIndex;            /**< sample index of the first minimum. */
+    uint32_t maxIndex;            /**< sample index of the first maximum. */
+  } arm_stats_acc_instance_q31;
 
+  /**
+   * @brief Instance structure for the Q15 streaming statistics accumulator.
+   */
+  typedef struct
+  {
+    uint32_t count;               /**< number of samples accumulated. */
+    q63_t sum;                    /**< sum of the samples in 49.15 format. */
+    q63_t sumOfSquares;           /**< sum of the squares in 34.30 format. */
+    q15_t min;                    /**< minimum value. */
+    q15_t max;                    /**< maximum value. */
+    uint32_t minIndex;            /**< sample index of the first minimum. */
+    uint32_t maxIndex;            /**< sample index of the first maximum. */
+  } arm_stats_acc_instance_q15;
 
   /**
-   * @brief  Sum of the squares of the elements of a Q31 vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output value.
+   * @brief  Initialization function for the floating-point streaming statistics accumulator.
+   * @param[out] *S points to an instance of the floating-point accumulator.
    * @return none.
    */
 
-  void arm_power_q31(
-		      q31_t * pSrc,
-		     uint32_t blockSize,
-		     q63_t * pResult);
+  void arm_stats_acc_init_f32(
+		    arm_stats_acc_instance_f32 * S);
 
   /**
-   * @brief  Sum of the squares of the elements of a floating-point vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output value.
+   * @brief  Initialization function for the Q31 streaming statistics accumulator.
+   * @param[out] *S points to an instance of the Q31 accumulator.
    * @return none.
    */
 
-  void arm_power_f32(
-		      float32_t * pSrc,
-		     uint32_t blockSize,
-		     float32_t * pResult);
+  void arm_stats_acc_init_q31(
+		    arm_stats_acc_instance_q31 * S);
 
   /**
-   * @brief  Sum of the squares of the elements of a Q15 vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output value.
+   * @brief  Initialization function for the Q15 streaming statistics accumulator.
+   * @param[out] *S points to an instance of the Q15 accumulator.
    * @return none.
    */
 
-  void arm_power_q15(
-		      q15_t * pSrc,
-		     uint32_t blockSize,
-		     q63_t * pResult);
+  void arm_stats_acc_init_q15(
+		    arm_stats_acc_instance_q15 * S);
 
   /**
-   * @brief  Sum of the squares of the elements of a Q7 vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output value.
+   * @brief  Adds a block of samples to the floating-point streaming statistics accumulator.
+   * @param[in,out] *S         points to an instance of the floating-point accumulator.
+   * @param[in]     *pSrc      points to the block of input data.
+   * @param[in]     blockSize  number of samples in the block.
    * @return none.
    */
 
-  void arm_power_q7(
-		     q7_t * pSrc,
-		    uint32_t blockSize,
-		    q31_t * pResult);
+  void arm_stats_acc_f32(
+		    arm_stats_acc_instance_f32 * S,
+		   float32_t * pSrc,
+		   uint32_t blockSize);
 
   /**
-   * @brief  Mean value of a Q7 vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output value.
+   * @brief  Adds a block of samples to the Q31 streaming statistics accumulator.
+   * @param[in,out] *S         points to an instance of the Q31 accumulator.
+   * @param[in]     *pSrc      points to the block of input data.
+   * @param[in]     blockSize  number of samples in the block.
    * @return none.
    */
 
-  void arm_mean_q7(
-		    q7_t * pSrc,
-		   uint32_t blockSize,
-		   q7_t * pResult);
+  void arm_stats_acc_q31(
+		    arm_stats_acc_instance_q31 * S,
+		   q31_t * pSrc,
+		   uint32_t blockSize);
 
   /**
-   * @brief  Mean value of a Q15 vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output value.
+   * @brief  Adds a block of samples to the Q15 streaming statistics accumulator.
+   * @param[in,out] *S         points to an instance of the Q15 accumulator.
+   * @param[in]     *pSrc      points to the block of input data.
+   * @param[in]     blockSize  number of samples in the block.
    * @return none.
    */
-  void arm_mean_q15(
-		     q15_t * pSrc,
-		    uint32_t blockSize,
-		    q15_t * pResult);
+
+  void arm_stats_acc_q15(
+		    arm_stats_acc_instance_q15 * S,
+		   q15_t * pSrc,
+		   uint32_t blockSize);
 
   /**
-   * @brief  Mean value of a Q31 vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output value.
+   * @brief  Merges two floating-point streaming statistics accumulators, as if the samples of the second followed those of the first.
+   * @param[in,out] *S      points to the accumulator that receives the merged state.
+   * @param[in]     *pOther points to the accumulator that is added.
    * @return none.
    */
-  void arm_mean_q31(
-		     q31_t * pSrc,
-		    uint32_t blockSize,
-		    q31_t * pResult);
+
+  void arm_stats_acc_merge_f32(
+		    arm_stats_acc_instance_f32 * S,
+		   const arm_stats_acc_instance_f32 * pOther);
 
   /**
-   * @brief  Mean value of a floating-point vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output value.
+   * @brief  Merges two Q31 streaming statistics accumulators, as if the samples of the second followed those of the first.
+   * @param[in,out] *S      points to the accumulator that receives the merged state.
+   * @param[in]     *pOther points to the accumulator that is added.
    * @return none.
    */
-  void arm_mean_f32(
-		     float32_t * pSrc,
-		    uint32_t blockSize,
-		    float32_t * pResult);
+
+  void arm_stats_acc_merge_q31(
+		    arm_stats_acc_instance_q31 * S,
+		   const arm_stats_acc_instance_q31 * pOther);
 
   /**
-   * @brief  Variance of the elements of a floating-point vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output value.
+   * @brief  Merges two Q15 streaming statistics accumulators, as if the samples of the second followed those of the first.
+   * @param[in,out] *S      points to the accumulator that receives the merged state.
+   * @param[in]     *pOther points to the accumulator that is added.
    * @return none.
    */
 
-  void arm_var_f32(
-		    float32_t * pSrc,
-		   uint32_t blockSize,
-		   float32_t * pResult);
+  void arm_stats_acc_merge_q15(
+		    arm_stats_acc_instance_q15 * S,
+		   const arm_stats_acc_instance_q15 * pOther);
 
   /**
-   * @brief  Variance of the elements of a Q31 vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output value.
+   * @brief  Statistics of all the samples of a floating-point streaming statistics accumulator.
+   * @param[in]  *S       points to an instance of the floating-point accumulator.
+   * @param[out] *pResult points to the results.
    * @return none.
    */
 
-  void arm_var_q31(
-		    q31_t * pSrc,
-		   uint32_t blockSize,
-		   q63_t * pResult);
+  void arm_stats_acc_get_f32(
+		    const arm_stats_acc_instance_f32 * S,
+		   arm_stats_result_f32 * pResult);
 
   /**
-   * @brief  Variance of the elements of a Q15 vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output value.
+   * @brief  Statistics of all the samples of a Q31 streaming statistics accumulator.
+   * @param[in]  *S       points to an instance of the Q31 accumulator.
+   * @param[out] *pResult points to the results.
    * @return none.
    */
 
-  void arm_var_q15(
-		    q15_t * pSrc,
-		   uint32_t blockSize,
-		   q31_t * pResult);
+  void arm_stats_acc_get_q31(
+		    const arm_stats_acc_instance_q31 * S,
+		   arm_stats_result_q31 * pResult);
 
   /**
-   * @brief  Root Mean Square of the elements of a floating-point vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output value.
+   * @brief  Statistics of all the samples of a Q15 streaming statistics accumulator.
+   * @param[in]  *S       points to an instance of the Q15 accumulator.
+   * @param[out] *pResult points to the results.
    * @return none.
    */
 
-  void arm_rms_f32(
-		    float32_t * pSrc,
-		   uint32_t blockSize,
-		   float32_t * pResult);
+  void arm_stats_acc_get_q15(
+		    const arm_stats_acc_instance_q15 * S,
+		   arm_stats_result_q15 * pResult);
 
   /**
-   * @brief  Root Mean Square of the elements of a Q31 vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output value.
+   * @brief Instance structure for the floating-point exponential RMS.
+   */
+  typedef struct
+  {
+    float32_t coeff;              /**< smoothing coefficient per sample, 0 to 1. */
+    float32_t meanSquare;         /**< smoothed mean of the squares. */
+  } arm_rms_exp_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 exponential RMS.
+   */
+  typedef struct
+  {
+    q31_t coeff;                  /**< smoothing coefficient per sample in 1.31 format. */
+    q31_t meanSquare;             /**< smoothed mean of the squares in 1.31 format. */
+  } arm_rms_exp_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 exponential RMS.
+   */
+  typedef struct
+  {
+    q31_t coeff;                  /**< smoothing coefficient per sample in 1.31 format. */
+    q31_t meanSquare;             /**< smoothed mean of the squares in 2.30 format. */
+  } arm_rms_exp_instance_q15;
+
+  /**
+   * @brief  Initialization function for the floating-point exponential RMS.
+   * @param[out] *S     points to an instance of the floating-point exponential RMS.
+   * @param[in]  coeff  smoothing coefficient per sample, 0 to 1.
    * @return none.
    */
 
-  void arm_rms_q31(
-		    q31_t * pSrc,
-		   uint32_t blockSize,
-		   q31_t * pResult);
+  void arm_rms_exp_init_f32(
+		    arm_rms_exp_instance_f32 * S,
+		   float32_t coeff);
 
   /**
-   * @brief  Root Mean Square of the elements of a Q15 vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output value.
+   * @brief  Initialization function for the Q31 exponential RMS.
+   * @param[out] *S     points to an instance of the Q31 exponential RMS.
+   * @param[in]  coeff  smoothing coefficient per sample in 1.31 format.
    * @return none.
    */
 
-  void arm_rms_q15(
-		    q15_t * pSrc,
-		   uint32_t blockSize,
-		   q15_t * pResult);
+  void arm_rms_exp_init_q31(
+		    arm_rms_exp_instance_q31 * S,
+		   q31_t coeff);
 
   /**
-   * @brief  Standard deviation of the elements of a floating-point vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output value.
+   * @brief  Initialization function for the Q15 exponential RMS.
+   * @param[out] *S     points to an instance of the Q15 exponential RMS.
+   * @param[in]  coeff  smoothing coefficient per sample in 1.31 format.
    * @return none.
    */
 
-  void arm_std_f32(
-		    float32_t * pSrc,
+  void arm_rms_exp_init_q15(
+		    arm_rms_exp_instance_q15 * S,
+		   q31_t coeff);
+
+  /**
+   * @brief  Processing function for the floating-point exponential RMS.
+   * @param[in,out] *S         points to an instance of the floating-point exponential RMS.
+   * @param[in]     *pSrc      points to the block of input data.
+   * @param[in]     blockSize  number of samples in the block.
+   * @param[out]    *pResult   RMS after the last sample of the block.
+   * @return none.
+   */
+
+  void arm_rms_exp_f32(
+		    arm_rms_exp_instance_f32 * S,
+		   float32_t * pSrc,
 		   uint32_t blockSize,
 		   float32_t * pResult);
 
   /**
-   * @brief  Standard deviation of the elements of a Q31 vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output value.
+   * @brief  Processing function for the Q31 exponential RMS.
+   * @param[in,out] *S         points to an instance of the Q31 exponential RMS.
+   * @param[in]     *pSrc      points to the block of input data.
+   * @param[in]     blockSize  number of samples in the block.
+   * @param[out]    *pResult   RMS after the last sample of the block.
    * @return none.
    */
 
-  void arm_std_q31(
-		    q31_t * pSrc,
+  void arm_rms_exp_q31(
+		    arm_rms_exp_instance_q31 * S,
+		   q31_t * pSrc,
 		   uint32_t blockSize,
 		   q31_t * pResult);
 
   /**
-   * @brief  Standard deviation of the elements of a Q15 vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output value.
+   * @brief  Processing function for the Q15 exponential RMS.
+   * @param[in,out] *S         points to an instance of the Q15 exponential RMS.
+   * @param[in]     *pSrc      points to the block of input data.
+   * @param[in]     blockSize  number of samples in the block.
+   * @param[out]    *pResult   RMS after the last sample of the block.
    * @return none.
    */
 
-  void arm_std_q15(
-		    q15_t * pSrc,
+  void arm_rms_exp_q15(
+		    arm_rms_exp_instance_q15 * S,
+		   q15_t * pSrc,
 		   uint32_t blockSize,
 		   q15_t * pResult);
 
   /**
-   * @brief  Floating-point complex magnitude
-   * @param[in]  *pSrc points to the complex input vector
-   * @param[out]  *pDst points to the real output vector
-   * @param[in]  numSamples number of complex samples in the input vector
-   * @return none.
+   * @brief Instance structure for the floating-point windowed RMS.
    */
+  typedef struct
+  {
+    uint16_t numBlocks;           /**< number of blocks in the window. */
+    uint16_t blockIndex;          /**< slot of the oldest block in pBlockPower. */
+    uint16_t numFilled;           /**< number of blocks in the window so far, up to numBlocks. */
+    float32_t *pBlockPower;       /**< points to the sums of squares of the blocks. The array is of length numBlocks. */
+  } arm_rms_window_instance_f32;
 
-  void arm_cmplx_mag_f32(
-			  float32_t * pSrc,
-			 float32_t * pDst,
-			 uint32_t numSamples);
+  /**
+   * @brief Instance structure for the Q31 windowed RMS.
+   */
+  typedef struct
+  {
+    uint16_t numBlocks;           /**< number of blocks in the window. */
+    uint16_t blockIndex;          /**< slot of the oldest block in pBlockPower. */
+    uint16_t numFilled;           /**< number of blocks in the window so far, up to numBlocks. */
+    q63_t total;                  /**< sum of the array pBlockPower. */
+    q63_t *pBlockPower;           /**< points to the sums of squares of the blocks in 33.31 format. The array is of length numBlocks. */
+  } arm_rms_window_instance_q31;
 
   /**
-   * @brief  Q31 complex magnitude
-   * @param[in]  *pSrc points to the complex input vector
-   * @param[out]  *pDst points to the real output vector
-   * @param[in]  numSamples number of complex samples in the input vector
+   * @brief Instance structure for the Q15 windowed RMS.
+   */
+  typedef struct
+  {
+    uint16_t numBlocks;           /**< number of blocks in the window. */
+    uint16_t blockIndex;          /**< slot of the oldest block in pBlockPower. */
+    uint16_t numFilled;           /**< number of blocks in the window so far, up to numBlocks. */
+    q63_t total;                  /**< sum of the array pBlockPower. */
+    q63_t *pBlockPower;           /**< points to the sums of squares of the blocks in 34.30 format. The array is of length numBlocks. */
+  } arm_rms_window_instance_q15;
+
+  /**
+   * @brief  Initialization function for the floating-point windowed RMS.
+   * @param[out] *S            points to an instance of the floating-point windowed RMS.
+   * @param[in]  numBlocks     number of blocks in the window.
+   * @param[in]  *pBlockPower  points to an array of numBlocks values.
    * @return none.
    */
 
-  void arm_cmplx_mag_q31(
-			  q31_t * pSrc,
-			 q31_t * pDst,
-			 uint32_t numSamples);
+  void arm_rms_window_init_f32(
+		    arm_rms_window_instance_f32 * S,
+		   uint16_t numBlocks,
+		   float32_t * pBlockPower);
 
   /**
-   * @brief  Q15 complex magnitude
-   * @param[in]  *pSrc points to the complex input vector
-   * @param[out]  *pDst points to the real output vector
-   * @param[in]  numSamples number of complex samples in the input vector
+   * @brief  Initialization function for the Q31 windowed RMS.
+   * @param[out] *S            points to an instance of the Q31 windowed RMS.
+   * @param[in]  numBlocks     number of blocks in the window.
+   * @param[in]  *pBlockPower  points to an array of numBlocks values.
    * @return none.
    */
 
-  void arm_cmplx_mag_q15(
-			  q15_t * pSrc,
-			 q15_t * pDst,
-			 uint32_t numSamples);
+  void arm_rms_window_init_q31(
+		    arm_rms_window_instance_q31 * S,
+		   uint16_t numBlocks,
+		   q63_t * pBlockPower);
 
   /**
-   * @brief  Q15 complex dot product
-   * @param[in]  *pSrcA points to the first input vector
-   * @param[in]  *pSrcB points to the second input vector
-   * @param[in]  numSamples number of complex samples in each vector
-   * @param[out]  *realResult real part of the result returned here
-   * @param[out]  *imagResult imaginary part of the result returned here
+   * @brief  Initialization function for the Q15 windowed RMS.
+   * @param[out] *S            points to an instance of the Q15 windowed RMS.
+   * @param[in]  numBlocks     number of blocks in the window.
+   * @param[in]  *pBlockPower  points to an array of numBlocks values.
    * @return none.
    */
 
-  void arm_cmplx_dot_prod_q15(
-			       q15_t * pSrcA,
-			       q15_t * pSrcB,
-			      uint32_t numSamples,
-			      q31_t * realResult,
-			      q31_t * imagResult);
+  void arm_rms_window_init_q15(
+		    arm_rms_window_instance_q15 * S,
+		   uint16_t numBlocks,
+		   q63_t * pBlockPower);
 
   /**
-   * @brief  Q31 complex dot product
-   * @param[in]  *pSrcA points to the first input vector
-   * @param[in]  *pSrcB points to the second input vector
-   * @param[in]  numSamples number of complex samples in each vector
-   * @param[out]  *realResult real part of the result returned here
-   * @param[out]  *imagResult imaginary part of the result returned here
+   * @brief  Processing function for the floating-point windowed RMS.
+   * @param[in,out] *S         points to an instance of the floating-point windowed RMS.
+   * @param[in]     *pSrc      points to the block of input data.
+   * @param[in]     blockSize  number of samples in the block, the same for every call.
+   * @param[out]    *pResult   RMS of the blocks in the window.
    * @return none.
    */
 
-  void arm_cmplx_dot_prod_q31(
-			       q31_t * pSrcA,
-			       q31_t * pSrcB,
-			      uint32_t numSamples,
-			      q63_t * realResult,
-			      q63_t * imagResult);
+  void arm_rms_window_f32(
+		    arm_rms_window_instance_f32 * S,
+		   float32_t * pSrc,
+		   uint32_t blockSize,
+		   float32_t * pResult);
 
   /**
-   * @brief  Floating-point complex dot product
-   * @param[in]  *pSrcA points to the first input vector
-   * @param[in]  *pSrcB points to the second input vector
-   * @param[in]  numSamples number of complex samples in each vector
-   * @param[out]  *realResult real part of the result returned here
-   * @param[out]  *imagResult imaginary part of the result returned here
+   * @brief  Processing function for the Q31 windowed RMS.
+   * @param[in,out] *S         points to an instance of the Q31 windowed RMS.
+   * @param[in]     *pSrc      points to the block of input data.
+   * @param[in]     blockSize  number of samples in the block, the same for every call.
+   * @param[out]    *pResult   RMS of the blocks in the window.
    * @return none.
    */
 
-  void arm_cmplx_dot_prod_f32(
-			       float32_t * pSrcA,
-			       float32_t * pSrcB,
-			      uint32_t numSamples,
-			      float32_t * realResult,
-			      float32_t * imagResult);
+  void arm_rms_window_q31(
+		    arm_rms_window_instance_q31 * S,
+		   q31_t * pSrc,
+		   uint32_t blockSize,
+		   q31_t * pResult);
 
   /**
-   * @brief  Q15 complex-by-real multiplication
-   * @param[in]  *pSrcCmplx points to the complex input vector
-   * @param[in]  *pSrcReal points to the real input vector
-   * @param[out]  *pCmplxDst points to the complex output vector
-   * @param[in]  numSamples number of samples in each vector
+   * @brief  Processing function for the Q15 windowed RMS.
+   * @param[in,out] *S         points to an instance of the Q15 windowed RMS.
+   * @param[in]     *pSrc      points to the block of input data.
+   * @param[in]     blockSize  number of samples in the block, the same for every call.
+   * @param[out]    *pResult   RMS of the blocks in the window.
    * @return none.
    */
 
-  void arm_cmplx_mult_real_q15(
-			        q15_t * pSrcCmplx,
-			        q15_t * pSrcReal,
-			       q15_t * pCmplxDst,
-			       uint32_t numSamples);
+  void arm_rms_window_q15(
+		    arm_rms_window_instance_q15 * S,
+		   q15_t * pSrc,
+		   uint32_t blockSize,
+		   q15_t * pResult);
 
   /**
-   * @brief  Q31 complex-by-real multiplication
-   * @param[in]  *pSrcCmplx points to the complex input vector
-   * @param[in]  *pSrcReal points to the real input vector
-   * @param[out]  *pCmplxDst points to the complex output vector
-   * @param[in]  numSamples number of samples in each vector
-   * @return none.
+   * @brief Instance structure for the floating-point histogram.
+   */
+  typedef struct
+  {
+    uint32_t numBins;             /**< number of bins. */
+    float32_t minVal;             /**< lower edge of the first bin. */
+    float32_t scale;              /**< number of bins per unit. */
+    uint32_t *pCounts;            /**< points to the bin counts. The array is of length numBins. */
+  } arm_histogram_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 histogram.
    */
+  typedef struct
+  {
+    uint32_t numBins;             /**< number of bins, a power of 2. */
+    uint8_t shift;                /**< right shift of the offset sample to its bin. */
+    uint32_t *pCounts;            /**< points to the bin counts. The array is of length numBins. */
+  } arm_histogram_instance_q31;
 
-  void arm_cmplx_mult_real_q31(
-			        q31_t * pSrcCmplx,
-			        q31_t * pSrcReal,
-			       q31_t * pCmplxDst,
-			       uint32_t numSamples);
+  /**
+   * @brief Instance structure for the Q15 histogram.
+   */
+  typedef struct
+  {
+    uint32_t numBins;             /**< number of bins, a power of 2. */
+    uint8_t shift;                /**< right shift of the offset sample to its bin. */
+    uint32_t *pCounts;            /**< points to the bin counts. The array is of length numBins. */
+  } arm_histogram_instance_q15;
 
   /**
-   * @brief  Floating-point complex-by-real multiplication
-   * @param[in]  *pSrcCmplx points to the complex input vector
-   * @param[in]  *pSrcReal points to the real input vector
-   * @param[out]  *pCmplxDst points to the complex output vector
-   * @param[in]  numSamples number of samples in each vector
-   * @return none.
+   * @brief  Initialization function for the floating-point histogram.
+   * @param[out] *S        points to an instance of the floating-point histogram.
+   * @param[in]  numBins   number of bins.
+   * @param[in]  minVal    lower edge of the first bin.
+   * @param[in]  maxVal    upper edge of the last bin.
+   * @param[in]  *pCounts  points to an array of numBins counts.
+   * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+   * <code>numBins</code> is 0 or <code>maxVal</code> is not above <code>minVal</code>.
    */
 
-  void arm_cmplx_mult_real_f32(
-			        float32_t * pSrcCmplx,
-			        float32_t * pSrcReal,
-			       float32_t * pCmplxDst,
-			       uint32_t numSamples);
+  arm_status arm_histogram_init_f32(
+		    arm_histogram_instance_f32 * S,
+		   uint32_t numBins,
+		   float32_t minVal,
+		   float32_t maxVal,
+		   uint32_t * pCounts);
 
   /**
-   * @brief  Minimum value of a Q7 vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *result is output pointer
-   * @param[in]  index is the array index of the minimum value in the input buffer.
-   * @return none.
+   * @brief  Initialization function for the Q31 histogram.
+   * @param[out] *S        points to an instance of the Q31 histogram.
+   * @param[in]  numBins   number of bins, a power of 2 from 1 to 65536.
+   * @param[in]  *pCounts  points to an array of numBins counts.
+   * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+   * <code>numBins</code> is not a power of 2 from 1 to 65536.
    */
 
-  void arm_min_q7(
-		   q7_t * pSrc,
-		  uint32_t blockSize,
-		  q7_t * result,
-		  uint32_t * index);
+  arm_status arm_histogram_init_q31(
+		    arm_histogram_instance_q31 * S,
+		   uint32_t numBins,
+		   uint32_t * pCounts);
 
   /**
-   * @brief  Minimum value of a Q15 vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output pointer
-   * @param[in]  *pIndex is the array index of the minimum value in the input buffer.
-   * @return none.
+   * @brief  Initialization function for the Q15 histogram.
+   * @param[out] *S        points to an instance of the Q15 histogram.
+   * @param[in]  numBins   number of bins, a power of 2 from 1 to 65536.
+   * @param[in]  *pCounts  points to an array of numBins counts.
+   * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+   * <code>numBins</code> is not a power of 2 from 1 to 65536.
    */
 
-  void arm_min_q15(
-		    q15_t * pSrc,
-		   uint32_t blockSize,
-		   q15_t * pResult,
-		   uint32_t * pIndex);
+  arm_status arm_histogram_init_q15(
+		    arm_histogram_instance_q15 * S,
+		   uint32_t numBins,
+		   uint32_t * pCounts);
 
   /**
-   * @brief  Minimum value of a Q31 vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output pointer
-   * @param[out]  *pIndex is the array index of the minimum value in the input buffer.
+   * @brief  Adds a block of samples to a floating-point histogram.
+   * @param[in,out] *S         points to an instance of the floating-point histogram.
+   * @param[in]     *pSrc      points to the block of input data.
+   * @param[in]     blockSize  number of samples in the block.
    * @return none.
    */
-  void arm_min_q31(
-		    q31_t * pSrc,
-		   uint32_t blockSize,
-		   q31_t * pResult,
-		   uint32_t * pIndex);
+
+  void arm_histogram_f32(
+		    const arm_histogram_instance_f32 * S,
+		   float32_t * pSrc,
+		   uint32_t blockSize);
 
   /**
-   * @brief  Minimum value of a floating-point vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output pointer
-   * @param[out]  *pIndex is the array index of the minimum value in the input buffer.
+   * @brief  Adds a block of samples to a Q31 histogram.
+   * @param[in,out] *S         points to an instance of the Q31 histogram.
+   * @param[in]     *pSrc      points to the block of input data.
+   * @param[in]     blockSize  number of samples in the block.
    * @return none.
    */
 
-  void arm_min_f32(
-		    float32_t * pSrc,
-		   uint32_t blockSize,
-		   float32_t * pResult,
-		   uint32_t * pIndex);
+  void arm_histogram_q31(
+		    const arm_histogram_instance_q31 * S,
+		   q31_t * pSrc,
+		   uint32_t blockSize);
 
-/**
- * @brief Maximum value of a Q7 vector.
- * @param[in]       *pSrc points to the input buffer
- * @param[in]       blockSize length of the input vector
- * @param[out]      *pResult maximum value returned here
- * @param[out]      *pIndex index of maximum value returned here
- * @return none.
- */
+  /**
+   * @brief  Adds a block of samples to a Q15 histogram.
+   * @param[in,out] *S         points to an instance of the Q15 histogram.
+   * @param[in]     *pSrc      points to the block of input data.
+   * @param[in]     blockSize  number of samples in the block.
+   * @return none.
+   */
 
-  void arm_max_q7(
-		   q7_t * pSrc,
-		  uint32_t blockSize,
-		  q7_t * pResult,
-		  uint32_t * pIndex);
+  void arm_histogram_q15(
+		    const arm_histogram_instance_q15 * S,
+		   q15_t * pSrc,
+		   uint32_t blockSize);
 
-/**
- * @brief Maximum value of a Q15 vector.
- * @param[in]       *pSrc points to the input buffer
- * @param[in]       blockSize length of the input vector
- * @param[out]      *pResult maximum value returned here
- * @param[out]      *pIndex index of maximum value returned here
- * @return none.
- */
+  /**
+   * @brief  Adds the counts of a floating-point histogram to another one with the same bins.
+   * @param[in,out] *S      points to the histogram that receives the counts.
+   * @param[in]     *pOther points to the histogram that is added.
+   * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_SIZE_MISMATCH if the bins differ.
+   */
 
-  void arm_max_q15(
-		    q15_t * pSrc,
-		   uint32_t blockSize,
-		   q15_t * pResult,
-		   uint32_t * pIndex);
+  arm_status arm_histogram_merge_f32(
+		    const arm_histogram_instance_f32 * S,
+		   const arm_histogram_instance_f32 * pOther);
 
-/**
- * @brief Maximum value of a Q31 vector.
- * @param[in]       *pSrc points to the input buffer
- * @param[in]       blockSize length of the input vector
- * @param[out]      *pResult maximum value returned here
- * @param[out]      *pIndex index of maximum value returned here
- * @return none.
- */
+  /**
+   * @brief  Adds the counts of a Q31 histogram to another one with the same bins.
+   * @param[in,out] *S      points to the histogram that receives the counts.
+   * @param[in]     *pOther points to the histogram that is added.
+   * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_SIZE_MISMATCH if the bins differ.
+   */
 
-  void arm_max_q31(
-		    q31_t * pSrc,
-		   uint32_t blockSize,
-		   q31_t * pResult,
-		   uint32_t * pIndex);
+  arm_status arm_histogram_merge_q31(
+		    const arm_histogram_instance_q31 * S,
+		   const arm_histogram_instance_q31 * pOther);
 
-/**
- * @brief Maximum value of a floating-point vector.
- * @param[in]       *pSrc points to the input buffer
- * @param[in]       blockSize length of the input vector
- * @param[out]      *pResult maximum value returned here
- * @param[out]      *pIndex index of maximum value returned here
- * @return none.
- */
+  /**
+   * @brief  Adds the counts of a Q15 histogram to another one with the same bins.
+   * @param[in,out] *S      points to the histogram that receives the counts.
+   * @param[in]     *pOther points to the histogram that is added.
+   * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_SIZE_MISMATCH if the bins differ.
+   */
 
-  void arm_max_f32(
-		    float32_t * pSrc,
-		   uint32_t blockSize,
-		   float32_t * pResult,
-		   uint32_t * pIndex);
+  arm_status arm_histogram_merge_q15(
+		    const arm_histogram_instance_q15 * S,
+		   const arm_histogram_instance_q15 * pOther);
 
   /**
    * @brief  Q15 complex-by-complex multiplication
@@ -6666,6 +10059,128 @@ extern "C"
 		     uint32_t blockSize);
 
 
+  /**
+   * @brief Rounding mode of the dithered conversions.
+   */
+
+  typedef enum
+  {
+    ARM_CONVERT_TRUNCATE = 0,    /**< truncation, as in the float_to_x and q31_to_x functions. */
+    ARM_CONVERT_ROUND = 1,       /**< rounding to the nearest value. */
+    ARM_CONVERT_DITHER_TPDF = 2  /**< TPDF dither of +/-1 LSB followed by rounding. */
+  } arm_convert_mode;
+
+  /**
+   * @brief Instance structure for the dithered conversions.
+   */
+
+  typedef struct
+  {
+    uint32_t state[8];          /**< states of the eight xorshift32 dither generators. */
+    arm_convert_mode mode;      /**< rounding mode. */
+    uint8_t countFlag;          /**< flag that enables (countFlag=1) or disables (countFlag=0) the saturation count. */
+  } arm_convert_instance;
+
+  /**
+   * @brief  Steps a dither generator.
+   * @param[in,out] *pState points to the state of the xorshift32 generator.
+   * @return the new state, whose two halves give the dither of two samples.
+   */
+  static __INLINE uint32_t arm_convert_xorshift(
+  uint32_t * pState)
+  {
+    uint32_t x = *pState;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *pState = x;
+
+    return (x);
+  }
+
+  /**
+   * @brief  Returns the TPDF value of the lower half of a generator value.
+   * @param[in] x value of a dither generator.
+   * @return the difference of its two lower bytes in the range [-0xFF 0xFF], in units of 2^-8 LSB.
+   */
+  static __INLINE q31_t arm_convert_tpdf(
+  uint32_t x)
+  {
+    return ((q31_t) (x & 0xFFu) - (q31_t) ((x >> 8) & 0xFFu));
+  }
+
+  /**
+   * @brief  Initialization function for the dithered conversions.
+   * @param[out]  *S points to an instance of the conversion structure.
+   * @param[in]   mode rounding mode of the conversions.
+   * @param[in]   countFlag flag that enables (countFlag=1) or disables (countFlag=0) the saturation count.
+   * @param[in]   seed seed of the dither generators.
+   * @return none.
+   */
+  void arm_convert_init(
+  arm_convert_instance * S,
+  arm_convert_mode mode,
+  uint8_t countFlag,
+  uint32_t seed);
+
+  /**
+   * @brief  Converts the elements of the floating-point vector to Q31 vector with dither.
+   * @param[in,out] *S points to an instance of the conversion structure.
+   * @param[in]  *pSrc points to the floating-point input vector.
+   * @param[out] *pDst points to the Q31 output vector.
+   * @param[in]  blockSize length of the input vector.
+   * @return number of saturated samples, 0 if the count is disabled.
+   */
+  uint32_t arm_convert_float_to_q31(
+  arm_convert_instance * S,
+  float32_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Converts the elements of the floating-point vector to Q15 vector with dither.
+   * @param[in,out] *S points to an instance of the conversion structure.
+   * @param[in]  *pSrc points to the floating-point input vector.
+   * @param[out] *pDst points to the Q15 output vector.
+   * @param[in]  blockSize length of the input vector.
+   * @return number of saturated samples, 0 if the count is disabled.
+   */
+  uint32_t arm_convert_float_to_q15(
+  arm_convert_instance * S,
+  float32_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Converts the elements of the floating-point vector to Q7 vector with dither.
+   * @param[in,out] *S points to an instance of the conversion structure.
+   * @param[in]  *pSrc points to the floating-point input vector.
+   * @param[out] *pDst points to the Q7 output vector.
+   * @param[in]  blockSize length of the input vector.
+   * @return number of saturated samples, 0 if the count is disabled.
+   */
+  uint32_t arm_convert_float_to_q7(
+  arm_convert_instance * S,
+  float32_t * pSrc,
+  q7_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Converts the elements of the Q31 vector to Q15 vector with dither.
+   * @param[in,out] *S points to an instance of the conversion structure.
+   * @param[in]  *pSrc points to the Q31 input vector.
+   * @param[out] *pDst points to the Q15 output vector.
+   * @param[in]  blockSize length of the input vector.
+   * @return number of saturated samples, 0 if the count is disabled.
+   */
+  uint32_t arm_convert_q31_to_q15(
+  arm_convert_instance * S,
+  q31_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
   /**
    * @ingroup groupInterpolation
    */
@@ -0,0 +1,85 @@
+/**
+ * @file         align.h
+ * @version      1.0
+ * @date         2015
+ * @author       Christoph Lauer
+ * @compiler     armcc
+ * @copyright    Christoph Lauer engineering
+ */
+
+#ifndef __ALIGN_H
+#define __ALIGN_H
+
+#include <stdint.h>
+
+/*
+ * Delay estimation between a reference stream, the signal sent to the codec, and the captured
+ * stream of the microphone, with the generalized cross correlation and the phase transform
+ * (GCC-PHAT). The time domain correlation costs ALIGN_RANGE multiplications per sample; here a
+ * frame of ALIGN_REF_LEN reference samples and the ALIGN_CAP_LEN captured samples that follow
+ * it are transformed with two real FFTs of ALIGN_FFT_LEN points, which are long enough for the
+ * correlation of the two frames not to wrap around. The cross spectra of the frames are
+ * averaged with a forgetting factor. An estimate divides every bin of the average by its
+ * magnitude, which keeps only the phases and turns the correlation into a sharp peak at the
+ * delay whatever the spectrum of the signals. The inverse FFT gives the correlation at every
+ * lag, the largest value is searched between ALIGN_BULK and ALIGN_BULK + ALIGN_RANGE samples,
+ * and a parabola through the three values around it places the peak to a fraction of a sample.
+ *
+ * pushAlign() only copies the blocks into a ring per stream. dsp() calls it from fill_buffer()
+ * in the main loop, and it is not safe to call from an interrupt. runAlign() does one step of
+ * the FFT work per call in the same loop while it waits for the next buffer: the update with
+ * the next frame, or an estimate every ALIGN_FRAMES frames. Frames the background could not
+ * take in time are skipped and counted. The CPU cycles of the last update and of the last
+ * estimate are measured with the cycle counter and published with the result.
+ */
+#define ALIGN_FFT_LEN   2048                              // real FFT length
+#define ALIGN_REF_LEN   512                               // reference samples per frame, the frame step
+#define ALIGN_CAP_LEN   (ALIGN_FFT_LEN - ALIGN_REF_LEN)   // captured samples per frame
+#define ALIGN_BULK      512                               // shortest delay searched, in samples
+#define ALIGN_RANGE     (ALIGN_CAP_LEN - ALIGN_REF_LEN)   // lags searched above ALIGN_BULK
+#define ALIGN_FRAMES    8                                 // frames per estimate
+#define ALIGN_RING      4096                              // samples kept per stream, a power of two
+
+enum
+{
+  ALIGN_REFERENCE,                    // the signal to the codec
+  ALIGN_CAPTURED,                     // the microphone signal
+  ALIGN_STREAMS
+};
+
+typedef struct
+{
+  float samples;                      // delay of the captured stream behind the reference
+  float ms;                           // the same in milliseconds
+  float peak;                         // height of the correlation peak, at most 1
+  int valid;                          // the peak stands out enough to trust the delay
+  uint32_t frames;                    // frames averaged since the start
+  uint32_t skipped;                   // frames skipped because the background was late
+  uint32_t updateCycles;              // CPU cycles of the last frame update
+  uint32_t estimateCycles;            // CPU cycles of the last estimate
+} align_t;
+
+/*
+ * Clears the streams and the average, and starts the cycle counter. The sample rate only
+ * converts the delay to milliseconds.
+ */
+void initAlign(int sampleRate);
+
+/*
+ * Appends a block to a stream. Both streams must be pushed with the same blocks, the
+ * reference at most ALIGN_RING - ALIGN_FFT_LEN samples behind the captured stream.
+ */
+void pushAlign(int stream, const int16_t* buffer, int length);
+
+/*
+ * Does the next step of the estimation, if the samples for it are there. Returns 1 when the
+ * step published a new estimate, 0 otherwise.
+ */
+int runAlign(void);
+
+/*
+ * Copies the last published estimate.
+ */
+void readAlign(align_t* estimate);
+
+#endif
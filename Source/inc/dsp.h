@@ -14,5 +14,8 @@
 
 void dsp(int16_t* buffer, int length);
 void initFilter(void);
+float dspGainReduction(void);
+char dspDtmfDigit(void);
+void dspBackground(void);
 
 #endif
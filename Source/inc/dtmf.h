@@ -0,0 +1,66 @@
+/**
+ * @file         dtmf.h
+ * @version      1.0
+ * @date         2015
+ * @author       Christoph Lauer
+ * @compiler     armcc
+ * @copyright    Christoph Lauer engineering
+ */
+
+#ifndef __DTMF_H
+#define __DTMF_H
+
+#include <stdint.h>
+
+/*
+ * Decoder of the telephone keypad tones (DTMF). A bank of eight Goertzel resonators measures
+ * the power of the four row and the four column tones over windows of DTMF_WINDOW samples.
+ * The windows run on across the blocks, so any block length works. A window holds a digit if
+ * the strongest row and column tones are loud enough, dominate the other tones of their
+ * group, stay within the allowed twist and carry most of the signal energy.
+ *
+ * A digit is reported after two consecutive windows with it, and once per key press: the
+ * decoder re-arms after a window without a digit. At 16 kHz a window is 16 ms, so tones of
+ * 48 ms and pauses of 32 ms are always detected. The digits go into a queue: dsp() writes
+ * it from fill_buffer() in the main loop and the same loop reads it after each block, so
+ * writer and reader never run concurrently.
+ */
+#define DTMF_TONES      8             // four row and four column tones
+#define DTMF_WINDOW     256           // samples per window at 16 kHz, 62.5 Hz resolution
+#define DTMF_QUEUE_SIZE 16            // digits the queue holds, a power of two
+
+typedef struct
+{
+  float coeff[DTMF_TONES];            // 2 cos(w) of the resonators
+  float s1[DTMF_TONES];               // resonator states s(n-1)
+  float s2[DTMF_TONES];               // resonator states s(n-2)
+  float energy;                       // energy of the samples of the window
+  int count;                          // samples of the window so far
+  int window;                         // samples per window
+  char candidate;                     // digit of the last window, 0 if none
+  char reported;                      // digit reported for the current key press, 0 if none
+  char queue[DTMF_QUEUE_SIZE];        // detected digits
+  volatile uint32_t head;             // digits written, by dsp()
+  volatile uint32_t tail;             // digits read, by readDtmf()
+  uint32_t overruns;                  // digits lost on a full queue
+} dtmf_t;
+
+/*
+ * Initializes the decoder for the sample rate in Hz, with windows of the same duration as
+ * DTMF_WINDOW samples at 16 kHz.
+ */
+void initDtmf(dtmf_t* dtmf, int sampleRate);
+
+/*
+ * Runs the decoder over a block and queues the detected digits. Only one context may
+ * process a decoder.
+ */
+void processDtmf(dtmf_t* dtmf, const int16_t* buffer, int length);
+
+/*
+ * Returns the next detected digit, '0' to '9', '*', '#' or 'A' to 'D', or 0 if the queue is
+ * empty. Only one context may read a decoder.
+ */
+char readDtmf(dtmf_t* dtmf);
+
+#endif
@@ -13,10 +13,11 @@
 
 /*
  * This function is called by the wav recorder (i.e. microphone sampler) when PCM samples from the
- * microphone are ready. Here we store them into the circular microphone data buffer and check for
- * possibly clipped values (which we use to flash the red LED as a warning). Note that we assume
- * that the data will be removed from the buffer in time, so we do not check the mic_tail pointer
- * for buffer overrun.
+ * microphone are ready. Here we store them into the circular microphone data buffer. Clipped
+ * samples are counted by the input meter of the dsp chain, and the red LED flashes when they
+ * occur or when the limiter at the end of the chain reduces the gain. Note that we assume that
+ * the data will be removed from the buffer in time, so we do not check the mic_tail pointer for
+ * buffer overrun.
  */
 void WaveRecorderCallback (int16_t *buffer, int num_samples);
 void WavePlayBack(uint32_t AudioFreq);
@@ -58,7 +59,8 @@ uint16_t EVAL_AUDIO_GetSampleCallBack(void);
  * another project). Note that you can get a pretty long delay by increasing
  * the size of the buffers (and these don't count toward the 32K max). There
  * are some delay values that, when played back in headphones, make it almost
- * impossible to talk. Big fun!
+ * impossible to talk. Big fun! With TEST_TONE set in headphone.c, the
+ * microphone is replaced by a two tone test signal from the oscillator bank.
  */
 static void fill_buffer (int16_t *buffer, int num_samples);
 
@@ -0,0 +1,58 @@
+/**
+ * @file         limiter.h
+ * @version      1.0
+ * @date         2015
+ * @author       Christoph Lauer
+ * @compiler     armcc
+ * @copyright    Christoph Lauer engineering
+ */
+
+#ifndef __LIMITER_H
+#define __LIMITER_H
+
+#include <stdint.h>
+
+/*
+ * Lookahead peak limiter and compressor for the end of the dsp chain. The gain is computed
+ * once per segment of LIMITER_SEGMENT samples from the block peak of the segment and linearly
+ * interpolated between these control points, so the cost per sample is one multiply. The
+ * output is delayed by the lookahead, which lets the gain come down before a peak arrives:
+ * no output sample exceeds the threshold of a limiter, whatever the attack time.
+ */
+#define LIMITER_SEGMENT       16      // samples per gain control point (1ms at 16KHz)
+#define LIMITER_MAX_LOOKAHEAD 8       // longest lookahead in segments
+#define LIMITER_RATIO_INF     0.0f    // ratio of a limiter
+
+typedef struct
+{
+  float threshold;                    // linear threshold, 1.0 is full scale
+  float slope;                        // 1/ratio - 1 of the static curve, -1 for a limiter
+  float attack;                       // smoothing coefficients per control point
+  float release;
+  float gain;                         // gain at the last control point
+  float minGain;                      // smallest gain of the last block
+  float target[LIMITER_MAX_LOOKAHEAD + 1];                   // gain targets, oldest (the output segment) first
+  int16_t delay[LIMITER_MAX_LOOKAHEAD * LIMITER_SEGMENT];    // lookahead delay line, one slot per segment
+  int lookahead;                      // lookahead in segments
+  int slot;                           // delay line slot of the oldest segment
+} limiter_t;
+
+/*
+ * Initializes the limiter and clears its delay line. The threshold is in dBFS, the ratio is
+ * LIMITER_RATIO_INF for a limiter or above 1 for a compressor, and the lookahead is rounded
+ * up to whole segments, 1 to LIMITER_MAX_LOOKAHEAD.
+ */
+void initLimiter(limiter_t* lim, int sampleRate, float thresholdDb, float ratio,
+                 float attackMs, float releaseMs, float lookaheadMs);
+
+/*
+ * Processes a block in place. The length must be a multiple of LIMITER_SEGMENT.
+ */
+void processLimiter(limiter_t* lim, int16_t* buffer, int length);
+
+/*
+ * Returns the largest gain reduction of the last block in dB, positive or zero.
+ */
+float limiterGainReduction(const limiter_t* lim);
+
+#endif
@@ -0,0 +1,55 @@
+/**
+ * @file         meter.h
+ * @version      1.0
+ * @date         2015
+ * @author       Christoph Lauer
+ * @compiler     armcc
+ * @copyright    Christoph Lauer engineering
+ */
+
+#ifndef __METER_H
+#define __METER_H
+
+#include <stdint.h>
+
+/*
+ * Block level metering of the tap points in the dsp chain. Every block is measured in one
+ * pass without per-sample branches, and the results are published as a lock-free snapshot
+ * per tap. A snapshot carries a sequence counter that is odd while it is written, so the
+ * main loop and a debugger reading over the debug link at any time get a consistent copy
+ * without disabling the interrupts: read the counter, copy the snapshot, read the counter
+ * again and retry when it was odd or has changed.
+ */
+#define METER_CLIP_LEVEL 32700        // magnitude counted as a clipped sample
+
+enum
+{
+  METER_INPUT,                        // the microphone signal at the start of the chain
+  METER_EFFECT,                       // the output of the effect, before the limiter
+  METER_OUTPUT,                       // the signal to the codec
+  METER_TAPS
+};
+
+typedef struct
+{
+  int16_t peak;                       // largest magnitude, 32767 is full scale
+  int16_t rms;                        // root mean square
+  int16_t dc;                         // mean of the block
+  uint16_t clips;                     // samples at or above METER_CLIP_LEVEL in the block
+  uint32_t clipTotal;                 // clipped samples since the start
+  uint32_t blocks;                    // number of blocks measured since the start
+} meter_t;
+
+/*
+ * Measures a block at a tap point and publishes the snapshot. Only one context may update
+ * a tap. The length must be even.
+ */
+void updateMeter(int tap, const int16_t* buffer, int length);
+
+/*
+ * Copies the last consistent snapshot of a tap. If the snapshot is updated while it is
+ * copied, the copy is repeated.
+ */
+void readMeter(int tap, meter_t* snapshot);
+
+#endif
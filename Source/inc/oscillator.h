@@ -0,0 +1,68 @@
+/**
+ * @file         oscillator.h
+ * @version      1.0
+ * @date         2015
+ * @author       Christoph Lauer
+ * @compiler     armcc
+ * @copyright    Christoph Lauer engineering
+ */
+
+#ifndef __OSCILLATOR_H
+#define __OSCILLATOR_H
+
+#include <stdint.h>
+
+/*
+ * Bank of sine oscillators (numerically controlled oscillators) for test signals and
+ * modulation. Every voice has a 32 bit phase accumulator, a full turn being 2^32, so the
+ * frequency resolution is sampleRate / 2^32 and the phase wraps for free. All voices read
+ * one shared sine table of OSC_TABLE_SIZE entries with linear interpolation; at 1024
+ * entries the interpolation error stays below the 16 bit quantization.
+ */
+#define OSC_MAX_VOICES  8             // voices per bank
+#define OSC_TABLE_BITS  10            // log2 of the sine table size
+#define OSC_TABLE_SIZE  (1 << OSC_TABLE_BITS)
+
+typedef struct
+{
+  uint32_t phase[OSC_MAX_VOICES];     // phase accumulators, a full turn is 2^32
+  uint32_t increment[OSC_MAX_VOICES]; // phase increments per sample
+  int16_t amplitude[OSC_MAX_VOICES];  // q15 amplitudes
+  int voices;                         // number of voices in use
+  float sampleRate;
+} oscillator_t;
+
+/*
+ * Initializes a bank of 1 to OSC_MAX_VOICES silent voices at phase zero, and the shared
+ * sine table on the first call.
+ */
+void initOscillators(oscillator_t* osc, int sampleRate, int voices);
+
+/*
+ * Sets the frequency in Hz and the linear amplitude, 0 to 1, of a voice. The phase runs on,
+ * so the change is free of clicks.
+ */
+void setOscillator(oscillator_t* osc, int voice, float frequency, float amplitude);
+
+/*
+ * Sets the phase of a voice in turns, 0 to 1, e.g. 0.25 for a cosine.
+ */
+void setOscillatorPhase(oscillator_t* osc, int voice, float phase);
+
+/*
+ * Writes the saturated sum of all the voices of the bank into the buffer, as a test signal.
+ */
+void renderOscillators(oscillator_t* osc, int16_t* buffer, int length);
+
+/*
+ * Writes a single voice into the buffer, as a modulation source at the sample rate.
+ */
+void renderOscillator(oscillator_t* osc, int voice, int16_t* buffer, int length);
+
+/*
+ * Returns the current q15 value of a voice and advances its phase by the given number of
+ * samples, as a modulation source at the block rate.
+ */
+int16_t stepOscillator(oscillator_t* osc, int voice, int samples);
+
+#endif
@@ -0,0 +1,202 @@
+/**
+ * @file         align.c
+ * @version      1.0
+ * @date         2015
+ * @author       Christoph Lauer
+ * @compiler     armcc
+ * @copyright    Christoph Lauer engineering
+ */
+
+// local includes
+#include <align.h>
+
+// arm cmsis library includes
+#define ARM_MATH_CM4
+#include "stm32f4xx.h"
+#include <arm_math.h>
+
+// arm c library includes
+#include <string.h>
+
+// the cycle counter of the data watchpoint and trace unit, which the core header of this
+// project does not define
+#define DWT_CTRL   (*(volatile uint32_t*)0xE0001000)
+#define DWT_CYCCNT (*(volatile uint32_t*)0xE0001004)
+
+#define ALIGN_ALPHA     0.875f        // weight of the past frames in the average, 8 frames
+#define ALIGN_FLOOR     1.0e-6f       // bins 120 dB below the strongest are left out
+#define ALIGN_MIN_RATIO 6.0f          // peak over the rms of the lags searched, for a valid estimate
+
+// the last ALIGN_RING samples of each stream, and the samples pushed since the start. The
+// writer updates the count after the samples, the reader checks it after the copy.
+static int16_t rings[ALIGN_STREAMS][ALIGN_RING];
+static volatile uint32_t totals[ALIGN_STREAMS];
+
+// the transforms and their buffers, used by the background only
+static arm_rfft_instance_f32 rfft, rifft;
+static arm_cfft_radix4_instance_f32 cfft, cifft;
+static float cross[ALIGN_FFT_LEN + 2];          // average cross spectrum, bins 0 to N/2
+static float refSpectrum[ALIGN_FFT_LEN + 2];    // spectrum of the reference frame
+static float spectrum[2 * ALIGN_FFT_LEN];       // the real FFT writes all the N bins
+static float frame[ALIGN_FFT_LEN + 2];          // a frame, then the correlation
+static uint32_t next;                           // start of the next reference frame
+static int pending;                             // frames since the last estimate
+static int rate;
+static align_t result;
+
+void initAlign(int sampleRate)
+{
+  memset(rings, 0, sizeof(rings));
+  totals[ALIGN_REFERENCE] = 0;
+  totals[ALIGN_CAPTURED] = 0;
+  memset(cross, 0, sizeof(cross));
+  memset(&result, 0, sizeof(result));
+  next = 0;
+  pending = 0;
+  rate = sampleRate;
+
+  arm_rfft_init_f32(&rfft, &cfft, ALIGN_FFT_LEN, 0, 1);
+  arm_rfft_init_f32(&rifft, &cifft, ALIGN_FFT_LEN, 1, 1);
+
+  // the cycle counter needs the trace unit
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT_CTRL |= 1;
+}
+
+void pushAlign(int stream, const int16_t* buffer, int length)
+{
+  uint32_t total = totals[stream];
+  int16_t* ring = rings[stream];
+  int n;
+
+  for (n = 0; n < length; n++)
+    ring[(total + n) & (ALIGN_RING - 1)] = buffer[n];
+
+  totals[stream] = total + length;
+}
+
+// converts length samples of a stream from start on into the frame and pads it with zeros.
+// Returns 0 if the writer has overwritten some of them meanwhile.
+static int load(int stream, uint32_t start, int length)
+{
+  int first = ALIGN_RING - (start & (ALIGN_RING - 1));
+
+  if (first > length)
+    first = length;
+
+  arm_q15_to_float(&rings[stream][start & (ALIGN_RING - 1)], frame, first);
+  arm_q15_to_float(rings[stream], frame + first, length - first);
+  arm_fill_f32(0.0f, frame + length, ALIGN_FFT_LEN - length);
+
+  return totals[stream] - start <= ALIGN_RING;
+}
+
+// the correlation with the phase transform, and the peak in the lags searched
+static void locate(void)
+{
+  float magnitude, scale, limit, peak, rms, before, after, curve, offset = 0.0f;
+  uint32_t index;
+  int k;
+
+  // the magnitudes of the bins go to the frame first, which is free until the inverse FFT
+  arm_cmplx_mag_f32(cross, frame, ALIGN_FFT_LEN / 2 + 1);
+  arm_max_f32(frame, ALIGN_FFT_LEN / 2 + 1, &limit, &index);
+  limit *= ALIGN_FLOOR;
+
+  for (k = 0; k <= ALIGN_FFT_LEN / 2; k++)
+  {
+    magnitude = frame[k];
+    scale = (magnitude > limit) ? 1.0f / magnitude : 0.0f;
+    spectrum[2 * k] = cross[2 * k] * scale;
+    spectrum[2 * k + 1] = cross[2 * k + 1] * scale;
+  }
+
+  // the lag k of the captured frame behind the reference frame is at index k, the negative
+  // lags at the end of the frame
+  arm_rfft_f32(&rifft, spectrum, frame);
+  arm_max_f32(frame, ALIGN_RANGE + 1, &peak, &index);
+  arm_rms_f32(frame, ALIGN_RANGE + 1, &rms);
+
+  // the parabola through the peak and its neighbours, which are valid lags at both ends
+  before = frame[(index - 1) & (ALIGN_FFT_LEN - 1)];
+  after = frame[index + 1];
+  curve = before - 2.0f * peak + after;
+  if (curve < 0.0f)
+  {
+    offset = 0.5f * (before - after) / curve;
+    peak -= 0.25f * (before - after) * offset;
+  }
+
+  result.samples = (float)(ALIGN_BULK + index) + offset;
+  result.ms = result.samples * 1000.0f / (float)rate;
+  result.peak = peak;
+  result.valid = peak >= ALIGN_MIN_RATIO * rms;
+}
+
+int runAlign(void)
+{
+  uint32_t start = DWT_CYCCNT;
+
+  // an estimate every ALIGN_FRAMES frames, as a step of its own
+  if (pending >= ALIGN_FRAMES)
+  {
+    locate();
+    pending = 0;
+    result.estimateCycles = DWT_CYCCNT - start;
+    return 1;
+  }
+
+  // the captured frame follows the reference frame by ALIGN_BULK samples
+  if (totals[ALIGN_CAPTURED] < next + ALIGN_BULK + ALIGN_CAP_LEN ||
+      totals[ALIGN_REFERENCE] < next + ALIGN_REF_LEN)
+    return 0;
+
+  // a late background skips the frames that are leaving the rings
+  while (totals[ALIGN_CAPTURED] - next > ALIGN_RING)
+  {
+    next += ALIGN_REF_LEN;
+    result.skipped++;
+  }
+
+  // the reference spectrum, conjugated
+  if (!load(ALIGN_REFERENCE, next, ALIGN_REF_LEN))
+  {
+    next += ALIGN_REF_LEN;
+    result.skipped++;
+    return 0;
+  }
+  arm_rfft_f32(&rfft, frame, spectrum);
+  arm_cmplx_conj_f32(spectrum, refSpectrum, ALIGN_FFT_LEN / 2 + 1);
+
+  // the captured spectrum times the conjugated reference spectrum, bins 0 to N/2
+  if (!load(ALIGN_CAPTURED, next + ALIGN_BULK, ALIGN_CAP_LEN))
+  {
+    next += ALIGN_REF_LEN;
+    result.skipped++;
+    return 0;
+  }
+  arm_rfft_f32(&rfft, frame, spectrum);
+  arm_cmplx_mult_cmplx_f32(spectrum, refSpectrum, spectrum, ALIGN_FFT_LEN / 2 + 1);
+
+  // the average with the forgetting factor, which starts from the first frame
+  if (result.frames == 0)
+    arm_copy_f32(spectrum, cross, ALIGN_FFT_LEN + 2);
+  else
+  {
+    arm_scale_f32(cross, ALIGN_ALPHA, cross, ALIGN_FFT_LEN + 2);
+    arm_scale_f32(spectrum, 1.0f - ALIGN_ALPHA, spectrum, ALIGN_FFT_LEN + 2);
+    arm_add_f32(cross, spectrum, cross, ALIGN_FFT_LEN + 2);
+  }
+
+  next += ALIGN_REF_LEN;
+  pending++;
+  result.frames++;
+  result.updateCycles = DWT_CYCCNT - start;
+
+  return 0;
+}
+
+void readAlign(align_t* estimate)
+{
+  *estimate = result;
+}
@@ -8,7 +8,11 @@
  */
  
  // local includes
+#include <align.h>
 #include <dsp.h>
+#include <dtmf.h>
+#include <limiter.h>
+#include <meter.h>
 
 // arm cmsis library includes
 #define ARM_MATH_CM4
@@ -24,6 +28,7 @@ int old_user_mode;
 
 #define NUM_FIR_TAPS 56
 #define BLOCKSIZE    512
+#define SAMPLE_RATE  16000
 
 // allocate the buffer signals and the filter coefficients on the heap
 arm_fir_instance_q15 FIR;
@@ -45,9 +50,37 @@ q15_t fir_coeffs_hp[NUM_FIR_TAPS] = { -654,  483,  393,  321,  222,   76, -108,
 q15_t fir_state[NUM_FIR_TAPS + BLOCKSIZE];
 bool firstStart = false;
 
+// the output limiter at -1dBFS with 2ms lookahead, so no effect can clip the codec
+limiter_t limiter;
+bool limiterStarted = false;
+
+// the keypad tone decoder on the microphone signal
+dtmf_t dtmf;
+bool dtmfStarted = false;
+
+// the delay from the codec output back to the microphone, estimated in the background
+bool alignStarted = false;
+
 // the core dsp function
 void dsp(int16_t* buffer, int length)
 {
+  updateMeter(METER_INPUT, buffer, length);
+
+  // the decoder listens to the input, so the effects cannot hide the tones
+  if (dtmfStarted == false)
+  {
+    initDtmf(&dtmf, SAMPLE_RATE);
+    dtmfStarted = true;
+  }
+  processDtmf(&dtmf, buffer, length);
+
+  if (alignStarted == false)
+  {
+    initAlign(SAMPLE_RATE);
+    alignStarted = true;
+  }
+  pushAlign(ALIGN_CAPTURED, buffer, length);
+
 	// only enable the filter if the user button is pressed
 	if (user_mode & 1)
 	{
@@ -65,6 +98,38 @@ void dsp(int16_t* buffer, int length)
   	// copy the result
 	  arm_copy_q15(outSignal, buffer, length);
   }
+
+  updateMeter(METER_EFFECT, buffer, length);
+
+  // the limiter runs on every block as the last stage of the chain
+  if (limiterStarted == false)
+  {
+    initLimiter(&limiter, SAMPLE_RATE, -1.0f, LIMITER_RATIO_INF, 1.0f, 100.0f, 2.0f);
+    limiterStarted = true;
+  }
+  processLimiter(&limiter, buffer, length);
+
+  updateMeter(METER_OUTPUT, buffer, length);
+  pushAlign(ALIGN_REFERENCE, buffer, length);
+}
+
+// the work that runs while the main loop waits for the next buffer
+void dspBackground()
+{
+  if (alignStarted)
+    runAlign();
+}
+
+// the gain reduction of the limiter in dB over the last block
+float dspGainReduction()
+{
+  return limiterGainReduction(&limiter);
+}
+
+// the next keypad digit decoded from the input, or 0 if there is none
+char dspDtmfDigit()
+{
+  return readDtmf(&dtmf);
 }
 
 // we initialize and switch the filter here
@@ -0,0 +1,195 @@
+/**
+ * @file         dtmf.c
+ * @version      1.0
+ * @date         2015
+ * @author       Christoph Lauer
+ * @compiler     armcc
+ * @copyright    Christoph Lauer engineering
+ */
+
+// local includes
+#include <dtmf.h>
+
+// arm cmsis library includes
+#define ARM_MATH_CM4
+#include "stm32f4xx.h"
+#include <arm_math.h>
+
+// arm c library includes
+#include <string.h>
+
+// the row tones in the first and the column tones in the second half of the bank
+static const float tones[DTMF_TONES] = { 697.0f, 770.0f, 852.0f, 941.0f,
+                                         1209.0f, 1336.0f, 1477.0f, 1633.0f };
+static const char keys[4][4] = { { '1', '2', '3', 'A' },
+                                 { '4', '5', '6', 'B' },
+                                 { '7', '8', '9', 'C' },
+                                 { '*', '0', '#', 'D' } };
+
+// the detection limits as power ratios
+#define DTMF_MIN_LEVEL     0.01f      // amplitude of each tone, -40 dBFS
+#define DTMF_TWIST_NORMAL  6.31f      // column tone louder than the row tone, 8 dB
+#define DTMF_TWIST_REVERSE 2.51f      // row tone louder than the column tone, 4 dB
+#define DTMF_DOMINANCE     6.31f      // over the other tones of the group, 8 dB
+#define DTMF_ENERGY_RATIO  0.6f       // share of the window energy in the two tones
+
+void initDtmf(dtmf_t* dtmf, int sampleRate)
+{
+  int i;
+
+  memset(dtmf, 0, sizeof(dtmf_t));
+  dtmf->window = (DTMF_WINDOW * sampleRate + 8000) / 16000;
+  for (i = 0; i < DTMF_TONES; i++)
+    dtmf->coeff[i] = 2.0f * arm_cos_f32(2.0f * PI * tones[i] / (float)sampleRate);
+}
+
+// the index of the strongest of the four tones, and the dominance test against the others
+static int strongest(const float* power, int* dominant)
+{
+  int i, best = 0;
+
+  for (i = 1; i < 4; i++)
+    if (power[i] > power[best])
+      best = i;
+
+  *dominant = 1;
+  for (i = 0; i < 4; i++)
+    if (i != best && power[i] * DTMF_DOMINANCE > power[best])
+      *dominant = 0;
+
+  return best;
+}
+
+// the digit of a complete window, or 0
+static char detect(dtmf_t* dtmf)
+{
+  float power[DTMF_TONES], minPower, half = 0.5f * (float)dtmf->window;
+  float s1, s2;
+  int i, row, col, rowDominant, colDominant;
+
+  // the power at the tone of a resonator, the squared magnitude of the dft at its frequency:
+  // a tone of amplitude a gives (a * window / 2)^2
+  for (i = 0; i < DTMF_TONES; i++)
+  {
+    s1 = dtmf->s1[i];
+    s2 = dtmf->s2[i];
+    power[i] = s1 * s1 + s2 * s2 - dtmf->coeff[i] * s1 * s2;
+  }
+
+  row = strongest(&power[0], &rowDominant);
+  col = strongest(&power[4], &colDominant);
+
+  // the level of each tone in the full scale of 32768
+  minPower = DTMF_MIN_LEVEL * 32768.0f * half;
+  minPower *= minPower;
+
+  if (!rowDominant || !colDominant)
+    return 0;
+  if (power[row] < minPower || power[4 + col] < minPower)
+    return 0;
+  if (power[4 + col] > power[row] * DTMF_TWIST_NORMAL)
+    return 0;
+  if (power[row] > power[4 + col] * DTMF_TWIST_REVERSE)
+    return 0;
+
+  // a tone of power p carries p / (window / 2) of the energy of the window, so speech and
+  // noise with some energy at the tones are rejected
+  if (power[row] + power[4 + col] < DTMF_ENERGY_RATIO * half * dtmf->energy)
+    return 0;
+
+  return keys[row][col];
+}
+
+// the debounce at the end of a window, and the queue for the main loop
+static void endWindow(dtmf_t* dtmf)
+{
+  char digit = detect(dtmf);
+
+  if (digit == 0)
+    dtmf->reported = 0;
+  else if (digit == dtmf->candidate && digit != dtmf->reported)
+  {
+    if (dtmf->head - dtmf->tail < DTMF_QUEUE_SIZE)
+    {
+      dtmf->queue[dtmf->head & (DTMF_QUEUE_SIZE - 1)] = digit;
+      dtmf->head++;
+    }
+    else
+      dtmf->overruns++;
+    dtmf->reported = digit;
+  }
+  dtmf->candidate = digit;
+
+  memset(dtmf->s1, 0, sizeof(dtmf->s1));
+  memset(dtmf->s2, 0, sizeof(dtmf->s2));
+  dtmf->energy = 0.0f;
+  dtmf->count = 0;
+}
+
+void processDtmf(dtmf_t* dtmf, const int16_t* buffer, int length)
+{
+  float x, t, energy;
+  float ca, a1, a2, cb, b1, b2;
+  int i, n, samples;
+
+  while (length > 0)
+  {
+    // the samples up to the end of the window or of the block
+    samples = dtmf->window - dtmf->count;
+    if (samples > length)
+      samples = length;
+
+    // two resonators per pass over the samples, with the states in registers: every sample
+    // is loaded once for both, and the two independent recursions fill the fpu pipeline
+    for (i = 0; i < DTMF_TONES; i += 2)
+    {
+      ca = dtmf->coeff[i];
+      a1 = dtmf->s1[i];
+      a2 = dtmf->s2[i];
+      cb = dtmf->coeff[i + 1];
+      b1 = dtmf->s1[i + 1];
+      b2 = dtmf->s2[i + 1];
+      for (n = 0; n < samples; n++)
+      {
+        x = (float)buffer[n];
+        t = x + ca * a1 - a2;
+        a2 = a1;
+        a1 = t;
+        t = x + cb * b1 - b2;
+        b2 = b1;
+        b1 = t;
+      }
+      dtmf->s1[i] = a1;
+      dtmf->s2[i] = a2;
+      dtmf->s1[i + 1] = b1;
+      dtmf->s2[i + 1] = b2;
+    }
+
+    energy = 0.0f;
+    for (n = 0; n < samples; n++)
+    {
+      x = (float)buffer[n];
+      energy += x * x;
+    }
+    dtmf->energy += energy;
+
+    dtmf->count += samples;
+    buffer += samples;
+    length -= samples;
+
+    if (dtmf->count == dtmf->window)
+      endWindow(dtmf);
+  }
+}
+
+char readDtmf(dtmf_t* dtmf)
+{
+  char digit;
+
+  if (dtmf->tail == dtmf->head)
+    return 0;
+
+  digit = dtmf->queue[dtmf->tail & (DTMF_QUEUE_SIZE - 1)];
+  dtmf->tail++;
+  return digit;
+}
@@ -12,6 +12,8 @@
 #include <string.h>
 #include <math.h>
 #include <dsp.h>
+#include <meter.h>
+#include <oscillator.h>
 
 static uint8_t volume = 100;
 extern volatile uint8_t LED_Toggle;
@@ -32,6 +34,7 @@ extern volatile int user_mode;
 static int16_t buff0 [OUT_BUFFER_SAMPLES], buff1 [OUT_BUFFER_SAMPLES], micbuff [MIC_BUFFER_SAMPLES];
 static volatile uint16_t mic_head, mic_tail;    // head and tail indices to mic buffer
 static volatile uint8_t next_buff;              // next output buffer to write
+static volatile char dtmf_digit;                // last decoded keypad tone, for the debugger
  
 // These functions will have different instances depending on the global function selected below
 static void fill_init (void);
@@ -39,24 +42,8 @@ static void fill_buffer (int16_t *buffer, int num_samples);
 
 void WaveRecorderCallback (int16_t *buffer, int num_samples)
 {
-    static int clip_timer;
-    int clip = 0, i;
-
-    for (i = 0; i < num_samples; ++i) {
-        int16_t sample = *buffer++;
-        if (sample >= 32700 || sample <= -32700)
-            clip = 1;
-        micbuff [mic_head + i] = sample;
-    }    
+    memcpy (micbuff + mic_head, buffer, num_samples * sizeof (int16_t));
     mic_head = (mic_head + num_samples >= MIC_BUFFER_SAMPLES) ? 0 : mic_head + num_samples;
-    if (clip_timer) {
-        if (!--clip_timer)
-            STM_EVAL_LEDOff(LED5);
-    }
-    else if (clip)
-        STM_EVAL_LEDOn(LED5);
-    if (clip)
-        clip_timer = 50;
 }
 
 void WavePlayBack(uint32_t AudioFreq)
@@ -88,12 +75,15 @@ void WavePlayBack(uint32_t AudioFreq)
    * handles starting the next buffer playing, so we don't need to be worried about that
    * latency here. The functionality of the fill_buffer() function determines what it is
    * that we are doing (e.g., playing tones, echoing the mic, being a nervous dog, etc.)
+   * While we wait, dspBackground() does the work that need not finish with the block.
    */
 
   while (1) {
-    while (next_buff == 1);
+    while (next_buff == 1)
+      dspBackground ();
     fill_buffer (buff0, OUT_BUFFER_SAMPLES);
-    while (next_buff == 0);
+    while (next_buff == 0)
+      dspBackground ();
     fill_buffer (buff1, OUT_BUFFER_SAMPLES);
   }
 }
@@ -136,15 +126,50 @@ uint16_t EVAL_AUDIO_GetSampleCallBack(void)
   return 0;
 }
 
+// set TEST_TONE to 1 to replace the microphone by a test tone at the input of the dsp chain
+#define TEST_TONE 0
+
+#if TEST_TONE
+static oscillator_t tone;
+#endif
+
 static void fill_init (void)
 {
+#if TEST_TONE
+	// 1KHz at -6dBFS and 3KHz at -20dBFS: the low pass mode keeps the first, the high pass the second
+	initOscillators(&tone, SAMPLE_RATE, 2);
+	setOscillator(&tone, 0, 1000.0f, 0.5f);
+	setOscillator(&tone, 1, 3000.0f, 0.1f);
+#endif
 }
 
 static void fill_buffer (int16_t *buffer, int num_samples)
 {
+	static int limit_timer;
 	int count = num_samples / 2;
+	meter_t input;
+	char digit;
 	
+#if TEST_TONE
+	renderOscillators(&tone, micbuff + mic_tail, count);
+#endif
 	dsp(micbuff + mic_tail, count);
+	readMeter(METER_INPUT, &input);
+	
+	// the red LED shows a clipped microphone signal or the output limiter reducing the gain
+	// by more than 1dB, held for 2 blocks
+	if (input.clips || dspGainReduction() > 1.0f) {
+		STM_EVAL_LEDOn(LED5);
+		limit_timer = 2;
+	}
+	else if (limit_timer && !--limit_timer)
+		STM_EVAL_LEDOff(LED5);
+	
+	// keep the last decoded keypad tone for the debugger; the digits only report what the
+	// microphone heard and do not control anything. The queue is drained every block so it
+	// never overruns
+	while ((digit = dspDtmfDigit()) != 0)
+		dtmf_digit = digit;
 	
 	// make mono to stereo here
   while (count--) 
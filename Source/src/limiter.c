@@ -0,0 +1,139 @@
+/**
+ * @file         limiter.c
+ * @version      1.0
+ * @date         2015
+ * @author       Christoph Lauer
+ * @compiler     armcc
+ * @copyright    Christoph Lauer engineering
+ */
+
+// local includes
+#include <limiter.h>
+
+// arm cmsis library includes
+#define ARM_MATH_CM4
+#include "stm32f4xx.h"
+#include <arm_math.h>
+
+// arm c library includes
+#include <math.h>
+#include <string.h>
+
+// the static curve: the gain that brings a segment peak down to the threshold (limiter)
+// or reduces the level above the threshold by the ratio (compressor)
+static float gainTarget(const limiter_t* lim, float peak)
+{
+  if (peak <= lim->threshold)
+    return 1.0f;
+  if (lim->slope == -1.0f)
+    return lim->threshold / peak;
+  return expf(lim->slope * logf(peak / lim->threshold));
+}
+
+// smoothing coefficient per control point of a time constant in ms
+static float timeCoefficient(int sampleRate, float ms)
+{
+  if (ms <= 0.0f)
+    return 1.0f;
+  return 1.0f - expf(-(float)LIMITER_SEGMENT * 1000.0f / (ms * (float)sampleRate));
+}
+
+void initLimiter(limiter_t* lim, int sampleRate, float thresholdDb, float ratio,
+                 float attackMs, float releaseMs, float lookaheadMs)
+{
+  int i, lookahead;
+
+  lim->threshold = powf(10.0f, thresholdDb / 20.0f);
+  lim->slope = (ratio <= 1.0f) ? -1.0f : (1.0f / ratio - 1.0f);
+  lim->attack = timeCoefficient(sampleRate, attackMs);
+  lim->release = timeCoefficient(sampleRate, releaseMs);
+
+  // the lookahead in whole segments, at least one: the gain ramp of a segment needs the next one
+  lookahead = (int)ceilf(lookaheadMs * (float)sampleRate / (1000.0f * LIMITER_SEGMENT));
+  if (lookahead < 1)
+    lookahead = 1;
+  if (lookahead > LIMITER_MAX_LOOKAHEAD)
+    lookahead = LIMITER_MAX_LOOKAHEAD;
+  lim->lookahead = lookahead;
+
+  lim->gain = 1.0f;
+  lim->minGain = 1.0f;
+  for (i = 0; i <= LIMITER_MAX_LOOKAHEAD; i++)
+    lim->target[i] = 1.0f;
+  memset(lim->delay, 0, sizeof(lim->delay));
+  lim->slot = 0;
+}
+
+void processLimiter(limiter_t* lim, int16_t* buffer, int length)
+{
+  int n, i, m = lim->lookahead;
+  q15_t maxVal, minVal, x;
+  uint32_t index;
+  q31_t peak, gain, step;
+  q15_t* delay;
+  float look, required, newGain;
+
+  lim->minGain = 1.0f;
+
+  for (n = length / LIMITER_SEGMENT; n > 0; n--)
+  {
+    // block peak of the newest segment
+    arm_max_q15(buffer, LIMITER_SEGMENT, &maxVal, &index);
+    arm_min_q15(buffer, LIMITER_SEGMENT, &minVal, &index);
+    peak = ((q31_t)maxVal > -(q31_t)minVal) ? (q31_t)maxVal : -(q31_t)minVal;
+
+    // target[0] is now the segment that leaves the delay line, target[m] the newest one
+    for (i = 0; i < m; i++)
+      lim->target[i] = lim->target[i + 1];
+    lim->target[m] = gainTarget(lim, (float)peak / 32768.0f);
+
+    // move towards the smallest target of the lookahead window...
+    look = lim->target[0];
+    for (i = 1; i <= m; i++)
+      if (lim->target[i] < look)
+        look = lim->target[i];
+    newGain = lim->gain + ((look < lim->gain) ? lim->attack : lim->release) * (look - lim->gain);
+
+    // ...but never above the targets of the two segments this control point ends and starts,
+    // then the whole linear ramp is below the target of the output segment
+    required = (lim->target[1] < lim->target[0]) ? lim->target[1] : lim->target[0];
+    if (newGain > required)
+      newGain = required;
+    if (newGain < lim->minGain)
+      lim->minGain = newGain;
+
+    // output the delayed segment with the gain ramp and store the new one in its slot
+    delay = lim->delay + lim->slot * LIMITER_SEGMENT;
+    if (lim->gain >= 1.0f && newGain >= 1.0f)
+    {
+      for (i = 0; i < LIMITER_SEGMENT; i++)
+      {
+        x = delay[i];
+        delay[i] = buffer[i];
+        buffer[i] = x;
+      }
+    }
+    else
+    {
+      // the gain in 2.30 format, so that 1.0 is exact, and 17.15 format for the multiply
+      gain = (q31_t)(lim->gain * 1073741824.0f);
+      step = ((q31_t)(newGain * 1073741824.0f) - gain) / LIMITER_SEGMENT;
+      for (i = 0; i < LIMITER_SEGMENT; i++)
+      {
+        x = delay[i];
+        delay[i] = buffer[i];
+        buffer[i] = (q15_t)(((q31_t)x * (gain >> 15)) >> 15);
+        gain += step;
+      }
+    }
+
+    lim->gain = newGain;
+    lim->slot = (lim->slot + 1 >= m) ? 0 : lim->slot + 1;
+    buffer += LIMITER_SEGMENT;
+  }
+}
+
+float limiterGainReduction(const limiter_t* lim)
+{
+  return -20.0f * log10f(lim->minGain);
+}
@@ -0,0 +1,87 @@
+/**
+ * @file         meter.c
+ * @version      1.0
+ * @date         2015
+ * @author       Christoph Lauer
+ * @compiler     armcc
+ * @copyright    Christoph Lauer engineering
+ */
+
+// local includes
+#include <meter.h>
+
+// arm cmsis library includes
+#define ARM_MATH_CM4
+#include "stm32f4xx.h"
+#include <arm_math.h>
+
+// the snapshot of every tap with its sequence counter, which is odd while the snapshot is
+// written. dsp() writes it from fill_buffer() in the main loop, but a debugger reads the
+// memory over the debug link at any time, so a reader takes the counter before and after
+// the copy and retries when it was odd or has changed. The writer never waits.
+static volatile struct
+{
+  uint32_t sequence;
+  meter_t value;
+} meters[METER_TAPS];
+
+void updateMeter(int tap, const int16_t* buffer, int length)
+{
+  const q15_t* p = buffer;
+  q31_t in, sum = 0;
+  q63_t squares = 0;
+  q15_t x0, x1, max = -32768, min = 32767;
+  uint32_t clips = 0;
+  int32_t peak;
+  int n;
+
+  // one pass over the block: the sum and the sum of squares two samples at a time with the
+  // dual 16 bit multiply accumulate instructions, the extremes and the clip count with
+  // conditional selects
+  for (n = length >> 1; n > 0; n--)
+  {
+    in = *__SIMD32(p)++;
+    sum = __SMLAD(in, 0x00010001, sum);
+    squares = __SMLALD(in, in, squares);
+
+    x0 = (q15_t)in;
+    x1 = (q15_t)(in >> 16);
+    max = (x0 > max) ? x0 : max;
+    min = (x0 < min) ? x0 : min;
+    max = (x1 > max) ? x1 : max;
+    min = (x1 < min) ? x1 : min;
+
+    // a magnitude of METER_CLIP_LEVEL or more wraps the offset sample above the range
+    clips += (uint32_t)(x0 + (METER_CLIP_LEVEL - 1)) > 2u * (METER_CLIP_LEVEL - 1);
+    clips += (uint32_t)(x1 + (METER_CLIP_LEVEL - 1)) > 2u * (METER_CLIP_LEVEL - 1);
+  }
+
+  peak = ((int32_t)max > -(int32_t)min) ? (int32_t)max : -(int32_t)min;
+
+  // the barriers keep the snapshot writes between the two counter updates for a reader on
+  // the bus
+  meters[tap].sequence++;
+  __DMB();
+  meters[tap].value.peak = (int16_t)((peak > 32767) ? 32767 : peak);
+  meters[tap].value.rms = (int16_t)sqrtf((float)squares / (float)length);
+  meters[tap].value.dc = (int16_t)(sum / length);
+  meters[tap].value.clips = (uint16_t)clips;
+  meters[tap].value.clipTotal += clips;
+  meters[tap].value.blocks++;
+  __DMB();
+  meters[tap].sequence++;
+}
+
+void readMeter(int tap, meter_t* snapshot)
+{
+  uint32_t sequence;
+
+  do
+  {
+    sequence = meters[tap].sequence;
+    __DMB();
+    *snapshot = meters[tap].value;
+    __DMB();
+  }
+  while ((sequence & 1) || sequence != meters[tap].sequence);
+}
@@ -0,0 +1,121 @@
+/**
+ * @file         oscillator.c
+ * @version      1.0
+ * @date         2015
+ * @author       Christoph Lauer
+ * @compiler     armcc
+ * @copyright    Christoph Lauer engineering
+ */
+
+// local includes
+#include <oscillator.h>
+
+// arm cmsis library includes
+#define ARM_MATH_CM4
+#include "stm32f4xx.h"
+#include <arm_math.h>
+
+// arm c library includes
+#include <string.h>
+
+// the sine table shared by all the banks, with a guard entry for the interpolation
+static q15_t sineTable[OSC_TABLE_SIZE + 1];
+static int sineTableReady = 0;
+
+// the table index from the upper bits of the phase, the q15 fraction from the next 15 bits
+#define OSC_INDEX(phase)    ((phase) >> (32 - OSC_TABLE_BITS))
+#define OSC_FRACTION(phase) (((phase) >> (17 - OSC_TABLE_BITS)) & 0x7fff)
+
+// linearly interpolated table lookup of a phase; the products below are rounded, as a
+// truncation would add a DC offset and a distortion of about one LSB
+static __INLINE q31_t sine(uint32_t phase)
+{
+  const q15_t* p = &sineTable[OSC_INDEX(phase)];
+  return p[0] + (((p[1] - p[0]) * (q31_t)OSC_FRACTION(phase) + 0x4000) >> 15);
+}
+
+void initOscillators(oscillator_t* osc, int sampleRate, int voices)
+{
+  int i;
+  float x;
+
+  // the table in q15, rounded to the nearest integer
+  if (!sineTableReady)
+  {
+    for (i = 0; i < OSC_TABLE_SIZE; i++)
+    {
+      x = arm_sin_f32(2.0f * PI * i / OSC_TABLE_SIZE) * 32768.0f;
+      sineTable[i] = (q15_t)__SSAT((q31_t)(x + (x > 0.0f ? 0.5f : -0.5f)), 16);
+    }
+    sineTable[OSC_TABLE_SIZE] = sineTable[0];
+    sineTableReady = 1;
+  }
+
+  if (voices < 1)
+    voices = 1;
+  if (voices > OSC_MAX_VOICES)
+    voices = OSC_MAX_VOICES;
+
+  memset(osc, 0, sizeof(oscillator_t));
+  osc->voices = voices;
+  osc->sampleRate = (float)sampleRate;
+}
+
+void setOscillator(oscillator_t* osc, int voice, float frequency, float amplitude)
+{
+  // the increment is the frequency in turns per sample, 2^32 being one turn, computed in
+  // double precision once per call for the full 32 bit resolution. The negative frequencies
+  // run backwards and the ones above the sample rate alias.
+  double turns = (double)frequency / osc->sampleRate;
+  turns -= floor(turns);
+  osc->increment[voice] = (uint32_t)(int64_t)(turns * 4294967296.0);
+  osc->amplitude[voice] = (q15_t)__SSAT((q31_t)(amplitude * 32768.0f), 16);
+}
+
+void setOscillatorPhase(oscillator_t* osc, int voice, float phase)
+{
+  // a fraction that rounds up to a whole turn wraps to zero in the conversion through 64 bits
+  phase -= floorf(phase);
+  osc->phase[voice] = (uint32_t)(int64_t)(phase * 4294967296.0f);
+}
+
+void renderOscillators(oscillator_t* osc, int16_t* buffer, int length)
+{
+  int n, v, voices = osc->voices;
+  q31_t sum;
+
+  for (n = 0; n < length; n++)
+  {
+    sum = 0;
+    for (v = 0; v < voices; v++)
+    {
+      sum += (sine(osc->phase[v]) * osc->amplitude[v] + 0x4000) >> 15;
+      osc->phase[v] += osc->increment[v];
+    }
+    buffer[n] = (int16_t)__SSAT(sum, 16);
+  }
+}
+
+void renderOscillator(oscillator_t* osc, int voice, int16_t* buffer, int length)
+{
+  // the voice state in registers for the loop
+  uint32_t phase = osc->phase[voice];
+  uint32_t increment = osc->increment[voice];
+  q31_t amplitude = osc->amplitude[voice];
+  int n;
+
+  for (n = 0; n < length; n++)
+  {
+    buffer[n] = (int16_t)((sine(phase) * amplitude + 0x4000) >> 15);
+    phase += increment;
+  }
+
+  osc->phase[voice] = phase;
+}
+
+int16_t stepOscillator(oscillator_t* osc, int voice, int samples)
+{
+  int16_t value = (int16_t)((sine(osc->phase[voice]) * osc->amplitude[voice] + 0x4000) >> 15);
+  osc->phase[voice] += osc->increment[voice] * (uint32_t)samples;
+  return value;
+}